@@ -425,7 +425,7 @@ static inline __m256 _mm256_copysign_ps(__m256 x, __m256 y) {
 	);
 }
 
-static inline __m256 _mm_fdim_ps(__m256 x, __m256 y) {
+static inline __m256 _mm256_fdim_ps(__m256 x, __m256 y) {
 	__m256 ret;
 	ret = _mm256_sub_ps(x, y);
 	// returns true when ret > 0.0 or ret is NaN
@@ -483,6 +483,19 @@ static inline __m256 _mm256_fmin_ps(__m256 x, __m256 y) {
 }
 #endif
 
+//------------------------------------------------------------------------------
+// __m256 SVML replacement functions
+//------------------------------------------------------------------------------
+
+#ifndef _mm256_trunc_ps
+/**
+ * @brief _mm256_trunc_ps replacement function.
+ */
+static inline __m256 _mm256_trunc_ps(__m256 x) {
+	return _mm256_round_ps(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+}
+#endif
+
 #ifdef __cplusplus
 	}
 #endif
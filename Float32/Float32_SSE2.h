@@ -0,0 +1,551 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#ifndef FLOAT32_SSE2_H
+#define FLOAT32_SSE2_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <math.h>
+#include <emmintrin.h>
+
+#ifdef __SSE4_1__
+	#include <smmintrin.h>
+#endif
+#ifdef __SSE4_2__
+	#include <nmmintrin.h>
+#endif
+#ifdef __AVX__
+	#include <immintrin.h>
+#endif
+
+#if (!defined(__SSE2__) && defined(__GNUC__))
+	#error "__SSE2__ is not enabled in your compiler. Try -msse2"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//------------------------------------------------------------------------------
+// __m128 mathematical constants
+//------------------------------------------------------------------------------
+
+/**
+ * @brief ~2.718281828 Returns the value of euler's number
+ */
+static inline __m128 _mm_const_e_ps(void) {
+	return _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x402DF854));
+}
+
+/**
+ * @brief ~1.442695041 Returns the value of log2(e)
+ */
+static inline __m128 _mm_const_log2e_ps(void) {
+	return _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3FB8AA3B));
+}
+
+/**
+ * @brief ~0.434294482 Returns the value of log10(e)
+ */
+static inline __m128 _mm_const_log10e_ps(void) {
+	return _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3EDE5BD9));
+}
+
+/**
+ * @brief ~3.141592654 Returns the value of pi
+ */
+static inline __m128 _mm_const_pi_ps(void) {
+	return _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x40490FDB));
+}
+
+/**
+ * @brief ~0.318309886 Returns the value of 1 / pi
+ */
+static inline __m128 _mm_const_inv_pi_ps(void) {
+	return _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3EA2F983));
+}
+
+/**
+ * @brief ~0.564189584 Returns the value of 1 / sqrt(pi)
+ */
+static inline __m128 _mm_const_inv_sqrtpi_ps(void) {
+	return _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3F106EBB));
+}
+
+/**
+ * @brief ~0.693147181 Returns the value of ln(2)
+ */
+static inline __m128 _mm_const_ln2_ps(void) {
+	return _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3F317218));
+}
+
+/**
+ * @brief ~2.302585093 Returns the value of ln(10)
+ */
+static inline __m128 _mm_const_ln10_ps(void) {
+	return _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x40135D8E));
+}
+
+/**
+ * @brief ~1.414213562 Returns the value of sqrt(2)
+ */
+static inline __m128 _mm_const_sqrt2_ps(void) {
+	return _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3FB504F3));
+}
+
+/**
+ * @brief ~1.732050808 Returns the value of sqrt(3)
+ */
+static inline __m128 _mm_const_sqrt3_ps(void) {
+	return _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3FDDB3D7));
+}
+
+/**
+ * @brief ~0.577350269 Returns the value of 1 / sqrt(3)
+ */
+static inline __m128 _mm_const_inv_sqrt3_ps(void) {
+	return _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3F13CD3A));
+}
+
+/**
+ * @brief ~0.577215665 Returns the value of gamma (The Euler–Mascheroni constant)
+ */
+static inline __m128 _mm_const_egamma_ps(void) {
+	return _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3F13C468));
+}
+
+/**
+ * @brief ~1.618033989 Returns the value of phi (The golden ratio)
+ */
+static inline __m128 _mm_const_phi_ps(void) {
+	return _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3FCF1BBD));
+}
+
+//------------------------------------------------------------------------------
+// __m128 floating point manipulation
+//------------------------------------------------------------------------------
+
+/** @brief Returns a __m128 value set to positive infinity */
+static inline __m128 _mm_get_infinity_ps(void) {
+	return _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7F800000));
+}
+
+/** @brief Returns a __m128 value set to signaling NaN */
+static inline __m128 _mm_get_sNaN_ps(void) {
+	return _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7F800001));
+}
+
+/** @brief Returns a __m128 value set to quiet NaN */
+static inline __m128 _mm_get_qNaN_ps(void) {
+	return _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7FC00001));
+}
+
+/** @brief Returns the bitmask for extracting the sign bit */
+static inline __m128 _mm_get_sign_mask_ps(void) {
+	return _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x80000000));
+}
+
+/** @brief Returns the bitmask for extracting the exponent bits */
+static inline __m128 _mm_get_exponent_mask_ps(void) {
+	return _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7F800000));
+}
+
+/** @brief Returns the bitmask for extracting the mantissa bits */
+static inline __m128 _mm_get_mantissa_mask_ps(void) {
+	return _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x007FFFFF));
+}
+
+/** @brief Extracts the exponent via a bitmask */
+static inline __m128 _mm_extract_exponent_ps(const __m128 x) {
+	return _mm_and_ps(x, _mm_get_exponent_mask_ps());
+}
+
+/** @brief Extracts the mantissa via a bitmask */
+static inline __m128 _mm_extract_mantissa_ps(const __m128 x) {
+	return _mm_and_ps(x, _mm_get_mantissa_mask_ps());
+}
+
+//------------------------------------------------------------------------------
+// __m128 blendv replacement
+//------------------------------------------------------------------------------
+
+#ifdef __SSE4_1__
+
+static inline __m128 _internal_mm_blendv_ps(__m128 false_case, __m128 true_case, __m128 mask) {
+	return _mm_blendv_ps(false_case, true_case, mask);
+}
+
+#else
+
+/** @note Unlike _mm_blendv_ps, every bit of mask must be set or cleared */
+static inline __m128 _internal_mm_blendv_ps(__m128 false_case, __m128 true_case, __m128 mask) {
+	return _mm_or_ps(_mm_andnot_ps(mask, false_case), _mm_and_ps(true_case, mask));
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+// __m128 floating point classify
+//------------------------------------------------------------------------------
+
+#ifdef __SSE4_1__
+
+/** @brief Returns true if x is negative */
+static inline __m128 _mm_signbit_ps(const __m128 x) {
+	return _mm_blendv_ps(
+		_mm_setzero_ps(),
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0xFFFFFFFF)),
+		x
+	);
+}
+
+#else
+
+/** @brief Returns true if x is negative */
+static inline __m128 _mm_signbit_ps(const __m128 x) {
+	/**
+	 * Extracts the signbit from x, and performs a bitwise OR with 1.0, setting
+	 * the value to be either +1.0 or -1.0
+	 */
+	return
+		_mm_cmpeq_ps(
+			_mm_or_ps(
+				_mm_and_ps(x, _mm_get_sign_mask_ps()), _mm_set1_ps(1.0f)
+			),
+			_mm_set1_ps(-1.0f)
+		);
+}
+
+#endif
+
+/** @brief Returns true if x is finite */
+static inline __m128 _mm_isfinite_ps(const __m128 x) {
+	// extract the exponent, and check that it is not all ones
+	__m128 x_exp = _mm_extract_exponent_ps(x);
+	return _mm_cmpneq_ps(x_exp, _mm_get_exponent_mask_ps());
+}
+
+/** @brief Returns true if x is +-infinity */
+static inline __m128 _mm_isinf_ps(const __m128 x) {
+	return _mm_cmpeq_ps(
+		_mm_and_ps(
+			x,
+			_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7FFFFFFF))
+		),
+		_mm_get_infinity_ps()
+	);
+}
+
+/** @brief Returns true if x is any kind of NaN */
+static inline __m128 _mm_isnan_ps(const __m128 x) {
+	return _mm_cmpunord_ps(x, x);
+}
+
+/** @brief Returns true if x is normal */
+static inline __m128 _mm_isnormal_ps(const __m128 x) {
+	// extract the exponent, and check that it is not all ones or zeros
+	__m128 x_exp = _mm_extract_exponent_ps(x);
+	return _mm_and_ps(
+		_mm_cmpneq_ps(x_exp, _mm_get_exponent_mask_ps()),
+		_mm_cmpneq_ps(x_exp, _mm_setzero_ps())
+	);
+}
+
+/** @brief Returns true if x is denormal */
+static inline __m128 _mm_isdenormal_ps(const __m128 x) {
+	// check that x is not equal to zero, and that the exponent is all zeros
+	__m128 x_exp = _mm_extract_exponent_ps(x);
+	return _mm_and_ps(
+		_mm_cmpneq_ps(x, _mm_setzero_ps()),
+		_mm_cmpeq_ps(x_exp, _mm_setzero_ps())
+	);
+}
+
+//------------------------------------------------------------------------------
+// __m128 comparison
+//------------------------------------------------------------------------------
+
+#ifdef __AVX__
+
+	#ifndef _mm_cmplg_ps
+	/** @brief `x <> y` unordered not-equals */
+	static inline __m128 _mm_cmplg_ps(__m128 x, __m128 y) {
+		return _mm_cmp_ps(x, y, _CMP_NEQ_UQ);
+	}
+	#endif
+
+	#ifndef _mm_cmpnlg_ps
+	/** @brief `x !<> y` unordered equals */
+	static inline __m128 _mm_cmpnlg_ps(__m128 x, __m128 y) {
+		return _mm_cmp_ps(x, y, _CMP_EQ_UQ);
+	}
+	#endif
+
+#else
+
+	#ifndef _mm_cmplg_ps
+	/** @brief `x <> y` unordered not-equals */
+	static inline __m128 _mm_cmplg_ps(__m128 x, __m128 y) {
+		return _mm_or_ps(_mm_cmplt_ps(x, y), _mm_cmpgt_ps(x, y));
+	}
+	#endif
+
+	#ifndef _mm_cmpnlg_ps
+	/** @brief `x !<> y` unordered equals */
+	static inline __m128 _mm_cmpnlg_ps(__m128 x, __m128 y) {
+		return _mm_and_ps(_mm_cmpnlt_ps(x, y), _mm_cmpngt_ps(x, y));
+	}
+	#endif
+
+#endif
+
+//------------------------------------------------------------------------------
+// __m128 math.h comparison
+//------------------------------------------------------------------------------
+
+/** @brief Returns true if either x or y are NaN (Unordered) */
+static inline __m128 _mm_isunordered_ps(__m128 x, __m128 y) {
+	return _mm_cmpunord_ps(x, y);
+}
+
+/** @brief `x <> y` unordered not-equals */
+static inline __m128 _mm_islessgreater_ps(__m128 x, __m128 y) {
+	return _mm_cmplg_ps(x, y);
+}
+
+/** @brief `x < y` ordered less-than */
+static inline __m128 _mm_isless_ps(__m128 x, __m128 y) {
+	return _mm_cmplt_ps(x, y);
+}
+
+/** @brief `x <= y` ordered less-equal */
+static inline __m128 _mm_islessequal_ps(__m128 x, __m128 y) {
+	return _mm_cmple_ps(x, y);
+}
+
+/** @brief `x > y` ordered greater-than */
+static inline __m128 _mm_isgreater_ps(__m128 x, __m128 y) {
+	return _mm_cmpgt_ps(x, y);
+}
+
+/** @brief `x >= y` ordered greater-equal */
+static inline __m128 _mm_isgreaterequal_ps(__m128 x, __m128 y) {
+	return _mm_cmpge_ps(x, y);
+}
+
+//------------------------------------------------------------------------------
+// __m128 math.h functions
+//------------------------------------------------------------------------------
+
+#ifndef _mm_negate_ps 
+/**
+ * @brief `-x` Negates a __m128 value (Multiplies by -1.0)
+ */
+static inline __m128 _mm_negate_ps(__m128 x) {
+	// return _mm_xor_ps(
+	// 	x,
+	// 	_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x80000000))
+	// );
+	return _mm_mul_ps(x, _mm_set1_ps(-1.0f));
+}
+#endif
+
+#ifndef _mm_recip_ps 
+/**
+ * @brief `1 / x` Calculates the reciprocal of a __m128 value
+ */
+static inline __m128 _mm_recip_ps(__m128 x) {
+	return _mm_div_ps(_mm_set1_ps(1.0f), x);
+}
+#endif
+
+#ifndef _mm_square_ps 
+/**
+ * @brief `x * x` Squares a __m128 value
+ */
+static inline __m128 _mm_square_ps(__m128 x) {
+	return _mm_mul_ps(x, x);
+}
+#endif
+
+#ifndef _mm_fabs_ps
+/**
+ * @brief `|x|` Returns the absolute value of a __m128 value
+ * @remarks _mm_andnot_ps cannot be used because 0x80000000 gets
+ * converted from -0.0 to 0.0 on -Ofast
+ */
+static inline __m128 _mm_fabs_ps(__m128 x) {
+	return _mm_and_ps(
+		x,
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7FFFFFFF))
+	);
+}
+#endif
+
+#ifndef _mm_not_ps
+static inline __m128 _mm_not_ps(__m128 x) {
+	return _mm_xor_ps(
+		x,
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0xFFFFFFFF))
+	);
+}
+#endif
+
+static inline __m128 _mm_copysign_ps(__m128 x, __m128 y) {
+	return _mm_xor_ps(
+		y, _mm_and_ps(
+			_mm_xor_ps(x, y),
+			_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7FFFFFFF))
+		)
+	);
+}
+
+static inline __m128 _mm_fdim_ps(__m128 x, __m128 y) {
+	__m128 ret;
+	ret = _mm_sub_ps(x, y);
+	// returns true when ret > 0.0 or ret is NaN
+	__m128 cmp_nle = _mm_cmpnle_ps(ret, _mm_setzero_ps());
+	// NaN remains NaN, and -0.0 becomes +0.0
+	ret = _mm_and_ps(ret, cmp_nle);
+	return ret;
+}
+
+#ifdef __SSE4_1__
+
+#ifndef _mm_fmax_ps
+/**
+ * @brief Returns the fmax of x and y. Correctly handling NaN and signed zeros.
+ * You may use _mm_max_ps as a faster alternative.
+ */
+static inline __m128 _mm_fmax_ps(__m128 x, __m128 y) {
+	__m128 fmax_cmp =
+		_mm_or_ps(
+			_mm_andnot_ps(
+				_mm_or_ps(
+					_mm_andnot_ps(
+						_mm_signbit_ps(x),
+						_mm_isnan_ps(y)
+					),
+					_mm_isnan_ps(x)
+				),
+				_mm_cmplt_ps(y, x)
+			),
+			_mm_cmplt_ps(x, y)
+		);
+	return _mm_blendv_ps(x, y, fmax_cmp);
+}
+#endif
+
+#ifndef _mm_fmin_ps
+/**
+ * @brief Returns the fmin of x and y. Correctly handling NaN and signed zeros.
+ * You may use _mm_min_ps as a faster alternative.
+ */
+static inline __m128 _mm_fmin_ps(__m128 x, __m128 y) {
+	__m128 fmin_cmp =
+		_mm_or_ps(
+			_mm_andnot_ps(
+				_mm_or_ps(
+					_mm_andnot_ps(
+						_mm_signbit_ps(x),
+						_mm_isnan_ps(y)
+					),
+					_mm_isnan_ps(x)
+				),
+				_mm_cmpgt_ps(y, x)
+			),
+			_mm_cmpgt_ps(x, y)
+		);
+	return _mm_blendv_ps(x, y, fmin_cmp);
+}
+#endif
+
+#ifndef _mm_trunc_ps
+/**
+ * @brief _mm_trunc_ps replacement function.
+ */
+static inline __m128 _mm_trunc_ps(__m128 x) {
+	return _mm_round_ps(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+}
+#endif
+
+#endif
+
+//------------------------------------------------------------------------------
+// __m128 rounding
+//------------------------------------------------------------------------------
+
+#ifdef __SSE4_1__
+
+/**
+ * @brief Rounds to the nearest integer, with ties rounding to even.
+ */
+static inline __m128 _mm_nearbyint_ps(__m128 x) {
+	return _mm_round_ps(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+
+#else
+
+/**
+ * @brief Rounds to the nearest integer, with ties rounding to even.
+ * Adding and subtracting 2^23 rounds away the fractional bits of |x|.
+ */
+static inline __m128 _mm_nearbyint_ps(__m128 x) {
+	const __m128 round_const = _mm_set1_ps(8388608.0f);
+	const __m128 abs_x = _mm_fabs_ps(x);
+	__m128 ret = _mm_sub_ps(_mm_add_ps(abs_x, round_const), round_const);
+	ret = _mm_copysign_ps(ret, x);
+	// |x| >= 2^23 is already an integer. NaN is returned unchanged
+	return _internal_mm_blendv_ps(x, ret, _mm_cmplt_ps(abs_x, round_const));
+}
+
+#ifndef _mm_trunc_ps
+/**
+ * @brief _mm_trunc_ps replacement function using SSE2.
+ */
+static inline __m128 _mm_trunc_ps(__m128 x) {
+	const __m128 abs_x = _mm_fabs_ps(x);
+	__m128 ret = _mm_nearbyint_ps(abs_x);
+	// Subtracts 1.0 if |x| was rounded up
+	ret = _mm_sub_ps(ret, _mm_and_ps(_mm_cmpgt_ps(ret, abs_x), _mm_set1_ps(1.0f)));
+	return _mm_copysign_ps(ret, x);
+}
+#endif
+
+#ifndef _mm_floor_ps
+/**
+ * @brief _mm_floor_ps replacement function using SSE2.
+ */
+static inline __m128 _mm_floor_ps(__m128 x) {
+	__m128 ret = _mm_nearbyint_ps(x);
+	// Subtracts 1.0 if x was rounded up
+	return _mm_sub_ps(ret, _mm_and_ps(_mm_cmpgt_ps(ret, x), _mm_set1_ps(1.0f)));
+}
+#endif
+
+#ifndef _mm_ceil_ps
+/**
+ * @brief _mm_ceil_ps replacement function using SSE2.
+ */
+static inline __m128 _mm_ceil_ps(__m128 x) {
+	__m128 ret = _mm_nearbyint_ps(x);
+	// Adds 1.0 if x was rounded down
+	ret = _mm_add_ps(ret, _mm_and_ps(_mm_cmplt_ps(ret, x), _mm_set1_ps(1.0f)));
+	// ceil(x) is -0.0 when x is within (-1.0, -0.0]
+	return _mm_copysign_ps(ret, x);
+}
+#endif
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FLOAT32_SSE2_H */
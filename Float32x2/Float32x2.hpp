@@ -18,6 +18,7 @@
 #include <limits>
 
 #include "../LDF/LDF_arithmetic.hpp"
+#include "../LDF/LDF_fma.h"
 
 #include "../Float64/Float64.h"
 
@@ -239,6 +240,12 @@ Float32x2 LDF::sub<Float32x2, Float32x2, Float32x2>
 template <> inline
 Float32x2 LDF::mul<Float32x2, fp32, fp32>
 (const fp32& x, const fp32& y) {
+#ifdef LDF_ENABLE_FMA
+	Float32x2 r;
+	r.hi = x * y;
+	r.lo = std::fma(x, y, -r.hi);
+	return r;
+#else
 	Float32x2 a = dekker_split(x);
 	Float32x2 b = dekker_split(y);
 	fp32 p = a.hi * b.hi;
@@ -248,6 +255,7 @@ Float32x2 LDF::mul<Float32x2, fp32, fp32>
 	r.hi = p + q;
 	r.lo = p - r.hi + q + a.lo * b.lo;
 	return r;
+#endif
 }
 
 template <> inline
@@ -281,6 +289,12 @@ Float32x2 LDF::div<Float32x2, Float32x2, Float32x2>
 template <> inline
 Float32x2 LDF::square<Float32x2, fp32>
 (const fp32& x) {
+#ifdef LDF_ENABLE_FMA
+	Float32x2 r;
+	r.hi = x * x;
+	r.lo = std::fma(x, x, -r.hi);
+	return r;
+#else
 	Float32x2 a = dekker_split(x);
 	fp32 p = a.hi * a.hi;
 	fp32 q = static_cast<fp32>(2.0) * (a.hi * a.lo);
@@ -289,6 +303,7 @@ Float32x2 LDF::square<Float32x2, fp32>
 	r.hi = p + q;
 	r.lo = ((p - r.hi) + q) + (a.lo * a.lo);
 	return r;
+#endif
 }
 
 template <> inline
@@ -972,6 +987,62 @@ namespace std {
 		sincos(x, sin_val, cos_val);
 		return sin_val / cos_val;
 	}
+	/**
+	 * @brief Calculates `sin(pi * x)` and `cos(pi * x)`.
+	 * @note Each limb is reduced modulo 2 exactly, and x = r + n / 2 is then
+	 * split off so that sin and cos are calculated in Float32x2_Math with
+	 * |r * pi| <= pi/4.
+	 */
+	inline void sincospi(const Float32x2 x, Float32x2& p_sin, Float32x2& p_cos) {
+		if (!isfinite(x)) {
+			p_sin = std::numeric_limits<Float32x2>::quiet_NaN();
+			p_cos = std::numeric_limits<Float32x2>::quiet_NaN();
+			return;
+		}
+		Float32x2_Math r =
+			static_cast<Float32x2_Math>(x.hi - static_cast<fp32>(2.0) * round(x.hi * static_cast<fp32>(0.5))) +
+			static_cast<Float32x2_Math>(x.lo - static_cast<fp32>(2.0) * round(x.lo * static_cast<fp32>(0.5)));
+		const Float32x2_Math n = round(r * static_cast<Float32x2_Math>(2.0));
+		r -= n * static_cast<Float32x2_Math>(0.5);
+		r *= LDF::const_pi<Float32x2_Math>();
+		const Float32x2 sin_r = static_cast<Float32x2>(sin(r));
+		const Float32x2 cos_r = static_cast<Float32x2>(cos(r));
+		switch (static_cast<int>(n) & 3) {
+			case 0:
+				p_sin = sin_r;
+				p_cos = cos_r;
+				return;
+			case 1:
+				p_sin = cos_r;
+				p_cos = -sin_r;
+				return;
+			case 2:
+				p_sin = -sin_r;
+				p_cos = -cos_r;
+				return;
+			default:
+				p_sin = -cos_r;
+				p_cos = sin_r;
+				return;
+		}
+	}
+	/** @brief Calculates `sin(pi * x)`. Calls `sincospi`. */
+	inline Float32x2 sinpi(const Float32x2 x) {
+		Float32x2 sin_val, cos_val;
+		sincospi(x, sin_val, cos_val);
+		return sin_val;
+	}
+	/** @brief Calculates `cos(pi * x)`. Calls `sincospi`. */
+	inline Float32x2 cospi(const Float32x2 x) {
+		Float32x2 sin_val, cos_val;
+		sincospi(x, sin_val, cos_val);
+		return cos_val;
+	}
+	inline Float32x2 tanpi(const Float32x2 x) {
+		Float32x2 sin_val, cos_val;
+		sincospi(x, sin_val, cos_val);
+		return sin_val / cos_val;
+	}
 	/** 
 	 * @note casts to Float32x2_Math for calculation as this function is not
 	 * currently implemeneted.
@@ -0,0 +1,324 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+/**
+ * Compiles this file for AVX even when the rest of the library targets an
+ * older CPU, so that the runtime dispatch in Float32x2_array.cpp can use it.
+ */
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__AVX__)
+	#pragma GCC target("avx")
+#endif
+
+#include "Float32x2_AVX.h"
+#include "../Float64/Float64_AVX.h"
+
+#include <immintrin.h>
+
+//------------------------------------------------------------------------------
+// __m256x2 conversions to and from __m256d
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Converts the lower four floats of a __m256 to a __m256d
+ */
+static inline __m256d _internal_mm256_cvtps_lo_pd(const __m256 x) {
+	return _mm256_cvtps_pd(_mm256_castps256_ps128(x));
+}
+
+/**
+ * @brief Converts the upper four floats of a __m256 to a __m256d
+ */
+static inline __m256d _internal_mm256_cvtps_hi_pd(const __m256 x) {
+	return _mm256_cvtps_pd(_mm256_extractf128_ps(x, 1));
+}
+
+/**
+ * @brief Rounds a pair of __m256d to a __m256x2. The lower four lanes come
+ * from x0, and the upper four lanes come from x1.
+ */
+static inline __m256x2 _internal_mm256x2_cvtpd_psx2(
+	const __m256d x0, const __m256d x1
+) {
+	const __m128 hi0 = _mm256_cvtpd_ps(x0);
+	const __m128 hi1 = _mm256_cvtpd_ps(x1);
+	const __m256d hi0_pd = _mm256_cvtps_pd(hi0);
+	const __m256d hi1_pd = _mm256_cvtps_pd(hi1);
+	// The low part is set to zero when the high part is infinite or NaN
+	const __m128 lo0 = _mm256_cvtpd_ps(_mm256_and_pd(
+		_mm256_sub_pd(x0, hi0_pd), _mm256_isfinite_pd(hi0_pd)
+	));
+	const __m128 lo1 = _mm256_cvtpd_ps(_mm256_and_pd(
+		_mm256_sub_pd(x1, hi1_pd), _mm256_isfinite_pd(hi1_pd)
+	));
+	__m256x2 ret;
+	ret.hi = _mm256_insertf128_ps(_mm256_castps128_ps256(hi0), hi1, 1);
+	ret.lo = _mm256_insertf128_ps(_mm256_castps128_ps256(lo0), lo1, 1);
+	return ret;
+}
+
+/**
+ * @brief returns a mask of the lanes where x is not zero.
+ */
+static inline __m256d _internal_mm256_cmpneqzero_pd(const __m256d x) {
+	return _mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_NEQ_UQ);
+}
+
+//------------------------------------------------------------------------------
+// __m256x2 exponents and logarithms
+//------------------------------------------------------------------------------
+
+/**
+ * @brief exp(hi + lo) = exp(hi) * (1 + lo + lo^2 / 2)
+ */
+static inline __m256d _internal_mm256x2_exp_pd(
+	const __m256d hi, const __m256d lo
+) {
+	const __m256d correction = _mm256_add_pd(_mm256_set1_pd(1.0), _mm256_mul_pd(
+		lo, _mm256_add_pd(_mm256_set1_pd(1.0), _mm256_mul_pd(lo, _mm256_set1_pd(0.5)))
+	));
+	return _mm256_mul_pd(_mm256_exp_pd(hi), correction);
+}
+
+__m256x2 _mm256x2_exp_psx2(const __m256x2 x) {
+	return _internal_mm256x2_cvtpd_psx2(
+		_internal_mm256x2_exp_pd(
+			_internal_mm256_cvtps_lo_pd(x.hi), _internal_mm256_cvtps_lo_pd(x.lo)
+		),
+		_internal_mm256x2_exp_pd(
+			_internal_mm256_cvtps_hi_pd(x.hi), _internal_mm256_cvtps_hi_pd(x.lo)
+		)
+	);
+}
+
+/**
+ * @brief expm1(hi + lo) = expm1(hi) + (expm1(hi) + 1) * (lo + lo^2 / 2)
+ */
+static inline __m256d _internal_mm256x2_expm1_pd(
+	const __m256d hi, const __m256d lo
+) {
+	const __m256d em1 = _mm256_expm1_pd(hi);
+	__m256d correction = _mm256_mul_pd(
+		_mm256_add_pd(em1, _mm256_set1_pd(1.0)),
+		_mm256_mul_pd(
+			lo, _mm256_add_pd(_mm256_set1_pd(1.0), _mm256_mul_pd(lo, _mm256_set1_pd(0.5)))
+		)
+	);
+	correction = _mm256_and_pd(correction, _internal_mm256_cmpneqzero_pd(lo));
+	return _mm256_add_pd(em1, correction);
+}
+
+__m256x2 _mm256x2_expm1_psx2(const __m256x2 x) {
+	return _internal_mm256x2_cvtpd_psx2(
+		_internal_mm256x2_expm1_pd(
+			_internal_mm256_cvtps_lo_pd(x.hi), _internal_mm256_cvtps_lo_pd(x.lo)
+		),
+		_internal_mm256x2_expm1_pd(
+			_internal_mm256_cvtps_hi_pd(x.hi), _internal_mm256_cvtps_hi_pd(x.lo)
+		)
+	);
+}
+
+/**
+ * @brief log(hi + lo) = log(hi) + q - q^2 / 2, where q = lo / hi
+ */
+static inline __m256d _internal_mm256x2_log_pd(
+	const __m256d hi, const __m256d lo
+) {
+	const __m256d q = _mm256_div_pd(lo, hi);
+	__m256d correction = _mm256_mul_pd(
+		q, _mm256_sub_pd(_mm256_set1_pd(1.0), _mm256_mul_pd(q, _mm256_set1_pd(0.5)))
+	);
+	correction = _mm256_and_pd(correction, _internal_mm256_cmpneqzero_pd(lo));
+	return _mm256_add_pd(_mm256_log_pd(hi), correction);
+}
+
+__m256x2 _mm256x2_log_psx2(const __m256x2 x) {
+	return _internal_mm256x2_cvtpd_psx2(
+		_internal_mm256x2_log_pd(
+			_internal_mm256_cvtps_lo_pd(x.hi), _internal_mm256_cvtps_lo_pd(x.lo)
+		),
+		_internal_mm256x2_log_pd(
+			_internal_mm256_cvtps_hi_pd(x.hi), _internal_mm256_cvtps_hi_pd(x.lo)
+		)
+	);
+}
+
+/**
+ * @brief log1p(hi + lo) = log1p(hi) + q - q^2 / 2, where q = lo / (1 + hi)
+ */
+static inline __m256d _internal_mm256x2_log1p_pd(
+	const __m256d hi, const __m256d lo
+) {
+	const __m256d q = _mm256_div_pd(lo, _mm256_add_pd(_mm256_set1_pd(1.0), hi));
+	__m256d correction = _mm256_mul_pd(
+		q, _mm256_sub_pd(_mm256_set1_pd(1.0), _mm256_mul_pd(q, _mm256_set1_pd(0.5)))
+	);
+	correction = _mm256_and_pd(correction, _internal_mm256_cmpneqzero_pd(lo));
+	return _mm256_add_pd(_mm256_log1p_pd(hi), correction);
+}
+
+__m256x2 _mm256x2_log1p_psx2(const __m256x2 x) {
+	return _internal_mm256x2_cvtpd_psx2(
+		_internal_mm256x2_log1p_pd(
+			_internal_mm256_cvtps_lo_pd(x.hi), _internal_mm256_cvtps_lo_pd(x.lo)
+		),
+		_internal_mm256x2_log1p_pd(
+			_internal_mm256_cvtps_hi_pd(x.hi), _internal_mm256_cvtps_hi_pd(x.lo)
+		)
+	);
+}
+
+//------------------------------------------------------------------------------
+// __m256x2 trigonometry
+//------------------------------------------------------------------------------
+
+/**
+ * @brief sin(hi + lo) = sin(hi) + (cos(hi) * lo - sin(hi) * lo^2 / 2)
+ * cos(hi + lo) = cos(hi) - (sin(hi) * lo + cos(hi) * lo^2 / 2)
+ */
+static inline void _internal_mm256x2_sincos_pd(
+	const __m256d hi, const __m256d lo, __m256d* p_sin, __m256d* p_cos
+) {
+	__m256d cos_val;
+	const __m256d sin_val = _mm256_sincos_pd(&cos_val, hi);
+	const __m256d half_lo_sqr = _mm256_mul_pd(_mm256_mul_pd(lo, lo), _mm256_set1_pd(0.5));
+	*p_sin = _mm256_add_pd(sin_val, _mm256_sub_pd(
+		_mm256_mul_pd(cos_val, lo), _mm256_mul_pd(sin_val, half_lo_sqr)
+	));
+	*p_cos = _mm256_sub_pd(cos_val, _mm256_add_pd(
+		_mm256_mul_pd(sin_val, lo), _mm256_mul_pd(cos_val, half_lo_sqr)
+	));
+}
+
+__m256x2 _mm256x2_sin_psx2(const __m256x2 x) {
+	__m256d sin0, cos0, sin1, cos1;
+	_internal_mm256x2_sincos_pd(
+		_internal_mm256_cvtps_lo_pd(x.hi), _internal_mm256_cvtps_lo_pd(x.lo),
+		&sin0, &cos0
+	);
+	_internal_mm256x2_sincos_pd(
+		_internal_mm256_cvtps_hi_pd(x.hi), _internal_mm256_cvtps_hi_pd(x.lo),
+		&sin1, &cos1
+	);
+	return _internal_mm256x2_cvtpd_psx2(sin0, sin1);
+}
+
+__m256x2 _mm256x2_cos_psx2(const __m256x2 x) {
+	__m256d sin0, cos0, sin1, cos1;
+	_internal_mm256x2_sincos_pd(
+		_internal_mm256_cvtps_lo_pd(x.hi), _internal_mm256_cvtps_lo_pd(x.lo),
+		&sin0, &cos0
+	);
+	_internal_mm256x2_sincos_pd(
+		_internal_mm256_cvtps_hi_pd(x.hi), _internal_mm256_cvtps_hi_pd(x.lo),
+		&sin1, &cos1
+	);
+	return _internal_mm256x2_cvtpd_psx2(cos0, cos1);
+}
+
+void _mm256x2_sincos_psx2(
+	const __m256x2 theta, __m256x2* const p_sin, __m256x2* const p_cos
+) {
+	__m256d sin0, cos0, sin1, cos1;
+	_internal_mm256x2_sincos_pd(
+		_internal_mm256_cvtps_lo_pd(theta.hi), _internal_mm256_cvtps_lo_pd(theta.lo),
+		&sin0, &cos0
+	);
+	_internal_mm256x2_sincos_pd(
+		_internal_mm256_cvtps_hi_pd(theta.hi), _internal_mm256_cvtps_hi_pd(theta.lo),
+		&sin1, &cos1
+	);
+	*p_sin = _internal_mm256x2_cvtpd_psx2(sin0, sin1);
+	*p_cos = _internal_mm256x2_cvtpd_psx2(cos0, cos1);
+}
+
+/**
+ * @brief Computes sin(pi * (hi + lo)) and cos(pi * (hi + lo)). Each limb is
+ * reduced modulo 2 exactly, and x = r + n / 2 is then split off so that
+ * |r * pi| <= pi/4.
+ */
+static inline void _internal_mm256x2_sincospi_pd(
+	const __m256d hi, const __m256d lo, __m256d* p_sin, __m256d* p_cos
+) {
+	const __m256d two = _mm256_set1_pd(2.0);
+	const __m256d half = _mm256_set1_pd(0.5);
+	/* limb - 2 * round(limb / 2) is exact */
+	__m256d r = _mm256_add_pd(
+		_mm256_sub_pd(hi, _mm256_mul_pd(two, _mm256_round_pd(
+			_mm256_mul_pd(hi, half), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC
+		))),
+		_mm256_sub_pd(lo, _mm256_mul_pd(two, _mm256_round_pd(
+			_mm256_mul_pd(lo, half), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC
+		)))
+	);
+	const __m256d n = _mm256_round_pd(
+		_mm256_mul_pd(r, two), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC
+	);
+	r = _mm256_sub_pd(r, _mm256_mul_pd(n, half));
+	r = _mm256_mul_pd(r, _mm256_const_pi_pd());
+
+	__m256d cos_val;
+	const __m256d sin_val = _mm256_sincos_pd(&cos_val, r);
+
+	/* Applies the quadrant (n mod 4) */
+	const __m256d quadrant = _mm256_sub_pd(n, _mm256_mul_pd(
+		_mm256_floor_pd(_mm256_mul_pd(n, _mm256_set1_pd(0.25))), _mm256_set1_pd(4.0)
+	));
+	const __m256d quadrant_1 = _mm256_cmp_pd(quadrant, _mm256_set1_pd(1.0), _CMP_EQ_OQ);
+	const __m256d quadrant_2 = _mm256_cmp_pd(quadrant, _mm256_set1_pd(2.0), _CMP_EQ_OQ);
+	const __m256d quadrant_3 = _mm256_cmp_pd(quadrant, _mm256_set1_pd(3.0), _CMP_EQ_OQ);
+	const __m256d swap = _mm256_or_pd(quadrant_1, quadrant_3);
+	const __m256d sign_bit = _mm256_set1_pd(-0.0);
+	const __m256d sin_sign = _mm256_and_pd(_mm256_or_pd(quadrant_2, quadrant_3), sign_bit);
+	const __m256d cos_sign = _mm256_and_pd(_mm256_or_pd(quadrant_1, quadrant_2), sign_bit);
+
+	*p_sin = _mm256_xor_pd(_mm256_blendv_pd(sin_val, cos_val, swap), sin_sign);
+	*p_cos = _mm256_xor_pd(_mm256_blendv_pd(cos_val, sin_val, swap), cos_sign);
+}
+
+__m256x2 _mm256x2_sinpi_psx2(const __m256x2 x) {
+	__m256d sin0, cos0, sin1, cos1;
+	_internal_mm256x2_sincospi_pd(
+		_internal_mm256_cvtps_lo_pd(x.hi), _internal_mm256_cvtps_lo_pd(x.lo),
+		&sin0, &cos0
+	);
+	_internal_mm256x2_sincospi_pd(
+		_internal_mm256_cvtps_hi_pd(x.hi), _internal_mm256_cvtps_hi_pd(x.lo),
+		&sin1, &cos1
+	);
+	return _internal_mm256x2_cvtpd_psx2(sin0, sin1);
+}
+
+__m256x2 _mm256x2_cospi_psx2(const __m256x2 x) {
+	__m256d sin0, cos0, sin1, cos1;
+	_internal_mm256x2_sincospi_pd(
+		_internal_mm256_cvtps_lo_pd(x.hi), _internal_mm256_cvtps_lo_pd(x.lo),
+		&sin0, &cos0
+	);
+	_internal_mm256x2_sincospi_pd(
+		_internal_mm256_cvtps_hi_pd(x.hi), _internal_mm256_cvtps_hi_pd(x.lo),
+		&sin1, &cos1
+	);
+	return _internal_mm256x2_cvtpd_psx2(cos0, cos1);
+}
+
+void _mm256x2_sincospi_psx2(
+	const __m256x2 x, __m256x2* const p_sin, __m256x2* const p_cos
+) {
+	__m256d sin0, cos0, sin1, cos1;
+	_internal_mm256x2_sincospi_pd(
+		_internal_mm256_cvtps_lo_pd(x.hi), _internal_mm256_cvtps_lo_pd(x.lo),
+		&sin0, &cos0
+	);
+	_internal_mm256x2_sincospi_pd(
+		_internal_mm256_cvtps_hi_pd(x.hi), _internal_mm256_cvtps_hi_pd(x.lo),
+		&sin1, &cos1
+	);
+	*p_sin = _internal_mm256x2_cvtpd_psx2(sin0, sin1);
+	*p_cos = _internal_mm256x2_cvtpd_psx2(cos0, cos1);
+}
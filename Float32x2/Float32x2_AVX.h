@@ -0,0 +1,1879 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+#ifndef FLOAT32X2_AVX_H
+#define FLOAT32X2_AVX_H
+
+/**
+ * @brief Double-Float32 AVX Dekker Float implementation.
+ * Source: Creel "Double it Like Dekker" on YouTube.
+ *
+ * @note Requires AVX or later.
+ * @warning -Ofast may break this library. -O3 compiles okay on gcc and clang.
+ */
+
+#include "Float32x2_def.h"
+#include "../Float32/Float32_AVX.h"
+#include "../LDF/LDF_fma.h"
+
+#include <stdint.h>
+
+#if (!defined(__AVX__) && defined(__GNUC__))
+	#error "__AVX__ is not enabled in your compiler. Try -mavx"
+#endif
+
+#include <immintrin.h>
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+//------------------------------------------------------------------------------
+// __m256x2 struct
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Holds eight Double-Float32 dekker floats
+ */
+typedef struct __m256x2 {
+	__m256 hi;
+	__m256 lo;
+} __m256x2;
+
+//------------------------------------------------------------------------------
+// __m256x2 set1 functions
+//------------------------------------------------------------------------------
+
+static inline __m256x2 _mm256x2_setzero_psx2(void) {
+	__m256x2 ret;
+	ret.hi = _mm256_setzero_ps();
+	ret.lo = _mm256_setzero_ps();
+	return ret;
+}
+
+static inline __m256x2 _mm256x2_set1_psx2(Float32x2 val) {
+	__m256x2 ret;
+	ret.hi = _mm256_set1_ps(val.hi);
+	ret.lo = _mm256_set1_ps(val.lo);
+	return ret;
+}
+
+static inline __m256x2 _mm256x2_set1_ps(float x) {
+	__m256x2 ret;
+	ret.hi = _mm256_set1_ps(x);
+	ret.lo = _mm256_setzero_ps();
+	return ret;
+}
+
+static inline __m256x2 _mm256x2_set1_epi32(int x) {
+	__m256x2 ret;
+	ret.hi = _mm256_castsi256_ps(_mm256_set1_epi32(x));
+	ret.lo = _mm256_castsi256_ps(_mm256_set1_epi32(x));
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m256x2 set functions
+//------------------------------------------------------------------------------
+
+static inline __m256x2 _mm256x2_set_ps(
+	float e7, float e6, float e5, float e4,
+	float e3, float e2, float e1, float e0
+) {
+	__m256x2 ret;
+	ret.hi = _mm256_set_ps(e7, e6, e5, e4, e3, e2, e1, e0);
+	ret.lo = _mm256_setzero_ps();
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m256x2 setr (set reverse) functions
+//------------------------------------------------------------------------------
+
+static inline __m256x2 _mm256x2_setr_ps(
+	float e7, float e6, float e5, float e4,
+	float e3, float e2, float e1, float e0
+) {
+	__m256x2 ret;
+	ret.hi = _mm256_setr_ps(e7, e6, e5, e4, e3, e2, e1, e0);
+	ret.lo = _mm256_setzero_ps();
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m256x2 load operations
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Loads eight interleaved {hi, lo} pairs.
+ * @note mem_addr must be aligned on a 16-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline __m256x2 _mm256x2_load_ps(const float* mem_addr) {
+	// hi.0, lo.0, hi.1, lo.1, hi.4, lo.4, hi.5, lo.5
+	__m256 v0 = _mm256_castps128_ps256(_mm_load_ps(mem_addr));
+	v0 = _mm256_insertf128_ps(v0, _mm_load_ps(mem_addr + 8), 1);
+	// hi.2, lo.2, hi.3, lo.3, hi.6, lo.6, hi.7, lo.7
+	__m256 v1 = _mm256_castps128_ps256(_mm_load_ps(mem_addr + 4));
+	v1 = _mm256_insertf128_ps(v1, _mm_load_ps(mem_addr + 12), 1);
+
+	__m256x2 val;
+	val.hi = _mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0));
+	val.lo = _mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1));
+	return val;
+}
+
+/**
+ * @brief Loads eight interleaved {hi, lo} pairs.
+ */
+static inline __m256x2 _mm256x2_loadu_ps(const float* mem_addr) {
+	// hi.0, lo.0, hi.1, lo.1, hi.4, lo.4, hi.5, lo.5
+	__m256 v0 = _mm256_castps128_ps256(_mm_loadu_ps(mem_addr));
+	v0 = _mm256_insertf128_ps(v0, _mm_loadu_ps(mem_addr + 8), 1);
+	// hi.2, lo.2, hi.3, lo.3, hi.6, lo.6, hi.7, lo.7
+	__m256 v1 = _mm256_castps128_ps256(_mm_loadu_ps(mem_addr + 4));
+	v1 = _mm256_insertf128_ps(v1, _mm_loadu_ps(mem_addr + 12), 1);
+
+	__m256x2 val;
+	val.hi = _mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0));
+	val.lo = _mm256_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1));
+	return val;
+}
+
+/**
+ * @note mem_addr must be aligned on a 16-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline __m256x2 _mm256x2_load_psx2(const Float32x2* mem_addr) {
+	return _mm256x2_load_ps((const float*)((const void*)mem_addr));
+}
+
+static inline __m256x2 _mm256x2_loadu_psx2(const Float32x2* mem_addr) {
+	return _mm256x2_loadu_ps((const float*)((const void*)mem_addr));
+}
+
+/**
+ * @note mem_addr must be aligned on a 32-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline __m256x2 _mm256x2_load_raw_ps(const float* mem_addr) {
+	__m256x2 val;
+	val.hi = _mm256_load_ps(mem_addr);
+	mem_addr += sizeof(__m256) / sizeof(float);
+	val.lo = _mm256_load_ps(mem_addr);
+	return val;
+}
+
+static inline __m256x2 _mm256x2_loadu_raw_ps(const float* mem_addr) {
+	__m256x2 val;
+	val.hi = _mm256_loadu_ps(mem_addr);
+	mem_addr += sizeof(__m256) / sizeof(float);
+	val.lo = _mm256_loadu_ps(mem_addr);
+	return val;
+}
+
+//------------------------------------------------------------------------------
+// __m256x2 store operations
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Stores eight interleaved {hi, lo} pairs.
+ * @note mem_addr must be aligned on a 16-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline void _mm256x2_store_ps(float* mem_addr, __m256x2 val) {
+	// hi.0, lo.0, hi.1, lo.1, hi.4, lo.4, hi.5, lo.5
+	__m256 v0 = _mm256_unpacklo_ps(val.hi, val.lo);
+	// hi.2, lo.2, hi.3, lo.3, hi.6, lo.6, hi.7, lo.7
+	__m256 v1 = _mm256_unpackhi_ps(val.hi, val.lo);
+	_mm_store_ps(mem_addr     , _mm256_castps256_ps128(v0));
+	_mm_store_ps(mem_addr +  4, _mm256_castps256_ps128(v1));
+	_mm_store_ps(mem_addr +  8, _mm256_extractf128_ps(v0, 1));
+	_mm_store_ps(mem_addr + 12, _mm256_extractf128_ps(v1, 1));
+}
+
+/**
+ * @brief Stores eight interleaved {hi, lo} pairs.
+ */
+static inline void _mm256x2_storeu_ps(float* mem_addr, __m256x2 val) {
+	// hi.0, lo.0, hi.1, lo.1, hi.4, lo.4, hi.5, lo.5
+	__m256 v0 = _mm256_unpacklo_ps(val.hi, val.lo);
+	// hi.2, lo.2, hi.3, lo.3, hi.6, lo.6, hi.7, lo.7
+	__m256 v1 = _mm256_unpackhi_ps(val.hi, val.lo);
+	_mm_storeu_ps(mem_addr     , _mm256_castps256_ps128(v0));
+	_mm_storeu_ps(mem_addr +  4, _mm256_castps256_ps128(v1));
+	_mm_storeu_ps(mem_addr +  8, _mm256_extractf128_ps(v0, 1));
+	_mm_storeu_ps(mem_addr + 12, _mm256_extractf128_ps(v1, 1));
+}
+
+/**
+ * @note mem_addr must be aligned on a 16-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline void _mm256x2_store_psx2(Float32x2* mem_addr, __m256x2 val) {
+	_mm256x2_store_ps((float*)((void*)mem_addr), val);
+}
+
+static inline void _mm256x2_storeu_psx2(Float32x2* mem_addr, __m256x2 val) {
+	_mm256x2_storeu_ps((float*)((void*)mem_addr), val);
+}
+
+/**
+ * @note mem_addr must be aligned on a 32-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline void _mm256_store_raw_psx2(float* mem_addr, __m256x2 x) {
+	_mm256_store_ps(mem_addr, x.hi);
+	mem_addr += sizeof(__m256) / sizeof(float);
+	_mm256_store_ps(mem_addr, x.lo);
+}
+
+static inline void _mm256_storeu_raw_psx2(float* mem_addr, __m256x2 x) {
+	_mm256_storeu_ps(mem_addr, x.hi);
+	mem_addr += sizeof(__m256) / sizeof(float);
+	_mm256_storeu_ps(mem_addr, x.lo);
+}
+
+
+//------------------------------------------------------------------------------
+// __m256x2 bitwise operations
+//------------------------------------------------------------------------------
+
+/**
+ * @brief bitwise not `~x`
+ */
+static inline __m256x2 _mm256x2_not_psx2(__m256x2 x) {
+	x.hi = _mm256_not_ps(x.hi);
+	x.lo = _mm256_not_ps(x.lo);
+	return x;
+}
+
+/**
+ * @brief bitwise and `x & y`
+ */
+static inline __m256x2 _mm256x2_and_psx2(__m256x2 x, __m256x2 y) {
+	x.hi = _mm256_and_ps(x.hi, y.hi);
+	x.lo = _mm256_and_ps(x.lo, y.lo);
+	return x;
+}
+
+/**
+ * @brief bitwise andnot `x & ~y`
+ */
+static inline __m256x2 _mm256x2_andnot_psx2(__m256x2 x, __m256x2 y) {
+	x.hi = _mm256_andnot_ps(x.hi, y.hi);
+	x.lo = _mm256_andnot_ps(x.lo, y.lo);
+	return x;
+}
+
+/**
+ * @brief bitwise or `x | y`
+ */
+static inline __m256x2 _mm256x2_or_psx2(__m256x2 x, __m256x2 y) {
+	x.hi = _mm256_or_ps(x.hi, y.hi);
+	x.lo = _mm256_or_ps(x.lo, y.lo);
+	return x;
+}
+
+/**
+ * @brief bitwise xor `x ^ y`
+ */
+static inline __m256x2 _mm256x2_xor_psx2(__m256x2 x, __m256x2 y) {
+	x.hi = _mm256_xor_ps(x.hi, y.hi);
+	x.lo = _mm256_xor_ps(x.lo, y.lo);
+	return x;
+}
+
+//------------------------------------------------------------------------------
+// __m256x2 comparison extend
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Copies cmp to val[0 - 1]. Used for extending comparison results.
+ */
+static inline __m256x2 _mm256x2_cmp_extend_ps(__m256 cmp) {
+	__m256x2 ret = {cmp, cmp};
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m256x2 comparison functions
+//------------------------------------------------------------------------------
+
+/* __m256x2 compare __m256x2 */
+
+	/**
+	 * @brief _CMP_ORD_Q
+	 */
+	static inline __m256 _mm256_cmpord_psx2(__m256x2 x, __m256x2 y) {
+		__m256 cmp_hi = _mm256_cmp_ps(x.hi, y.hi, _CMP_ORD_Q);
+		__m256 cmp_lo = _mm256_cmp_ps(x.lo, y.lo, _CMP_ORD_Q);
+		return _mm256_and_ps(cmp_hi, cmp_lo);
+	}
+
+	/**
+	 * @brief _CMP_UNORD_Q
+	 */
+	static inline __m256 _mm256_cmpunord_psx2(__m256x2 x, __m256x2 y) {
+		__m256 cmp_hi = _mm256_cmp_ps(x.hi, y.hi, _CMP_UNORD_Q);
+		__m256 cmp_lo = _mm256_cmp_ps(x.lo, y.lo, _CMP_UNORD_Q);
+		return _mm256_or_ps(cmp_hi, cmp_lo);
+	}
+
+	/**
+	 * @brief _CMP_EQ_OQ
+	 */
+	static inline __m256 _mm256_cmpeq_psx2(__m256x2 x, __m256x2 y) {
+		__m256 cmp_hi = _mm256_cmp_ps(x.hi, y.hi, _CMP_EQ_OQ);
+		__m256 cmp_lo = _mm256_cmp_ps(x.lo, y.lo, _CMP_EQ_OQ);
+		return _mm256_and_ps(cmp_hi, cmp_lo);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_OQ
+	 */
+	static inline __m256 _mm256_cmpneq_psx2(__m256x2 x, __m256x2 y) {
+		__m256 cmp_hi = _mm256_cmp_ps(x.hi, y.hi, _CMP_NEQ_OQ);
+		__m256 cmp_lo = _mm256_cmp_ps(x.lo, y.lo, _CMP_NEQ_OQ);
+		return _mm256_or_ps(cmp_hi, cmp_lo);
+	}
+
+	/**
+	 * @brief _CMP_EQ_UQ
+	 */
+	static inline __m256 _mm256_cmplg_psx2(__m256x2 x, __m256x2 y) {
+		__m256 cmp_hi = _mm256_cmp_ps(x.hi, y.hi, _CMP_NEQ_UQ);
+		__m256 cmp_lo = _mm256_cmp_ps(x.lo, y.lo, _CMP_NEQ_UQ);
+		return _mm256_or_ps(cmp_hi, cmp_lo);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_UQ
+	 */
+	static inline __m256 _mm256_cmpnlg_psx2(__m256x2 x, __m256x2 y) {
+		__m256 cmp_hi = _mm256_cmp_ps(x.hi, y.hi, _CMP_EQ_UQ);
+		__m256 cmp_lo = _mm256_cmp_ps(x.lo, y.lo, _CMP_EQ_UQ);
+		return _mm256_and_ps(cmp_hi, cmp_lo);
+	}
+
+	/**
+	 * @brief _CMP_LT_OQ
+	 */
+	static inline __m256 _mm256_cmplt_psx2(__m256x2 x, __m256x2 y) {
+		return _mm256_or_ps(
+			_mm256_cmp_ps(x.hi, y.hi, _CMP_LT_OQ),
+			_mm256_and_ps(
+				_mm256_cmp_ps(x.hi, y.hi, _CMP_EQ_OQ),
+				_mm256_cmp_ps(x.lo, y.lo, _CMP_LT_OQ)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_LE_OQ
+	 */
+	static inline __m256 _mm256_cmple_psx2(__m256x2 x, __m256x2 y) {
+		return _mm256_or_ps(
+			_mm256_cmp_ps(x.hi, y.hi, _CMP_LT_OQ),
+			_mm256_and_ps(
+				_mm256_cmp_ps(x.hi, y.hi, _CMP_EQ_OQ),
+				_mm256_cmp_ps(x.lo, y.lo, _CMP_LE_OQ)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_GT_OQ
+	 */
+	static inline __m256 _mm256_cmpgt_psx2(__m256x2 x, __m256x2 y) {
+		return _mm256_or_ps(
+			_mm256_cmp_ps(x.hi, y.hi, _CMP_GT_OQ),
+			_mm256_and_ps(
+				_mm256_cmp_ps(x.hi, y.hi, _CMP_EQ_OQ),
+				_mm256_cmp_ps(x.lo, y.lo, _CMP_GT_OQ)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_GE_OQ
+	 */
+	static inline __m256 _mm256_cmpge_psx2(__m256x2 x, __m256x2 y) {
+		return _mm256_or_ps(
+			_mm256_cmp_ps(x.hi, y.hi, _CMP_GT_OQ),
+			_mm256_and_ps(
+				_mm256_cmp_ps(x.hi, y.hi, _CMP_EQ_OQ),
+				_mm256_cmp_ps(x.lo, y.lo, _CMP_GE_OQ)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NLT_UQ
+	 */
+	static inline __m256 _mm256_cmpnlt_psx2(__m256x2 x, __m256x2 y) {
+		return _mm256_and_ps(
+			_mm256_cmp_ps(x.hi, y.hi, _CMP_NLT_UQ),
+			_mm256_or_ps(
+				_mm256_cmp_ps(x.hi, y.hi, _CMP_NEQ_OQ),
+				_mm256_cmp_ps(x.lo, y.lo, _CMP_NLT_UQ)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NLE_UQ
+	 */
+	static inline __m256 _mm256_cmpnle_psx2(__m256x2 x, __m256x2 y) {
+		return _mm256_and_ps(
+			_mm256_cmp_ps(x.hi, y.hi, _CMP_NLT_UQ),
+			_mm256_or_ps(
+				_mm256_cmp_ps(x.hi, y.hi, _CMP_NEQ_OQ),
+				_mm256_cmp_ps(x.lo, y.lo, _CMP_NLE_UQ)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NGT_UQ
+	 */
+	static inline __m256 _mm256_cmpngt_psx2(__m256x2 x, __m256x2 y) {
+		return _mm256_and_ps(
+			_mm256_cmp_ps(x.hi, y.hi, _CMP_NGT_UQ),
+			_mm256_or_ps(
+				_mm256_cmp_ps(x.hi, y.hi, _CMP_NEQ_OQ),
+				_mm256_cmp_ps(x.lo, y.lo, _CMP_NGT_UQ)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NGE_UQ
+	 */
+	static inline __m256 _mm256_cmpnge_psx2(__m256x2 x, __m256x2 y) {
+		return _mm256_and_ps(
+			_mm256_cmp_ps(x.hi, y.hi, _CMP_NGT_UQ),
+			_mm256_or_ps(
+				_mm256_cmp_ps(x.hi, y.hi, _CMP_NEQ_OQ),
+				_mm256_cmp_ps(x.lo, y.lo, _CMP_NGE_UQ)
+			)
+		);
+	}
+
+/* __m256x2 compare __m256 */
+
+	/**
+	 * @brief _CMP_ORD_Q
+	 */
+	static inline __m256 _mm256_cmpord_psx2_ps(__m256x2 x, __m256 y) {
+		return _mm256_cmp_ps(x.hi, y, _CMP_ORD_Q);
+	}
+
+	/**
+	 * @brief _CMP_UNORD_Q
+	 */
+	static inline __m256 _mm256_cmpunord_psx2_ps(__m256x2 x, __m256 y) {
+		return _mm256_cmp_ps(x.hi, y, _CMP_UNORD_Q);
+	}
+
+	/**
+	 * @brief _CMP_EQ_OQ
+	 */
+	static inline __m256 _mm256_cmpeq_psx2_ps(__m256x2 x, __m256 y) {
+		__m256 cmp_hi = _mm256_cmp_ps(x.hi, y, _CMP_EQ_OQ);
+		__m256 cmp_lo = _mm256_cmp_ps(x.lo, _mm256_setzero_ps(), _CMP_EQ_OQ);
+		return _mm256_and_ps(cmp_hi, cmp_lo);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_OQ
+	 */
+	static inline __m256 _mm256_cmpneq_psx2_ps(__m256x2 x, __m256 y) {
+		__m256 cmp_hi = _mm256_cmp_ps(x.hi, y, _CMP_NEQ_OQ);
+		__m256 cmp_lo = _mm256_cmp_ps(x.lo, _mm256_setzero_ps(), _CMP_NEQ_OQ);
+		return _mm256_or_ps(cmp_hi, cmp_lo);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_UQ
+	 */
+	static inline __m256 _mm256_cmplg_psx2_ps(__m256x2 x, __m256 y) {
+		__m256 cmp_hi = _mm256_cmp_ps(x.hi, y, _CMP_NEQ_UQ);
+		__m256 cmp_lo = _mm256_cmp_ps(x.lo, _mm256_setzero_ps(), _CMP_NEQ_UQ);
+		return _mm256_or_ps(cmp_hi, cmp_lo);
+	}
+
+	/**
+	 * @brief _CMP_EQ_UQ
+	 */
+	static inline __m256 _mm256_cmpnlg_psx2_ps(__m256x2 x, __m256 y) {
+		__m256 cmp_hi = _mm256_cmp_ps(x.hi, y, _CMP_EQ_UQ);
+		__m256 cmp_lo = _mm256_cmp_ps(x.lo, _mm256_setzero_ps(), _CMP_EQ_UQ);
+		return _mm256_and_ps(cmp_hi, cmp_lo);
+	}
+
+		/**
+	 * @brief _CMP_LT_OQ
+	 */
+	static inline __m256 _mm256_cmplt_psx2_ps(__m256x2 x, __m256 y) {
+		return _mm256_or_ps(
+			_mm256_cmp_ps(x.hi, y, _CMP_LT_OQ),
+			_mm256_and_ps(
+				_mm256_cmp_ps(x.hi, y, _CMP_EQ_OQ),
+				_mm256_cmp_ps(x.lo, _mm256_setzero_ps(), _CMP_LT_OQ)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_LE_OQ
+	 */
+	static inline __m256 _mm256_cmple_psx2_ps(__m256x2 x, __m256 y) {
+		return _mm256_or_ps(
+			_mm256_cmp_ps(x.hi, y, _CMP_LT_OQ),
+			_mm256_and_ps(
+				_mm256_cmp_ps(x.hi, y, _CMP_EQ_OQ),
+				_mm256_cmp_ps(x.lo, _mm256_setzero_ps(), _CMP_LE_OQ)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_GT_OQ
+	 */
+	static inline __m256 _mm256_cmpgt_psx2_ps(__m256x2 x, __m256 y) {
+		return _mm256_or_ps(
+			_mm256_cmp_ps(x.hi, y, _CMP_GT_OQ),
+			_mm256_and_ps(
+				_mm256_cmp_ps(x.hi, y, _CMP_EQ_OQ),
+				_mm256_cmp_ps(x.lo, _mm256_setzero_ps(), _CMP_GT_OQ)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_GE_OQ
+	 */
+	static inline __m256 _mm256_cmpge_psx2_ps(__m256x2 x, __m256 y) {
+		return _mm256_or_ps(
+			_mm256_cmp_ps(x.hi, y, _CMP_GT_OQ),
+			_mm256_and_ps(
+				_mm256_cmp_ps(x.hi, y, _CMP_EQ_OQ),
+				_mm256_cmp_ps(x.lo, _mm256_setzero_ps(), _CMP_GE_OQ)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NLT_UQ
+	 */
+	static inline __m256 _mm256_cmpnlt_psx2_ps(__m256x2 x, __m256 y) {
+		return _mm256_or_ps(
+			_mm256_cmp_ps(x.hi, y, _CMP_NLT_UQ),
+			_mm256_and_ps(
+				_mm256_cmp_ps(x.hi, y, _CMP_NEQ_OQ),
+				_mm256_cmp_ps(x.lo, _mm256_setzero_ps(), _CMP_NLT_UQ)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NLE_UQ
+	 */
+	static inline __m256 _mm256_cmpnle_psx2_ps(__m256x2 x, __m256 y) {
+		return _mm256_and_ps(
+			_mm256_cmp_ps(x.hi, y, _CMP_NLT_UQ),
+			_mm256_or_ps(
+				_mm256_cmp_ps(x.hi, y, _CMP_NEQ_OQ),
+				_mm256_cmp_ps(x.lo, _mm256_setzero_ps(), _CMP_NLE_UQ)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NGT_UQ
+	 */
+	static inline __m256 _mm256_cmpngt_psx2_ps(__m256x2 x, __m256 y) {
+		return _mm256_and_ps(
+			_mm256_cmp_ps(x.hi, y, _CMP_NGT_UQ),
+			_mm256_or_ps(
+				_mm256_cmp_ps(x.hi, y, _CMP_NEQ_OQ),
+				_mm256_cmp_ps(x.lo, _mm256_setzero_ps(), _CMP_NGT_UQ)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NGE_UQ
+	 */
+	static inline __m256 _mm256_cmpnge_psx2_ps(__m256x2 x, __m256 y) {
+		return _mm256_and_ps(
+			_mm256_cmp_ps(x.hi, y, _CMP_NGT_UQ),
+			_mm256_or_ps(
+				_mm256_cmp_ps(x.hi, y, _CMP_NEQ_OQ),
+				_mm256_cmp_ps(x.lo, _mm256_setzero_ps(), _CMP_NGE_UQ)
+			)
+		);
+	}
+
+/* __m256 compare __m256x2 */
+
+	/**
+	 * @brief _CMP_ORD_Q
+	 */
+	static inline __m256 _mm256_cmpord_ps_psx2(__m256 x, __m256x2 y) {
+		return _mm256_cmp_ps(x, y.hi, _CMP_ORD_Q);
+	}
+
+	/**
+	 * @brief _CMP_UNORD_Q
+	 */
+	static inline __m256 _mm256_cmpunord_ps_psx2(__m256 x, __m256x2 y) {
+		return _mm256_cmp_ps(x, y.hi, _CMP_UNORD_Q);
+	}
+
+	/**
+	 * @brief _CMP_EQ_OQ
+	 */
+	static inline __m256 _mm256_cmpeq_ps_psx2(__m256 x, __m256x2 y) {
+		__m256 cmp_hi = _mm256_cmp_ps(x, y.hi, _CMP_EQ_OQ);
+		__m256 cmp_lo = _mm256_cmp_ps(_mm256_setzero_ps(), y.lo, _CMP_EQ_OQ);
+		return _mm256_and_ps(cmp_hi, cmp_lo);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_OQ
+	 */
+	static inline __m256 _mm256_cmpneq_ps_psx2(__m256 x, __m256x2 y) {
+		__m256 cmp_hi = _mm256_cmp_ps(x, y.hi, _CMP_NEQ_OQ);
+		__m256 cmp_lo = _mm256_cmp_ps(_mm256_setzero_ps(), y.lo, _CMP_NEQ_OQ);
+		return _mm256_or_ps(cmp_hi, cmp_lo);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_UQ
+	 */
+	static inline __m256 _mm256_cmplg_ps_psx2(__m256 x, __m256x2 y) {
+		__m256 cmp_hi = _mm256_cmp_ps(x, y.hi, _CMP_NEQ_UQ);
+		__m256 cmp_lo = _mm256_cmp_ps(_mm256_setzero_ps(), y.lo, _CMP_NEQ_UQ);
+		return _mm256_or_ps(cmp_hi, cmp_lo);
+	}
+
+	/**
+	 * @brief _CMP_EQ_UQ
+	 */
+	static inline __m256 _mm256_cmpnlg_ps_psx2(__m256 x, __m256x2 y) {
+		__m256 cmp_hi = _mm256_cmp_ps(x, y.hi, _CMP_EQ_UQ);
+		__m256 cmp_lo = _mm256_cmp_ps(_mm256_setzero_ps(), y.lo, _CMP_EQ_UQ);
+		return _mm256_and_ps(cmp_hi, cmp_lo);
+	}
+
+		/**
+	 * @brief _CMP_LT_OQ
+	 */
+	static inline __m256 _mm256_cmplt_ps_psx2(__m256 x, __m256x2 y) {
+		return _mm256_or_ps(
+			_mm256_cmp_ps(x, y.hi, _CMP_LT_OQ),
+			_mm256_and_ps(
+				_mm256_cmp_ps(x, y.hi, _CMP_EQ_OQ),
+				_mm256_cmp_ps(_mm256_setzero_ps(), y.lo, _CMP_LT_OQ)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_LE_OQ
+	 */
+	static inline __m256 _mm256_cmple_ps_psx2(__m256 x, __m256x2 y) {
+		return _mm256_or_ps(
+			_mm256_cmp_ps(x, y.hi, _CMP_LT_OQ),
+			_mm256_and_ps(
+				_mm256_cmp_ps(x, y.hi, _CMP_EQ_OQ),
+				_mm256_cmp_ps(_mm256_setzero_ps(), y.lo, _CMP_LE_OQ)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_GT_OQ
+	 */
+	static inline __m256 _mm256_cmpgt_ps_psx2(__m256 x, __m256x2 y) {
+		return _mm256_or_ps(
+			_mm256_cmp_ps(x, y.hi, _CMP_GT_OQ),
+			_mm256_and_ps(
+				_mm256_cmp_ps(x, y.hi, _CMP_EQ_OQ),
+				_mm256_cmp_ps(_mm256_setzero_ps(), y.lo, _CMP_GT_OQ)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_GE_OQ
+	 */
+	static inline __m256 _mm256_cmpge_ps_psx2(__m256 x, __m256x2 y) {
+		return _mm256_or_ps(
+			_mm256_cmp_ps(x, y.hi, _CMP_GT_OQ),
+			_mm256_and_ps(
+				_mm256_cmp_ps(x, y.hi, _CMP_EQ_OQ),
+				_mm256_cmp_ps(_mm256_setzero_ps(), y.lo, _CMP_GE_OQ)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NLT_UQ
+	 */
+	static inline __m256 _mm256_cmpnlt_ps_psx2(__m256 x, __m256x2 y) {
+		return _mm256_or_ps(
+			_mm256_cmp_ps(x, y.hi, _CMP_NLT_UQ),
+			_mm256_and_ps(
+				_mm256_cmp_ps(x, y.hi, _CMP_NEQ_OQ),
+				_mm256_cmp_ps(_mm256_setzero_ps(), y.lo, _CMP_NLT_UQ)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NLE_UQ
+	 */
+	static inline __m256 _mm256_cmpnle_ps_psx2(__m256 x, __m256x2 y) {
+		return _mm256_and_ps(
+			_mm256_cmp_ps(x, y.hi, _CMP_NLT_UQ),
+			_mm256_or_ps(
+				_mm256_cmp_ps(x, y.hi, _CMP_NEQ_OQ),
+				_mm256_cmp_ps(_mm256_setzero_ps(), y.lo, _CMP_NLE_UQ)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NGT_UQ
+	 */
+	static inline __m256 _mm256_cmpngt_ps_psx2(__m256 x, __m256x2 y) {
+		return _mm256_and_ps(
+			_mm256_cmp_ps(x, y.hi, _CMP_NGT_UQ),
+			_mm256_or_ps(
+				_mm256_cmp_ps(x, y.hi, _CMP_NEQ_OQ),
+				_mm256_cmp_ps(_mm256_setzero_ps(), y.lo, _CMP_NGT_UQ)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NGE_UQ
+	 */
+	static inline __m256 _mm256_cmpnge_ps_psx2(__m256 x, __m256x2 y) {
+		return _mm256_and_ps(
+			_mm256_cmp_ps(x, y.hi, _CMP_NGT_UQ),
+			_mm256_or_ps(
+				_mm256_cmp_ps(x, y.hi, _CMP_NEQ_OQ),
+				_mm256_cmp_ps(_mm256_setzero_ps(), y.lo, _CMP_NGE_UQ)
+			)
+		);
+	}
+
+//------------------------------------------------------------------------------
+// __m256x2 compare to zero functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief _CMP_EQ_OQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m256 _mm256_cmpeq_zero_psx2(__m256x2 x) {
+	return _mm256_cmp_ps(x.hi, _mm256_setzero_ps(), _CMP_EQ_OQ);
+}
+/**
+ * @brief _CMP_NEQ_OQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m256 _mm256_cmpneq_zero_psx2(__m256x2 x) {
+	return _mm256_cmp_ps(x.hi, _mm256_setzero_ps(), _CMP_NEQ_OQ);
+}
+/**
+ * @brief _CMP_NEQ_UQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m256 _mm256_cmplg_zero_psx2(__m256x2 x) {
+	return _mm256_cmp_ps(x.hi, _mm256_setzero_ps(), _CMP_NEQ_UQ);
+}
+/**
+ * @brief _CMP_EQ_UQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m256 _mm256_cmpnlg_zero_psx2(__m256x2 x) {
+	return _mm256_cmp_ps(x.hi, _mm256_setzero_ps(), _CMP_EQ_UQ);
+}
+
+/**
+ * @brief _CMP_LT_OQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m256 _mm256_cmplt_zero_psx2(__m256x2 x) {
+	return _mm256_cmp_ps(x.hi, _mm256_setzero_ps(), _CMP_LT_OQ);
+}
+/**
+ * @brief _CMP_LE_OQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m256 _mm256_cmple_zero_psx2(__m256x2 x) {
+	return _mm256_cmp_ps(x.hi, _mm256_setzero_ps(), _CMP_LE_OQ);
+}
+/**
+ * @brief _CMP_GT_OQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m256 _mm256_cmpgt_zero_psx2(__m256x2 x) {
+	return _mm256_cmp_ps(x.hi, _mm256_setzero_ps(), _CMP_GT_OQ);
+}
+/**
+ * @brief _CMP_GE_OQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m256 _mm256_cmpge_zero_psx2(__m256x2 x) {
+	return _mm256_cmp_ps(x.hi, _mm256_setzero_ps(), _CMP_GE_OQ);
+}
+
+/**
+ * @brief _CMP_NLT_UQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m256 _mm256_cmpnlt_zero_psx2(__m256x2 x) {
+	return _mm256_cmp_ps(x.hi, _mm256_setzero_ps(), _CMP_NLT_UQ);
+}
+/**
+ * @brief _CMP_NLE_UQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m256 _mm256_cmpnle_zero_psx2(__m256x2 x) {
+	return _mm256_cmp_ps(x.hi, _mm256_setzero_ps(), _CMP_NLE_UQ);
+}
+/**
+ * @brief _CMP_NGT_UQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m256 _mm256_cmpngt_zero_psx2(__m256x2 x) {
+	return _mm256_cmp_ps(x.hi, _mm256_setzero_ps(), _CMP_NGT_UQ);
+}
+/**
+ * @brief _CMP_NGE_UQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m256 _mm256_cmpnge_zero_psx2(__m256x2 x) {
+	return _mm256_cmp_ps(x.hi, _mm256_setzero_ps(), _CMP_NGE_UQ);
+}
+
+//------------------------------------------------------------------------------
+// __m256x2 basic arithmetic
+//------------------------------------------------------------------------------
+
+static inline __m256x2 _mm256x2_negate_psx2(__m256x2 x) {
+	const __m256 sign_bit_mask = _mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x80000000));
+	x.hi = _mm256_xor_ps(x.hi, sign_bit_mask);
+	x.lo = _mm256_xor_ps(x.lo, sign_bit_mask);
+	return x;
+}
+
+static inline __m256x2 _mm256x2_add_psx2(__m256x2 x, __m256x2 y) {
+	// __m256 r_hi = _mm256_add_ps(x.hi, y.hi);
+	// /* if (fabs(x.hi) < fabs(y.hi)) */ {
+	// 	const __m256 cmp_result = _mm256_cmp_ps(
+	// 		_mm256_fabs_ps(x.hi), _mm256_fabs_ps(y.hi),
+	// 	_CMP_LT_OQ);
+		
+	// 	// Swaps x and y
+	// 	__m256 temp_hi = _mm256_blendv_ps(x.hi, y.hi, cmp_result);
+	// 	y.hi = _mm256_blendv_ps(y.hi, x.hi, cmp_result);
+	// 	x.hi = temp_hi;
+	// 	__m256 temp_lo = _mm256_blendv_ps(x.lo, y.lo, cmp_result);
+	// 	y.lo = _mm256_blendv_ps(y.lo, x.lo, cmp_result);
+	// 	x.lo = temp_lo;
+	// }
+	// __m256 r_lo = _mm256_add_ps(_mm256_add_ps(
+	// 	_mm256_add_ps(_mm256_sub_ps(x.hi, r_hi), y.hi),
+	// y.lo), x.lo);
+
+	__m256 r_hi = _mm256_add_ps(x.hi, y.hi);
+
+	__m256 rx_lo = _mm256_add_ps(_mm256_add_ps(
+		_mm256_add_ps(_mm256_sub_ps(x.hi, r_hi), y.hi),
+	y.lo), x.lo);
+	__m256 ry_lo = _mm256_add_ps(_mm256_add_ps(
+		_mm256_add_ps(_mm256_sub_ps(y.hi, r_hi), x.hi),
+	x.lo), y.lo);
+
+	const __m256 cmp_result = _mm256_cmp_ps(
+	 		_mm256_fabs_ps(x.hi), _mm256_fabs_ps(y.hi),
+	_CMP_LE_OQ);
+	__m256 r_lo = _mm256_blendv_ps(rx_lo, ry_lo, cmp_result);
+
+	__m256x2 c;
+	c.hi = _mm256_add_ps(r_hi, r_lo);
+	c.lo = _mm256_add_ps(_mm256_sub_ps(r_hi, c.hi), r_lo);
+	return c;
+}
+
+static inline __m256x2 _mm256x2_sub_psx2(__m256x2 x, __m256x2 y) {
+	// y.hi = _mm256_negate_ps(y.hi);
+	// y.lo = _mm256_negate_ps(y.lo);
+	// return _mm256x2_add_psx2(x, y);
+
+	// __m256 r_hi = _mm256_sub_ps(x.hi, y.hi);
+	// /* if (fabs(x.hi) < fabs(y.hi)) */ {
+	// 	const __m256 cmp_result = _mm256_cmp_ps(
+	// 		_mm256_fabs_ps(x.hi), _mm256_fabs_ps(y.hi),
+	// 	_CMP_LT_OQ);
+		
+	// 	// Swaps x and y
+	// 	__m256 temp_hi = _mm256_blendv_ps(x.hi, y.hi, cmp_result);
+	// 	y.hi = _mm256_blendv_ps(y.hi, x.hi, cmp_result);
+	// 	x.hi = temp_hi;
+	// 	__m256 temp_lo = _mm256_blendv_ps(x.lo, y.lo, cmp_result);
+	// 	y.lo = _mm256_blendv_ps(y.lo, x.lo, cmp_result);
+	// 	x.lo = temp_lo;
+	// }
+	// __m256 r_lo = _mm256_add_ps(_mm256_sub_ps(
+	// 	_mm256_sub_ps(_mm256_sub_ps(x.hi, r_hi), y.hi),
+	// y.lo), x.lo);
+	
+	__m256 r_hi = _mm256_sub_ps(x.hi, y.hi);
+
+	__m256 rx_lo = _mm256_add_ps(_mm256_sub_ps(
+		_mm256_sub_ps(_mm256_sub_ps(x.hi, r_hi), y.hi),
+	y.lo), x.lo);
+
+	y.hi = _mm256_negate_ps(y.hi);
+	__m256 ry_lo = _mm256_sub_ps(_mm256_add_ps(
+		_mm256_add_ps(_mm256_sub_ps(/* negative */ y.hi, r_hi), x.hi),
+	x.lo), y.lo);
+
+	const __m256 cmp_result = _mm256_cmp_ps(
+	 		_mm256_fabs_ps(x.hi), _mm256_fabs_ps(y.hi),
+	_CMP_LE_OQ);
+	__m256 r_lo = _mm256_blendv_ps(rx_lo, ry_lo, cmp_result);
+
+	__m256x2 c;
+	c.hi = _mm256_add_ps(r_hi, r_lo);
+	c.lo = _mm256_add_ps(_mm256_sub_ps(r_hi, c.hi), r_lo);
+	return c;
+}
+
+static inline __m256x2 _mm256x2_dekker_split_ps(__m256 x) {
+	// (2^ceil(24 / 2) + 1)
+	const __m256 dekker_scale = _mm256_set1_ps(4097.0f);
+	__m256 temp = _mm256_mul_ps(x, dekker_scale);
+	__m256x2 ret;
+	ret.hi = _mm256_sub_ps(temp, _mm256_sub_ps(temp, x));
+	ret.lo = _mm256_sub_ps(x, ret.hi);
+	return ret;
+}
+
+static inline __m256x2 _mm256x2_dekker_mul12_ps(__m256 x, __m256 y) {
+	__m256x2 r;
+	#ifdef LDF_ENABLE_FMA_SIMD
+		r.hi = _mm256_mul_ps(x, y);
+		r.lo = _mm256_fmsub_ps(x, y, r.hi);
+	#else
+		__m256x2 a = _mm256x2_dekker_split_ps(x);
+		__m256x2 b = _mm256x2_dekker_split_ps(y);
+		__m256 p = _mm256_mul_ps(a.hi, b.hi);
+		__m256 q = _mm256_add_ps(
+			_mm256_mul_ps(a.hi, b.lo), _mm256_mul_ps(a.lo, b.hi)
+		);
+
+		r.hi = _mm256_add_ps(p, q);
+		r.lo = _mm256_add_ps(
+			_mm256_add_ps(_mm256_sub_ps(p, r.hi), q),
+			_mm256_mul_ps(a.lo, b.lo)
+		);
+	#endif
+	return r;
+}
+
+static inline __m256x2 _mm256x2_mul_psx2(__m256x2 x, __m256x2 y) {
+	__m256x2 t = _mm256x2_dekker_mul12_ps(x.hi, y.hi);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		__m256 c = _mm256_fmadd_ps(x.hi, y.lo, _mm256_fmadd_ps(x.lo, y.hi, t.lo));
+	#else
+		__m256 c = _mm256_add_ps(_mm256_add_ps(
+			_mm256_mul_ps(x.hi, y.lo), _mm256_mul_ps(x.lo, y.hi)
+		), t.lo);
+	#endif
+
+	__m256x2 r;
+	r.hi = _mm256_add_ps(t.hi, c);
+	r.lo = _mm256_add_ps(_mm256_sub_ps(t.hi, r.hi), c);
+	return r;
+}
+
+static inline __m256x2 _mm256x2_div_psx2(__m256x2 x, __m256x2 y) {
+	__m256 u = _mm256_div_ps(x.hi, y.hi);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		/* x.hi - u * y.hi is exact */
+		__m256 l = _mm256_div_ps(_mm256_fnmadd_ps(u, y.lo,
+			_mm256_add_ps(_mm256_fnmadd_ps(u, y.hi, x.hi), x.lo)
+		), y.hi);
+	#else
+		__m256x2 t = _mm256x2_dekker_mul12_ps(u, y.hi);
+		__m256 l = _mm256_div_ps(_mm256_sub_ps(
+			_mm256_add_ps(_mm256_sub_ps(_mm256_sub_ps(x.hi, t.hi), t.lo), x.lo),
+			_mm256_mul_ps(u, y.lo)
+		), y.hi);
+	#endif
+
+	__m256x2 r;
+	r.hi = _mm256_add_ps(u, l);
+	r.lo = _mm256_add_ps(_mm256_sub_ps(u, r.hi), l);
+	return r;
+}
+
+static inline __m256x2 _mm256x2_dekker_square12_ps(__m256 x) {
+	__m256x2 r;
+	#ifdef LDF_ENABLE_FMA_SIMD
+		r.hi = _mm256_mul_ps(x, x);
+		r.lo = _mm256_fmsub_ps(x, x, r.hi);
+	#else
+		__m256x2 a = _mm256x2_dekker_split_ps(x);
+		__m256 p = _mm256_mul_ps(a.hi, a.hi);
+		__m256 q = _mm256_mul_ps(
+			_mm256_set1_ps(2.0f), _mm256_mul_ps(a.hi, a.lo)
+		);
+
+		r.hi = _mm256_add_ps(p, q);
+		r.lo = _mm256_add_ps(
+			_mm256_add_ps(_mm256_sub_ps(p, r.hi), q),
+			_mm256_mul_ps(a.lo, a.lo)
+		);
+	#endif
+	return r;
+}
+
+static inline __m256x2 _mm256x2_square_psx2(__m256x2 x) {
+	__m256x2 t = _mm256x2_dekker_square12_ps(x.hi);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		__m256 c = _mm256_fmadd_ps(_mm256_add_ps(x.hi, x.hi), x.lo, t.lo);
+	#else
+		__m256 c = _mm256_add_ps(
+			_mm256_mul_ps(_mm256_set1_ps(2.0f), _mm256_mul_ps(x.hi, x.lo)), t.lo
+		);
+	#endif
+
+	__m256x2 r;
+	r.hi = _mm256_add_ps(t.hi, c);
+	r.lo = _mm256_add_ps(_mm256_sub_ps(t.hi, r.hi), c);
+	return r;
+}
+
+static inline __m256x2 _mm256x2_recip_psx2(__m256x2 y) {
+	__m256 u = _mm256_div_ps(_mm256_set1_ps(1.0f), y.hi);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		/* 1.0 - u * y.hi is exact */
+		__m256 l = _mm256_div_ps(_mm256_fnmadd_ps(u, y.lo,
+			_mm256_fnmadd_ps(u, y.hi, _mm256_set1_ps(1.0f))
+		), y.hi);
+	#else
+		__m256x2 t = _mm256x2_dekker_mul12_ps(u, y.hi);
+		__m256 l = _mm256_div_ps(_mm256_sub_ps(
+			_mm256_sub_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), t.hi), t.lo),
+			_mm256_mul_ps(u, y.lo)
+		), y.hi);
+	#endif
+
+	__m256x2 r;
+	r.hi = _mm256_add_ps(u, l);
+	r.lo = _mm256_add_ps(_mm256_sub_ps(u, r.hi), l);
+	return r;
+}
+
+//------------------------------------------------------------------------------
+// __m256x2 optimized arithmetic
+//------------------------------------------------------------------------------
+
+static inline __m256x2 _mm256x2_add_psx2_ps(__m256x2 x, __m256 y) {
+	__m256 r_hi = _mm256_add_ps(x.hi, y);
+
+	__m256 rx_lo = _mm256_add_ps(
+		_mm256_add_ps(_mm256_sub_ps(x.hi, r_hi), y), x.lo
+	);
+	__m256 ry_lo = _mm256_add_ps(
+		_mm256_add_ps(_mm256_sub_ps(y, r_hi), x.hi),
+	x.lo);
+
+	const __m256 cmp_result = _mm256_cmp_ps(
+	 		_mm256_fabs_ps(x.hi), _mm256_fabs_ps(y),
+	_CMP_LE_OQ);
+	__m256 r_lo = _mm256_blendv_ps(rx_lo, ry_lo, cmp_result);
+
+	__m256x2 c;
+	c.hi = _mm256_add_ps(r_hi, r_lo);
+	c.lo = _mm256_add_ps(_mm256_sub_ps(r_hi, c.hi), r_lo);
+	return c;
+}
+
+static inline __m256x2 _mm256x2_add_ps_psx2(__m256 x, __m256x2 y) {
+	__m256 r_hi = _mm256_add_ps(x, y.hi);
+
+	__m256 rx_lo = _mm256_add_ps(
+		_mm256_add_ps(_mm256_sub_ps(x, r_hi), y.hi),
+	y.lo);
+	__m256 ry_lo = _mm256_add_ps(
+		_mm256_add_ps(_mm256_sub_ps(y.hi, r_hi), x), y.lo
+	);
+
+	const __m256 cmp_result = _mm256_cmp_ps(
+	 		_mm256_fabs_ps(x), _mm256_fabs_ps(y.hi),
+	_CMP_LE_OQ);
+	__m256 r_lo = _mm256_blendv_ps(rx_lo, ry_lo, cmp_result);
+
+	__m256x2 c;
+	c.hi = _mm256_add_ps(r_hi, r_lo);
+	c.lo = _mm256_add_ps(_mm256_sub_ps(r_hi, c.hi), r_lo);
+	return c;
+}
+
+/**
+ * @brief Adds two __m256 values with the result stored as a __m256x2
+ */
+static inline __m256x2 _mm256x2_add_ps_ps(__m256 x, __m256 y) {
+	__m256 r_hi = _mm256_add_ps(x, y);
+
+	__m256 rx_lo = _mm256_add_ps(_mm256_sub_ps(x, r_hi), y);
+	__m256 ry_lo = _mm256_add_ps(_mm256_sub_ps(y, r_hi), x);
+
+	const __m256 cmp_result = _mm256_cmp_ps(
+	 		_mm256_fabs_ps(x), _mm256_fabs_ps(y),
+	_CMP_LE_OQ);
+	__m256 r_lo = _mm256_blendv_ps(rx_lo, ry_lo, cmp_result);
+
+	__m256x2 c;
+	c.hi = _mm256_add_ps(r_hi, r_lo);
+	c.lo = _mm256_add_ps(_mm256_sub_ps(r_hi, c.hi), r_lo);
+	return c;
+}
+
+static inline __m256x2 _mm256x2_sub_psx2_ps(__m256x2 x, __m256 y) {
+	__m256 r_hi = _mm256_sub_ps(x.hi, y);
+
+	__m256 rx_lo = _mm256_add_ps(
+		_mm256_sub_ps(_mm256_sub_ps(x.hi, r_hi), y), x.lo
+	);
+
+	y = _mm256_negate_ps(y);
+	__m256 ry_lo = _mm256_add_ps(
+		_mm256_add_ps(_mm256_sub_ps(/* negative */ y, r_hi), x.hi), x.lo
+	);
+
+	const __m256 cmp_result = _mm256_cmp_ps(
+	 		_mm256_fabs_ps(x.hi), _mm256_fabs_ps(y),
+	_CMP_LE_OQ);
+	__m256 r_lo = _mm256_blendv_ps(rx_lo, ry_lo, cmp_result);
+
+	__m256x2 c;
+	c.hi = _mm256_add_ps(r_hi, r_lo);
+	c.lo = _mm256_add_ps(_mm256_sub_ps(r_hi, c.hi), r_lo);
+	return c;
+}
+
+static inline __m256x2 _mm256x2_sub_ps_psx2(__m256 x, __m256x2 y) {
+	__m256 r_hi = _mm256_sub_ps(x, y.hi);
+
+	__m256 rx_lo = _mm256_sub_ps(
+		_mm256_sub_ps(_mm256_sub_ps(x, r_hi), y.hi),
+	y.lo);
+
+	y.hi = _mm256_negate_ps(y.hi);
+	__m256 ry_lo = _mm256_sub_ps(
+		_mm256_add_ps(_mm256_sub_ps(/* negative */ y.hi, r_hi), x), y.lo
+	);
+
+	const __m256 cmp_result = _mm256_cmp_ps(
+	 		_mm256_fabs_ps(x), _mm256_fabs_ps(y.hi),
+	_CMP_LE_OQ);
+	__m256 r_lo = _mm256_blendv_ps(rx_lo, ry_lo, cmp_result);
+
+	__m256x2 c;
+	c.hi = _mm256_add_ps(r_hi, r_lo);
+	c.lo = _mm256_add_ps(_mm256_sub_ps(r_hi, c.hi), r_lo);
+	return c;
+}
+
+/**
+ * @brief Subtracts two __m256 values with the result stored as a __m256x2
+ */
+static inline __m256x2 _mm256x2_sub_ps_ps(__m256 x, __m256 y) {
+	__m256 r_hi = _mm256_sub_ps(x, y);
+
+	__m256 rx_lo = _mm256_sub_ps(_mm256_sub_ps(x, r_hi), y);
+
+	y = _mm256_negate_ps(y);
+	__m256 ry_lo = _mm256_add_ps(_mm256_sub_ps(/* negative */ y, r_hi), x);
+
+	const __m256 cmp_result = _mm256_cmp_ps(
+	 		_mm256_fabs_ps(x), _mm256_fabs_ps(y),
+	_CMP_LE_OQ);
+	__m256 r_lo = _mm256_blendv_ps(rx_lo, ry_lo, cmp_result);
+
+	__m256x2 c;
+	c.hi = _mm256_add_ps(r_hi, r_lo);
+	c.lo = _mm256_add_ps(_mm256_sub_ps(r_hi, c.hi), r_lo);
+	return c;
+}
+
+static inline __m256x2 _mm256x2_mul_psx2_ps(__m256x2 x, __m256 y) {
+	__m256x2 t = _mm256x2_dekker_mul12_ps(x.hi, y);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		__m256 c = _mm256_fmadd_ps(x.lo, y, t.lo);
+	#else
+		__m256 c = _mm256_add_ps(_mm256_mul_ps(x.lo, y), t.lo);
+	#endif
+
+	__m256x2 r;
+	r.hi = _mm256_add_ps(t.hi, c);
+	r.lo = _mm256_add_ps(_mm256_sub_ps(t.hi, r.hi), c);
+	return r;
+}
+
+static inline __m256x2 _mm256x2_mul_ps_psx2(__m256 x, __m256x2 y) {
+	__m256x2 t = _mm256x2_dekker_mul12_ps(x, y.hi);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		__m256 c = _mm256_fmadd_ps(x, y.lo, t.lo);
+	#else
+		__m256 c = _mm256_add_ps(_mm256_mul_ps(x, y.lo), t.lo);
+	#endif
+
+	__m256x2 r;
+	r.hi = _mm256_add_ps(t.hi, c);
+	r.lo = _mm256_add_ps(_mm256_sub_ps(t.hi, r.hi), c);
+	return r;
+}
+
+/**
+ * @brief Multiplies two __m256 values with the result stored as a __m256x2
+ */
+static inline __m256x2 _mm256x2_mul_ps_ps(__m256 x, __m256 y) {
+	return _mm256x2_dekker_mul12_ps(x, y);
+}
+
+static inline __m256x2 _mm256x2_div_psx2_ps(__m256x2 x, __m256 y) {
+	__m256 u = _mm256_div_ps(x.hi, y);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		__m256 l = _mm256_div_ps(
+			_mm256_add_ps(_mm256_fnmadd_ps(u, y, x.hi), x.lo), y
+		);
+	#else
+		__m256x2 t = _mm256x2_dekker_mul12_ps(u, y);
+		__m256 l = _mm256_div_ps(
+			_mm256_add_ps(_mm256_sub_ps(_mm256_sub_ps(x.hi, t.hi), t.lo), x.lo), y
+		);
+	#endif
+
+	__m256x2 r;
+	r.hi = _mm256_add_ps(u, l);
+	r.lo = _mm256_add_ps(_mm256_sub_ps(u, r.hi), l);
+	return r;
+}
+
+static inline __m256x2 _mm256x2_div_ps_psx2(__m256 x, __m256x2 y) {
+	__m256 u = _mm256_div_ps(x, y.hi);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		__m256 l = _mm256_div_ps(_mm256_fnmadd_ps(u, y.lo,
+			_mm256_fnmadd_ps(u, y.hi, x)
+		), y.hi);
+	#else
+		__m256x2 t = _mm256x2_dekker_mul12_ps(u, y.hi);
+		__m256 l = _mm256_div_ps(_mm256_sub_ps(
+			_mm256_sub_ps(_mm256_sub_ps(x, t.hi), t.lo),
+			_mm256_mul_ps(u, y.lo)
+		), y.hi);
+	#endif
+
+	__m256x2 r;
+	r.hi = _mm256_add_ps(u, l);
+	r.lo = _mm256_add_ps(_mm256_sub_ps(u, r.hi), l);
+	return r;
+}
+
+/**
+ * @brief Divides two __m256 values with the result stored as a __m256x2
+ */
+static inline __m256x2 _mm256x2_div_ps_ps(__m256 x, __m256 y) {
+	__m256 u = _mm256_div_ps(x, y);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		__m256 l = _mm256_div_ps(_mm256_fnmadd_ps(u, y, x), y);
+	#else
+		__m256x2 t = _mm256x2_dekker_mul12_ps(u, y);
+		__m256 l = _mm256_div_ps(
+			_mm256_sub_ps(_mm256_sub_ps(x, t.hi), t.lo), y
+		);
+	#endif
+
+	__m256x2 r;
+	r.hi = _mm256_add_ps(u, l);
+	r.lo = _mm256_add_ps(_mm256_sub_ps(u, r.hi), l);
+	return r;
+}
+
+/**
+ * @brief Squares a __m256 value with the result stored as a __m256x2
+ */
+static inline __m256x2 _mm256x2_square_ps(__m256 x) {
+	return _mm256x2_dekker_square12_ps(x);
+}
+
+/**
+ * @brief Calculates the reciprocal of a __m256 value with the result stored
+ * as a __m256x2
+ */
+static inline __m256x2 _mm256x2_recip_ps(__m256 y) {
+	__m256 u = _mm256_div_ps(_mm256_set1_ps(1.0f), y);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		__m256 l = _mm256_div_ps(
+			_mm256_fnmadd_ps(u, y, _mm256_set1_ps(1.0f)), y
+		);
+	#else
+		__m256x2 t = _mm256x2_dekker_mul12_ps(u, y);
+		__m256 l = _mm256_div_ps(
+			_mm256_sub_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), t.hi), t.lo), y
+		);
+	#endif
+
+	__m256x2 r;
+	r.hi = _mm256_add_ps(u, l);
+	r.lo = _mm256_add_ps(_mm256_sub_ps(u, r.hi), l);
+	return r;
+}
+
+//------------------------------------------------------------------------------
+// __m256x2 specialized arithmetic
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Multiplies by a known power of two (such as 2.0, 0.5, etc.) or zero
+ */
+static inline __m256x2 _mm256x2_mul_power2_psx2_ps(__m256x2 x, __m256 y) {
+	x.hi = _mm256_mul_ps(x.hi, y);
+	x.lo = _mm256_mul_ps(x.lo, y);
+	return x;
+}
+
+/**
+ * @brief Multiplies by a known power of two (such as 2.0, 0.5, etc.) or zero
+ */
+static inline __m256x2 _mm256x2_mul_power2_ps_psx2(__m256 x, __m256x2 y) {
+	y.hi = _mm256_mul_ps(x, y.hi);
+	y.lo = _mm256_mul_ps(x, y.lo);
+	return y;
+}
+
+//------------------------------------------------------------------------------
+// __m256x2 Mathematical Constants
+//------------------------------------------------------------------------------
+
+/**
+ * @brief ~2.718281828 Returns the value of euler's number
+ */
+static inline __m256x2 _mm256x2_const_e_psx2(void) {
+	const __m256x2 ret = {
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x402DF854)),
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x33B14577))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~1.442695041 Returns the value of log2(e)
+ */
+static inline __m256x2 _mm256x2_const_log2e_psx2(void) {
+	const __m256x2 ret = {
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x3FB8AA3B)),
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x32A57060))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~0.434294482 Returns the value of log10(e)
+ */
+static inline __m256x2 _mm256x2_const_log10e_psx2(void) {
+	const __m256x2 ret = {
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x3EDE5BD9)),
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0xB22D91AF))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~3.141592654 Returns the value of pi
+ */
+static inline __m256x2 _mm256x2_const_pi_psx2(void) {
+	const __m256x2 ret = {
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x40490FDB)),
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0xB3BBBD2E))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~0.318309886 Returns the value of 1 / pi
+ */
+static inline __m256x2 _mm256x2_const_inv_pi_psx2(void) {
+	const __m256x2 ret = {
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x3EA2F983)),
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x325C9C88))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~0.564189584 Returns the value of 1 / sqrt(pi)
+ */
+static inline __m256x2 _mm256x2_const_inv_sqrtpi_psx2(void) {
+	const __m256x2 ret = {
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x3F106EBB)),
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0xB2FBD649))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~0.693147181 Returns the value of ln(2)
+ */
+static inline __m256x2 _mm256x2_const_ln2_psx2(void) {
+	const __m256x2 ret = {
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x3F317218)),
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0xB102E308))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~2.302585093 Returns the value of ln(10)
+ */
+static inline __m256x2 _mm256x2_const_ln10_psx2(void) {
+	const __m256x2 ret = {
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x40135D8E)),
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0xB309555D))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~1.414213562 Returns the value of sqrt(2)
+ */
+static inline __m256x2 _mm256x2_const_sqrt2_psx2(void) {
+	const __m256x2 ret = {
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x3FB504F3)),
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x32CFE77A))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~1.732050808 Returns the value of sqrt(3)
+ */
+static inline __m256x2 _mm256x2_const_sqrt3_psx2(void) {
+	const __m256x2 ret = {
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x3FDDB3D7)),
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x330584CB))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~0.577350269 Returns the value of 1 / sqrt(3)
+ */
+static inline __m256x2 _mm256x2_const_inv_sqrt3_psx2(void) {
+	const __m256x2 ret = {
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x3F13CD3A)),
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x32320664))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~0.577215665 Returns the value of gamma (The Euler–Mascheroni constant)
+ */
+static inline __m256x2 _mm256x2_const_egamma_psx2(void) {
+	const __m256x2 ret = {
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x3F13C468)),
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0xB1E4127A))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~1.618033989 Returns the value of phi (The golden ratio)
+ */
+static inline __m256x2 _mm256x2_const_phi_psx2(void) {
+	const __m256x2 ret = {
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x3FCF1BBD)),
+		_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0xB28D016B))
+	};
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m256x2 floating point classify
+//------------------------------------------------------------------------------
+
+/* values */
+
+	/**
+	 * @brief Returns a __m256x2 value set to positive infinity
+	 */
+	static inline __m256x2 _mm256x2_get_infinity_psx2(void) {
+		__m256x2 ret = {
+			_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7F800000)),
+			_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7F800000))
+		};
+		return ret;
+	}
+
+	/**
+	 * @brief Returns a __m256x2 value set to signaling NaN
+	 */
+	static inline __m256x2 _mm256x2_get_sNaN_psx2(void) {
+		__m256x2 ret = {
+			_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7F800001)),
+			_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7F800001))
+		};
+		return ret;
+	}
+
+	/**
+	 * @brief Returns a __m256x2 value set to quiet NaN
+	 */
+	static inline __m256x2 _mm256x2_get_qNaN_psx2(void) {
+		__m256x2 ret = {
+			_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7FC00001)),
+			_mm256_castsi256_ps(_mm256_set1_epi32((int32_t)0x7FC00001))
+		};
+		return ret;
+	}
+
+/* Float Classify */
+
+	/** @brief Returns true if x is negative */
+	static inline __m256 _mm256_signbit_psx2(const __m256x2 x) {
+		return _mm256_signbit_ps(x.hi);
+	}
+
+	/** @brief Returns true if x is finite */
+	static inline __m256 _mm256_isfinite_psx2(const __m256x2 x) {
+		return _mm256_isfinite_ps(x.hi);
+	}
+
+	/** @brief Returns true if x is +-infinity */
+	static inline __m256 _mm256_isinf_psx2(const __m256x2 x) {
+		return _mm256_isinf_ps(x.hi);
+	}
+
+	/** @brief Returns true if x is any kind of NaN */
+	static inline __m256 _mm256_isnan_psx2(const __m256x2 x) {
+		return _mm256_isnan_ps(x.hi);
+	}
+
+	/** @brief Returns true if x is normal */
+	static inline __m256 _mm256_isnormal_psx2(const __m256x2 x) {
+		return _mm256_and_ps(
+			_mm256_isnormal_ps(x.hi),
+			_mm256_or_ps(
+				_mm256_isnormal_ps(x.lo),
+				_mm256_cmp_ps(x.lo, _mm256_setzero_ps(), _CMP_EQ_OQ)
+			)
+		);
+	}
+
+	/** @brief Returns true if x is denormal and non-zero */
+	static inline __m256 _mm256_isdenormal_psx2(const __m256x2 x) {
+		return _mm256_or_ps(
+			_mm256_isdenormal_ps(x.hi), _mm256_isdenormal_ps(x.lo)
+		);
+	}
+
+	/** @brief Returns true if x and y are unordered */
+	static inline __m256 _mm256_isunordered_psx2(const __m256x2 x, const __m256x2 y) {
+		return _mm256_isunordered_ps(x.hi, y.hi);
+	}
+
+//------------------------------------------------------------------------------
+// __m256x2 max/min functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns the fmax of x and y. Correctly handling NaN and signed zeros.
+ * You may use _mm256x2_max_psx2 as a faster alternative.
+ */
+static inline __m256x2 _mm256x2_fmax_psx2(__m256x2 x, __m256x2 y) {
+	__m256 fmax_cmp =
+		_mm256_or_ps(
+			_mm256_or_ps(
+				_mm256_cmplt_psx2(x, y),
+				_mm256_isnan_psx2(x)
+			),
+			_mm256_and_ps(
+				_mm256_signbit_psx2(x),
+				_mm256_cmpeq_psx2(x, y)
+			)
+		);
+	__m256x2 ret;
+	ret.hi = _mm256_blendv_ps(x.hi, y.hi, fmax_cmp);
+	ret.lo = _mm256_blendv_ps(x.lo, y.lo, fmax_cmp);
+	return ret;
+}
+
+/**
+ * @brief Returns the fmin of x and y. Correctly handling NaN and signed zeros.
+ * You may use _mm256x2_min_psx2 as a faster alternative.
+ */
+static inline __m256x2 _mm256x2_fmin_psx2(__m256x2 x, __m256x2 y) {
+	__m256 fmin_cmp =
+		_mm256_or_ps(
+			_mm256_or_ps(
+				_mm256_cmpgt_psx2(x, y),
+				_mm256_isnan_psx2(x)
+			),
+			_mm256_andnot_ps(
+				_mm256_signbit_psx2(x),
+				_mm256_cmpeq_psx2(x, y)
+			)
+		);
+	__m256x2 ret;
+	ret.hi = _mm256_blendv_ps(x.hi, y.hi, fmin_cmp);
+	ret.lo = _mm256_blendv_ps(x.lo, y.lo, fmin_cmp);
+	return ret;
+}
+
+static inline __m256x2 _mm256x2_max_psx2(__m256x2 x, __m256x2 y) {
+	const __m256 cmp_max = _mm256_cmplt_psx2(x, y);
+	__m256x2 ret;
+	ret.hi = _mm256_blendv_ps(x.hi, y.hi, cmp_max);
+	ret.lo = _mm256_blendv_ps(x.lo, y.lo, cmp_max);
+	return ret;
+}
+
+static inline __m256x2 _mm256x2_min_psx2(__m256x2 x, __m256x2 y) {
+	const __m256 cmp_max = _mm256_cmpgt_psx2(x, y);
+	__m256x2 ret;
+	ret.hi = _mm256_blendv_ps(x.hi, y.hi, cmp_max);
+	ret.lo = _mm256_blendv_ps(x.lo, y.lo, cmp_max);
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m256x2 rounding functions
+//------------------------------------------------------------------------------
+
+/** same as aint(x) */
+static inline __m256x2 _mm256x2_trunc_psx2(__m256x2 x) {
+	__m256 int_hi = _mm256_trunc_ps(x.hi);
+	__m256 int_lo = _mm256_trunc_ps(x.lo);
+	__m256 frac_hi = _mm256_sub_ps(x.hi, int_hi);
+	__m256 frac_lo = _mm256_sub_ps(x.lo, int_lo);
+	
+	__m256 frac_ge_1 = _mm256_cmp_ps(_mm256_add_ps(frac_hi, frac_lo), _mm256_set1_ps(1.0f), _CMP_GE_OQ);
+
+	__m256x2 trunc_all = _mm256x2_add_psx2_ps(_mm256x2_add_ps_ps(
+		_mm256_blendv_ps(_mm256_setzero_ps(), _mm256_set1_ps(1.0f), frac_ge_1),
+		int_lo
+	), int_hi);
+	return trunc_all;
+}
+
+static inline __m256x2 _mm256x2_floor_psx2(__m256x2 x) {
+	__m256x2 int_part = _mm256x2_trunc_psx2(x);
+	
+	__m256 cmp_floor;
+	cmp_floor = _mm256_and_ps(
+		_mm256_cmplt_psx2(x, _mm256x2_setzero_psx2()),
+		_mm256_cmpneq_psx2(x, int_part)
+	);
+	__m256 floor_part = _mm256_blendv_ps(
+		_mm256_setzero_ps(), _mm256_set1_ps(1.0f), cmp_floor
+	);
+	return _mm256x2_sub_psx2_ps(int_part, floor_part);
+}
+
+static inline __m256x2 _mm256x2_ceil_psx2(__m256x2 x) {
+	__m256x2 int_part = _mm256x2_trunc_psx2(x);
+	
+	__m256 cmp_ceil = _mm256_and_ps(
+		_mm256_cmpgt_psx2(x, _mm256x2_setzero_psx2()),
+		_mm256_cmpneq_psx2(x, int_part)
+	);
+	__m256 ceil_part = _mm256_blendv_ps(
+		_mm256_setzero_ps(), _mm256_set1_ps(1.0f), cmp_ceil
+	);
+	return _mm256x2_add_psx2_ps(int_part, ceil_part);
+}
+
+/** same as nint(x) */
+static inline __m256x2 _mm256x2_round_psx2(__m256x2 x) {
+	__m256x2 round_up = _mm256x2_add_psx2_ps(_mm256x2_floor_psx2(x), _mm256_set1_ps(0.5f));
+	__m256x2 round_dn = _mm256x2_sub_psx2_ps(_mm256x2_ceil_psx2 (x), _mm256_set1_ps(0.5f));
+	__m256 cmp_mask = _mm256_cmplt_psx2(x, _mm256x2_setzero_psx2());
+	__m256x2 ret;
+	ret.hi = _mm256_blendv_ps(round_up.hi, round_dn.hi, cmp_mask);
+	ret.lo = _mm256_blendv_ps(round_up.lo, round_dn.lo, cmp_mask);
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m256x2 math.h functions
+//------------------------------------------------------------------------------
+
+static inline __m256x2 _mm256x2_fabs_psx2(__m256x2 x) {
+	const __m256 sign_mask = _mm256_and_ps(
+		x.hi,
+		_mm256_get_sign_mask_ps()
+	);
+	x.hi = _mm256_xor_ps(x.hi, sign_mask);
+	x.lo = _mm256_xor_ps(x.lo, sign_mask);
+	return x;
+}
+
+static inline __m256x2 _mm256x2_fdim_psx2(__m256x2 x, __m256x2 y) {
+	__m256x2 ret;
+	ret = _mm256x2_sub_psx2(x, y);
+	// returns true when ret > 0.0 or ret is NaN
+	__m256 cmp_nle = _mm256_cmpnle_zero_psx2(ret);
+	// NaN remains NaN, and -0.0 becomes +0.0
+	ret.hi = _mm256_and_ps(ret.hi, cmp_nle);
+	ret.lo = _mm256_and_ps(ret.lo, cmp_nle);
+	return ret;
+}
+
+static inline __m256x2 _mm256x2_copysign_psx2(__m256x2 x, __m256x2 y) {
+	const __m256 sign_mask = _mm256_and_ps(
+		_mm256_xor_ps(x.hi, y.hi),
+		_mm256_get_sign_mask_ps()
+	);
+	x.hi = _mm256_xor_ps(x.hi, sign_mask);
+	x.lo = _mm256_xor_ps(x.lo, sign_mask);
+	return x;
+}
+
+static inline __m256x2 _mm256x2_copysign_psx2_ps(__m256x2 x, __m256 y) {
+	const __m256 sign_mask = _mm256_and_ps(
+		_mm256_xor_ps(x.hi, y),
+		_mm256_get_sign_mask_ps()
+	);
+	x.hi = _mm256_xor_ps(x.hi, sign_mask);
+	x.lo = _mm256_xor_ps(x.lo, sign_mask);
+	return x;
+}
+
+static inline __m256x2 _mm256x2_sqrt_psx2(__m256x2 x) {
+	__m256 guess = _mm256_sqrt_ps(x.hi);
+	return _mm256x2_and_psx2(
+		_mm256x2_mul_power2_psx2_ps(
+			_mm256x2_add_ps_psx2(guess, _mm256x2_div_psx2_ps(x, guess)),
+			_mm256_set1_ps(0.5f)
+		),
+		// returns 0.0 on division by 0.0
+		_mm256x2_cmp_extend_ps(
+			_mm256_cmp_ps(guess, _mm256_setzero_ps(), _CMP_NEQ_UQ)
+		)
+	);
+}
+
+/**
+ * @brief returns the fractional part of a __m256x2 value.
+ * @note int_part cannot not be NULL
+ */
+static inline __m256x2 _mm256x2_modf_psx2(__m256x2 x, __m256x2* int_part) {
+	__m256x2 trunc_part = _mm256x2_trunc_psx2(x);
+	*int_part = trunc_part;
+	return _mm256x2_sub_psx2(x, trunc_part);
+}
+
+static inline __m256x2 _mm256x2_fmod_psx2(__m256x2 x, __m256x2 y) {
+	__m256x2 trunc_part = _mm256x2_trunc_psx2(_mm256x2_div_psx2(x, y));
+	return _mm256x2_sub_psx2(x, _mm256x2_mul_psx2(y, trunc_part));
+}
+
+//------------------------------------------------------------------------------
+// __m256x2 exponents and logarithms
+//------------------------------------------------------------------------------
+
+/**
+ * @note exp, log, sin, and cos are calculated in double precision with the
+ * __m256d functions from Float64_AVX.h, which have more precision than
+ * Float32x2. Float64_AVX.c must be compiled and linked.
+ */
+
+__m256x2 _mm256x2_exp_psx2(__m256x2 x);
+
+__m256x2 _mm256x2_expm1_psx2(__m256x2 x);
+
+static inline __m256x2 _mm256x2_exp2_psx2(const __m256x2 x) {
+	return _mm256x2_exp_psx2(_mm256x2_mul_psx2(x, _mm256x2_const_ln2_psx2()));
+}
+
+static inline __m256x2 _mm256x2_exp10_psx2(const __m256x2 x) {
+	return _mm256x2_exp_psx2(_mm256x2_mul_psx2(x, _mm256x2_const_ln10_psx2()));
+}
+
+__m256x2 _mm256x2_log_psx2(__m256x2 x);
+
+__m256x2 _mm256x2_log1p_psx2(__m256x2 x);
+
+static inline __m256x2 _mm256x2_log2_psx2(const __m256x2 x) {
+	return _mm256x2_mul_psx2(_mm256x2_log_psx2(x), _mm256x2_const_log2e_psx2());
+}
+
+static inline __m256x2 _mm256x2_log10_psx2(const __m256x2 x) {
+	return _mm256x2_mul_psx2(_mm256x2_log_psx2(x), _mm256x2_const_log10e_psx2());
+}
+
+//------------------------------------------------------------------------------
+// __m256x2 trigonometry
+//------------------------------------------------------------------------------
+
+__m256x2 _mm256x2_sin_psx2(__m256x2 x);
+
+__m256x2 _mm256x2_cos_psx2(__m256x2 x);
+
+/**
+ * @warning p_sin and p_cos must be aligned on a 32-byte boundary or a
+ * general-protection exception may be generated.
+ */
+void _mm256x2_sincos_psx2(
+	__m256x2 theta, __m256x2* p_sin, __m256x2* p_cos
+);
+
+static inline __m256x2 _mm256x2_tan_psx2(__m256x2 x) {
+	__m256x2 t_sin, t_cos;
+	_mm256x2_sincos_psx2(x, &t_sin, &t_cos);
+	return _mm256x2_div_psx2(t_sin, t_cos);
+}
+
+/** @brief Computes sin(pi * x) with an exact argument reduction */
+__m256x2 _mm256x2_sinpi_psx2(__m256x2 x);
+
+/** @brief Computes cos(pi * x) with an exact argument reduction */
+__m256x2 _mm256x2_cospi_psx2(__m256x2 x);
+
+/**
+ * @warning p_sin and p_cos must be aligned on a 32-byte boundary or a
+ * general-protection exception may be generated.
+ */
+void _mm256x2_sincospi_psx2(
+	__m256x2 x, __m256x2* p_sin, __m256x2* p_cos
+);
+
+static inline __m256x2 _mm256x2_tanpi_psx2(__m256x2 x) {
+	__m256x2 t_sin, t_cos;
+	_mm256x2_sincospi_psx2(x, &t_sin, &t_cos);
+	return _mm256x2_div_psx2(t_sin, t_cos);
+}
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* FLOAT32X2_AVX_H */
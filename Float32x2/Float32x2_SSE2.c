@@ -0,0 +1,147 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "Float32x2_SSE2.h"
+
+#include <math.h>
+#include <emmintrin.h>
+
+//------------------------------------------------------------------------------
+// __m128x2 conversions to and from double
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Rounds a double to a Float32x2. The low part is set to zero when the
+ * high part is infinite or NaN.
+ */
+static inline Float32x2 _internal_mm128x2_round_to_fp32x2(const double x) {
+	Float32x2 ret;
+	ret.hi = (fp32)x;
+	ret.lo = isfinite(ret.hi) ? (fp32)(x - (double)ret.hi) : 0.0f;
+	return ret;
+}
+
+/**
+ * @brief Evaluates func(hi, lo) in double precision on each element.
+ */
+static inline __m128x2 _internal_mm128x2_map_psx2(
+	const __m128x2 x, double (*func)(double, double)
+) {
+	fp32 x_hi[4], x_lo[4];
+	_mm_storeu_ps(x_hi, x.hi);
+	_mm_storeu_ps(x_lo, x.lo);
+	Float32x2 x_val[4];
+	for (int i = 0; i < 4; i++) {
+		x_val[i] = _internal_mm128x2_round_to_fp32x2(
+			func((double)x_hi[i], (double)x_lo[i])
+		);
+	}
+	__m128x2 ret;
+	ret.hi = _mm_set_ps(x_val[3].hi, x_val[2].hi, x_val[1].hi, x_val[0].hi);
+	ret.lo = _mm_set_ps(x_val[3].lo, x_val[2].lo, x_val[1].lo, x_val[0].lo);
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m128x2 exponents and logarithms
+//------------------------------------------------------------------------------
+
+/**
+ * @brief exp(hi + lo) = exp(hi) * (1 + lo + lo^2 / 2)
+ */
+static double _internal_mm128x2_exp_d(const double hi, const double lo) {
+	return exp(hi) * (1.0 + lo * (1.0 + lo * 0.5));
+}
+
+__m128x2 _mm128x2_exp_psx2(const __m128x2 x) {
+	return _internal_mm128x2_map_psx2(x, _internal_mm128x2_exp_d);
+}
+
+/**
+ * @brief expm1(hi + lo) = expm1(hi) + (expm1(hi) + 1) * (lo + lo^2 / 2)
+ */
+static double _internal_mm128x2_expm1_d(const double hi, const double lo) {
+	const double em1 = expm1(hi);
+	if (lo == 0.0) {
+		return em1;
+	}
+	return em1 + (em1 + 1.0) * (lo * (1.0 + lo * 0.5));
+}
+
+__m128x2 _mm128x2_expm1_psx2(const __m128x2 x) {
+	return _internal_mm128x2_map_psx2(x, _internal_mm128x2_expm1_d);
+}
+
+/**
+ * @brief log(hi + lo) = log(hi) + q - q^2 / 2, where q = lo / hi
+ */
+static double _internal_mm128x2_log_d(const double hi, const double lo) {
+	if (lo == 0.0) {
+		return log(hi);
+	}
+	const double q = lo / hi;
+	return log(hi) + q * (1.0 - q * 0.5);
+}
+
+__m128x2 _mm128x2_log_psx2(const __m128x2 x) {
+	return _internal_mm128x2_map_psx2(x, _internal_mm128x2_log_d);
+}
+
+/**
+ * @brief log1p(hi + lo) = log1p(hi) + q - q^2 / 2, where q = lo / (1 + hi)
+ */
+static double _internal_mm128x2_log1p_d(const double hi, const double lo) {
+	if (lo == 0.0) {
+		return log1p(hi);
+	}
+	const double q = lo / (1.0 + hi);
+	return log1p(hi) + q * (1.0 - q * 0.5);
+}
+
+__m128x2 _mm128x2_log1p_psx2(const __m128x2 x) {
+	return _internal_mm128x2_map_psx2(x, _internal_mm128x2_log1p_d);
+}
+
+//------------------------------------------------------------------------------
+// __m128x2 trigonometry
+//------------------------------------------------------------------------------
+
+/**
+ * @brief sin(hi + lo) = sin(hi) + (cos(hi) * lo - sin(hi) * lo^2 / 2)
+ */
+static double _internal_mm128x2_sin_d(const double hi, const double lo) {
+	const double sin_val = sin(hi);
+	const double cos_val = cos(hi);
+	const double half_lo_sqr = (lo * lo) * 0.5;
+	return sin_val + (cos_val * lo - sin_val * half_lo_sqr);
+}
+
+/**
+ * @brief cos(hi + lo) = cos(hi) - (sin(hi) * lo + cos(hi) * lo^2 / 2)
+ */
+static double _internal_mm128x2_cos_d(const double hi, const double lo) {
+	const double sin_val = sin(hi);
+	const double cos_val = cos(hi);
+	const double half_lo_sqr = (lo * lo) * 0.5;
+	return cos_val - (sin_val * lo + cos_val * half_lo_sqr);
+}
+
+__m128x2 _mm128x2_sin_psx2(const __m128x2 x) {
+	return _internal_mm128x2_map_psx2(x, _internal_mm128x2_sin_d);
+}
+
+__m128x2 _mm128x2_cos_psx2(const __m128x2 x) {
+	return _internal_mm128x2_map_psx2(x, _internal_mm128x2_cos_d);
+}
+
+void _mm128x2_sincos_psx2(
+	const __m128x2 theta, __m128x2* const p_sin, __m128x2* const p_cos
+) {
+	*p_sin = _internal_mm128x2_map_psx2(theta, _internal_mm128x2_sin_d);
+	*p_cos = _internal_mm128x2_map_psx2(theta, _internal_mm128x2_cos_d);
+}
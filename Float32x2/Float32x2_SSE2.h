@@ -0,0 +1,1786 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+#ifndef FLOAT32X2_SSE2_H
+#define FLOAT32X2_SSE2_H
+
+/**
+ * @brief Double-Float32 SSE2 Dekker Float implementation.
+ * Source: Creel "Double it Like Dekker" on YouTube.
+ *
+ * @note Requires SSE2 or later. SSE4.1 is used when available.
+ * @warning -Ofast may break this library. -O3 compiles okay on gcc and clang.
+ */
+
+#include "Float32x2_def.h"
+#include "../Float32/Float32_SSE2.h"
+#include "../LDF/LDF_fma.h"
+
+#include <stdint.h>
+
+#if (!defined(__SSE2__) && defined(__GNUC__))
+	#error "__SSE2__ is not enabled in your compiler. Try -msse2"
+#endif
+
+#include <emmintrin.h>
+
+#ifdef __SSE4_1__
+	#include <smmintrin.h>
+#endif
+#ifdef __SSE4_2__
+	#include <nmmintrin.h>
+#endif
+#ifdef __AVX__
+	#include <immintrin.h>
+#endif
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+//------------------------------------------------------------------------------
+// __m128x2 struct
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Holds four Double-Float32 dekker floats
+ */
+typedef struct __m128x2 {
+	__m128 hi;
+	__m128 lo;
+} __m128x2;
+
+//------------------------------------------------------------------------------
+// __m128x2 set1 functions
+//------------------------------------------------------------------------------
+
+static inline __m128x2 _mm128x2_setzero_psx2(void) {
+	__m128x2 ret;
+	ret.hi = _mm_setzero_ps();
+	ret.lo = _mm_setzero_ps();
+	return ret;
+}
+
+static inline __m128x2 _mm128x2_set1_psx2(Float32x2 val) {
+	__m128x2 ret;
+	ret.hi = _mm_set1_ps(val.hi);
+	ret.lo = _mm_set1_ps(val.lo);
+	return ret;
+}
+
+static inline __m128x2 _mm128x2_set1_ps(float x) {
+	__m128x2 ret;
+	ret.hi = _mm_set1_ps(x);
+	ret.lo = _mm_setzero_ps();
+	return ret;
+}
+
+static inline __m128x2 _mm128x2_set1_epi32(int x) {
+	__m128x2 ret;
+	ret.hi = _mm_castsi128_ps(_mm_set1_epi32(x));
+	ret.lo = _mm_castsi128_ps(_mm_set1_epi32(x));
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m128x2 set functions
+//------------------------------------------------------------------------------
+
+static inline __m128x2 _mm128x2_set_ps(
+	float e3, float e2, float e1, float e0
+) {
+	__m128x2 ret;
+	ret.hi = _mm_set_ps(e3, e2, e1, e0);
+	ret.lo = _mm_setzero_ps();
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m128x2 setr (set reverse) functions
+//------------------------------------------------------------------------------
+
+static inline __m128x2 _mm128x2_setr_ps(
+	float e3, float e2, float e1, float e0
+) {
+	__m128x2 ret;
+	ret.hi = _mm_setr_ps(e3, e2, e1, e0);
+	ret.lo = _mm_setzero_ps();
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m128x2 load operations
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Loads four interleaved {hi, lo} pairs.
+ * @note mem_addr must be aligned on a 16-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline __m128x2 _mm128x2_load_ps(const float* mem_addr) {
+	// hi.0, lo.0, hi.1, lo.1
+	const __m128 v0 = _mm_load_ps(mem_addr);
+	// hi.2, lo.2, hi.3, lo.3
+	const __m128 v1 = _mm_load_ps(mem_addr + 4);
+
+	__m128x2 val;
+	val.hi = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0));
+	val.lo = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1));
+	return val;
+}
+
+/**
+ * @brief Loads four interleaved {hi, lo} pairs.
+ */
+static inline __m128x2 _mm128x2_loadu_ps(const float* mem_addr) {
+	// hi.0, lo.0, hi.1, lo.1
+	const __m128 v0 = _mm_loadu_ps(mem_addr);
+	// hi.2, lo.2, hi.3, lo.3
+	const __m128 v1 = _mm_loadu_ps(mem_addr + 4);
+
+	__m128x2 val;
+	val.hi = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0));
+	val.lo = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1));
+	return val;
+}
+
+/**
+ * @note mem_addr must be aligned on a 16-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline __m128x2 _mm128x2_load_psx2(const Float32x2* mem_addr) {
+	return _mm128x2_load_ps((const float*)((const void*)mem_addr));
+}
+
+static inline __m128x2 _mm128x2_loadu_psx2(const Float32x2* mem_addr) {
+	return _mm128x2_loadu_ps((const float*)((const void*)mem_addr));
+}
+
+/**
+ * @note mem_addr must be aligned on a 16-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline __m128x2 _mm128x2_load_raw_ps(const float* mem_addr) {
+	__m128x2 val;
+	val.hi = _mm_load_ps(mem_addr);
+	mem_addr += sizeof(__m128) / sizeof(float);
+	val.lo = _mm_load_ps(mem_addr);
+	return val;
+}
+
+static inline __m128x2 _mm128x2_loadu_raw_ps(const float* mem_addr) {
+	__m128x2 val;
+	val.hi = _mm_loadu_ps(mem_addr);
+	mem_addr += sizeof(__m128) / sizeof(float);
+	val.lo = _mm_loadu_ps(mem_addr);
+	return val;
+}
+
+//------------------------------------------------------------------------------
+// __m128x2 store operations
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Stores four interleaved {hi, lo} pairs.
+ * @note mem_addr must be aligned on a 16-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline void _mm128x2_store_ps(float* mem_addr, __m128x2 val) {
+	// hi.0, lo.0, hi.1, lo.1
+	_mm_store_ps(mem_addr    , _mm_unpacklo_ps(val.hi, val.lo));
+	// hi.2, lo.2, hi.3, lo.3
+	_mm_store_ps(mem_addr + 4, _mm_unpackhi_ps(val.hi, val.lo));
+}
+
+/**
+ * @brief Stores four interleaved {hi, lo} pairs.
+ */
+static inline void _mm128x2_storeu_ps(float* mem_addr, __m128x2 val) {
+	// hi.0, lo.0, hi.1, lo.1
+	_mm_storeu_ps(mem_addr    , _mm_unpacklo_ps(val.hi, val.lo));
+	// hi.2, lo.2, hi.3, lo.3
+	_mm_storeu_ps(mem_addr + 4, _mm_unpackhi_ps(val.hi, val.lo));
+}
+
+/**
+ * @note mem_addr must be aligned on a 16-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline void _mm128x2_store_psx2(Float32x2* mem_addr, __m128x2 val) {
+	_mm128x2_store_ps((float*)((void*)mem_addr), val);
+}
+
+static inline void _mm128x2_storeu_psx2(Float32x2* mem_addr, __m128x2 val) {
+	_mm128x2_storeu_ps((float*)((void*)mem_addr), val);
+}
+
+/**
+ * @note mem_addr must be aligned on a 16-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline void _mm_store_raw_psx2(float* mem_addr, __m128x2 x) {
+	_mm_store_ps(mem_addr, x.hi);
+	mem_addr += sizeof(__m128) / sizeof(float);
+	_mm_store_ps(mem_addr, x.lo);
+}
+
+static inline void _mm_storeu_raw_psx2(float* mem_addr, __m128x2 x) {
+	_mm_storeu_ps(mem_addr, x.hi);
+	mem_addr += sizeof(__m128) / sizeof(float);
+	_mm_storeu_ps(mem_addr, x.lo);
+}
+
+//------------------------------------------------------------------------------
+// __m128x2 bitwise operations
+//------------------------------------------------------------------------------
+
+/**
+ * @brief bitwise not `~x`
+ */
+static inline __m128x2 _mm128x2_not_psx2(__m128x2 x) {
+	x.hi = _mm_not_ps(x.hi);
+	x.lo = _mm_not_ps(x.lo);
+	return x;
+}
+
+/**
+ * @brief bitwise and `x & y`
+ */
+static inline __m128x2 _mm128x2_and_psx2(__m128x2 x, __m128x2 y) {
+	x.hi = _mm_and_ps(x.hi, y.hi);
+	x.lo = _mm_and_ps(x.lo, y.lo);
+	return x;
+}
+
+/**
+ * @brief bitwise andnot `x & ~y`
+ */
+static inline __m128x2 _mm128x2_andnot_psx2(__m128x2 x, __m128x2 y) {
+	x.hi = _mm_andnot_ps(x.hi, y.hi);
+	x.lo = _mm_andnot_ps(x.lo, y.lo);
+	return x;
+}
+
+/**
+ * @brief bitwise or `x | y`
+ */
+static inline __m128x2 _mm128x2_or_psx2(__m128x2 x, __m128x2 y) {
+	x.hi = _mm_or_ps(x.hi, y.hi);
+	x.lo = _mm_or_ps(x.lo, y.lo);
+	return x;
+}
+
+/**
+ * @brief bitwise xor `x ^ y`
+ */
+static inline __m128x2 _mm128x2_xor_psx2(__m128x2 x, __m128x2 y) {
+	x.hi = _mm_xor_ps(x.hi, y.hi);
+	x.lo = _mm_xor_ps(x.lo, y.lo);
+	return x;
+}
+
+//------------------------------------------------------------------------------
+// __m128x2 comparison extend
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Copies cmp to val[0 - 1]. Used for extending comparison results.
+ */
+static inline __m128x2 _mm128x2_cmp_extend_ps(__m128 cmp) {
+	__m128x2 ret = {cmp, cmp};
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m128x2 comparison functions
+//------------------------------------------------------------------------------
+
+/* __m128x2 compare __m128x2 */
+
+	/**
+	 * @brief _CMP_ORD_Q
+	 */
+	static inline __m128 _mm_cmpord_psx2(__m128x2 x, __m128x2 y) {
+		__m128 cmp_hi = _mm_cmpord_ps(x.hi, y.hi);
+		__m128 cmp_lo = _mm_cmpord_ps(x.lo, y.lo);
+		return _mm_and_ps(cmp_hi, cmp_lo);
+	}
+
+	/**
+	 * @brief _CMP_UNORD_Q
+	 */
+	static inline __m128 _mm_cmpunord_psx2(__m128x2 x, __m128x2 y) {
+		__m128 cmp_hi = _mm_cmpunord_ps(x.hi, y.hi);
+		__m128 cmp_lo = _mm_cmpunord_ps(x.lo, y.lo);
+		return _mm_or_ps(cmp_hi, cmp_lo);
+	}
+
+	/**
+	 * @brief _CMP_EQ_OQ
+	 */
+	static inline __m128 _mm_cmpeq_psx2(__m128x2 x, __m128x2 y) {
+		__m128 cmp_hi = _mm_cmpeq_ps(x.hi, y.hi);
+		__m128 cmp_lo = _mm_cmpeq_ps(x.lo, y.lo);
+		return _mm_and_ps(cmp_hi, cmp_lo);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_OQ
+	 */
+	static inline __m128 _mm_cmpneq_psx2(__m128x2 x, __m128x2 y) {
+		__m128 cmp_hi = _mm_cmpneq_ps(x.hi, y.hi);
+		__m128 cmp_lo = _mm_cmpneq_ps(x.lo, y.lo);
+		return _mm_or_ps(cmp_hi, cmp_lo);
+	}
+
+#ifdef __AVX__
+
+	/**
+	 * @brief _CMP_NEQ_UQ
+	 */
+	static inline __m128 _mm_cmplg_psx2(__m128x2 x, __m128x2 y) {
+		__m128 cmp_hi = _mm_cmp_ps(x.hi, y.hi, _CMP_NEQ_UQ);
+		__m128 cmp_lo = _mm_cmp_ps(x.lo, y.lo, _CMP_NEQ_UQ);
+		return _mm_or_ps(cmp_hi, cmp_lo);
+	}
+
+	/**
+	 * @brief _CMP_EQ_UQ
+	 */
+	static inline __m128 _mm_cmpnlg_psx2(__m128x2 x, __m128x2 y) {
+		__m128 cmp_hi = _mm_cmp_ps(x.hi, y.hi, _CMP_EQ_UQ);
+		__m128 cmp_lo = _mm_cmp_ps(x.lo, y.lo, _CMP_EQ_UQ);
+		return _mm_and_ps(cmp_hi, cmp_lo);
+	}
+
+#else
+
+	/**
+	 * @brief _CMP_EQ_UQ
+	 */
+	static inline __m128 _mm_cmplg_psx2(__m128x2 x, __m128x2 y) {
+		__m128 cmp_hi = _mm_or_ps(_mm_cmplt_ps(x.hi, y.hi), _mm_cmpgt_ps(x.hi, y.hi));
+		__m128 cmp_lo = _mm_cmpneq_ps(x.lo, y.lo);
+		return _mm_or_ps(cmp_hi, cmp_lo);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_UQ
+	 */
+	static inline __m128 _mm_cmpnlg_psx2(__m128x2 x, __m128x2 y) {
+		__m128 cmp_hi = _mm_and_ps(_mm_cmpnlt_ps(x.hi, y.hi), _mm_cmpngt_ps(x.hi, y.hi));
+		__m128 cmp_lo = _mm_cmpeq_ps(x.lo, y.lo);
+		return _mm_and_ps(cmp_hi, cmp_lo);
+	}
+
+#endif
+
+	/**
+	 * @brief _CMP_LT_OQ
+	 */
+	static inline __m128 _mm_cmplt_psx2(__m128x2 x, __m128x2 y) {
+		return _mm_or_ps(
+			_mm_cmplt_ps(x.hi, y.hi),
+			_mm_and_ps(
+				_mm_cmpeq_ps(x.hi, y.hi),
+				_mm_cmplt_ps(x.lo, y.lo)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_LE_OQ
+	 */
+	static inline __m128 _mm_cmple_psx2(__m128x2 x, __m128x2 y) {
+		return _mm_or_ps(
+			_mm_cmplt_ps(x.hi, y.hi),
+			_mm_and_ps(
+				_mm_cmpeq_ps(x.hi, y.hi),
+				_mm_cmple_ps(x.lo, y.lo)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_GT_OQ
+	 */
+	static inline __m128 _mm_cmpgt_psx2(__m128x2 x, __m128x2 y) {
+		return _mm_or_ps(
+			_mm_cmpgt_ps(x.hi, y.hi),
+			_mm_and_ps(
+				_mm_cmpeq_ps(x.hi, y.hi),
+				_mm_cmpgt_ps(x.lo, y.lo)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_GE_OQ
+	 */
+	static inline __m128 _mm_cmpge_psx2(__m128x2 x, __m128x2 y) {
+		return _mm_or_ps(
+			_mm_cmpgt_ps(x.hi, y.hi),
+			_mm_and_ps(
+				_mm_cmpeq_ps(x.hi, y.hi),
+				_mm_cmpge_ps(x.lo, y.lo)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NLT_UQ
+	 */
+	static inline __m128 _mm_cmpnlt_psx2(__m128x2 x, __m128x2 y) {
+		return _mm_and_ps(
+			_mm_cmpnlt_ps(x.hi, y.hi),
+			_mm_or_ps(
+				_mm_cmpneq_ps(x.hi, y.hi),
+				_mm_cmpnlt_ps(x.lo, y.lo)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NLE_UQ
+	 */
+	static inline __m128 _mm_cmpnle_psx2(__m128x2 x, __m128x2 y) {
+		return _mm_and_ps(
+			_mm_cmpnlt_ps(x.hi, y.hi),
+			_mm_or_ps(
+				_mm_cmpneq_ps(x.hi, y.hi),
+				_mm_cmpnle_ps(x.lo, y.lo)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NGT_UQ
+	 */
+	static inline __m128 _mm_cmpngt_psx2(__m128x2 x, __m128x2 y) {
+		return _mm_and_ps(
+			_mm_cmpngt_ps(x.hi, y.hi),
+			_mm_or_ps(
+				_mm_cmpneq_ps(x.hi, y.hi),
+				_mm_cmpngt_ps(x.lo, y.lo)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NGE_UQ
+	 */
+	static inline __m128 _mm_cmpnge_psx2(__m128x2 x, __m128x2 y) {
+		return _mm_and_ps(
+			_mm_cmpngt_ps(x.hi, y.hi),
+			_mm_or_ps(
+				_mm_cmpneq_ps(x.hi, y.hi),
+				_mm_cmpnge_ps(x.lo, y.lo)
+			)
+		);
+	}
+
+/* __m128x2 compare __m128 */
+
+	/**
+	 * @brief _CMP_ORD_Q
+	 */
+	static inline __m128 _mm_cmpord_psx2_ps(__m128x2 x, __m128 y) {
+		return _mm_cmpord_ps(x.hi, y);
+	}
+
+	/**
+	 * @brief _CMP_UNORD_Q
+	 */
+	static inline __m128 _mm_cmpunord_psx2_ps(__m128x2 x, __m128 y) {
+		return _mm_cmpunord_ps(x.hi, y);
+	}
+
+	/**
+	 * @brief _CMP_EQ_OQ
+	 */
+	static inline __m128 _mm_cmpeq_psx2_ps(__m128x2 x, __m128 y) {
+		__m128 cmp_hi = _mm_cmpeq_ps(x.hi, y);
+		__m128 cmp_lo = _mm_cmpeq_ps(x.lo, _mm_setzero_ps());
+		return _mm_and_ps(cmp_hi, cmp_lo);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_OQ
+	 */
+	static inline __m128 _mm_cmpneq_psx2_ps(__m128x2 x, __m128 y) {
+		__m128 cmp_hi = _mm_cmpneq_ps(x.hi, y);
+		__m128 cmp_lo = _mm_cmpneq_ps(x.lo, _mm_setzero_ps());
+		return _mm_or_ps(cmp_hi, cmp_lo);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_UQ
+	 */
+	static inline __m128 _mm_cmplg_psx2_ps(__m128x2 x, __m128 y) {
+		__m128 cmp_hi = _mm_cmplg_ps(x.hi, y);
+		__m128 cmp_lo = _mm_cmplg_ps(x.lo, _mm_setzero_ps());
+		return _mm_or_ps(cmp_hi, cmp_lo);
+	}
+
+	/**
+	 * @brief _CMP_EQ_UQ
+	 */
+	static inline __m128 _mm_cmpnlg_psx2_ps(__m128x2 x, __m128 y) {
+		__m128 cmp_hi = _mm_cmpnlg_ps(x.hi, y);
+		__m128 cmp_lo = _mm_cmpnlg_ps(x.lo, _mm_setzero_ps());
+		return _mm_and_ps(cmp_hi, cmp_lo);
+	}
+
+		/**
+	 * @brief _CMP_LT_OQ
+	 */
+	static inline __m128 _mm_cmplt_psx2_ps(__m128x2 x, __m128 y) {
+		return _mm_or_ps(
+			_mm_cmplt_ps(x.hi, y),
+			_mm_and_ps(
+				_mm_cmpeq_ps(x.hi, y),
+				_mm_cmplt_ps(x.lo, _mm_setzero_ps())
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_LE_OQ
+	 */
+	static inline __m128 _mm_cmple_psx2_ps(__m128x2 x, __m128 y) {
+		return _mm_or_ps(
+			_mm_cmplt_ps(x.hi, y),
+			_mm_and_ps(
+				_mm_cmpeq_ps(x.hi, y),
+				_mm_cmple_ps(x.lo, _mm_setzero_ps())
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_GT_OQ
+	 */
+	static inline __m128 _mm_cmpgt_psx2_ps(__m128x2 x, __m128 y) {
+		return _mm_or_ps(
+			_mm_cmpgt_ps(x.hi, y),
+			_mm_and_ps(
+				_mm_cmpeq_ps(x.hi, y),
+				_mm_cmpgt_ps(x.lo, _mm_setzero_ps())
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_GE_OQ
+	 */
+	static inline __m128 _mm_cmpge_psx2_ps(__m128x2 x, __m128 y) {
+		return _mm_or_ps(
+			_mm_cmpgt_ps(x.hi, y),
+			_mm_and_ps(
+				_mm_cmpeq_ps(x.hi, y),
+				_mm_cmpge_ps(x.lo, _mm_setzero_ps())
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NLT_UQ
+	 */
+	static inline __m128 _mm_cmpnlt_psx2_ps(__m128x2 x, __m128 y) {
+		return _mm_or_ps(
+			_mm_cmpnlt_ps(x.hi, y),
+			_mm_and_ps(
+				_mm_cmpneq_ps(x.hi, y),
+				_mm_cmpnlt_ps(x.lo, _mm_setzero_ps())
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NLE_UQ
+	 */
+	static inline __m128 _mm_cmpnle_psx2_ps(__m128x2 x, __m128 y) {
+		return _mm_and_ps(
+			_mm_cmpnlt_ps(x.hi, y),
+			_mm_or_ps(
+				_mm_cmpneq_ps(x.hi, y),
+				_mm_cmpnle_ps(x.lo, _mm_setzero_ps())
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NGT_UQ
+	 */
+	static inline __m128 _mm_cmpngt_psx2_ps(__m128x2 x, __m128 y) {
+		return _mm_and_ps(
+			_mm_cmpngt_ps(x.hi, y),
+			_mm_or_ps(
+				_mm_cmpneq_ps(x.hi, y),
+				_mm_cmpngt_ps(x.lo, _mm_setzero_ps())
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NGE_UQ
+	 */
+	static inline __m128 _mm_cmpnge_psx2_ps(__m128x2 x, __m128 y) {
+		return _mm_and_ps(
+			_mm_cmpngt_ps(x.hi, y),
+			_mm_or_ps(
+				_mm_cmpneq_ps(x.hi, y),
+				_mm_cmpnge_ps(x.lo, _mm_setzero_ps())
+			)
+		);
+	}
+
+/* __m128 compare __m128x2 */
+
+	/**
+	 * @brief _CMP_ORD_Q
+	 */
+	static inline __m128 _mm_cmpord_ps_psx2(__m128 x, __m128x2 y) {
+		return _mm_cmpord_ps(x, y.hi);
+	}
+
+	/**
+	 * @brief _CMP_UNORD_Q
+	 */
+	static inline __m128 _mm_cmpunord_ps_psx2(__m128 x, __m128x2 y) {
+		return _mm_cmpunord_ps(x, y.hi);
+	}
+
+	/**
+	 * @brief _CMP_EQ_OQ
+	 */
+	static inline __m128 _mm_cmpeq_ps_psx2(__m128 x, __m128x2 y) {
+		__m128 cmp_hi = _mm_cmpeq_ps(x, y.hi);
+		__m128 cmp_lo = _mm_cmpeq_ps(_mm_setzero_ps(), y.lo);
+		return _mm_and_ps(cmp_hi, cmp_lo);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_OQ
+	 */
+	static inline __m128 _mm_cmpneq_ps_psx2(__m128 x, __m128x2 y) {
+		__m128 cmp_hi = _mm_cmpneq_ps(x, y.hi);
+		__m128 cmp_lo = _mm_cmpneq_ps(_mm_setzero_ps(), y.lo);
+		return _mm_or_ps(cmp_hi, cmp_lo);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_UQ
+	 */
+	static inline __m128 _mm_cmplg_ps_psx2(__m128 x, __m128x2 y) {
+		__m128 cmp_hi = _mm_cmplg_ps(x, y.hi);
+		__m128 cmp_lo = _mm_cmplg_ps(_mm_setzero_ps(), y.lo);
+		return _mm_or_ps(cmp_hi, cmp_lo);
+	}
+
+	/**
+	 * @brief _CMP_EQ_UQ
+	 */
+	static inline __m128 _mm_cmpnlg_ps_psx2(__m128 x, __m128x2 y) {
+		__m128 cmp_hi = _mm_cmpnlg_ps(x, y.hi);
+		__m128 cmp_lo = _mm_cmpnlg_ps(_mm_setzero_ps(), y.lo);
+		return _mm_and_ps(cmp_hi, cmp_lo);
+	}
+
+		/**
+	 * @brief _CMP_LT_OQ
+	 */
+	static inline __m128 _mm_cmplt_ps_psx2(__m128 x, __m128x2 y) {
+		return _mm_or_ps(
+			_mm_cmplt_ps(x, y.hi),
+			_mm_and_ps(
+				_mm_cmpeq_ps(x, y.hi),
+				_mm_cmplt_ps(_mm_setzero_ps(), y.lo)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_LE_OQ
+	 */
+	static inline __m128 _mm_cmple_ps_psx2(__m128 x, __m128x2 y) {
+		return _mm_or_ps(
+			_mm_cmplt_ps(x, y.hi),
+			_mm_and_ps(
+				_mm_cmpeq_ps(x, y.hi),
+				_mm_cmple_ps(_mm_setzero_ps(), y.lo)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_GT_OQ
+	 */
+	static inline __m128 _mm_cmpgt_ps_psx2(__m128 x, __m128x2 y) {
+		return _mm_or_ps(
+			_mm_cmpgt_ps(x, y.hi),
+			_mm_and_ps(
+				_mm_cmpeq_ps(x, y.hi),
+				_mm_cmpgt_ps(_mm_setzero_ps(), y.lo)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_GE_OQ
+	 */
+	static inline __m128 _mm_cmpge_ps_psx2(__m128 x, __m128x2 y) {
+		return _mm_or_ps(
+			_mm_cmpgt_ps(x, y.hi),
+			_mm_and_ps(
+				_mm_cmpeq_ps(x, y.hi),
+				_mm_cmpge_ps(_mm_setzero_ps(), y.lo)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NLT_UQ
+	 */
+	static inline __m128 _mm_cmpnlt_ps_psx2(__m128 x, __m128x2 y) {
+		return _mm_or_ps(
+			_mm_cmpnlt_ps(x, y.hi),
+			_mm_and_ps(
+				_mm_cmpneq_ps(x, y.hi),
+				_mm_cmpnlt_ps(_mm_setzero_ps(), y.lo)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NLE_UQ
+	 */
+	static inline __m128 _mm_cmpnle_ps_psx2(__m128 x, __m128x2 y) {
+		return _mm_and_ps(
+			_mm_cmpnlt_ps(x, y.hi),
+			_mm_or_ps(
+				_mm_cmpneq_ps(x, y.hi),
+				_mm_cmpnle_ps(_mm_setzero_ps(), y.lo)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NGT_UQ
+	 */
+	static inline __m128 _mm_cmpngt_ps_psx2(__m128 x, __m128x2 y) {
+		return _mm_and_ps(
+			_mm_cmpngt_ps(x, y.hi),
+			_mm_or_ps(
+				_mm_cmpneq_ps(x, y.hi),
+				_mm_cmpngt_ps(_mm_setzero_ps(), y.lo)
+			)
+		);
+	}
+
+	/**
+	 * @brief _CMP_NGE_UQ
+	 */
+	static inline __m128 _mm_cmpnge_ps_psx2(__m128 x, __m128x2 y) {
+		return _mm_and_ps(
+			_mm_cmpngt_ps(x, y.hi),
+			_mm_or_ps(
+				_mm_cmpneq_ps(x, y.hi),
+				_mm_cmpnge_ps(_mm_setzero_ps(), y.lo)
+			)
+		);
+	}
+
+//------------------------------------------------------------------------------
+// __m128x2 compare to zero functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief _CMP_EQ_OQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m128 _mm_cmpeq_zero_psx2(__m128x2 x) {
+	return _mm_cmpeq_ps(x.hi, _mm_setzero_ps());
+}
+/**
+ * @brief _CMP_NEQ_OQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m128 _mm_cmpneq_zero_psx2(__m128x2 x) {
+	return _mm_cmpneq_ps(x.hi, _mm_setzero_ps());
+}
+/**
+ * @brief _CMP_NEQ_UQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m128 _mm_cmplg_zero_psx2(__m128x2 x) {
+	return _mm_cmplg_ps(x.hi, _mm_setzero_ps());
+}
+/**
+ * @brief _CMP_EQ_UQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m128 _mm_cmpnlg_zero_psx2(__m128x2 x) {
+	return _mm_cmpnlg_ps(x.hi, _mm_setzero_ps());
+}
+
+/**
+ * @brief _CMP_LT_OQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m128 _mm_cmplt_zero_psx2(__m128x2 x) {
+	return _mm_cmplt_ps(x.hi, _mm_setzero_ps());
+}
+/**
+ * @brief _CMP_LE_OQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m128 _mm_cmple_zero_psx2(__m128x2 x) {
+	return _mm_cmple_ps(x.hi, _mm_setzero_ps());
+}
+/**
+ * @brief _CMP_GT_OQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m128 _mm_cmpgt_zero_psx2(__m128x2 x) {
+	return _mm_cmpgt_ps(x.hi, _mm_setzero_ps());
+}
+/**
+ * @brief _CMP_GE_OQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m128 _mm_cmpge_zero_psx2(__m128x2 x) {
+	return _mm_cmpge_ps(x.hi, _mm_setzero_ps());
+}
+
+/**
+ * @brief _CMP_NLT_UQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m128 _mm_cmpnlt_zero_psx2(__m128x2 x) {
+	return _mm_cmpnlt_ps(x.hi, _mm_setzero_ps());
+}
+/**
+ * @brief _CMP_NLE_UQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m128 _mm_cmpnle_zero_psx2(__m128x2 x) {
+	return _mm_cmpnle_ps(x.hi, _mm_setzero_ps());
+}
+/**
+ * @brief _CMP_NGT_UQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m128 _mm_cmpngt_zero_psx2(__m128x2 x) {
+	return _mm_cmpngt_ps(x.hi, _mm_setzero_ps());
+}
+/**
+ * @brief _CMP_NGE_UQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __m128 _mm_cmpnge_zero_psx2(__m128x2 x) {
+	return _mm_cmpnge_ps(x.hi, _mm_setzero_ps());
+}
+
+//------------------------------------------------------------------------------
+// __m128x2 basic arithmetic
+//------------------------------------------------------------------------------
+
+static inline __m128x2 _mm128x2_negate_psx2(__m128x2 x) {
+	const __m128 sign_bit_mask = _mm_castsi128_ps(_mm_set1_epi32((int32_t)0x80000000));
+	x.hi = _mm_xor_ps(x.hi, sign_bit_mask);
+	x.lo = _mm_xor_ps(x.lo, sign_bit_mask);
+	return x;
+}
+
+static inline __m128x2 _mm128x2_add_psx2(__m128x2 x, __m128x2 y) {
+
+	__m128 r_hi = _mm_add_ps(x.hi, y.hi);
+
+	__m128 rx_lo = _mm_add_ps(_mm_add_ps(
+		_mm_add_ps(_mm_sub_ps(x.hi, r_hi), y.hi),
+	y.lo), x.lo);
+	__m128 ry_lo = _mm_add_ps(_mm_add_ps(
+		_mm_add_ps(_mm_sub_ps(y.hi, r_hi), x.hi),
+	x.lo), y.lo);
+
+	const __m128 cmp_result = _mm_cmple_ps(
+	 	_mm_fabs_ps(x.hi), _mm_fabs_ps(y.hi)
+	);
+	__m128 r_lo = _internal_mm_blendv_ps(rx_lo, ry_lo, cmp_result);
+
+	__m128x2 c;
+	c.hi = _mm_add_ps(r_hi, r_lo);
+	c.lo = _mm_add_ps(_mm_sub_ps(r_hi, c.hi), r_lo);
+	return c;
+}
+
+static inline __m128x2 _mm128x2_sub_psx2(__m128x2 x, __m128x2 y) {
+	__m128 r_hi = _mm_sub_ps(x.hi, y.hi);
+
+	__m128 rx_lo = _mm_add_ps(_mm_sub_ps(
+		_mm_sub_ps(_mm_sub_ps(x.hi, r_hi), y.hi),
+	y.lo), x.lo);
+
+	y.hi = _mm_negate_ps(y.hi);
+	__m128 ry_lo = _mm_sub_ps(_mm_add_ps(
+		_mm_add_ps(_mm_sub_ps(/* negative */ y.hi, r_hi), x.hi),
+	x.lo), y.lo);
+
+	const __m128 cmp_result = _mm_cmple_ps(
+	 	_mm_fabs_ps(x.hi), _mm_fabs_ps(y.hi)
+	);
+	__m128 r_lo = _internal_mm_blendv_ps(rx_lo, ry_lo, cmp_result);
+
+	__m128x2 c;
+	c.hi = _mm_add_ps(r_hi, r_lo);
+	c.lo = _mm_add_ps(_mm_sub_ps(r_hi, c.hi), r_lo);
+	return c;
+}
+
+static inline __m128x2 _mm128x2_dekker_split_ps(__m128 x) {
+	// (2^ceil(24 / 2) + 1)
+	const __m128 dekker_scale = _mm_set1_ps(4097.0f);
+	__m128 temp = _mm_mul_ps(x, dekker_scale);
+	__m128x2 ret;
+	ret.hi = _mm_sub_ps(temp, _mm_sub_ps(temp, x));
+	ret.lo = _mm_sub_ps(x, ret.hi);
+	return ret;
+}
+
+static inline __m128x2 _mm128x2_dekker_mul12_ps(__m128 x, __m128 y) {
+	__m128x2 r;
+	#ifdef LDF_ENABLE_FMA_SIMD
+		r.hi = _mm_mul_ps(x, y);
+		r.lo = _mm_fmsub_ps(x, y, r.hi);
+	#else
+		__m128x2 a = _mm128x2_dekker_split_ps(x);
+		__m128x2 b = _mm128x2_dekker_split_ps(y);
+		__m128 p = _mm_mul_ps(a.hi, b.hi);
+		__m128 q = _mm_add_ps(
+			_mm_mul_ps(a.hi, b.lo), _mm_mul_ps(a.lo, b.hi)
+		);
+
+		r.hi = _mm_add_ps(p, q);
+		r.lo = _mm_add_ps(
+			_mm_add_ps(_mm_sub_ps(p, r.hi), q),
+			_mm_mul_ps(a.lo, b.lo)
+		);
+	#endif
+	return r;
+}
+
+static inline __m128x2 _mm128x2_mul_psx2(__m128x2 x, __m128x2 y) {
+	__m128x2 t = _mm128x2_dekker_mul12_ps(x.hi, y.hi);
+	__m128 c = _mm_add_ps(_mm_add_ps(
+		_mm_mul_ps(x.hi, y.lo), _mm_mul_ps(x.lo, y.hi)
+	), t.lo);
+
+	__m128x2 r;
+	r.hi = _mm_add_ps(t.hi, c);
+	r.lo = _mm_add_ps(_mm_sub_ps(t.hi, r.hi), c);
+	return r;
+}
+
+static inline __m128x2 _mm128x2_div_psx2(__m128x2 x, __m128x2 y) {
+	__m128 u = _mm_div_ps(x.hi, y.hi);
+	__m128x2 t = _mm128x2_dekker_mul12_ps(u, y.hi);
+	__m128 l = _mm_div_ps(_mm_sub_ps(
+		_mm_add_ps(_mm_sub_ps(_mm_sub_ps(x.hi, t.hi), t.lo), x.lo),
+		_mm_mul_ps(u, y.lo)
+	), y.hi);
+
+	__m128x2 r;
+	r.hi = _mm_add_ps(u, l);
+	r.lo = _mm_add_ps(_mm_sub_ps(u, r.hi), l);
+	return r;
+}
+
+static inline __m128x2 _mm128x2_dekker_square12_ps(__m128 x) {
+	__m128x2 r;
+	#ifdef LDF_ENABLE_FMA_SIMD
+		r.hi = _mm_mul_ps(x, x);
+		r.lo = _mm_fmsub_ps(x, x, r.hi);
+	#else
+		__m128x2 a = _mm128x2_dekker_split_ps(x);
+		__m128 p = _mm_mul_ps(a.hi, a.hi);
+		__m128 q = _mm_mul_ps(
+			_mm_set1_ps(2.0f), _mm_mul_ps(a.hi, a.lo)
+		);
+
+		r.hi = _mm_add_ps(p, q);
+		r.lo = _mm_add_ps(
+			_mm_add_ps(_mm_sub_ps(p, r.hi), q),
+			_mm_mul_ps(a.lo, a.lo)
+		);
+	#endif
+	return r;
+}
+
+static inline __m128x2 _mm128x2_square_psx2(__m128x2 x) {
+	__m128x2 t = _mm128x2_dekker_square12_ps(x.hi);
+	__m128 c = _mm_add_ps(
+		_mm_mul_ps(_mm_set1_ps(2.0f), _mm_mul_ps(x.hi, x.lo)), t.lo
+	);
+
+	__m128x2 r;
+	r.hi = _mm_add_ps(t.hi, c);
+	r.lo = _mm_add_ps(_mm_sub_ps(t.hi, r.hi), c);
+	return r;
+}
+
+static inline __m128x2 _mm128x2_recip_psx2(__m128x2 y) {
+	__m128 u = _mm_div_ps(_mm_set1_ps(1.0f), y.hi);
+	__m128x2 t = _mm128x2_dekker_mul12_ps(u, y.hi);
+	__m128 l = _mm_div_ps(_mm_sub_ps(
+		_mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.0f), t.hi), t.lo),
+		_mm_mul_ps(u, y.lo)
+	), y.hi);
+
+	__m128x2 r;
+	r.hi = _mm_add_ps(u, l);
+	r.lo = _mm_add_ps(_mm_sub_ps(u, r.hi), l);
+	return r;
+}
+
+//------------------------------------------------------------------------------
+// __m128x2 optimized arithmetic
+//------------------------------------------------------------------------------
+
+static inline __m128x2 _mm128x2_add_psx2_ps(__m128x2 x, __m128 y) {
+	__m128 r_hi = _mm_add_ps(x.hi, y);
+
+	__m128 rx_lo = _mm_add_ps(
+		_mm_add_ps(_mm_sub_ps(x.hi, r_hi), y), x.lo
+	);
+	__m128 ry_lo = _mm_add_ps(
+		_mm_add_ps(_mm_sub_ps(y, r_hi), x.hi),
+	x.lo);
+
+	const __m128 cmp_result = _mm_cmple_ps(
+	 	_mm_fabs_ps(x.hi), _mm_fabs_ps(y)
+	);
+	__m128 r_lo = _internal_mm_blendv_ps(rx_lo, ry_lo, cmp_result);
+
+	__m128x2 c;
+	c.hi = _mm_add_ps(r_hi, r_lo);
+	c.lo = _mm_add_ps(_mm_sub_ps(r_hi, c.hi), r_lo);
+	return c;
+}
+
+static inline __m128x2 _mm128x2_add_ps_psx2(__m128 x, __m128x2 y) {
+	__m128 r_hi = _mm_add_ps(x, y.hi);
+
+	__m128 rx_lo = _mm_add_ps(
+		_mm_add_ps(_mm_sub_ps(x, r_hi), y.hi),
+	y.lo);
+	__m128 ry_lo = _mm_add_ps(
+		_mm_add_ps(_mm_sub_ps(y.hi, r_hi), x), y.lo
+	);
+
+	const __m128 cmp_result = _mm_cmple_ps(
+	 	_mm_fabs_ps(x), _mm_fabs_ps(y.hi)
+	);
+	__m128 r_lo = _internal_mm_blendv_ps(rx_lo, ry_lo, cmp_result);
+
+	__m128x2 c;
+	c.hi = _mm_add_ps(r_hi, r_lo);
+	c.lo = _mm_add_ps(_mm_sub_ps(r_hi, c.hi), r_lo);
+	return c;
+}
+
+/**
+ * @brief Adds two __m128 values with the result stored as a __m128x2
+ */
+static inline __m128x2 _mm128x2_add_ps_ps(__m128 x, __m128 y) {
+	__m128 r_hi = _mm_add_ps(x, y);
+
+	__m128 rx_lo = _mm_add_ps(_mm_sub_ps(x, r_hi), y);
+	__m128 ry_lo = _mm_add_ps(_mm_sub_ps(y, r_hi), x);
+
+	const __m128 cmp_result = _mm_cmple_ps(
+		_mm_fabs_ps(x), _mm_fabs_ps(y)
+	);
+	__m128 r_lo = _internal_mm_blendv_ps(rx_lo, ry_lo, cmp_result);
+
+	__m128x2 c;
+	c.hi = _mm_add_ps(r_hi, r_lo);
+	c.lo = _mm_add_ps(_mm_sub_ps(r_hi, c.hi), r_lo);
+	return c;
+}
+
+static inline __m128x2 _mm128x2_sub_psx2_ps(__m128x2 x, __m128 y) {
+	__m128 r_hi = _mm_sub_ps(x.hi, y);
+
+	__m128 rx_lo = _mm_add_ps(
+		_mm_sub_ps(_mm_sub_ps(x.hi, r_hi), y), x.lo
+	);
+
+	y = _mm_negate_ps(y);
+	__m128 ry_lo = _mm_add_ps(
+		_mm_add_ps(_mm_sub_ps(/* negative */ y, r_hi), x.hi), x.lo
+	);
+
+	const __m128 cmp_result = _mm_cmple_ps(
+		_mm_fabs_ps(x.hi), _mm_fabs_ps(y)
+	);
+	__m128 r_lo = _internal_mm_blendv_ps(rx_lo, ry_lo, cmp_result);
+
+	__m128x2 c;
+	c.hi = _mm_add_ps(r_hi, r_lo);
+	c.lo = _mm_add_ps(_mm_sub_ps(r_hi, c.hi), r_lo);
+	return c;
+}
+
+static inline __m128x2 _mm128x2_sub_ps_psx2(__m128 x, __m128x2 y) {
+	__m128 r_hi = _mm_sub_ps(x, y.hi);
+
+	__m128 rx_lo = _mm_sub_ps(
+		_mm_sub_ps(_mm_sub_ps(x, r_hi), y.hi),
+	y.lo);
+
+	y.hi = _mm_negate_ps(y.hi);
+	__m128 ry_lo = _mm_sub_ps(
+		_mm_add_ps(_mm_sub_ps(/* negative */ y.hi, r_hi), x), y.lo
+	);
+
+	const __m128 cmp_result = _mm_cmple_ps(
+		_mm_fabs_ps(x), _mm_fabs_ps(y.hi)
+	);
+	__m128 r_lo = _internal_mm_blendv_ps(rx_lo, ry_lo, cmp_result);
+
+	__m128x2 c;
+	c.hi = _mm_add_ps(r_hi, r_lo);
+	c.lo = _mm_add_ps(_mm_sub_ps(r_hi, c.hi), r_lo);
+	return c;
+}
+
+/**
+ * @brief Subtracts two __m128 values with the result stored as a __m128x2
+ */
+static inline __m128x2 _mm128x2_sub_ps_ps(__m128 x, __m128 y) {
+	__m128 r_hi = _mm_sub_ps(x, y);
+
+	__m128 rx_lo = _mm_sub_ps(_mm_sub_ps(x, r_hi), y);
+
+	y = _mm_negate_ps(y);
+	__m128 ry_lo = _mm_add_ps(_mm_sub_ps(/* negative */ y, r_hi), x);
+
+	const __m128 cmp_result = _mm_cmple_ps(
+		_mm_fabs_ps(x), _mm_fabs_ps(y)
+	);
+	__m128 r_lo = _internal_mm_blendv_ps(rx_lo, ry_lo, cmp_result);
+
+	__m128x2 c;
+	c.hi = _mm_add_ps(r_hi, r_lo);
+	c.lo = _mm_add_ps(_mm_sub_ps(r_hi, c.hi), r_lo);
+	return c;
+}
+
+static inline __m128x2 _mm128x2_mul_psx2_ps(__m128x2 x, __m128 y) {
+	__m128x2 t = _mm128x2_dekker_mul12_ps(x.hi, y);
+	__m128 c = _mm_add_ps(_mm_mul_ps(x.lo, y), t.lo);
+
+	__m128x2 r;
+	r.hi = _mm_add_ps(t.hi, c);
+	r.lo = _mm_add_ps(_mm_sub_ps(t.hi, r.hi), c);
+	return r;
+}
+
+static inline __m128x2 _mm128x2_mul_ps_psx2(__m128 x, __m128x2 y) {
+	__m128x2 t = _mm128x2_dekker_mul12_ps(x, y.hi);
+	__m128 c = _mm_add_ps(_mm_mul_ps(x, y.lo), t.lo);
+
+	__m128x2 r;
+	r.hi = _mm_add_ps(t.hi, c);
+	r.lo = _mm_add_ps(_mm_sub_ps(t.hi, r.hi), c);
+	return r;
+}
+
+/**
+ * @brief Multiplies two __m128 values with the result stored as a __m128x2
+ */
+static inline __m128x2 _mm128x2_mul_ps_ps(__m128 x, __m128 y) {
+	return _mm128x2_dekker_mul12_ps(x, y);
+}
+
+static inline __m128x2 _mm128x2_div_psx2_ps(__m128x2 x, __m128 y) {
+	__m128 u = _mm_div_ps(x.hi, y);
+	__m128x2 t = _mm128x2_dekker_mul12_ps(u, y);
+	__m128 l = _mm_div_ps(
+		_mm_add_ps(_mm_sub_ps(_mm_sub_ps(x.hi, t.hi), t.lo), x.lo), y
+	);
+
+	__m128x2 r;
+	r.hi = _mm_add_ps(u, l);
+	r.lo = _mm_add_ps(_mm_sub_ps(u, r.hi), l);
+	return r;
+}
+
+static inline __m128x2 _mm128x2_div_ps_psx2(__m128 x, __m128x2 y) {
+	__m128 u = _mm_div_ps(x, y.hi);
+	__m128x2 t = _mm128x2_dekker_mul12_ps(u, y.hi);
+	__m128 l = _mm_div_ps(_mm_sub_ps(
+		_mm_sub_ps(_mm_sub_ps(x, t.hi), t.lo),
+		_mm_mul_ps(u, y.lo)
+	), y.hi);
+
+	__m128x2 r;
+	r.hi = _mm_add_ps(u, l);
+	r.lo = _mm_add_ps(_mm_sub_ps(u, r.hi), l);
+	return r;
+}
+
+/**
+ * @brief Divides two __m128 values with the result stored as a __m128x2
+ */
+static inline __m128x2 _mm128x2_div_ps_ps(__m128 x, __m128 y) {
+	__m128 u = _mm_div_ps(x, y);
+	__m128x2 t = _mm128x2_dekker_mul12_ps(u, y);
+	__m128 l = _mm_div_ps(
+		_mm_sub_ps(_mm_sub_ps(x, t.hi), t.lo), y
+	);
+
+	__m128x2 r;
+	r.hi = _mm_add_ps(u, l);
+	r.lo = _mm_add_ps(_mm_sub_ps(u, r.hi), l);
+	return r;
+}
+
+/**
+ * @brief Squares a __m128 value with the result stored as a __m128x2
+ */
+static inline __m128x2 _mm128x2_square_ps(__m128 x) {
+	return _mm128x2_dekker_square12_ps(x);
+}
+
+/**
+ * @brief Calculates the reciprocal of a __m128 value with the result stored
+ * as a __m128x2
+ */
+static inline __m128x2 _mm128x2_recip_ps(__m128 y) {
+	__m128 u = _mm_div_ps(_mm_set1_ps(1.0f), y);
+	__m128x2 t = _mm128x2_dekker_mul12_ps(u, y);
+	__m128 l = _mm_div_ps(
+		_mm_sub_ps(_mm_sub_ps(_mm_set1_ps(1.0f), t.hi), t.lo), y
+	);
+
+	__m128x2 r;
+	r.hi = _mm_add_ps(u, l);
+	r.lo = _mm_add_ps(_mm_sub_ps(u, r.hi), l);
+	return r;
+}
+
+//------------------------------------------------------------------------------
+// __m128x2 specialized arithmetic
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Multiplies by a known power of two (such as 2.0, 0.5, etc.) or zero
+ */
+static inline __m128x2 _mm128x2_mul_power2_psx2_ps(__m128x2 x, __m128 y) {
+	x.hi = _mm_mul_ps(x.hi, y);
+	x.lo = _mm_mul_ps(x.lo, y);
+	return x;
+}
+
+/**
+ * @brief Multiplies by a known power of two (such as 2.0, 0.5, etc.) or zero
+ */
+static inline __m128x2 _mm128x2_mul_power2_ps_psx2(__m128 x, __m128x2 y) {
+	y.hi = _mm_mul_ps(x, y.hi);
+	y.lo = _mm_mul_ps(x, y.lo);
+	return y;
+}
+
+//------------------------------------------------------------------------------
+// __m128x2 Mathematical Constants
+//------------------------------------------------------------------------------
+
+/**
+ * @brief ~2.718281828 Returns the value of euler's number
+ */
+static inline __m128x2 _mm128x2_const_e_psx2(void) {
+	const __m128x2 ret = {
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x402DF854)),
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x33B14577))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~1.442695041 Returns the value of log2(e)
+ */
+static inline __m128x2 _mm128x2_const_log2e_psx2(void) {
+	const __m128x2 ret = {
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3FB8AA3B)),
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x32A57060))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~0.434294482 Returns the value of log10(e)
+ */
+static inline __m128x2 _mm128x2_const_log10e_psx2(void) {
+	const __m128x2 ret = {
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3EDE5BD9)),
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0xB22D91AF))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~3.141592654 Returns the value of pi
+ */
+static inline __m128x2 _mm128x2_const_pi_psx2(void) {
+	const __m128x2 ret = {
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x40490FDB)),
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0xB3BBBD2E))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~0.318309886 Returns the value of 1 / pi
+ */
+static inline __m128x2 _mm128x2_const_inv_pi_psx2(void) {
+	const __m128x2 ret = {
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3EA2F983)),
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x325C9C88))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~0.564189584 Returns the value of 1 / sqrt(pi)
+ */
+static inline __m128x2 _mm128x2_const_inv_sqrtpi_psx2(void) {
+	const __m128x2 ret = {
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3F106EBB)),
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0xB2FBD649))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~0.693147181 Returns the value of ln(2)
+ */
+static inline __m128x2 _mm128x2_const_ln2_psx2(void) {
+	const __m128x2 ret = {
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3F317218)),
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0xB102E308))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~2.302585093 Returns the value of ln(10)
+ */
+static inline __m128x2 _mm128x2_const_ln10_psx2(void) {
+	const __m128x2 ret = {
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x40135D8E)),
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0xB309555D))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~1.414213562 Returns the value of sqrt(2)
+ */
+static inline __m128x2 _mm128x2_const_sqrt2_psx2(void) {
+	const __m128x2 ret = {
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3FB504F3)),
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x32CFE77A))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~1.732050808 Returns the value of sqrt(3)
+ */
+static inline __m128x2 _mm128x2_const_sqrt3_psx2(void) {
+	const __m128x2 ret = {
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3FDDB3D7)),
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x330584CB))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~0.577350269 Returns the value of 1 / sqrt(3)
+ */
+static inline __m128x2 _mm128x2_const_inv_sqrt3_psx2(void) {
+	const __m128x2 ret = {
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3F13CD3A)),
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x32320664))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~0.577215665 Returns the value of gamma (The Euler–Mascheroni constant)
+ */
+static inline __m128x2 _mm128x2_const_egamma_psx2(void) {
+	const __m128x2 ret = {
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3F13C468)),
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0xB1E4127A))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~1.618033989 Returns the value of phi (The golden ratio)
+ */
+static inline __m128x2 _mm128x2_const_phi_psx2(void) {
+	const __m128x2 ret = {
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x3FCF1BBD)),
+		_mm_castsi128_ps(_mm_set1_epi32((int32_t)0xB28D016B))
+	};
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m128x2 floating point classify
+//------------------------------------------------------------------------------
+
+/* values */
+
+	/**
+	 * @brief Returns a __m128x2 value set to positive infinity
+	 */
+	static inline __m128x2 _mm128x2_get_infinity_psx2(void) {
+		__m128x2 ret = {
+			_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7F800000)),
+			_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7F800000))
+		};
+		return ret;
+	}
+
+	/**
+	 * @brief Returns a __m128x2 value set to signaling NaN
+	 */
+	static inline __m128x2 _mm128x2_get_sNaN_psx2(void) {
+		__m128x2 ret = {
+			_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7F800001)),
+			_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7F800001))
+		};
+		return ret;
+	}
+
+	/**
+	 * @brief Returns a __m128x2 value set to quiet NaN
+	 */
+	static inline __m128x2 _mm128x2_get_qNaN_psx2(void) {
+		__m128x2 ret = {
+			_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7FC00001)),
+			_mm_castsi128_ps(_mm_set1_epi32((int32_t)0x7FC00001))
+		};
+		return ret;
+	}
+
+/* Float Classify */
+
+	/** @brief Returns true if x is negative */
+	static inline __m128 _mm_signbit_psx2(const __m128x2 x) {
+		return _mm_signbit_ps(x.hi);
+	}
+
+	/** @brief Returns true if x is finite */
+	static inline __m128 _mm_isfinite_psx2(const __m128x2 x) {
+		return _mm_isfinite_ps(x.hi);
+	}
+
+	/** @brief Returns true if x is +-infinity */
+	static inline __m128 _mm_isinf_psx2(const __m128x2 x) {
+		return _mm_isinf_ps(x.hi);
+	}
+
+	/** @brief Returns true if x is any kind of NaN */
+	static inline __m128 _mm_isnan_psx2(const __m128x2 x) {
+		return _mm_isnan_ps(x.hi);
+	}
+
+	/** @brief Returns true if x is normal */
+	static inline __m128 _mm_isnormal_psx2(const __m128x2 x) {
+		return _mm_and_ps(
+			_mm_isnormal_ps(x.hi),
+			_mm_or_ps(
+				_mm_isnormal_ps(x.lo),
+				_mm_cmpeq_ps(x.lo, _mm_setzero_ps())
+			)
+		);
+	}
+
+	/** @brief Returns true if x is denormal and non-zero */
+	static inline __m128 _mm_isdenormal_psx2(const __m128x2 x) {
+		return _mm_or_ps(
+			_mm_isdenormal_ps(x.hi), _mm_isdenormal_ps(x.lo)
+		);
+	}
+
+	/** @brief Returns true if x and y are unordered */
+	static inline __m128 _mm_isunordered_psx2(const __m128x2 x, const __m128x2 y) {
+		return _mm_isunordered_ps(x.hi, y.hi);
+	}
+
+//------------------------------------------------------------------------------
+// __m128x2 max/min functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns the fmax of x and y. Correctly handling NaN and signed zeros.
+ * You may use _mm128x2_max_psx2 as a faster alternative.
+ */
+static inline __m128x2 _mm128x2_fmax_psx2(__m128x2 x, __m128x2 y) {
+	__m128 fmax_cmp =
+		_mm_or_ps(
+			_mm_or_ps(
+				_mm_cmplt_psx2(x, y),
+				_mm_isnan_psx2(x)
+			),
+			_mm_and_ps(
+				_mm_signbit_psx2(x),
+				_mm_cmpeq_psx2(x, y)
+			)
+		);
+	__m128x2 ret;
+	ret.hi = _internal_mm_blendv_ps(x.hi, y.hi, fmax_cmp);
+	ret.lo = _internal_mm_blendv_ps(x.lo, y.lo, fmax_cmp);
+	return ret;
+}
+
+/**
+ * @brief Returns the fmin of x and y. Correctly handling NaN and signed zeros.
+ * You may use _mm128x2_min_psx2 as a faster alternative.
+ */
+static inline __m128x2 _mm128x2_fmin_psx2(__m128x2 x, __m128x2 y) {
+	__m128 fmin_cmp =
+		_mm_or_ps(
+			_mm_or_ps(
+				_mm_cmpgt_psx2(x, y),
+				_mm_isnan_psx2(x)
+			),
+			_mm_andnot_ps(
+				_mm_signbit_psx2(x),
+				_mm_cmpeq_psx2(x, y)
+			)
+		);
+	__m128x2 ret;
+	ret.hi = _internal_mm_blendv_ps(x.hi, y.hi, fmin_cmp);
+	ret.lo = _internal_mm_blendv_ps(x.lo, y.lo, fmin_cmp);
+	return ret;
+}
+
+static inline __m128x2 _mm128x2_max_psx2(__m128x2 x, __m128x2 y) {
+	const __m128 cmp_max = _mm_cmplt_psx2(x, y);
+	__m128x2 ret;
+	ret.hi = _internal_mm_blendv_ps(x.hi, y.hi, cmp_max);
+	ret.lo = _internal_mm_blendv_ps(x.lo, y.lo, cmp_max);
+	return ret;
+}
+
+static inline __m128x2 _mm128x2_min_psx2(__m128x2 x, __m128x2 y) {
+	const __m128 cmp_max = _mm_cmpgt_psx2(x, y);
+	__m128x2 ret;
+	ret.hi = _internal_mm_blendv_ps(x.hi, y.hi, cmp_max);
+	ret.lo = _internal_mm_blendv_ps(x.lo, y.lo, cmp_max);
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m128x2 rounding functions
+//------------------------------------------------------------------------------
+
+/** same as aint(x) */
+static inline __m128x2 _mm128x2_trunc_psx2(__m128x2 x) {
+	__m128 int_hi = _mm_trunc_ps(x.hi);
+	__m128 int_lo = _mm_trunc_ps(x.lo);
+	__m128 frac_hi = _mm_sub_ps(x.hi, int_hi);
+	__m128 frac_lo = _mm_sub_ps(x.lo, int_lo);
+	
+	__m128 frac_ge_1 = _mm_cmpge_ps(_mm_add_ps(frac_hi, frac_lo), _mm_set1_ps(1.0f));
+
+	__m128x2 trunc_all = _mm128x2_add_psx2_ps(_mm128x2_add_ps_ps(
+		_internal_mm_blendv_ps(_mm_setzero_ps(), _mm_set1_ps(1.0f), frac_ge_1),
+		int_lo
+	), int_hi);
+	return trunc_all;
+}
+
+static inline __m128x2 _mm128x2_floor_psx2(__m128x2 x) {
+	__m128x2 int_part = _mm128x2_trunc_psx2(x);
+	
+	__m128 cmp_floor;
+	cmp_floor = _mm_and_ps(
+		_mm_cmplt_psx2(x, _mm128x2_setzero_psx2()),
+		_mm_cmpneq_psx2(x, int_part)
+	);
+	__m128 floor_part = _internal_mm_blendv_ps(
+		_mm_setzero_ps(), _mm_set1_ps(1.0f), cmp_floor
+	);
+	return _mm128x2_sub_psx2_ps(int_part, floor_part);
+}
+
+static inline __m128x2 _mm128x2_ceil_psx2(__m128x2 x) {
+	__m128x2 int_part = _mm128x2_trunc_psx2(x);
+	
+	__m128 cmp_ceil = _mm_and_ps(
+		_mm_cmpgt_psx2(x, _mm128x2_setzero_psx2()),
+		_mm_cmpneq_psx2(x, int_part)
+	);
+	__m128 ceil_part = _internal_mm_blendv_ps(
+		_mm_setzero_ps(), _mm_set1_ps(1.0f), cmp_ceil
+	);
+	return _mm128x2_add_psx2_ps(int_part, ceil_part);
+}
+
+/** same as nint(x) */
+static inline __m128x2 _mm128x2_round_psx2(__m128x2 x) {
+	__m128x2 round_up = _mm128x2_add_psx2_ps(_mm128x2_floor_psx2(x), _mm_set1_ps(0.5f));
+	__m128x2 round_dn = _mm128x2_sub_psx2_ps(_mm128x2_ceil_psx2 (x), _mm_set1_ps(0.5f));
+	__m128 cmp_mask = _mm_cmplt_psx2(x, _mm128x2_setzero_psx2());
+	__m128x2 ret;
+	ret.hi = _internal_mm_blendv_ps(round_up.hi, round_dn.hi, cmp_mask);
+	ret.lo = _internal_mm_blendv_ps(round_up.lo, round_dn.lo, cmp_mask);
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m128x2 math.h functions
+//------------------------------------------------------------------------------
+
+static inline __m128x2 _mm128x2_fabs_psx2(__m128x2 x) {
+	const __m128 sign_mask = _mm_and_ps(
+		x.hi,
+		_mm_get_sign_mask_ps()
+	);
+	x.hi = _mm_xor_ps(x.hi, sign_mask);
+	x.lo = _mm_xor_ps(x.lo, sign_mask);
+	return x;
+}
+
+static inline __m128x2 _mm128x2_fdim_psx2(__m128x2 x, __m128x2 y) {
+	__m128x2 ret;
+	ret = _mm128x2_sub_psx2(x, y);
+	// returns true when ret > 0.0 or ret is NaN
+	__m128 cmp_nle = _mm_cmpnle_zero_psx2(ret);
+	// NaN remains NaN, and -0.0 becomes +0.0
+	ret.hi = _mm_and_ps(ret.hi, cmp_nle);
+	ret.lo = _mm_and_ps(ret.lo, cmp_nle);
+	return ret;
+}
+
+static inline __m128x2 _mm128x2_copysign_psx2(__m128x2 x, __m128x2 y) {
+	const __m128 sign_mask = _mm_and_ps(
+		_mm_xor_ps(x.hi, y.hi),
+		_mm_get_sign_mask_ps()
+	);
+	x.hi = _mm_xor_ps(x.hi, sign_mask);
+	x.lo = _mm_xor_ps(x.lo, sign_mask);
+	return x;
+}
+
+static inline __m128x2 _mm128x2_copysign_psx2_ps(__m128x2 x, __m128 y) {
+	const __m128 sign_mask = _mm_and_ps(
+		_mm_xor_ps(x.hi, y),
+		_mm_get_sign_mask_ps()
+	);
+	x.hi = _mm_xor_ps(x.hi, sign_mask);
+	x.lo = _mm_xor_ps(x.lo, sign_mask);
+	return x;
+}
+
+static inline __m128x2 _mm128x2_sqrt_psx2(__m128x2 x) {
+	__m128 guess = _mm_sqrt_ps(x.hi);
+	return _mm128x2_and_psx2(
+		_mm128x2_mul_power2_psx2_ps(
+			_mm128x2_add_ps_psx2(guess, _mm128x2_div_psx2_ps(x, guess)),
+			_mm_set1_ps(0.5f)
+		),
+		// returns 0.0 on division by 0.0
+		_mm128x2_cmp_extend_ps(
+			_mm_cmpneq_ps(guess, _mm_setzero_ps())
+		)
+	);
+}
+
+/**
+ * @brief returns the fractional part of a __m128x2 value.
+ * @note int_part cannot not be NULL
+ */
+static inline __m128x2 _mm128x2_modf_psx2(__m128x2 x, __m128x2* int_part) {
+	__m128x2 trunc_part = _mm128x2_trunc_psx2(x);
+	*int_part = trunc_part;
+	return _mm128x2_sub_psx2(x, trunc_part);
+}
+
+static inline __m128x2 _mm128x2_fmod_psx2(__m128x2 x, __m128x2 y) {
+	__m128x2 trunc_part = _mm128x2_trunc_psx2(_mm128x2_div_psx2(x, y));
+	return _mm128x2_sub_psx2(x, _mm128x2_mul_psx2(y, trunc_part));
+}
+
+//------------------------------------------------------------------------------
+// __m128x2 exponents and logarithms
+//------------------------------------------------------------------------------
+
+/**
+ * @note exp, log, sin, and cos are calculated in double precision with the
+ * functions from math.h, which have more precision than Float32x2.
+ */
+
+__m128x2 _mm128x2_exp_psx2(__m128x2 x);
+
+__m128x2 _mm128x2_expm1_psx2(__m128x2 x);
+
+static inline __m128x2 _mm128x2_exp2_psx2(const __m128x2 x) {
+	return _mm128x2_exp_psx2(_mm128x2_mul_psx2(x, _mm128x2_const_ln2_psx2()));
+}
+
+static inline __m128x2 _mm128x2_exp10_psx2(const __m128x2 x) {
+	return _mm128x2_exp_psx2(_mm128x2_mul_psx2(x, _mm128x2_const_ln10_psx2()));
+}
+
+__m128x2 _mm128x2_log_psx2(__m128x2 x);
+
+__m128x2 _mm128x2_log1p_psx2(__m128x2 x);
+
+static inline __m128x2 _mm128x2_log2_psx2(const __m128x2 x) {
+	return _mm128x2_mul_psx2(_mm128x2_log_psx2(x), _mm128x2_const_log2e_psx2());
+}
+
+static inline __m128x2 _mm128x2_log10_psx2(const __m128x2 x) {
+	return _mm128x2_mul_psx2(_mm128x2_log_psx2(x), _mm128x2_const_log10e_psx2());
+}
+
+//------------------------------------------------------------------------------
+// __m128x2 trigonometry
+//------------------------------------------------------------------------------
+
+__m128x2 _mm128x2_sin_psx2(__m128x2 x);
+
+__m128x2 _mm128x2_cos_psx2(__m128x2 x);
+
+/**
+ * @warning p_sin and p_cos must be aligned on a 16-byte boundary or a
+ * general-protection exception may be generated.
+ */
+void _mm128x2_sincos_psx2(
+	__m128x2 theta, __m128x2* p_sin, __m128x2* p_cos
+);
+
+static inline __m128x2 _mm128x2_tan_psx2(__m128x2 x) {
+	__m128x2 t_sin, t_cos;
+	_mm128x2_sincos_psx2(x, &t_sin, &t_cos);
+	return _mm128x2_div_psx2(t_sin, t_cos);
+}
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* FLOAT32X2_AVX_H */
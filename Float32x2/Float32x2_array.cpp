@@ -0,0 +1,140 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "Float32x2_array.h"
+#include "Float32x2_array_kernels.h"
+#include "Float32x2.hpp"
+
+//------------------------------------------------------------------------------
+// Float32x2 dispatch
+//------------------------------------------------------------------------------
+
+/** Indexed by LDF_cpu_level. NULL for the scalar level and disabled levels. */
+static const Float32x2_array_kernels* const
+Float32x2_array_levels[LDF_CPU_LEVEL_COUNT] = {
+	NULL,
+	#ifdef LDF_ENABLE_DISPATCH_SSE2
+		&Float32x2_array_kernels_SSE2,
+	#else
+		NULL,
+	#endif
+	#ifdef LDF_ENABLE_DISPATCH_AVX
+		&Float32x2_array_kernels_AVX,
+	#else
+		NULL,
+	#endif
+	#ifdef LDF_ENABLE_DISPATCH_AVX2_FMA
+		&Float32x2_array_kernels_AVX2_FMA,
+	#else
+		NULL,
+	#endif
+	NULL,
+};
+
+/**
+ * @brief Calls the kernel from the highest supported level that implements
+ * it, and returns. Otherwise the caller falls through to its scalar loop.
+ */
+#define FLOAT32X2_ARRAY_DISPATCH(kernel, ...) \
+	for (int level = (int)LDF_cpu_get_level(); level > 0; level--) { \
+		const Float32x2_array_kernels* table = Float32x2_array_levels[level]; \
+		if (table != NULL && table->kernel != NULL) { \
+			table->kernel(__VA_ARGS__); \
+			return; \
+		} \
+	}
+
+#define FLOAT32X2_ARRAY_UNARY(name, func) \
+void Float32x2_##name##_array(const Float32x2* in, Float32x2* out, size_t n) { \
+	FLOAT32X2_ARRAY_DISPATCH(name##_array, in, out, n) \
+	for (size_t i = 0; i < n; i++) { \
+		out[i] = func(in[i]); \
+	} \
+}
+
+#define FLOAT32X2_ARRAY_BINARY(name, func) \
+void Float32x2_##name##_array( \
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n \
+) { \
+	FLOAT32X2_ARRAY_DISPATCH(name##_array, x, y, out, n) \
+	for (size_t i = 0; i < n; i++) { \
+		out[i] = func(x[i], y[i]); \
+	} \
+}
+
+#define FLOAT32X2_ARRAY_SCALAR_UNARY(name, func) \
+void Float32x2_##name##_array(const Float32x2* in, Float32x2* out, size_t n) { \
+	for (size_t i = 0; i < n; i++) { \
+		out[i] = func(in[i]); \
+	} \
+}
+
+#define FLOAT32X2_ARRAY_SCALAR_BINARY(name, func) \
+void Float32x2_##name##_array( \
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n \
+) { \
+	for (size_t i = 0; i < n; i++) { \
+		out[i] = func(x[i], y[i]); \
+	} \
+}
+
+//------------------------------------------------------------------------------
+// Float32x2 array functions
+//------------------------------------------------------------------------------
+
+FLOAT32X2_ARRAY_BINARY(add, operator+)
+FLOAT32X2_ARRAY_BINARY(sub, operator-)
+FLOAT32X2_ARRAY_BINARY(mul, operator*)
+FLOAT32X2_ARRAY_BINARY(div, operator/)
+FLOAT32X2_ARRAY_BINARY(copysign, copysign)
+FLOAT32X2_ARRAY_BINARY(fdim, fdim)
+FLOAT32X2_ARRAY_BINARY(fmax, fmax)
+FLOAT32X2_ARRAY_BINARY(fmin, fmin)
+FLOAT32X2_ARRAY_BINARY(fmod, fmod)
+FLOAT32X2_ARRAY_SCALAR_BINARY(remainder, remainder)
+FLOAT32X2_ARRAY_SCALAR_BINARY(pow, pow)
+FLOAT32X2_ARRAY_SCALAR_BINARY(atan2, atan2)
+FLOAT32X2_ARRAY_UNARY(fabs, fabs)
+FLOAT32X2_ARRAY_UNARY(sqrt, sqrt)
+FLOAT32X2_ARRAY_SCALAR_UNARY(cbrt, cbrt)
+FLOAT32X2_ARRAY_UNARY(exp, exp)
+FLOAT32X2_ARRAY_UNARY(exp2, exp2)
+FLOAT32X2_ARRAY_UNARY(exp10, exp10)
+FLOAT32X2_ARRAY_UNARY(expm1, expm1)
+FLOAT32X2_ARRAY_UNARY(log, log)
+FLOAT32X2_ARRAY_UNARY(log2, log2)
+FLOAT32X2_ARRAY_UNARY(log10, log10)
+FLOAT32X2_ARRAY_UNARY(log1p, log1p)
+FLOAT32X2_ARRAY_UNARY(sin, sin)
+FLOAT32X2_ARRAY_UNARY(cos, cos)
+FLOAT32X2_ARRAY_UNARY(tan, tan)
+FLOAT32X2_ARRAY_SCALAR_UNARY(asin, asin)
+FLOAT32X2_ARRAY_SCALAR_UNARY(acos, acos)
+FLOAT32X2_ARRAY_SCALAR_UNARY(atan, atan)
+FLOAT32X2_ARRAY_SCALAR_UNARY(sinh, sinh)
+FLOAT32X2_ARRAY_SCALAR_UNARY(cosh, cosh)
+FLOAT32X2_ARRAY_SCALAR_UNARY(tanh, tanh)
+FLOAT32X2_ARRAY_SCALAR_UNARY(asinh, asinh)
+FLOAT32X2_ARRAY_SCALAR_UNARY(acosh, acosh)
+FLOAT32X2_ARRAY_SCALAR_UNARY(atanh, atanh)
+FLOAT32X2_ARRAY_SCALAR_UNARY(erf, erf)
+FLOAT32X2_ARRAY_SCALAR_UNARY(erfc, erfc)
+FLOAT32X2_ARRAY_SCALAR_UNARY(tgamma, tgamma)
+FLOAT32X2_ARRAY_SCALAR_UNARY(lgamma, lgamma)
+FLOAT32X2_ARRAY_UNARY(floor, floor)
+FLOAT32X2_ARRAY_UNARY(ceil, ceil)
+FLOAT32X2_ARRAY_UNARY(trunc, trunc)
+FLOAT32X2_ARRAY_SCALAR_UNARY(round, round)
+FLOAT32X2_ARRAY_SCALAR_UNARY(rint, rint)
+FLOAT32X2_ARRAY_SCALAR_UNARY(nearbyint, nearbyint)
+
+#undef FLOAT32X2_ARRAY_DISPATCH
+#undef FLOAT32X2_ARRAY_UNARY
+#undef FLOAT32X2_ARRAY_BINARY
+#undef FLOAT32X2_ARRAY_SCALAR_UNARY
+#undef FLOAT32X2_ARRAY_SCALAR_BINARY
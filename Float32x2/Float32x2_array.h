@@ -0,0 +1,394 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#ifndef FLOAT32X2_ARRAY_H
+#define FLOAT32X2_ARRAY_H
+
+/**
+ * @brief Element-wise functions over arrays of Float32x2.
+ *
+ * The SSE2, AVX, or AVX2+FMA implementation is selected at runtime
+ * with LDF_cpu_get_level() from LDF/LDF_cpu_dispatch.h, so the library does
+ * not need to be compiled with -mavx to use AVX. Functions without a SIMD
+ * implementation, and the tail of each array, use the scalar functions.
+ *
+ * @note The arrays do not need to be aligned. Arrays aligned to 32 bytes
+ * are faster. `out` may be the same array as an input, but the arrays must
+ * not otherwise overlap.
+ *
+ * @note Each Float32x2_array_<ISA>.c file targets its own instruction set
+ * with `#pragma GCC target` on GCC. Other compilers need to compile those
+ * files with the matching flags (-mavx, -mavx2 -mfma), along with
+ * Float32x2/Float32x2_SSE2.c and Float32x2/Float32x2_AVX.c.
+ */
+
+#include "Float32x2_def.h"
+#include "../LDF/LDF_cpu_dispatch.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+//------------------------------------------------------------------------------
+// Float32x2 array arithmetic
+//------------------------------------------------------------------------------
+
+/** @brief out[i] = x[i] + y[i] */
+void Float32x2_add_array(
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n
+);
+
+/** @brief out[i] = x[i] - y[i] */
+void Float32x2_sub_array(
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n
+);
+
+/** @brief out[i] = x[i] * y[i] */
+void Float32x2_mul_array(
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n
+);
+
+/** @brief out[i] = x[i] / y[i] */
+void Float32x2_div_array(
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n
+);
+
+//------------------------------------------------------------------------------
+// Float32x2 array math.h functions
+//------------------------------------------------------------------------------
+
+/** @brief out[i] = copysign(x[i], y[i]) */
+void Float32x2_copysign_array(
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n
+);
+
+/** @brief out[i] = fdim(x[i], y[i]) */
+void Float32x2_fdim_array(
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n
+);
+
+/** @brief out[i] = fmax(x[i], y[i]) */
+void Float32x2_fmax_array(
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n
+);
+
+/** @brief out[i] = fmin(x[i], y[i]) */
+void Float32x2_fmin_array(
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n
+);
+
+/** @brief out[i] = fmod(x[i], y[i]) */
+void Float32x2_fmod_array(
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n
+);
+
+/** @brief out[i] = remainder(x[i], y[i]) */
+void Float32x2_remainder_array(
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n
+);
+
+/** @brief out[i] = fabs(in[i]) */
+void Float32x2_fabs_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = sqrt(in[i]) */
+void Float32x2_sqrt_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = cbrt(in[i]) */
+void Float32x2_cbrt_array(const Float32x2* in, Float32x2* out, size_t n);
+
+//------------------------------------------------------------------------------
+// Float32x2 array exponents and logarithms
+//------------------------------------------------------------------------------
+
+/** @brief out[i] = pow(x[i], y[i]) */
+void Float32x2_pow_array(
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n
+);
+
+/** @brief out[i] = exp(in[i]) */
+void Float32x2_exp_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = exp2(in[i]) */
+void Float32x2_exp2_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = exp10(in[i]) */
+void Float32x2_exp10_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = expm1(in[i]) */
+void Float32x2_expm1_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = log(in[i]) */
+void Float32x2_log_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = log2(in[i]) */
+void Float32x2_log2_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = log10(in[i]) */
+void Float32x2_log10_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = log1p(in[i]) */
+void Float32x2_log1p_array(const Float32x2* in, Float32x2* out, size_t n);
+
+//------------------------------------------------------------------------------
+// Float32x2 array trigonometry
+//------------------------------------------------------------------------------
+
+/** @brief out[i] = atan2(y[i], x[i]) */
+void Float32x2_atan2_array(
+	const Float32x2* y, const Float32x2* x, Float32x2* out, size_t n
+);
+
+/** @brief out[i] = sin(in[i]) */
+void Float32x2_sin_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = cos(in[i]) */
+void Float32x2_cos_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = tan(in[i]) */
+void Float32x2_tan_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = asin(in[i]) */
+void Float32x2_asin_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = acos(in[i]) */
+void Float32x2_acos_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = atan(in[i]) */
+void Float32x2_atan_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = sinh(in[i]) */
+void Float32x2_sinh_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = cosh(in[i]) */
+void Float32x2_cosh_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = tanh(in[i]) */
+void Float32x2_tanh_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = asinh(in[i]) */
+void Float32x2_asinh_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = acosh(in[i]) */
+void Float32x2_acosh_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = atanh(in[i]) */
+void Float32x2_atanh_array(const Float32x2* in, Float32x2* out, size_t n);
+
+//------------------------------------------------------------------------------
+// Float32x2 array special functions
+//------------------------------------------------------------------------------
+
+/** @brief out[i] = erf(in[i]) */
+void Float32x2_erf_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = erfc(in[i]) */
+void Float32x2_erfc_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = tgamma(in[i]) */
+void Float32x2_tgamma_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = lgamma(in[i]) */
+void Float32x2_lgamma_array(const Float32x2* in, Float32x2* out, size_t n);
+
+//------------------------------------------------------------------------------
+// Float32x2 array rounding
+//------------------------------------------------------------------------------
+
+/** @brief out[i] = floor(in[i]) */
+void Float32x2_floor_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = ceil(in[i]) */
+void Float32x2_ceil_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = trunc(in[i]) */
+void Float32x2_trunc_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = round(in[i]) */
+void Float32x2_round_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = rint(in[i]) */
+void Float32x2_rint_array(const Float32x2* in, Float32x2* out, size_t n);
+
+/** @brief out[i] = nearbyint(in[i]) */
+void Float32x2_nearbyint_array(const Float32x2* in, Float32x2* out, size_t n);
+
+#ifdef __cplusplus
+	}
+#endif
+
+#ifdef __cplusplus
+
+//------------------------------------------------------------------------------
+// Float32x2 array C++ overloads
+//------------------------------------------------------------------------------
+
+inline void add_array(
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n
+) {
+	Float32x2_add_array(x, y, out, n);
+}
+inline void sub_array(
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n
+) {
+	Float32x2_sub_array(x, y, out, n);
+}
+inline void mul_array(
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n
+) {
+	Float32x2_mul_array(x, y, out, n);
+}
+inline void div_array(
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n
+) {
+	Float32x2_div_array(x, y, out, n);
+}
+inline void copysign_array(
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n
+) {
+	Float32x2_copysign_array(x, y, out, n);
+}
+inline void fdim_array(
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n
+) {
+	Float32x2_fdim_array(x, y, out, n);
+}
+inline void fmax_array(
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n
+) {
+	Float32x2_fmax_array(x, y, out, n);
+}
+inline void fmin_array(
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n
+) {
+	Float32x2_fmin_array(x, y, out, n);
+}
+inline void fmod_array(
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n
+) {
+	Float32x2_fmod_array(x, y, out, n);
+}
+inline void remainder_array(
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n
+) {
+	Float32x2_remainder_array(x, y, out, n);
+}
+inline void pow_array(
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n
+) {
+	Float32x2_pow_array(x, y, out, n);
+}
+inline void atan2_array(
+	const Float32x2* y, const Float32x2* x, Float32x2* out, size_t n
+) {
+	Float32x2_atan2_array(y, x, out, n);
+}
+inline void fabs_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_fabs_array(in, out, n);
+}
+inline void sqrt_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_sqrt_array(in, out, n);
+}
+inline void cbrt_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_cbrt_array(in, out, n);
+}
+inline void exp_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_exp_array(in, out, n);
+}
+inline void exp2_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_exp2_array(in, out, n);
+}
+inline void exp10_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_exp10_array(in, out, n);
+}
+inline void expm1_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_expm1_array(in, out, n);
+}
+inline void log_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_log_array(in, out, n);
+}
+inline void log2_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_log2_array(in, out, n);
+}
+inline void log10_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_log10_array(in, out, n);
+}
+inline void log1p_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_log1p_array(in, out, n);
+}
+inline void sin_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_sin_array(in, out, n);
+}
+inline void cos_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_cos_array(in, out, n);
+}
+inline void tan_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_tan_array(in, out, n);
+}
+inline void asin_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_asin_array(in, out, n);
+}
+inline void acos_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_acos_array(in, out, n);
+}
+inline void atan_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_atan_array(in, out, n);
+}
+inline void sinh_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_sinh_array(in, out, n);
+}
+inline void cosh_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_cosh_array(in, out, n);
+}
+inline void tanh_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_tanh_array(in, out, n);
+}
+inline void asinh_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_asinh_array(in, out, n);
+}
+inline void acosh_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_acosh_array(in, out, n);
+}
+inline void atanh_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_atanh_array(in, out, n);
+}
+inline void erf_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_erf_array(in, out, n);
+}
+inline void erfc_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_erfc_array(in, out, n);
+}
+inline void tgamma_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_tgamma_array(in, out, n);
+}
+inline void lgamma_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_lgamma_array(in, out, n);
+}
+inline void floor_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_floor_array(in, out, n);
+}
+inline void ceil_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_ceil_array(in, out, n);
+}
+inline void trunc_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_trunc_array(in, out, n);
+}
+inline void round_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_round_array(in, out, n);
+}
+inline void rint_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_rint_array(in, out, n);
+}
+inline void nearbyint_array(const Float32x2* in, Float32x2* out, size_t n) {
+	Float32x2_nearbyint_array(in, out, n);
+}
+
+#endif
+
+#endif /* FLOAT32X2_ARRAY_H */
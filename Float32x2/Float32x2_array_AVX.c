@@ -0,0 +1,144 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "../LDF/LDF_cpu_dispatch.h"
+
+/**
+ * @brief AVX kernels for Float32x2_array.h. Also compiled as the AVX2+FMA
+ * kernels by Float32x2_array_AVX2.c, which defines
+ * FLOAT32X2_ARRAY_AVX_KERNELS before including this file.
+ */
+
+#ifndef FLOAT32X2_ARRAY_AVX_KERNELS
+	#ifdef LDF_ENABLE_DISPATCH_AVX
+		#define FLOAT32X2_ARRAY_AVX_KERNELS Float32x2_array_kernels_AVX
+		#if defined(__GNUC__) && !defined(__clang__) && !defined(__AVX__)
+			#pragma GCC target("avx")
+		#endif
+	#endif
+#endif
+
+#ifdef FLOAT32X2_ARRAY_AVX_KERNELS
+
+#include "Float32x2_array_kernels.h"
+#include "Float32x2_AVX.h"
+
+#include <immintrin.h>
+
+//------------------------------------------------------------------------------
+// __m256x2 array kernels
+//------------------------------------------------------------------------------
+
+/**
+ * @brief The tail is padded to a full __m256x2 with copies of the last
+ * element, so that it is computed the same way as the rest of the array.
+ */
+#define FLOAT32X2_ARRAY_AVX_UNARY(name, func) \
+static void name(const Float32x2* in, Float32x2* out, size_t n) { \
+	size_t i = 0; \
+	for (; i + 8 <= n; i += 8) { \
+		_mm256x2_storeu_psx2(&out[i], func(_mm256x2_loadu_psx2(&in[i]))); \
+	} \
+	if (i < n) { \
+		const size_t rem = n - i; \
+		Float32x2 buf[8]; \
+		for (size_t j = 0; j < 8; j++) { \
+			buf[j] = in[i + ((j < rem) ? j : rem - 1)]; \
+		} \
+		_mm256x2_storeu_psx2(buf, func(_mm256x2_loadu_psx2(buf))); \
+		for (size_t j = 0; j < rem; j++) { \
+			out[i + j] = buf[j]; \
+		} \
+	} \
+}
+
+#define FLOAT32X2_ARRAY_AVX_BINARY(name, func) \
+static void name( \
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n \
+) { \
+	size_t i = 0; \
+	for (; i + 8 <= n; i += 8) { \
+		_mm256x2_storeu_psx2(&out[i], func( \
+			_mm256x2_loadu_psx2(&x[i]), _mm256x2_loadu_psx2(&y[i]) \
+		)); \
+	} \
+	if (i < n) { \
+		const size_t rem = n - i; \
+		Float32x2 buf_x[8]; \
+		Float32x2 buf_y[8]; \
+		for (size_t j = 0; j < 8; j++) { \
+			buf_x[j] = x[i + ((j < rem) ? j : rem - 1)]; \
+			buf_y[j] = y[i + ((j < rem) ? j : rem - 1)]; \
+		} \
+		_mm256x2_storeu_psx2(buf_x, func( \
+			_mm256x2_loadu_psx2(buf_x), _mm256x2_loadu_psx2(buf_y) \
+		)); \
+		for (size_t j = 0; j < rem; j++) { \
+			out[i + j] = buf_x[j]; \
+		} \
+	} \
+}
+
+FLOAT32X2_ARRAY_AVX_BINARY(Float32x2_add_array_AVX, _mm256x2_add_psx2)
+FLOAT32X2_ARRAY_AVX_BINARY(Float32x2_sub_array_AVX, _mm256x2_sub_psx2)
+FLOAT32X2_ARRAY_AVX_BINARY(Float32x2_mul_array_AVX, _mm256x2_mul_psx2)
+FLOAT32X2_ARRAY_AVX_BINARY(Float32x2_div_array_AVX, _mm256x2_div_psx2)
+FLOAT32X2_ARRAY_AVX_BINARY(Float32x2_copysign_array_AVX, _mm256x2_copysign_psx2)
+FLOAT32X2_ARRAY_AVX_BINARY(Float32x2_fdim_array_AVX, _mm256x2_fdim_psx2)
+FLOAT32X2_ARRAY_AVX_BINARY(Float32x2_fmax_array_AVX, _mm256x2_fmax_psx2)
+FLOAT32X2_ARRAY_AVX_BINARY(Float32x2_fmin_array_AVX, _mm256x2_fmin_psx2)
+FLOAT32X2_ARRAY_AVX_BINARY(Float32x2_fmod_array_AVX, _mm256x2_fmod_psx2)
+FLOAT32X2_ARRAY_AVX_UNARY(Float32x2_fabs_array_AVX, _mm256x2_fabs_psx2)
+FLOAT32X2_ARRAY_AVX_UNARY(Float32x2_sqrt_array_AVX, _mm256x2_sqrt_psx2)
+FLOAT32X2_ARRAY_AVX_UNARY(Float32x2_exp_array_AVX, _mm256x2_exp_psx2)
+FLOAT32X2_ARRAY_AVX_UNARY(Float32x2_exp2_array_AVX, _mm256x2_exp2_psx2)
+FLOAT32X2_ARRAY_AVX_UNARY(Float32x2_exp10_array_AVX, _mm256x2_exp10_psx2)
+FLOAT32X2_ARRAY_AVX_UNARY(Float32x2_expm1_array_AVX, _mm256x2_expm1_psx2)
+FLOAT32X2_ARRAY_AVX_UNARY(Float32x2_log_array_AVX, _mm256x2_log_psx2)
+FLOAT32X2_ARRAY_AVX_UNARY(Float32x2_log2_array_AVX, _mm256x2_log2_psx2)
+FLOAT32X2_ARRAY_AVX_UNARY(Float32x2_log10_array_AVX, _mm256x2_log10_psx2)
+FLOAT32X2_ARRAY_AVX_UNARY(Float32x2_log1p_array_AVX, _mm256x2_log1p_psx2)
+FLOAT32X2_ARRAY_AVX_UNARY(Float32x2_sin_array_AVX, _mm256x2_sin_psx2)
+FLOAT32X2_ARRAY_AVX_UNARY(Float32x2_cos_array_AVX, _mm256x2_cos_psx2)
+FLOAT32X2_ARRAY_AVX_UNARY(Float32x2_tan_array_AVX, _mm256x2_tan_psx2)
+FLOAT32X2_ARRAY_AVX_UNARY(Float32x2_floor_array_AVX, _mm256x2_floor_psx2)
+FLOAT32X2_ARRAY_AVX_UNARY(Float32x2_ceil_array_AVX, _mm256x2_ceil_psx2)
+FLOAT32X2_ARRAY_AVX_UNARY(Float32x2_trunc_array_AVX, _mm256x2_trunc_psx2)
+
+#undef FLOAT32X2_ARRAY_AVX_UNARY
+#undef FLOAT32X2_ARRAY_AVX_BINARY
+
+const Float32x2_array_kernels FLOAT32X2_ARRAY_AVX_KERNELS = {
+	.add_array      = Float32x2_add_array_AVX,
+	.sub_array      = Float32x2_sub_array_AVX,
+	.mul_array      = Float32x2_mul_array_AVX,
+	.div_array      = Float32x2_div_array_AVX,
+	.copysign_array = Float32x2_copysign_array_AVX,
+	.fdim_array     = Float32x2_fdim_array_AVX,
+	.fmax_array     = Float32x2_fmax_array_AVX,
+	.fmin_array     = Float32x2_fmin_array_AVX,
+	.fmod_array     = Float32x2_fmod_array_AVX,
+	.fabs_array     = Float32x2_fabs_array_AVX,
+	.sqrt_array     = Float32x2_sqrt_array_AVX,
+	.exp_array      = Float32x2_exp_array_AVX,
+	.exp2_array     = Float32x2_exp2_array_AVX,
+	.exp10_array    = Float32x2_exp10_array_AVX,
+	.expm1_array    = Float32x2_expm1_array_AVX,
+	.log_array      = Float32x2_log_array_AVX,
+	.log2_array     = Float32x2_log2_array_AVX,
+	.log10_array    = Float32x2_log10_array_AVX,
+	.log1p_array    = Float32x2_log1p_array_AVX,
+	.sin_array      = Float32x2_sin_array_AVX,
+	.cos_array      = Float32x2_cos_array_AVX,
+	.tan_array      = Float32x2_tan_array_AVX,
+	.floor_array    = Float32x2_floor_array_AVX,
+	.ceil_array     = Float32x2_ceil_array_AVX,
+	.trunc_array    = Float32x2_trunc_array_AVX,
+};
+
+#endif
@@ -0,0 +1,22 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "../LDF/LDF_cpu_dispatch.h"
+
+/**
+ * @brief AVX2+FMA kernels for Float32x2_array.h. These are the same as the
+ * AVX kernels, except that the exact products use _mm256_fmsub_ps.
+ */
+
+#ifdef LDF_ENABLE_DISPATCH_AVX2_FMA
+	#if defined(__GNUC__) && !defined(__clang__) && !(defined(__AVX2__) && defined(__FMA__))
+		#pragma GCC target("avx2,fma")
+	#endif
+	#define FLOAT32X2_ARRAY_AVX_KERNELS Float32x2_array_kernels_AVX2_FMA
+	#include "Float32x2_array_AVX.c"
+#endif
@@ -0,0 +1,137 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "../LDF/LDF_cpu_dispatch.h"
+
+/**
+ * @brief SSE2 kernels for Float32x2_array.h
+ */
+
+#ifdef LDF_ENABLE_DISPATCH_SSE2
+
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__SSE2__)
+	#pragma GCC target("sse2")
+#endif
+
+#include "Float32x2_array_kernels.h"
+#include "Float32x2_SSE2.h"
+
+#include <emmintrin.h>
+
+//------------------------------------------------------------------------------
+// __m128x2 array kernels
+//------------------------------------------------------------------------------
+
+/**
+ * @brief The tail is padded to a full __m128x2 with copies of the last
+ * element, so that it is computed the same way as the rest of the array.
+ */
+#define FLOAT32X2_ARRAY_SSE2_UNARY(name, func) \
+static void name(const Float32x2* in, Float32x2* out, size_t n) { \
+	size_t i = 0; \
+	for (; i + 4 <= n; i += 4) { \
+		_mm128x2_storeu_psx2(&out[i], func(_mm128x2_loadu_psx2(&in[i]))); \
+	} \
+	if (i < n) { \
+		const size_t rem = n - i; \
+		Float32x2 buf[4]; \
+		for (size_t j = 0; j < 4; j++) { \
+			buf[j] = in[i + ((j < rem) ? j : rem - 1)]; \
+		} \
+		_mm128x2_storeu_psx2(buf, func(_mm128x2_loadu_psx2(buf))); \
+		for (size_t j = 0; j < rem; j++) { \
+			out[i + j] = buf[j]; \
+		} \
+	} \
+}
+
+#define FLOAT32X2_ARRAY_SSE2_BINARY(name, func) \
+static void name( \
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n \
+) { \
+	size_t i = 0; \
+	for (; i + 4 <= n; i += 4) { \
+		_mm128x2_storeu_psx2(&out[i], func( \
+			_mm128x2_loadu_psx2(&x[i]), _mm128x2_loadu_psx2(&y[i]) \
+		)); \
+	} \
+	if (i < n) { \
+		const size_t rem = n - i; \
+		Float32x2 buf_x[4]; \
+		Float32x2 buf_y[4]; \
+		for (size_t j = 0; j < 4; j++) { \
+			buf_x[j] = x[i + ((j < rem) ? j : rem - 1)]; \
+			buf_y[j] = y[i + ((j < rem) ? j : rem - 1)]; \
+		} \
+		_mm128x2_storeu_psx2(buf_x, func( \
+			_mm128x2_loadu_psx2(buf_x), _mm128x2_loadu_psx2(buf_y) \
+		)); \
+		for (size_t j = 0; j < rem; j++) { \
+			out[i + j] = buf_x[j]; \
+		} \
+	} \
+}
+
+FLOAT32X2_ARRAY_SSE2_BINARY(Float32x2_add_array_SSE2, _mm128x2_add_psx2)
+FLOAT32X2_ARRAY_SSE2_BINARY(Float32x2_sub_array_SSE2, _mm128x2_sub_psx2)
+FLOAT32X2_ARRAY_SSE2_BINARY(Float32x2_mul_array_SSE2, _mm128x2_mul_psx2)
+FLOAT32X2_ARRAY_SSE2_BINARY(Float32x2_div_array_SSE2, _mm128x2_div_psx2)
+FLOAT32X2_ARRAY_SSE2_BINARY(Float32x2_copysign_array_SSE2, _mm128x2_copysign_psx2)
+FLOAT32X2_ARRAY_SSE2_BINARY(Float32x2_fdim_array_SSE2, _mm128x2_fdim_psx2)
+FLOAT32X2_ARRAY_SSE2_BINARY(Float32x2_fmax_array_SSE2, _mm128x2_fmax_psx2)
+FLOAT32X2_ARRAY_SSE2_BINARY(Float32x2_fmin_array_SSE2, _mm128x2_fmin_psx2)
+FLOAT32X2_ARRAY_SSE2_BINARY(Float32x2_fmod_array_SSE2, _mm128x2_fmod_psx2)
+FLOAT32X2_ARRAY_SSE2_UNARY(Float32x2_fabs_array_SSE2, _mm128x2_fabs_psx2)
+FLOAT32X2_ARRAY_SSE2_UNARY(Float32x2_sqrt_array_SSE2, _mm128x2_sqrt_psx2)
+FLOAT32X2_ARRAY_SSE2_UNARY(Float32x2_exp_array_SSE2, _mm128x2_exp_psx2)
+FLOAT32X2_ARRAY_SSE2_UNARY(Float32x2_exp2_array_SSE2, _mm128x2_exp2_psx2)
+FLOAT32X2_ARRAY_SSE2_UNARY(Float32x2_exp10_array_SSE2, _mm128x2_exp10_psx2)
+FLOAT32X2_ARRAY_SSE2_UNARY(Float32x2_expm1_array_SSE2, _mm128x2_expm1_psx2)
+FLOAT32X2_ARRAY_SSE2_UNARY(Float32x2_log_array_SSE2, _mm128x2_log_psx2)
+FLOAT32X2_ARRAY_SSE2_UNARY(Float32x2_log2_array_SSE2, _mm128x2_log2_psx2)
+FLOAT32X2_ARRAY_SSE2_UNARY(Float32x2_log10_array_SSE2, _mm128x2_log10_psx2)
+FLOAT32X2_ARRAY_SSE2_UNARY(Float32x2_log1p_array_SSE2, _mm128x2_log1p_psx2)
+FLOAT32X2_ARRAY_SSE2_UNARY(Float32x2_sin_array_SSE2, _mm128x2_sin_psx2)
+FLOAT32X2_ARRAY_SSE2_UNARY(Float32x2_cos_array_SSE2, _mm128x2_cos_psx2)
+FLOAT32X2_ARRAY_SSE2_UNARY(Float32x2_tan_array_SSE2, _mm128x2_tan_psx2)
+FLOAT32X2_ARRAY_SSE2_UNARY(Float32x2_floor_array_SSE2, _mm128x2_floor_psx2)
+FLOAT32X2_ARRAY_SSE2_UNARY(Float32x2_ceil_array_SSE2, _mm128x2_ceil_psx2)
+FLOAT32X2_ARRAY_SSE2_UNARY(Float32x2_trunc_array_SSE2, _mm128x2_trunc_psx2)
+
+#undef FLOAT32X2_ARRAY_SSE2_UNARY
+#undef FLOAT32X2_ARRAY_SSE2_BINARY
+
+const Float32x2_array_kernels Float32x2_array_kernels_SSE2 = {
+	.add_array      = Float32x2_add_array_SSE2,
+	.sub_array      = Float32x2_sub_array_SSE2,
+	.mul_array      = Float32x2_mul_array_SSE2,
+	.div_array      = Float32x2_div_array_SSE2,
+	.copysign_array = Float32x2_copysign_array_SSE2,
+	.fdim_array     = Float32x2_fdim_array_SSE2,
+	.fmax_array     = Float32x2_fmax_array_SSE2,
+	.fmin_array     = Float32x2_fmin_array_SSE2,
+	.fmod_array     = Float32x2_fmod_array_SSE2,
+	.fabs_array     = Float32x2_fabs_array_SSE2,
+	.sqrt_array     = Float32x2_sqrt_array_SSE2,
+	.exp_array      = Float32x2_exp_array_SSE2,
+	.exp2_array     = Float32x2_exp2_array_SSE2,
+	.exp10_array    = Float32x2_exp10_array_SSE2,
+	.expm1_array    = Float32x2_expm1_array_SSE2,
+	.log_array      = Float32x2_log_array_SSE2,
+	.log2_array     = Float32x2_log2_array_SSE2,
+	.log10_array    = Float32x2_log10_array_SSE2,
+	.log1p_array    = Float32x2_log1p_array_SSE2,
+	.sin_array      = Float32x2_sin_array_SSE2,
+	.cos_array      = Float32x2_cos_array_SSE2,
+	.tan_array      = Float32x2_tan_array_SSE2,
+	.floor_array    = Float32x2_floor_array_SSE2,
+	.ceil_array     = Float32x2_ceil_array_SSE2,
+	.trunc_array    = Float32x2_trunc_array_SSE2,
+};
+
+#endif
@@ -0,0 +1,80 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#ifndef FLOAT32X2_ARRAY_KERNELS_H
+#define FLOAT32X2_ARRAY_KERNELS_H
+
+/**
+ * @brief Internal table of the Float32x2_array.h kernels. Each
+ * Float32x2_array_<ISA>.c file provides one table.
+ *
+ * @note NULL entries fall back to the next lower level, and then to the
+ * scalar loop in Float32x2_array.cpp, so a level only needs to implement the
+ * kernels that it speeds up.
+ */
+
+#include "Float32x2_def.h"
+#include "../LDF/LDF_cpu_dispatch.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+typedef void (*Float32x2_array_unary_func)(
+	const Float32x2* in, Float32x2* out, size_t n
+);
+
+typedef void (*Float32x2_array_binary_func)(
+	const Float32x2* x, const Float32x2* y, Float32x2* out, size_t n
+);
+
+typedef struct Float32x2_array_kernels {
+	Float32x2_array_binary_func add_array;
+	Float32x2_array_binary_func sub_array;
+	Float32x2_array_binary_func mul_array;
+	Float32x2_array_binary_func div_array;
+	Float32x2_array_binary_func copysign_array;
+	Float32x2_array_binary_func fdim_array;
+	Float32x2_array_binary_func fmax_array;
+	Float32x2_array_binary_func fmin_array;
+	Float32x2_array_binary_func fmod_array;
+	Float32x2_array_unary_func fabs_array;
+	Float32x2_array_unary_func sqrt_array;
+	Float32x2_array_unary_func exp_array;
+	Float32x2_array_unary_func exp2_array;
+	Float32x2_array_unary_func exp10_array;
+	Float32x2_array_unary_func expm1_array;
+	Float32x2_array_unary_func log_array;
+	Float32x2_array_unary_func log2_array;
+	Float32x2_array_unary_func log10_array;
+	Float32x2_array_unary_func log1p_array;
+	Float32x2_array_unary_func sin_array;
+	Float32x2_array_unary_func cos_array;
+	Float32x2_array_unary_func tan_array;
+	Float32x2_array_unary_func floor_array;
+	Float32x2_array_unary_func ceil_array;
+	Float32x2_array_unary_func trunc_array;
+} Float32x2_array_kernels;
+
+#ifdef LDF_ENABLE_DISPATCH_SSE2
+	extern const Float32x2_array_kernels Float32x2_array_kernels_SSE2;
+#endif
+#ifdef LDF_ENABLE_DISPATCH_AVX
+	extern const Float32x2_array_kernels Float32x2_array_kernels_AVX;
+#endif
+#ifdef LDF_ENABLE_DISPATCH_AVX2_FMA
+	extern const Float32x2_array_kernels Float32x2_array_kernels_AVX2_FMA;
+#endif
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* FLOAT32X2_ARRAY_KERNELS_H */
@@ -15,8 +15,6 @@
 
 #include "../Float32/Float32.h"
 
-typedef float fp32;
-
 //------------------------------------------------------------------------------
 // Float32x2 struct
 //------------------------------------------------------------------------------
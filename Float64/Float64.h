@@ -68,7 +68,7 @@ static inline bool Float64_isnan(const fp64 x) {
 	const uint64_t* const x_bin = (const uint64_t*)((const void*)&x);
 	// extract the exponent, and check if it is all ones
 	const uint64_t x_exp = *x_bin & Float64_get_exponent_mask();
-	const bool all_ones = (x_exp != Float64_get_exponent_mask());
+	const bool all_ones = (x_exp == Float64_get_exponent_mask());
 	// extract the mantissa, and check that at least one bit is set
 	const uint64_t x_mant = *x_bin & Float64_get_mantissa_mask();
 	const bool mantissa_set = (x_mant != 0);
@@ -6,12 +6,110 @@
 **	this project. If not, see https://opensource.org/license/MIT
 */
 
+/**
+ * Compiles this file for AVX even when the rest of the library targets an
+ * older CPU, so that the runtime dispatch in Float64x2_array.c can use it.
+ */
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__AVX__)
+	#pragma GCC target("avx")
+#endif
+
 #include <immintrin.h>
 #include <math.h>
 #include "Float64_AVX.h"
+#include "../LDF/LDF_fma.h"
 
 #if (FLOAT64_AVX_SVML_REPLACEMENTS != 0)
 
+//------------------------------------------------------------------------------
+// __m256d helper functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Loads table[index] for each lane.
+ * @note index must be within the bounds of table.
+ */
+static inline __m256d _mm256_lookup_table_pd(
+	const double* const table, const __m128i index
+) {
+	#ifdef __AVX2__
+		return _mm256_i32gather_pd(table, index, sizeof(double));
+	#else
+		int32_t i[4];
+		_mm_storeu_si128((__m128i*)i, index);
+		return _mm256_set_pd(table[i[3]], table[i[2]], table[i[1]], table[i[0]]);
+	#endif
+}
+
+/**
+ * @brief Evaluates coef[0] + coef[1] * x + ... + coef[count - 1] * x^(count - 1)
+ * using Horner's method.
+ */
+static inline __m256d _mm256_horner_pd(
+	const __m256d x, const double* const coef, const int count
+) {
+	__m256d ret = _mm256_set1_pd(coef[count - 1]);
+	for (int i = count - 2; i >= 0; i--) {
+		ret = _mm256_add_pd(_mm256_mul_pd(ret, x), _mm256_set1_pd(coef[i]));
+	}
+	return ret;
+}
+
+/**
+ * @brief Computes x + y = ret + *err exactly
+ */
+static inline __m256d _mm256_two_sum_pd(
+	const __m256d x, const __m256d y, __m256d* const err
+) {
+	const __m256d s = _mm256_add_pd(x, y);
+	const __m256d v = _mm256_sub_pd(s, x);
+	*err = _mm256_add_pd(
+		_mm256_sub_pd(x, _mm256_sub_pd(s, v)), _mm256_sub_pd(y, v)
+	);
+	return s;
+}
+
+/**
+ * @brief Computes x * y = ret + *err exactly
+ */
+static inline __m256d _mm256_two_prod_pd(
+	const __m256d x, const __m256d y, __m256d* const err
+) {
+	const __m256d p = _mm256_mul_pd(x, y);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		*err = _mm256_fmsub_pd(x, y, p);
+	#else
+		// (2^ceil(53 / 2) + 1)
+		const __m256d dekker_scale = _mm256_set1_pd(134217729.0);
+		__m256d temp = _mm256_mul_pd(x, dekker_scale);
+		const __m256d x_hi = _mm256_sub_pd(temp, _mm256_sub_pd(temp, x));
+		const __m256d x_lo = _mm256_sub_pd(x, x_hi);
+		temp = _mm256_mul_pd(y, dekker_scale);
+		const __m256d y_hi = _mm256_sub_pd(temp, _mm256_sub_pd(temp, y));
+		const __m256d y_lo = _mm256_sub_pd(y, y_hi);
+		*err = _mm256_add_pd(_mm256_add_pd(_mm256_add_pd(_mm256_add_pd(
+			_mm256_mul_pd(x_hi, y_hi), _mm256_negate_pd(p)),
+			_mm256_mul_pd(x_hi, y_lo)), _mm256_mul_pd(x_lo, y_hi)),
+			_mm256_mul_pd(x_lo, y_lo)
+		);
+	#endif
+	return p;
+}
+
+/**
+ * @brief Returns a mask of the lanes where x is an integer, including
+ * infinity.
+ */
+static inline __m256d _mm256_isint_pd(const __m256d x) {
+	return _mm256_cmp_pd(
+		_mm256_round_pd(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC), x, _CMP_EQ_OQ
+	);
+}
+
+//------------------------------------------------------------------------------
+// __m256d other functions
+//------------------------------------------------------------------------------
+
 #if 0
 /* Legacy Functions */
 
@@ -72,295 +170,1276 @@ __m256d _mm256_hypot_pd(const __m256d x, const __m256d y) {
 //------------------------------------------------------------------------------
 
 /**
- * @note This is currently the __m256dx2 version of the function, which means
- * the extra precision is wasted.
- * @todo Find the correct value for k and the number of terms to use for the
- * taylor series for this function.
+ * @brief Computes expm1(r) for |r| <= ln(2)/2 with the Taylor series
+ * 1/2! to 1/14!, where r = r_hi + r_lo
  */
-static inline __m256d _mm256_taylor_expm1_pd(
-	const __m256d x, __m128i* m_bin
-) {
-	const __m256d inv_fact[6] = {
-	/* 3! */ _mm256_set1_pd(0x1.5555555555555p-3 ),
-	/* 4! */ _mm256_set1_pd(0x1.5555555555555p-5 ),
-	/* 5! */ _mm256_set1_pd(0x1.1111111111111p-7 ),
-	/* 6! */ _mm256_set1_pd(0x1.6c16c16c16c17p-10),
-	/* 7! */ _mm256_set1_pd(0x1.a01a01a01a01ap-13),
-	/* 8! */ _mm256_set1_pd(0x1.a01a01a01a01ap-16)
+static inline __m256d _mm256_expm1_kernel_pd(const __m256d r_hi, const __m256d r_lo) {
+	static const double inv_fact[13] = {
+		+0x1.0000000000000p-1,
+		+0x1.5555555555555p-3,
+		+0x1.5555555555555p-5,
+		+0x1.1111111111111p-7,
+		+0x1.6c16c16c16c17p-10,
+		+0x1.a01a01a01a01ap-13,
+		+0x1.a01a01a01a01ap-16,
+		+0x1.71de3a556c734p-19,
+		+0x1.27e4fb7789f5cp-22,
+		+0x1.ae64567f544e4p-26,
+		+0x1.1eed8eff8d898p-29,
+		+0x1.6124613a86d09p-33,
+		+0x1.93974a8c07c9dp-37
 	};
-	/* Strategy:  We first reduce the size of x by noting that
-		
-			exp(kr + m * log(2)) = 2^m * exp(r)^k
-
-		where m and k are integers.  By choosing m appropriately
-		we can make |kr| <= log(2) / 2 = 0.347.  Then exp(r) is 
-		evaluated using the familiar Taylor series.  Reducing the 
-		argument substantially speeds up the convergence.       */  
-
-	// const __m256d k = _mm256_set1_pd(0x1.0p+9);
-	const __m256d inv_k = _mm256_set1_pd(0x1.0p-9);
-
-	const __m256d const_log2e = _mm256_const_log2e_pd();
-	const __m256d const_ln2 = _mm256_const_ln2_pd();
+	const __m256d r = _mm256_add_pd(r_hi, r_lo);
+	const __m256d r_err = _mm256_add_pd(_mm256_sub_pd(r_hi, r), r_lo);
+	const __m256d poly = _mm256_horner_pd(r, inv_fact, 13);
+	return _mm256_add_pd(r, _mm256_add_pd(
+		_mm256_mul_pd(_mm256_square_pd(r), poly), r_err
+	));
+}
 
-	__m256d m = _mm256_floor_pd(
-		_mm256_add_pd(_mm256_mul_pd(x, const_log2e), _mm256_set1_pd(0.5))
+/**
+ * @brief Computes expm1(r) where x = r + m * ln(2) and |r| <= ln(2)/2.
+ *
+ * @details x is clamped to [-746.0, +710.0] so that m fits inside of an
+ * int32_t, and exp(x) underflows to zero or overflows to infinity outside of
+ * that range. NaN must be blended back in afterwards.
+ */
+static inline __m256d _mm256_exp_reduce_pd(const __m256d x, __m128i* const m_bin) {
+	/* ln(2) split so that m * ln2_hi is exact */
+	const __m256d ln2_hi = _mm256_set1_pd(+0x1.62e42fee00000p-1);
+	const __m256d ln2_lo = _mm256_set1_pd(+0x1.a39ef35793c76p-33);
+	const __m256d x_clamp = _mm256_min_pd(
+		_mm256_max_pd(x, _mm256_set1_pd(-746.0)), _mm256_set1_pd(+710.0)
 	);
-	*m_bin = _mm256_cvttpd_epi32(m);
 
-	__m256d r = _mm256_mul_pd(
-		_mm256_sub_pd(x, _mm256_mul_pd(const_ln2, m)), inv_k
+	const __m256d m = _mm256_round_pd(
+		_mm256_mul_pd(x_clamp, _mm256_const_log2e_pd()),
+		_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC
 	);
-	__m256d s, t, p;
+	*m_bin = _mm256_cvtpd_epi32(m);
 
-	p = _mm256_square_pd(r);
-	s = _mm256_add_pd(r, _mm256_mul_pd(p, _mm256_set1_pd(0.5)));
-	p = _mm256_mul_pd(p, r);
-	t = _mm256_mul_pd(p, inv_fact[0]);
-	size_t i = 0;
-	do {
-		s = _mm256_add_pd(s, t);
-		p = _mm256_mul_pd(p, r);
-		++i;
-		t = _mm256_mul_pd(p, inv_fact[i]);
-	} while (i < 5);
-
-	s = _mm256_add_pd(s, t);
-
-	s = _mm256_add_pd(_mm256_mul_pd(s, _mm256_set1_pd(2.0)), _mm256_square_pd(s));
-	s = _mm256_add_pd(_mm256_mul_pd(s, _mm256_set1_pd(2.0)), _mm256_square_pd(s));
-	s = _mm256_add_pd(_mm256_mul_pd(s, _mm256_set1_pd(2.0)), _mm256_square_pd(s));
-
-	s = _mm256_add_pd(_mm256_mul_pd(s, _mm256_set1_pd(2.0)), _mm256_square_pd(s));
-	s = _mm256_add_pd(_mm256_mul_pd(s, _mm256_set1_pd(2.0)), _mm256_square_pd(s));
-	s = _mm256_add_pd(_mm256_mul_pd(s, _mm256_set1_pd(2.0)), _mm256_square_pd(s));
-
-	s = _mm256_add_pd(_mm256_mul_pd(s, _mm256_set1_pd(2.0)), _mm256_square_pd(s));
-	s = _mm256_add_pd(_mm256_mul_pd(s, _mm256_set1_pd(2.0)), _mm256_square_pd(s));
-	s = _mm256_add_pd(_mm256_mul_pd(s, _mm256_set1_pd(2.0)), _mm256_square_pd(s));
-	
-	return s;
-	// Original return code:
-	// s += 1.0;
-	// return ldexp(s, static_cast<int>(m));
+	const __m256d r_hi = _mm256_sub_pd(x_clamp, _mm256_mul_pd(m, ln2_hi));
+	const __m256d r_lo = _mm256_negate_pd(_mm256_mul_pd(m, ln2_lo));
+	return _mm256_expm1_kernel_pd(r_hi, r_lo);
 }
 
 __m256d _mm256_exp_pd(const __m256d x) {
 	__m128i m_bin;
-	__m256d ret = _mm256_taylor_expm1_pd(x, &m_bin);
+	__m256d ret = _mm256_exp_reduce_pd(x, &m_bin);
 	ret = _mm256_add_pd(ret, _mm256_set1_pd(1.0));
-	
-	return _mm256_ldexp_pd_epi32(ret, m_bin);
+	ret = _mm256_ldexp_pd_epi32(ret, m_bin);
+
+	// Propagates NaN
+	return _mm256_blendv_pd(ret, x, _mm256_isnan_pd(x));
 }
 
 __m256d _mm256_expm1_pd(const __m256d x) {
 	__m128i m_bin;
-	__m256d ret_expm1 = _mm256_taylor_expm1_pd(x, &m_bin);
+	const __m256d ret_expm1 = _mm256_exp_reduce_pd(x, &m_bin);
 
-	__m256d ret = _mm256_add_pd(ret_expm1, _mm256_set1_pd(1.0));
-	
-	ret = _mm256_ldexp_pd_epi32(ret, m_bin);
-	ret = _mm256_sub_pd(ret, _mm256_set1_pd(1.0));
+	/**
+	 * 2^m * (expm1(r) + 1) - 1 = 2^m * expm1(r) + (2^m - 1)
+	 * 2^m - 1 is exact when |m| <= 53, so only a single rounding occurs.
+	 */
+	const __m256d pow2_m = _mm256_ldexp_pd_epi32(_mm256_set1_pd(1.0), m_bin);
+	__m256d ret = _mm256_add_pd(
+		_mm256_ldexp_pd_epi32(ret_expm1, m_bin),
+		_mm256_sub_pd(pow2_m, _mm256_set1_pd(1.0))
+	);
 
-	// Check if x was in range
-	const __m256d const_half_ln2 = _mm256_mul_pd(
-		_mm256_const_ln2_pd(), _mm256_set1_pd(0.5)
+	// Avoids overflowing 2^m when m is large
+	const __m256d ret_large = _mm256_sub_pd(_mm256_ldexp_pd_epi32(
+		_mm256_add_pd(ret_expm1, _mm256_set1_pd(1.0)), m_bin
+	), _mm256_set1_pd(1.0));
+	ret = _mm256_blendv_pd(ret, ret_large,
+		_mm256_cmp_pd(x, _mm256_set1_pd(40.0), _CMP_GT_OQ)
 	);
-	__m256d ret_cmp = _mm256_cmp_pd(_mm256_fabs_pd(x), const_half_ln2, _CMP_LT_OQ);
 
-	ret = _mm256_blendv_pd(ret, ret_expm1, ret_cmp);
+	// Propagates NaN
+	return _mm256_blendv_pd(ret, x, _mm256_isnan_pd(x));
+}
+
+/**
+ * @brief log(i / 128) for i = 96 to 192, split into two doubles.
+ */
+static const double _mm256_log_table_hi[97] = {
+	-0x1.269621134db92p-2, -0x1.1bf99635a6b95p-2, -0x1.1178e8227e47cp-2, -0x1.07138604d5862p-2,
+	-0x1.f991c6cb3b379p-3, -0x1.e530effe71012p-3, -0x1.d1037f2655e7bp-3, -0x1.bd087383bd8adp-3,
+	-0x1.a93ed3c8ad9e3p-3, -0x1.95a5adcf7017fp-3, -0x1.823c16551a3c2p-3, -0x1.6f0128b756abcp-3,
+	-0x1.5bf406b543db2p-3, -0x1.4913d8333b561p-3, -0x1.365fcb0159016p-3, -0x1.23d712a49c202p-3,
+	-0x1.1178e8227e47cp-3, -0x1.fe89139dbd566p-4, -0x1.da727638446a2p-4, -0x1.b6ac88dad5b1cp-4,
+	-0x1.9335e5d594989p-4, -0x1.700d30aeac0e1p-4, -0x1.4d3115d207eacp-4, -0x1.2aa04a44717a5p-4,
+	-0x1.08598b59e3a07p-4, -0x1.ccb73cdddb2ccp-5, -0x1.894aa149fb343p-5, -0x1.466aed42de3eap-5,
+	-0x1.0415d89e74444p-5, -0x1.8492528c8cabfp-6, -0x1.0205658935847p-6, -0x1.010157588de71p-7,
+	+0x0.0p+0, +0x1.fe02a6b106789p-8, +0x1.fc0a8b0fc03e4p-7, +0x1.7b91b07d5b11bp-6,
+	+0x1.f829b0e783300p-6, +0x1.39e87b9febd60p-5, +0x1.77458f632dcfcp-5, +0x1.b42dd711971bfp-5,
+	+0x1.f0a30c01162a6p-5, +0x1.16536eea37ae1p-4, +0x1.341d7961bd1d1p-4, +0x1.51b073f06183fp-4,
+	+0x1.6f0d28ae56b4cp-4, +0x1.8c345d6319b21p-4, +0x1.a926d3a4ad563p-4, +0x1.c5e548f5bc743p-4,
+	+0x1.e27076e2af2e6p-4, +0x1.fec9131dbeabbp-4, +0x1.0d77e7cd08e59p-3, +0x1.1b72ad52f67a0p-3,
+	+0x1.29552f81ff523p-3, +0x1.371fc201e8f74p-3, +0x1.44d2b6ccb7d1ep-3, +0x1.526e5e3a1b438p-3,
+	+0x1.5ff3070a793d4p-3, +0x1.6d60fe719d21dp-3, +0x1.7ab890210d909p-3, +0x1.87fa06520c911p-3,
+	+0x1.9525a9cf456b4p-3, +0x1.a23bc1fe2b563p-3, +0x1.af3c94e80bff3p-3, +0x1.bc286742d8cd6p-3,
+	+0x1.c8ff7c79a9a22p-3, +0x1.d5c216b4fbb91p-3, +0x1.e27076e2af2e6p-3, +0x1.ef0adcbdc5936p-3,
+	+0x1.fb9186d5e3e2bp-3, +0x1.0402594b4d041p-2, +0x1.0a324e27390e3p-2, +0x1.1058bf9ae4ad5p-2,
+	+0x1.1675cababa60ep-2, +0x1.1c898c16999fbp-2, +0x1.22941fbcf7966p-2, +0x1.2895a13de86a3p-2,
+	+0x1.2e8e2bae11d31p-2, +0x1.347dd9a987d55p-2, +0x1.3a64c556945eap-2, +0x1.404308686a7e4p-2,
+	+0x1.4618bc21c5ec2p-2, +0x1.4be5f957778a1p-2, +0x1.51aad872df82dp-2, +0x1.5767717455a6cp-2,
+	+0x1.5d1bdbf5809cap-2, +0x1.62c82f2b9c795p-2, +0x1.686c81e9b14afp-2, +0x1.6e08eaa2ba1e4p-2,
+	+0x1.739d7f6bbd007p-2, +0x1.792a55fdd47a2p-2, +0x1.7eaf83b82afc3p-2, +0x1.842d1da1e8b17p-2,
+	+0x1.89a3386c1425bp-2, +0x1.8f11e873662c7p-2, +0x1.947941c2116fbp-2, +0x1.99d958117e08bp-2,
+	+0x1.9f323ecbf984cp-2
+};
+
+static const double _mm256_log_table_lo[97] = {
+	-0x1.e0efadd9db02bp-56, +0x1.12aeb84249223p-57, +0x1.0e63a5f01c691p-57, -0x1.cdb16ed4e9138p-56,
+	-0x1.f665066f980a2p-57, -0x1.2276041f43042p-59, -0x1.60629242471a2p-57, -0x1.dd355f6a516d7p-60,
+	-0x1.bcafa9de97203p-57, -0x1.142c507fb7a3dp-58, +0x1.1232ce70be781p-57, +0x1.8de59c21e166cp-57,
+	+0x1.1f5b44c0df7e7p-61, +0x1.0d5604930f135p-58, -0x1.7d411a5b944adp-58, +0x1.6e38161051d69p-57,
+	+0x1.0e63a5f01c691p-58, +0x1.ac9f4215f9393p-58, -0x1.401fa71733019p-58, +0x1.0057eed1ca59fp-59,
+	+0x1.478a85704ccb7p-58, +0x1.72566212cdd05p-61, -0x1.769f42c7842ccp-58, +0x1.d15d38d2fa3f7p-58,
+	+0x1.dd7009902bf32p-58, +0x1.e48fb0500efd4p-59, -0x1.a8be97660a23dp-60, +0x1.cdd6f7f4a137ep-59,
+	-0x1.c05cf1d753622p-59, +0x1.d192d0619fa67p-60, -0x1.27c8e8416e71fp-60, -0x1.46662d417ced0p-62,
+	+0x0.0p+0, -0x1.e44b7e3711ebfp-67, -0x1.83092c59642a1p-62, -0x1.5b602ace3a510p-60,
+	+0x1.33e3f04f1ef23p-60, -0x1.5bfa937f551bbp-59, +0x1.18d3ca87b9296p-59, -0x1.eb9759c130499p-60,
+	+0x1.85f325c5bbacdp-59, -0x1.79da3e8c22cdap-60, -0x1.b599f227becbbp-58, +0x1.a49e39a1a8be4p-58,
+	-0x1.906d99184b992p-58, -0x1.4a697ab3424a9p-61, +0x1.942f48aa70ea9p-58, +0x1.5d617ef8161b1p-60,
+	-0x1.61578001e0162p-60, -0x1.5746b9981b36cp-58, +0x1.9a5dc5e9030acp-57, +0x1.483023472cd74p-58,
+	+0x1.301771c407dbfp-57, +0x1.de6cb62af18a0p-58, +0x1.9f4f6543e1f88p-57, -0x1.746ff8a470d3ap-57,
+	-0x1.bc60efafc6f6ep-58, -0x1.caae268ecd179p-57, +0x1.be36b2d6a0608p-59, -0x1.bf7fdbfa08d9ap-57,
+	+0x1.d904c1d4e2e26p-57, +0x1.93711b07a998cp-59, -0x1.398cff3641985p-58, +0x1.4fce744870f55p-58,
+	-0x1.4f689f8434012p-57, +0x1.6e443597e4d40p-57, -0x1.61578001e0162p-59, +0x1.48637950dc20dp-57,
+	-0x1.caaae64f21acbp-57, -0x1.28ec217a5022dp-57, +0x1.7dcfde8061c03p-56, +0x1.89fa0ab4cb31dp-58,
+	+0x1.ce63eab883717p-61, -0x1.0e5c62aff1c44p-60, -0x1.76f5eb09628afp-56, +0x1.7ad24c13f040ep-56,
+	-0x1.8f4cdb95ebdf9p-56, -0x1.4dd4c580919f8p-57, -0x1.c68651945f97cp-57, -0x1.0bcfb6082ce6dp-56,
+	+0x1.f42decdeccf1dp-56, -0x1.259b35b04813dp-57, +0x1.3927ac19f55e3p-59, +0x1.526adb283660cp-56,
+	+0x1.4236383dc7fe1p-56, +0x1.7b7af915300e5p-57, -0x1.ddea0f7f58e3dp-57, -0x1.cfb1b39ca3a0fp-56,
+	-0x1.8c76ceb014b04p-56, +0x1.f057691fe9ed7p-56, +0x1.92ce979ed2950p-56, +0x1.24ec519784676p-56,
+	-0x1.29639dfbbf0fbp-56, +0x1.f85da755a61a3p-56, -0x1.16cc8bae0bbe4p-56, -0x1.a2b6889dc3e72p-57,
+	-0x1.a92e513217f5cp-59
+};
+
+/**
+ * @brief 128 / i for i = 96 to 192
+ */
+static const double _mm256_log_table_inv[97] = {
+	+0x1.5555555555555p+0, +0x1.51d07eae2f815p+0, +0x1.4e5e0a72f0539p+0, +0x1.4afd6a052bf5bp+0,
+	+0x1.47ae147ae147bp+0, +0x1.446f86562d9fbp+0, +0x1.4141414141414p+0, +0x1.3e22cbce4a902p+0,
+	+0x1.3b13b13b13b14p+0, +0x1.3813813813814p+0, +0x1.3521cfb2b78c1p+0, +0x1.323e34a2b10bfp+0,
+	+0x1.2f684bda12f68p+0, +0x1.2c9fb4d812ca0p+0, +0x1.29e4129e4129ep+0, +0x1.27350b8812735p+0,
+	+0x1.2492492492492p+0, +0x1.21fb78121fb78p+0, +0x1.1f7047dc11f70p+0, +0x1.1cf06ada2811dp+0,
+	+0x1.1a7b9611a7b96p+0, +0x1.1811811811812p+0, +0x1.15b1e5f75270dp+0, +0x1.135c81135c811p+0,
+	+0x1.1111111111111p+0, +0x1.0ecf56be69c90p+0, +0x1.0c9714fbcda3bp+0, +0x1.0a6810a6810a7p+0,
+	+0x1.0842108421084p+0, +0x1.0624dd2f1a9fcp+0, +0x1.0410410410410p+0, +0x1.0204081020408p+0,
+	+0x1.0000000000000p+0, +0x1.fc07f01fc07f0p-1, +0x1.f81f81f81f820p-1, +0x1.f44659e4a4271p-1,
+	+0x1.f07c1f07c1f08p-1, +0x1.ecc07b301ecc0p-1, +0x1.e9131abf0b767p-1, +0x1.e573ac901e574p-1,
+	+0x1.e1e1e1e1e1e1ep-1, +0x1.de5d6e3f8868ap-1, +0x1.dae6076b981dbp-1, +0x1.d77b654b82c34p-1,
+	+0x1.d41d41d41d41dp-1, +0x1.d0cb58f6ec074p-1, +0x1.cd85689039b0bp-1, +0x1.ca4b3055ee191p-1,
+	+0x1.c71c71c71c71cp-1, +0x1.c3f8f01c3f8f0p-1, +0x1.c0e070381c0e0p-1, +0x1.bdd2b899406f7p-1,
+	+0x1.bacf914c1bad0p-1, +0x1.b7d6c3dda338bp-1, +0x1.b4e81b4e81b4fp-1, +0x1.b2036406c80d9p-1,
+	+0x1.af286bca1af28p-1, +0x1.ac5701ac5701bp-1, +0x1.a98ef606a63bep-1, +0x1.a6d01a6d01a6dp-1,
+	+0x1.a41a41a41a41ap-1, +0x1.a16d3f97a4b02p-1, +0x1.9ec8e951033d9p-1, +0x1.9c2d14ee4a102p-1,
+	+0x1.999999999999ap-1, +0x1.970e4f80cb872p-1, +0x1.948b0fcd6e9e0p-1, +0x1.920fb49d0e229p-1,
+	+0x1.8f9c18f9c18fap-1, +0x1.8d3018d3018d3p-1, +0x1.8acb90f6bf3aap-1, +0x1.886e5f0abb04ap-1,
+	+0x1.8618618618618p-1, +0x1.83c977ab2beddp-1, +0x1.8181818181818p-1, +0x1.7f405fd017f40p-1,
+	+0x1.7d05f417d05f4p-1, +0x1.7ad2208e0ecc3p-1, +0x1.78a4c8178a4c8p-1, +0x1.767dce434a9b1p-1,
+	+0x1.745d1745d1746p-1, +0x1.724287f46debcp-1, +0x1.702e05c0b8170p-1, +0x1.6e1f76b4337c7p-1,
+	+0x1.6c16c16c16c17p-1, +0x1.6a13cd1537290p-1, +0x1.6816816816817p-1, +0x1.661ec6a5122f9p-1,
+	+0x1.642c8590b2164p-1, +0x1.623fa77016240p-1, +0x1.6058160581606p-1, +0x1.5e75bb8d015e7p-1,
+	+0x1.5c9882b931057p-1, +0x1.5ac056b015ac0p-1, +0x1.58ed2308158edp-1, +0x1.571ed3c506b3ap-1,
+	+0x1.5555555555555p-1
+};
+
+/**
+ * @brief Computes log(x) = *ret_hi + *ret_lo for finite x > 0.
+ *
+ * @details x is split into 2^e * m with m inside [0.75, 1.5), then
+ * log(x) = e * log(2) + log(c) + log1p((m - c) / c) where c is m rounded to a
+ * multiple of 1/128. log(c) is looked up from a table, which leaves
+ * |(m - c) / c| < 2^-7.5 for the polynomial. The result has roughly 70 bits
+ * of precision so that it can be used by pow.
+ */
+static inline void _mm256_log_kernel_pd(
+	__m256d x, __m256d* const ret_hi, __m256d* const ret_lo
+) {
+	/* ln(2) split so that e * ln2_hi is exact */
+	const __m256d ln2_hi = _mm256_set1_pd(+0x1.62e42fee00000p-1);
+	const __m256d ln2_lo = _mm256_set1_pd(+0x1.a39ef35793c76p-33);
+	/* 1/3, -1/4, 1/5, -1/6, 1/7, -1/8 */
+	static const double log1p_coef[6] = {
+		+0x1.5555555555555p-2, -0x1.0000000000000p-2,
+		+0x1.999999999999ap-3, -0x1.5555555555555p-3,
+		+0x1.2492492492492p-3, -0x1.0000000000000p-3
+	};
+
+	// Keeps the table index in bounds for 0.0, infinity, and NaN
+	x = _mm256_blendv_pd(_mm256_set1_pd(1.0), x, _mm256_and_pd(
+		_mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_GT_OQ), _mm256_isfinite_pd(x)
+	));
+
+	__m128i expon;
+	__m256d m = _mm256_frexp_pd_epi32(x, &expon);
+	// [0.5, 0.75) to [1.0, 1.5)
+	const __m256d m_small = _mm256_cmp_pd(m, _mm256_set1_pd(0.75), _CMP_LT_OQ);
+	m = _mm256_blendv_pd(m, _mm256_add_pd(m, m), m_small);
+	expon = _mm_sub_epi32(expon, _mm256_cvtpd_epi32(
+		_mm256_and_pd(m_small, _mm256_set1_pd(1.0))
+	));
+	const __m256d e = _mm256_cvtepi32_pd(expon);
+
+	const __m256d c_index = _mm256_round_pd(
+		_mm256_mul_pd(m, _mm256_set1_pd(128.0)),
+		_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC
+	);
+	const __m256d c = _mm256_mul_pd(c_index, _mm256_set1_pd(0x1.0p-7));
+	const __m128i index = _mm_sub_epi32(_mm256_cvtpd_epi32(c_index), _mm_set1_epi32(96));
+	const __m256d inv_c = _mm256_lookup_table_pd(_mm256_log_table_inv, index);
+	const __m256d log_c_hi = _mm256_lookup_table_pd(_mm256_log_table_hi, index);
+	const __m256d log_c_lo = _mm256_lookup_table_pd(_mm256_log_table_lo, index);
+
+	/* r = (m - c) / c = r_hi + r_lo, where m - c is exact */
+	const __m256d d = _mm256_sub_pd(m, c);
+	const __m256d r_hi = _mm256_mul_pd(d, inv_c);
+	__m256d prod_lo;
+	const __m256d prod_hi = _mm256_two_prod_pd(r_hi, c, &prod_lo);
+	const __m256d r_lo = _mm256_mul_pd(
+		_mm256_sub_pd(_mm256_sub_pd(d, prod_hi), prod_lo), inv_c
+	);
+
+	/* log1p(r) = r - r^2/2 + r^3 * poly(r) */
+	const __m256d r_squared = _mm256_square_pd(r_hi);
+	const __m256d poly = _mm256_sub_pd(
+		_mm256_mul_pd(_mm256_mul_pd(r_squared, r_hi), _mm256_horner_pd(r_hi, log1p_coef, 6)),
+		_mm256_mul_pd(r_squared, _mm256_set1_pd(0.5))
+	);
+
+	/* e * ln2_hi + log_c_hi + r_hi, with the rounding errors kept */
+	__m256d err_0, err_1;
+	__m256d sum = _mm256_two_sum_pd(_mm256_mul_pd(e, ln2_hi), log_c_hi, &err_0);
+	sum = _mm256_two_sum_pd(sum, r_hi, &err_1);
+	__m256d sum_lo = _mm256_add_pd(
+		_mm256_add_pd(_mm256_mul_pd(e, ln2_lo), log_c_lo),
+		_mm256_add_pd(r_lo, poly)
+	);
+	sum_lo = _mm256_add_pd(sum_lo, _mm256_add_pd(err_0, err_1));
+
+	*ret_hi = _mm256_add_pd(sum, sum_lo);
+	*ret_lo = _mm256_sub_pd(sum_lo, _mm256_sub_pd(*ret_hi, sum));
+}
+
+/**
+ * @brief Applies the special cases of log(x) to ret.
+ */
+static inline __m256d _mm256_log_special_pd(__m256d ret, const __m256d x) {
+	// log(+inf) = +inf
+	ret = _mm256_blendv_pd(ret, x,
+		_mm256_cmp_pd(x, _mm256_get_infinity_pd(), _CMP_EQ_OQ)
+	);
+	// log(0.0) = -inf
+	ret = _mm256_blendv_pd(ret, _mm256_negate_pd(_mm256_get_infinity_pd()),
+		_mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_EQ_OQ)
+	);
+	// log(x < 0.0) = NaN, and propagates NaN
+	ret = _mm256_blendv_pd(ret, _mm256_get_qNaN_pd(),
+		_mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_NGE_UQ)
+	);
 	return ret;
 }
 
 __m256d _mm256_log_pd(const __m256d x) {
-	// extract the exponent, and multiply by ln(2)
-	__m256d guess = _mm256_mul_pd(
-		_mm256_cvtepi32_pd(_mm256_ilogb_pd_epi32(x)), _mm256_const_ln2_pd()
-	);
-	// 6 iterations should yield the full precision of ieee doubles
-	for (int i = 0; i < 6; i++) {
-		guess = _mm256_sub_pd(_mm256_add_pd(
-			guess,
-			_mm256_mul_pd(x, _mm256_exp_pd(_mm256_negate_pd(guess)))
-		), _mm256_set1_pd(1.0));
-	}
-	return guess;
+	__m256d ret_hi, ret_lo;
+	_mm256_log_kernel_pd(x, &ret_hi, &ret_lo);
+	return _mm256_log_special_pd(ret_hi, x);
 }
 
+/**
+ * @brief log1p(x) = log(1 + x) + (x - ((1 + x) - 1)) / (1 + x)
+ * @details The second term corrects for the rounding of 1 + x.
+ */
+__m256d _mm256_log1p_pd(const __m256d x) {
+	const __m256d u = _mm256_add_pd(x, _mm256_set1_pd(1.0));
+	__m256d ret = _mm256_log_pd(u);
+	__m256d correction = _mm256_div_pd(
+		_mm256_sub_pd(x, _mm256_sub_pd(u, _mm256_set1_pd(1.0))), u
+	);
+	// inf - inf and 0 / 0
+	correction = _mm256_andnot_pd(_mm256_isnan_pd(correction), correction);
+	ret = _mm256_add_pd(ret, correction);
+	// log1p(+-0.0) = +-0.0 and avoids underflow
+	return _mm256_blendv_pd(ret, x,
+		_mm256_cmp_pd(u, _mm256_set1_pd(1.0), _CMP_EQ_OQ)
+	);
+}
+
+/**
+ * @brief Computes exp(x_hi + x_lo) = exp(x_hi) * (1 + x_lo) where
+ * |x_lo| <= ulp(x_hi)
+ */
+static inline __m256d _mm256_exp_dd_pd(const __m256d x_hi, const __m256d x_lo) {
+	const __m256d exp_hi = _mm256_exp_pd(x_hi);
+	const __m256d ret = _mm256_add_pd(exp_hi, _mm256_mul_pd(exp_hi, x_lo));
+	// Avoids inf * 0.0 and inf - inf
+	return _mm256_blendv_pd(ret, exp_hi, _mm256_isinf_pd(exp_hi));
+}
+
+/**
+ * @brief pow(x, y) = exp(y * log(x))
+ *
+ * @details log(x) is computed to roughly 70 bits, and y * log(x) is
+ * computed exactly as a double-double, so that the error in exp(y * log(x))
+ * does not grow with the size of y * log(x).
+ */
 __m256d _mm256_pow_pd(const __m256d x, const __m256d y) {
-	double x_val[4];
-	double y_val[4];
-	_mm256_store_pd(x_val, x);
-	_mm256_store_pd(y_val, y);
-	x_val[0] = pow(x_val[0], y_val[0]);
-	x_val[1] = pow(x_val[1], y_val[1]);
-	x_val[2] = pow(x_val[2], y_val[2]);
-	x_val[3] = pow(x_val[3], y_val[3]);
-	return _mm256_load_pd(x_val);
+	const __m256d abs_x = _mm256_fabs_pd(x);
+	__m256d log_hi, log_lo;
+	_mm256_log_kernel_pd(abs_x, &log_hi, &log_lo);
+	log_hi = _mm256_log_special_pd(log_hi, abs_x);
+
+	/* y * log(x) = prod_hi + prod_lo */
+	__m256d prod_lo;
+	__m256d prod_hi = _mm256_two_prod_pd(y, log_hi, &prod_lo);
+	prod_lo = _mm256_add_pd(prod_lo, _mm256_mul_pd(y, log_lo));
+	// inf - inf and inf * 0.0 when the product is infinite
+	prod_lo = _mm256_andnot_pd(_mm256_isnan_pd(prod_lo), prod_lo);
+	const __m256d sum = _mm256_add_pd(prod_hi, prod_lo);
+	prod_lo = _mm256_sub_pd(prod_lo, _mm256_sub_pd(sum, prod_hi));
+	prod_lo = _mm256_andnot_pd(_mm256_isnan_pd(prod_lo), prod_lo);
+
+	__m256d ret = _mm256_exp_dd_pd(sum, prod_lo);
+
+	/* Sign and domain of x < 0.0 */
+	const __m256d y_isint = _mm256_isint_pd(y);
+	const __m256d y_isodd = _mm256_andnot_pd(
+		_mm256_isint_pd(_mm256_mul_pd(y, _mm256_set1_pd(0.5))), y_isint
+	);
+	ret = _mm256_xor_pd(ret, _mm256_and_pd(
+		_mm256_and_pd(x, _mm256_get_sign_mask_pd()), y_isodd
+	));
+	const __m256d x_isneg = _mm256_and_pd(
+		_mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_LT_OQ), _mm256_isfinite_pd(x)
+	);
+	ret = _mm256_blendv_pd(ret, _mm256_get_qNaN_pd(),
+		_mm256_andnot_pd(y_isint, x_isneg)
+	);
+
+	/* pow(x, +-0.0) = 1.0, pow(1.0, y) = 1.0, and pow(-1.0, +-inf) = 1.0 */
+	const __m256d ret_one = _mm256_or_pd(_mm256_or_pd(
+		_mm256_cmp_pd(y, _mm256_setzero_pd(), _CMP_EQ_OQ),
+		_mm256_cmp_pd(x, _mm256_set1_pd(1.0), _CMP_EQ_OQ)
+	), _mm256_and_pd(
+		_mm256_cmp_pd(abs_x, _mm256_set1_pd(1.0), _CMP_EQ_OQ),
+		_mm256_isinf_pd(y)
+	));
+	return _mm256_blendv_pd(ret, _mm256_set1_pd(1.0), ret_one);
 }
 
 //------------------------------------------------------------------------------
 // __m256d trigonometry
 //------------------------------------------------------------------------------
 
+/**
+ * @brief Computes sin(x) and cos(x) for |x| <= pi/4
+ *
+ * @author Polynomial coefficients are taken from fdlibm k_sin.c and k_cos.c
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ * Developed at SunSoft, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ */
+static inline void _mm256_sincos_taylor_pd(
+	const __m256d x, __m256d* const p_sin, __m256d* const p_cos
+) {
+	static const double sin_coef[6] = {
+		-1.66666666666666324348e-01, +8.33333333332248946124e-03,
+		-1.98412698298579493134e-04, +2.75573137070700676789e-06,
+		-2.50507602534068634195e-08, +1.58969099521155010221e-10
+	};
+	static const double cos_coef[6] = {
+		+4.16666666666666019037e-02, -1.38888888888741095749e-03,
+		+2.48015872894767294178e-05, -2.75573143513906633035e-07,
+		+2.08757232129817482790e-09, -1.13596475577881948265e-11
+	};
+	const __m256d z = _mm256_square_pd(x);
+	*p_sin = _mm256_add_pd(x, _mm256_mul_pd(
+		_mm256_mul_pd(x, z), _mm256_horner_pd(z, sin_coef, 6)
+	));
+	/* cos(x) = 1 - z/2 + z^2 * poly(z), rounding 1 - z/2 carefully */
+	const __m256d half_z = _mm256_mul_pd(z, _mm256_set1_pd(0.5));
+	const __m256d w = _mm256_sub_pd(_mm256_set1_pd(1.0), half_z);
+	*p_cos = _mm256_add_pd(w, _mm256_add_pd(
+		_mm256_sub_pd(_mm256_sub_pd(_mm256_set1_pd(1.0), w), half_z),
+		_mm256_mul_pd(_mm256_square_pd(z), _mm256_horner_pd(z, cos_coef, 6))
+	));
+}
+
+/**
+ * @brief Computes sin(x) and cos(x) for all four lanes at once.
+ *
+ * @details x is reduced to x = r + n * (pi/2) with |r| <= pi/4 using a
+ * Cody-Waite reduction with a four part pi/2. The first three parts have 33
+ * bits, so n * part is exact for |n| < 2^20. Lanes outside of that range
+ * fall back to libm.
+ */
+static inline void _mm256_sincos_kernel_pd(
+	const __m256d x, __m256d* const p_sin, __m256d* const p_cos
+) {
+	const __m256d pio2_1 = _mm256_set1_pd(+0x1.921fb54400000p+0);
+	const __m256d pio2_2 = _mm256_set1_pd(+0x1.0b4611a600000p-34);
+	const __m256d pio2_3 = _mm256_set1_pd(+0x1.3198a2e000000p-69);
+	const __m256d pio2_4 = _mm256_set1_pd(+0x1.b839a252049c1p-104);
+	const __m256d inv_pio2 = _mm256_set1_pd(+0x1.45f306dc9c883p-1);
+
+	const __m256d n = _mm256_round_pd(
+		_mm256_mul_pd(x, inv_pio2), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC
+	);
+	__m256d r = _mm256_sub_pd(x, _mm256_mul_pd(n, pio2_1));
+	r = _mm256_sub_pd(r, _mm256_mul_pd(n, pio2_2));
+	r = _mm256_sub_pd(r, _mm256_mul_pd(n, pio2_3));
+	r = _mm256_sub_pd(r, _mm256_mul_pd(n, pio2_4));
+
+	__m256d sin_val, cos_val;
+	_mm256_sincos_taylor_pd(r, &sin_val, &cos_val);
+
+	/* Applies the quadrant (n mod 4) */
+	const __m256d quadrant = _mm256_sub_pd(n, _mm256_mul_pd(
+		_mm256_floor_pd(_mm256_mul_pd(n, _mm256_set1_pd(0.25))), _mm256_set1_pd(4.0)
+	));
+	const __m256d quadrant_1 = _mm256_cmp_pd(quadrant, _mm256_set1_pd(1.0), _CMP_EQ_OQ);
+	const __m256d quadrant_2 = _mm256_cmp_pd(quadrant, _mm256_set1_pd(2.0), _CMP_EQ_OQ);
+	const __m256d quadrant_3 = _mm256_cmp_pd(quadrant, _mm256_set1_pd(3.0), _CMP_EQ_OQ);
+	const __m256d swap = _mm256_or_pd(quadrant_1, quadrant_3);
+	const __m256d sign_mask = _mm256_get_sign_mask_pd();
+
+	__m256d ret_sin = _mm256_blendv_pd(sin_val, cos_val, swap);
+	__m256d ret_cos = _mm256_blendv_pd(cos_val, sin_val, swap);
+	ret_sin = _mm256_xor_pd(ret_sin,
+		_mm256_and_pd(_mm256_or_pd(quadrant_2, quadrant_3), sign_mask)
+	);
+	ret_cos = _mm256_xor_pd(ret_cos,
+		_mm256_and_pd(_mm256_or_pd(quadrant_1, quadrant_2), sign_mask)
+	);
+
+	/* |x| >= 2^20 and infinity */
+	const __m256d x_large = _mm256_cmp_pd(
+		_mm256_fabs_pd(x), _mm256_set1_pd(0x1.0p+20), _CMP_GE_OQ
+	);
+	const int large_mask = _mm256_movemask_pd(x_large);
+	if (large_mask != 0x0) {
+		double val[4];
+		double sin_large[4];
+		double cos_large[4];
+		_mm256_storeu_pd(val, x);
+		_mm256_storeu_pd(sin_large, ret_sin);
+		_mm256_storeu_pd(cos_large, ret_cos);
+		for (int i = 0; i < 4; i++) {
+			if (large_mask & (1 << i)) {
+				sin_large[i] = sin(val[i]);
+				cos_large[i] = cos(val[i]);
+			}
+		}
+		ret_sin = _mm256_loadu_pd(sin_large);
+		ret_cos = _mm256_loadu_pd(cos_large);
+	}
+	*p_sin = ret_sin;
+	*p_cos = ret_cos;
+}
+
 __m256d _mm256_sin_pd(const __m256d x) {
-	double val[4];
-	_mm256_store_pd(val, x);
-	val[0] = sin(val[0]);
-	val[1] = sin(val[1]);
-	val[2] = sin(val[2]);
-	val[3] = sin(val[3]);
-	return _mm256_load_pd(val);
+	__m256d ret_sin, ret_cos;
+	_mm256_sincos_kernel_pd(x, &ret_sin, &ret_cos);
+	return ret_sin;
 }
 
 __m256d _mm256_cos_pd(const __m256d x) {
-	double val[4];
-	_mm256_store_pd(val, x);
-	val[0] = cos(val[0]);
-	val[1] = cos(val[1]);
-	val[2] = cos(val[2]);
-	val[3] = cos(val[3]);
-	return _mm256_load_pd(val);
+	__m256d ret_sin, ret_cos;
+	_mm256_sincos_kernel_pd(x, &ret_sin, &ret_cos);
+	return ret_cos;
 }
 
 __m256d _mm256_sincos_pd(__m256d* const p_cos, const __m256d theta) {
-	double val[4];
-	double sin_val[4];
-	double cos_val[4];
-	_mm256_store_pd(val, theta);
-	sin_val[0] = sin(val[0]);
-	sin_val[1] = sin(val[1]);
-	sin_val[2] = sin(val[2]);
-	sin_val[3] = sin(val[3]);
-	cos_val[0] = cos(val[0]);
-	cos_val[1] = cos(val[1]);
-	cos_val[2] = cos(val[2]);
-	cos_val[3] = cos(val[3]);
-	*p_cos = _mm256_load_pd(cos_val);
-	return _mm256_load_pd(sin_val);
+	__m256d ret_sin;
+	_mm256_sincos_kernel_pd(theta, &ret_sin, p_cos);
+	return ret_sin;
 }
 
-__m256d _mm256_asin_pd(const __m256d x) {
-	double val[4];
-	_mm256_store_pd(val, x);
-	val[0] = asin(val[0]);
-	val[1] = asin(val[1]);
-	val[2] = asin(val[2]);
-	val[3] = asin(val[3]);
-	return _mm256_load_pd(val);
-}
+/**
+ * @brief atan(i/2 + ...) break points used by _mm256_atan_kernel_pd, split
+ * into two doubles. The first entry is used when |x| < 7/16.
+ */
+static const double _mm256_atan_table_hi[5] = {
+	+0x0.0p+0, +0x1.dac670561bb4fp-2, +0x1.921fb54442d18p-1, +0x1.f730bd281f69bp-1, +0x1.921fb54442d18p+0
+};
 
-__m256d _mm256_acos_pd(const __m256d x) {
-	double val[4];
-	_mm256_store_pd(val, x);
-	val[0] = acos(val[0]);
-	val[1] = acos(val[1]);
-	val[2] = acos(val[2]);
-	val[3] = acos(val[3]);
-	return _mm256_load_pd(val);
+static const double _mm256_atan_table_lo[5] = {
+	+0x0.0p+0, +0x1.a2b7f222f65e2p-56, +0x1.1a62633145c07p-55, +0x1.007887af0cbbdp-56, +0x1.1a62633145c07p-54
+};
+
+/**
+ * @brief Computes atan(x) for x >= 0.0
+ *
+ * @author Algorithm and coefficients are taken from fdlibm s_atan.c
+ * Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+ * Developed at SunPro, a Sun Microsystems, Inc. business.
+ * Permission to use, copy, modify, and distribute this
+ * software is freely granted, provided that this notice
+ * is preserved.
+ */
+static inline __m256d _mm256_atan_kernel_pd(const __m256d x) {
+	/* Coefficients for the even and odd powers of t^2 */
+	static const double coef_even[6] = {
+		+3.33333333333329318027e-01, +1.42857142725034663711e-01,
+		+9.09088713343650656196e-02, +6.66107313738753120669e-02,
+		+4.97687799461593236017e-02, +1.62858201153657823623e-02
+	};
+	static const double coef_odd[5] = {
+		-1.99999999998764832476e-01, -1.11111104054623557880e-01,
+		-7.69187620504482999495e-02, -5.83357013379057348645e-02,
+		-3.65315727442169155270e-02
+	};
+	const __m256d one = _mm256_set1_pd(1.0);
+	/**
+	 * [0, 7/16)      atan(x)
+	 * [7/16, 11/16)  atan(1/2) + atan((2x - 1) / (2 + x))
+	 * [11/16, 19/16) atan(1)   + atan((x - 1) / (x + 1))
+	 * [19/16, 39/16) atan(3/2) + atan((x - 3/2) / (1 + 3x/2))
+	 * [39/16, inf]   atan(inf) + atan(-1 / x)
+	 */
+	const __m256d range_1 = _mm256_cmp_pd(x, _mm256_set1_pd( 7.0 / 16.0), _CMP_GE_OQ);
+	const __m256d range_2 = _mm256_cmp_pd(x, _mm256_set1_pd(11.0 / 16.0), _CMP_GE_OQ);
+	const __m256d range_3 = _mm256_cmp_pd(x, _mm256_set1_pd(19.0 / 16.0), _CMP_GE_OQ);
+	const __m256d range_4 = _mm256_cmp_pd(x, _mm256_set1_pd(39.0 / 16.0), _CMP_GE_OQ);
+
+	__m256d num = x;
+	__m256d den = one;
+	num = _mm256_blendv_pd(num, _mm256_sub_pd(_mm256_add_pd(x, x), one), range_1);
+	den = _mm256_blendv_pd(den, _mm256_add_pd(x, _mm256_set1_pd(2.0)), range_1);
+	num = _mm256_blendv_pd(num, _mm256_sub_pd(x, one), range_2);
+	den = _mm256_blendv_pd(den, _mm256_add_pd(x, one), range_2);
+	num = _mm256_blendv_pd(num, _mm256_sub_pd(x, _mm256_set1_pd(1.5)), range_3);
+	den = _mm256_blendv_pd(den, _mm256_add_pd(
+		_mm256_mul_pd(x, _mm256_set1_pd(1.5)), one
+	), range_3);
+	num = _mm256_blendv_pd(num, _mm256_set1_pd(-1.0), range_4);
+	den = _mm256_blendv_pd(den, x, range_4);
+	const __m256d t = _mm256_div_pd(num, den);
+
+	const __m256d index_pd = _mm256_add_pd(
+		_mm256_add_pd(_mm256_and_pd(range_1, one), _mm256_and_pd(range_2, one)),
+		_mm256_add_pd(_mm256_and_pd(range_3, one), _mm256_and_pd(range_4, one))
+	);
+	const __m128i index = _mm256_cvtpd_epi32(index_pd);
+
+	const __m256d z = _mm256_square_pd(t);
+	const __m256d w = _mm256_square_pd(z);
+	const __m256d s = _mm256_add_pd(
+		_mm256_mul_pd(z, _mm256_horner_pd(w, coef_even, 6)),
+		_mm256_mul_pd(w, _mm256_horner_pd(w, coef_odd, 5))
+	);
+	/* hi - ((t * s - lo) - t) */
+	return _mm256_sub_pd(
+		_mm256_lookup_table_pd(_mm256_atan_table_hi, index),
+		_mm256_sub_pd(_mm256_sub_pd(
+			_mm256_mul_pd(t, s), _mm256_lookup_table_pd(_mm256_atan_table_lo, index)
+		), t)
+	);
 }
 
 __m256d _mm256_atan_pd(const __m256d x) {
-	double val[4];
-	_mm256_store_pd(val, x);
-	val[0] = atan(val[0]);
-	val[1] = atan(val[1]);
-	val[2] = atan(val[2]);
-	val[3] = atan(val[3]);
-	return _mm256_load_pd(val);
+	const __m256d ret = _mm256_atan_kernel_pd(_mm256_fabs_pd(x));
+	// atan(-x) = -atan(x)
+	return _mm256_xor_pd(ret, _mm256_and_pd(x, _mm256_get_sign_mask_pd()));
 }
 
 __m256d _mm256_atan2_pd(const __m256d y, const __m256d x) {
-	double y_val[4];
-	double x_val[4];
-	_mm256_store_pd(y_val, y);
-	_mm256_store_pd(x_val, x);
-	y_val[0] = atan2(y_val[0], x_val[0]);
-	y_val[1] = atan2(y_val[1], x_val[1]);
-	y_val[2] = atan2(y_val[2], x_val[2]);
-	y_val[3] = atan2(y_val[3], x_val[3]);
-	return _mm256_load_pd(y_val);
+	const __m256d pi_hi   = _mm256_set1_pd(+0x1.921fb54442d18p+1);
+	const __m256d pi_lo   = _mm256_set1_pd(+0x1.1a62633145c07p-53);
+	const __m256d pio2_hi = _mm256_set1_pd(+0x1.921fb54442d18p+0);
+	const __m256d pio2_lo = _mm256_set1_pd(+0x1.1a62633145c07p-54);
+
+	const __m256d abs_x = _mm256_fabs_pd(x);
+	const __m256d abs_y = _mm256_fabs_pd(y);
+	/* atan(|y| / |x|) or pi/2 - atan(|x| / |y|) so that the quotient is <= 1 */
+	const __m256d swap = _mm256_cmp_pd(abs_y, abs_x, _CMP_GT_OQ);
+	const __m256d num = _mm256_blendv_pd(abs_y, abs_x, swap);
+	const __m256d den = _mm256_blendv_pd(abs_x, abs_y, swap);
+	__m256d t = _mm256_div_pd(num, den);
+	// atan2(+-0.0, +-0.0)
+	t = _mm256_blendv_pd(t, _mm256_setzero_pd(),
+		_mm256_cmp_pd(den, _mm256_setzero_pd(), _CMP_EQ_OQ)
+	);
+	// atan2(+-inf, +-inf)
+	t = _mm256_blendv_pd(t, _mm256_set1_pd(1.0),
+		_mm256_and_pd(_mm256_isinf_pd(x), _mm256_isinf_pd(y))
+	);
+
+	/**
+	 * x >= 0.0 : 0    + atan(t) or pi/2 - atan(t)
+	 * x <= -0.0: pi   - atan(t) or pi/2 + atan(t)
+	 */
+	// copysign(1.0, x) < 0.0
+	const __m256d x_isneg = _mm256_cmp_pd(
+		_mm256_or_pd(_mm256_and_pd(x, _mm256_get_sign_mask_pd()), _mm256_set1_pd(1.0)),
+		_mm256_setzero_pd(), _CMP_LT_OQ
+	);
+	const __m256d negate = _mm256_xor_pd(swap, x_isneg);
+	__m256d offset_hi = _mm256_blendv_pd(_mm256_setzero_pd(), pi_hi, x_isneg);
+	__m256d offset_lo = _mm256_blendv_pd(_mm256_setzero_pd(), pi_lo, x_isneg);
+	offset_hi = _mm256_blendv_pd(offset_hi, pio2_hi, swap);
+	offset_lo = _mm256_blendv_pd(offset_lo, pio2_lo, swap);
+	__m256d ret = _mm256_atan_kernel_pd(t);
+	ret = _mm256_xor_pd(ret, _mm256_and_pd(negate, _mm256_get_sign_mask_pd()));
+	ret = _mm256_add_pd(offset_hi, _mm256_add_pd(ret, offset_lo));
+	ret = _mm256_xor_pd(ret, _mm256_and_pd(y, _mm256_get_sign_mask_pd()));
+	// Propagates NaN
+	return _mm256_blendv_pd(ret, _mm256_add_pd(x, y),
+		_mm256_or_pd(_mm256_isnan_pd(x), _mm256_isnan_pd(y))
+	);
 }
 
-__m256d _mm256_sinh_pd(const __m256d x) {
-	double val[4];
-	_mm256_store_pd(val, x);
-	val[0] = sinh(val[0]);
-	val[1] = sinh(val[1]);
-	val[2] = sinh(val[2]);
-	val[3] = sinh(val[3]);
-	return _mm256_load_pd(val);
+/**
+ * @brief Computes sqrt(1 - x^2) as sqrt((1 - x) * (1 + x)) to avoid
+ * cancellation when |x| is close to 1.
+ */
+static inline __m256d _mm256_sqrt_one_minus_square_pd(const __m256d x) {
+	const __m256d one = _mm256_set1_pd(1.0);
+	return _mm256_sqrt_pd(_mm256_mul_pd(
+		_mm256_sub_pd(one, x), _mm256_add_pd(one, x)
+	));
 }
 
-__m256d _mm256_tanh_pd(const __m256d x) {
-	double val[4];
-	_mm256_store_pd(val, x);
-	val[0] = tanh(val[0]);
-	val[1] = tanh(val[1]);
-	val[2] = tanh(val[2]);
-	val[3] = tanh(val[3]);
-	return _mm256_load_pd(val);
+__m256d _mm256_asin_pd(const __m256d x) {
+	// |x| > 1.0 returns NaN from the square root
+	return _mm256_atan2_pd(x, _mm256_sqrt_one_minus_square_pd(x));
 }
 
+__m256d _mm256_acos_pd(const __m256d x) {
+	// |x| > 1.0 returns NaN from the square root
+	return _mm256_atan2_pd(_mm256_sqrt_one_minus_square_pd(x), x);
+}
+
+/**
+ * @brief sinh(|x|) = (expm1(|x|) + expm1(|x|) / exp(|x|)) / 2
+ * cosh(|x|) = (exp(|x|) + 1 / exp(|x|)) / 2
+ */
 __m256d _mm256_sinhcosh_pd(__m256d* const p_cosh, const __m256d theta) {
-	double val[4];
-	double sinh_val[4];
-	double cosh_val[4];
-	_mm256_store_pd(val, theta);
-	sinh_val[0] = sinh(val[0]);
-	sinh_val[1] = sinh(val[1]);
-	sinh_val[2] = sinh(val[2]);
-	sinh_val[3] = sinh(val[3]);
-	cosh_val[0] = cosh(val[0]);
-	cosh_val[1] = cosh(val[1]);
-	cosh_val[2] = cosh(val[2]);
-	cosh_val[3] = cosh(val[3]);
-	*p_cosh = _mm256_load_pd(cosh_val);
-	return _mm256_load_pd(sinh_val);
+	const __m256d half = _mm256_set1_pd(0.5);
+	const __m256d abs_x = _mm256_fabs_pd(theta);
+	const __m256d x_expm1 = _mm256_expm1_pd(abs_x);
+	const __m256d x_exp = _mm256_add_pd(x_expm1, _mm256_set1_pd(1.0));
+	const __m256d recip_exp = _mm256_recip_pd(x_exp);
+
+	__m256d ret_sinh = _mm256_mul_pd(
+		_mm256_add_pd(x_expm1, _mm256_mul_pd(x_expm1, recip_exp)), half
+	);
+	__m256d ret_cosh = _mm256_mul_pd(_mm256_add_pd(x_exp, recip_exp), half);
+
+	/* exp(|x|) / 2 = exp(|x| / 2) * (exp(|x| / 2) / 2) avoids overflow */
+	const __m256d exp_half = _mm256_exp_pd(_mm256_mul_pd(abs_x, half));
+	const __m256d ret_large = _mm256_mul_pd(_mm256_mul_pd(exp_half, half), exp_half);
+	const __m256d x_large = _mm256_cmp_pd(abs_x, _mm256_set1_pd(709.0), _CMP_GT_OQ);
+	ret_sinh = _mm256_blendv_pd(ret_sinh, ret_large, x_large);
+	ret_cosh = _mm256_blendv_pd(ret_cosh, ret_large, x_large);
+
+	// sinh(-x) = -sinh(x)
+	ret_sinh = _mm256_xor_pd(ret_sinh, _mm256_and_pd(theta, _mm256_get_sign_mask_pd()));
+	*p_cosh = ret_cosh;
+	return ret_sinh;
+}
+
+__m256d _mm256_sinh_pd(const __m256d x) {
+	__m256d ret_cosh;
+	return _mm256_sinhcosh_pd(&ret_cosh, x);
+}
+
+__m256d _mm256_cosh_pd(const __m256d x) {
+	__m256d ret_cosh;
+	_mm256_sinhcosh_pd(&ret_cosh, x);
+	return ret_cosh;
+}
+
+/**
+ * @brief tanh(|x|) = expm1(2|x|) / (expm1(2|x|) + 2)
+ */
+__m256d _mm256_tanh_pd(const __m256d x) {
+	const __m256d abs_x = _mm256_fabs_pd(x);
+	const __m256d x_expm1 = _mm256_expm1_pd(_mm256_add_pd(abs_x, abs_x));
+	__m256d ret = _mm256_div_pd(x_expm1, _mm256_add_pd(x_expm1, _mm256_set1_pd(2.0)));
+	// 1.0 - tanh(22.0) is below 2^-54, and avoids inf / inf
+	ret = _mm256_blendv_pd(ret, _mm256_set1_pd(1.0),
+		_mm256_cmp_pd(abs_x, _mm256_set1_pd(22.0), _CMP_GT_OQ)
+	);
+	// tanh(-x) = -tanh(x)
+	return _mm256_xor_pd(ret, _mm256_and_pd(x, _mm256_get_sign_mask_pd()));
 }
 
 //------------------------------------------------------------------------------
 // __m256d transcendental functions
 //------------------------------------------------------------------------------
 
+/**
+ * @brief Computes sin(pi * x) without the rounding error of pi * x growing
+ * with the size of x.
+ */
+static inline __m256d _mm256_sinpi_kernel_pd(const __m256d x) {
+	const __m256d n = _mm256_round_pd(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+	// |r| <= 0.5 is exact
+	const __m256d r = _mm256_sub_pd(x, n);
+	__m256d ret = _mm256_sin_pd(_mm256_mul_pd(r, _mm256_const_pi_pd()));
+	// sin(pi * (r + n)) = (-1)^n * sin(pi * r)
+	const __m256d n_isodd = _mm256_andnot_pd(
+		_mm256_isint_pd(_mm256_mul_pd(n, _mm256_set1_pd(0.5))), _mm256_isfinite_pd(n)
+	);
+	return _mm256_xor_pd(ret, _mm256_and_pd(n_isodd, _mm256_get_sign_mask_pd()));
+}
+
+/**
+ * @brief Computes lgamma(x) for x inside [1.0, 2.0] as
+ * (x - 1) * (x - 2) * poly(2x - 3)
+ * @note x_m1 = x - 1 and x_m2 = x - 2 are passed in so that they can be
+ * computed exactly by the caller.
+ */
+static inline __m256d _mm256_lgamma_kernel_pd(const __m256d x_m1, const __m256d x_m2) {
+	static const double lgamma_coef[20] = {
+		+0x1.eeb95b094c191p-2,
+		-0x1.2aed059bd608ap-4,
+		+0x1.01af62a292e9ep-6,
+		-0x1.007aa83cee7e5p-8,
+		+0x1.13342351dde0fp-10,
+		-0x1.34dbda13c8fa0p-12,
+		+0x1.64f066cdbffa0p-14,
+		-0x1.a50352d82388ep-16,
+		+0x1.f81485f78bbd0p-18,
+		-0x1.313e688773355p-19,
+		+0x1.7510a4178474dp-21,
+		-0x1.cb4cc1c288e9ep-23,
+		+0x1.1c0dd4afb9573p-24,
+		-0x1.61af5dcde0802p-26,
+		+0x1.c3ca9686347cfp-28,
+		-0x1.1bbedb9aeb43dp-29,
+		+0x1.25823abba02b4p-31,
+		-0x1.72274bc432ce1p-33,
+		+0x1.db79b9599b3a6p-34,
+		-0x1.2eb5136d557dbp-35
+	};
+	const __m256d t = _mm256_add_pd(x_m1, x_m2);
+	return _mm256_mul_pd(
+		_mm256_mul_pd(x_m1, x_m2), _mm256_horner_pd(t, lgamma_coef, 20)
+	);
+}
+
+/**
+ * @brief Shifts x inside [0.5, 10.0) to w inside [1.0, 2.0), where
+ * Gamma(x) = Gamma(w) * prod, or Gamma(x) = Gamma(w) / prod when x < 1.0
+ *
+ * @details Returns lgamma(w). w - 1 and w - 2 are computed exactly, since
+ * x + 1 would round when x < 1.0
+ */
+static inline __m256d _mm256_gamma_reduce_pd(
+	const __m256d x, __m256d* const p_prod, __m256d* const p_isrecip
+) {
+	const __m256d one = _mm256_set1_pd(1.0);
+	const __m256d two = _mm256_set1_pd(2.0);
+	/* Gamma(x) = Gamma(x + 1) / x for x < 1.0 */
+	const __m256d x_isrecip = _mm256_cmp_pd(x, one, _CMP_LT_OQ);
+	__m256d w = _mm256_blendv_pd(x, _mm256_add_pd(x, one), x_isrecip);
+	__m256d prod = _mm256_blendv_pd(one, x, x_isrecip);
+	/* Gamma(w) = Gamma(w - 1) * (w - 1) for w >= 2.0 */
+	for (int i = 0; i < 8; i++) {
+		const __m256d w_large = _mm256_cmp_pd(w, two, _CMP_GE_OQ);
+		w = _mm256_blendv_pd(w, _mm256_sub_pd(w, one), w_large);
+		prod = _mm256_blendv_pd(prod, _mm256_mul_pd(prod, w), w_large);
+	}
+	*p_prod = prod;
+	*p_isrecip = x_isrecip;
+	const __m256d w_m1 = _mm256_blendv_pd(_mm256_sub_pd(w, one), x, x_isrecip);
+	const __m256d w_m2 = _mm256_blendv_pd(_mm256_sub_pd(w, two), _mm256_sub_pd(x, one), x_isrecip);
+	return _mm256_lgamma_kernel_pd(w_m1, w_m2);
+}
+
+/**
+ * @brief Stirling series
+ * lgamma(x) = (x - 0.5) * log(x) - x + log(2pi)/2 + 1/(12x) - 1/(360x^3) ...
+ * @note Used for x >= 10.0
+ */
+static inline __m256d _mm256_stirling_series_pd(const __m256d x) {
+	static const double stirling_coef[8] = {
+		+0x1.5555555555555p-4,
+		-0x1.6c16c16c16c17p-9,
+		+0x1.a01a01a01a01ap-11,
+		-0x1.3813813813814p-11,
+		+0x1.b951e2b18ff23p-11,
+		-0x1.f6ab0d9993c7dp-10,
+		+0x1.a41a41a41a41ap-8,
+		-0x1.e4286cb0f5398p-6
+	};
+	const __m256d inv_x = _mm256_recip_pd(x);
+	return _mm256_mul_pd(inv_x,
+		_mm256_horner_pd(_mm256_square_pd(inv_x), stirling_coef, 8)
+	);
+}
+
 __m256d _mm256_tgamma_pd(const __m256d x) {
-	double val[4];
-	_mm256_store_pd(val, x);
-	val[0] = tgamma(val[0]);
-	val[1] = tgamma(val[1]);
-	val[2] = tgamma(val[2]);
-	val[3] = tgamma(val[3]);
-	return _mm256_load_pd(val);
+	const __m256d half = _mm256_set1_pd(0.5);
+	/**
+	 * Gamma(x) = pi / (sin(pi * x) * Gamma(1 - x)) for x < 0.5
+	 * Gamma(1 - x) = -x * Gamma(-x) is used for x < -0.5, since 1 - x would
+	 * round.
+	 */
+	const __m256d x_reflect = _mm256_cmp_pd(x, half, _CMP_LT_OQ);
+	const __m256d x_negate = _mm256_cmp_pd(x, _mm256_negate_pd(half), _CMP_LT_OQ);
+	__m256d y = _mm256_blendv_pd(x, _mm256_sub_pd(_mm256_set1_pd(1.0), x), x_reflect);
+	y = _mm256_blendv_pd(y, _mm256_negate_pd(x), x_negate);
+
+	/* [0.5, 10.0) */
+	__m256d prod, y_isrecip;
+	__m256d ret_small = _mm256_exp_pd(_mm256_gamma_reduce_pd(
+		_mm256_min_pd(y, _mm256_set1_pd(10.0)), &prod, &y_isrecip
+	));
+	ret_small = _mm256_blendv_pd(
+		_mm256_mul_pd(ret_small, prod), _mm256_div_pd(ret_small, prod), y_isrecip
+	);
+
+	/**
+	 * [10.0, 172.0]
+	 * Gamma(y) = sqrt(2pi) * exp((y - 0.5) * log(y) - y + series)
+	 * The exponent is computed as a double-double, since the rounding error
+	 * of a double would be scaled by exp.
+	 */
+	const __m256d y_large = _mm256_min_pd(
+		_mm256_max_pd(y, _mm256_set1_pd(10.0)), _mm256_set1_pd(172.0)
+	);
+	__m256d log_hi, log_lo;
+	_mm256_log_kernel_pd(y_large, &log_hi, &log_lo);
+	// y - 0.5 is exact
+	const __m256d y_m_half = _mm256_sub_pd(y_large, half);
+	__m256d expon_lo, sum_err;
+	__m256d expon_hi = _mm256_two_prod_pd(y_m_half, log_hi, &expon_lo);
+	expon_lo = _mm256_add_pd(expon_lo, _mm256_mul_pd(y_m_half, log_lo));
+	expon_hi = _mm256_two_sum_pd(expon_hi, _mm256_negate_pd(y_large), &sum_err);
+	expon_lo = _mm256_add_pd(_mm256_add_pd(expon_lo, sum_err),
+		_mm256_stirling_series_pd(y_large)
+	);
+	const __m256d expon = _mm256_add_pd(expon_hi, expon_lo);
+	expon_lo = _mm256_sub_pd(expon_lo, _mm256_sub_pd(expon, expon_hi));
+	const __m256d ret_large = _mm256_mul_pd(
+		_mm256_exp_dd_pd(expon, expon_lo),
+		_mm256_set1_pd(+0x1.40d931ff62706p+1) // sqrt(2pi)
+	);
+
+	__m256d ret = _mm256_blendv_pd(ret_small, ret_large,
+		_mm256_cmp_pd(y, _mm256_set1_pd(10.0), _CMP_GE_OQ)
+	);
+	// Gamma(x) overflows for x > 171.62
+	ret = _mm256_blendv_pd(ret, _mm256_get_infinity_pd(),
+		_mm256_cmp_pd(y, _mm256_set1_pd(172.0), _CMP_GT_OQ)
+	);
+
+	/* Reflection */
+	__m256d sinpi_x = _mm256_sinpi_kernel_pd(x);
+	sinpi_x = _mm256_blendv_pd(sinpi_x, _mm256_mul_pd(sinpi_x, y), x_negate);
+	const __m256d ret_reflect = _mm256_div_pd(
+		_mm256_const_pi_pd(), _mm256_mul_pd(sinpi_x, ret)
+	);
+	ret = _mm256_blendv_pd(ret, ret_reflect, x_reflect);
+
+	// tgamma(+-0.0) = +-inf
+	ret = _mm256_blendv_pd(ret,
+		_mm256_or_pd(_mm256_get_infinity_pd(), _mm256_and_pd(x, _mm256_get_sign_mask_pd())),
+		_mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_EQ_OQ)
+	);
+	// tgamma(x) = NaN for negative integers and -inf
+	ret = _mm256_blendv_pd(ret, _mm256_get_qNaN_pd(), _mm256_and_pd(
+		_mm256_isint_pd(x), _mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_LT_OQ)
+	));
+	// Propagates NaN
+	return _mm256_blendv_pd(ret, x, _mm256_isnan_pd(x));
 }
 
+/**
+ * @brief The roots of lgamma(x) inside (-10.0, -2.0) as double-doubles.
+ * lgamma(x) = log(pi / |sin(pi * x)|) - lgamma(1 - x) cancels near the roots,
+ * so x within _mm256_lgamma_root_radius of a root uses
+ * lgamma(x) = t * poly(t) where t = x - root.
+ */
+static const double _mm256_lgamma_root[16][2] = {
+	{-0x1.3a7fc9600f86cp+1, -0x1.55f64f98af8d0p-55},
+	{-0x1.5fb410a1bd901p+1, +0x1.a19a96d2e6f85p-54},
+	{-0x1.9260dbc9e59afp+1, -0x1.f717cd335a7b3p-53},
+	{-0x1.fa471547c2fe5p+1, -0x1.70d4561291237p-56},
+	{-0x1.0284e78599581p+2, +0x1.e78c1e9e43cfep-53},
+	{-0x1.3f7577a6eeafdp+2, +0x1.5de5eab7f12cfp-53},
+	{-0x1.4086a57f0b6d9p+2, -0x1.95262b72ca9cap-55},
+	{-0x1.7fe92f591f40dp+2, -0x1.7dd4ed62cbd32p-52},
+	{-0x1.8016b25897c8dp+2, +0x1.27e0f49a4ba72p-54},
+	{-0x1.bffcbf76b86f0p+2, +0x1.853b29347b806p-57},
+	{-0x1.c0033fdedfe1fp+2, +0x1.20bb7d2324678p-52},
+	{-0x1.ffff97f8159cfp+2, -0x1.e54f415a91586p-55},
+	{-0x1.000034028b3f9p+3, -0x1.f60cb3cec1cedp-52},
+	{-0x1.1ffffa3884bd0p+3, -0x1.ff90c9d2ae925p-53},
+	{-0x1.200005c7768fbp+3, -0x1.b5b610ffb70d4p-54},
+	{-0x1.3fffff6c0d7c0p+3, +0x1.197cea8c42d7dp-51}
+};
+/** @brief 1/8th of the distance from each root to the nearest integer */
+static const double _mm256_lgamma_root_radius[16] = {
+	+0x1.d3fe4b007c361p-5,
+	+0x1.025f7af2137fap-5,
+	+0x1.260dbc9e59af8p-6,
+	+0x1.6e3aae0f406bdp-8,
+	+0x1.4273c2ccac062p-8,
+	+0x1.1510b222a0657p-10,
+	+0x1.0d4afe16db219p-10,
+	+0x1.6d0a6e0bf2a09p-13,
+	+0x1.6b25897c8ced8p-13,
+	+0x1.a044a3c880185p-16,
+	+0x1.9fef6ff0f5be9p-16,
+	+0x1.a01fa98c3c356p-19,
+	+0x1.a01459fc9f60dp-19,
+	+0x1.71ded0bf801bdp-22,
+	+0x1.71dda3ec36b6cp-22,
+	+0x1.27e50808cbe75p-25
+};
+/** @brief Taylor series of lgamma(root + t) / t */
+static const double _mm256_lgamma_root_coef[16][19] = {
+	/* -2.4570247382 */ {
+		+0x1.83fe966af535fp+0, +0x1.36eebb002f55dp+2, +0x1.694a6058a7858p+0, +0x1.1718d7ca09e5bp+3,
+		+0x1.7339fe04b2764p+2, +0x1.8d32f682aa0bdp+4, +0x1.809f04ee6e0fap+4, +0x1.48eaa81657361p+6,
+		+0x1.9297adb2def5ap+6, +0x1.286fb8cbaebb3p+8, +0x1.a92e0a5de4bf8p+8, +0x1.1a9d4d8c62a7fp+10,
+		+0x1.c4cd2594e7015p+10, +0x1.18737ec8c5674p+12, +0x1.e602879652df6p+12, +0x1.1eacaecbf98b0p+14,
+		+0x1.06bcea0337924p+15, +0x1.2bb10938de2a6p+16, +0x1.1dffffc809619p+17
+	},
+	/* -2.7476826467 */ {
+		-0x1.ea12da904b18cp+0, +0x1.3267f3c265a52p+3, -0x1.4185ac30c8bf2p+4, +0x1.f504accc9f19bp+5,
+		-0x1.8588458207eacp+7, +0x1.4373f7cc709b3p+9, -0x1.12239bdd6c013p+11, +0x1.dba65e27421c4p+12,
+		-0x1.a2d2504d7e987p+14, +0x1.7581739ee6087p+16, -0x1.506c65fad617ep+18, +0x1.318ef724f780ep+20,
+		-0x1.17767260da07ap+22, +0x1.011e34454c6c3p+24, -0x1.db8b9e6a8c538p+25, +0x1.b9bab1f9b6834p+27,
+		-0x1.9bed47276f3fdp+29, +0x1.81780ebc26f0ep+31, -0x1.69d3c3d06ea2ap+33
+	},
+	/* -3.1435808883 */ {
+		+0x1.f20a65f2fac55p+2, +0x1.9d4d2977150efp+4, +0x1.c1137124d5c5bp+6, +0x1.267203d776b0ep+9,
+		+0x1.99a6337da39ddp+11, +0x1.293c3f78d3bdbp+14, +0x1.bb97aa0b71e45p+16, +0x1.51ea3345f5349p+19,
+		+0x1.057f65c64b21bp+22, +0x1.99c8650e3a38bp+24, +0x1.44520c3a4bb84p+27, +0x1.02d2219647af7p+30,
+		+0x1.9ffcd984abdd5p+32, +0x1.50494b0fb07d3p+35, +0x1.113fdd5c69526p+38, +0x1.be0a490c4df0cp+40,
+		+0x1.6d79c294fad34p+43, +0x1.2c80a95baf903p+46, +0x1.efb0bc8c60f24p+48
+	},
+	/* -3.9552942849 */ {
+		-0x1.4b99d966c5647p+4, +0x1.f76deae0436bep+7, -0x1.d25359d4b2f38p+11, +0x1.e8f829f141aa5p+15,
+		-0x1.116f7806d26d3p+20, +0x1.3e8f3ab9fc1f4p+24, -0x1.7dbbe062ffd9ep+28, +0x1.d2f76de7bd027p+32,
+		-0x1.2225fe4f8493dp+37, +0x1.6d12ae1936a57p+41, -0x1.cffc2a8f5fd74p+45, +0x1.294e1bddb6102p+50,
+		-0x1.7fab626523b36p+54, +0x1.f211ab5311400p+58, -0x1.44f2935b0d559p+63, +0x1.a9e4dda1fa758p+67,
+		-0x1.1831c904dee78p+72, +0x1.71f55d099ee18p+76, -0x1.e9fde7b7f7589p+80
+	},
+	/* -4.0393618397 */ {
+		+0x1.aca5cf4921642p+4, +0x1.44415cd813f8ep+8, +0x1.559b11b2a9c7cp+12, +0x1.96d18e21aebdbp+16,
+		+0x1.0261eb5732e40p+21, +0x1.55e3dbf99eb3dp+25, +0x1.d14fe49c4e437p+29, +0x1.433dce282da6ep+34,
+		+0x1.c8399c7588cd0p+38, +0x1.45fbe666d9402p+43, +0x1.d68d794caefcep+47, +0x1.56729dc75f00cp+52,
+		+0x1.f5ec3352c68c7p+56, +0x1.720575617731cp+61, +0x1.122e774adbf8cp+66, +0x1.982505251d81ep+70,
+		+0x1.30f8cb66574ffp+75, +0x1.c95779d27e83cp+79, +0x1.57fb1ced57c1dp+84
+	},
+	/* -4.9915446406 */ {
+		-0x1.d224a3ef9e41fp+6, +0x1.b533c678a3956p+12, -0x1.0d3f7fee65d34p+19, +0x1.752a6f5ac2726p+25,
+		-0x1.13d5d163bd3f7p+32, +0x1.a8c5c53458ca5p+38, -0x1.5068b3ed69409p+45, +0x1.0ffa575ea7fe9p+52,
+		-0x1.bec12dd78a14bp+58, +0x1.7382570f089d4p+65, -0x1.380ebf618414ep+72, +0x1.084de4426e886p+79,
+		-0x1.c2d90d8b990e9p+85, +0x1.82d0a2bda7309p+92, -0x1.4d941707780bcp+99, +0x1.20f3f9c92a5e8p+106,
+		-0x1.f68edeceb3e4cp+112, +0x1.b68d3198a8ef1p+119, -0x1.7fe1bc42d03a1p+126
+	},
+	/* -5.0082181683 */ {
+		+0x1.ed72e0829ae02p+6, +0x1.cecc32ec22f9bp+12, +0x1.253d8563f7264p+19, +0x1.a225df2da6e63p+25,
+		+0x1.3e01773762671p+32, +0x1.f7d8d5bdcb186p+38, +0x1.9a8d00c77a92cp+45, +0x1.557fd8c490b4bp+52,
+		+0x1.209221a6240a0p+59, +0x1.edc98d3bbb5dap+65, +0x1.aabd28e6f7c6bp+72, +0x1.73de2dd9728eep+79,
+		+0x1.465182ebf6449p+86, +0x1.200d7ad1db285p+93, +0x1.ff27fe506ad9ep+99, +0x1.c78dd75474154p+106,
+		+0x1.9797a1ff28289p+113, +0x1.6df243043de45p+120, +0x1.4992a02ca6af1p+127
+	},
+	/* -5.9986074801 */ {
+		-0x1.661f6a43a5e12p+9, +0x1.f79dcb794f26fp+17, -0x1.d6e8088a19ffep+26, +0x1.ef5d308dbfc97p+35,
+		-0x1.15ea6b0ab529ep+45, +0x1.44d54e9fe2397p+54, -0x1.8684e40cebb3dp+63, +0x1.df44c1d81c723p+72,
+		-0x1.2ac3053f4ee19p+82, +0x1.79226ae04a7a4p+91, -0x1.e0dffb5f77a15p+100, +0x1.352178907a204p+110,
+		-0x1.903aa9af8baf3p+119, +0x1.04a1032c75e6ep+129, -0x1.552efbfef36bdp+138, +0x1.c0a12fef24050p+147,
+		-0x1.281cf56357003p+157, +0x1.883ff0616e794p+166, -0x1.049a7e039cda5p+176
+	},
+	/* -6.0013852945 */ {
+		+0x1.69de49e3af2aap+9, +0x1.fce23484cfd10p+17, +0x1.de503a3c37c40p+26, +0x1.f9c7b52558abbp+35,
+		+0x1.1d3d50714416ap+45, +0x1.4f21e2fb9e060p+54, +0x1.9500994cd8a9ep+63, +0x1.f3a2c23c19d79p+72,
+		+0x1.39152652eb3abp+82, +0x1.8d45f8be8912ep+91, +0x1.fd3214a70281fp+100, +0x1.490b47682046dp+110,
+		+0x1.ac3b9652b43f1p+119, +0x1.1851c435e895cp+129, +0x1.70dfb5065b675p+138, +0x1.e791f4585a172p+147,
+		+0x1.437e70afcdf58p+157, +0x1.aec150a4d4de7p+166, +0x1.1fadae58d1bcap+176
+	},
+	/* -6.9998015079 */ {
+		-0x1.3abf7a5cea91bp+12, +0x1.8349a2550422dp+23, -0x1.3d91dadc98428p+35, +0x1.24f3d636f3339p+47,
+		-0x1.20427df1b3492p+59, +0x1.2775e857fb69cp+71, -0x1.377e70b463c13p+83, +0x1.4f3d28edba5cdp+95,
+		-0x1.6e8557168cf8ep+107, +0x1.95bb17ce4279bp+119, -0x1.c5ac12d48f08ep+131, +0x1.ff816dad7515cp+143,
+		-0x1.225f4a6a494c5p+156, +0x1.4ba3e5c03fddfp+168, -0x1.7cb737da558d6p+180, +0x1.b7011fbab594ep+192,
+		-0x1.fc33d1e2031d6p+204, +0x1.272cdde38c75ap+217, -0x1.57f3456aca08bp+229
+	},
+	/* -7.0001983334 */ {
+		+0x1.3b407aa387bd1p+12, +0x1.83e85daafbad6p+23, +0x1.3e552b5e3c226p+35, +0x1.25e42a45e905bp+47,
+		+0x1.216a3560743eep+59, +0x1.28e1c70ef5313p+71, +0x1.393e2bc330081p+83, +0x1.5164141f5ae6ap+95,
+		+0x1.712b3a86e1be0p+107, +0x1.98fd36b906d52p+119, +0x1.c9ae6ef62604ap+131, +0x1.02382a95938fcp+144,
+		+0x1.256845ecbeb17p+156, +0x1.4f5ff358f4caep+168, +0x1.814f9cbfb69aep+180, +0x1.bca8a41a47672p+192,
+		+0x1.019479082f294p+205, +0x1.2b74ad631f92ep+217, +0x1.5d37a2004c585p+229
+	},
+	/* -7.9999751971 */ {
+		-0x1.3af76fe4c2fabp+15, +0x1.838e76caaf123p+29, -0x1.3de68b3256526p+44, +0x1.255c052530c71p+59,
+		-0x1.20c2a8418126ap+74, +0x1.28139342cef00p+89, -0x1.384066c322246p+104, +0x1.502bc4dad47d3p+119,
+		-0x1.6faadfece0e2fp+134, +0x1.9724323c8991ep+149, -0x1.c7684c96f2617p+164, +0x1.00d1f4874360ap+180,
+		-0x1.23af6dd4635e3p+195, +0x1.4d41695948489p+210, -0x1.7eb3eb486c004p+225, +0x1.b972ec3a26abdp+240,
+		-0x1.ff35abe012e90p+255, +0x1.2906660d21163p+271, -0x1.5a39ce3047ce9p+286
+	},
+	/* -8.0000248003 */ {
+		+0x1.3b088fed67718p+15, +0x1.83a3893550edcp+29, +0x1.3e0078db8ada4p+44, +0x1.257bec9464251p+59,
+		+0x1.20e9ea0755a47p+74, +0x1.2843e1313c83bp+89, +0x1.387bd6a785478p+104, +0x1.5074e788de770p+119,
+		+0x1.7004dd990d7d9p+134, +0x1.9792ed5f6dfc9p+149, +0x1.c7f08cdaef517p+164, +0x1.0125c811215a5p+180,
+		+0x1.2416931f15426p+195, +0x1.4dc0543c441a3p+210, +0x1.7f50164dd19c1p+225, +0x1.ba331529ed6a5p+240,
+		+0x1.00110f1fa573dp+256, +0x1.2997de6ad4e7bp+271, +0x1.5aeccd4bbcdf4p+286
+	},
+	/* -8.9999972443 */ {
+		-0x1.625edfc63db2fp+18, +0x1.ea8c150480a7ap+35, -0x1.c4b30e4bc55c1p+53, +0x1.d5fe468dbbf03p+71,
+		-0x1.043d21bc24decp+90, +0x1.2c334ae535e1dp+108, -0x1.64314b431cd64p+126, +0x1.af6ed589b3a86p+144,
+		-0x1.096e446edcfb3p+163, +0x1.4aaf49e713c02p+181, -0x1.a0246d9c1b687p+199, +0x1.0806315c1aa49p+218,
+		-0x1.515dd6b889a42p+236, +0x1.b1a5fe767c44bp+254, -0x1.18222955c5804p+273, +0x1.6b8b3180efb2ep+291,
+		-0x1.d9a3c5a532222p+309, +0x1.359c2851f3f32p+328, -0x1.9606c2f7e1f9dp+346
+	},
+	/* -9.0000027557 */ {
+		+0x1.6261203919440p+18, +0x1.ea8f32fb7f586p+35, +0x1.c4b75ee68e2bap+53, +0x1.d6043fa1ffaa5p+71,
+		+0x1.04414411db7f4p+90, +0x1.2c3903ec9c90cp+108, +0x1.64393744bb9bdp+126, +0x1.af79ccdc71d33p+144,
+		+0x1.0975db7d71fc6p+163, +0x1.4ab9cba1e346ep+181, +0x1.a032f8f11473dp+199, +0x1.0810426bfac85p+218,
+		+0x1.516bc616e3904p+236, +0x1.b1b948b0b8090p+254, +0x1.182f8345f3c60p+273, +0x1.6b9dace0c9cc7p+291,
+		+0x1.d9bd5b2e01bd0p+309, +0x1.35addd8195315p+328, +0x1.961f4627b0e20p+346
+	},
+	/* -9.9999997244 */ {
+		-0x1.baf7da5f3795dp+21, +0x1.7f3e8791fa0d2p+42, -0x1.ba18befcaaa63p+63, +0x1.1ede14765dc0cp+85,
+		-0x1.8d1a9ab5a5050p+106, +0x1.1e4d8c35d22ccp+128, -0x1.a8a191db10900p+149, +0x1.4174f65ff8680p+171,
+		-0x1.ee6d90f2332c5p+192, +0x1.80fd3420fba1dp+214, -0x1.2ecd481762ff2p+236, +0x1.e04a0b28da2b0p+257,
+		-0x1.7f91af3f00393p+279, +0x1.342652fd50c8cp+301, -0x1.f1a88f83f11a9p+322, +0x1.93a6874ce10a9p+344,
+		-0x1.48af445c01ea7p+366, +0x1.0c921ae53b628p+388, -0x1.b842de1ec9297p+409
+	}
+};
+
 __m256d _mm256_lgamma_pd(const __m256d x) {
-	double val[4];
-	_mm256_store_pd(val, x);
-	val[0] = lgamma(val[0]);
-	val[1] = lgamma(val[1]);
-	val[2] = lgamma(val[2]);
-	val[3] = lgamma(val[3]);
-	return _mm256_load_pd(val);
+	const __m256d half = _mm256_set1_pd(0.5);
+	/**
+	 * lgamma(x) = log(pi / |sin(pi * x)|) - lgamma(1 - x) for x < 0.5
+	 * lgamma(1 - x) = log(-x) + lgamma(-x) is used for x < -0.5, since 1 - x
+	 * would round.
+	 */
+	const __m256d x_reflect = _mm256_cmp_pd(x, half, _CMP_LT_OQ);
+	const __m256d x_negate = _mm256_cmp_pd(x, _mm256_negate_pd(half), _CMP_LT_OQ);
+	__m256d y = _mm256_blendv_pd(x, _mm256_sub_pd(_mm256_set1_pd(1.0), x), x_reflect);
+	y = _mm256_blendv_pd(y, _mm256_negate_pd(x), x_negate);
+
+	/* [0.5, 10.0) */
+	__m256d prod, y_isrecip;
+	__m256d ret_small = _mm256_gamma_reduce_pd(
+		_mm256_min_pd(y, _mm256_set1_pd(10.0)), &prod, &y_isrecip
+	);
+	ret_small = _mm256_add_pd(ret_small, _mm256_xor_pd(_mm256_log_pd(prod),
+		_mm256_and_pd(y_isrecip, _mm256_get_sign_mask_pd())
+	));
+
+	/* [10.0, inf] */
+	const __m256d y_large = _mm256_max_pd(y, _mm256_set1_pd(10.0));
+	__m256d ret_large = _mm256_sub_pd(
+		_mm256_mul_pd(_mm256_sub_pd(y_large, half), _mm256_log_pd(y_large)), y_large
+	);
+	ret_large = _mm256_add_pd(ret_large, _mm256_add_pd(
+		_mm256_set1_pd(+0x1.d67f1c864beb5p-1), // log(2pi) / 2
+		_mm256_stirling_series_pd(y_large)
+	));
+	// Avoids inf - inf
+	ret_large = _mm256_blendv_pd(ret_large, y_large, _mm256_isinf_pd(y_large));
+
+	__m256d ret = _mm256_blendv_pd(ret_small, ret_large,
+		_mm256_cmp_pd(y, _mm256_set1_pd(10.0), _CMP_GE_OQ)
+	);
+
+	/* Reflection */
+	__m256d sinpi_x = _mm256_fabs_pd(_mm256_sinpi_kernel_pd(x));
+	sinpi_x = _mm256_blendv_pd(sinpi_x, _mm256_mul_pd(sinpi_x, y), x_negate);
+	const __m256d ret_reflect = _mm256_sub_pd(_mm256_log_pd(
+		_mm256_div_pd(_mm256_const_pi_pd(), sinpi_x)
+	), ret);
+	ret = _mm256_blendv_pd(ret, ret_reflect, x_reflect);
+
+	/* Roots inside (-10.0, -2.0) */
+	if (_mm256_movemask_pd(_mm256_cmp_pd(x, _mm256_set1_pd(-2.0), _CMP_LT_OQ)) != 0) {
+		for (int i = 0; i < 16; i++) {
+			// x - root_hi is exact
+			const __m256d t = _mm256_sub_pd(
+				_mm256_sub_pd(x, _mm256_set1_pd(_mm256_lgamma_root[i][0])),
+				_mm256_set1_pd(_mm256_lgamma_root[i][1])
+			);
+			const __m256d x_near_root = _mm256_cmp_pd(_mm256_fabs_pd(t),
+				_mm256_set1_pd(_mm256_lgamma_root_radius[i]), _CMP_LT_OQ
+			);
+			if (_mm256_movemask_pd(x_near_root) == 0) {
+				continue;
+			}
+			ret = _mm256_blendv_pd(ret, _mm256_mul_pd(
+				t, _mm256_horner_pd(t, _mm256_lgamma_root_coef[i], 19)
+			), x_near_root);
+		}
+	}
+
+	// lgamma(x) = -log(|x|) for tiny x, where 1 / x would overflow
+	ret = _mm256_blendv_pd(ret, _mm256_negate_pd(_mm256_log_pd(_mm256_fabs_pd(x))),
+		_mm256_cmp_pd(_mm256_fabs_pd(x), _mm256_set1_pd(0x1.0p-54), _CMP_LT_OQ)
+	);
+
+	// lgamma(x) = +inf for +-0.0, negative integers, and +-inf
+	ret = _mm256_blendv_pd(ret, _mm256_get_infinity_pd(), _mm256_or_pd(
+		_mm256_and_pd(_mm256_isint_pd(x), _mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_LE_OQ)),
+		_mm256_isinf_pd(x)
+	));
+	// Propagates NaN
+	return _mm256_blendv_pd(ret, x, _mm256_isnan_pd(x));
+}
+
+/**
+ * @brief erf(x) = x * poly(x^2) for |x| <= 1.0
+ */
+static inline __m256d _mm256_erf_kernel_pd(const __m256d x) {
+	static const double erf_coef[13] = {
+		+0x1.20dd750429b6dp+0,
+		-0x1.812746b0379e6p-2,
+		+0x1.ce2f21a042b30p-4,
+		-0x1.b82ce31284e00p-6,
+		+0x1.565bcd0dbaa38p-8,
+		-0x1.c02db3dac435fp-11,
+		+0x1.f9a321d5b8e1ep-14,
+		-0x1.f4d1e3183f7aep-17,
+		+0x1.b9df224ca4b97p-20,
+		-0x1.5f1ecb6f0764cp-23,
+		+0x1.f7b4bf3b13964p-27,
+		-0x1.389d4f2641625p-30,
+		+0x1.05ffd737fb32ep-34
+	};
+	return _mm256_mul_pd(x, _mm256_horner_pd(_mm256_square_pd(x), erf_coef, 13));
+}
+
+/**
+ * @brief Chebyshev fits of x * exp(x^2) * erfc(x) in terms of s = 1/x for
+ * s inside [1/32, 1/4], [1/4, 1/2], [1/2, 1], and [1, 2].
+ */
+static const double _mm256_erfc_table[4][18] = {
+	/* [0.03125, 0.25] */ {
+		+0x1.1e16f3e421bc4p-1, -0x1.0ca105e86d194p-7, -0x1.743a87bfb2ba9p-9,
+		+0x1.02fd42d89fb07p-12, +0x1.c62c0dcd78e61p-16, -0x1.ffea2c1c7768ep-18,
+		+0x1.3188ba2145700p-23, +0x1.c26a700317303p-23, -0x1.266ebd4f29d33p-25,
+		-0x1.70827ee16d7d5p-29, +0x1.044db92576775p-29, -0x1.ea9aec60a7d9cp-33,
+		-0x1.b8ac2722f6c36p-35, +0x1.874c0b6952f83p-36, -0x1.1028b6816c3f8p-39,
+		-0x1.f2c0da82f0f28p-41, +0x1.265d353298651p-42, -0x1.63800f6fed03dp-48
+	},
+	/* [0.25, 0.5] */ {
+		+0x1.0fcced7e1e7c8p-1, -0x1.367279608aefep-6, -0x1.78feec12540f7p-10,
+		+0x1.6b0b80c99484bp-12, -0x1.dc4a70137bca5p-16, -0x1.35b947fc102d3p-20,
+		+0x1.91e7801ce5de0p-21, -0x1.05d22813c8746p-23, +0x1.16c3e02029c79p-27,
+		+0x1.5cbe3c00c2f9dp-30, -0x1.1c3335255f136p-31, +0x1.8fe7158f5f478p-34,
+		-0x1.1202857e7cfe5p-37, -0x1.b49bf6f1db987p-41, +0x1.0758bca4a5cf7p-41,
+		-0x1.d947a37b324bcp-44, +0x1.a67bc018c248cp-47, +0x1.3933562c1885ep-52
+	},
+	/* [0.5, 1] */ {
+		+0x1.df6a7891d7325p-2, -0x1.5a4720afb6ebcp-5, +0x1.3cfedc0bfe6dbp-10,
+		+0x1.4a14f6e4a6decp-11, -0x1.9d6a514f55cdcp-13, +0x1.34bef97c0e9f3p-15,
+		-0x1.28d3f1c9e1f99p-18, +0x1.2606c88c55973p-25, +0x1.6cac095b76bfep-23,
+		-0x1.09dee193c9b99p-24, +0x1.02691c858716bp-26, -0x1.7bb91c16a4328p-29,
+		+0x1.70ebc63beed5cp-32, +0x1.881cf9a70eb7fp-38, -0x1.4a592f10bf895p-36,
+		+0x1.0a8cc8b5b9f42p-37, -0x1.59ece07a1ef2fp-39, +0x1.168ab801387bep-41
+	},
+	/* [1, 2] */ {
+		+0x1.7026c7fe254efp-2, -0x1.e4f552d9716d5p-5, +0x1.0f9f2a7f714b3p-7,
+		-0x1.84d69756a32d9p-11, -0x1.31542d41308b6p-14, +0x1.0e7e636b0479fp-14,
+		-0x1.875199e98f5b0p-16, +0x1.bbd99dc563d23p-18, -0x1.b2e3445123d00p-20,
+		+0x1.74e878b581f1fp-22, -0x1.0bf7ae01597e0p-24, +0x1.067e546ed583bp-27,
+		+0x1.a7a289dd48dcfp-32, -0x1.795a7b2428d17p-31, +0x1.3e011af051754p-32,
+		-0x1.c8c5590150a4bp-34, +0x1.88b5a4fd62262p-35, -0x1.9a0604d76ddcap-37
+	}
+};
+
+/**
+ * @brief Computes erfc(x) for x inside [0.5, 32.0]
+ * erfc(x) = exp(-x^2) * poly(1/x) / x
+ */
+static inline __m256d _mm256_erfc_kernel_pd(const __m256d x) {
+	static const double range_mid[4] = {
+		+0x1.2000000000000p-3, +0x1.8000000000000p-2,
+		+0x1.8000000000000p-1, +0x1.8000000000000p+0
+	};
+	static const double range_inv_half[4] = {
+		+0x1.2492492492492p+3, +0x1.0000000000000p+3,
+		+0x1.0000000000000p+2, +0x1.0000000000000p+1
+	};
+	const __m256d one = _mm256_set1_pd(1.0);
+	const __m256d s = _mm256_recip_pd(x);
+	const __m256d index_pd = _mm256_add_pd(_mm256_add_pd(
+		_mm256_and_pd(_mm256_cmp_pd(s, _mm256_set1_pd(0.25), _CMP_GT_OQ), one),
+		_mm256_and_pd(_mm256_cmp_pd(s, _mm256_set1_pd(0.5 ), _CMP_GT_OQ), one)),
+		_mm256_and_pd(_mm256_cmp_pd(s, _mm256_set1_pd(1.0 ), _CMP_GT_OQ), one)
+	);
+	const __m128i index = _mm256_cvtpd_epi32(index_pd);
+	const __m256d t = _mm256_mul_pd(
+		_mm256_sub_pd(s, _mm256_lookup_table_pd(range_mid, index)),
+		_mm256_lookup_table_pd(range_inv_half, index)
+	);
+
+	const __m128i row = _mm_mullo_epi32(index, _mm_set1_epi32(18));
+	__m256d poly = _mm256_lookup_table_pd(&_mm256_erfc_table[0][17], row);
+	for (int i = 16; i >= 0; i--) {
+		poly = _mm256_add_pd(_mm256_mul_pd(poly, t),
+			_mm256_lookup_table_pd(&_mm256_erfc_table[0][i], row)
+		);
+	}
+
+	/**
+	 * exp(-x^2) = exp(-z^2) * exp((z - x) * (z + x)), where z is x rounded
+	 * to 21 bits so that z^2 is exact.
+	 */
+	const __m256d z = _mm256_and_pd(x,
+		_mm256_castsi256_pd(_mm256_set1_epi64x((int64_t)0xFFFFFFFF00000000))
+	);
+	const __m256d exp_x2 = _mm256_mul_pd(
+		_mm256_exp_pd(_mm256_negate_pd(_mm256_square_pd(z))),
+		_mm256_exp_pd(_mm256_mul_pd(_mm256_sub_pd(z, x), _mm256_add_pd(z, x)))
+	);
+	return _mm256_mul_pd(exp_x2, _mm256_mul_pd(poly, s));
 }
 
 __m256d _mm256_erf_pd(const __m256d x) {
-	double val[4];
-	_mm256_store_pd(val, x);
-	val[0] = erf(val[0]);
-	val[1] = erf(val[1]);
-	val[2] = erf(val[2]);
-	val[3] = erf(val[3]);
-	return _mm256_load_pd(val);
+	const __m256d abs_x = _mm256_fabs_pd(x);
+	const __m256d ret_small = _mm256_erf_kernel_pd(_mm256_min_pd(abs_x, _mm256_set1_pd(1.0)));
+	__m256d ret_large = _mm256_sub_pd(_mm256_set1_pd(1.0), _mm256_erfc_kernel_pd(
+		_mm256_min_pd(_mm256_max_pd(abs_x, _mm256_set1_pd(1.0)), _mm256_set1_pd(32.0))
+	));
+	__m256d ret = _mm256_blendv_pd(ret_small, ret_large,
+		_mm256_cmp_pd(abs_x, _mm256_set1_pd(1.0), _CMP_GT_OQ)
+	);
+	// erf(-x) = -erf(x)
+	ret = _mm256_xor_pd(ret, _mm256_and_pd(x, _mm256_get_sign_mask_pd()));
+	// Propagates NaN
+	return _mm256_blendv_pd(ret, x, _mm256_isnan_pd(x));
 }
 
 __m256d _mm256_erfc_pd(const __m256d x) {
-	double val[4];
-	_mm256_store_pd(val, x);
-	val[0] = erfc(val[0]);
-	val[1] = erfc(val[1]);
-	val[2] = erfc(val[2]);
-	val[3] = erfc(val[3]);
-	return _mm256_load_pd(val);
+	const __m256d one = _mm256_set1_pd(1.0);
+	const __m256d abs_x = _mm256_fabs_pd(x);
+	/* erfc(x) = 1 - erf(x) for |x| < 0.5 */
+	const __m256d ret_small = _mm256_sub_pd(one,
+		_mm256_erf_kernel_pd(_mm256_min_pd(_mm256_max_pd(x, _mm256_set1_pd(-0.5)), _mm256_set1_pd(0.5)))
+	);
+	__m256d ret_large = _mm256_erfc_kernel_pd(
+		_mm256_min_pd(_mm256_max_pd(abs_x, _mm256_set1_pd(0.5)), _mm256_set1_pd(32.0))
+	);
+	// erfc(x) underflows for x > 27.3
+	ret_large = _mm256_andnot_pd(
+		_mm256_cmp_pd(abs_x, _mm256_set1_pd(32.0), _CMP_GT_OQ), ret_large
+	);
+	// erfc(-x) = 2 - erfc(x)
+	ret_large = _mm256_blendv_pd(ret_large,
+		_mm256_sub_pd(_mm256_set1_pd(2.0), ret_large), x
+	);
+	__m256d ret = _mm256_blendv_pd(ret_small, ret_large,
+		_mm256_cmp_pd(abs_x, _mm256_set1_pd(0.5), _CMP_GE_OQ)
+	);
+	// Propagates NaN
+	return _mm256_blendv_pd(ret, x, _mm256_isnan_pd(x));
 }
 
 #endif
@@ -679,7 +679,7 @@ static inline __m256i _internal_mm256_ilogb_pd_epi64(__m256d x) {
 		bin_x = _mm256_slli_epi64(bin_x, 1);
 		// shift the exponent down
 		bin_x = _mm256_srli_epi64(bin_x, 52 + 1);
-		bin_x = _mm256_add_epi64(bin_x, _mm256_set1_epi64x(float64_bias));
+		bin_x = _mm256_sub_epi64(bin_x, _mm256_set1_epi64x(float64_bias));
 		
 		// subtracts the exponent shift used for denormal numbers
 		bin_x = _mm256_sub_epi64(bin_x,
@@ -737,7 +737,7 @@ static inline __m128i _mm256_ilogb_pd_epi32(__m256d x) {
 	static inline __m256i _mm256_ilogb_pd_epi64(__m256d x) {
 		__m128i part_0 = _mm_ilogb_pd_epi64(_mm256_extractf128_pd(x, 0));
 		__m128i part_1 = _mm_ilogb_pd_epi64(_mm256_extractf128_pd(x, 1));
-		return _mm256_set_m128i(part_0, part_1);
+		return _mm256_set_m128i(part_1, part_0);
 	}
 
 	/**
@@ -776,22 +776,22 @@ static inline __m256d _mm256_ldexp_pd_epi64(__m256d x, __m256i expon) {
 	{ /* multiplies by a large power of 2 */
 		__m256i test = _mm256_cmpgt_epi64(expon, _mm256_set1_epi64x(mult_2_power - 1));
 		x = _mm256_mul_pd(x, _mm256_blendv_pd(_mm256_set1_pd(1.0), mult_2_p896, _mm256_castsi256_pd(test)));
-		expon = _mm256_sub_epi64(expon, _mm256_set1_epi64x(mult_2_power));
+		expon = _mm256_sub_epi64(expon, _mm256_and_si256(test, _mm256_set1_epi64x(mult_2_power)));
 	}
 	{ /* multiplies by a large power of 2 */
 		__m256i test = _mm256_cmpgt_epi64(expon, _mm256_set1_epi64x(mult_2_power - 1));
 		x = _mm256_mul_pd(x, _mm256_blendv_pd(_mm256_set1_pd(1.0), mult_2_p896, _mm256_castsi256_pd(test)));
-		expon = _mm256_sub_epi64(expon, _mm256_set1_epi64x(mult_2_power));
+		expon = _mm256_sub_epi64(expon, _mm256_and_si256(test, _mm256_set1_epi64x(mult_2_power)));
 	}
 	{ /* divides by a large power of 2 */
 		__m256i test = _mm256_cmpgt_epi64(_mm256_set1_epi64x(-mult_2_power + 1), expon);
-		x = _mm256_mul_pd(x, _mm256_blendv_pd(mult_2_n896, _mm256_set1_pd(1.0), _mm256_castsi256_pd(test)));
-		expon = _mm256_add_epi64(expon, _mm256_set1_epi64x(mult_2_power));
+		x = _mm256_mul_pd(x, _mm256_blendv_pd(_mm256_set1_pd(1.0), mult_2_n896, _mm256_castsi256_pd(test)));
+		expon = _mm256_add_epi64(expon, _mm256_and_si256(test, _mm256_set1_epi64x(mult_2_power)));
 	}
 	{ /* divides by a large power of 2 */
 		__m256i test = _mm256_cmpgt_epi64(_mm256_set1_epi64x(-mult_2_power + 1), expon);
-		x = _mm256_mul_pd(x, _mm256_blendv_pd(mult_2_n896, _mm256_set1_pd(1.0), _mm256_castsi256_pd(test)));
-		expon = _mm256_add_epi64(expon, _mm256_set1_epi64x(mult_2_power));
+		x = _mm256_mul_pd(x, _mm256_blendv_pd(_mm256_set1_pd(1.0), mult_2_n896, _mm256_castsi256_pd(test)));
+		expon = _mm256_add_epi64(expon, _mm256_and_si256(test, _mm256_set1_epi64x(mult_2_power)));
 	}
 
 	/* multiplies by the remaining exponent */
@@ -816,7 +816,7 @@ static inline __m256d _mm256_ldexp_pd_epi32(__m256d x, __m128i expon) {
 static inline __m256d _mm256_ldexp_pd_epi64(__m256d x, __m256i expon) {
 	__m128d part_0 = _mm_ldexp_pd_epi64(_mm256_extractf128_pd(x, 0), _mm256_extractf128_si256(expon, 0));
 	__m128d part_1 = _mm_ldexp_pd_epi64(_mm256_extractf128_pd(x, 1), _mm256_extractf128_si256(expon, 1));
-	return _mm256_set_m128d(part_0, part_1);
+	return _mm256_set_m128d(part_1, part_0);
 }
 
 /**
@@ -826,10 +826,10 @@ static inline __m256d _mm256_ldexp_pd_epi32(__m256d x, __m128i expon) {
 	// Loads the lower half, extending each from int32_t to int64_t
 	__m128d part_0 = _mm_ldexp_pd_epi64(_mm256_extractf128_pd(x, 0), _mm_cvtepi32_epi64(expon));
 	// Copy the upper half to the lower half
-	expon = _mm_move_epi64(expon);
+	expon = _mm_unpackhi_epi64(expon, expon);
 	// Loads the upper half, extending each from int32_t to int64_t
 	__m128d part_1 = _mm_ldexp_pd_epi64(_mm256_extractf128_pd(x, 1), _mm_cvtepi32_epi64(expon));
-	return _mm256_set_m128d(part_0, part_1);
+	return _mm256_set_m128d(part_1, part_0);
 }
 
 #endif
@@ -887,9 +887,17 @@ static inline __m256d _mm256_frexp_pd_epi64(__m256d x, __m256i* const expon) {
 	 * Clears the exponent bits of x, then does a bitwise OR so that x will
 	 * be inside the range [0.5, 1.0)
 	 */
-	x = _mm256_andnot_pd(x, _mm256_get_exponent_mask_pd());
-	x = _mm256_or_pd(x, _mm256_set1_pd(0.5));
-	return x;
+	// 2 ^ +64, normalizes denormal numbers
+	const __m256d mult_2_p64 = _mm256_set1_pd(1.8446744073709551616e+19);
+	__m256d ret = _mm256_mul_pd(
+		x, _mm256_blendv_pd(_mm256_set1_pd(1.0), mult_2_p64, _mm256_isdenormal_pd(x))
+	);
+	ret = _mm256_andnot_pd(_mm256_get_exponent_mask_pd(), ret);
+	ret = _mm256_or_pd(ret, _mm256_set1_pd(0.5));
+	// if x is zero, NaN, or inf, x is returned instead
+	return _mm256_blendv_pd(x, ret, _mm256_andnot_pd(
+		_mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_EQ_OQ), _mm256_isfinite_pd(x)
+	));
 }
 
 #else
@@ -898,8 +906,8 @@ static inline __m256d _mm256_frexp_pd_epi64(__m256d x, __m256i* const expon) {
 	__m128i expon_0, expon_1;
 	__m128d part_0 = _mm_frexp_pd_epi64(_mm256_extractf128_pd(x, 0), &expon_0);
 	__m128d part_1 = _mm_frexp_pd_epi64(_mm256_extractf128_pd(x, 1), &expon_1);
-	*expon = _mm256_set_m128i(expon_0, expon_1);
-	return _mm256_set_m128d(part_0, part_1);
+	*expon = _mm256_set_m128i(expon_1, expon_0);
+	return _mm256_set_m128d(part_1, part_0);
 }
 
 #endif
@@ -910,11 +918,17 @@ static inline __m256d _mm256_frexp_pd_epi32(__m256d x, __m128i* const expon) {
 	 * Clears the exponent bits of x, then does a bitwise OR so that x will
 	 * be inside the range [0.5, 1.0)
 	 */
-	__m256d ret;
-	ret = _mm256_andnot_pd(x, _mm256_get_exponent_mask_pd());
+	// 2 ^ +64, normalizes denormal numbers
+	const __m256d mult_2_p64 = _mm256_set1_pd(1.8446744073709551616e+19);
+	__m256d ret = _mm256_mul_pd(
+		x, _mm256_blendv_pd(_mm256_set1_pd(1.0), mult_2_p64, _mm256_isdenormal_pd(x))
+	);
+	ret = _mm256_andnot_pd(_mm256_get_exponent_mask_pd(), ret);
 	ret = _mm256_or_pd(ret, _mm256_set1_pd(0.5));
-	// if x is NaN or inf, x is returned instead
-	return _mm256_blendv_pd(x, ret, _mm256_isfinite_pd(x));
+	// if x is zero, NaN, or inf, x is returned instead
+	return _mm256_blendv_pd(x, ret, _mm256_andnot_pd(
+		_mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_EQ_OQ), _mm256_isfinite_pd(x)
+	));
 }
 
 //------------------------------------------------------------------------------
@@ -960,7 +974,7 @@ static inline __m256d _mm256_nextafter_pd(__m256d x, __m256d y) {
 static inline __m256d _mm256_nextafter_pd(__m256d x, __m256d y) {
 	__m128d part_0 = _mm_nextafter_pd(_mm256_extractf128_pd(x, 0), _mm256_extractf128_pd(y, 0));
 	__m128d part_1 = _mm_nextafter_pd(_mm256_extractf128_pd(x, 1), _mm256_extractf128_pd(y, 1));
-	return _mm256_set_m128d(part_0, part_1);
+	return _mm256_set_m128d(part_1, part_0);
 }
 
 #endif
@@ -1042,124 +1056,122 @@ static inline __m256d _mm256_exp10_pd(const __m256d x) {
 
 __m256d _mm256_log_pd(__m256d x);
 
-/** @note This is not an accurate implementation of log1p */
-static inline __m256d _mm256_log1p_pd(__m256d x) {
-	return _mm256_log_pd(_mm256_add_pd(x, _mm256_set1_pd(1.0)));
-}
+__m256d _mm256_log1p_pd(__m256d x);
 
 static inline __m256d _mm256_log2_pd(const __m256d x) {
-	return _mm256_exp_pd(_mm256_mul_pd(x, _mm256_const_log2e_pd()));
+	return _mm256_mul_pd(_mm256_log_pd(x), _mm256_const_log2e_pd());
 }
 
 static inline __m256d _mm256_log10_pd(const __m256d x) {
-	return _mm256_exp_pd(_mm256_mul_pd(x, _mm256_const_log10e_pd()));
+	return _mm256_mul_pd(_mm256_log_pd(x), _mm256_const_log10e_pd());
 }
 
-/** @note This function doesn't use AVX for calculations */
 __m256d _mm256_pow_pd(__m256d x, __m256d y);
 
 //------------------------------------------------------------------------------
 // __m256d SVML Trigonometry
 //------------------------------------------------------------------------------
 
-/** @note This function doesn't use AVX for calculations */
+/** @note Lanes where |x| >= 2^20 fall back to libm */
 __m256d _mm256_sin_pd(__m256d x);
 
-/** @note This function doesn't use AVX for calculations */
+/** @note Lanes where |x| >= 2^20 fall back to libm */
 __m256d _mm256_cos_pd(__m256d x);
 
 /**
  * @brief returns sin by value, and cos by pointer.
  * @warning cos_ptr must be aligned on a 32-byte boundary or a
  * general-protection exception may be generated.
- * @note This function doesn't use AVX for calculations
  */
 __m256d _mm256_sincos_pd(__m256d* cos_ptr, __m256d theta);
 
-/** @note This function doesn't use AVX for calculations */
 static inline __m256d _mm256_tan_pd(__m256d theta) {
 	__m256d cos_val;
 	__m256d sin_val = _mm256_sincos_pd(&cos_val, theta);
 	return _mm256_div_pd(sin_val, cos_val);
 }
 
-/** @note This function doesn't use AVX for calculations */
 __m256d _mm256_asin_pd(__m256d x);
 
-/** @note This function doesn't use AVX for calculations */
 __m256d _mm256_acos_pd(__m256d x);
 
-/** @note This function doesn't use AVX for calculations */
 __m256d _mm256_atan_pd(__m256d x);
 
-/** @note This function doesn't use AVX for calculations */
 __m256d _mm256_atan2_pd(__m256d y, __m256d x);
 
 /**
- * @note This function doesn't use AVX for calculations
  * @remarks sinh is inaccurate when x is close to 0, which is why it isn't inlined
  */
 __m256d _mm256_sinh_pd(__m256d x);
 
-/** @note This function doesn't use AVX for calculations */
-static inline __m256d _mm256_cosh_pd(__m256d x) {
-	__m256d exp_x = _mm256_exp_pd(x);
-	return _mm256_mul_pd(
-		_mm256_add_pd(exp_x, _mm256_div_pd(_mm256_set1_pd(1.0), exp_x)),
-	_mm256_set1_pd(0.5));
-}
+__m256d _mm256_cosh_pd(__m256d x);
 
-/** @note This function doesn't use AVX for calculations */
 __m256d _mm256_tanh_pd(__m256d x);
 
 /**
  * @brief returns sinh by value, and cosh by pointer.
  * @warning cosh_ptr must be aligned on a 32-byte boundary or a
  * general-protection exception may be generated.
- * @note This function doesn't use AVX for calculations
  */
 __m256d _mm256_sinhcosh_pd(__m256d* cosh_ptr, __m256d theta);
 
-/** @note This function doesn't use AVX for calculations */
+/**
+ * @brief asinh(|x|) = log1p(|x| + x^2 / (1 + sqrt(x^2 + 1)))
+ */
 static inline __m256d _mm256_asinh_pd(__m256d x) {
-	return _mm256_log_pd(_mm256_add_pd(x,
-		_mm256_sqrt_pd(
-			_mm256_sub_pd(_mm256_square_pd(x), _mm256_set1_pd(1.0))
-		)
-	));
+	const __m256d abs_x = _mm256_fabs_pd(x);
+	const __m256d x_squared = _mm256_square_pd(abs_x);
+	__m256d ret = _mm256_log1p_pd(_mm256_add_pd(abs_x, _mm256_div_pd(
+		x_squared,
+		_mm256_add_pd(_mm256_sqrt_pd(
+			_mm256_add_pd(x_squared, _mm256_set1_pd(1.0))
+		), _mm256_set1_pd(1.0))
+	)));
+	// asinh(|x|) = log(2|x|) when x^2 overflows
+	ret = _mm256_blendv_pd(ret,
+		_mm256_add_pd(_mm256_log_pd(abs_x), _mm256_const_ln2_pd()),
+		_mm256_cmp_pd(abs_x, _mm256_set1_pd(0x1.0p+500), _CMP_GT_OQ)
+	);
+	return _mm256_copysign_pd(ret, x);
 }
 
-/** @note This function doesn't use AVX for calculations */
+/**
+ * @brief acosh(x) = log1p((x - 1) + sqrt((x - 1) * (x + 1)))
+ */
 static inline __m256d _mm256_acosh_pd(__m256d x) {
-	return _mm256_log_pd(_mm256_add_pd(x,
-		_mm256_sqrt_pd(
-			_mm256_add_pd(_mm256_mul_pd(x, x), _mm256_set1_pd(1.0))
-		)
-	));
+	const __m256d x_m1 = _mm256_sub_pd(x, _mm256_set1_pd(1.0));
+	__m256d ret = _mm256_log1p_pd(_mm256_add_pd(x_m1, _mm256_sqrt_pd(
+		_mm256_mul_pd(x_m1, _mm256_add_pd(x, _mm256_set1_pd(1.0)))
+	)));
+	// acosh(x) = log(2x) when x^2 overflows
+	return _mm256_blendv_pd(ret,
+		_mm256_add_pd(_mm256_log_pd(x), _mm256_const_ln2_pd()),
+		_mm256_cmp_pd(x, _mm256_set1_pd(0x1.0p+500), _CMP_GT_OQ)
+	);
 }
 
-/** @note This function doesn't use AVX for calculations */
+/**
+ * @brief atanh(|x|) = log1p(2|x| / (1 - |x|)) / 2
+ */
 static inline __m256d _mm256_atanh_pd(__m256d x) {
-	return _mm256_mul_pd(_mm256_log_pd(_mm256_div_pd(
-			_mm256_add_pd(_mm256_set1_pd(1.0), x),
-			_mm256_sub_pd(_mm256_set1_pd(1.0), x)
+	const __m256d abs_x = _mm256_fabs_pd(x);
+	const __m256d ret = _mm256_mul_pd(_mm256_log1p_pd(_mm256_div_pd(
+		_mm256_add_pd(abs_x, abs_x), _mm256_sub_pd(_mm256_set1_pd(1.0), abs_x)
 	)), _mm256_set1_pd(0.5));
+	return _mm256_copysign_pd(ret, x);
 }
 
 //------------------------------------------------------------------------------
 // __m256d SVML transcendental functions
 //------------------------------------------------------------------------------
 
-/** @note This function doesn't use AVX for calculations */
 __m256d _mm256_tgamma_pd(__m256d x);
 
-/** @note This function doesn't use AVX for calculations */
+/** @note Loses relative precision near the roots of lgamma(x) for x < 0.0 */
 __m256d _mm256_lgamma_pd(__m256d x);
 
-/** @note This function doesn't use AVX for calculations */
 __m256d _mm256_erf_pd(__m256d x);
 
-/** @note This function doesn't use AVX for calculations */
 __m256d _mm256_erfc_pd(__m256d x);
 
 #if 0
@@ -1172,7 +1184,6 @@ static inline __m256d _mm256_erfcinv_pd(__m256d x);
 
 #endif
 
-/** @note This function doesn't use AVX for calculations */
 static inline __m256d _mm256_cdfnorm_pd(__m256d x) {
 	return _mm256_mul_pd(
 		_mm256_add_pd(
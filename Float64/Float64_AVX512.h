@@ -0,0 +1,478 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#ifndef FLOAT64_AVX512_H
+#define FLOAT64_AVX512_H
+
+
+/**
+ * @brief defines functions and macros for the __m512d type.
+ * @note Only AVX512F is required. Bitwise operations on __m512d are done
+ * through the integer domain since _mm512_and_pd and friends need AVX512DQ.
+ * Comparisons and classifications return a __mmask8.
+ */
+
+#if (!defined(__AVX512F__) && defined(__GNUC__))
+	#error "__AVX512F__ is not enabled in your compiler. Try -mavx512f"
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <math.h>
+#include <immintrin.h>
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+//------------------------------------------------------------------------------
+// __m512d mathematical constants
+//------------------------------------------------------------------------------
+
+/**
+ * @brief ~2.718281828 Returns the value of euler's number
+ */
+static inline __m512d _mm512_const_e_pd(void) {
+	return _mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x4005BF0A8B145769));
+}
+
+/**
+ * @brief ~1.442695041 Returns the value of log2(e)
+ */
+static inline __m512d _mm512_const_log2e_pd(void) {
+	return _mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FF71547652B82FE));
+}
+
+/**
+ * @brief ~0.434294482 Returns the value of log10(e)
+ */
+static inline __m512d _mm512_const_log10e_pd(void) {
+	return _mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FDBCB7B1526E50E));
+}
+
+/**
+ * @brief ~3.141592654 Returns the value of pi
+ */
+static inline __m512d _mm512_const_pi_pd(void) {
+	return _mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x400921FB54442D18));
+}
+
+/**
+ * @brief ~0.318309886 Returns the value of 1 / pi
+ */
+static inline __m512d _mm512_const_inv_pi_pd(void) {
+	return _mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FD45F306DC9C883));
+}
+
+/**
+ * @brief ~0.564189584 Returns the value of 1 / sqrt(pi)
+ */
+static inline __m512d _mm512_const_inv_sqrtpi_pd(void) {
+	return _mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FE20DD750429B6D));
+}
+
+/**
+ * @brief ~0.693147181 Returns the value of ln(2)
+ */
+static inline __m512d _mm512_const_ln2_pd(void) {
+	return _mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FE62E42FEFA39EF));
+}
+
+/**
+ * @brief ~2.302585093 Returns the value of ln(10)
+ */
+static inline __m512d _mm512_const_ln10_pd(void) {
+	return _mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x40026BB1BBB55516));
+}
+
+/**
+ * @brief ~1.414213562 Returns the value of sqrt(2)
+ */
+static inline __m512d _mm512_const_sqrt2_pd(void) {
+	return _mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FF6A09E667F3BCD));
+}
+
+/**
+ * @brief ~1.732050808 Returns the value of sqrt(3)
+ */
+static inline __m512d _mm512_const_sqrt3_pd(void) {
+	return _mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FFBB67AE8584CAA));
+}
+
+/**
+ * @brief ~0.577350269 Returns the value of 1 / sqrt(3)
+ */
+static inline __m512d _mm512_const_inv_sqrt3_pd(void) {
+	return _mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FE279A74590331C));
+}
+
+/**
+ * @brief ~0.577215665 Returns the value of gamma (The Euler–Mascheroni constant)
+ */
+static inline __m512d _mm512_const_egamma_pd(void) {
+	return _mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FE2788CFC6FB619));
+}
+
+/**
+ * @brief ~1.618033989 Returns the value of phi (The golden ratio)
+ */
+static inline __m512d _mm512_const_phi_pd(void) {
+	return _mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FF9E3779B97F4A8));
+}
+
+//------------------------------------------------------------------------------
+// __m512d floating point manipulation
+//------------------------------------------------------------------------------
+
+/** @brief Returns a __m512d value set to positive infinity */
+static inline __m512d _mm512_get_infinity_pd(void) {
+	return _mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x7FF0000000000000));
+}
+
+/** @brief Returns a __m512d value set to signaling NaN */
+static inline __m512d _mm512_get_sNaN_pd(void) {
+	return _mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x7FF0000000000001));
+}
+
+/** @brief Returns a __m512d value set to quiet NaN */
+static inline __m512d _mm512_get_qNaN_pd(void) {
+	return _mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x7FF8000000000001));
+}
+
+/** @brief Returns the bitmask for extracting the sign bit */
+static inline __m512d _mm512_get_sign_mask_pd(void) {
+	return _mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x8000000000000000));
+}
+
+/** @brief Returns the bitmask for extracting the exponent bits */
+static inline __m512d _mm512_get_exponent_mask_pd(void) {
+	return _mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x7FF0000000000000));
+}
+
+/** @brief Returns the bitmask for extracting the mantissa bits */
+static inline __m512d _mm512_get_mantissa_mask_pd(void) {
+	return _mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x000FFFFFFFFFFFFF));
+}
+
+/** @brief Extracts the exponent via a bitmask */
+static inline __m512d _mm512_extract_exponent_pd(const __m512d x) {
+	return _mm512_castsi512_pd(_mm512_and_si512(
+		_mm512_castpd_si512(x), _mm512_castpd_si512(_mm512_get_exponent_mask_pd())
+	));
+}
+
+/** @brief Extracts the mantissa via a bitmask */
+static inline __m512d _mm512_extract_mantissa_pd(const __m512d x) {
+	return _mm512_castsi512_pd(_mm512_and_si512(
+		_mm512_castpd_si512(x), _mm512_castpd_si512(_mm512_get_mantissa_mask_pd())
+	));
+}
+
+//------------------------------------------------------------------------------
+// __m512d floating point classify
+//------------------------------------------------------------------------------
+
+/** @brief Returns true if the signbit of x is set (or if x is negative) */
+static inline __mmask8 _mm512_signbit_pd(const __m512d x) {
+	return _mm512_test_epi64_mask(
+		_mm512_castpd_si512(x), _mm512_castpd_si512(_mm512_get_sign_mask_pd())
+	);
+}
+
+/** @brief Returns true if x is finite */
+static inline __mmask8 _mm512_isfinite_pd(const __m512d x) {
+	return _mm512_cmp_pd_mask(_mm512_abs_pd(x), _mm512_get_infinity_pd(), _CMP_LT_OQ);
+}
+
+/** @brief Returns true if x is +-infinity */
+static inline __mmask8 _mm512_isinf_pd(const __m512d x) {
+	return _mm512_cmp_pd_mask(_mm512_abs_pd(x), _mm512_get_infinity_pd(), _CMP_EQ_OQ);
+}
+
+/** @brief Returns true if x is any kind of NaN */
+static inline __mmask8 _mm512_isnan_pd(const __m512d x) {
+	return _mm512_cmp_pd_mask(x, x, _CMP_UNORD_Q);
+}
+
+/** @brief Returns true if x is normal */
+static inline __mmask8 _mm512_isnormal_pd(const __m512d x) {
+	const __m512d x_abs = _mm512_abs_pd(x);
+	// DBL_MIN <= fabs(x) < inf
+	return _mm512_mask_cmp_pd_mask(
+		_mm512_cmp_pd_mask(x_abs, _mm512_set1_pd(2.2250738585072014e-308), _CMP_GE_OQ),
+		x_abs, _mm512_get_infinity_pd(), _CMP_LT_OQ
+	);
+}
+
+/** @brief Returns true if x is denormal and non-zero */
+static inline __mmask8 _mm512_isdenormal_pd(const __m512d x) {
+	const __m512d x_abs = _mm512_abs_pd(x);
+	// 0.0 < fabs(x) < DBL_MIN
+	return _mm512_mask_cmp_pd_mask(
+		_mm512_cmp_pd_mask(x_abs, _mm512_set1_pd(2.2250738585072014e-308), _CMP_LT_OQ),
+		x_abs, _mm512_setzero_pd(), _CMP_NEQ_OQ
+	);
+}
+
+//------------------------------------------------------------------------------
+// __m512d math.h comparison
+//------------------------------------------------------------------------------
+
+/** @brief Returns true if either x or y is NaN */
+static inline __mmask8 _mm512_isunordered_pd(__m512d x, __m512d y) {
+	return _mm512_cmp_pd_mask(x, y, _CMP_UNORD_Q);
+}
+
+/** @brief Returns true if x < y or x > y */
+static inline __mmask8 _mm512_islessgreater_pd(__m512d x, __m512d y) {
+	return _mm512_cmp_pd_mask(x, y, _CMP_NEQ_OQ);
+}
+
+/** @brief Returns true if x < y */
+static inline __mmask8 _mm512_isless_pd(__m512d x, __m512d y) {
+	return _mm512_cmp_pd_mask(x, y, _CMP_LT_OQ);
+}
+
+/** @brief Returns true if x <= y */
+static inline __mmask8 _mm512_islessequal_pd(__m512d x, __m512d y) {
+	return _mm512_cmp_pd_mask(x, y, _CMP_LE_OQ);
+}
+
+/** @brief Returns true if x > y */
+static inline __mmask8 _mm512_isgreater_pd(__m512d x, __m512d y) {
+	return _mm512_cmp_pd_mask(x, y, _CMP_GT_OQ);
+}
+
+/** @brief Returns true if x >= y */
+static inline __mmask8 _mm512_isgreaterequal_pd(__m512d x, __m512d y) {
+	return _mm512_cmp_pd_mask(x, y, _CMP_GE_OQ);
+}
+
+//------------------------------------------------------------------------------
+// __m512d math.h functions
+//------------------------------------------------------------------------------
+
+#ifndef _mm512_negate_pd
+/**
+ * @brief `-x` Negates a __m512d value (Multiplies by -1.0)
+ */
+static inline __m512d _mm512_negate_pd(__m512d x) {
+	return _mm512_castsi512_pd(_mm512_xor_si512(
+		_mm512_castpd_si512(x), _mm512_castpd_si512(_mm512_get_sign_mask_pd())
+	));
+}
+#endif
+
+#ifndef _mm512_recip_pd
+/**
+ * @brief `1 / x` Calculates the reciprocal of a __m512d value
+ */
+static inline __m512d _mm512_recip_pd(__m512d x) {
+	return _mm512_div_pd(_mm512_set1_pd(1.0), x);
+}
+#endif
+
+#ifndef _mm512_square_pd
+/**
+ * @brief `x * x` Squares a __m512d value
+ */
+static inline __m512d _mm512_square_pd(__m512d x) {
+	return _mm512_mul_pd(x, x);
+}
+#endif
+
+#ifndef _mm512_fabs_pd
+/**
+ * @brief `|x|` Returns the absolute value of a __m512d value
+ */
+static inline __m512d _mm512_fabs_pd(__m512d x) {
+	return _mm512_abs_pd(x);
+}
+#endif
+
+/**
+ * @brief Copies the sign of y to x
+ * @note 0xCA selects the bits of x where the mask is set, and y otherwise.
+ */
+static inline __m512d _mm512_copysign_pd(__m512d x, __m512d y) {
+	return _mm512_castsi512_pd(_mm512_ternarylogic_epi64(
+		_mm512_set1_epi64((int64_t)0x7FFFFFFFFFFFFFFF),
+		_mm512_castpd_si512(x),
+		_mm512_castpd_si512(y),
+	0xCA));
+}
+
+static inline __m512d _mm512_fdim_pd(__m512d x, __m512d y) {
+	__m512d ret = _mm512_sub_pd(x, y);
+	// NaN remains NaN, and -0.0 becomes +0.0
+	return _mm512_maskz_mov_pd(
+		_mm512_cmp_pd_mask(ret, _mm512_setzero_pd(), _CMP_NLE_UQ), ret
+	);
+}
+
+/**
+ * @brief Returns the fmax of x and y. Correctly handling NaN.
+ */
+static inline __m512d _mm512_fmax_pd(__m512d x, __m512d y) {
+	// returns y if x is NaN or x < y
+	return _mm512_mask_blend_pd(
+		_mm512_cmp_pd_mask(x, y, _CMP_NGE_UQ) & ~_mm512_isnan_pd(y), x, y
+	);
+}
+
+/**
+ * @brief Returns the fmin of x and y. Correctly handling NaN.
+ */
+static inline __m512d _mm512_fmin_pd(__m512d x, __m512d y) {
+	// returns y if x is NaN or x > y
+	return _mm512_mask_blend_pd(
+		_mm512_cmp_pd_mask(x, y, _CMP_NLE_UQ) & ~_mm512_isnan_pd(y), x, y
+	);
+}
+
+//------------------------------------------------------------------------------
+// __m512d rounding functions
+//------------------------------------------------------------------------------
+
+static inline __m512d _mm512_trunc_pd(__m512d x) {
+	return _mm512_roundscale_pd(x, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+}
+
+//------------------------------------------------------------------------------
+// __m512d ilogb
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Computes ilogb(x) using vgetexppd, which also handles denormals.
+ * @returns __m256i int32_t
+ */
+static inline __m256i _mm512_ilogb_pd_epi32(__m512d x) {
+	__m512d ret = _mm512_getexp_pd(x);
+	// Sets ret to INT32_MIN if x is zero or NaN
+	ret = _mm512_mask_mov_pd(
+		ret,
+		_mm512_cmp_pd_mask(x, _mm512_setzero_pd(), _CMP_EQ_UQ),
+		_mm512_set1_pd((double)INT32_MIN)
+	);
+	// Sets ret to INT32_MAX if x is infinity
+	ret = _mm512_mask_mov_pd(
+		ret, _mm512_isinf_pd(x), _mm512_set1_pd((double)INT32_MAX)
+	);
+	return _mm512_cvtpd_epi32(ret);
+}
+
+/**
+ * @brief Computes ilogb(x) using vgetexppd, which also handles denormals.
+ * @returns __m512i int64_t
+ */
+static inline __m512i _mm512_ilogb_pd_epi64(__m512d x) {
+	__m512i ret = _mm512_cvtepi32_epi64(_mm512_cvtpd_epi32(_mm512_getexp_pd(x)));
+	// Sets ret to INT64_MIN if x is zero or NaN
+	ret = _mm512_mask_mov_epi64(
+		ret,
+		_mm512_cmp_pd_mask(x, _mm512_setzero_pd(), _CMP_EQ_UQ),
+		_mm512_set1_epi64(INT64_MIN)
+	);
+	// Sets ret to INT64_MAX if x is infinity
+	ret = _mm512_mask_mov_epi64(
+		ret, _mm512_isinf_pd(x), _mm512_set1_epi64(INT64_MAX)
+	);
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m512d ldexp
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Computes ldexp(x, expon) using vscalefpd, with support for denormal
+ * numbers.
+ */
+static inline __m512d _mm512_ldexp_pd_epi32(__m512d x, __m256i expon) {
+	return _mm512_scalef_pd(x, _mm512_cvtepi32_pd(expon));
+}
+
+/**
+ * @brief Computes ldexp(x, expon) using vscalefpd, with support for denormal
+ * numbers.
+ * @note expon is saturated to the range of int32_t.
+ */
+static inline __m512d _mm512_ldexp_pd_epi64(__m512d x, __m512i expon) {
+	return _mm512_ldexp_pd_epi32(x, _mm512_cvtsepi64_epi32(expon));
+}
+
+/**
+ * @brief Computes ldexp(x, expon) with support for denormal numbers.
+ */
+static inline __m512d _mm512_ldexp_pd_i32(__m512d x, int32_t expon) {
+	return _mm512_scalef_pd(x, _mm512_set1_pd((double)expon));
+}
+
+/**
+ * @brief Computes ldexp(x, expon) with support for denormal numbers.
+ */
+static inline __m512d _mm512_ldexp_pd_i64(__m512d x, int64_t expon) {
+	return _mm512_scalef_pd(x, _mm512_set1_pd((double)expon));
+}
+
+//------------------------------------------------------------------------------
+// __m512d frexp
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Computes frexp(x, expon) using vgetmantpd and vgetexppd.
+ * @note expon is set to zero when x is zero, infinity, or NaN, and x is
+ * returned unchanged.
+ */
+static inline __m512d _mm512_frexp_pd_epi32(__m512d x, __m256i* const expon) {
+	__m512d expon_pd = _mm512_add_pd(_mm512_getexp_pd(x), _mm512_set1_pd(1.0));
+	/**
+	 * vgetexppd returns -inf for zero, +inf for infinity, and NaN for NaN.
+	 * The fixup table maps QNaN, SNaN, -inf, and +inf to +0.0
+	 */
+	expon_pd = _mm512_fixupimm_pd(
+		expon_pd, expon_pd, _mm512_set1_epi64((int64_t)0x00880088), 0
+	);
+	*expon = _mm512_cvtpd_epi32(expon_pd);
+	__m512d ret = _mm512_getmant_pd(x, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src);
+	/**
+	 * The fixup table returns x for zero and infinity, and quiets NaN.
+	 */
+	return _mm512_fixupimm_pd(
+		ret, x, _mm512_set1_epi64((int64_t)0x00110122), 0
+	);
+}
+
+/**
+ * @brief Computes frexp(x, expon) using vgetmantpd and vgetexppd.
+ * @note expon is set to zero when x is zero, infinity, or NaN, and x is
+ * returned unchanged.
+ */
+static inline __m512d _mm512_frexp_pd_epi64(__m512d x, __m512i* const expon) {
+	__m256i expon_32;
+	__m512d ret = _mm512_frexp_pd_epi32(x, &expon_32);
+	*expon = _mm512_cvtepi32_epi64(expon_32);
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m512d other functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Clamps x between [min_val, max_val]
+ */
+static inline __m512d _mm512_clamp_pd(__m512d x, __m512d min_val, __m512d max_val) {
+	return _mm512_min_pd(_mm512_max_pd(x, min_val), max_val);
+}
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* FLOAT64_AVX512_H */
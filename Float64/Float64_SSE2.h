@@ -171,6 +171,25 @@ static inline __m128d _mm_extract_mantissa_pd(const __m128d x) {
 	return _mm_and_pd(x, _mm_get_mantissa_mask_pd());
 }
 
+//------------------------------------------------------------------------------
+// __m128d blendv replacement
+//------------------------------------------------------------------------------
+
+#ifdef __SSE4_1__
+
+static inline __m128d _internal_mm_blendv_pd(__m128d false_case, __m128d true_case, __m128d mask) {
+	return _mm_blendv_pd(false_case, true_case, mask);
+}
+
+#else
+
+/** @note Unlike _mm_blendv_pd, every bit of mask must be set or cleared */
+static inline __m128d _internal_mm_blendv_pd(__m128d false_case, __m128d true_case, __m128d mask) {
+	return _mm_or_pd(_mm_andnot_pd(mask, false_case), _mm_and_pd(true_case, mask));
+}
+
+#endif
+
 //------------------------------------------------------------------------------
 // __m128d floating point classify
 //------------------------------------------------------------------------------
@@ -459,10 +478,75 @@ static inline __m128d _mm_trunc_pd(__m128d x) {
 #endif
 
 //------------------------------------------------------------------------------
-// __m128d ilogb
+// __m128d rounding
 //------------------------------------------------------------------------------
 
-#if defined(__SSE4_1__) && defined(__SSE4_2__)
+#ifdef __SSE4_1__
+
+/**
+ * @brief Rounds to the nearest integer, with ties rounding to even.
+ */
+static inline __m128d _mm_nearbyint_pd(__m128d x) {
+	return _mm_round_pd(x, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+}
+
+#else
+
+/**
+ * @brief Rounds to the nearest integer, with ties rounding to even.
+ * Adding and subtracting 2^52 rounds away the fractional bits of |x|.
+ */
+static inline __m128d _mm_nearbyint_pd(__m128d x) {
+	const __m128d round_const = _mm_set1_pd(0x1.0p+52);
+	const __m128d abs_x = _mm_fabs_pd(x);
+	__m128d ret = _mm_sub_pd(_mm_add_pd(abs_x, round_const), round_const);
+	ret = _mm_copysign_pd(ret, x);
+	// |x| >= 2^52 is already an integer. NaN is returned unchanged
+	return _internal_mm_blendv_pd(x, ret, _mm_cmplt_pd(abs_x, round_const));
+}
+
+#ifndef _mm_trunc_pd
+/**
+ * @brief _mm_trunc_pd replacement function using SSE2.
+ */
+static inline __m128d _mm_trunc_pd(__m128d x) {
+	const __m128d abs_x = _mm_fabs_pd(x);
+	__m128d ret = _mm_nearbyint_pd(abs_x);
+	// Subtracts 1.0 if |x| was rounded up
+	ret = _mm_sub_pd(ret, _mm_and_pd(_mm_cmpgt_pd(ret, abs_x), _mm_set1_pd(1.0)));
+	return _mm_copysign_pd(ret, x);
+}
+#endif
+
+#ifndef _mm_floor_pd
+/**
+ * @brief _mm_floor_pd replacement function using SSE2.
+ */
+static inline __m128d _mm_floor_pd(__m128d x) {
+	__m128d ret = _mm_nearbyint_pd(x);
+	// Subtracts 1.0 if x was rounded up
+	return _mm_sub_pd(ret, _mm_and_pd(_mm_cmpgt_pd(ret, x), _mm_set1_pd(1.0)));
+}
+#endif
+
+#ifndef _mm_ceil_pd
+/**
+ * @brief _mm_ceil_pd replacement function using SSE2.
+ */
+static inline __m128d _mm_ceil_pd(__m128d x) {
+	__m128d ret = _mm_nearbyint_pd(x);
+	// Adds 1.0 if x was rounded down
+	ret = _mm_add_pd(ret, _mm_and_pd(_mm_cmplt_pd(ret, x), _mm_set1_pd(1.0)));
+	// ceil(x) is -0.0 when x is within (-1.0, -0.0]
+	return _mm_copysign_pd(ret, x);
+}
+#endif
+
+#endif
+
+//------------------------------------------------------------------------------
+// __m128d ilogb
+//------------------------------------------------------------------------------
 
 static inline __m128i _internal_mm_ilogb_pd_epi64(__m128d x) {
 	const int64_t float64_bias = 1023;
@@ -482,14 +566,14 @@ static inline __m128i _internal_mm_ilogb_pd_epi64(__m128d x) {
 		
 		const __m128d x_isdenorm = _mm_isdenormal_pd(x);
 		__m128i bin_x = _mm_castpd_si128(_mm_mul_pd(
-			x, _mm_blendv_pd(_mm_set1_pd(1.0), mult_2_p64, x_isdenorm)
+			x, _internal_mm_blendv_pd(_mm_set1_pd(1.0), mult_2_p64, x_isdenorm)
 		));
 		
 		// clear the signbit
 		bin_x = _mm_slli_epi64(bin_x, 1);
 		// shift the exponent down
 		bin_x = _mm_srli_epi64(bin_x, 52 + 1);
-		bin_x = _mm_add_epi64(bin_x, _mm_set1_epi64x(float64_bias));
+		bin_x = _mm_sub_epi64(bin_x, _mm_set1_epi64x(float64_bias));
 		
 		// subtracts the exponent shift used for denormal numbers
 		bin_x = _mm_sub_epi64(bin_x,
@@ -501,25 +585,43 @@ static inline __m128i _internal_mm_ilogb_pd_epi64(__m128d x) {
 }
 
 /**
- * @brief Computes ilogb(x) using AVX2 integer operations
+ * @brief Computes ilogb(x) using SSE2 integer operations
  * @returns __m128i int64_t
  */
 static inline __m128i _mm_ilogb_pd_epi64(__m128d x) {
 	__m128d ret = _mm_castsi128_pd(_internal_mm_ilogb_pd_epi64(x));
 	// Sets ret to INT64_MIN if x is zero or NaN
-	ret = _mm_blendv_pd(
+	ret = _internal_mm_blendv_pd(
 		ret, _mm_castsi128_pd(_mm_set1_epi64x(INT64_MIN)),
 		_mm_or_pd(_mm_isnan_pd(x), _mm_cmpeq_pd(x, _mm_setzero_pd()))
 	);
 	// Sets ret to INT64_MAX if x is infinity
-	ret = _mm_blendv_pd(
+	ret = _internal_mm_blendv_pd(
 		ret, _mm_castsi128_pd(_mm_set1_epi64x(INT64_MAX)),
 		_mm_isinf_pd(x)
 	);
 	return _mm_castpd_si128(ret);
 }
 
-#endif
+/**
+ * @brief Computes ilogb(x) using SSE2 integer operations
+ * @returns int32_t in the lower two elements of a __m128i
+ */
+static inline __m128i _mm_ilogb_pd_epi32(__m128d x) {
+	__m128d ret = _mm_castsi128_pd(_internal_mm_ilogb_pd_epi64(x));
+	// Sets ret to INT32_MIN if x is zero or NaN
+	ret = _internal_mm_blendv_pd(
+		ret, _mm_castsi128_pd(_mm_set1_epi64x(INT32_MIN)),
+		_mm_or_pd(_mm_isnan_pd(x), _mm_cmpeq_pd(x, _mm_setzero_pd()))
+	);
+	// Sets ret to INT32_MAX if x is infinity
+	ret = _internal_mm_blendv_pd(
+		ret, _mm_castsi128_pd(_mm_set1_epi64x(INT32_MAX)),
+		_mm_isinf_pd(x)
+	);
+	// Moves the lower half of each int64_t into the lower two elements
+	return _mm_shuffle_epi32(_mm_castpd_si128(ret), _MM_SHUFFLE(3, 1, 2, 0));
+}
 
 //------------------------------------------------------------------------------
 // __m128d ldexp
@@ -547,22 +649,22 @@ static inline __m128d _mm_ldexp_pd_epi64(__m128d x, __m128i expon) {
 	{ /* multiplies by a large power of 2 */
 		__m128i test = _mm_cmpgt_epi64(expon, _mm_set1_epi64x(mult_2_power - 1));
 		x = _mm_mul_pd(x, _mm_blendv_pd(_mm_set1_pd(1.0), mult_2_p896, _mm_castsi128_pd(test)));
-		expon = _mm_sub_epi64(expon, _mm_set1_epi64x(mult_2_power));
+		expon = _mm_sub_epi64(expon, _mm_and_si128(test, _mm_set1_epi64x(mult_2_power)));
 	}
 	{ /* multiplies by a large power of 2 */
 		__m128i test = _mm_cmpgt_epi64(expon, _mm_set1_epi64x(mult_2_power - 1));
 		x = _mm_mul_pd(x, _mm_blendv_pd(_mm_set1_pd(1.0), mult_2_p896, _mm_castsi128_pd(test)));
-		expon = _mm_sub_epi64(expon, _mm_set1_epi64x(mult_2_power));
+		expon = _mm_sub_epi64(expon, _mm_and_si128(test, _mm_set1_epi64x(mult_2_power)));
 	}
 	{ /* divides by a large power of 2 */
 		__m128i test = _mm_cmpgt_epi64(_mm_set1_epi64x(-mult_2_power + 1), expon);
-		x = _mm_mul_pd(x, _mm_blendv_pd(mult_2_n896, _mm_set1_pd(1.0), _mm_castsi128_pd(test)));
-		expon = _mm_add_epi64(expon, _mm_set1_epi64x(mult_2_power));
+		x = _mm_mul_pd(x, _mm_blendv_pd(_mm_set1_pd(1.0), mult_2_n896, _mm_castsi128_pd(test)));
+		expon = _mm_add_epi64(expon, _mm_and_si128(test, _mm_set1_epi64x(mult_2_power)));
 	}
 	{ /* divides by a large power of 2 */
 		__m128i test = _mm_cmpgt_epi64(_mm_set1_epi64x(-mult_2_power + 1), expon);
-		x = _mm_mul_pd(x, _mm_blendv_pd(mult_2_n896, _mm_set1_pd(1.0), _mm_castsi128_pd(test)));
-		expon = _mm_add_epi64(expon, _mm_set1_epi64x(mult_2_power));
+		x = _mm_mul_pd(x, _mm_blendv_pd(_mm_set1_pd(1.0), mult_2_n896, _mm_castsi128_pd(test)));
+		expon = _mm_add_epi64(expon, _mm_and_si128(test, _mm_set1_epi64x(mult_2_power)));
 	}
 
 	/* multiplies by the remaining exponent */
@@ -577,24 +679,104 @@ static inline __m128d _mm_ldexp_pd_epi64(__m128d x, __m128i expon) {
 
 #endif
 
+/**
+ * @brief Computes ldexp(x, expon) with support for denormal numbers, using
+ * SSE2 integer operations.
+ * @note expon is read from the lower two int32_t elements of the __m128i
+ */
+static inline __m128d _mm_ldexp_pd_epi32(__m128d x, __m128i expon) {
+
+	const int32_t float64_bias = 1023;
+
+	// Arbritrary, but should be large and less than ~1024
+	const int32_t mult_2_power = 896;
+	// 2 ^ +896
+	const __m128d mult_2_p896 = _mm_set1_pd(5.2829453113566524635233978491652e+269);
+	// 2 ^ -896
+	const __m128d mult_2_n896 = _mm_set1_pd(1.8928834978668395375564025560288e-270);
+
+	/**
+	 * Duplicates each int32_t so that the int32_t comparisons fill each
+	 * 64bit lane, allowing them to be used as a __m128d mask.
+	 */
+	expon = _mm_unpacklo_epi32(expon, expon);
+
+	{ /* multiplies by a large power of 2 */
+		__m128i test = _mm_cmpgt_epi32(expon, _mm_set1_epi32(mult_2_power - 1));
+		x = _mm_mul_pd(x, _internal_mm_blendv_pd(_mm_set1_pd(1.0), mult_2_p896, _mm_castsi128_pd(test)));
+		expon = _mm_sub_epi32(expon, _mm_and_si128(test, _mm_set1_epi32(mult_2_power)));
+	}
+	{ /* multiplies by a large power of 2 */
+		__m128i test = _mm_cmpgt_epi32(expon, _mm_set1_epi32(mult_2_power - 1));
+		x = _mm_mul_pd(x, _internal_mm_blendv_pd(_mm_set1_pd(1.0), mult_2_p896, _mm_castsi128_pd(test)));
+		expon = _mm_sub_epi32(expon, _mm_and_si128(test, _mm_set1_epi32(mult_2_power)));
+	}
+	{ /* divides by a large power of 2 */
+		__m128i test = _mm_cmplt_epi32(expon, _mm_set1_epi32(-mult_2_power + 1));
+		x = _mm_mul_pd(x, _internal_mm_blendv_pd(_mm_set1_pd(1.0), mult_2_n896, _mm_castsi128_pd(test)));
+		expon = _mm_add_epi32(expon, _mm_and_si128(test, _mm_set1_epi32(mult_2_power)));
+	}
+	{ /* divides by a large power of 2 */
+		__m128i test = _mm_cmplt_epi32(expon, _mm_set1_epi32(-mult_2_power + 1));
+		x = _mm_mul_pd(x, _internal_mm_blendv_pd(_mm_set1_pd(1.0), mult_2_n896, _mm_castsi128_pd(test)));
+		expon = _mm_add_epi32(expon, _mm_and_si128(test, _mm_set1_epi32(mult_2_power)));
+	}
+
+	/* multiplies by the remaining exponent */
+
+	// Creates a normalized number of the form 2^expon
+	__m128i bias_expon = _mm_add_epi32(expon, _mm_set1_epi32(float64_bias));
+	// The duplicated upper int32_t is shifted out of each 64bit lane
+	__m128d mult = _mm_castsi128_pd(_mm_slli_epi64(bias_expon, 52));
+
+	return _mm_mul_pd(x, mult);
+}
+
 //------------------------------------------------------------------------------
 // __m128d frexp
 //------------------------------------------------------------------------------
 
-#if defined(__SSE4_1__) && defined(__SSE4_2__)
-
 static inline __m128d _mm_frexp_pd_epi64(__m128d x, __m128i* const expon) {
 	*expon = _mm_add_epi64(_mm_ilogb_pd_epi64(x), _mm_set1_epi64x((int64_t)1));
 	/**
 	 * Clears the exponent bits of x, then does a bitwise OR so that x will
 	 * be inside the range [0.5, 1.0)
 	 */
-	x = _mm_andnot_pd(x, _mm_get_exponent_mask_pd());
-	x = _mm_or_pd(x, _mm_set1_pd(0.5));
-	return x;
+	// 2 ^ +64, normalizes denormal numbers
+	const __m128d mult_2_p64 = _mm_set1_pd(1.8446744073709551616e+19);
+	__m128d ret = _mm_mul_pd(
+		x, _internal_mm_blendv_pd(_mm_set1_pd(1.0), mult_2_p64, _mm_isdenormal_pd(x))
+	);
+	ret = _mm_andnot_pd(_mm_get_exponent_mask_pd(), ret);
+	ret = _mm_or_pd(ret, _mm_set1_pd(0.5));
+	// if x is zero, NaN, or inf, x is returned instead
+	return _internal_mm_blendv_pd(x, ret, _mm_andnot_pd(
+		_mm_cmpeq_pd(x, _mm_setzero_pd()), _mm_isfinite_pd(x)
+	));
 }
 
-#endif
+/**
+ * @brief Computes frexp(x, expon) using SSE2 integer operations
+ * @note expon is stored in the lower two int32_t elements of the __m128i
+ */
+static inline __m128d _mm_frexp_pd_epi32(__m128d x, __m128i* const expon) {
+	*expon = _mm_add_epi32(_mm_ilogb_pd_epi32(x), _mm_set1_epi32((int32_t)1));
+	/**
+	 * Clears the exponent bits of x, then does a bitwise OR so that x will
+	 * be inside the range [0.5, 1.0)
+	 */
+	// 2 ^ +64, normalizes denormal numbers
+	const __m128d mult_2_p64 = _mm_set1_pd(1.8446744073709551616e+19);
+	__m128d ret = _mm_mul_pd(
+		x, _internal_mm_blendv_pd(_mm_set1_pd(1.0), mult_2_p64, _mm_isdenormal_pd(x))
+	);
+	ret = _mm_andnot_pd(_mm_get_exponent_mask_pd(), ret);
+	ret = _mm_or_pd(ret, _mm_set1_pd(0.5));
+	// if x is zero, NaN, or inf, x is returned instead
+	return _internal_mm_blendv_pd(x, ret, _mm_andnot_pd(
+		_mm_cmpeq_pd(x, _mm_setzero_pd()), _mm_isfinite_pd(x)
+	));
+}
 
 //------------------------------------------------------------------------------
 // __m128d nextafter and nexttoward
@@ -0,0 +1,274 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "Float64_sum.h"
+#include "Float64_sum_kernels.h"
+#include "Float64_util.h"
+
+#include <float.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+//------------------------------------------------------------------------------
+// Float64 summation dispatch
+//------------------------------------------------------------------------------
+
+/** Indexed by LDF_cpu_level. NULL for the scalar level and disabled levels. */
+static const Float64_sum_kernels* const
+Float64_sum_levels[LDF_CPU_LEVEL_COUNT] = {
+	NULL,
+	#ifdef LDF_ENABLE_DISPATCH_SSE2
+		&Float64_sum_kernels_SSE2,
+	#else
+		NULL,
+	#endif
+	#ifdef LDF_ENABLE_DISPATCH_AVX
+		&Float64_sum_kernels_AVX,
+	#else
+		NULL,
+	#endif
+	/* AVX2+FMA uses the AVX kernels */
+	NULL,
+	#ifdef LDF_ENABLE_DISPATCH_AVX512
+		&Float64_sum_kernels_AVX512,
+	#else
+		NULL,
+	#endif
+};
+
+/**
+ * @brief Sets func to the kernel from the highest supported level that
+ * implements it. func is left as NULL otherwise.
+ */
+#define FLOAT64_SUM_FIND(kernel, func) \
+	for (int level = (int)LDF_cpu_get_level(); level > 0 && func == NULL; level--) { \
+		const Float64_sum_kernels* table = Float64_sum_levels[level]; \
+		if (table != NULL) { \
+			func = table->kernel; \
+		} \
+	}
+
+/** @brief Returns the index of the first element of a strided array */
+static inline ptrdiff_t Float64_sum_start(size_t n, ptrdiff_t inc) {
+	return (inc < 0) ? (ptrdiff_t)(n - 1) * -inc : 0;
+}
+
+/** @brief Adds x to K cascaded partial sums, where sum[k + 1] sums the errors of sum[k] */
+static inline void Float64_sum_cascade(fp64* sum, int K, fp64 x) {
+	for (int k = 0; k + 1 < K; k++) {
+		sum[k] = Float64_two_sum(sum[k], x, &x);
+	}
+	sum[K - 1] += x;
+}
+
+//------------------------------------------------------------------------------
+// Float64 scalar kernels
+//------------------------------------------------------------------------------
+
+static void Float64_sumK_scalar(
+	const fp64* x, ptrdiff_t incx, size_t n, int K, fp64* state
+) {
+	ptrdiff_t ix = Float64_sum_start(n, incx);
+	for (size_t i = 0; i < n; i += FLOAT64_SUM_LANES) {
+		for (size_t lane = 0; lane < FLOAT64_SUM_LANES; lane++) {
+			fp64 e = x[ix];
+			for (int k = 0; k + 1 < K; k++) {
+				fp64* s = &state[(size_t)k * FLOAT64_SUM_LANES + lane];
+				*s = Float64_two_sum(*s, e, &e);
+			}
+			state[(size_t)(K - 1) * FLOAT64_SUM_LANES + lane] += e;
+			ix += incx;
+		}
+	}
+}
+
+static fp64 Float64_absmax_scalar(const fp64* x, ptrdiff_t incx, size_t n) {
+	ptrdiff_t ix = Float64_sum_start(n, incx);
+	fp64 ret = 0.0;
+	for (size_t i = 0; i < n; i++) {
+		if (isnan(x[ix])) {
+			return x[ix];
+		}
+		ret = (fabs(x[ix]) > ret) ? fabs(x[ix]) : ret;
+		ix += incx;
+	}
+	return ret;
+}
+
+static fp64 Float64_extract_scalar(
+	fp64* p, const fp64* x, ptrdiff_t incx, size_t n, fp64 sigma
+) {
+	ptrdiff_t ix = Float64_sum_start(n, incx);
+	fp64 tau = 0.0;
+	for (size_t i = 0; i < n; i++) {
+		const fp64 q = (sigma + x[ix]) - sigma;
+		p[i] = x[ix] - q;
+		tau += q;
+		ix += incx;
+	}
+	return tau;
+}
+
+//------------------------------------------------------------------------------
+// Float64 summation
+//------------------------------------------------------------------------------
+
+int Float64_sumK_partials(
+	size_t n, const fp64* x, ptrdiff_t incx, int K, fp64* partials
+) {
+	K = (K < 1) ? 1 : (K > FLOAT64_SUMK_MAX) ? FLOAT64_SUMK_MAX : K;
+	fp64 state[FLOAT64_SUMK_MAX * FLOAT64_SUM_LANES];
+	for (size_t i = 0; i < (size_t)K * FLOAT64_SUM_LANES; i++) {
+		state[i] = 0.0;
+	}
+	for (int k = 0; k < K; k++) {
+		partials[k] = 0.0;
+	}
+	if (n == 0) {
+		return K;
+	}
+	const size_t body = n - n % FLOAT64_SUM_LANES;
+	Float64_sum_sumK_func sumK = NULL;
+	if (incx == 1) {
+		FLOAT64_SUM_FIND(sumK, sumK)
+	}
+	if (sumK != NULL) {
+		sumK(x, body, K, state);
+	} else {
+		/* Offset so that the body is the first elements of a negative stride */
+		const ptrdiff_t offset = (incx < 0) ? (ptrdiff_t)(n - body) * -incx : 0;
+		Float64_sumK_scalar(&x[offset], incx, body, K, state);
+	}
+	/* The lanes and the tail are merged in the same order at every level */
+	for (size_t lane = 0; lane < FLOAT64_SUM_LANES; lane++) {
+		for (int k = 0; k < K; k++) {
+			Float64_sum_cascade(
+				partials, K, state[(size_t)k * FLOAT64_SUM_LANES + lane]
+			);
+		}
+	}
+	ptrdiff_t ix = Float64_sum_start(n, incx) + (ptrdiff_t)body * incx;
+	for (size_t i = body; i < n; i++) {
+		Float64_sum_cascade(partials, K, x[ix]);
+		ix += incx;
+	}
+	return K;
+}
+
+/** @brief Returns the smallest power of two that is >= fabs(x) */
+static fp64 Float64_next_power_two(fp64 x) {
+	int expon;
+	const fp64 mant = frexp(fabs(x), &expon);
+	return (mant == 0.5) ? fabs(x) : ldexp(1.0, expon);
+}
+
+/** @brief Returns true if sigma = Ms * NextPowerTwo(mu) would overflow */
+static bool Float64_accsum_overflows(size_t n, fp64 mu) {
+	const fp64 Ms = Float64_next_power_two((fp64)(n + 2));
+	return Float64_next_power_two(mu) >= 0x1.0p+1023 / Ms;
+}
+
+/**
+ * @brief AccSum (Algorithm 4.5 of Rump, Ogita, and Oishi). The first pass
+ * reads x and writes the remainders to p, later passes work in place on p.
+ * @param mu the largest fabs(x[i]), which must be finite and non-zero
+ */
+static fp64 Float64_accsum_extract(
+	fp64* p, const fp64* x, ptrdiff_t incx, size_t n, fp64 mu
+) {
+	Float64_sum_extract_func extract = NULL;
+	FLOAT64_SUM_FIND(extract, extract)
+	Float64_sum_absmax_func absmax = NULL;
+	FLOAT64_SUM_FIND(absmax, absmax)
+
+	const fp64 Ms = Float64_next_power_two((fp64)(n + 2));
+	const fp64 phi = 0x1.0p-53 * Ms;
+	const fp64 factor = 0x1.0p-52 * Ms * Ms;
+	fp64 sigma = Ms * Float64_next_power_two(mu);
+	fp64 t = 0.0;
+	for (;;) {
+		fp64 tau;
+		if (x == p || incx == 1) {
+			tau = (extract != NULL) ?
+				extract(p, x, n, sigma) :
+				Float64_extract_scalar(p, x, 1, n, sigma);
+		} else {
+			tau = Float64_extract_scalar(p, x, incx, n, sigma);
+		}
+		x = p;
+		const fp64 t_new = t + tau;
+		if (fabs(t_new) >= factor * sigma || sigma <= DBL_MIN) {
+			const fp64 tau2 = tau - (t_new - t);
+			fp64 rest;
+			Float64_sumK_partials(n, p, 1, 1, &rest);
+			return t_new + (tau2 + rest);
+		}
+		t = t_new;
+		if (t == 0.0) {
+			/* The extracted parts cancelled, so restart on the remainders */
+			mu = (absmax != NULL) ? absmax(p, n) : Float64_absmax_scalar(p, 1, n);
+			if (mu == 0.0) {
+				return 0.0;
+			}
+			sigma = Ms * Float64_next_power_two(mu);
+			continue;
+		}
+		sigma *= phi;
+	}
+}
+
+fp64 Float64_accsum(size_t n, const fp64* x, ptrdiff_t incx) {
+	if (n == 0) {
+		return 0.0;
+	}
+	Float64_sum_absmax_func absmax = NULL;
+	if (incx == 1) {
+		FLOAT64_SUM_FIND(absmax, absmax)
+	}
+	const fp64 mu = (absmax != NULL) ? absmax(x, n) : Float64_absmax_scalar(x, incx, n);
+	if (!isfinite(mu)) {
+		return Float64_sumK(n, x, incx, 1);
+	}
+	if (mu == 0.0) {
+		return 0.0;
+	}
+	if (Float64_accsum_overflows(n, mu)) {
+		return Float64_sumK(n, x, incx, 4);
+	}
+	fp64* p = (fp64*)malloc(n * sizeof(fp64));
+	if (p == NULL) {
+		return Float64_sumK(n, x, incx, 4);
+	}
+	const fp64 ret = Float64_accsum_extract(p, x, incx, n, mu);
+	free(p);
+	return ret;
+}
+
+fp64 Float64_sumK(size_t n, const fp64* x, ptrdiff_t incx, int K) {
+	fp64 partials[FLOAT64_SUMK_MAX];
+	K = Float64_sumK_partials(n, x, incx, K, partials);
+	if (K == 1) {
+		return partials[0];
+	}
+	const fp64 mu = Float64_absmax_scalar(partials, 1, (size_t)K);
+	if (!isfinite(mu) || mu == 0.0) {
+		return partials[0];
+	}
+	if (Float64_accsum_overflows((size_t)K, mu)) {
+		fp64 ret = 0.0;
+		for (int k = K - 1; k >= 0; k--) {
+			ret += partials[k];
+		}
+		return ret;
+	}
+	/* AccSum on the partial sums rounds their exact total */
+	return Float64_accsum_extract(partials, partials, 1, (size_t)K, mu);
+}
+
+#undef FLOAT64_SUM_FIND
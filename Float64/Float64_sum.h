@@ -0,0 +1,79 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#ifndef FLOAT64_SUM_H
+#define FLOAT64_SUM_H
+
+/**
+ * @brief Accurate summation of fp64 arrays.
+ *
+ * Float64_sumK uses the cascaded SumK algorithm from Ogita, Rump, and Oishi,
+ * "Accurate Sum and Dot Product" (2005), which is as accurate as summing in
+ * K-fold precision. Float64_accsum uses AccSum from Rump, Ogita, and Oishi,
+ * "Accurate Floating-Point Summation Part I: Faithful Rounding" (2008).
+ *
+ * Contiguous arrays (inc == 1) use the SSE2, AVX, or AVX512 kernels
+ * selected at runtime with LDF_cpu_get_level(). Every level, including the
+ * strided scalar loop, splits the array into the same
+ * FLOAT64_SUM_LANES interleaved lanes and merges them in the same order,
+ * so the results are bitwise identical on every CPU.
+ */
+
+#include "Float64.h"
+#include "../LDF/LDF_cpu_dispatch.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+/** @brief Largest K for Float64_sumK */
+#define FLOAT64_SUMK_MAX 8
+
+//------------------------------------------------------------------------------
+// Float64 summation
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Computes the K-fold cascaded sum of x[i], and stores it as K
+ * partial sums in partials[0] to partials[K - 1]. Their exact total is the
+ * result. partials[0] is the recursive sum, and each following partial sums
+ * the rounding errors of the one before it, so they are not ordered by
+ * magnitude when the sum cancels.
+ * @note K is clamped to [1, FLOAT64_SUMK_MAX]. K = 1 is recursive
+ * summation, and K = 2 is Sum2.
+ * @returns the clamped K
+ */
+int Float64_sumK_partials(
+	size_t n, const fp64* x, ptrdiff_t incx, int K, fp64* partials
+);
+
+/**
+ * @brief Returns the K-fold cascaded sum of x[i], faithfully rounded to
+ * fp64.
+ */
+fp64 Float64_sumK(size_t n, const fp64* x, ptrdiff_t incx, int K);
+
+/**
+ * @brief Returns the sum of x[i] faithfully rounded to fp64, so the result
+ * is exact when the sum is representable, and otherwise one of the two
+ * adjacent fp64 values. Each pass only extracts as many bits as needed, so
+ * well conditioned sums take two or three passes.
+ *
+ * @note Uses malloc for a copy of x. Falls back to Float64_sumK with K = 4
+ * if the allocation fails, or if fabs(x[i]) is close enough to DBL_MAX that
+ * the extraction would overflow. Infinities and NaN are summed normally.
+ */
+fp64 Float64_accsum(size_t n, const fp64* x, ptrdiff_t incx);
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* FLOAT64_SUM_H */
@@ -0,0 +1,127 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "../LDF/LDF_cpu_dispatch.h"
+
+/**
+ * @brief AVX kernels for Float64_sum.h. Also used by the AVX2+FMA level.
+ */
+
+#ifdef LDF_ENABLE_DISPATCH_AVX
+
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__AVX__)
+	#pragma GCC target("avx")
+#endif
+
+#include "Float64_sum_kernels.h"
+#include "Float64_AVX.h"
+
+#include <math.h>
+#include <immintrin.h>
+
+//------------------------------------------------------------------------------
+// Float64 summation kernels
+//------------------------------------------------------------------------------
+
+/** @brief Computes fl(x + y) and err(x + y), like Float64_two_sum */
+static inline __m256d Float64_two_sum_AVX(__m256d x, __m256d y, __m256d* err) {
+	const __m256d s = _mm256_add_pd(x, y);
+	const __m256d bb = _mm256_sub_pd(s, x);
+	*err = _mm256_add_pd(
+		_mm256_sub_pd(x, _mm256_sub_pd(s, bb)), _mm256_sub_pd(y, bb)
+	);
+	return s;
+}
+
+/**
+ * @brief Lane j of vector v is lane 4 * v + j of FLOAT64_SUM_LANES, which
+ * matches the scalar loop.
+ */
+static void Float64_sumK_AVX(const fp64* x, size_t n, int K, fp64* state) {
+	__m256d sum[FLOAT64_SUMK_MAX][2];
+	for (int k = 0; k < K; k++) {
+		for (size_t v = 0; v < 2; v++) {
+			sum[k][v] = _mm256_loadu_pd(&state[(size_t)k * FLOAT64_SUM_LANES + v * 4]);
+		}
+	}
+	for (size_t i = 0; i < n; i += FLOAT64_SUM_LANES) {
+		__m256d e0 = _mm256_loadu_pd(&x[i + 0]);
+		__m256d e1 = _mm256_loadu_pd(&x[i + 4]);
+		for (int k = 0; k + 1 < K; k++) {
+			sum[k][0] = Float64_two_sum_AVX(sum[k][0], e0, &e0);
+			sum[k][1] = Float64_two_sum_AVX(sum[k][1], e1, &e1);
+		}
+		sum[K - 1][0] = _mm256_add_pd(sum[K - 1][0], e0);
+		sum[K - 1][1] = _mm256_add_pd(sum[K - 1][1], e1);
+	}
+	for (int k = 0; k < K; k++) {
+		for (size_t v = 0; v < 2; v++) {
+			_mm256_storeu_pd(&state[(size_t)k * FLOAT64_SUM_LANES + v * 4], sum[k][v]);
+		}
+	}
+}
+
+static fp64 Float64_absmax_AVX(const fp64* x, size_t n) {
+	__m256d x_max = _mm256_setzero_pd();
+	__m256d nan_mask = _mm256_setzero_pd();
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4) {
+		const __m256d x_val = _mm256_loadu_pd(&x[i]);
+		nan_mask = _mm256_or_pd(nan_mask, _mm256_cmpunord_pd(x_val, x_val));
+		x_max = _mm256_max_pd(x_max, _mm256_fabs_pd(x_val));
+	}
+	if (_mm256_movemask_pd(nan_mask) != 0) {
+		return NAN;
+	}
+	fp64 lane[4];
+	_mm256_storeu_pd(lane, x_max);
+	fp64 ret = 0.0;
+	for (size_t j = 0; j < 4; j++) {
+		ret = (lane[j] > ret) ? lane[j] : ret;
+	}
+	for (; i < n; i++) {
+		if (isnan(x[i])) {
+			return x[i];
+		}
+		ret = (fabs(x[i]) > ret) ? fabs(x[i]) : ret;
+	}
+	return ret;
+}
+
+/** @brief The sum of the high parts is exact, so it may be in any order */
+static fp64 Float64_extract_AVX(fp64* p, const fp64* x, size_t n, fp64 sigma) {
+	const __m256d v_sigma = _mm256_set1_pd(sigma);
+	__m256d tau = _mm256_setzero_pd();
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4) {
+		const __m256d x_val = _mm256_loadu_pd(&x[i]);
+		const __m256d q = _mm256_sub_pd(_mm256_add_pd(v_sigma, x_val), v_sigma);
+		_mm256_storeu_pd(&p[i], _mm256_sub_pd(x_val, q));
+		tau = _mm256_add_pd(tau, q);
+	}
+	fp64 lane[4];
+	_mm256_storeu_pd(lane, tau);
+	fp64 ret = 0.0;
+	for (size_t j = 0; j < 4; j++) {
+		ret += lane[j];
+	}
+	for (; i < n; i++) {
+		const fp64 q = (sigma + x[i]) - sigma;
+		p[i] = x[i] - q;
+		ret += q;
+	}
+	return ret;
+}
+
+const Float64_sum_kernels Float64_sum_kernels_AVX = {
+	.sumK    = Float64_sumK_AVX,
+	.absmax  = Float64_absmax_AVX,
+	.extract = Float64_extract_AVX,
+};
+
+#endif
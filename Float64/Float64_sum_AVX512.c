@@ -0,0 +1,124 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "../LDF/LDF_cpu_dispatch.h"
+
+/**
+ * @brief AVX512 kernels for Float64_sum.h. Only AVX512F is required.
+ */
+
+#ifdef LDF_ENABLE_DISPATCH_AVX512
+
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__AVX512F__)
+	#pragma GCC target("avx512f")
+#endif
+
+#include "Float64_sum_kernels.h"
+#include "Float64_AVX512.h"
+
+#include <math.h>
+#include <immintrin.h>
+
+//------------------------------------------------------------------------------
+// Float64 summation kernels
+//------------------------------------------------------------------------------
+
+/** @brief Computes fl(x + y) and err(x + y), like Float64_two_sum */
+static inline __m512d Float64_two_sum_AVX512(__m512d x, __m512d y, __m512d* err) {
+	const __m512d s = _mm512_add_pd(x, y);
+	const __m512d bb = _mm512_sub_pd(s, x);
+	*err = _mm512_add_pd(
+		_mm512_sub_pd(x, _mm512_sub_pd(s, bb)), _mm512_sub_pd(y, bb)
+	);
+	return s;
+}
+
+/**
+ * @brief Lane j of vector v is lane 8 * v + j of FLOAT64_SUM_LANES, which
+ * matches the scalar loop.
+ */
+static void Float64_sumK_AVX512(const fp64* x, size_t n, int K, fp64* state) {
+	__m512d sum[FLOAT64_SUMK_MAX][1];
+	for (int k = 0; k < K; k++) {
+		for (size_t v = 0; v < 1; v++) {
+			sum[k][v] = _mm512_loadu_pd(&state[(size_t)k * FLOAT64_SUM_LANES + v * 8]);
+		}
+	}
+	for (size_t i = 0; i < n; i += FLOAT64_SUM_LANES) {
+		__m512d e0 = _mm512_loadu_pd(&x[i + 0]);
+		for (int k = 0; k + 1 < K; k++) {
+			sum[k][0] = Float64_two_sum_AVX512(sum[k][0], e0, &e0);
+		}
+		sum[K - 1][0] = _mm512_add_pd(sum[K - 1][0], e0);
+	}
+	for (int k = 0; k < K; k++) {
+		for (size_t v = 0; v < 1; v++) {
+			_mm512_storeu_pd(&state[(size_t)k * FLOAT64_SUM_LANES + v * 8], sum[k][v]);
+		}
+	}
+}
+
+static fp64 Float64_absmax_AVX512(const fp64* x, size_t n) {
+	__m512d x_max = _mm512_setzero_pd();
+	__mmask8 nan_mask = 0;
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		const __m512d x_val = _mm512_loadu_pd(&x[i]);
+		nan_mask = (__mmask8)(nan_mask | _mm512_cmp_pd_mask(x_val, x_val, _CMP_UNORD_Q));
+		x_max = _mm512_max_pd(x_max, _mm512_fabs_pd(x_val));
+	}
+	if (nan_mask != 0) {
+		return NAN;
+	}
+	fp64 lane[8];
+	_mm512_storeu_pd(lane, x_max);
+	fp64 ret = 0.0;
+	for (size_t j = 0; j < 8; j++) {
+		ret = (lane[j] > ret) ? lane[j] : ret;
+	}
+	for (; i < n; i++) {
+		if (isnan(x[i])) {
+			return x[i];
+		}
+		ret = (fabs(x[i]) > ret) ? fabs(x[i]) : ret;
+	}
+	return ret;
+}
+
+/** @brief The sum of the high parts is exact, so it may be in any order */
+static fp64 Float64_extract_AVX512(fp64* p, const fp64* x, size_t n, fp64 sigma) {
+	const __m512d v_sigma = _mm512_set1_pd(sigma);
+	__m512d tau = _mm512_setzero_pd();
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		const __m512d x_val = _mm512_loadu_pd(&x[i]);
+		const __m512d q = _mm512_sub_pd(_mm512_add_pd(v_sigma, x_val), v_sigma);
+		_mm512_storeu_pd(&p[i], _mm512_sub_pd(x_val, q));
+		tau = _mm512_add_pd(tau, q);
+	}
+	fp64 lane[8];
+	_mm512_storeu_pd(lane, tau);
+	fp64 ret = 0.0;
+	for (size_t j = 0; j < 8; j++) {
+		ret += lane[j];
+	}
+	for (; i < n; i++) {
+		const fp64 q = (sigma + x[i]) - sigma;
+		p[i] = x[i] - q;
+		ret += q;
+	}
+	return ret;
+}
+
+const Float64_sum_kernels Float64_sum_kernels_AVX512 = {
+	.sumK    = Float64_sumK_AVX512,
+	.absmax  = Float64_absmax_AVX512,
+	.extract = Float64_extract_AVX512,
+};
+
+#endif
@@ -0,0 +1,133 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "../LDF/LDF_cpu_dispatch.h"
+
+/**
+ * @brief SSE2 kernels for Float64_sum.h
+ */
+
+#ifdef LDF_ENABLE_DISPATCH_SSE2
+
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__SSE2__)
+	#pragma GCC target("sse2")
+#endif
+
+#include "Float64_sum_kernels.h"
+#include "Float64_SSE2.h"
+
+#include <math.h>
+#include <emmintrin.h>
+
+//------------------------------------------------------------------------------
+// Float64 summation kernels
+//------------------------------------------------------------------------------
+
+/** @brief Computes fl(x + y) and err(x + y), like Float64_two_sum */
+static inline __m128d Float64_two_sum_SSE2(__m128d x, __m128d y, __m128d* err) {
+	const __m128d s = _mm_add_pd(x, y);
+	const __m128d bb = _mm_sub_pd(s, x);
+	*err = _mm_add_pd(
+		_mm_sub_pd(x, _mm_sub_pd(s, bb)), _mm_sub_pd(y, bb)
+	);
+	return s;
+}
+
+/**
+ * @brief Lane j of vector v is lane 2 * v + j of FLOAT64_SUM_LANES, which
+ * matches the scalar loop.
+ */
+static void Float64_sumK_SSE2(const fp64* x, size_t n, int K, fp64* state) {
+	__m128d sum[FLOAT64_SUMK_MAX][4];
+	for (int k = 0; k < K; k++) {
+		for (size_t v = 0; v < 4; v++) {
+			sum[k][v] = _mm_loadu_pd(&state[(size_t)k * FLOAT64_SUM_LANES + v * 2]);
+		}
+	}
+	for (size_t i = 0; i < n; i += FLOAT64_SUM_LANES) {
+		__m128d e0 = _mm_loadu_pd(&x[i + 0]);
+		__m128d e1 = _mm_loadu_pd(&x[i + 2]);
+		__m128d e2 = _mm_loadu_pd(&x[i + 4]);
+		__m128d e3 = _mm_loadu_pd(&x[i + 6]);
+		for (int k = 0; k + 1 < K; k++) {
+			sum[k][0] = Float64_two_sum_SSE2(sum[k][0], e0, &e0);
+			sum[k][1] = Float64_two_sum_SSE2(sum[k][1], e1, &e1);
+			sum[k][2] = Float64_two_sum_SSE2(sum[k][2], e2, &e2);
+			sum[k][3] = Float64_two_sum_SSE2(sum[k][3], e3, &e3);
+		}
+		sum[K - 1][0] = _mm_add_pd(sum[K - 1][0], e0);
+		sum[K - 1][1] = _mm_add_pd(sum[K - 1][1], e1);
+		sum[K - 1][2] = _mm_add_pd(sum[K - 1][2], e2);
+		sum[K - 1][3] = _mm_add_pd(sum[K - 1][3], e3);
+	}
+	for (int k = 0; k < K; k++) {
+		for (size_t v = 0; v < 4; v++) {
+			_mm_storeu_pd(&state[(size_t)k * FLOAT64_SUM_LANES + v * 2], sum[k][v]);
+		}
+	}
+}
+
+static fp64 Float64_absmax_SSE2(const fp64* x, size_t n) {
+	__m128d x_max = _mm_setzero_pd();
+	__m128d nan_mask = _mm_setzero_pd();
+	size_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		const __m128d x_val = _mm_loadu_pd(&x[i]);
+		nan_mask = _mm_or_pd(nan_mask, _mm_cmpunord_pd(x_val, x_val));
+		x_max = _mm_max_pd(x_max, _mm_fabs_pd(x_val));
+	}
+	if (_mm_movemask_pd(nan_mask) != 0) {
+		return NAN;
+	}
+	fp64 lane[2];
+	_mm_storeu_pd(lane, x_max);
+	fp64 ret = 0.0;
+	for (size_t j = 0; j < 2; j++) {
+		ret = (lane[j] > ret) ? lane[j] : ret;
+	}
+	for (; i < n; i++) {
+		if (isnan(x[i])) {
+			return x[i];
+		}
+		ret = (fabs(x[i]) > ret) ? fabs(x[i]) : ret;
+	}
+	return ret;
+}
+
+/** @brief The sum of the high parts is exact, so it may be in any order */
+static fp64 Float64_extract_SSE2(fp64* p, const fp64* x, size_t n, fp64 sigma) {
+	const __m128d v_sigma = _mm_set1_pd(sigma);
+	__m128d tau = _mm_setzero_pd();
+	size_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		const __m128d x_val = _mm_loadu_pd(&x[i]);
+		const __m128d q = _mm_sub_pd(_mm_add_pd(v_sigma, x_val), v_sigma);
+		_mm_storeu_pd(&p[i], _mm_sub_pd(x_val, q));
+		tau = _mm_add_pd(tau, q);
+	}
+	fp64 lane[2];
+	_mm_storeu_pd(lane, tau);
+	fp64 ret = 0.0;
+	for (size_t j = 0; j < 2; j++) {
+		ret += lane[j];
+	}
+	for (; i < n; i++) {
+		const fp64 q = (sigma + x[i]) - sigma;
+		p[i] = x[i] - q;
+		ret += q;
+	}
+	return ret;
+}
+
+const Float64_sum_kernels Float64_sum_kernels_SSE2 = {
+	.sumK    = Float64_sumK_SSE2,
+	.absmax  = Float64_absmax_SSE2,
+	.extract = Float64_extract_SSE2,
+};
+
+#endif
@@ -0,0 +1,77 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#ifndef FLOAT64_SUM_KERNELS_H
+#define FLOAT64_SUM_KERNELS_H
+
+/**
+ * @brief Internal table of the Float64_sum.h kernels. Each
+ * Float64_sum_<ISA>.c file provides one table.
+ *
+ * @note NULL entries fall back to the next lower level, and then to the
+ * scalar loops in Float64_sum.c. None of the kernels use FMA, so the
+ * AVX2+FMA level uses the AVX kernels.
+ */
+
+#include "Float64.h"
+#include "Float64_sum.h"
+#include "../LDF/LDF_cpu_dispatch.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+/**
+ * @brief Element i of the array is summed into lane i % FLOAT64_SUM_LANES,
+ * which is one SIMD lane of one of the accumulators at every level.
+ */
+#define FLOAT64_SUM_LANES 8
+
+/**
+ * @brief SumK over n elements, where n is a multiple of FLOAT64_SUM_LANES.
+ * Partial sum k of each lane is stored in state[k * FLOAT64_SUM_LANES + lane].
+ */
+typedef void (*Float64_sum_sumK_func)(
+	const fp64* x, size_t n, int K, fp64* state
+);
+
+/** @brief Returns the largest fabs(x[i]), or NaN if any x[i] is NaN */
+typedef fp64 (*Float64_sum_absmax_func)(const fp64* x, size_t n);
+
+/**
+ * @brief ExtractVector from AccSum. Splits each x[i] into a high part,
+ * which is a multiple of ulp(sigma), and p[i] = x[i] - high part. Returns the
+ * sum of the high parts, which is exact. p may be the same array as x.
+ */
+typedef fp64 (*Float64_sum_extract_func)(
+	fp64* p, const fp64* x, size_t n, fp64 sigma
+);
+
+typedef struct Float64_sum_kernels {
+	Float64_sum_sumK_func sumK;
+	Float64_sum_absmax_func absmax;
+	Float64_sum_extract_func extract;
+} Float64_sum_kernels;
+
+#ifdef LDF_ENABLE_DISPATCH_SSE2
+	extern const Float64_sum_kernels Float64_sum_kernels_SSE2;
+#endif
+#ifdef LDF_ENABLE_DISPATCH_AVX
+	extern const Float64_sum_kernels Float64_sum_kernels_AVX;
+#endif
+#ifdef LDF_ENABLE_DISPATCH_AVX512
+	extern const Float64_sum_kernels Float64_sum_kernels_AVX512;
+#endif
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* FLOAT64_SUM_KERNELS_H */
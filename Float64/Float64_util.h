@@ -10,6 +10,10 @@
 #define FLOAT64_UTIL_H
 
 #include "Float64.h"
+#include "../LDF/LDF_restrict.h"
+#include "../LDF/LDF_fma.h"
+
+#include <math.h>
 
 //------------------------------------------------------------------------------
 // qd_real.cpp functions
@@ -73,6 +77,11 @@ static inline void Float64_split(
 
 /** @brief Computes fl(x * y) and err(x * y). */
 static inline fp64 Float64_two_prod(const fp64 a, const fp64 b, fp64* LDF_restrict const err) {
+#ifdef LDF_ENABLE_FMA
+	fp64 p = a * b;
+	*err = fma(a, b, -p);
+	return p;
+#else
 	fp64 a_hi, a_lo, b_hi, b_lo;
 	fp64 p = a * b;
 	Float64_split(a, &a_hi, &a_lo);
@@ -82,10 +91,16 @@ static inline fp64 Float64_two_prod(const fp64 a, const fp64 b, fp64* LDF_restri
 		a_hi * b_lo + a_lo * b_hi
 	) + a_lo * b_lo;
 	return p;
+#endif
 }
 
 /** @brief Computes fl(x * x) and err(x * x). Faster than Float64_two_prod(x, x, err) */
 static inline fp64 Float64_two_sqr(const fp64 a, fp64* LDF_restrict const err) {
+#ifdef LDF_ENABLE_FMA
+	fp64 q = a * a;
+	*err = fma(a, a, -q);
+	return q;
+#else
 	fp64 hi, lo;
 	fp64 q = a * a;
 	Float64_split(a, &hi, &lo);
@@ -94,6 +109,7 @@ static inline fp64 Float64_two_sqr(const fp64 a, fp64* LDF_restrict const err) {
 		2.0 * hi * lo
 	) + lo * lo;
 	return q;
+#endif
 }
 
 /** 
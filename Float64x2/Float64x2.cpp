@@ -45,6 +45,7 @@
 #include "../Float64x4/Float64x4.hpp"
 
 #include "Float64x2_input_limits.hpp"
+#include "../LDF/LDF_trig_reduce.hpp"
 
 //------------------------------------------------------------------------------
 // Float64x2 math.h functions
@@ -251,10 +252,136 @@ static inline Float64x2 taylor_expm1(const Float64x2& x, fp64& m) {
 	// return ldexp(s, static_cast<int>(m));
 }
 
+/**
+ * @brief 2^(j / 64) for j = 0 to 63
+ */
+static constexpr Float64x2 exp2_table[] = {
+/*   0 */ {0x1.0000000000000p+0 ,+0x0.0000000000000p+0 },
+/*   1 */ {0x1.02c9a3e778061p+0 ,-0x1.19083535b085dp-56},
+/*   2 */ {0x1.059b0d3158574p+0 ,+0x1.d73e2a475b465p-55},
+/*   3 */ {0x1.0874518759bc8p+0 ,+0x1.186be4bb284ffp-57},
+/*   4 */ {0x1.0b5586cf9890fp+0 ,+0x1.8a62e4adc610bp-54},
+/*   5 */ {0x1.0e3ec32d3d1a2p+0 ,+0x1.03a1727c57b53p-59},
+/*   6 */ {0x1.11301d0125b51p+0 ,-0x1.6c51039449b3ap-54},
+/*   7 */ {0x1.1429aaea92de0p+0 ,-0x1.32fbf9af1369ep-54},
+/*   8 */ {0x1.172b83c7d517bp+0 ,-0x1.19041b9d78a76p-55},
+/*   9 */ {0x1.1a35beb6fcb75p+0 ,+0x1.e5b4c7b4968e4p-55},
+/*  10 */ {0x1.1d4873168b9aap+0 ,+0x1.e016e00a2643cp-54},
+/*  11 */ {0x1.2063b88628cd6p+0 ,+0x1.dc775814a8495p-55},
+/*  12 */ {0x1.2387a6e756238p+0 ,+0x1.9b07eb6c70573p-54},
+/*  13 */ {0x1.26b4565e27cddp+0 ,+0x1.2bd339940e9d9p-55},
+/*  14 */ {0x1.29e9df51fdee1p+0 ,+0x1.612e8afad1255p-55},
+/*  15 */ {0x1.2d285a6e4030bp+0 ,+0x1.0024754db41d5p-54},
+/*  16 */ {0x1.306fe0a31b715p+0 ,+0x1.6f46ad23182e4p-55},
+/*  17 */ {0x1.33c08b26416ffp+0 ,+0x1.32721843659a6p-54},
+/*  18 */ {0x1.371a7373aa9cbp+0 ,-0x1.63aeabf42eae2p-54},
+/*  19 */ {0x1.3a7db34e59ff7p+0 ,-0x1.5e436d661f5e3p-56},
+/*  20 */ {0x1.3dea64c123422p+0 ,+0x1.ada0911f09ebcp-55},
+/*  21 */ {0x1.4160a21f72e2ap+0 ,-0x1.ef3691c309278p-58},
+/*  22 */ {0x1.44e086061892dp+0 ,+0x1.89b7a04ef80d0p-59},
+/*  23 */ {0x1.486a2b5c13cd0p+0 ,+0x1.3c1a3b69062f0p-56},
+/*  24 */ {0x1.4bfdad5362a27p+0 ,+0x1.d4397afec42e2p-56},
+/*  25 */ {0x1.4f9b2769d2ca7p+0 ,-0x1.4b309d25957e3p-54},
+/*  26 */ {0x1.5342b569d4f82p+0 ,-0x1.07abe1db13cadp-55},
+/*  27 */ {0x1.56f4736b527dap+0 ,+0x1.9bb2c011d93adp-54},
+/*  28 */ {0x1.5ab07dd485429p+0 ,+0x1.6324c054647adp-54},
+/*  29 */ {0x1.5e76f15ad2148p+0 ,+0x1.ba6f93080e65ep-54},
+/*  30 */ {0x1.6247eb03a5585p+0 ,-0x1.383c17e40b497p-54},
+/*  31 */ {0x1.6623882552225p+0 ,-0x1.bb60987591c34p-54},
+/*  32 */ {0x1.6a09e667f3bcdp+0 ,-0x1.bdd3413b26456p-54},
+/*  33 */ {0x1.6dfb23c651a2fp+0 ,-0x1.bbe3a683c88abp-57},
+/*  34 */ {0x1.71f75e8ec5f74p+0 ,-0x1.16e4786887a99p-55},
+/*  35 */ {0x1.75feb564267c9p+0 ,-0x1.0245957316dd3p-54},
+/*  36 */ {0x1.7a11473eb0187p+0 ,-0x1.41577ee04992fp-55},
+/*  37 */ {0x1.7e2f336cf4e62p+0 ,+0x1.05d02ba15797ep-56},
+/*  38 */ {0x1.82589994cce13p+0 ,-0x1.d4c1dd41532d8p-54},
+/*  39 */ {0x1.868d99b4492edp+0 ,-0x1.fc6f89bd4f6bap-54},
+/*  40 */ {0x1.8ace5422aa0dbp+0 ,+0x1.6e9f156864b27p-54},
+/*  41 */ {0x1.8f1ae99157736p+0 ,+0x1.5cc13a2e3976cp-55},
+/*  42 */ {0x1.93737b0cdc5e5p+0 ,-0x1.75fc781b57ebcp-57},
+/*  43 */ {0x1.97d829fde4e50p+0 ,-0x1.d185b7c1b85d1p-54},
+/*  44 */ {0x1.9c49182a3f090p+0 ,+0x1.c7c46b071f2bep-56},
+/*  45 */ {0x1.a0c667b5de565p+0 ,-0x1.359495d1cd533p-54},
+/*  46 */ {0x1.a5503b23e255dp+0 ,-0x1.d2f6edb8d41e1p-54},
+/*  47 */ {0x1.a9e6b5579fdbfp+0 ,+0x1.0fac90ef7fd31p-54},
+/*  48 */ {0x1.ae89f995ad3adp+0 ,+0x1.7a1cd345dcc81p-54},
+/*  49 */ {0x1.b33a2b84f15fbp+0 ,-0x1.2805e3084d708p-57},
+/*  50 */ {0x1.b7f76f2fb5e47p+0 ,-0x1.5584f7e54ac3bp-56},
+/*  51 */ {0x1.bcc1e904bc1d2p+0 ,+0x1.23dd07a2d9e84p-55},
+/*  52 */ {0x1.c199bdd85529cp+0 ,+0x1.11065895048ddp-55},
+/*  53 */ {0x1.c67f12e57d14bp+0 ,+0x1.2884dff483cadp-54},
+/*  54 */ {0x1.cb720dcef9069p+0 ,+0x1.503cbd1e949dbp-56},
+/*  55 */ {0x1.d072d4a07897cp+0 ,-0x1.cbc3743797a9cp-54},
+/*  56 */ {0x1.d5818dcfba487p+0 ,+0x1.2ed02d75b3707p-55},
+/*  57 */ {0x1.da9e603db3285p+0 ,+0x1.c2300696db532p-54},
+/*  58 */ {0x1.dfc97337b9b5fp+0 ,-0x1.1a5cd4f184b5cp-54},
+/*  59 */ {0x1.e502ee78b3ff6p+0 ,+0x1.39e8980a9cc8fp-55},
+/*  60 */ {0x1.ea4afa2a490dap+0 ,-0x1.e9c23179c2893p-54},
+/*  61 */ {0x1.efa1bee615a27p+0 ,+0x1.dc7f486a4b6b0p-54},
+/*  62 */ {0x1.f50765b6e4540p+0 ,+0x1.9d3e12dd8a18bp-54},
+/*  63 */ {0x1.fa7c1819e90d8p+0 ,+0x1.74853f3a5931ep-55}
+};
+static constexpr int exp2_table_bits = 6;
+static constexpr int exp2_table_size = 1 << exp2_table_bits;
+
+/**
+ * @brief ln(2) / 64 split into three parts. The first part has 36 bits, so
+ * k * exp2_ln2_split[0] is exact for |k| < 2^17.
+ */
+static constexpr fp64 exp2_ln2_split[3] = {
+	+0x1.62e42fefa0000p-7, +0x1.cf79abc9e3b3ap-46, -0x1.ff0342542fc33p-100
+};
+
+/**
+ * @brief Computes exp(x) / 2^m with a table of 2^(j / 64).
+ *
+ * @remarks x is reduced to (64m + j) * ln(2) / 64 + r, where |r| <= ln(2) / 128,
+ * so that exp(x) = 2^m * 2^(j / 64) * exp(r). The Taylor series of expm1(r)
+ * only needs terms up to r^11, and the terms after r^6 are smaller than
+ * 2^-64, so they are summed in fp64. This replaces the nine serial squarings
+ * of taylor_expm1 with a single multiplication by the table.
+ *
+ * r is reduced with a three part ln(2) / 64, which avoids the error of
+ * rounding ln(2) to Float64x2 when k is large.
+ */
+static inline Float64x2 table_exp(const Float64x2& x, int& m) {
+	const fp64 k = floor(
+		x.hi * (static_cast<fp64>(exp2_table_size) * LDF::const_log2e<fp64>()) +
+		static_cast<fp64>(0.5)
+	);
+	Float64x2 r = x - k * exp2_ln2_split[0];
+	r -= LDF::mul<Float64x2, fp64, fp64>(k, exp2_ln2_split[1]);
+	r -= k * exp2_ln2_split[2];
+	const int k_int = static_cast<int>(k);
+	const int j = k_int & (exp2_table_size - 1);
+	m = (k_int - j) / exp2_table_size;
+
+	/* 1/7! + r/8! + ... + r^4/11! */
+	fp64 tail = inv_fact[8].hi;
+	tail = tail * r.hi + inv_fact[7].hi;
+	tail = tail * r.hi + inv_fact[6].hi;
+	tail = tail * r.hi + inv_fact[5].hi;
+	tail = tail * r.hi + inv_fact[4].hi;
+
+	/* 1/2! + r/3! + ... + r^9/11! */
+	Float64x2 p = inv_fact[3] + r * tail;
+	p = inv_fact[2] + r * p;
+	p = inv_fact[1] + r * p;
+	p = inv_fact[0] + r * p;
+	p = static_cast<fp64>(0.5) + r * p;
+
+	const Float64x2 expm1_r = r + square(r) * p;
+	return exp2_table[j] + exp2_table[j] * expm1_r;
+}
+
 Float64x2 exp(const Float64x2& x) {
 	if (x.hi <= LDF::LDF_Input_Limits::exp_min<Float64x2, fp64>()) {
-		// Gives a better approximation near extreme values
-		return exp(x.hi);
+		/**
+		 * Gives a better approximation near extreme values. The result is
+		 * subnormal, so exp(x.lo) = 1 + x.lo is enough, but x.lo would be
+		 * lost if it were added after rounding.
+		 */
+		return exp(x.hi) * (static_cast<fp64>(1.0) + x.lo);
 	}
 	/* ln(2^1023 * (1 + (1 - 2^-52)))) = ~709.782712893 */
 	if (x.hi >= LDF::LDF_Input_Limits::exp_max<Float64x2, fp64>()) {
@@ -270,10 +397,9 @@ Float64x2 exp(const Float64x2& x) {
 		return LDF::const_inv_e<Float64x4>();
 	}
 
-	fp64 m;
-	Float64x2 ret = taylor_expm1(x, m);
-	ret += static_cast<fp64>(1.0);
-	return ldexp(ret, static_cast<int>(m));
+	int m;
+	Float64x2 ret = table_exp(x, m);
+	return ldexp(ret, m);
 }
 
 Float64x2 expm1(const Float64x2& x) {
@@ -286,8 +412,6 @@ Float64x2 expm1(const Float64x2& x) {
 	if (isequal_zero(x)) {
 		return static_cast<Float64x2>(0.0);
 	}
-	fp64 m;
-	Float64x2 ret = taylor_expm1(x, m);
 	/**
 	 * @remarks LDF::const_ln2<fp64>() is less than LDF::const_ln2<Float64x2>(). If this were not the
 	 * case, then one would have to compare against
@@ -298,13 +422,226 @@ Float64x2 expm1(const Float64x2& x) {
 	 * rounding errors.
 	 */
 	if (fabs(x) < mul_pwr2(static_cast<fp64>(0.5), LDF::const_ln2<Float64x2>())) {
-		return ret; // expm1 to higher accuracy
+		fp64 m;
+		return taylor_expm1(x, m); // expm1 to higher accuracy
 	}
-	ret += static_cast<fp64>(1.0);
-	ret = ldexp(ret, static_cast<int>(m));
+	int m;
+	Float64x2 ret = table_exp(x, m);
+	ret = ldexp(ret, m);
 	return ret - static_cast<fp64>(1.0); // expm1 to standard accuracy
 }
 
+/**
+ * @brief Table for log. log_table_invc[i - 90] is 128 / i rounded to fp64,
+ * for 128 / i in [sqrt(0.5), sqrt(2)].
+ */
+static constexpr fp64 log_table_invc[] = {
+/*  90 */ 0x1.6c16c16c16c17p+0,
+/*  91 */ 0x1.6816816816817p+0,
+/*  92 */ 0x1.642c8590b2164p+0,
+/*  93 */ 0x1.6058160581606p+0,
+/*  94 */ 0x1.5c9882b931057p+0,
+/*  95 */ 0x1.58ed2308158edp+0,
+/*  96 */ 0x1.5555555555555p+0,
+/*  97 */ 0x1.51d07eae2f815p+0,
+/*  98 */ 0x1.4e5e0a72f0539p+0,
+/*  99 */ 0x1.4afd6a052bf5bp+0,
+/* 100 */ 0x1.47ae147ae147bp+0,
+/* 101 */ 0x1.446f86562d9fbp+0,
+/* 102 */ 0x1.4141414141414p+0,
+/* 103 */ 0x1.3e22cbce4a902p+0,
+/* 104 */ 0x1.3b13b13b13b14p+0,
+/* 105 */ 0x1.3813813813814p+0,
+/* 106 */ 0x1.3521cfb2b78c1p+0,
+/* 107 */ 0x1.323e34a2b10bfp+0,
+/* 108 */ 0x1.2f684bda12f68p+0,
+/* 109 */ 0x1.2c9fb4d812ca0p+0,
+/* 110 */ 0x1.29e4129e4129ep+0,
+/* 111 */ 0x1.27350b8812735p+0,
+/* 112 */ 0x1.2492492492492p+0,
+/* 113 */ 0x1.21fb78121fb78p+0,
+/* 114 */ 0x1.1f7047dc11f70p+0,
+/* 115 */ 0x1.1cf06ada2811dp+0,
+/* 116 */ 0x1.1a7b9611a7b96p+0,
+/* 117 */ 0x1.1811811811812p+0,
+/* 118 */ 0x1.15b1e5f75270dp+0,
+/* 119 */ 0x1.135c81135c811p+0,
+/* 120 */ 0x1.1111111111111p+0,
+/* 121 */ 0x1.0ecf56be69c90p+0,
+/* 122 */ 0x1.0c9714fbcda3bp+0,
+/* 123 */ 0x1.0a6810a6810a7p+0,
+/* 124 */ 0x1.0842108421084p+0,
+/* 125 */ 0x1.0624dd2f1a9fcp+0,
+/* 126 */ 0x1.0410410410410p+0,
+/* 127 */ 0x1.0204081020408p+0,
+/* 128 */ 0x1.0000000000000p+0,
+/* 129 */ 0x1.fc07f01fc07f0p-1,
+/* 130 */ 0x1.f81f81f81f820p-1,
+/* 131 */ 0x1.f44659e4a4271p-1,
+/* 132 */ 0x1.f07c1f07c1f08p-1,
+/* 133 */ 0x1.ecc07b301ecc0p-1,
+/* 134 */ 0x1.e9131abf0b767p-1,
+/* 135 */ 0x1.e573ac901e574p-1,
+/* 136 */ 0x1.e1e1e1e1e1e1ep-1,
+/* 137 */ 0x1.de5d6e3f8868ap-1,
+/* 138 */ 0x1.dae6076b981dbp-1,
+/* 139 */ 0x1.d77b654b82c34p-1,
+/* 140 */ 0x1.d41d41d41d41dp-1,
+/* 141 */ 0x1.d0cb58f6ec074p-1,
+/* 142 */ 0x1.cd85689039b0bp-1,
+/* 143 */ 0x1.ca4b3055ee191p-1,
+/* 144 */ 0x1.c71c71c71c71cp-1,
+/* 145 */ 0x1.c3f8f01c3f8f0p-1,
+/* 146 */ 0x1.c0e070381c0e0p-1,
+/* 147 */ 0x1.bdd2b899406f7p-1,
+/* 148 */ 0x1.bacf914c1bad0p-1,
+/* 149 */ 0x1.b7d6c3dda338bp-1,
+/* 150 */ 0x1.b4e81b4e81b4fp-1,
+/* 151 */ 0x1.b2036406c80d9p-1,
+/* 152 */ 0x1.af286bca1af28p-1,
+/* 153 */ 0x1.ac5701ac5701bp-1,
+/* 154 */ 0x1.a98ef606a63bep-1,
+/* 155 */ 0x1.a6d01a6d01a6dp-1,
+/* 156 */ 0x1.a41a41a41a41ap-1,
+/* 157 */ 0x1.a16d3f97a4b02p-1,
+/* 158 */ 0x1.9ec8e951033d9p-1,
+/* 159 */ 0x1.9c2d14ee4a102p-1,
+/* 160 */ 0x1.999999999999ap-1,
+/* 161 */ 0x1.970e4f80cb872p-1,
+/* 162 */ 0x1.948b0fcd6e9e0p-1,
+/* 163 */ 0x1.920fb49d0e229p-1,
+/* 164 */ 0x1.8f9c18f9c18fap-1,
+/* 165 */ 0x1.8d3018d3018d3p-1,
+/* 166 */ 0x1.8acb90f6bf3aap-1,
+/* 167 */ 0x1.886e5f0abb04ap-1,
+/* 168 */ 0x1.8618618618618p-1,
+/* 169 */ 0x1.83c977ab2beddp-1,
+/* 170 */ 0x1.8181818181818p-1,
+/* 171 */ 0x1.7f405fd017f40p-1,
+/* 172 */ 0x1.7d05f417d05f4p-1,
+/* 173 */ 0x1.7ad2208e0ecc3p-1,
+/* 174 */ 0x1.78a4c8178a4c8p-1,
+/* 175 */ 0x1.767dce434a9b1p-1,
+/* 176 */ 0x1.745d1745d1746p-1,
+/* 177 */ 0x1.724287f46debcp-1,
+/* 178 */ 0x1.702e05c0b8170p-1,
+/* 179 */ 0x1.6e1f76b4337c7p-1,
+/* 180 */ 0x1.6c16c16c16c17p-1,
+/* 181 */ 0x1.6a13cd1537290p-1
+};
+
+/**
+ * @brief log_table_log[i] = -log(log_table_invc[i])
+ */
+static constexpr Float64x2 log_table_log[] = {
+/*  90 */ {-0x1.68ac83e9c6a15p-2,+0x1.acd8a9145ff44p-57},
+/*  91 */ {-0x1.5d5bddf595f31p-2,-0x1.d5f75b9a23ae4p-59},
+/*  92 */ {-0x1.522ae0738a3d7p-2,-0x1.3840b263acb43p-56},
+/*  93 */ {-0x1.4718dc271c41cp-2,-0x1.d8fb4c14c56eep-56},
+/*  94 */ {-0x1.3c25277333183p-2,-0x1.152d81af5713ap-56},
+/*  95 */ {-0x1.314f1e1d35ce3p-2,-0x1.22966f61a3c23p-56},
+/*  96 */ {-0x1.269621134db91p-2,-0x1.e0efadd9db02ap-56},
+/*  97 */ {-0x1.1bf99635a6b95p-2,+0x1.e9575c2124912p-56},
+/*  98 */ {-0x1.1178e8227e47ap-2,-0x1.b8ce2d07f1cb7p-56},
+/*  99 */ {-0x1.07138604d5864p-2,+0x1.24e912b16ec8bp-60},
+/* 100 */ {-0x1.f991c6cb3b37ap-3,-0x1.ecca0cdf30143p-58},
+/* 101 */ {-0x1.e530effe71013p-3,+0x1.f7627ef82f3f0p-57},
+/* 102 */ {-0x1.d1037f2655e7bp-3,+0x1.3f3adb7b71cbcp-58},
+/* 103 */ {-0x1.bd087383bd8aap-3,+0x1.1165504ad749ep-59},
+/* 104 */ {-0x1.a93ed3c8ad9e5p-3,-0x1.bcafa9de97202p-57},
+/* 105 */ {-0x1.95a5adcf70182p-3,-0x1.8a16283fdbd1cp-57},
+/* 106 */ {-0x1.823c16551a3c0p-3,-0x1.6dcd318f4187ep-57},
+/* 107 */ {-0x1.6f0128b756ab9p-3,+0x1.37967087859b9p-59},
+/* 108 */ {-0x1.5bf406b543db0p-3,+0x1.1f5b44c0df7f7p-61},
+/* 109 */ {-0x1.4913d8333b563p-3,+0x1.0d5604930f137p-58},
+/* 110 */ {-0x1.365fcb0159014p-3,-0x1.bea08d2dca256p-57},
+/* 111 */ {-0x1.23d712a49c201p-3,-0x1.51c7e9efae297p-57},
+/* 112 */ {-0x1.1178e8227e47ap-3,+0x1.0e63a5f01c693p-58},
+/* 113 */ {-0x1.fe89139dbd565p-4,+0x1.ac9f4215f9394p-58},
+/* 114 */ {-0x1.da7276384469ep-4,-0x1.401fa71733017p-58},
+/* 115 */ {-0x1.b6ac88dad5b1dp-4,+0x1.002bf768e52d0p-58},
+/* 116 */ {-0x1.9335e5d594988p-4,+0x1.478a85704ccb7p-58},
+/* 117 */ {-0x1.700d30aeac0e8p-4,-0x1.a36a677b4c8b2p-59},
+/* 118 */ {-0x1.4d3115d207eacp-4,-0x1.da7d0b1e10b2fp-60},
+/* 119 */ {-0x1.2aa04a44717a1p-4,-0x1.aea2c72d05c08p-58},
+/* 120 */ {-0x1.08598b59e3a06p-4,+0x1.dd7009902bf32p-58},
+/* 121 */ {-0x1.ccb73cdddb2d0p-5,+0x1.e48fb0500efd5p-59},
+/* 122 */ {-0x1.894aa149fb34bp-5,+0x1.2ba0b44cfaee5p-59},
+/* 123 */ {-0x1.466aed42de3f9p-5,+0x1.9badefe942718p-60},
+/* 124 */ {-0x1.0415d89e74440p-5,-0x1.c05cf1d753621p-59},
+/* 125 */ {-0x1.8492528c8cac5p-6,+0x1.d192d0619fa68p-60},
+/* 126 */ {-0x1.0205658935837p-6,-0x1.27c8e8416e717p-60},
+/* 127 */ {-0x1.010157588de69p-7,-0x1.46662d417cecep-62},
+/* 128 */ {0x0.0000000000000p+0 ,+0x0.0000000000000p+0 },
+/* 129 */ {0x1.fe02a6b106799p-8 ,-0x1.e44b7e3711e7fp-67},
+/* 130 */ {0x1.fc0a8b0fc03c4p-7 ,-0x1.83092c5964281p-62},
+/* 131 */ {0x1.7b91b07d5b126p-6 ,-0x1.6d80ab38e9430p-62},
+/* 132 */ {0x1.f829b0e7832f8p-6 ,+0x1.33e3f04f1ef25p-60},
+/* 133 */ {0x1.39e87b9febd68p-5 ,-0x1.5bfa937f551b7p-59},
+/* 134 */ {0x1.77458f632dcffp-5 ,+0x1.8d3ca87b92968p-63},
+/* 135 */ {0x1.b42dd711971b9p-5 ,+0x1.0a34531f67db5p-59},
+/* 136 */ {0x1.f0a30c01162a8p-5 ,+0x1.85f325c5bbacdp-59},
+/* 137 */ {0x1.16536eea37ae3p-4 ,+0x1.2189705cf74cap-58},
+/* 138 */ {0x1.341d7961bd1d0p-4 ,-0x1.3599f227becbbp-58},
+/* 139 */ {0x1.51b073f06183cp-4 ,-0x1.5b61c65e5741ap-58},
+/* 140 */ {0x1.6f0d28ae56b4ep-4 ,-0x1.20db323097324p-59},
+/* 141 */ {0x1.8c345d6319b23p-4 ,-0x1.294d2f5668495p-58},
+/* 142 */ {0x1.a926d3a4ad562p-4 ,-0x1.d7a16eab1e2adp-59},
+/* 143 */ {0x1.c5e548f5bc743p-4 ,+0x1.2eb0bf7c0b0d9p-59},
+/* 144 */ {0x1.e27076e2af2eap-4 ,-0x1.61578001e015ap-60},
+/* 145 */ {0x1.fec9131dbeabcp-4 ,-0x1.5746b9981b36cp-58},
+/* 146 */ {0x1.0d77e7cd08e5bp-3 ,+0x1.9a5dc5e9030adp-57},
+/* 147 */ {0x1.1b72ad52f67a2p-3 ,-0x1.fbe7ee5c69946p-57},
+/* 148 */ {0x1.29552f81ff521p-3 ,+0x1.301771c407dc0p-57},
+/* 149 */ {0x1.371fc201e8f75p-3 ,+0x1.e6cb62af18a02p-62},
+/* 150 */ {0x1.44d2b6ccb7d1cp-3 ,+0x1.7d3d950f87e23p-59},
+/* 151 */ {0x1.526e5e3a1b438p-3 ,-0x1.546ff8a470d3ap-57},
+/* 152 */ {0x1.5ff3070a793d6p-3 ,-0x1.bc60efafc6f6cp-58},
+/* 153 */ {0x1.6d60fe719d21bp-3 ,+0x1.d551d97132e87p-57},
+/* 154 */ {0x1.7ab890210d907p-3 ,-0x1.1072534a57e7dp-57},
+/* 155 */ {0x1.87fa06520c911p-3 ,-0x1.9f7fdbfa08d9ap-57},
+/* 156 */ {0x1.9525a9cf456b6p-3 ,-0x1.26fb3e2b1d1dap-57},
+/* 157 */ {0x1.a23bc1fe2b561p-3 ,+0x1.24dc46c1ea664p-57},
+/* 158 */ {0x1.af3c94e80bff3p-3 ,+0x1.a3398064df33ep-57},
+/* 159 */ {0x1.bc286742d8cd4p-3 ,+0x1.cfce744870f57p-58},
+/* 160 */ {0x1.c8ff7c79a9a20p-3 ,-0x1.4f689f8434011p-57},
+/* 161 */ {0x1.d5c216b4fbb94p-3 ,-0x1.a37794d03657dp-58},
+/* 162 */ {0x1.e27076e2af2e8p-3 ,-0x1.61578001e015ep-59},
+/* 163 */ {0x1.ef0adcbdc5935p-3 ,+0x1.e8637950dc20dp-57},
+/* 164 */ {0x1.fb9186d5e3e29p-3 ,+0x1.355519b0de535p-57},
+/* 165 */ {0x1.0402594b4d041p-2 ,-0x1.08ec217a5022dp-57},
+/* 166 */ {0x1.0a324e27390e2p-2 ,+0x1.bdcfde8061c03p-56},
+/* 167 */ {0x1.1058bf9ae4ad4p-2 ,+0x1.3f415699663ecp-63},
+/* 168 */ {0x1.1675cababa60fp-2 ,+0x1.ce63eab883727p-61},
+/* 169 */ {0x1.1c898c16999fbp-2 ,+0x1.9f1a39d500e3cp-56},
+/* 170 */ {0x1.22941fbcf7966p-2 ,-0x1.dbd7ac258a2bdp-58},
+/* 171 */ {0x1.2895a13de86a4p-2 ,+0x1.7ad24c13f040fp-56},
+/* 172 */ {0x1.2e8e2bae11d31p-2 ,-0x1.1e99b72bd7bf2p-57},
+/* 173 */ {0x1.347dd9a987d56p-2 ,-0x1.16ea62c048cfbp-56},
+/* 174 */ {0x1.3a64c556945eap-2 ,+0x1.cbcd735d03424p-60},
+/* 175 */ {0x1.404308686a7e4p-2 ,-0x1.f79f6c1059cdbp-57},
+/* 176 */ {0x1.4618bc21c5ec2p-2 ,-0x1.7a42642661c62p-61},
+/* 177 */ {0x1.4be5f957778a1p-2 ,-0x1.4b366b609027ap-58},
+/* 178 */ {0x1.51aad872df82ep-2 ,-0x1.d8db0a7cc1543p-56},
+/* 179 */ {0x1.5767717455a6cp-2 ,-0x1.fb2a49af933e8p-57},
+/* 180 */ {0x1.5d1bdbf5809cap-2 ,-0x1.7dc9c7c23801fp-56},
+/* 181 */ {0x1.62c82f2b9c796p-2 ,-0x1.090a0dd59fe35p-58}
+};
+static constexpr int log_table_bits = 7;
+static constexpr int log_table_offset = 90;
+
+/**
+ * @brief 1 / (2k + 1) for k = 1 to 6, used by the atanh series in log
+ */
+static constexpr Float64x2 log_inv_odd[] = {
+/* 1/ 3 */ {0x1.5555555555555p-2 ,+0x1.5555555555555p-56},
+/* 1/ 5 */ {0x1.999999999999ap-3 ,-0x1.999999999999ap-57},
+/* 1/ 7 */ {0x1.2492492492492p-3 ,+0x1.2492492492492p-57},
+/* 1/ 9 */ {0x1.c71c71c71c71cp-4 ,+0x1.c71c71c71c71cp-58},
+/* 1/11 */ {0x1.745d1745d1746p-4 ,-0x1.745d1745d1746p-59},
+/* 1/13 */ {0x1.3b13b13b13b14p-4 ,-0x1.3b13b13b13b14p-58}
+};
+
 /** 
  * @brief Logarithm.  Computes log(x) in double-double precision.
  * @note This is a natural logarithm (i.e., base e).
@@ -343,8 +680,54 @@ Float64x2 log(const Float64x2& x) {
 		return std::numeric_limits<Float64x2>::quiet_NaN();
 	}
 
-	Float64x2 guess = log(x.hi);   /* Initial approximation */
-	return guess.hi + x * exp(-guess) - static_cast<fp64>(1.0);
+	if (!isfinite(x)) {
+		return x;
+	}
+
+	/**
+	 * x = 2^e * m, where m is in [sqrt(0.5), sqrt(2)]. m is multiplied by
+	 * invc ~= 1 / c from the table, where c = i / 128 is the closest point to m,
+	 * so that r = m * invc - 1 is smaller than 2^-7.5. The products are exact,
+	 * and m.hi * invc - 1 is exact since it is near 1, so r has no
+	 * cancellation error. When m is within 2^-7 of 1, c = 1 is used instead,
+	 * since -log(invc) and log1p(r) would have opposite signs and cancel.
+	 */
+	int e = ilogb(x.hi);
+	Float64x2 m = ldexp(x, -e);
+	if (m.hi > LDF::const_sqrt2<fp64>()) {
+		m = mul_pwr2(m, static_cast<fp64>(0.5));
+		e++;
+	}
+	int i = static_cast<int>(
+		m.hi * static_cast<fp64>(1 << log_table_bits) + static_cast<fp64>(0.5)
+	) - log_table_offset;
+	if (std::fabs(m.hi - static_cast<fp64>(1.0)) < static_cast<fp64>(0x1.0p-7)) {
+		i = (1 << log_table_bits) - log_table_offset;
+	}
+	const fp64 invc = log_table_invc[i];
+	const Float64x2 p_hi = LDF::mul<Float64x2, fp64, fp64>(m.hi, invc);
+	Float64x2 r = LDF::add<Float64x2, fp64, fp64>(p_hi.hi - static_cast<fp64>(1.0), p_hi.lo);
+	r += LDF::mul<Float64x2, fp64, fp64>(m.lo, invc);
+
+	/**
+	 * log(1 + r) = 2 * atanh(s), where s = r / (2 + r) is smaller than 2^-8.
+	 * atanh(s) / s = 1 + s^2/3 + s^4/5 + ..., and the terms after s^6/7 are
+	 * smaller than 2^-67, so they are summed in fp64.
+	 * 2 * s = r - r * s, so log(1 + r) = r - r * s + 2 * s^3 * (1/3 + ...).
+	 * r is exact, which keeps the rounding error of the division in the
+	 * terms that are at most 2^-8 of the result.
+	 */
+	const Float64x2 s = r / (static_cast<fp64>(2.0) + r);
+	const Float64x2 z = square(s);
+	fp64 tail = log_inv_odd[5].hi;
+	tail = tail * z.hi + log_inv_odd[4].hi;
+	tail = tail * z.hi + log_inv_odd[3].hi;
+	Float64x2 p = log_inv_odd[2] + z * tail;
+	p = log_inv_odd[1] + z * p;
+	p = log_inv_odd[0] + z * p;
+	const Float64x2 log1p_r = (r - r * s) + mul_pwr2(s * z, static_cast<fp64>(2.0)) * p;
+
+	return (LDF::const_ln2<Float64x2>() * static_cast<fp64>(e) + log_table_log[i]) + log1p_r;
 }
 
 Float64x2 log1p(const Float64x2& x) {
@@ -674,89 +1057,134 @@ static void sincos_taylor(
 	p_cos = sqrt(static_cast<fp64>(1.0) - square(p_sin));
 }
 
-static constexpr Float64x4 Float64x4_pi16 = {0x1.921fb54442d18p-3,+0x1.1a62633145c07p-57,-0x1.f1976b7ed8fbcp-113,+0x1.4cf98e804177dp-167};
+/**
+ * @brief pi/16 split into five parts. The first part has 30 bits, so
+ * n * trig_pi16_split[0] is exact for |n| < 2^23.
+ */
+static constexpr fp64 trig_pi16_split[5] = {
+	+0x1.921fb54000000p-3, +0x1.10b4611a62633p-33,
+	+0x1.45c06e0e68948p-89, +0x1.27044533e63a0p-145,
+	+0x1.05df531d89cd9p-201
+};
 
-static inline void trig_modulo(
-	const Float64x2& x, Float64x2& ret, Float64x2& t,
-	int& j, int& k
-) {
-	#if 0
-		// approximately reduce modulo 2*pi
-		Float64x2 z = round(x / Float64x2_2pi);
-		ret = (x - Float64x2_2pi * z);
-
-		// approximately reduce modulo pi/2 and then modulo pi/16.
-		fp64 q = floor(ret.hi / LDF::const_pi2<fp64>() + 0.5);
-		t = ret - LDF::const_pi2<Float64x2>() * q;
-		j = static_cast<int>(q);
-		q = floor(t.hi / Float64x2_pi16.hi + 0.5);
-		t -= Float64x2_pi16 * q;
-		k = static_cast<int>(q);
-	#elif 0
-		// approximately reduce modulo 2*pi
-		Float64x4 z = round(x / Float64x4_2pi);
-		ret = static_cast<Float64x2>(x - Float64x4_2pi * z);
-
-		// approximately reduce modulo pi/2 and then modulo pi/16.
-		fp64 q = floor(ret.hi / LDF::const_pi2<fp64>() + 0.5);
-		t = ret - LDF::const_pi2<Float64x2>() * q;
-		j = static_cast<int>(q);
-		q = floor(t.hi / Float64x2_pi16.hi + 0.5);
-		t -= Float64x2_pi16 * q;
-		k = static_cast<int>(q);
-	#elif 0
-		// approximately reduce modulo 2*pi
-		Float64x4 z = round(x / Float64x4_2pi);
-		ret = static_cast<Float64x2>(x - Float64x4_2pi * z);
-
-		// approximately reduce modulo pi/2 and then modulo pi/16.
-		Float64x2 q = floor(ret / LDF::const_pi2<Float64x2>() + 0.5);
-		t = ret - LDF::const_pi2<Float64x2>() * q;
-		j = static_cast<int>(q);
-		q = floor(t / Float64x2_pi16 + 0.5);
-		t -= Float64x2_pi16 * q;
-		k = static_cast<int>(q);
-	#else
-		// approximately reduce modulo 2*pi
-		Float64x4 z = round(x / LDF::const_2pi<Float64x4>());
-		Float64x4 ret_temp = x - LDF::const_2pi<Float64x4>() * z;
-		
-		// approximately reduce modulo pi/2 and then modulo pi/16.
-		Float64x4 q = floor(ret_temp / LDF::const_pi2<Float64x4>() + 0.5);
-		Float64x4 t_temp = ret_temp - LDF::const_pi2<Float64x4>() * q;
-		j = static_cast<int>(q);
-		q = floor(t / Float64x4_pi16 + 0.5);
-		t_temp -= Float64x4_pi16 * q;
-		k = static_cast<int>(q);
-		ret = static_cast<Float64x2>(ret_temp);
-		t = static_cast<Float64x2>(t_temp);
-	#endif
+/** @brief Largest |x| that trig_modulo reduces with trig_pi16_split */
+static constexpr fp64 trig_cody_waite_max = 0x1.0p+20;
+
+/** @brief Returns x - n * (pi/16), where n is an integer and |n| < 2^23 */
+static inline Float64x2 trig_sub_pi16(const Float64x2& x, const fp64 n) {
+	Float64x2 t = x - n * trig_pi16_split[0];
+	t -= LDF::mul<Float64x2, fp64, fp64>(n, trig_pi16_split[1]);
+	t -= LDF::mul<Float64x2, fp64, fp64>(n, trig_pi16_split[2]);
+	t -= LDF::mul<Float64x2, fp64, fp64>(n, trig_pi16_split[3]);
+	t -= n * trig_pi16_split[4];
+	return t;
 }
 
-/** 
- * @author Taken from libQD dd_real.cpp which can be found under a
- * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+/**
+ * @brief Reduces x modulo pi/2 with LDF::trig_reduce_pi2, and then modulo
+ * pi/16. Used for |x| > trig_cody_waite_max.
  */
-Float64x2 sin(const Float64x2& x) {  
-
-	/* Strategy.  To compute sin(x), we choose integers a, b so that
+static inline void trig_modulo_large(
+	const Float64x2& x, Float64x2& t, int& j, int& k
+) {
+	const fp64 limbs[2] = {x.hi, x.lo};
+	fp64 r[3];
+	j = LDF::trig_reduce_pi2(limbs, 2, r, 3);
+	if (j == 3) {
+		j = -1;
+	}
+	t = LDF::add<Float64x2, fp64, fp64>(r[0], r[1]) + r[2];
+	if (!isfinite(t)) {
+		/* t is NaN */
+		k = 0;
+		return;
+	}
+	const fp64 n = round(t.hi * (static_cast<fp64>(16.0) * LDF::const_inv_pi<fp64>()));
+	t = trig_sub_pi16(t, n);
+	k = static_cast<int>(n);
+}
 
-		x = s + a * (pi/2) + b * (pi/16)
+/**
+ * @brief Computes x = t + (8j + k) * (pi/16), where |t| <= pi/32,
+ * j is in [-1, 2] and k is in [-4, 4].
+ *
+ * @remarks Nearly all arguments are reduced without any Float64x4 arithmetic:
+ * - If |x| <= pi/32, x is returned as is.
+ * - If |x| <= 2^20, n = round(x / (pi/16)) is subtracted with a five part
+ * Cody-Waite constant. The extra bits keep t accurate when x is close to a
+ * multiple of pi/16.
+ * - Otherwise the Payne-Hanek reduction in trig_modulo_large is used.
+ */
+static inline void trig_modulo(
+	const Float64x2& x, Float64x2& t, int& j, int& k
+) {
+	const fp64 n = round(x.hi * (static_cast<fp64>(16.0) * LDF::const_inv_pi<fp64>()));
+	if (n == static_cast<fp64>(0.0)) {
+		t = x;
+		j = 0;
+		k = 0;
+		return;
+	}
+	if (!(fabs(x.hi) <= trig_cody_waite_max)) {
+		trig_modulo_large(x, t, j, k);
+		return;
+	}
+	t = trig_sub_pi16(x, n);
 
-		and |s| <= pi/32.  Using the fact that 
+	const fp64 q = round(n * static_cast<fp64>(0.125));
+	k = static_cast<int>(n - static_cast<fp64>(8.0) * q);
+	/* j = q mod 4, mapped to [-1, 2] */
+	j = static_cast<int>(static_cast<int32_t>(q) & 3);
+	if (j == 3) {
+		j = -1;
+	}
+}
 
-		sin(pi/16) = 0.5 * sqrt(2 - sqrt(2 + sqrt(2)))
+/**
+ * @brief Computes x = s + (8j + k) / 16 and returns t = s * pi, where
+ * |s| <= 1/32, j is in [-1, 2] and k is in [-4, 4].
+ *
+ * @remarks The reduction is exact, since each limb is first reduced modulo 2
+ * by clearing its integer bits, and n / 16 is then subtracted from a value
+ * within [-2, +2]. The only rounding error comes from multiplying s by pi.
+ */
+static inline void trigpi_modulo(
+	const Float64x2& x, Float64x2& t, int& j, int& k
+) {
+	if (!isfinite(x)) {
+		t = std::numeric_limits<Float64x2>::quiet_NaN();
+		j = 0;
+		k = 0;
+		return;
+	}
+	const fp64 y_hi = x.hi - static_cast<fp64>(2.0) * round(x.hi * static_cast<fp64>(0.5));
+	const fp64 y_lo = x.lo - static_cast<fp64>(2.0) * round(x.lo * static_cast<fp64>(0.5));
+	const Float64x2 y = LDF::add<Float64x2, fp64, fp64>(y_hi, y_lo);
 
-		we can compute sin(x) from sin(s), cos(s).  This greatly 
-		increases the convergence of the sine Taylor series. */
+	const fp64 n = round(y.hi * static_cast<fp64>(16.0));
+	const Float64x2 s = LDF::add<Float64x2, fp64, fp64>(
+		y.hi - n * static_cast<fp64>(0.0625), y.lo
+	);
+	t = s * LDF::const_pi<Float64x2>();
 
-	if (isequal_zero(x)) {
-		return 0.0;
+	const fp64 q = round(n * static_cast<fp64>(0.125));
+	k = static_cast<int>(n - static_cast<fp64>(8.0) * q);
+	/* j = q mod 4, mapped to [-1, 2] */
+	j = static_cast<int>(q) & 3;
+	if (j == 3) {
+		j = -1;
 	}
+}
 
-	Float64x2 ret, t;
-	int j, k;
-	trig_modulo(x, ret, t, j, k);
+/**
+ * @brief Computes sin(t + (8j + k) * (pi/16)) for the output of trig_modulo
+ * or trigpi_modulo.
+ *
+ * @author Taken from libQD dd_real.cpp which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+static Float64x2 sin_reduced(const Float64x2& t, const int j, const int k) {
+	Float64x2 ret;
 	unsigned int abs_k = static_cast<unsigned int>(abs(k));
 
 	if (j < -2 || j > 2) {
@@ -821,15 +1249,38 @@ Float64x2 sin(const Float64x2& x) {
  * @author Taken from libQD dd_real.cpp which can be found under a
  * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
  */
-Float64x2 cos(const Float64x2& x) {
+Float64x2 sin(const Float64x2& x) {  
+
+	/* Strategy.  To compute sin(x), we choose integers a, b so that
+
+		x = s + a * (pi/2) + b * (pi/16)
+
+		and |s| <= pi/32.  Using the fact that 
+
+		sin(pi/16) = 0.5 * sqrt(2 - sqrt(2 + sqrt(2)))
+
+		we can compute sin(x) from sin(s), cos(s).  This greatly 
+		increases the convergence of the sine Taylor series. */
 
 	if (isequal_zero(x)) {
-		return 1.0;
+		return 0.0;
 	}
 
-	Float64x2 ret, t;
+	Float64x2 t;
 	int j, k;
-	trig_modulo(x, ret, t, j, k);
+	trig_modulo(x, t, j, k);
+	return sin_reduced(t, j, k);
+}
+
+/**
+ * @brief Computes cos(t + (8j + k) * (pi/16)) for the output of trig_modulo
+ * or trigpi_modulo.
+ *
+ * @author Taken from libQD dd_real.cpp which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+static Float64x2 cos_reduced(const Float64x2& t, const int j, const int k) {
+	Float64x2 ret;
 	unsigned int abs_k = static_cast<unsigned int>(abs(k));
 
 	if (j < -2 || j > 2) {
@@ -895,17 +1346,29 @@ Float64x2 cos(const Float64x2& x) {
  * @author Taken from libQD dd_real.cpp which can be found under a
  * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
  */
-void sincos(const Float64x2& x, Float64x2& p_sin, Float64x2& p_cos) {
+Float64x2 cos(const Float64x2& x) {
 
 	if (isequal_zero(x)) {
-		p_sin = static_cast<fp64>(0.0);
-		p_cos = static_cast<fp64>(1.0);
-		return;
+		return 1.0;
 	}
 
-	Float64x2 ret, t;
+	Float64x2 t;
 	int j, k;
-	trig_modulo(x, ret, t, j, k);
+	trig_modulo(x, t, j, k);
+	return cos_reduced(t, j, k);
+}
+
+/**
+ * @brief Computes sin and cos of t + (8j + k) * (pi/16) for the output of
+ * trig_modulo or trigpi_modulo.
+ *
+ * @author Taken from libQD dd_real.cpp which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+static void sincos_reduced(
+	const Float64x2& t, const int j, const int k,
+	Float64x2& p_sin, Float64x2& p_cos
+) {
 	unsigned int abs_k = static_cast<unsigned int>(abs(k));
 	unsigned int abs_j = static_cast<unsigned int>(abs(j));
 
@@ -958,6 +1421,56 @@ void sincos(const Float64x2& x, Float64x2& p_sin, Float64x2& p_cos) {
 	}
 }
 
+/** 
+ * @author Taken from libQD dd_real.cpp which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+void sincos(const Float64x2& x, Float64x2& p_sin, Float64x2& p_cos) {
+
+	if (isequal_zero(x)) {
+		p_sin = static_cast<fp64>(0.0);
+		p_cos = static_cast<fp64>(1.0);
+		return;
+	}
+
+	Float64x2 t;
+	int j, k;
+	trig_modulo(x, t, j, k);
+	sincos_reduced(t, j, k, p_sin, p_cos);
+}
+
+Float64x2 sinpi(const Float64x2& x) {
+	if (isequal_zero(x)) {
+		return 0.0;
+	}
+	Float64x2 t;
+	int j, k;
+	trigpi_modulo(x, t, j, k);
+	return sin_reduced(t, j, k);
+}
+
+Float64x2 cospi(const Float64x2& x) {
+	if (isequal_zero(x)) {
+		return 1.0;
+	}
+	Float64x2 t;
+	int j, k;
+	trigpi_modulo(x, t, j, k);
+	return cos_reduced(t, j, k);
+}
+
+void sincospi(const Float64x2& x, Float64x2& p_sin, Float64x2& p_cos) {
+	if (isequal_zero(x)) {
+		p_sin = static_cast<fp64>(0.0);
+		p_cos = static_cast<fp64>(1.0);
+		return;
+	}
+	Float64x2 t;
+	int j, k;
+	trigpi_modulo(x, t, j, k);
+	sincos_reduced(t, j, k, p_sin, p_cos);
+}
+
 /** 
  * @author Taken from libQD dd_real.cpp which can be found under a
  * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
@@ -1328,13 +1841,13 @@ Float64x2 hypot(const Float64x2& x, const Float64x2& y) {
 	if (max_value >= sqrt_max) {
 		return ldexp(sqrt(
 			square(ldexp(x, -512)) + square(ldexp(y, -512))
-		), 256);
+		), 512);
 	}
 	// Prevents underflow
 	if (max_value <= sqrt_min) {
 		return ldexp(sqrt(
 			square(ldexp(x, 512)) + square(ldexp(y, 512))
-		), -256);
+		), -512);
 	}
 	// Trival case
 	return sqrt(square(x) + square(y));
@@ -1370,13 +1883,13 @@ Float64x2 hypot(const Float64x2& x, const Float64x2& y, const Float64x2& z) {
 	if (max_value >= sqrt_max) {
 		return ldexp(sqrt(
 			square(ldexp(x, -512)) + square(ldexp(y, -512)) + square(ldexp(z, -512))
-		), 256);
+		), 512);
 	}
 	// Prevents underflow
 	if (max_value <= sqrt_min) {
 		return ldexp(sqrt(
 			square(ldexp(x, 512)) + square(ldexp(y, 512)) + square(ldexp(z, 512))
-		), -256);
+		), -512);
 	}
 	// Trival case
 	return sqrt(square(x) + square(y) + square(z));
@@ -1543,7 +2056,7 @@ Float64x2 Float64x2_exp(Float64x2 x) {
 	return exp(x);
 }
 Float64x2 Float64x2_expm1(Float64x2 x) {
-	return exp(x);
+	return expm1(x);
 }
 Float64x2 Float64x2_log(Float64x2 x) {
 	return log(x);
@@ -1564,6 +2077,18 @@ void Float64x2_sincos(Float64x2 theta, Float64x2* LDF_restrict p_sin, Float64x2*
 Float64x2 Float64x2_tan(Float64x2 x) {
 	return tan(x);
 }
+Float64x2 Float64x2_sinpi(Float64x2 x) {
+	return sinpi(x);
+}
+Float64x2 Float64x2_cospi(Float64x2 x) {
+	return cospi(x);
+}
+void Float64x2_sincospi(Float64x2 x, Float64x2* LDF_restrict p_sin, Float64x2* LDF_restrict p_cos) {
+	sincospi(x, *p_sin, *p_cos);
+}
+Float64x2 Float64x2_tanpi(Float64x2 x) {
+	return tanpi(x);
+}
 Float64x2 Float64x2_asin(Float64x2 x) {
 	return asin(x);
 }
@@ -1588,6 +2113,15 @@ Float64x2 Float64x2_tanh(Float64x2 x) {
 void Float64x2_sinhcosh(Float64x2 theta, Float64x2* LDF_restrict p_sinh, Float64x2* LDF_restrict p_cosh) {
 	sinhcosh(theta, *p_sinh, *p_cosh);
 }
+Float64x2 Float64x2_asinh(Float64x2 x) {
+	return asinh(x);
+}
+Float64x2 Float64x2_acosh(Float64x2 x) {
+	return acosh(x);
+}
+Float64x2 Float64x2_atanh(Float64x2 x) {
+	return atanh(x);
+}
 
 Float64x2 Float64x2_erf(Float64x2 x) {
 	return erf(x);
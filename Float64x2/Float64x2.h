@@ -25,12 +25,14 @@
 #include <fenv.h>
 
 #include "../LDF/LDF_restrict.h"
+#include "../LDF/LDF_fma.h"
 
 //------------------------------------------------------------------------------
 // Float64x2 struct
 //------------------------------------------------------------------------------
 
 #include "Float64x2_def.h"
+#include "../Float64/Float64_util.h"
 
 /**
  * @brief Allows for type punning
@@ -213,9 +215,9 @@ static inline Float64x2 Float64x2_negate(Float64x2 x) {
 }
 
 /**
- * @brief `x + y` Adds two Float64x2 values.
+ * @brief `x + y` Dekker's addition. Branches on `fabs(x.hi) > fabs(y.hi)`.
  */
-static inline Float64x2 Float64x2_add(const Float64x2 x, const Float64x2 y) {
+static inline Float64x2 Float64x2_add_dekker(const Float64x2 x, const Float64x2 y) {
 	fp64 r_hi = x.hi + y.hi;
 	fp64 r_lo = 0.0;
 	if (fabs(x.hi) > fabs(y.hi)) {
@@ -231,9 +233,9 @@ static inline Float64x2 Float64x2_add(const Float64x2 x, const Float64x2 y) {
 }
 
 /**
- * @brief `x - y` Subtracts two Float64x2 values.
+ * @brief `x - y` Dekker's subtraction. Branches on `fabs(x.hi) > fabs(y.hi)`.
  */
-static inline Float64x2 Float64x2_sub(const Float64x2 x, const Float64x2 y) {
+static inline Float64x2 Float64x2_sub_dekker(const Float64x2 x, const Float64x2 y) {
 	fp64 r_hi = x.hi - y.hi;
 	fp64 r_lo = 0.0;
 	if (fabs(x.hi) > fabs(y.hi)) {
@@ -248,6 +250,98 @@ static inline Float64x2 Float64x2_sub(const Float64x2 x, const Float64x2 y) {
 	return c;
 }
 
+/**
+ * @brief `x + y` Orginally dd_real::sloppy_add. Branch-free.
+ */
+static inline Float64x2 Float64x2_add_quick(const Float64x2 x, const Float64x2 y) {
+	fp64 e;
+	fp64 s = Float64_two_sum(x.hi, y.hi, &e);
+	e += x.lo + y.lo;
+
+	Float64x2 c;
+	c.hi = Float64_quick_two_sum(s, e, &c.lo);
+	return c;
+}
+
+/**
+ * @brief `x - y` Based on dd_real::sloppy_add. Branch-free.
+ */
+static inline Float64x2 Float64x2_sub_quick(const Float64x2 x, const Float64x2 y) {
+	fp64 e;
+	fp64 s = Float64_two_diff(x.hi, y.hi, &e);
+	e += x.lo - y.lo;
+
+	Float64x2 c;
+	c.hi = Float64_quick_two_sum(s, e, &c.lo);
+	return c;
+}
+
+/**
+ * @brief `x + y` Orginally dd_real::ieee_add. Branch-free, and satisfies an
+ * IEEE style error bound.
+ */
+static inline Float64x2 Float64x2_add_accurate(const Float64x2 x, const Float64x2 y) {
+	fp64 s2, t2;
+	fp64 s1 = Float64_two_sum(x.hi, y.hi, &s2);
+	fp64 t1 = Float64_two_sum(x.lo, y.lo, &t2);
+	s2 += t1;
+	s1 = Float64_quick_two_sum(s1, s2, &s2);
+	s2 += t2;
+
+	Float64x2 c;
+	c.hi = Float64_quick_two_sum(s1, s2, &c.lo);
+	return c;
+}
+
+/**
+ * @brief `x - y` Based on dd_real::ieee_add. Branch-free, and satisfies an
+ * IEEE style error bound.
+ */
+static inline Float64x2 Float64x2_sub_accurate(const Float64x2 x, const Float64x2 y) {
+	fp64 s2, t2;
+	fp64 s1 = Float64_two_diff(x.hi, y.hi, &s2);
+	fp64 t1 = Float64_two_diff(x.lo, y.lo, &t2);
+	s2 += t1;
+	s1 = Float64_quick_two_sum(s1, s2, &s2);
+	s2 += t2;
+
+	Float64x2 c;
+	c.hi = Float64_quick_two_sum(s1, s2, &c.lo);
+	return c;
+}
+
+/**
+ * @brief `x + y` Adds two Float64x2 values.
+ * @note Uses Float64x2_add_accurate when FLOAT64X2_IEEE_MODE is defined,
+ * Float64x2_add_dekker when FLOAT64X2_DEKKER_ADD is defined, and
+ * Float64x2_add_quick otherwise.
+ */
+static inline Float64x2 Float64x2_add(const Float64x2 x, const Float64x2 y) {
+	#if defined(FLOAT64X2_IEEE_MODE)
+		return Float64x2_add_accurate(x, y);
+	#elif defined(FLOAT64X2_DEKKER_ADD)
+		return Float64x2_add_dekker(x, y);
+	#else
+		return Float64x2_add_quick(x, y);
+	#endif
+}
+
+/**
+ * @brief `x - y` Subtracts two Float64x2 values.
+ * @note Uses Float64x2_sub_accurate when FLOAT64X2_IEEE_MODE is defined,
+ * Float64x2_sub_dekker when FLOAT64X2_DEKKER_ADD is defined, and
+ * Float64x2_sub_quick otherwise.
+ */
+static inline Float64x2 Float64x2_sub(const Float64x2 x, const Float64x2 y) {
+	#if defined(FLOAT64X2_IEEE_MODE)
+		return Float64x2_sub_accurate(x, y);
+	#elif defined(FLOAT64X2_DEKKER_ADD)
+		return Float64x2_sub_dekker(x, y);
+	#else
+		return Float64x2_sub_quick(x, y);
+	#endif
+}
+
 #if defined(FLOATNX2_BITWISE_SPLIT) || defined(FLOAT64X2_BITWISE_SPLIT)
 	/**
 	* @brief Splits the mantissa bits of a floating point value via bitwise
@@ -281,6 +375,12 @@ static inline Float64x2 Float64x2_sub(const Float64x2 x, const Float64x2 y) {
  * as a Float64x2.
  */
 static inline Float64x2 Float64x2_dekker_mul12(const fp64 x, const fp64 y) {
+#ifdef LDF_ENABLE_FMA
+	Float64x2 r;
+	r.hi = x * y;
+	r.lo = fma(x, y, -r.hi);
+	return r;
+#else
 	Float64x2 a = Float64x2_dekker_split(x);
 	Float64x2 b = Float64x2_dekker_split(y);
 	fp64 p = a.hi * b.hi;
@@ -290,6 +390,7 @@ static inline Float64x2 Float64x2_dekker_mul12(const fp64 x, const fp64 y) {
 	r.hi = p + q;
 	r.lo = p - r.hi + q + a.lo * b.lo;
 	return r;
+#endif
 }
 
 /**
@@ -324,6 +425,12 @@ static inline Float64x2 Float64x2_div(const Float64x2 x, const Float64x2 y) {
  * as a Float64x2 value.
  */
 static inline Float64x2 Float64x2_dekker_square12(const fp64 x) {
+#ifdef LDF_ENABLE_FMA
+	Float64x2 r;
+	r.hi = x * x;
+	r.lo = fma(x, x, -r.hi);
+	return r;
+#else
 	Float64x2 a = Float64x2_dekker_split(x);
 	fp64 p = a.hi * a.hi;
 	fp64 q = 2.0 * (a.hi * a.lo);
@@ -332,6 +439,7 @@ static inline Float64x2 Float64x2_dekker_square12(const fp64 x) {
 	r.hi = p + q;
 	r.lo = ((p - r.hi) + q) + (a.lo * a.lo);
 	return r;
+#endif
 }
 
 /**
@@ -1342,6 +1450,13 @@ Float64x2 Float64x2_cos(Float64x2 x);
 void Float64x2_sincos(Float64x2 x, Float64x2* LDF_restrict p_sin, Float64x2* LDF_restrict p_cos);
 Float64x2 Float64x2_tan(Float64x2 x);
 
+/** @brief Computes sin(pi * x) with an exact argument reduction */
+Float64x2 Float64x2_sinpi(Float64x2 x);
+/** @brief Computes cos(pi * x) with an exact argument reduction */
+Float64x2 Float64x2_cospi(Float64x2 x);
+void Float64x2_sincospi(Float64x2 x, Float64x2* LDF_restrict p_sin, Float64x2* LDF_restrict p_cos);
+Float64x2 Float64x2_tanpi(Float64x2 x);
+
 Float64x2 Float64x2_asin(Float64x2 x);
 Float64x2 Float64x2_acos(Float64x2 x);
 Float64x2 Float64x2_atan(Float64x2 x);
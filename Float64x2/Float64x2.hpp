@@ -18,6 +18,7 @@
 #include "Float64x2_def.h"
 
 #include "../LDF/LDF_arithmetic.hpp"
+#include "../LDF/LDF_fma.h"
 #include "Float64x2_input_limits.hpp"
 
 #include <cstdint>
@@ -198,12 +199,14 @@ inline constexpr bool isgreaterequal_zero(const Float64x2& x) {
 #endif
 
 //------------------------------------------------------------------------------
-// Float64x2 Basic Arithmetic
+// Float64x2 Addition
 //------------------------------------------------------------------------------
 
-template <> inline
-Float64x2 LDF::add<Float64x2, Float64x2, Float64x2>
-(const Float64x2& x, const Float64x2& y) {
+/**
+ * @brief Dekker's addition. Branches on `fabs(x.hi) > fabs(y.hi)` to compute
+ * the error of `x.hi + y.hi`.
+ */
+inline Float64x2 add_dekker(const Float64x2& x, const Float64x2& y) {
 	fp64 r_hi = x.hi + y.hi;
 	fp64 r_lo = static_cast<fp64>(0.0);
 	if (fabs(x.hi) > fabs(y.hi)) {
@@ -218,9 +221,11 @@ Float64x2 LDF::add<Float64x2, Float64x2, Float64x2>
 	return c;
 }
 
-template <> inline
-Float64x2 LDF::sub<Float64x2, Float64x2, Float64x2>
-(const Float64x2& x, const Float64x2& y) {
+/**
+ * @brief Dekker's subtraction. Branches on `fabs(x.hi) > fabs(y.hi)` to
+ * compute the error of `x.hi - y.hi`.
+ */
+inline Float64x2 sub_dekker(const Float64x2& x, const Float64x2& y) {
 	fp64 r_hi = x.hi - y.hi;
 	fp64 r_lo = static_cast<fp64>(0.0);
 	if (fabs(x.hi) > fabs(y.hi)) {
@@ -235,12 +240,150 @@ Float64x2 LDF::sub<Float64x2, Float64x2, Float64x2>
 	return c;
 }
 
+/**
+ * @brief Orginally dd_real::sloppy_add. Branch-free, uses two_sum on the
+ * high parts.
+ */
+inline Float64x2 add_quick(const Float64x2& x, const Float64x2& y) {
+	/* two_sum */
+	fp64 s = x.hi + y.hi;
+	fp64 v = s - x.hi;
+	fp64 e = (x.hi - (s - v)) + (y.hi - v);
+
+	e += x.lo + y.lo;
+
+	/* quick_two_sum */
+	Float64x2 c;
+	c.hi = s + e;
+	c.lo = e - (c.hi - s);
+	return c;
+}
+
+/**
+ * @brief Based on dd_real::sloppy_add. Branch-free, uses two_diff on the
+ * high parts.
+ */
+inline Float64x2 sub_quick(const Float64x2& x, const Float64x2& y) {
+	/* two_diff */
+	fp64 s = x.hi - y.hi;
+	fp64 v = s - x.hi;
+	fp64 e = (x.hi - (s - v)) - (y.hi + v);
+
+	e += x.lo - y.lo;
+
+	/* quick_two_sum */
+	Float64x2 c;
+	c.hi = s + e;
+	c.lo = e - (c.hi - s);
+	return c;
+}
+
+/**
+ * @brief Orginally dd_real::ieee_add. Branch-free, uses two_sum on both the
+ * high and low parts.
+ */
+inline Float64x2 add_accurate(const Float64x2& x, const Float64x2& y) {
+	/* two_sum */
+	fp64 s1 = x.hi + y.hi;
+	fp64 v = s1 - x.hi;
+	fp64 s2 = (x.hi - (s1 - v)) + (y.hi - v);
+
+	/* two_sum */
+	fp64 t1 = x.lo + y.lo;
+	v = t1 - x.lo;
+	fp64 t2 = (x.lo - (t1 - v)) + (y.lo - v);
+
+	s2 += t1;
+	/* quick_two_sum */
+	v = s1 + s2;
+	s2 = s2 - (v - s1);
+	s1 = v;
+
+	s2 += t2;
+	/* quick_two_sum */
+	Float64x2 c;
+	c.hi = s1 + s2;
+	c.lo = s2 - (c.hi - s1);
+	return c;
+}
+
+/**
+ * @brief Based on dd_real::ieee_add. Branch-free, uses two_diff on both the
+ * high and low parts.
+ */
+inline Float64x2 sub_accurate(const Float64x2& x, const Float64x2& y) {
+	/* two_diff */
+	fp64 s1 = x.hi - y.hi;
+	fp64 v = s1 - x.hi;
+	fp64 s2 = (x.hi - (s1 - v)) - (y.hi + v);
+
+	/* two_diff */
+	fp64 t1 = x.lo - y.lo;
+	v = t1 - x.lo;
+	fp64 t2 = (x.lo - (t1 - v)) - (y.lo + v);
+
+	s2 += t1;
+	/* quick_two_sum */
+	v = s1 + s2;
+	s2 = s2 - (v - s1);
+	s1 = v;
+
+	s2 += t2;
+	/* quick_two_sum */
+	Float64x2 c;
+	c.hi = s1 + s2;
+	c.lo = s2 - (c.hi - s1);
+	return c;
+}
+
+//------------------------------------------------------------------------------
+// Float64x2 Basic Arithmetic
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Uses add_accurate when FLOAT64X2_IEEE_MODE is defined, add_dekker
+ * when FLOAT64X2_DEKKER_ADD is defined, and add_quick otherwise.
+ */
+template <> inline
+Float64x2 LDF::add<Float64x2, Float64x2, Float64x2>
+(const Float64x2& x, const Float64x2& y) {
+	#if defined(FLOAT64X2_IEEE_MODE)
+		return add_accurate(x, y);
+	#elif defined(FLOAT64X2_DEKKER_ADD)
+		return add_dekker(x, y);
+	#else
+		return add_quick(x, y);
+	#endif
+}
+
+/**
+ * @brief Uses sub_accurate when FLOAT64X2_IEEE_MODE is defined, sub_dekker
+ * when FLOAT64X2_DEKKER_ADD is defined, and sub_quick otherwise.
+ */
+template <> inline
+Float64x2 LDF::sub<Float64x2, Float64x2, Float64x2>
+(const Float64x2& x, const Float64x2& y) {
+	#if defined(FLOAT64X2_IEEE_MODE)
+		return sub_accurate(x, y);
+	#elif defined(FLOAT64X2_DEKKER_ADD)
+		return sub_dekker(x, y);
+	#else
+		return sub_quick(x, y);
+	#endif
+}
+
 /**
  * @brief Multiplies two fp64 values with result stored as a Float64x2
  */
 template <> inline
 Float64x2 LDF::mul<Float64x2, fp64, fp64>
 (const fp64& x, const fp64& y) {
+#ifdef LDF_ENABLE_FMA
+	Float64x2 r;
+	r.hi = x * y;
+	r.lo = std::fma(x, y, -r.hi);
+	return r;
+#else
 	Float64x2 a = dekker_split(x);
 	Float64x2 b = dekker_split(y);
 	fp64 p = a.hi * b.hi;
@@ -250,6 +393,7 @@ Float64x2 LDF::mul<Float64x2, fp64, fp64>
 	r.hi = p + q;
 	r.lo = p - r.hi + q + a.lo * b.lo;
 	return r;
+#endif
 }
 
 template <> inline
@@ -283,6 +427,12 @@ Float64x2 LDF::div<Float64x2, Float64x2, Float64x2>
 template <> inline
 Float64x2 LDF::square<Float64x2, fp64>
 (const fp64& x) {
+#ifdef LDF_ENABLE_FMA
+	Float64x2 r;
+	r.hi = x * x;
+	r.lo = std::fma(x, x, -r.hi);
+	return r;
+#else
 	Float64x2 a = dekker_split(x);
 	fp64 p = a.hi * a.hi;
 	fp64 q = static_cast<fp64>(2.0) * (a.hi * a.lo);
@@ -291,6 +441,7 @@ Float64x2 LDF::square<Float64x2, fp64>
 	r.hi = p + q;
 	r.lo = ((p - r.hi) + q) + (a.lo * a.lo);
 	return r;
+#endif
 }
 
 template <> inline
@@ -1145,6 +1296,32 @@ namespace std {
 		// return static_cast<Float64x2>(tan(ret));
 	}
 
+	/**
+	 * @brief Calculates `sin(pi * x)`. The argument is reduced exactly, so
+	 * there is no rounding error from multiplying `x` by pi.
+	 */
+	Float64x2 sinpi(const Float64x2& x);
+	/**
+	 * @brief Calculates `cos(pi * x)`. The argument is reduced exactly, so
+	 * there is no rounding error from multiplying `x` by pi.
+	 */
+	Float64x2 cospi(const Float64x2& x);
+
+	/**
+	 * @brief Simultaneously calculates `sinpi(x)` and `cospi(x)`.
+	 */
+	void sincospi(const Float64x2& x, Float64x2& p_sin, Float64x2& p_cos);
+
+	/**
+	 * @brief Calculates `tan(pi * x)`.
+	 * @remarks Calls `sincospi` and does `sin / cos` to calculate `tanpi(x)`
+	 */
+	inline Float64x2 tanpi(const Float64x2& x) {
+		Float64x2 sin_val, cos_val;
+		sincospi(x, sin_val, cos_val);
+		return sin_val / cos_val;
+	}
+
 	Float64x2 asin (const Float64x2& x);
 	Float64x2 acos (const Float64x2& x);
 	Float64x2 atan (const Float64x2& x);
@@ -18,6 +18,7 @@
 
 #include "Float64x2_def.h"
 #include "../Float64/Float64_AVX.h"
+#include "../LDF/LDF_fma.h"
 
 #include <stdint.h>
 
@@ -1066,27 +1067,36 @@ static inline __m256dx2 _mm256x2_dekker_split_pd(__m256d x) {
 // }
 
 static inline __m256dx2 _mm256x2_dekker_mul12_pd(__m256d x, __m256d y) {
-	__m256dx2 a = _mm256x2_dekker_split_pd(x);
-	__m256dx2 b = _mm256x2_dekker_split_pd(y);
-	__m256d p = _mm256_mul_pd(a.hi, b.hi);
-	__m256d q = _mm256_add_pd(
-		_mm256_mul_pd(a.hi, b.lo), _mm256_mul_pd(a.lo, b.hi)
-	);
-
 	__m256dx2 r;
-	r.hi = _mm256_add_pd(p, q);
-	r.lo = _mm256_add_pd(
-		_mm256_add_pd(_mm256_sub_pd(p, r.hi), q),
-		_mm256_mul_pd(a.lo, b.lo)
-	);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		r.hi = _mm256_mul_pd(x, y);
+		r.lo = _mm256_fmsub_pd(x, y, r.hi);
+	#else
+		__m256dx2 a = _mm256x2_dekker_split_pd(x);
+		__m256dx2 b = _mm256x2_dekker_split_pd(y);
+		__m256d p = _mm256_mul_pd(a.hi, b.hi);
+		__m256d q = _mm256_add_pd(
+			_mm256_mul_pd(a.hi, b.lo), _mm256_mul_pd(a.lo, b.hi)
+		);
+
+		r.hi = _mm256_add_pd(p, q);
+		r.lo = _mm256_add_pd(
+			_mm256_add_pd(_mm256_sub_pd(p, r.hi), q),
+			_mm256_mul_pd(a.lo, b.lo)
+		);
+	#endif
 	return r;
 }
 
 static inline __m256dx2 _mm256x2_mul_pdx2(__m256dx2 x, __m256dx2 y) {
 	__m256dx2 t = _mm256x2_dekker_mul12_pd(x.hi, y.hi);
-	__m256d c = _mm256_add_pd(_mm256_add_pd(
-		_mm256_mul_pd(x.hi, y.lo), _mm256_mul_pd(x.lo, y.hi)
-	), t.lo);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		__m256d c = _mm256_fmadd_pd(x.hi, y.lo, _mm256_fmadd_pd(x.lo, y.hi, t.lo));
+	#else
+		__m256d c = _mm256_add_pd(_mm256_add_pd(
+			_mm256_mul_pd(x.hi, y.lo), _mm256_mul_pd(x.lo, y.hi)
+		), t.lo);
+	#endif
 
 	__m256dx2 r;
 	r.hi = _mm256_add_pd(t.hi, c);
@@ -1096,11 +1106,18 @@ static inline __m256dx2 _mm256x2_mul_pdx2(__m256dx2 x, __m256dx2 y) {
 
 static inline __m256dx2 _mm256x2_div_pdx2(__m256dx2 x, __m256dx2 y) {
 	__m256d u = _mm256_div_pd(x.hi, y.hi);
-	__m256dx2 t = _mm256x2_dekker_mul12_pd(u, y.hi);
-	__m256d l = _mm256_div_pd(_mm256_sub_pd(
-		_mm256_add_pd(_mm256_sub_pd(_mm256_sub_pd(x.hi, t.hi), t.lo), x.lo),
-		_mm256_mul_pd(u, y.lo)
-	), y.hi);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		/* x.hi - u * y.hi is exact */
+		__m256d l = _mm256_div_pd(_mm256_fnmadd_pd(u, y.lo,
+			_mm256_add_pd(_mm256_fnmadd_pd(u, y.hi, x.hi), x.lo)
+		), y.hi);
+	#else
+		__m256dx2 t = _mm256x2_dekker_mul12_pd(u, y.hi);
+		__m256d l = _mm256_div_pd(_mm256_sub_pd(
+			_mm256_add_pd(_mm256_sub_pd(_mm256_sub_pd(x.hi, t.hi), t.lo), x.lo),
+			_mm256_mul_pd(u, y.lo)
+		), y.hi);
+	#endif
 
 	__m256dx2 r;
 	r.hi = _mm256_add_pd(u, l);
@@ -1109,26 +1126,35 @@ static inline __m256dx2 _mm256x2_div_pdx2(__m256dx2 x, __m256dx2 y) {
 }
 
 static inline __m256dx2 _mm256x2_dekker_square12_pd(__m256d x) {
-	__m256dx2 a = _mm256x2_dekker_split_pd(x);
-	__m256d p = _mm256_mul_pd(a.hi, a.hi);
-	__m256d q = _mm256_mul_pd(
-		_mm256_set1_pd(2.0), _mm256_mul_pd(a.hi, a.lo)
-	);
-
 	__m256dx2 r;
-	r.hi = _mm256_add_pd(p, q);
-	r.lo = _mm256_add_pd(
-		_mm256_add_pd(_mm256_sub_pd(p, r.hi), q),
-		_mm256_mul_pd(a.lo, a.lo)
-	);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		r.hi = _mm256_mul_pd(x, x);
+		r.lo = _mm256_fmsub_pd(x, x, r.hi);
+	#else
+		__m256dx2 a = _mm256x2_dekker_split_pd(x);
+		__m256d p = _mm256_mul_pd(a.hi, a.hi);
+		__m256d q = _mm256_mul_pd(
+			_mm256_set1_pd(2.0), _mm256_mul_pd(a.hi, a.lo)
+		);
+
+		r.hi = _mm256_add_pd(p, q);
+		r.lo = _mm256_add_pd(
+			_mm256_add_pd(_mm256_sub_pd(p, r.hi), q),
+			_mm256_mul_pd(a.lo, a.lo)
+		);
+	#endif
 	return r;
 }
 
 static inline __m256dx2 _mm256x2_square_pdx2(__m256dx2 x) {
 	__m256dx2 t = _mm256x2_dekker_square12_pd(x.hi);
-	__m256d c = _mm256_add_pd(
-		_mm256_mul_pd(_mm256_set1_pd(2.0), _mm256_mul_pd(x.hi, x.lo)), t.lo
-	);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		__m256d c = _mm256_fmadd_pd(_mm256_add_pd(x.hi, x.hi), x.lo, t.lo);
+	#else
+		__m256d c = _mm256_add_pd(
+			_mm256_mul_pd(_mm256_set1_pd(2.0), _mm256_mul_pd(x.hi, x.lo)), t.lo
+		);
+	#endif
 
 	__m256dx2 r;
 	r.hi = _mm256_add_pd(t.hi, c);
@@ -1138,11 +1164,18 @@ static inline __m256dx2 _mm256x2_square_pdx2(__m256dx2 x) {
 
 static inline __m256dx2 _mm256x2_recip_pdx2(__m256dx2 y) {
 	__m256d u = _mm256_div_pd(_mm256_set1_pd(1.0), y.hi);
-	__m256dx2 t = _mm256x2_dekker_mul12_pd(u, y.hi);
-	__m256d l = _mm256_div_pd(_mm256_sub_pd(
-		_mm256_sub_pd(_mm256_sub_pd(_mm256_set1_pd(1.0), t.hi), t.lo),
-		_mm256_mul_pd(u, y.lo)
-	), y.hi);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		/* 1.0 - u * y.hi is exact */
+		__m256d l = _mm256_div_pd(_mm256_fnmadd_pd(u, y.lo,
+			_mm256_fnmadd_pd(u, y.hi, _mm256_set1_pd(1.0))
+		), y.hi);
+	#else
+		__m256dx2 t = _mm256x2_dekker_mul12_pd(u, y.hi);
+		__m256d l = _mm256_div_pd(_mm256_sub_pd(
+			_mm256_sub_pd(_mm256_sub_pd(_mm256_set1_pd(1.0), t.hi), t.lo),
+			_mm256_mul_pd(u, y.lo)
+		), y.hi);
+	#endif
 
 	__m256dx2 r;
 	r.hi = _mm256_add_pd(u, l);
@@ -1286,7 +1319,11 @@ static inline __m256dx2 _mm256x2_sub_pd_pd(__m256d x, __m256d y) {
 
 static inline __m256dx2 _mm256x2_mul_pdx2_pd(__m256dx2 x, __m256d y) {
 	__m256dx2 t = _mm256x2_dekker_mul12_pd(x.hi, y);
-	__m256d c = _mm256_add_pd(_mm256_mul_pd(x.lo, y), t.lo);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		__m256d c = _mm256_fmadd_pd(x.lo, y, t.lo);
+	#else
+		__m256d c = _mm256_add_pd(_mm256_mul_pd(x.lo, y), t.lo);
+	#endif
 
 	__m256dx2 r;
 	r.hi = _mm256_add_pd(t.hi, c);
@@ -1296,7 +1333,11 @@ static inline __m256dx2 _mm256x2_mul_pdx2_pd(__m256dx2 x, __m256d y) {
 
 static inline __m256dx2 _mm256x2_mul_pd_pdx2(__m256d x, __m256dx2 y) {
 	__m256dx2 t = _mm256x2_dekker_mul12_pd(x, y.hi);
-	__m256d c = _mm256_add_pd(_mm256_mul_pd(x, y.lo), t.lo);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		__m256d c = _mm256_fmadd_pd(x, y.lo, t.lo);
+	#else
+		__m256d c = _mm256_add_pd(_mm256_mul_pd(x, y.lo), t.lo);
+	#endif
 
 	__m256dx2 r;
 	r.hi = _mm256_add_pd(t.hi, c);
@@ -1313,10 +1354,16 @@ static inline __m256dx2 _mm256x2_mul_pd_pd(__m256d x, __m256d y) {
 
 static inline __m256dx2 _mm256x2_div_pdx2_pd(__m256dx2 x, __m256d y) {
 	__m256d u = _mm256_div_pd(x.hi, y);
-	__m256dx2 t = _mm256x2_dekker_mul12_pd(u, y);
-	__m256d l = _mm256_div_pd(
-		_mm256_add_pd(_mm256_sub_pd(_mm256_sub_pd(x.hi, t.hi), t.lo), x.lo), y
-	);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		__m256d l = _mm256_div_pd(
+			_mm256_add_pd(_mm256_fnmadd_pd(u, y, x.hi), x.lo), y
+		);
+	#else
+		__m256dx2 t = _mm256x2_dekker_mul12_pd(u, y);
+		__m256d l = _mm256_div_pd(
+			_mm256_add_pd(_mm256_sub_pd(_mm256_sub_pd(x.hi, t.hi), t.lo), x.lo), y
+		);
+	#endif
 
 	__m256dx2 r;
 	r.hi = _mm256_add_pd(u, l);
@@ -1326,11 +1373,17 @@ static inline __m256dx2 _mm256x2_div_pdx2_pd(__m256dx2 x, __m256d y) {
 
 static inline __m256dx2 _mm256x2_div_pd_pdx2(__m256d x, __m256dx2 y) {
 	__m256d u = _mm256_div_pd(x, y.hi);
-	__m256dx2 t = _mm256x2_dekker_mul12_pd(u, y.hi);
-	__m256d l = _mm256_div_pd(_mm256_sub_pd(
-		_mm256_sub_pd(_mm256_sub_pd(x, t.hi), t.lo),
-		_mm256_mul_pd(u, y.lo)
-	), y.hi);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		__m256d l = _mm256_div_pd(_mm256_fnmadd_pd(u, y.lo,
+			_mm256_fnmadd_pd(u, y.hi, x)
+		), y.hi);
+	#else
+		__m256dx2 t = _mm256x2_dekker_mul12_pd(u, y.hi);
+		__m256d l = _mm256_div_pd(_mm256_sub_pd(
+			_mm256_sub_pd(_mm256_sub_pd(x, t.hi), t.lo),
+			_mm256_mul_pd(u, y.lo)
+		), y.hi);
+	#endif
 
 	__m256dx2 r;
 	r.hi = _mm256_add_pd(u, l);
@@ -1343,10 +1396,14 @@ static inline __m256dx2 _mm256x2_div_pd_pdx2(__m256d x, __m256dx2 y) {
  */
 static inline __m256dx2 _mm256x2_div_pd_pd(__m256d x, __m256d y) {
 	__m256d u = _mm256_div_pd(x, y);
-	__m256dx2 t = _mm256x2_dekker_mul12_pd(u, y);
-	__m256d l = _mm256_div_pd(
-		_mm256_sub_pd(_mm256_sub_pd(x, t.hi), t.lo), y
-	);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		__m256d l = _mm256_div_pd(_mm256_fnmadd_pd(u, y, x), y);
+	#else
+		__m256dx2 t = _mm256x2_dekker_mul12_pd(u, y);
+		__m256d l = _mm256_div_pd(
+			_mm256_sub_pd(_mm256_sub_pd(x, t.hi), t.lo), y
+		);
+	#endif
 
 	__m256dx2 r;
 	r.hi = _mm256_add_pd(u, l);
@@ -1367,10 +1424,16 @@ static inline __m256dx2 _mm256x2_square_pd(__m256d x) {
  */
 static inline __m256dx2 _mm256x2_recip_pd(__m256d y) {
 	__m256d u = _mm256_div_pd(_mm256_set1_pd(1.0), y);
-	__m256dx2 t = _mm256x2_dekker_mul12_pd(u, y);
-	__m256d l = _mm256_div_pd(
-		_mm256_sub_pd(_mm256_sub_pd(_mm256_set1_pd(1.0), t.hi), t.lo), y
-	);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		__m256d l = _mm256_div_pd(
+			_mm256_fnmadd_pd(u, y, _mm256_set1_pd(1.0)), y
+		);
+	#else
+		__m256dx2 t = _mm256x2_dekker_mul12_pd(u, y);
+		__m256d l = _mm256_div_pd(
+			_mm256_sub_pd(_mm256_sub_pd(_mm256_set1_pd(1.0), t.hi), t.lo), y
+		);
+	#endif
 
 	__m256dx2 r;
 	r.hi = _mm256_add_pd(u, l);
@@ -1642,17 +1705,14 @@ static inline __m256dx2 _mm256x2_const_phi_pdx2(void) {
 static inline __m256dx2 _mm256x2_fmax_pdx2(__m256dx2 x, __m256dx2 y) {
 	__m256d fmax_cmp =
 		_mm256_or_pd(
-			_mm256_andnot_pd(
-				_mm256_or_pd(
-					_mm256_andnot_pd(
-						_mm256_signbit_pdx2(x),
-						_mm256_isnan_pdx2(y)
-					),
-					_mm256_isnan_pdx2(x)
-				),
-				_mm256_cmplt_pdx2(y, x)
+			_mm256_or_pd(
+				_mm256_cmplt_pdx2(x, y),
+				_mm256_isnan_pdx2(x)
 			),
-			_mm256_cmplt_pdx2(x, y)
+			_mm256_and_pd(
+				_mm256_signbit_pdx2(x),
+				_mm256_cmpeq_pdx2(x, y)
+			)
 		);
 	__m256dx2 ret;
 	ret.hi = _mm256_blendv_pd(x.hi, y.hi, fmax_cmp);
@@ -1667,17 +1727,14 @@ static inline __m256dx2 _mm256x2_fmax_pdx2(__m256dx2 x, __m256dx2 y) {
 static inline __m256dx2 _mm256x2_fmin_pdx2(__m256dx2 x, __m256dx2 y) {
 	__m256d fmin_cmp =
 		_mm256_or_pd(
-			_mm256_andnot_pd(
-				_mm256_or_pd(
-					_mm256_andnot_pd(
-						_mm256_signbit_pdx2(x),
-						_mm256_isnan_pdx2(y)
-					),
-					_mm256_isnan_pdx2(x)
-				),
-				_mm256_cmpgt_pdx2(y, x)
+			_mm256_or_pd(
+				_mm256_cmpgt_pdx2(x, y),
+				_mm256_isnan_pdx2(x)
 			),
-			_mm256_cmpgt_pdx2(x, y)
+			_mm256_andnot_pd(
+				_mm256_signbit_pdx2(x),
+				_mm256_cmpeq_pdx2(x, y)
+			)
 		);
 	__m256dx2 ret;
 	ret.hi = _mm256_blendv_pd(x.hi, y.hi, fmin_cmp);
@@ -1935,34 +1992,27 @@ static inline __m256dx2 _mm256x2_frexp_pdx2_epi32(__m256dx2 x, __m128i* const ex
 // __m256dx2 exponents and logarithms
 //------------------------------------------------------------------------------
 
-/** @note This function doesn't use AVX for calculations */
 __m256dx2 _mm256x2_exp_pdx2(__m256dx2 x);
 
-/** @note This function doesn't use AVX for calculations */
 __m256dx2 _mm256x2_expm1_pdx2(__m256dx2 x);
 
-/** @note This function doesn't use AVX for calculations */
 static inline __m256dx2 _mm256x2_exp2_pdx2(const __m256dx2 x) {
 	return _mm256x2_exp_pdx2(_mm256x2_mul_pdx2(x, _mm256x2_const_ln2_pdx2()));
 }
 
-/** @note This function doesn't use AVX for calculations */
 static inline __m256dx2 _mm256x2_exp10_pdx2(const __m256dx2 x) {
 	return _mm256x2_exp_pdx2(_mm256x2_mul_pdx2(x, _mm256x2_const_ln10_pdx2()));
 }
 
-/** @note This function doesn't use AVX for calculations */
+/** @note The initial guess is calculated with _mm256_log_pd */
 __m256dx2 _mm256x2_log_pdx2(__m256dx2 x);
 
-/** @note This function doesn't use AVX for calculations */
 __m256dx2 _mm256x2_log1p_pdx2(__m256dx2 x);
 
-/** @note This function doesn't use AVX for calculations */
 static inline __m256dx2 _mm256x2_log2_pdx2(const __m256dx2 x) {
 	return _mm256x2_mul_pdx2(_mm256x2_log_pdx2(x), _mm256x2_const_log2e_pdx2());
 }
 
-/** @note This function doesn't use AVX for calculations */
 static inline __m256dx2 _mm256x2_log10_pdx2(const __m256dx2 x) {
 	return _mm256x2_mul_pdx2(_mm256x2_log_pdx2(x), _mm256x2_const_log10e_pdx2());
 }
@@ -1991,14 +2041,11 @@ __m256dx2 _mm256x2_pow_pdx2_pd(__m256dx2 x, __m256d y);
 // __m256dx2 trigonometry
 //------------------------------------------------------------------------------
 
-/** @note This function doesn't use AVX for calculations */
 __m256dx2 _mm256x2_sin_pdx2(__m256dx2 x);
 
-/** @note This function doesn't use AVX for calculations */
 __m256dx2 _mm256x2_cos_pdx2(__m256dx2 x);
 
 /**
- * @note This function doesn't use AVX for calculations
  * @warning p_sin and p_cos must be aligned on a 32-byte boundary or a
  * general-protection exception may be generated.
  */
@@ -2006,70 +2053,97 @@ void _mm256x2_sincos_pdx2(
 	__m256dx2 theta, __m256dx2* p_sin, __m256dx2* p_cos
 );
 
-/** @note This function doesn't use AVX for calculations */
 static inline __m256dx2 _mm256x2_tan_pdx2(__m256dx2 x) {
 	__m256dx2 t_sin, t_cos;
 	_mm256x2_sincos_pdx2(x, &t_sin, &t_cos);
 	return _mm256x2_div_pdx2(t_sin, t_cos);
 }
 
-/** @note This function doesn't use AVX for calculations */
+/** @brief Computes sin(pi * x) with an exact argument reduction */
+__m256dx2 _mm256x2_sinpi_pdx2(__m256dx2 x);
+
+/** @brief Computes cos(pi * x) with an exact argument reduction */
+__m256dx2 _mm256x2_cospi_pdx2(__m256dx2 x);
+
+/**
+ * @warning p_sin and p_cos must be aligned on a 32-byte boundary or a
+ * general-protection exception may be generated.
+ */
+void _mm256x2_sincospi_pdx2(
+	__m256dx2 x, __m256dx2* p_sin, __m256dx2* p_cos
+);
+
+static inline __m256dx2 _mm256x2_tanpi_pdx2(__m256dx2 x) {
+	__m256dx2 t_sin, t_cos;
+	_mm256x2_sincospi_pdx2(x, &t_sin, &t_cos);
+	return _mm256x2_div_pdx2(t_sin, t_cos);
+}
+
 __m256dx2 _mm256x2_asin_pdx2(__m256dx2 x);
 
-/** @note This function doesn't use AVX for calculations */
 __m256dx2 _mm256x2_acos_pdx2(__m256dx2 x);
 
-/** @note This function doesn't use AVX for calculations */
 __m256dx2 _mm256x2_atan_pdx2(__m256dx2 x);
 
-/** @note This function doesn't use AVX for calculations */
 __m256dx2 _mm256x2_atan2_pdx2(__m256dx2 y, __m256dx2 x);
 
-/** @note sinh is inaccurate when x is close to 0, which is why it isn't inlined */
 __m256dx2 _mm256x2_sinh_pdx2(__m256dx2 x);
 
-/** @note This function doesn't use AVX for calculations */
-static inline __m256dx2 _mm256x2_cosh_pdx2(__m256dx2 x) {
-	__m256dx2 exp_x = _mm256x2_exp_pdx2(x);
-	return _mm256x2_mul_power2_pdx2_pd(
-		_mm256x2_add_pdx2(exp_x, _mm256x2_recip_pdx2(exp_x)),
-	_mm256_set1_pd(0.5));
-}
+__m256dx2 _mm256x2_cosh_pdx2(__m256dx2 x);
 
-/** @note This function doesn't use AVX for calculations */
 __m256dx2 _mm256x2_tanh_pdx2(__m256dx2 x);
 
 /**
- * @note This function doesn't use AVX for calculations
- * @warning p_sin and p_cos must be aligned on a 32-byte boundary or a
+ * @warning p_sinh and p_cosh must be aligned on a 32-byte boundary or a
  * general-protection exception may be generated.
  */
 void _mm256x2_sinhcosh_pdx2(
 	__m256dx2 theta, __m256dx2* p_sinh, __m256dx2* p_cosh
 );
 
-/** @note This function doesn't use AVX for calculations */
+/**
+ * @brief asinh(|x|) = log1p(|x| + x^2 / (1 + sqrt(x^2 + 1)))
+ * @note log1p(2|x|) is used when x^2 would overflow
+ */
 static inline __m256dx2 _mm256x2_asinh_pdx2(__m256dx2 x) {
-	return _mm256x2_log_pdx2(_mm256x2_add_pdx2(x,
-		_mm256x2_sqrt_pdx2(
-			_mm256x2_sub_pdx2_pd(_mm256x2_square_pdx2(x), _mm256_set1_pd(1.0))
-		)
-	));
+	const __m256dx2 abs_x = _mm256x2_fabs_pdx2(x);
+	const __m256dx2 x_squared = _mm256x2_square_pdx2(x);
+	__m256dx2 arg = _mm256x2_add_pdx2(abs_x,
+		_mm256x2_div_pdx2(x_squared, _mm256x2_add_pd_pdx2(_mm256_set1_pd(1.0),
+			_mm256x2_sqrt_pdx2(_mm256x2_add_pdx2_pd(x_squared, _mm256_set1_pd(1.0)))
+		))
+	);
+	const __m256d x_huge = _mm256_cmp_pd(abs_x.hi, _mm256_set1_pd(0x1.0p+500), _CMP_GT_OQ);
+	const __m256dx2 arg_huge = _mm256x2_mul_power2_pdx2_pd(abs_x, _mm256_set1_pd(2.0));
+	arg.hi = _mm256_blendv_pd(arg.hi, arg_huge.hi, x_huge);
+	arg.lo = _mm256_blendv_pd(arg.lo, arg_huge.lo, x_huge);
+	return _mm256x2_copysign_pdx2(_mm256x2_log1p_pdx2(arg), x);
 }
 
-/** @note This function doesn't use AVX for calculations */
+/**
+ * @brief acosh(x) = log1p((x - 1) + sqrt((x - 1) * (x + 1)))
+ * @note log1p(2x) is used when x^2 would overflow
+ */
 static inline __m256dx2 _mm256x2_acosh_pdx2(__m256dx2 x) {
-	return _mm256x2_log_pdx2(_mm256x2_add_pdx2(x,
-		_mm256x2_sqrt_pdx2(
-			_mm256x2_add_pdx2_pd(_mm256x2_square_pdx2(x), _mm256_set1_pd(1.0))
-		)
-	));
+	const __m256dx2 x_m1 = _mm256x2_sub_pdx2_pd(x, _mm256_set1_pd(1.0));
+	__m256dx2 arg = _mm256x2_add_pdx2(x_m1,
+		_mm256x2_sqrt_pdx2(_mm256x2_mul_pdx2(
+			x_m1, _mm256x2_add_pdx2_pd(x, _mm256_set1_pd(1.0))
+		))
+	);
+	const __m256d x_huge = _mm256_cmp_pd(x.hi, _mm256_set1_pd(0x1.0p+500), _CMP_GT_OQ);
+	const __m256dx2 arg_huge = _mm256x2_mul_power2_pdx2_pd(x, _mm256_set1_pd(2.0));
+	arg.hi = _mm256_blendv_pd(arg.hi, arg_huge.hi, x_huge);
+	arg.lo = _mm256_blendv_pd(arg.lo, arg_huge.lo, x_huge);
+	return _mm256x2_log1p_pdx2(arg);
 }
 
-/** @note This function doesn't use AVX for calculations */
+/**
+ * @brief atanh(x) = log1p(2x / (1 - x)) / 2
+ */
 static inline __m256dx2 _mm256x2_atanh_pdx2(__m256dx2 x) {
-	return _mm256x2_mul_power2_pdx2_pd(_mm256x2_log_pdx2(_mm256x2_div_pdx2(
-			_mm256x2_add_pd_pdx2(_mm256_set1_pd(1.0), x),
+	return _mm256x2_mul_power2_pdx2_pd(_mm256x2_log1p_pdx2(_mm256x2_div_pdx2(
+			_mm256x2_mul_power2_pdx2_pd(x, _mm256_set1_pd(2.0)),
 			_mm256x2_sub_pd_pdx2(_mm256_set1_pd(1.0), x)
 	)), _mm256_set1_pd(0.5));
 }
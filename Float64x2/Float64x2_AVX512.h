@@ -0,0 +1,1700 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+#ifndef FLOAT64X2_AVX512_H
+#define FLOAT64X2_AVX512_H
+
+/**
+ * @brief Double-Float64 AVX512 Dekker Float implementation.
+ * Source: Creel "Double it Like Dekker" on YouTube.
+ *
+ * @note Requires AVX512F or later. AVX512F always provides FMA, so the
+ * error-free products use _mm512_fmsub_pd directly.
+ * @note Comparisons return a __mmask8 instead of a __m512d bitmask.
+ * @warning -Ofast may break this library. -O3 compiles okay on gcc and clang.
+ */
+
+#include "Float64x2_def.h"
+#include "../Float64/Float64_AVX512.h"
+
+#include <stdint.h>
+
+#if (!defined(__AVX512F__) && defined(__GNUC__))
+	#error "__AVX512F__ is not enabled in your compiler. Try -mavx512f"
+#endif
+
+#include <immintrin.h>
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+//------------------------------------------------------------------------------
+// __m512dx2 struct
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Holds eight Double-Float64 dekker floats
+ */
+typedef struct __m512dx2 {
+	__m512d hi;
+	__m512d lo;
+} __m512dx2;
+
+//------------------------------------------------------------------------------
+// __m512dx2 set1 functions
+//------------------------------------------------------------------------------
+
+static inline __m512dx2 _mm512x2_setzero_pdx2(void) {
+	__m512dx2 ret;
+	ret.hi = _mm512_setzero_pd();
+	ret.lo = _mm512_setzero_pd();
+	return ret;
+}
+
+static inline __m512dx2 _mm512x2_set1_pdx2(Float64x2 val) {
+	__m512dx2 ret;
+	ret.hi = _mm512_set1_pd(val.hi);
+	ret.lo = _mm512_set1_pd(val.lo);
+	return ret;
+}
+
+static inline __m512dx2 _mm512x2_set1_pd(double x) {
+	__m512dx2 ret;
+	ret.hi = _mm512_set1_pd(x);
+	ret.lo = _mm512_setzero_pd();
+	return ret;
+}
+
+static inline __m512dx2 _mm512x2_set1_epi64(long long x) {
+	__m512dx2 ret;
+	ret.hi = _mm512_castsi512_pd(_mm512_set1_epi64(x));
+	ret.lo = _mm512_castsi512_pd(_mm512_set1_epi64(x));
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx2 set functions
+//------------------------------------------------------------------------------
+
+static inline __m512dx2 _mm512x2_set_pdx2(
+	Float64x2 e7, Float64x2 e6, Float64x2 e5, Float64x2 e4,
+	Float64x2 e3, Float64x2 e2, Float64x2 e1, Float64x2 e0
+) {
+	__m512dx2 ret;
+	ret.hi = _mm512_set_pd(e7.hi, e6.hi, e5.hi, e4.hi, e3.hi, e2.hi, e1.hi, e0.hi);
+	ret.lo = _mm512_set_pd(e7.lo, e6.lo, e5.lo, e4.lo, e3.lo, e2.lo, e1.lo, e0.lo);
+	return ret;
+}
+
+static inline __m512dx2 _mm512x2_set_pd(
+	double e7, double e6, double e5, double e4,
+	double e3, double e2, double e1, double e0
+) {
+	__m512dx2 ret;
+	ret.hi = _mm512_set_pd(e7, e6, e5, e4, e3, e2, e1, e0);
+	ret.lo = _mm512_setzero_pd();
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx2 setr (set reverse) functions
+//------------------------------------------------------------------------------
+
+static inline __m512dx2 _mm512x2_setr_pdx2(
+	Float64x2 e7, Float64x2 e6, Float64x2 e5, Float64x2 e4,
+	Float64x2 e3, Float64x2 e2, Float64x2 e1, Float64x2 e0
+) {
+	__m512dx2 ret;
+	ret.hi = _mm512_setr_pd(e7.hi, e6.hi, e5.hi, e4.hi, e3.hi, e2.hi, e1.hi, e0.hi);
+	ret.lo = _mm512_setr_pd(e7.lo, e6.lo, e5.lo, e4.lo, e3.lo, e2.lo, e1.lo, e0.lo);
+	return ret;
+}
+
+static inline __m512dx2 _mm512x2_setr_pd(
+	double e7, double e6, double e5, double e4,
+	double e3, double e2, double e1, double e0
+) {
+	__m512dx2 ret;
+	ret.hi = _mm512_setr_pd(e7, e6, e5, e4, e3, e2, e1, e0);
+	ret.lo = _mm512_setzero_pd();
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx2 load operations
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Loads eight interleaved {hi, lo} pairs, and deinterleaves them.
+ * @note mem_addr must be aligned on a 64-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline __m512dx2 _mm512x2_load_pd(const double* mem_addr) {
+	// hi.0, lo.0, hi.1, lo.1, hi.2, lo.2, hi.3, lo.3
+	__m512d v0 = _mm512_load_pd(mem_addr);
+	// hi.4, lo.4, hi.5, lo.5, hi.6, lo.6, hi.7, lo.7
+	__m512d v1 = _mm512_load_pd(mem_addr + 8);
+
+	__m512dx2 val;
+	val.hi = _mm512_permutex2var_pd(
+		v0, _mm512_setr_epi64(0, 2, 4, 6, 8, 10, 12, 14), v1
+	);
+	val.lo = _mm512_permutex2var_pd(
+		v0, _mm512_setr_epi64(1, 3, 5, 7, 9, 11, 13, 15), v1
+	);
+	return val;
+}
+
+/**
+ * @brief Loads eight interleaved {hi, lo} pairs, and deinterleaves them.
+ */
+static inline __m512dx2 _mm512x2_loadu_pd(const double* mem_addr) {
+	// hi.0, lo.0, hi.1, lo.1, hi.2, lo.2, hi.3, lo.3
+	__m512d v0 = _mm512_loadu_pd(mem_addr);
+	// hi.4, lo.4, hi.5, lo.5, hi.6, lo.6, hi.7, lo.7
+	__m512d v1 = _mm512_loadu_pd(mem_addr + 8);
+
+	__m512dx2 val;
+	val.hi = _mm512_permutex2var_pd(
+		v0, _mm512_setr_epi64(0, 2, 4, 6, 8, 10, 12, 14), v1
+	);
+	val.lo = _mm512_permutex2var_pd(
+		v0, _mm512_setr_epi64(1, 3, 5, 7, 9, 11, 13, 15), v1
+	);
+	return val;
+}
+
+/**
+ * @note mem_addr must be aligned on a 64-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline __m512dx2 _mm512x2_load_pdx2(const Float64x2* mem_addr) {
+	return _mm512x2_load_pd((const double*)((const void*)mem_addr));
+}
+
+static inline __m512dx2 _mm512x2_loadu_pdx2(const Float64x2* mem_addr) {
+	return _mm512x2_loadu_pd((const double*)((const void*)mem_addr));
+}
+
+/**
+ * @note mem_addr must be aligned on a 64-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline __m512dx2 _mm512x2_load_raw_pd(const double* mem_addr) {
+	__m512dx2 val;
+	val.hi = _mm512_load_pd(mem_addr);
+	mem_addr += sizeof(__m512d) / sizeof(double);
+	val.lo = _mm512_load_pd(mem_addr);
+	return val;
+}
+
+static inline __m512dx2 _mm512x2_loadu_raw_pd(const double* mem_addr) {
+	__m512dx2 val;
+	val.hi = _mm512_loadu_pd(mem_addr);
+	mem_addr += sizeof(__m512d) / sizeof(double);
+	val.lo = _mm512_loadu_pd(mem_addr);
+	return val;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx2 store operations
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Interleaves the hi and lo parts, and stores eight {hi, lo} pairs.
+ * @note mem_addr must be aligned on a 64-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline void _mm512x2_store_pd(double* mem_addr, __m512dx2 val) {
+	// hi.0, lo.0, hi.1, lo.1, hi.2, lo.2, hi.3, lo.3
+	__m512d v0 = _mm512_permutex2var_pd(
+		val.hi, _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11), val.lo
+	);
+	// hi.4, lo.4, hi.5, lo.5, hi.6, lo.6, hi.7, lo.7
+	__m512d v1 = _mm512_permutex2var_pd(
+		val.hi, _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15), val.lo
+	);
+	_mm512_store_pd(mem_addr, v0);
+	_mm512_store_pd(mem_addr + 8, v1);
+}
+
+/**
+ * @brief Interleaves the hi and lo parts, and stores eight {hi, lo} pairs.
+ */
+static inline void _mm512x2_storeu_pd(double* mem_addr, __m512dx2 val) {
+	// hi.0, lo.0, hi.1, lo.1, hi.2, lo.2, hi.3, lo.3
+	__m512d v0 = _mm512_permutex2var_pd(
+		val.hi, _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11), val.lo
+	);
+	// hi.4, lo.4, hi.5, lo.5, hi.6, lo.6, hi.7, lo.7
+	__m512d v1 = _mm512_permutex2var_pd(
+		val.hi, _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15), val.lo
+	);
+	_mm512_storeu_pd(mem_addr, v0);
+	_mm512_storeu_pd(mem_addr + 8, v1);
+}
+
+/**
+ * @note mem_addr must be aligned on a 64-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline void _mm512x2_store_pdx2(Float64x2* mem_addr, __m512dx2 val) {
+	_mm512x2_store_pd((double*)((void*)mem_addr), val);
+}
+
+static inline void _mm512x2_storeu_pdx2(Float64x2* mem_addr, __m512dx2 val) {
+	_mm512x2_storeu_pd((double*)((void*)mem_addr), val);
+}
+
+/**
+ * @note mem_addr must be aligned on a 64-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline void _mm512_store_raw_pdx2(double* mem_addr, __m512dx2 x) {
+	_mm512_store_pd(mem_addr, x.hi);
+	mem_addr += sizeof(__m512d) / sizeof(double);
+	_mm512_store_pd(mem_addr, x.lo);
+}
+
+static inline void _mm512_storeu_raw_pdx2(double* mem_addr, __m512dx2 x) {
+	_mm512_storeu_pd(mem_addr, x.hi);
+	mem_addr += sizeof(__m512d) / sizeof(double);
+	_mm512_storeu_pd(mem_addr, x.lo);
+}
+
+//------------------------------------------------------------------------------
+// __m512dx2 bitwise operations
+//------------------------------------------------------------------------------
+
+/**
+ * @brief bitwise not `~x`
+ */
+static inline __m512dx2 _mm512x2_not_pdx2(__m512dx2 x) {
+	x.hi = _mm512_castsi512_pd(_mm512_ternarylogic_epi64(
+		_mm512_castpd_si512(x.hi), _mm512_castpd_si512(x.hi), _mm512_castpd_si512(x.hi), 0x01
+	));
+	x.lo = _mm512_castsi512_pd(_mm512_ternarylogic_epi64(
+		_mm512_castpd_si512(x.lo), _mm512_castpd_si512(x.lo), _mm512_castpd_si512(x.lo), 0x01
+	));
+	return x;
+}
+
+/**
+ * @brief bitwise and `x & y`
+ */
+static inline __m512dx2 _mm512x2_and_pdx2(__m512dx2 x, __m512dx2 y) {
+	x.hi = _mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(x.hi), _mm512_castpd_si512(y.hi)));
+	x.lo = _mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(x.lo), _mm512_castpd_si512(y.lo)));
+	return x;
+}
+
+/**
+ * @brief bitwise andnot `~x & y`
+ */
+static inline __m512dx2 _mm512x2_andnot_pdx2(__m512dx2 x, __m512dx2 y) {
+	x.hi = _mm512_castsi512_pd(_mm512_andnot_si512(_mm512_castpd_si512(x.hi), _mm512_castpd_si512(y.hi)));
+	x.lo = _mm512_castsi512_pd(_mm512_andnot_si512(_mm512_castpd_si512(x.lo), _mm512_castpd_si512(y.lo)));
+	return x;
+}
+
+/**
+ * @brief bitwise or `x | y`
+ */
+static inline __m512dx2 _mm512x2_or_pdx2(__m512dx2 x, __m512dx2 y) {
+	x.hi = _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x.hi), _mm512_castpd_si512(y.hi)));
+	x.lo = _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x.lo), _mm512_castpd_si512(y.lo)));
+	return x;
+}
+
+/**
+ * @brief bitwise xor `x ^ y`
+ */
+static inline __m512dx2 _mm512x2_xor_pdx2(__m512dx2 x, __m512dx2 y) {
+	x.hi = _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(x.hi), _mm512_castpd_si512(y.hi)));
+	x.lo = _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(x.lo), _mm512_castpd_si512(y.lo)));
+	return x;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx2 masked operations
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Selects y where the mask is set, and x otherwise.
+ * Replaces the blendv emulation used by __m256dx2.
+ */
+static inline __m512dx2 _mm512x2_mask_blend_pdx2(__mmask8 k, __m512dx2 x, __m512dx2 y) {
+	x.hi = _mm512_mask_blend_pd(k, x.hi, y.hi);
+	x.lo = _mm512_mask_blend_pd(k, x.lo, y.lo);
+	return x;
+}
+
+/**
+ * @brief Zeros the lanes where the mask is not set.
+ */
+static inline __m512dx2 _mm512x2_maskz_mov_pdx2(__mmask8 k, __m512dx2 x) {
+	x.hi = _mm512_maskz_mov_pd(k, x.hi);
+	x.lo = _mm512_maskz_mov_pd(k, x.lo);
+	return x;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx2 comparison functions
+//------------------------------------------------------------------------------
+
+/* __m512dx2 compare __m512dx2 */
+
+	/**
+	 * @brief _CMP_ORD_Q
+	 */
+	static inline __mmask8 _mm512_cmpord_pdx2_mask(__m512dx2 x, __m512dx2 y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.hi, y.hi, _CMP_ORD_Q),
+			x.lo, y.lo, _CMP_ORD_Q
+		);
+	}
+
+	/**
+	 * @brief _CMP_UNORD_Q
+	 */
+	static inline __mmask8 _mm512_cmpunord_pdx2_mask(__m512dx2 x, __m512dx2 y) {
+		return
+			_mm512_cmp_pd_mask(x.hi, y.hi, _CMP_UNORD_Q) |
+			_mm512_cmp_pd_mask(x.lo, y.lo, _CMP_UNORD_Q);
+	}
+
+	/**
+	 * @brief _CMP_EQ_OQ
+	 */
+	static inline __mmask8 _mm512_cmpeq_pdx2_mask(__m512dx2 x, __m512dx2 y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.hi, y.hi, _CMP_EQ_OQ),
+			x.lo, y.lo, _CMP_EQ_OQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_OQ
+	 */
+	static inline __mmask8 _mm512_cmpneq_pdx2_mask(__m512dx2 x, __m512dx2 y) {
+		return
+			_mm512_cmp_pd_mask(x.hi, y.hi, _CMP_NEQ_OQ) |
+			_mm512_cmp_pd_mask(x.lo, y.lo, _CMP_NEQ_OQ);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_UQ
+	 */
+	static inline __mmask8 _mm512_cmplg_pdx2_mask(__m512dx2 x, __m512dx2 y) {
+		return
+			_mm512_cmp_pd_mask(x.hi, y.hi, _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(x.lo, y.lo, _CMP_NEQ_UQ);
+	}
+
+	/**
+	 * @brief _CMP_EQ_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnlg_pdx2_mask(__m512dx2 x, __m512dx2 y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.hi, y.hi, _CMP_EQ_UQ),
+			x.lo, y.lo, _CMP_EQ_UQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_LT_OQ
+	 */
+	static inline __mmask8 _mm512_cmplt_pdx2_mask(__m512dx2 x, __m512dx2 y) {
+		return
+			_mm512_cmp_pd_mask(x.hi, y.hi, _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(
+				_mm512_cmp_pd_mask(x.hi, y.hi, _CMP_EQ_OQ),
+				x.lo, y.lo, _CMP_LT_OQ
+			);
+	}
+
+	/**
+	 * @brief _CMP_LE_OQ
+	 */
+	static inline __mmask8 _mm512_cmple_pdx2_mask(__m512dx2 x, __m512dx2 y) {
+		return
+			_mm512_cmp_pd_mask(x.hi, y.hi, _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(
+				_mm512_cmp_pd_mask(x.hi, y.hi, _CMP_EQ_OQ),
+				x.lo, y.lo, _CMP_LE_OQ
+			);
+	}
+
+	/**
+	 * @brief _CMP_GT_OQ
+	 */
+	static inline __mmask8 _mm512_cmpgt_pdx2_mask(__m512dx2 x, __m512dx2 y) {
+		return
+			_mm512_cmp_pd_mask(x.hi, y.hi, _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(
+				_mm512_cmp_pd_mask(x.hi, y.hi, _CMP_EQ_OQ),
+				x.lo, y.lo, _CMP_GT_OQ
+			);
+	}
+
+	/**
+	 * @brief _CMP_GE_OQ
+	 */
+	static inline __mmask8 _mm512_cmpge_pdx2_mask(__m512dx2 x, __m512dx2 y) {
+		return
+			_mm512_cmp_pd_mask(x.hi, y.hi, _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(
+				_mm512_cmp_pd_mask(x.hi, y.hi, _CMP_EQ_OQ),
+				x.lo, y.lo, _CMP_GE_OQ
+			);
+	}
+
+	/**
+	 * @brief _CMP_NLT_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnlt_pdx2_mask(__m512dx2 x, __m512dx2 y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.hi, y.hi, _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(x.lo, y.lo, _CMP_NLT_UQ),
+			x.hi, y.hi, _CMP_NLT_UQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_NLE_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnle_pdx2_mask(__m512dx2 x, __m512dx2 y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.hi, y.hi, _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(x.lo, y.lo, _CMP_NLE_UQ),
+			x.hi, y.hi, _CMP_NLT_UQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_NGT_UQ
+	 */
+	static inline __mmask8 _mm512_cmpngt_pdx2_mask(__m512dx2 x, __m512dx2 y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.hi, y.hi, _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(x.lo, y.lo, _CMP_NGT_UQ),
+			x.hi, y.hi, _CMP_NGT_UQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_NGE_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnge_pdx2_mask(__m512dx2 x, __m512dx2 y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.hi, y.hi, _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(x.lo, y.lo, _CMP_NGE_UQ),
+			x.hi, y.hi, _CMP_NGT_UQ
+		);
+	}
+
+/* __m512dx2 compare __m512d */
+
+	/**
+	 * @brief _CMP_ORD_Q
+	 */
+	static inline __mmask8 _mm512_cmpord_pdx2_pd_mask(__m512dx2 x, __m512d y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.hi, y, _CMP_ORD_Q),
+			x.lo, _mm512_setzero_pd(), _CMP_ORD_Q
+		);
+	}
+
+	/**
+	 * @brief _CMP_UNORD_Q
+	 */
+	static inline __mmask8 _mm512_cmpunord_pdx2_pd_mask(__m512dx2 x, __m512d y) {
+		return
+			_mm512_cmp_pd_mask(x.hi, y, _CMP_UNORD_Q) |
+			_mm512_cmp_pd_mask(x.lo, _mm512_setzero_pd(), _CMP_UNORD_Q);
+	}
+
+	/**
+	 * @brief _CMP_EQ_OQ
+	 */
+	static inline __mmask8 _mm512_cmpeq_pdx2_pd_mask(__m512dx2 x, __m512d y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.hi, y, _CMP_EQ_OQ),
+			x.lo, _mm512_setzero_pd(), _CMP_EQ_OQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_OQ
+	 */
+	static inline __mmask8 _mm512_cmpneq_pdx2_pd_mask(__m512dx2 x, __m512d y) {
+		return
+			_mm512_cmp_pd_mask(x.hi, y, _CMP_NEQ_OQ) |
+			_mm512_cmp_pd_mask(x.lo, _mm512_setzero_pd(), _CMP_NEQ_OQ);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_UQ
+	 */
+	static inline __mmask8 _mm512_cmplg_pdx2_pd_mask(__m512dx2 x, __m512d y) {
+		return
+			_mm512_cmp_pd_mask(x.hi, y, _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(x.lo, _mm512_setzero_pd(), _CMP_NEQ_UQ);
+	}
+
+	/**
+	 * @brief _CMP_EQ_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnlg_pdx2_pd_mask(__m512dx2 x, __m512d y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.hi, y, _CMP_EQ_UQ),
+			x.lo, _mm512_setzero_pd(), _CMP_EQ_UQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_LT_OQ
+	 */
+	static inline __mmask8 _mm512_cmplt_pdx2_pd_mask(__m512dx2 x, __m512d y) {
+		return
+			_mm512_cmp_pd_mask(x.hi, y, _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(
+				_mm512_cmp_pd_mask(x.hi, y, _CMP_EQ_OQ),
+				x.lo, _mm512_setzero_pd(), _CMP_LT_OQ
+			);
+	}
+
+	/**
+	 * @brief _CMP_LE_OQ
+	 */
+	static inline __mmask8 _mm512_cmple_pdx2_pd_mask(__m512dx2 x, __m512d y) {
+		return
+			_mm512_cmp_pd_mask(x.hi, y, _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(
+				_mm512_cmp_pd_mask(x.hi, y, _CMP_EQ_OQ),
+				x.lo, _mm512_setzero_pd(), _CMP_LE_OQ
+			);
+	}
+
+	/**
+	 * @brief _CMP_GT_OQ
+	 */
+	static inline __mmask8 _mm512_cmpgt_pdx2_pd_mask(__m512dx2 x, __m512d y) {
+		return
+			_mm512_cmp_pd_mask(x.hi, y, _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(
+				_mm512_cmp_pd_mask(x.hi, y, _CMP_EQ_OQ),
+				x.lo, _mm512_setzero_pd(), _CMP_GT_OQ
+			);
+	}
+
+	/**
+	 * @brief _CMP_GE_OQ
+	 */
+	static inline __mmask8 _mm512_cmpge_pdx2_pd_mask(__m512dx2 x, __m512d y) {
+		return
+			_mm512_cmp_pd_mask(x.hi, y, _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(
+				_mm512_cmp_pd_mask(x.hi, y, _CMP_EQ_OQ),
+				x.lo, _mm512_setzero_pd(), _CMP_GE_OQ
+			);
+	}
+
+	/**
+	 * @brief _CMP_NLT_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnlt_pdx2_pd_mask(__m512dx2 x, __m512d y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.hi, y, _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(x.lo, _mm512_setzero_pd(), _CMP_NLT_UQ),
+			x.hi, y, _CMP_NLT_UQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_NLE_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnle_pdx2_pd_mask(__m512dx2 x, __m512d y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.hi, y, _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(x.lo, _mm512_setzero_pd(), _CMP_NLE_UQ),
+			x.hi, y, _CMP_NLT_UQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_NGT_UQ
+	 */
+	static inline __mmask8 _mm512_cmpngt_pdx2_pd_mask(__m512dx2 x, __m512d y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.hi, y, _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(x.lo, _mm512_setzero_pd(), _CMP_NGT_UQ),
+			x.hi, y, _CMP_NGT_UQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_NGE_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnge_pdx2_pd_mask(__m512dx2 x, __m512d y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.hi, y, _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(x.lo, _mm512_setzero_pd(), _CMP_NGE_UQ),
+			x.hi, y, _CMP_NGT_UQ
+		);
+	}
+
+/* __m512d compare __m512dx2 */
+
+	/**
+	 * @brief _CMP_ORD_Q
+	 */
+	static inline __mmask8 _mm512_cmpord_pd_pdx2_mask(__m512d x, __m512dx2 y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x, y.hi, _CMP_ORD_Q),
+			_mm512_setzero_pd(), y.lo, _CMP_ORD_Q
+		);
+	}
+
+	/**
+	 * @brief _CMP_UNORD_Q
+	 */
+	static inline __mmask8 _mm512_cmpunord_pd_pdx2_mask(__m512d x, __m512dx2 y) {
+		return
+			_mm512_cmp_pd_mask(x, y.hi, _CMP_UNORD_Q) |
+			_mm512_cmp_pd_mask(_mm512_setzero_pd(), y.lo, _CMP_UNORD_Q);
+	}
+
+	/**
+	 * @brief _CMP_EQ_OQ
+	 */
+	static inline __mmask8 _mm512_cmpeq_pd_pdx2_mask(__m512d x, __m512dx2 y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x, y.hi, _CMP_EQ_OQ),
+			_mm512_setzero_pd(), y.lo, _CMP_EQ_OQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_OQ
+	 */
+	static inline __mmask8 _mm512_cmpneq_pd_pdx2_mask(__m512d x, __m512dx2 y) {
+		return
+			_mm512_cmp_pd_mask(x, y.hi, _CMP_NEQ_OQ) |
+			_mm512_cmp_pd_mask(_mm512_setzero_pd(), y.lo, _CMP_NEQ_OQ);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_UQ
+	 */
+	static inline __mmask8 _mm512_cmplg_pd_pdx2_mask(__m512d x, __m512dx2 y) {
+		return
+			_mm512_cmp_pd_mask(x, y.hi, _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(_mm512_setzero_pd(), y.lo, _CMP_NEQ_UQ);
+	}
+
+	/**
+	 * @brief _CMP_EQ_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnlg_pd_pdx2_mask(__m512d x, __m512dx2 y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x, y.hi, _CMP_EQ_UQ),
+			_mm512_setzero_pd(), y.lo, _CMP_EQ_UQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_LT_OQ
+	 */
+	static inline __mmask8 _mm512_cmplt_pd_pdx2_mask(__m512d x, __m512dx2 y) {
+		return
+			_mm512_cmp_pd_mask(x, y.hi, _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(
+				_mm512_cmp_pd_mask(x, y.hi, _CMP_EQ_OQ),
+				_mm512_setzero_pd(), y.lo, _CMP_LT_OQ
+			);
+	}
+
+	/**
+	 * @brief _CMP_LE_OQ
+	 */
+	static inline __mmask8 _mm512_cmple_pd_pdx2_mask(__m512d x, __m512dx2 y) {
+		return
+			_mm512_cmp_pd_mask(x, y.hi, _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(
+				_mm512_cmp_pd_mask(x, y.hi, _CMP_EQ_OQ),
+				_mm512_setzero_pd(), y.lo, _CMP_LE_OQ
+			);
+	}
+
+	/**
+	 * @brief _CMP_GT_OQ
+	 */
+	static inline __mmask8 _mm512_cmpgt_pd_pdx2_mask(__m512d x, __m512dx2 y) {
+		return
+			_mm512_cmp_pd_mask(x, y.hi, _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(
+				_mm512_cmp_pd_mask(x, y.hi, _CMP_EQ_OQ),
+				_mm512_setzero_pd(), y.lo, _CMP_GT_OQ
+			);
+	}
+
+	/**
+	 * @brief _CMP_GE_OQ
+	 */
+	static inline __mmask8 _mm512_cmpge_pd_pdx2_mask(__m512d x, __m512dx2 y) {
+		return
+			_mm512_cmp_pd_mask(x, y.hi, _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(
+				_mm512_cmp_pd_mask(x, y.hi, _CMP_EQ_OQ),
+				_mm512_setzero_pd(), y.lo, _CMP_GE_OQ
+			);
+	}
+
+	/**
+	 * @brief _CMP_NLT_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnlt_pd_pdx2_mask(__m512d x, __m512dx2 y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x, y.hi, _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(_mm512_setzero_pd(), y.lo, _CMP_NLT_UQ),
+			x, y.hi, _CMP_NLT_UQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_NLE_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnle_pd_pdx2_mask(__m512d x, __m512dx2 y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x, y.hi, _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(_mm512_setzero_pd(), y.lo, _CMP_NLE_UQ),
+			x, y.hi, _CMP_NLT_UQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_NGT_UQ
+	 */
+	static inline __mmask8 _mm512_cmpngt_pd_pdx2_mask(__m512d x, __m512dx2 y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x, y.hi, _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(_mm512_setzero_pd(), y.lo, _CMP_NGT_UQ),
+			x, y.hi, _CMP_NGT_UQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_NGE_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnge_pd_pdx2_mask(__m512d x, __m512dx2 y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x, y.hi, _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(_mm512_setzero_pd(), y.lo, _CMP_NGE_UQ),
+			x, y.hi, _CMP_NGT_UQ
+		);
+	}
+
+//------------------------------------------------------------------------------
+// __m512dx2 compare to zero functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief _CMP_EQ_OQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __mmask8 _mm512_cmpeq_zero_pdx2_mask(__m512dx2 x) {
+	return _mm512_cmp_pd_mask(x.hi, _mm512_setzero_pd(), _CMP_EQ_OQ);
+}
+/**
+ * @brief _CMP_NEQ_OQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __mmask8 _mm512_cmpneq_zero_pdx2_mask(__m512dx2 x) {
+	return _mm512_cmp_pd_mask(x.hi, _mm512_setzero_pd(), _CMP_NEQ_OQ);
+}
+/**
+ * @brief _CMP_NEQ_UQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __mmask8 _mm512_cmplg_zero_pdx2_mask(__m512dx2 x) {
+	return _mm512_cmp_pd_mask(x.hi, _mm512_setzero_pd(), _CMP_NEQ_UQ);
+}
+/**
+ * @brief _CMP_EQ_UQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __mmask8 _mm512_cmpnlg_zero_pdx2_mask(__m512dx2 x) {
+	return _mm512_cmp_pd_mask(x.hi, _mm512_setzero_pd(), _CMP_EQ_UQ);
+}
+
+/**
+ * @brief _CMP_LT_OQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __mmask8 _mm512_cmplt_zero_pdx2_mask(__m512dx2 x) {
+	return _mm512_cmp_pd_mask(x.hi, _mm512_setzero_pd(), _CMP_LT_OQ);
+}
+/**
+ * @brief _CMP_LE_OQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __mmask8 _mm512_cmple_zero_pdx2_mask(__m512dx2 x) {
+	return _mm512_cmp_pd_mask(x.hi, _mm512_setzero_pd(), _CMP_LE_OQ);
+}
+/**
+ * @brief _CMP_GT_OQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __mmask8 _mm512_cmpgt_zero_pdx2_mask(__m512dx2 x) {
+	return _mm512_cmp_pd_mask(x.hi, _mm512_setzero_pd(), _CMP_GT_OQ);
+}
+/**
+ * @brief _CMP_GE_OQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __mmask8 _mm512_cmpge_zero_pdx2_mask(__m512dx2 x) {
+	return _mm512_cmp_pd_mask(x.hi, _mm512_setzero_pd(), _CMP_GE_OQ);
+}
+
+/**
+ * @brief _CMP_NLT_UQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __mmask8 _mm512_cmpnlt_zero_pdx2_mask(__m512dx2 x) {
+	return _mm512_cmp_pd_mask(x.hi, _mm512_setzero_pd(), _CMP_NLT_UQ);
+}
+/**
+ * @brief _CMP_NLE_UQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __mmask8 _mm512_cmpnle_zero_pdx2_mask(__m512dx2 x) {
+	return _mm512_cmp_pd_mask(x.hi, _mm512_setzero_pd(), _CMP_NLE_UQ);
+}
+/**
+ * @brief _CMP_NGT_UQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __mmask8 _mm512_cmpngt_zero_pdx2_mask(__m512dx2 x) {
+	return _mm512_cmp_pd_mask(x.hi, _mm512_setzero_pd(), _CMP_NGT_UQ);
+}
+/**
+ * @brief _CMP_NGE_UQ
+ * @note Assumes that if x.hi is zero then x.lo is also zero.
+ */
+static inline __mmask8 _mm512_cmpnge_zero_pdx2_mask(__m512dx2 x) {
+	return _mm512_cmp_pd_mask(x.hi, _mm512_setzero_pd(), _CMP_NGE_UQ);
+}
+
+//------------------------------------------------------------------------------
+// __m512dx2 basic arithmetic
+//------------------------------------------------------------------------------
+
+static inline __m512dx2 _mm512x2_negate_pdx2(__m512dx2 x) {
+	x.hi = _mm512_negate_pd(x.hi);
+	x.lo = _mm512_negate_pd(x.lo);
+	return x;
+}
+
+static inline __m512dx2 _mm512x2_add_pdx2(__m512dx2 x, __m512dx2 y) {
+	__m512d r_hi = _mm512_add_pd(x.hi, y.hi);
+
+	__m512d rx_lo = _mm512_add_pd(_mm512_add_pd(
+		_mm512_add_pd(_mm512_sub_pd(x.hi, r_hi), y.hi),
+	y.lo), x.lo);
+	__m512d ry_lo = _mm512_add_pd(_mm512_add_pd(
+		_mm512_add_pd(_mm512_sub_pd(y.hi, r_hi), x.hi),
+	x.lo), y.lo);
+
+	const __mmask8 cmp_result = _mm512_cmp_pd_mask(
+		_mm512_abs_pd(x.hi), _mm512_abs_pd(y.hi),
+	_CMP_LE_OQ);
+	__m512d r_lo = _mm512_mask_blend_pd(cmp_result, rx_lo, ry_lo);
+
+	__m512dx2 c;
+	c.hi = _mm512_add_pd(r_hi, r_lo);
+	c.lo = _mm512_add_pd(_mm512_sub_pd(r_hi, c.hi), r_lo);
+	return c;
+}
+
+static inline __m512dx2 _mm512x2_sub_pdx2(__m512dx2 x, __m512dx2 y) {
+	__m512d r_hi = _mm512_sub_pd(x.hi, y.hi);
+
+	__m512d rx_lo = _mm512_add_pd(_mm512_sub_pd(
+		_mm512_sub_pd(_mm512_sub_pd(x.hi, r_hi), y.hi),
+	y.lo), x.lo);
+
+	y.hi = _mm512_negate_pd(y.hi);
+	__m512d ry_lo = _mm512_sub_pd(_mm512_add_pd(
+		_mm512_add_pd(_mm512_sub_pd(/* negative */ y.hi, r_hi), x.hi),
+	x.lo), y.lo);
+
+	const __mmask8 cmp_result = _mm512_cmp_pd_mask(
+		_mm512_abs_pd(x.hi), _mm512_abs_pd(y.hi),
+	_CMP_LE_OQ);
+	__m512d r_lo = _mm512_mask_blend_pd(cmp_result, rx_lo, ry_lo);
+
+	__m512dx2 c;
+	c.hi = _mm512_add_pd(r_hi, r_lo);
+	c.lo = _mm512_add_pd(_mm512_sub_pd(r_hi, c.hi), r_lo);
+	return c;
+}
+
+static inline __m512dx2 _mm512x2_dekker_mul12_pd(__m512d x, __m512d y) {
+	__m512dx2 r;
+	r.hi = _mm512_mul_pd(x, y);
+	r.lo = _mm512_fmsub_pd(x, y, r.hi);
+	return r;
+}
+
+static inline __m512dx2 _mm512x2_mul_pdx2(__m512dx2 x, __m512dx2 y) {
+	__m512dx2 t = _mm512x2_dekker_mul12_pd(x.hi, y.hi);
+	__m512d c = _mm512_fmadd_pd(x.hi, y.lo, _mm512_fmadd_pd(x.lo, y.hi, t.lo));
+
+	__m512dx2 r;
+	r.hi = _mm512_add_pd(t.hi, c);
+	r.lo = _mm512_add_pd(_mm512_sub_pd(t.hi, r.hi), c);
+	return r;
+}
+
+static inline __m512dx2 _mm512x2_div_pdx2(__m512dx2 x, __m512dx2 y) {
+	__m512d u = _mm512_div_pd(x.hi, y.hi);
+	/* x.hi - u * y.hi is exact */
+	__m512d l = _mm512_div_pd(_mm512_fnmadd_pd(u, y.lo,
+		_mm512_add_pd(_mm512_fnmadd_pd(u, y.hi, x.hi), x.lo)
+	), y.hi);
+
+	__m512dx2 r;
+	r.hi = _mm512_add_pd(u, l);
+	r.lo = _mm512_add_pd(_mm512_sub_pd(u, r.hi), l);
+	return r;
+}
+
+static inline __m512dx2 _mm512x2_dekker_square12_pd(__m512d x) {
+	__m512dx2 r;
+	r.hi = _mm512_mul_pd(x, x);
+	r.lo = _mm512_fmsub_pd(x, x, r.hi);
+	return r;
+}
+
+static inline __m512dx2 _mm512x2_square_pdx2(__m512dx2 x) {
+	__m512dx2 t = _mm512x2_dekker_square12_pd(x.hi);
+	__m512d c = _mm512_fmadd_pd(_mm512_add_pd(x.hi, x.hi), x.lo, t.lo);
+
+	__m512dx2 r;
+	r.hi = _mm512_add_pd(t.hi, c);
+	r.lo = _mm512_add_pd(_mm512_sub_pd(t.hi, r.hi), c);
+	return r;
+}
+
+static inline __m512dx2 _mm512x2_recip_pdx2(__m512dx2 y) {
+	__m512d u = _mm512_div_pd(_mm512_set1_pd(1.0), y.hi);
+	/* 1.0 - u * y.hi is exact */
+	__m512d l = _mm512_div_pd(_mm512_fnmadd_pd(u, y.lo,
+		_mm512_fnmadd_pd(u, y.hi, _mm512_set1_pd(1.0))
+	), y.hi);
+
+	__m512dx2 r;
+	r.hi = _mm512_add_pd(u, l);
+	r.lo = _mm512_add_pd(_mm512_sub_pd(u, r.hi), l);
+	return r;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx2 optimized arithmetic
+//------------------------------------------------------------------------------
+
+static inline __m512dx2 _mm512x2_add_pdx2_pd(__m512dx2 x, __m512d y) {
+	__m512d r_hi = _mm512_add_pd(x.hi, y);
+
+	__m512d rx_lo = _mm512_add_pd(
+		_mm512_add_pd(_mm512_sub_pd(x.hi, r_hi), y), x.lo
+	);
+	__m512d ry_lo = _mm512_add_pd(
+		_mm512_add_pd(_mm512_sub_pd(y, r_hi), x.hi),
+	x.lo);
+
+	const __mmask8 cmp_result = _mm512_cmp_pd_mask(
+		_mm512_abs_pd(x.hi), _mm512_abs_pd(y),
+	_CMP_LE_OQ);
+	__m512d r_lo = _mm512_mask_blend_pd(cmp_result, rx_lo, ry_lo);
+
+	__m512dx2 c;
+	c.hi = _mm512_add_pd(r_hi, r_lo);
+	c.lo = _mm512_add_pd(_mm512_sub_pd(r_hi, c.hi), r_lo);
+	return c;
+}
+
+static inline __m512dx2 _mm512x2_add_pd_pdx2(__m512d x, __m512dx2 y) {
+	__m512d r_hi = _mm512_add_pd(x, y.hi);
+
+	__m512d rx_lo = _mm512_add_pd(
+		_mm512_add_pd(_mm512_sub_pd(x, r_hi), y.hi),
+	y.lo);
+	__m512d ry_lo = _mm512_add_pd(
+		_mm512_add_pd(_mm512_sub_pd(y.hi, r_hi), x), y.lo
+	);
+
+	const __mmask8 cmp_result = _mm512_cmp_pd_mask(
+		_mm512_abs_pd(x), _mm512_abs_pd(y.hi),
+	_CMP_LE_OQ);
+	__m512d r_lo = _mm512_mask_blend_pd(cmp_result, rx_lo, ry_lo);
+
+	__m512dx2 c;
+	c.hi = _mm512_add_pd(r_hi, r_lo);
+	c.lo = _mm512_add_pd(_mm512_sub_pd(r_hi, c.hi), r_lo);
+	return c;
+}
+
+/**
+ * @brief Adds two __m512d values with the result stored as a __m512dx2
+ */
+static inline __m512dx2 _mm512x2_add_pd_pd(__m512d x, __m512d y) {
+	__m512d r_hi = _mm512_add_pd(x, y);
+
+	__m512d rx_lo = _mm512_add_pd(_mm512_sub_pd(x, r_hi), y);
+	__m512d ry_lo = _mm512_add_pd(_mm512_sub_pd(y, r_hi), x);
+
+	const __mmask8 cmp_result = _mm512_cmp_pd_mask(
+		_mm512_abs_pd(x), _mm512_abs_pd(y),
+	_CMP_LE_OQ);
+	__m512d r_lo = _mm512_mask_blend_pd(cmp_result, rx_lo, ry_lo);
+
+	__m512dx2 c;
+	c.hi = _mm512_add_pd(r_hi, r_lo);
+	c.lo = _mm512_add_pd(_mm512_sub_pd(r_hi, c.hi), r_lo);
+	return c;
+}
+
+static inline __m512dx2 _mm512x2_sub_pdx2_pd(__m512dx2 x, __m512d y) {
+	__m512d r_hi = _mm512_sub_pd(x.hi, y);
+
+	__m512d rx_lo = _mm512_add_pd(
+		_mm512_sub_pd(_mm512_sub_pd(x.hi, r_hi), y), x.lo
+	);
+
+	y = _mm512_negate_pd(y);
+	__m512d ry_lo = _mm512_add_pd(
+		_mm512_add_pd(_mm512_sub_pd(/* negative */ y, r_hi), x.hi), x.lo
+	);
+
+	const __mmask8 cmp_result = _mm512_cmp_pd_mask(
+		_mm512_abs_pd(x.hi), _mm512_abs_pd(y),
+	_CMP_LE_OQ);
+	__m512d r_lo = _mm512_mask_blend_pd(cmp_result, rx_lo, ry_lo);
+
+	__m512dx2 c;
+	c.hi = _mm512_add_pd(r_hi, r_lo);
+	c.lo = _mm512_add_pd(_mm512_sub_pd(r_hi, c.hi), r_lo);
+	return c;
+}
+
+static inline __m512dx2 _mm512x2_sub_pd_pdx2(__m512d x, __m512dx2 y) {
+	__m512d r_hi = _mm512_sub_pd(x, y.hi);
+
+	__m512d rx_lo = _mm512_sub_pd(
+		_mm512_sub_pd(_mm512_sub_pd(x, r_hi), y.hi),
+	y.lo);
+
+	y.hi = _mm512_negate_pd(y.hi);
+	__m512d ry_lo = _mm512_sub_pd(
+		_mm512_add_pd(_mm512_sub_pd(/* negative */ y.hi, r_hi), x), y.lo
+	);
+
+	const __mmask8 cmp_result = _mm512_cmp_pd_mask(
+		_mm512_abs_pd(x), _mm512_abs_pd(y.hi),
+	_CMP_LE_OQ);
+	__m512d r_lo = _mm512_mask_blend_pd(cmp_result, rx_lo, ry_lo);
+
+	__m512dx2 c;
+	c.hi = _mm512_add_pd(r_hi, r_lo);
+	c.lo = _mm512_add_pd(_mm512_sub_pd(r_hi, c.hi), r_lo);
+	return c;
+}
+
+/**
+ * @brief Subtracts two __m512d values with the result stored as a __m512dx2
+ */
+static inline __m512dx2 _mm512x2_sub_pd_pd(__m512d x, __m512d y) {
+	__m512d r_hi = _mm512_sub_pd(x, y);
+
+	__m512d rx_lo = _mm512_sub_pd(_mm512_sub_pd(x, r_hi), y);
+
+	y = _mm512_negate_pd(y);
+	__m512d ry_lo = _mm512_add_pd(_mm512_sub_pd(/* negative */ y, r_hi), x);
+
+	const __mmask8 cmp_result = _mm512_cmp_pd_mask(
+		_mm512_abs_pd(x), _mm512_abs_pd(y),
+	_CMP_LE_OQ);
+	__m512d r_lo = _mm512_mask_blend_pd(cmp_result, rx_lo, ry_lo);
+
+	__m512dx2 c;
+	c.hi = _mm512_add_pd(r_hi, r_lo);
+	c.lo = _mm512_add_pd(_mm512_sub_pd(r_hi, c.hi), r_lo);
+	return c;
+}
+
+static inline __m512dx2 _mm512x2_mul_pdx2_pd(__m512dx2 x, __m512d y) {
+	__m512dx2 t = _mm512x2_dekker_mul12_pd(x.hi, y);
+	__m512d c = _mm512_fmadd_pd(x.lo, y, t.lo);
+
+	__m512dx2 r;
+	r.hi = _mm512_add_pd(t.hi, c);
+	r.lo = _mm512_add_pd(_mm512_sub_pd(t.hi, r.hi), c);
+	return r;
+}
+
+static inline __m512dx2 _mm512x2_mul_pd_pdx2(__m512d x, __m512dx2 y) {
+	__m512dx2 t = _mm512x2_dekker_mul12_pd(x, y.hi);
+	__m512d c = _mm512_fmadd_pd(x, y.lo, t.lo);
+
+	__m512dx2 r;
+	r.hi = _mm512_add_pd(t.hi, c);
+	r.lo = _mm512_add_pd(_mm512_sub_pd(t.hi, r.hi), c);
+	return r;
+}
+
+/**
+ * @brief Multiplies two __m512d values with the result stored as a __m512dx2
+ */
+static inline __m512dx2 _mm512x2_mul_pd_pd(__m512d x, __m512d y) {
+	return _mm512x2_dekker_mul12_pd(x, y);
+}
+
+static inline __m512dx2 _mm512x2_div_pdx2_pd(__m512dx2 x, __m512d y) {
+	__m512d u = _mm512_div_pd(x.hi, y);
+	__m512d l = _mm512_div_pd(
+		_mm512_add_pd(_mm512_fnmadd_pd(u, y, x.hi), x.lo), y
+	);
+
+	__m512dx2 r;
+	r.hi = _mm512_add_pd(u, l);
+	r.lo = _mm512_add_pd(_mm512_sub_pd(u, r.hi), l);
+	return r;
+}
+
+static inline __m512dx2 _mm512x2_div_pd_pdx2(__m512d x, __m512dx2 y) {
+	__m512d u = _mm512_div_pd(x, y.hi);
+	__m512d l = _mm512_div_pd(_mm512_fnmadd_pd(u, y.lo,
+		_mm512_fnmadd_pd(u, y.hi, x)
+	), y.hi);
+
+	__m512dx2 r;
+	r.hi = _mm512_add_pd(u, l);
+	r.lo = _mm512_add_pd(_mm512_sub_pd(u, r.hi), l);
+	return r;
+}
+
+/**
+ * @brief Divides two __m512d values with the result stored as a __m512dx2
+ */
+static inline __m512dx2 _mm512x2_div_pd_pd(__m512d x, __m512d y) {
+	__m512d u = _mm512_div_pd(x, y);
+	__m512d l = _mm512_div_pd(_mm512_fnmadd_pd(u, y, x), y);
+
+	__m512dx2 r;
+	r.hi = _mm512_add_pd(u, l);
+	r.lo = _mm512_add_pd(_mm512_sub_pd(u, r.hi), l);
+	return r;
+}
+
+/**
+ * @brief Squares a __m512d value with the result stored as a __m512dx2
+ */
+static inline __m512dx2 _mm512x2_square_pd(__m512d x) {
+	return _mm512x2_dekker_square12_pd(x);
+}
+
+/**
+ * @brief Calculates the reciprocal of a __m512d value with the result stored
+ * as a __m512dx2
+ */
+static inline __m512dx2 _mm512x2_recip_pd(__m512d y) {
+	__m512d u = _mm512_div_pd(_mm512_set1_pd(1.0), y);
+	__m512d l = _mm512_div_pd(
+		_mm512_fnmadd_pd(u, y, _mm512_set1_pd(1.0)), y
+	);
+
+	__m512dx2 r;
+	r.hi = _mm512_add_pd(u, l);
+	r.lo = _mm512_add_pd(_mm512_sub_pd(u, r.hi), l);
+	return r;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx2 specialized arithmetic
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Multiplies by a known power of two (such as 2.0, 0.5, etc.) or zero
+ */
+static inline __m512dx2 _mm512x2_mul_power2_pdx2_pd(__m512dx2 x, __m512d y) {
+	x.hi = _mm512_mul_pd(x.hi, y);
+	x.lo = _mm512_mul_pd(x.lo, y);
+	return x;
+}
+
+/**
+ * @brief Multiplies by a known power of two (such as 2.0, 0.5, etc.) or zero
+ */
+static inline __m512dx2 _mm512x2_mul_power2_pd_pdx2(__m512d x, __m512dx2 y) {
+	y.hi = _mm512_mul_pd(x, y.hi);
+	y.lo = _mm512_mul_pd(x, y.lo);
+	return y;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx2 Mathematical Constants
+//------------------------------------------------------------------------------
+
+/**
+ * @brief ~2.718281828 Returns the value of euler's number
+ */
+static inline __m512dx2 _mm512x2_const_e_pdx2(void) {
+	const __m512dx2 ret = {
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x4005BF0A8B145769)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3CA4D57EE2B1013A))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~1.442695041 Returns the value of log2(e)
+ */
+static inline __m512dx2 _mm512x2_const_log2e_pdx2(void) {
+	const __m512dx2 ret = {
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FF71547652B82FE)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3C7777D0FFDA0D24))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~0.434294482 Returns the value of log10(e)
+ */
+static inline __m512dx2 _mm512x2_const_log10e_pdx2(void) {
+	const __m512dx2 ret = {
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FDBCB7B1526E50E)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3C695355BAAAFAD3))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~3.141592654 Returns the value of pi
+ */
+static inline __m512dx2 _mm512x2_const_pi_pdx2(void) {
+	const __m512dx2 ret = {
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x400921FB54442D18)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3CA1A62633145C07))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~0.318309886 Returns the value of 1 / pi
+ */
+static inline __m512dx2 _mm512x2_const_inv_pi_pdx2(void) {
+	const __m512dx2 ret = {
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FD45F306DC9C883)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xBC76B01EC5417056))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~0.564189584 Returns the value of 1 / sqrt(pi)
+ */
+static inline __m512dx2 _mm512x2_const_inv_sqrtpi_pdx2(void) {
+	const __m512dx2 ret = {
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FE20DD750429B6D)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3C61AE3A914FED80))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~0.693147181 Returns the value of ln(2)
+ */
+static inline __m512dx2 _mm512x2_const_ln2_pdx2(void) {
+	const __m512dx2 ret = {
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FE62E42FEFA39EF)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3C7ABC9E3B39803F))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~2.302585093 Returns the value of ln(10)
+ */
+static inline __m512dx2 _mm512x2_const_ln10_pdx2(void) {
+	const __m512dx2 ret = {
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x40026BB1BBB55516)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xBCAF48AD494EA3E9))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~1.414213562 Returns the value of sqrt(2)
+ */
+static inline __m512dx2 _mm512x2_const_sqrt2_pdx2(void) {
+	const __m512dx2 ret = {
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FF6A09E667F3BCD)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xBC9BDD3413B26456))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~1.732050808 Returns the value of sqrt(3)
+ */
+static inline __m512dx2 _mm512x2_const_sqrt3_pdx2(void) {
+	const __m512dx2 ret = {
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FFBB67AE8584CAA)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3C9CEC95D0B5C1E3))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~0.577350269 Returns the value of 1 / sqrt(3)
+ */
+static inline __m512dx2 _mm512x2_const_inv_sqrt3_pdx2(void) {
+	const __m512dx2 ret = {
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FE279A74590331C)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3C834863E0792BED))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~0.577215665 Returns the value of gamma (The Euler–Mascheroni constant)
+ */
+static inline __m512dx2 _mm512x2_const_egamma_pdx2(void) {
+	const __m512dx2 ret = {
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FE2788CFC6FB619)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xBC56CB90701FBFAB))
+	};
+	return ret;
+}
+
+/**
+ * @brief ~1.618033989 Returns the value of phi (The golden ratio)
+ */
+static inline __m512dx2 _mm512x2_const_phi_pdx2(void) {
+	const __m512dx2 ret = {
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FF9E3779B97F4A8)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xBC8F506319FCFD19))
+	};
+	return ret;
+}
+//------------------------------------------------------------------------------
+// __m512dx2 floating point classify
+//------------------------------------------------------------------------------
+
+/* values */
+
+	/**
+	 * @brief Returns a __m512dx2 value set to positive infinity
+	 */
+	static inline __m512dx2 _mm512x2_get_infinity_pdx2(void) {
+		__m512dx2 ret = {
+			_mm512_get_infinity_pd(),
+			_mm512_get_infinity_pd()
+		};
+		return ret;
+	}
+
+	/**
+	 * @brief Returns a __m512dx2 value set to signaling NaN
+	 */
+	static inline __m512dx2 _mm512x2_get_sNaN_pdx2(void) {
+		__m512dx2 ret = {
+			_mm512_get_sNaN_pd(),
+			_mm512_get_sNaN_pd()
+		};
+		return ret;
+	}
+
+	/**
+	 * @brief Returns a __m512dx2 value set to quiet NaN
+	 */
+	static inline __m512dx2 _mm512x2_get_qNaN_pdx2(void) {
+		__m512dx2 ret = {
+			_mm512_get_qNaN_pd(),
+			_mm512_get_qNaN_pd()
+		};
+		return ret;
+	}
+
+/* Float Classify */
+
+	/** @brief Returns true if x is negative */
+	static inline __mmask8 _mm512_signbit_pdx2(const __m512dx2 x) {
+		return _mm512_signbit_pd(x.hi);
+	}
+
+	/** @brief Returns true if x is finite */
+	static inline __mmask8 _mm512_isfinite_pdx2(const __m512dx2 x) {
+		return _mm512_isfinite_pd(x.hi);
+	}
+
+	/** @brief Returns true if x is +-infinity */
+	static inline __mmask8 _mm512_isinf_pdx2(const __m512dx2 x) {
+		return _mm512_isinf_pd(x.hi);
+	}
+
+	/** @brief Returns true if x is any kind of NaN */
+	static inline __mmask8 _mm512_isnan_pdx2(const __m512dx2 x) {
+		return _mm512_isnan_pd(x.hi);
+	}
+
+	/** @brief Returns true if x is normal */
+	static inline __mmask8 _mm512_isnormal_pdx2(const __m512dx2 x) {
+		return _mm512_isnormal_pd(x.hi) & (
+			_mm512_isnormal_pd(x.lo) |
+			_mm512_cmp_pd_mask(x.lo, _mm512_setzero_pd(), _CMP_EQ_OQ)
+		);
+	}
+
+	/** @brief Returns true if x is denormal and non-zero */
+	static inline __mmask8 _mm512_isdenormal_pdx2(const __m512dx2 x) {
+		return _mm512_isdenormal_pd(x.hi) | _mm512_isdenormal_pd(x.lo);
+	}
+
+	/** @brief Returns true if x and y are unordered */
+	static inline __mmask8 _mm512_isunordered_pdx2(const __m512dx2 x, const __m512dx2 y) {
+		return _mm512_isunordered_pd(x.hi, y.hi);
+	}
+
+//------------------------------------------------------------------------------
+// __m512dx2 max/min functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns the fmax of x and y. Correctly handling NaN.
+ * You may use _mm512x2_max_pdx2 as a faster alternative.
+ */
+static inline __m512dx2 _mm512x2_fmax_pdx2(__m512dx2 x, __m512dx2 y) {
+	// returns y if x < y, or if x is NaN and y is not NaN
+	const __mmask8 fmax_cmp = _mm512_cmplt_pdx2_mask(x, y) | (
+		_mm512_isnan_pdx2(x) & _mm512_cmp_pd_mask(y.hi, y.hi, _CMP_ORD_Q)
+	);
+	return _mm512x2_mask_blend_pdx2(fmax_cmp, x, y);
+}
+
+/**
+ * @brief Returns the fmin of x and y. Correctly handling NaN.
+ * You may use _mm512x2_min_pdx2 as a faster alternative.
+ */
+static inline __m512dx2 _mm512x2_fmin_pdx2(__m512dx2 x, __m512dx2 y) {
+	// returns y if x > y, or if x is NaN and y is not NaN
+	const __mmask8 fmin_cmp = _mm512_cmpgt_pdx2_mask(x, y) | (
+		_mm512_isnan_pdx2(x) & _mm512_cmp_pd_mask(y.hi, y.hi, _CMP_ORD_Q)
+	);
+	return _mm512x2_mask_blend_pdx2(fmin_cmp, x, y);
+}
+
+static inline __m512dx2 _mm512x2_max_pdx2(__m512dx2 x, __m512dx2 y) {
+	return _mm512x2_mask_blend_pdx2(_mm512_cmplt_pdx2_mask(x, y), x, y);
+}
+
+static inline __m512dx2 _mm512x2_min_pdx2(__m512dx2 x, __m512dx2 y) {
+	return _mm512x2_mask_blend_pdx2(_mm512_cmpgt_pdx2_mask(x, y), x, y);
+}
+
+//------------------------------------------------------------------------------
+// __m512dx2 rounding functions
+//------------------------------------------------------------------------------
+
+/** same as aint(x) */
+static inline __m512dx2 _mm512x2_trunc_pdx2(__m512dx2 x) {
+	__m512d int_hi = _mm512_trunc_pd(x.hi);
+	__m512d int_lo = _mm512_trunc_pd(x.lo);
+	__m512d frac_hi = _mm512_sub_pd(x.hi, int_hi);
+	__m512d frac_lo = _mm512_sub_pd(x.lo, int_lo);
+
+	__mmask8 frac_ge_1 = _mm512_cmp_pd_mask(
+		_mm512_add_pd(frac_hi, frac_lo), _mm512_set1_pd(1.0), _CMP_GE_OQ
+	);
+
+	__m512dx2 trunc_all = _mm512x2_add_pdx2_pd(_mm512x2_add_pd_pd(
+		_mm512_maskz_mov_pd(frac_ge_1, _mm512_set1_pd(1.0)),
+		int_lo
+	), int_hi);
+	return trunc_all;
+}
+
+static inline __m512dx2 _mm512x2_floor_pdx2(__m512dx2 x) {
+	__m512dx2 int_part = _mm512x2_trunc_pdx2(x);
+
+	const __mmask8 cmp_floor =
+		_mm512_cmplt_zero_pdx2_mask(x) & _mm512_cmpneq_pdx2_mask(x, int_part);
+	return _mm512x2_sub_pdx2_pd(
+		int_part, _mm512_maskz_mov_pd(cmp_floor, _mm512_set1_pd(1.0))
+	);
+}
+
+static inline __m512dx2 _mm512x2_ceil_pdx2(__m512dx2 x) {
+	__m512dx2 int_part = _mm512x2_trunc_pdx2(x);
+
+	const __mmask8 cmp_ceil =
+		_mm512_cmpgt_zero_pdx2_mask(x) & _mm512_cmpneq_pdx2_mask(x, int_part);
+	return _mm512x2_add_pdx2_pd(
+		int_part, _mm512_maskz_mov_pd(cmp_ceil, _mm512_set1_pd(1.0))
+	);
+}
+
+/** same as nint(x). Rounds halfway cases away from zero. */
+static inline __m512dx2 _mm512x2_round_pdx2(__m512dx2 x) {
+	__m512dx2 int_part = _mm512x2_trunc_pdx2(x);
+	__m512dx2 frac_part = _mm512x2_sub_pdx2(x, int_part);
+
+	const __mmask8 round_up =
+		_mm512_cmpge_zero_pdx2_mask(x) &
+		_mm512_cmpge_pdx2_pd_mask(frac_part, _mm512_set1_pd(0.5));
+	const __mmask8 round_dn =
+		_mm512_cmplt_zero_pdx2_mask(x) &
+		_mm512_cmple_pdx2_pd_mask(frac_part, _mm512_set1_pd(-0.5));
+
+	__m512d round_part = _mm512_maskz_mov_pd(round_up, _mm512_set1_pd(1.0));
+	round_part = _mm512_mask_mov_pd(round_part, round_dn, _mm512_set1_pd(-1.0));
+	return _mm512x2_add_pdx2_pd(int_part, round_part);
+}
+
+//------------------------------------------------------------------------------
+// __m512dx2 math.h functions
+//------------------------------------------------------------------------------
+
+static inline __m512dx2 _mm512x2_fabs_pdx2(__m512dx2 x) {
+	return _mm512x2_mask_blend_pdx2(
+		_mm512_signbit_pd(x.hi), x, _mm512x2_negate_pdx2(x)
+	);
+}
+
+static inline __m512dx2 _mm512x2_fdim_pdx2(__m512dx2 x, __m512dx2 y) {
+	__m512dx2 ret = _mm512x2_sub_pdx2(x, y);
+	// NaN remains NaN, and -0.0 becomes +0.0
+	return _mm512x2_maskz_mov_pdx2(_mm512_cmpnle_zero_pdx2_mask(ret), ret);
+}
+
+static inline __m512dx2 _mm512x2_copysign_pdx2(__m512dx2 x, __m512dx2 y) {
+	return _mm512x2_mask_blend_pdx2(
+		_mm512_signbit_pd(_mm512_castsi512_pd(_mm512_xor_si512(
+			_mm512_castpd_si512(x.hi), _mm512_castpd_si512(y.hi)
+		))), x, _mm512x2_negate_pdx2(x)
+	);
+}
+
+static inline __m512dx2 _mm512x2_copysign_pdx2_pd(__m512dx2 x, __m512d y) {
+	return _mm512x2_mask_blend_pdx2(
+		_mm512_signbit_pd(_mm512_castsi512_pd(_mm512_xor_si512(
+			_mm512_castpd_si512(x.hi), _mm512_castpd_si512(y)
+		))), x, _mm512x2_negate_pdx2(x)
+	);
+}
+
+static inline __m512dx2 _mm512x2_sqrt_pdx2(__m512dx2 x) {
+	__m512d guess = _mm512_sqrt_pd(x.hi);
+	return _mm512x2_maskz_mov_pdx2(
+		// returns 0.0 on division by 0.0
+		_mm512_cmp_pd_mask(guess, _mm512_setzero_pd(), _CMP_NEQ_UQ),
+		_mm512x2_mul_power2_pdx2_pd(
+			_mm512x2_add_pd_pdx2(guess, _mm512x2_div_pdx2_pd(x, guess)),
+			_mm512_set1_pd(0.5)
+		)
+	);
+}
+
+/**
+ * @brief returns the fractional part of a __m512dx2 value.
+ * @note int_part cannot not be NULL
+ */
+static inline __m512dx2 _mm512x2_modf_pdx2(__m512dx2 x, __m512dx2* int_part) {
+	__m512dx2 trunc_part = _mm512x2_trunc_pdx2(x);
+	*int_part = trunc_part;
+	return _mm512x2_sub_pdx2(x, trunc_part);
+}
+
+static inline __m512dx2 _mm512x2_fmod_pdx2(__m512dx2 x, __m512dx2 y) {
+	__m512dx2 trunc_part = _mm512x2_trunc_pdx2(_mm512x2_div_pdx2(x, y));
+	return _mm512x2_sub_pdx2(x, _mm512x2_mul_pdx2(y, trunc_part));
+}
+
+//------------------------------------------------------------------------------
+// __m512dx2 ilogb
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Computes ilogb(x) on a __m512dx2 value
+ * @returns __m512i int64_t
+ */
+static inline __m512i _mm512x2_ilogb_pdx2_epi64(__m512dx2 x) {
+	return _mm512_ilogb_pd_epi64(x.hi);
+}
+
+/**
+ * @brief Computes ilogb(x) on a __m512dx2 value
+ * @returns __m256i int32_t
+ */
+static inline __m256i _mm512x2_ilogb_pdx2_epi32(__m512dx2 x) {
+	return _mm512_ilogb_pd_epi32(x.hi);
+}
+
+//------------------------------------------------------------------------------
+// __m512dx2 ldexp
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Computes ldexp(x, expon)
+ */
+static inline __m512dx2 _mm512x2_ldexp_pdx2_epi64(__m512dx2 x, __m512i expon) {
+	x.hi = _mm512_ldexp_pd_epi64(x.hi, expon);
+	x.lo = _mm512_ldexp_pd_epi64(x.lo, expon);
+	return x;
+}
+
+/**
+ * @brief Computes ldexp(x, expon)
+ */
+static inline __m512dx2 _mm512x2_ldexp_pdx2_epi32(__m512dx2 x, __m256i expon) {
+	x.hi = _mm512_ldexp_pd_epi32(x.hi, expon);
+	x.lo = _mm512_ldexp_pd_epi32(x.lo, expon);
+	return x;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx2 frexp
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Computes frexp(x, expon) on a __m512dx2 value
+ * @returns sign extended __m512i int64_t
+ */
+static inline __m512dx2 _mm512x2_frexp_pdx2_epi64(__m512dx2 x, __m512i* const expon) {
+	x.hi = _mm512_frexp_pd_epi64(x.hi, expon);
+	x.lo = _mm512_ldexp_pd_epi64(x.lo, _mm512_sub_epi64(_mm512_setzero_si512(), *expon));
+	return x;
+}
+
+/**
+ * @brief Computes frexp(x, expon) on a __m512dx2 value
+ * @returns __m256i int32_t
+ */
+static inline __m512dx2 _mm512x2_frexp_pdx2_epi32(__m512dx2 x, __m256i* const expon) {
+	x.hi = _mm512_frexp_pd_epi32(x.hi, expon);
+	x.lo = _mm512_ldexp_pd_epi32(x.lo, _mm256_sub_epi32(_mm256_setzero_si256(), *expon));
+	return x;
+}
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* FLOAT64X2_AVX512_H */
@@ -0,0 +1,918 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "Float64x2_SSE2.h"
+#include "Float64x2.h"
+
+#include <math.h>
+#include <emmintrin.h>
+
+//------------------------------------------------------------------------------
+// __m128dx2 exponents and logarithms
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Exponential.  Computes expm1(x) in double-double precision when x
+ * is between -0.5ln(2) and +0.5ln(2), otherwise exp(x) = 2^m * (ret + 1).
+ *
+ * @author Taken from libQD dd_real.cpp which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ *
+ * @note x.hi must be finite and within [-750.0, +710.0] so that m fits
+ * inside of an int32_t.
+ */
+static inline __m128dx2 _mm128x2_taylor_expm1_pdx2(
+	const __m128dx2 x, __m128i* m_bin
+) {
+	const __m128dx2 inv_fact[7] = {
+	/* 3! */ _mm128x2_set1_pd_pd(0x1.5555555555555p-3 ,+0x1.5555555555555p-57),
+	/* 4! */ _mm128x2_set1_pd_pd(0x1.5555555555555p-5 ,+0x1.5555555555555p-59),
+	/* 5! */ _mm128x2_set1_pd_pd(0x1.1111111111111p-7 ,+0x1.1111111111111p-63),
+	/* 6! */ _mm128x2_set1_pd_pd(0x1.6c16c16c16c17p-10,-0x1.f49f49f49f49fp-65),
+	/* 7! */ _mm128x2_set1_pd_pd(0x1.a01a01a01a01ap-13,+0x1.a01a01a01a01ap-73),
+	/* 8! */ _mm128x2_set1_pd_pd(0x1.a01a01a01a01ap-16,+0x1.a01a01a01a01ap-76),
+	/* 9! */ _mm128x2_set1_pd_pd(0x1.71de3a556c734p-19,-0x1.c154f8ddc6c00p-73)
+	};
+	/* Strategy:  We first reduce the size of x by noting that
+
+			exp(kr + m * log(2)) = 2^m * exp(r)^k
+
+		where m and k are integers.  By choosing m appropriately
+		we can make |kr| <= log(2) / 2 = 0.347.  Then exp(r) is
+		evaluated using the familiar Taylor series.  Reducing the
+		argument substantially speeds up the convergence.       */
+
+	// const __m128d k = _mm_set1_pd(0x1.0p+9);
+	const __m128d inv_k = _mm_set1_pd(0x1.0p-9);
+
+	const __m128d const_log2e = _mm_const_log2e_pd();
+	const __m128dx2 const_ln2 = _mm128x2_const_ln2_pdx2();
+
+	__m128d m = _mm_floor_pd(
+		_mm_add_pd(_mm_mul_pd(x.hi, const_log2e), _mm_set1_pd(0.5))
+	);
+	*m_bin = _mm_cvttpd_epi32(m);
+
+	__m128dx2 r = _mm128x2_mul_power2_pdx2_pd(
+		_mm128x2_sub_pdx2(x, _mm128x2_mul_pdx2_pd(const_ln2, m)), inv_k
+	);
+	__m128dx2 s, t, p;
+
+	p = _mm128x2_square_pdx2(r);
+	s = _mm128x2_add_pdx2(r, _mm128x2_mul_power2_pdx2_pd(p, _mm_set1_pd(0.5)));
+	p = _mm128x2_mul_pdx2(p, r);
+	t = _mm128x2_mul_pdx2(p, inv_fact[0]);
+	int i = 0;
+	// Originally set to `i < 5`, adding another term will sometimes improve precision.
+	do {
+		s = _mm128x2_add_pdx2(s, t);
+		p = _mm128x2_mul_pdx2(p, r);
+		++i;
+		t = _mm128x2_mul_pdx2(p, inv_fact[i]);
+	} while (i < 6);
+
+	s = _mm128x2_add_pdx2(s, t);
+
+	// Undoes the 2^-9 scaling, exp(r)^k = (expm1(r) + 1)^(2^9)
+	for (int j = 0; j < 9; j++) {
+		s = _mm128x2_add_pdx2(_mm128x2_mul_power2_pdx2_pd(s, _mm_set1_pd(2.0)), _mm128x2_square_pdx2(s));
+	}
+
+	return s;
+	// Original return code:
+	// s += 1.0;
+	// return ldexp(s, static_cast<int>(m));
+}
+
+/**
+ * @brief Clamps x.hi to [-750.0, +710.0] so that exp(x) underflows to zero
+ * or overflows to infinity. NaN is clamped to -750.0 and must be blended
+ * back in afterwards.
+ */
+static inline __m128dx2 _mm128x2_exp_clamp_pdx2(__m128dx2 x) {
+	const __m128d exp_lower = _mm_set1_pd(-750.0);
+	const __m128d exp_upper = _mm_set1_pd(+710.0);
+	__m128d in_range = _mm_and_pd(
+		_mm_cmpgt_pd(x.hi, exp_lower),
+		_mm_cmplt_pd(x.hi, exp_upper)
+	);
+	x.hi = _mm_min_pd(_mm_max_pd(x.hi, exp_lower), exp_upper);
+	x.lo = _mm_and_pd(x.lo, in_range);
+	return x;
+}
+
+__m128dx2 _mm128x2_exp_pdx2(const __m128dx2 x) {
+	__m128i m_bin;
+	__m128dx2 ret = _mm128x2_taylor_expm1_pdx2(
+		_mm128x2_exp_clamp_pdx2(x), &m_bin
+	);
+	ret = _mm128x2_add_pdx2_pd(ret, _mm_set1_pd(1.0));
+	ret = _mm128x2_ldexp_pdx2_epi32(ret, m_bin);
+
+	// Propagates NaN
+	const __m128d x_isnan = _mm_isnan_pd(x.hi);
+	ret.hi = _internal_mm_blendv_pd(ret.hi, x.hi, x_isnan);
+	ret.lo = _internal_mm_blendv_pd(ret.lo, x.hi, x_isnan);
+	return ret;
+}
+
+__m128dx2 _mm128x2_expm1_pdx2(const __m128dx2 x) {
+	__m128i m_bin;
+	__m128dx2 ret_expm1 = _mm128x2_taylor_expm1_pdx2(
+		_mm128x2_exp_clamp_pdx2(x), &m_bin
+	);
+
+	__m128dx2 ret = _mm128x2_add_pdx2_pd(ret_expm1, _mm_set1_pd(1.0));
+
+	ret = _mm128x2_ldexp_pdx2_epi32(ret, m_bin);
+	ret = _mm128x2_sub_pdx2_pd(ret, _mm_set1_pd(1.0));
+
+	// Check if x was in range
+	const __m128dx2 const_half_ln2 = _mm128x2_mul_power2_pdx2_pd(
+		_mm128x2_const_ln2_pdx2(), _mm_set1_pd(0.5)
+	);
+	__m128d ret_cmp = _mm_cmplt_pdx2(_mm128x2_fabs_pdx2(x), const_half_ln2);
+
+	ret.hi = _internal_mm_blendv_pd(ret.hi, ret_expm1.hi, ret_cmp);
+	ret.lo = _internal_mm_blendv_pd(ret.lo, ret_expm1.lo, ret_cmp);
+
+	// Avoids inf - inf when subtracting 1.0
+	const __m128d x_overflow = _mm_cmpge_pd(x.hi, _mm_set1_pd(709.79));
+	ret.hi = _internal_mm_blendv_pd(ret.hi, _mm_get_infinity_pd(), x_overflow);
+	ret.lo = _internal_mm_blendv_pd(ret.lo, _mm_setzero_pd(), x_overflow);
+
+	// Propagates NaN
+	const __m128d x_isnan = _mm_isnan_pd(x.hi);
+	ret.hi = _internal_mm_blendv_pd(ret.hi, x.hi, x_isnan);
+	ret.lo = _internal_mm_blendv_pd(ret.lo, x.hi, x_isnan);
+	return ret;
+}
+
+/**
+ * @brief log_table_invc[i - 90] is 128 / i rounded to fp64, for 128 / i in
+ * [sqrt(0.5), sqrt(2)].
+ */
+static const fp64 _mm128x2_log_table_invc[92] = {
+/*  90 */ 0x1.6c16c16c16c17p+0,
+/*  91 */ 0x1.6816816816817p+0,
+/*  92 */ 0x1.642c8590b2164p+0,
+/*  93 */ 0x1.6058160581606p+0,
+/*  94 */ 0x1.5c9882b931057p+0,
+/*  95 */ 0x1.58ed2308158edp+0,
+/*  96 */ 0x1.5555555555555p+0,
+/*  97 */ 0x1.51d07eae2f815p+0,
+/*  98 */ 0x1.4e5e0a72f0539p+0,
+/*  99 */ 0x1.4afd6a052bf5bp+0,
+/* 100 */ 0x1.47ae147ae147bp+0,
+/* 101 */ 0x1.446f86562d9fbp+0,
+/* 102 */ 0x1.4141414141414p+0,
+/* 103 */ 0x1.3e22cbce4a902p+0,
+/* 104 */ 0x1.3b13b13b13b14p+0,
+/* 105 */ 0x1.3813813813814p+0,
+/* 106 */ 0x1.3521cfb2b78c1p+0,
+/* 107 */ 0x1.323e34a2b10bfp+0,
+/* 108 */ 0x1.2f684bda12f68p+0,
+/* 109 */ 0x1.2c9fb4d812ca0p+0,
+/* 110 */ 0x1.29e4129e4129ep+0,
+/* 111 */ 0x1.27350b8812735p+0,
+/* 112 */ 0x1.2492492492492p+0,
+/* 113 */ 0x1.21fb78121fb78p+0,
+/* 114 */ 0x1.1f7047dc11f70p+0,
+/* 115 */ 0x1.1cf06ada2811dp+0,
+/* 116 */ 0x1.1a7b9611a7b96p+0,
+/* 117 */ 0x1.1811811811812p+0,
+/* 118 */ 0x1.15b1e5f75270dp+0,
+/* 119 */ 0x1.135c81135c811p+0,
+/* 120 */ 0x1.1111111111111p+0,
+/* 121 */ 0x1.0ecf56be69c90p+0,
+/* 122 */ 0x1.0c9714fbcda3bp+0,
+/* 123 */ 0x1.0a6810a6810a7p+0,
+/* 124 */ 0x1.0842108421084p+0,
+/* 125 */ 0x1.0624dd2f1a9fcp+0,
+/* 126 */ 0x1.0410410410410p+0,
+/* 127 */ 0x1.0204081020408p+0,
+/* 128 */ 0x1.0000000000000p+0,
+/* 129 */ 0x1.fc07f01fc07f0p-1,
+/* 130 */ 0x1.f81f81f81f820p-1,
+/* 131 */ 0x1.f44659e4a4271p-1,
+/* 132 */ 0x1.f07c1f07c1f08p-1,
+/* 133 */ 0x1.ecc07b301ecc0p-1,
+/* 134 */ 0x1.e9131abf0b767p-1,
+/* 135 */ 0x1.e573ac901e574p-1,
+/* 136 */ 0x1.e1e1e1e1e1e1ep-1,
+/* 137 */ 0x1.de5d6e3f8868ap-1,
+/* 138 */ 0x1.dae6076b981dbp-1,
+/* 139 */ 0x1.d77b654b82c34p-1,
+/* 140 */ 0x1.d41d41d41d41dp-1,
+/* 141 */ 0x1.d0cb58f6ec074p-1,
+/* 142 */ 0x1.cd85689039b0bp-1,
+/* 143 */ 0x1.ca4b3055ee191p-1,
+/* 144 */ 0x1.c71c71c71c71cp-1,
+/* 145 */ 0x1.c3f8f01c3f8f0p-1,
+/* 146 */ 0x1.c0e070381c0e0p-1,
+/* 147 */ 0x1.bdd2b899406f7p-1,
+/* 148 */ 0x1.bacf914c1bad0p-1,
+/* 149 */ 0x1.b7d6c3dda338bp-1,
+/* 150 */ 0x1.b4e81b4e81b4fp-1,
+/* 151 */ 0x1.b2036406c80d9p-1,
+/* 152 */ 0x1.af286bca1af28p-1,
+/* 153 */ 0x1.ac5701ac5701bp-1,
+/* 154 */ 0x1.a98ef606a63bep-1,
+/* 155 */ 0x1.a6d01a6d01a6dp-1,
+/* 156 */ 0x1.a41a41a41a41ap-1,
+/* 157 */ 0x1.a16d3f97a4b02p-1,
+/* 158 */ 0x1.9ec8e951033d9p-1,
+/* 159 */ 0x1.9c2d14ee4a102p-1,
+/* 160 */ 0x1.999999999999ap-1,
+/* 161 */ 0x1.970e4f80cb872p-1,
+/* 162 */ 0x1.948b0fcd6e9e0p-1,
+/* 163 */ 0x1.920fb49d0e229p-1,
+/* 164 */ 0x1.8f9c18f9c18fap-1,
+/* 165 */ 0x1.8d3018d3018d3p-1,
+/* 166 */ 0x1.8acb90f6bf3aap-1,
+/* 167 */ 0x1.886e5f0abb04ap-1,
+/* 168 */ 0x1.8618618618618p-1,
+/* 169 */ 0x1.83c977ab2beddp-1,
+/* 170 */ 0x1.8181818181818p-1,
+/* 171 */ 0x1.7f405fd017f40p-1,
+/* 172 */ 0x1.7d05f417d05f4p-1,
+/* 173 */ 0x1.7ad2208e0ecc3p-1,
+/* 174 */ 0x1.78a4c8178a4c8p-1,
+/* 175 */ 0x1.767dce434a9b1p-1,
+/* 176 */ 0x1.745d1745d1746p-1,
+/* 177 */ 0x1.724287f46debcp-1,
+/* 178 */ 0x1.702e05c0b8170p-1,
+/* 179 */ 0x1.6e1f76b4337c7p-1,
+/* 180 */ 0x1.6c16c16c16c17p-1,
+/* 181 */ 0x1.6a13cd1537290p-1
+};
+
+/**
+ * @brief log_table_log[i] = -log(log_table_invc[i])
+ */
+static const Float64x2 _mm128x2_log_table_log[92] = {
+/*  90 */ {-0x1.68ac83e9c6a15p-2,+0x1.acd8a9145ff44p-57},
+/*  91 */ {-0x1.5d5bddf595f31p-2,-0x1.d5f75b9a23ae4p-59},
+/*  92 */ {-0x1.522ae0738a3d7p-2,-0x1.3840b263acb43p-56},
+/*  93 */ {-0x1.4718dc271c41cp-2,-0x1.d8fb4c14c56eep-56},
+/*  94 */ {-0x1.3c25277333183p-2,-0x1.152d81af5713ap-56},
+/*  95 */ {-0x1.314f1e1d35ce3p-2,-0x1.22966f61a3c23p-56},
+/*  96 */ {-0x1.269621134db91p-2,-0x1.e0efadd9db02ap-56},
+/*  97 */ {-0x1.1bf99635a6b95p-2,+0x1.e9575c2124912p-56},
+/*  98 */ {-0x1.1178e8227e47ap-2,-0x1.b8ce2d07f1cb7p-56},
+/*  99 */ {-0x1.07138604d5864p-2,+0x1.24e912b16ec8bp-60},
+/* 100 */ {-0x1.f991c6cb3b37ap-3,-0x1.ecca0cdf30143p-58},
+/* 101 */ {-0x1.e530effe71013p-3,+0x1.f7627ef82f3f0p-57},
+/* 102 */ {-0x1.d1037f2655e7bp-3,+0x1.3f3adb7b71cbcp-58},
+/* 103 */ {-0x1.bd087383bd8aap-3,+0x1.1165504ad749ep-59},
+/* 104 */ {-0x1.a93ed3c8ad9e5p-3,-0x1.bcafa9de97202p-57},
+/* 105 */ {-0x1.95a5adcf70182p-3,-0x1.8a16283fdbd1cp-57},
+/* 106 */ {-0x1.823c16551a3c0p-3,-0x1.6dcd318f4187ep-57},
+/* 107 */ {-0x1.6f0128b756ab9p-3,+0x1.37967087859b9p-59},
+/* 108 */ {-0x1.5bf406b543db0p-3,+0x1.1f5b44c0df7f7p-61},
+/* 109 */ {-0x1.4913d8333b563p-3,+0x1.0d5604930f137p-58},
+/* 110 */ {-0x1.365fcb0159014p-3,-0x1.bea08d2dca256p-57},
+/* 111 */ {-0x1.23d712a49c201p-3,-0x1.51c7e9efae297p-57},
+/* 112 */ {-0x1.1178e8227e47ap-3,+0x1.0e63a5f01c693p-58},
+/* 113 */ {-0x1.fe89139dbd565p-4,+0x1.ac9f4215f9394p-58},
+/* 114 */ {-0x1.da7276384469ep-4,-0x1.401fa71733017p-58},
+/* 115 */ {-0x1.b6ac88dad5b1dp-4,+0x1.002bf768e52d0p-58},
+/* 116 */ {-0x1.9335e5d594988p-4,+0x1.478a85704ccb7p-58},
+/* 117 */ {-0x1.700d30aeac0e8p-4,-0x1.a36a677b4c8b2p-59},
+/* 118 */ {-0x1.4d3115d207eacp-4,-0x1.da7d0b1e10b2fp-60},
+/* 119 */ {-0x1.2aa04a44717a1p-4,-0x1.aea2c72d05c08p-58},
+/* 120 */ {-0x1.08598b59e3a06p-4,+0x1.dd7009902bf32p-58},
+/* 121 */ {-0x1.ccb73cdddb2d0p-5,+0x1.e48fb0500efd5p-59},
+/* 122 */ {-0x1.894aa149fb34bp-5,+0x1.2ba0b44cfaee5p-59},
+/* 123 */ {-0x1.466aed42de3f9p-5,+0x1.9badefe942718p-60},
+/* 124 */ {-0x1.0415d89e74440p-5,-0x1.c05cf1d753621p-59},
+/* 125 */ {-0x1.8492528c8cac5p-6,+0x1.d192d0619fa68p-60},
+/* 126 */ {-0x1.0205658935837p-6,-0x1.27c8e8416e717p-60},
+/* 127 */ {-0x1.010157588de69p-7,-0x1.46662d417cecep-62},
+/* 128 */ {0x0.0000000000000p+0 ,+0x0.0000000000000p+0 },
+/* 129 */ {0x1.fe02a6b106799p-8 ,-0x1.e44b7e3711e7fp-67},
+/* 130 */ {0x1.fc0a8b0fc03c4p-7 ,-0x1.83092c5964281p-62},
+/* 131 */ {0x1.7b91b07d5b126p-6 ,-0x1.6d80ab38e9430p-62},
+/* 132 */ {0x1.f829b0e7832f8p-6 ,+0x1.33e3f04f1ef25p-60},
+/* 133 */ {0x1.39e87b9febd68p-5 ,-0x1.5bfa937f551b7p-59},
+/* 134 */ {0x1.77458f632dcffp-5 ,+0x1.8d3ca87b92968p-63},
+/* 135 */ {0x1.b42dd711971b9p-5 ,+0x1.0a34531f67db5p-59},
+/* 136 */ {0x1.f0a30c01162a8p-5 ,+0x1.85f325c5bbacdp-59},
+/* 137 */ {0x1.16536eea37ae3p-4 ,+0x1.2189705cf74cap-58},
+/* 138 */ {0x1.341d7961bd1d0p-4 ,-0x1.3599f227becbbp-58},
+/* 139 */ {0x1.51b073f06183cp-4 ,-0x1.5b61c65e5741ap-58},
+/* 140 */ {0x1.6f0d28ae56b4ep-4 ,-0x1.20db323097324p-59},
+/* 141 */ {0x1.8c345d6319b23p-4 ,-0x1.294d2f5668495p-58},
+/* 142 */ {0x1.a926d3a4ad562p-4 ,-0x1.d7a16eab1e2adp-59},
+/* 143 */ {0x1.c5e548f5bc743p-4 ,+0x1.2eb0bf7c0b0d9p-59},
+/* 144 */ {0x1.e27076e2af2eap-4 ,-0x1.61578001e015ap-60},
+/* 145 */ {0x1.fec9131dbeabcp-4 ,-0x1.5746b9981b36cp-58},
+/* 146 */ {0x1.0d77e7cd08e5bp-3 ,+0x1.9a5dc5e9030adp-57},
+/* 147 */ {0x1.1b72ad52f67a2p-3 ,-0x1.fbe7ee5c69946p-57},
+/* 148 */ {0x1.29552f81ff521p-3 ,+0x1.301771c407dc0p-57},
+/* 149 */ {0x1.371fc201e8f75p-3 ,+0x1.e6cb62af18a02p-62},
+/* 150 */ {0x1.44d2b6ccb7d1cp-3 ,+0x1.7d3d950f87e23p-59},
+/* 151 */ {0x1.526e5e3a1b438p-3 ,-0x1.546ff8a470d3ap-57},
+/* 152 */ {0x1.5ff3070a793d6p-3 ,-0x1.bc60efafc6f6cp-58},
+/* 153 */ {0x1.6d60fe719d21bp-3 ,+0x1.d551d97132e87p-57},
+/* 154 */ {0x1.7ab890210d907p-3 ,-0x1.1072534a57e7dp-57},
+/* 155 */ {0x1.87fa06520c911p-3 ,-0x1.9f7fdbfa08d9ap-57},
+/* 156 */ {0x1.9525a9cf456b6p-3 ,-0x1.26fb3e2b1d1dap-57},
+/* 157 */ {0x1.a23bc1fe2b561p-3 ,+0x1.24dc46c1ea664p-57},
+/* 158 */ {0x1.af3c94e80bff3p-3 ,+0x1.a3398064df33ep-57},
+/* 159 */ {0x1.bc286742d8cd4p-3 ,+0x1.cfce744870f57p-58},
+/* 160 */ {0x1.c8ff7c79a9a20p-3 ,-0x1.4f689f8434011p-57},
+/* 161 */ {0x1.d5c216b4fbb94p-3 ,-0x1.a37794d03657dp-58},
+/* 162 */ {0x1.e27076e2af2e8p-3 ,-0x1.61578001e015ep-59},
+/* 163 */ {0x1.ef0adcbdc5935p-3 ,+0x1.e8637950dc20dp-57},
+/* 164 */ {0x1.fb9186d5e3e29p-3 ,+0x1.355519b0de535p-57},
+/* 165 */ {0x1.0402594b4d041p-2 ,-0x1.08ec217a5022dp-57},
+/* 166 */ {0x1.0a324e27390e2p-2 ,+0x1.bdcfde8061c03p-56},
+/* 167 */ {0x1.1058bf9ae4ad4p-2 ,+0x1.3f415699663ecp-63},
+/* 168 */ {0x1.1675cababa60fp-2 ,+0x1.ce63eab883727p-61},
+/* 169 */ {0x1.1c898c16999fbp-2 ,+0x1.9f1a39d500e3cp-56},
+/* 170 */ {0x1.22941fbcf7966p-2 ,-0x1.dbd7ac258a2bdp-58},
+/* 171 */ {0x1.2895a13de86a4p-2 ,+0x1.7ad24c13f040fp-56},
+/* 172 */ {0x1.2e8e2bae11d31p-2 ,-0x1.1e99b72bd7bf2p-57},
+/* 173 */ {0x1.347dd9a987d56p-2 ,-0x1.16ea62c048cfbp-56},
+/* 174 */ {0x1.3a64c556945eap-2 ,+0x1.cbcd735d03424p-60},
+/* 175 */ {0x1.404308686a7e4p-2 ,-0x1.f79f6c1059cdbp-57},
+/* 176 */ {0x1.4618bc21c5ec2p-2 ,-0x1.7a42642661c62p-61},
+/* 177 */ {0x1.4be5f957778a1p-2 ,-0x1.4b366b609027ap-58},
+/* 178 */ {0x1.51aad872df82ep-2 ,-0x1.d8db0a7cc1543p-56},
+/* 179 */ {0x1.5767717455a6cp-2 ,-0x1.fb2a49af933e8p-57},
+/* 180 */ {0x1.5d1bdbf5809cap-2 ,-0x1.7dc9c7c23801fp-56},
+/* 181 */ {0x1.62c82f2b9c796p-2 ,-0x1.090a0dd59fe35p-58}
+};
+
+/**
+ * @brief Loads table[index] for each lane.
+ * @note index must be within the bounds of table.
+ */
+static inline __m128d _mm_lookup_table_pd(
+	const fp64* const table, const __m128i index
+) {
+	const int32_t i_0 = _mm_cvtsi128_si32(index);
+	const int32_t i_1 = _mm_cvtsi128_si32(_mm_shuffle_epi32(index, _MM_SHUFFLE(1, 1, 1, 1)));
+	return _mm_set_pd(table[i_1], table[i_0]);
+}
+
+/**
+ * @brief Loads table[index] for each lane.
+ * @note index must be within the bounds of table.
+ */
+static inline __m128dx2 _mm128x2_lookup_table_pdx2(
+	const Float64x2* const table, const __m128i index
+) {
+	const int32_t i_0 = _mm_cvtsi128_si32(index);
+	const int32_t i_1 = _mm_cvtsi128_si32(_mm_shuffle_epi32(index, _MM_SHUFFLE(1, 1, 1, 1)));
+	// Each Float64x2 is already laid out as {hi, lo}
+	const __m128d val_0 = _mm_loadu_pd(&table[i_0].hi);
+	const __m128d val_1 = _mm_loadu_pd(&table[i_1].hi);
+	__m128dx2 ret;
+	ret.hi = _mm_unpacklo_pd(val_0, val_1);
+	ret.lo = _mm_unpackhi_pd(val_0, val_1);
+	return ret;
+}
+
+/** 
+ * @brief Logarithm.  Computes log(x) in double-double precision.
+ * @note This is a natural logarithm (i.e., base e).
+ *
+ * @details Uses the same algorithm as _mm256x2_log_pdx2, so that every
+ * dispatch level gives the same accuracy. x = 2^e * m, where m is in
+ * [sqrt(0.5), sqrt(2)], and r = m * invc - 1 is exact and smaller than
+ * 2^-7.5. log(1 + r) = 2 * atanh(s), where s = r / (2 + r).
+ */
+__m128dx2 _mm128x2_log_pdx2(const __m128dx2 x) {
+	/* 1 / (2k + 1) for k = 1 to 6 */
+	const __m128dx2 inv_odd[6] = {
+	/* 1/ 3 */ _mm128x2_set1_pd_pd(0x1.5555555555555p-2 ,+0x1.5555555555555p-56),
+	/* 1/ 5 */ _mm128x2_set1_pd_pd(0x1.999999999999ap-3 ,-0x1.999999999999ap-57),
+	/* 1/ 7 */ _mm128x2_set1_pd_pd(0x1.2492492492492p-3 ,+0x1.2492492492492p-57),
+	/* 1/ 9 */ _mm128x2_set1_pd_pd(0x1.c71c71c71c71cp-4 ,+0x1.c71c71c71c71cp-58),
+	/* 1/11 */ _mm128x2_set1_pd_pd(0x1.745d1745d1746p-4 ,-0x1.745d1745d1746p-59),
+	/* 1/13 */ _mm128x2_set1_pd_pd(0x1.3b13b13b13b14p-4 ,-0x1.3b13b13b13b14p-58)
+	};
+	const __m128d one = _mm_set1_pd(1.0);
+
+	/* x = 2^e * m */
+	const __m128i expon = _mm128x2_ilogb_pdx2_epi32(x);
+	__m128dx2 m = _mm128x2_ldexp_pdx2_epi32(x, _mm_sub_epi32(_mm_setzero_si128(), expon));
+	const __m128d m_large = _mm_cmpgt_pd(m.hi, _mm_const_sqrt2_pd());
+	m = _mm128x2_mul_power2_pdx2_pd(m, _internal_mm_blendv_pd(one, _mm_set1_pd(0.5), m_large));
+	const __m128d e = _mm_add_pd(_mm_cvtepi32_pd(expon), _mm_and_pd(m_large, one));
+
+	__m128d c = _mm_floor_pd(_mm_add_pd(
+		_mm_mul_pd(m.hi, _mm_set1_pd(128.0)), _mm_set1_pd(0.5)
+	));
+	const __m128d near_one = _mm_cmplt_pd(
+		_mm_fabs_pd(_mm_sub_pd(m.hi, one)), _mm_set1_pd(0x1.0p-7)
+	);
+	c = _internal_mm_blendv_pd(c, _mm_set1_pd(128.0), near_one);
+	// Keeps the table index in bounds for zero, NaN, and infinity
+	c = _mm_min_pd(_mm_max_pd(c, _mm_set1_pd(90.0)), _mm_set1_pd(181.0));
+	const __m128i index = _mm_cvttpd_epi32(_mm_sub_pd(c, _mm_set1_pd(90.0)));
+	const __m128d invc = _mm_lookup_table_pd(_mm128x2_log_table_invc, index);
+
+	/* r = m * invc - 1 */
+	const __m128dx2 p_hi = _mm128x2_dekker_mul12_pd(m.hi, invc);
+	__m128dx2 r = _mm128x2_add_pd_pd(_mm_sub_pd(p_hi.hi, one), p_hi.lo);
+	r = _mm128x2_add_pdx2(r, _mm128x2_dekker_mul12_pd(m.lo, invc));
+
+	/* log(1 + r) = r - r * s + 2 * s^3 * (1/3 + s^2/5 + ...) */
+	const __m128dx2 s = _mm128x2_div_pdx2(r, _mm128x2_add_pdx2_pd(r, _mm_set1_pd(2.0)));
+	const __m128dx2 z = _mm128x2_square_pdx2(s);
+	__m128d tail = inv_odd[5].hi;
+	tail = _mm_add_pd(_mm_mul_pd(tail, z.hi), inv_odd[4].hi);
+	tail = _mm_add_pd(_mm_mul_pd(tail, z.hi), inv_odd[3].hi);
+	__m128dx2 p = _mm128x2_add_pdx2(inv_odd[2], _mm128x2_mul_pdx2_pd(z, tail));
+	p = _mm128x2_add_pdx2(inv_odd[1], _mm128x2_mul_pdx2(z, p));
+	p = _mm128x2_add_pdx2(inv_odd[0], _mm128x2_mul_pdx2(z, p));
+	const __m128dx2 log1p_r = _mm128x2_add_pdx2(
+		_mm128x2_sub_pdx2(r, _mm128x2_mul_pdx2(r, s)),
+		_mm128x2_mul_pdx2(_mm128x2_mul_power2_pdx2_pd(
+			_mm128x2_mul_pdx2(s, z), _mm_set1_pd(2.0)
+		), p)
+	);
+
+	__m128dx2 ret = _mm128x2_add_pdx2(
+		_mm128x2_mul_pdx2_pd(_mm128x2_const_ln2_pdx2(), e),
+		_mm128x2_lookup_table_pdx2(_mm128x2_log_table_log, index)
+	);
+	ret = _mm128x2_add_pdx2(ret, log1p_r);
+
+	// log(+inf) = +inf
+	const __m128d x_isinf = _mm_cmpeq_pd(x.hi, _mm_get_infinity_pd());
+	ret.hi = _internal_mm_blendv_pd(ret.hi, x.hi, x_isinf);
+	ret.lo = _internal_mm_blendv_pd(ret.lo, _mm_setzero_pd(), x_isinf);
+
+	// log(0.0) = -inf
+	const __m128d x_iszero = _mm_cmpeq_pd(x.hi, _mm_setzero_pd());
+	ret.hi = _internal_mm_blendv_pd(ret.hi, _mm_negate_pd(_mm_get_infinity_pd()), x_iszero);
+	ret.lo = _internal_mm_blendv_pd(ret.lo, _mm_setzero_pd(), x_iszero);
+
+	// log(x < 0.0) = NaN, and propagates NaN
+	const __m128d x_isnan = _mm_cmpnge_pd(x.hi, _mm_setzero_pd());
+	ret.hi = _internal_mm_blendv_pd(ret.hi, _mm_get_qNaN_pd(), x_isnan);
+	ret.lo = _internal_mm_blendv_pd(ret.lo, _mm_get_qNaN_pd(), x_isnan);
+	return ret;
+}
+
+/**
+ * @brief Computes log1p(x) as log(u) + (x - (u - 1)) / u, where u = 1 + x.
+ * The second term corrects for the rounding of u, and u - 1 is exact.
+ */
+__m128dx2 _mm128x2_log1p_pdx2(const __m128dx2 x) {
+	const __m128d one = _mm_set1_pd(1.0);
+	const __m128dx2 u = _mm128x2_add_pdx2_pd(x, one);
+	// log(x <= -1.0) is handled by _mm128x2_log_pdx2
+	__m128dx2 ret = _mm128x2_log_pdx2(u);
+
+	const __m128dx2 u_err = _mm128x2_sub_pdx2(x, _mm128x2_sub_pdx2_pd(u, one));
+	const __m128dx2 ret_corrected = _mm128x2_add_pdx2(ret, _mm128x2_div_pdx2(u_err, u));
+	// Keeps log(u) when u is zero or infinite, since the correction is NaN
+	const __m128d u_finite = _mm_and_pd(
+		_mm_cmpgt_pd(u.hi, _mm_setzero_pd()),
+		_mm_cmplt_pd(u.hi, _mm_get_infinity_pd())
+	);
+	ret.hi = _internal_mm_blendv_pd(ret.hi, ret_corrected.hi, u_finite);
+	ret.lo = _internal_mm_blendv_pd(ret.lo, ret_corrected.lo, u_finite);
+
+	// log1p(+inf) = +inf, and log1p(-0.0) = -0.0
+	const __m128d x_isinf = _mm_cmpeq_pd(x.hi, _mm_get_infinity_pd());
+	const __m128d x_iszero = _mm_cmpeq_pd(x.hi, _mm_setzero_pd());
+	const __m128d x_keep = _mm_or_pd(x_isinf, x_iszero);
+	ret.hi = _internal_mm_blendv_pd(ret.hi, x.hi, x_keep);
+	ret.lo = _internal_mm_blendv_pd(ret.lo, _mm_setzero_pd(), x_keep);
+	return ret;
+}
+
+__m128dx2 _mm128x2_pow_pdx2(const __m128dx2 x, const __m128dx2 y) {
+	fp64 x_hi[2], x_lo[2], y_hi[2], y_lo[2];
+	_mm_storeu_pd(x_hi, x.hi);
+	_mm_storeu_pd(x_lo, x.lo);
+	_mm_storeu_pd(y_hi, y.hi);
+	_mm_storeu_pd(y_lo, y.lo);
+	Float64x2 x_val[2] = {{x_hi[0], x_lo[0]}, {x_hi[1], x_lo[1]}};
+	const Float64x2 y_val[2] = {{y_hi[0], y_lo[0]}, {y_hi[1], y_lo[1]}};
+	x_val[0] = Float64x2_pow(x_val[0], y_val[0]);
+	x_val[1] = Float64x2_pow(x_val[1], y_val[1]);
+	__m128dx2 ret;
+	ret.hi = _mm_set_pd(x_val[1].hi, x_val[0].hi);
+	ret.lo = _mm_set_pd(x_val[1].lo, x_val[0].lo);
+	return ret;
+}
+
+__m128dx2 _mm128x2_pow_pdx2_pd(const __m128dx2 x, const __m128d y) {
+	fp64 x_hi[2], x_lo[2], y_val[2];
+	_mm_storeu_pd(x_hi, x.hi);
+	_mm_storeu_pd(x_lo, x.lo);
+	_mm_storeu_pd(y_val, y);
+	Float64x2 x_val[2] = {{x_hi[0], x_lo[0]}, {x_hi[1], x_lo[1]}};
+	x_val[0] = Float64x2_pow_dx2_d(x_val[0], y_val[0]);
+	x_val[1] = Float64x2_pow_dx2_d(x_val[1], y_val[1]);
+	__m128dx2 ret;
+	ret.hi = _mm_set_pd(x_val[1].hi, x_val[0].hi);
+	ret.lo = _mm_set_pd(x_val[1].lo, x_val[0].lo);
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m128dx2 trigonometry
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Table of sin(k * pi/16) and cos(k * pi/16) for k = -4 to +4.
+ * Indexed with k + 4.
+ */
+static const Float64x2 _mm128x2_sin_table[9] = {
+	{-7.071067811865475727e-01, +4.833646656726456726e-17},
+	{-5.555702330196021776e-01, -4.709410940561676821e-17},
+	{-3.826834323650897818e-01, +1.005077269646158761e-17},
+	{-1.950903220161282758e-01, +7.991079068461731263e-18},
+	{ 0.000000000000000000e+00, +0.000000000000000000e+00},
+	{+1.950903220161282758e-01, -7.991079068461731263e-18},
+	{+3.826834323650897818e-01, -1.005077269646158761e-17},
+	{+5.555702330196021776e-01, +4.709410940561676821e-17},
+	{+7.071067811865475727e-01, -4.833646656726456726e-17}
+};
+
+static const Float64x2 _mm128x2_cos_table[9] = {
+	{+7.071067811865475727e-01, -4.833646656726456726e-17},
+	{+8.314696123025452357e-01, +1.407385698472802389e-18},
+	{+9.238795325112867385e-01, +1.764504708433667706e-17},
+	{+9.807852804032304306e-01, +1.854693999782500573e-17},
+	{+1.000000000000000000e+00, +0.000000000000000000e+00},
+	{+9.807852804032304306e-01, +1.854693999782500573e-17},
+	{+9.238795325112867385e-01, +1.764504708433667706e-17},
+	{+8.314696123025452357e-01, +1.407385698472802389e-18},
+	{+7.071067811865475727e-01, -4.833646656726456726e-17}
+};
+
+/**
+ * @brief Computes sin(x) and cos(x) using Taylor series.
+ * @note Assumes |x| <= pi/32.
+ *
+ * @author Taken from libQD dd_real.cpp which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+static inline void _mm128x2_sincos_taylor_pdx2(
+	const __m128dx2 x, __m128dx2* const p_sin, __m128dx2* const p_cos
+) {
+	/**
+	 * @remarks (pi/32)^21 / 21! is below 2^-106 * (pi/32), so the series is
+	 * truncated after the 19! term instead of checking a threshold.
+	 */
+	const __m128dx2 inv_fact_odd[9] = {
+	/*  3! */ _mm128x2_set1_pd_pd(0x1.5555555555555p-3 ,+0x1.5555555555555p-57 ),
+	/*  5! */ _mm128x2_set1_pd_pd(0x1.1111111111111p-7 ,+0x1.1111111111111p-63 ),
+	/*  7! */ _mm128x2_set1_pd_pd(0x1.a01a01a01a01ap-13,+0x1.a01a01a01a01ap-73 ),
+	/*  9! */ _mm128x2_set1_pd_pd(0x1.71de3a556c734p-19,-0x1.c154f8ddc6c00p-73 ),
+	/* 11! */ _mm128x2_set1_pd_pd(0x1.ae64567f544e4p-26,-0x1.c062e06d1f209p-80 ),
+	/* 13! */ _mm128x2_set1_pd_pd(0x1.6124613a86d09p-33,+0x1.f28e0cc748ebep-87 ),
+	/* 15! */ _mm128x2_set1_pd_pd(0x1.ae7f3e733b81fp-41,+0x1.1d8656b0ee8cbp-97 ),
+	/* 17! */ _mm128x2_set1_pd_pd(0x1.952c77030ad4ap-49,+0x1.ac981465ddc6cp-103),
+	/* 19! */ _mm128x2_set1_pd_pd(0x1.2f49b46814157p-57,+0x1.2650f61dbdcb4p-112)
+	};
+
+	const __m128dx2 neg_x_squared = _mm128x2_negate_pdx2(_mm128x2_square_pdx2(x));
+	__m128dx2 x_power = x;
+	__m128dx2 sum = _mm128x2_setzero_pdx2();
+	for (int i = 0; i < 9; i++) {
+		x_power = _mm128x2_mul_pdx2(x_power, neg_x_squared);
+		sum = _mm128x2_add_pdx2(sum, _mm128x2_mul_pdx2(x_power, inv_fact_odd[i]));
+	}
+	/**
+	 * @remarks Adding x towards the end improves the ULP slightly
+	 */
+	*p_sin = _mm128x2_add_pdx2(sum, x);
+	*p_cos = _mm128x2_sqrt_pdx2(_mm128x2_sub_pd_pdx2(
+		_mm_set1_pd(1.0), _mm128x2_square_pdx2(*p_sin)
+	));
+}
+
+/**
+ * @brief Computes sin(x) and cos(x) for both lanes at once.
+ *
+ * @details x is reduced to x = t + j * (pi/2) + k * (pi/16) with
+ * |t| <= pi/32, which is the same reduction used by libQD. Both steps are
+ * done at once with n = j * 8 + k, subtracting n * (pi/16) from x using a
+ * four part pi/16 so that the reduction stays accurate for large n.
+ * sin(k * pi/16) and cos(k * pi/16) are then loaded from a table, and the
+ * quadrant j is applied with blends.
+ */
+static inline void _mm128x2_sincos_kernel_pdx2(
+	const __m128dx2 x, __m128dx2* const p_sin, __m128dx2* const p_cos
+) {
+	/* pi/16 split into four doubles */
+	const __m128d pi16_0 = _mm_set1_pd(+0x1.921fb54442d18p-3);
+	const __m128d pi16_1 = _mm_set1_pd(+0x1.1a62633145c07p-57);
+	const __m128d pi16_2 = _mm_set1_pd(-0x1.f1976b7ed8fbcp-113);
+	const __m128d inv_pi16 = _mm_set1_pd(0x1.45f306dc9c883p+2);
+
+	const __m128d n = _mm_nearbyint_pd(_mm_mul_pd(x.hi, inv_pi16));
+
+	/* t = x - n * (pi/16) */
+	// x.hi - n * pi16_0 is exact since both are within a factor of two
+	const __m128dx2 p0 = _mm128x2_dekker_mul12_pd(n, pi16_0);
+	const __m128dx2 p1 = _mm128x2_dekker_mul12_pd(n, pi16_1);
+	__m128dx2 t = _mm128x2_add_pd_pd(_mm_sub_pd(x.hi, p0.hi), x.lo);
+	t = _mm128x2_sub_pdx2_pd(t, p0.lo);
+	t = _mm128x2_sub_pdx2_pd(t, p1.hi);
+	t = _mm128x2_sub_pdx2_pd(t, p1.lo);
+	t = _mm128x2_sub_pdx2_pd(t, _mm_mul_pd(n, pi16_2));
+
+	/* n = j * 8 + k where k is within [-4, +3] */
+	const __m128d j = _mm_floor_pd(
+		_mm_mul_pd(_mm_add_pd(n, _mm_set1_pd(4.0)), _mm_set1_pd(0.125))
+	);
+	__m128d k = _mm_sub_pd(n, _mm_mul_pd(j, _mm_set1_pd(8.0)));
+	// Keeps the table index in bounds for NaN, infinity, and huge values
+	k = _mm_min_pd(_mm_max_pd(k, _mm_set1_pd(-4.0)), _mm_set1_pd(4.0));
+	k = _mm_andnot_pd(_mm_cmpunord_pd(k, k), k);
+	const __m128i index = _mm_cvtpd_epi32(_mm_add_pd(k, _mm_set1_pd(4.0)));
+
+	/* sin(t + k * pi/16) and cos(t + k * pi/16) */
+	__m128dx2 t_sin, t_cos;
+	_mm128x2_sincos_taylor_pdx2(t, &t_sin, &t_cos);
+	const __m128dx2 u = _mm128x2_lookup_table_pdx2(_mm128x2_cos_table, index);
+	const __m128dx2 v = _mm128x2_lookup_table_pdx2(_mm128x2_sin_table, index);
+	const __m128dx2 sin_val = _mm128x2_add_pdx2(
+		_mm128x2_mul_pdx2(u, t_sin), _mm128x2_mul_pdx2(v, t_cos)
+	);
+	const __m128dx2 cos_val = _mm128x2_sub_pdx2(
+		_mm128x2_mul_pdx2(u, t_cos), _mm128x2_mul_pdx2(v, t_sin)
+	);
+
+	/* Applies the quadrant (j mod 4) */
+	const __m128d quadrant = _mm_sub_pd(j, _mm_mul_pd(
+		_mm_floor_pd(_mm_mul_pd(j, _mm_set1_pd(0.25))), _mm_set1_pd(4.0)
+	));
+	const __m128d quadrant_1 = _mm_cmpeq_pd(quadrant, _mm_set1_pd(1.0));
+	const __m128d quadrant_2 = _mm_cmpeq_pd(quadrant, _mm_set1_pd(2.0));
+	const __m128d quadrant_3 = _mm_cmpeq_pd(quadrant, _mm_set1_pd(3.0));
+	const __m128d swap = _mm_or_pd(quadrant_1, quadrant_3);
+	const __m128d sign_bit = _mm_get_sign_mask_pd();
+	const __m128d sin_sign = _mm_and_pd(_mm_or_pd(quadrant_2, quadrant_3), sign_bit);
+	const __m128d cos_sign = _mm_and_pd(_mm_or_pd(quadrant_1, quadrant_2), sign_bit);
+
+	p_sin->hi = _mm_xor_pd(_internal_mm_blendv_pd(sin_val.hi, cos_val.hi, swap), sin_sign);
+	p_sin->lo = _mm_xor_pd(_internal_mm_blendv_pd(sin_val.lo, cos_val.lo, swap), sin_sign);
+	p_cos->hi = _mm_xor_pd(_internal_mm_blendv_pd(cos_val.hi, sin_val.hi, swap), cos_sign);
+	p_cos->lo = _mm_xor_pd(_internal_mm_blendv_pd(cos_val.lo, sin_val.lo, swap), cos_sign);
+}
+
+__m128dx2 _mm128x2_sin_pdx2(const __m128dx2 x) {
+	__m128dx2 ret_sin, ret_cos;
+	_mm128x2_sincos_kernel_pdx2(x, &ret_sin, &ret_cos);
+	return ret_sin;
+}
+
+__m128dx2 _mm128x2_cos_pdx2(const __m128dx2 x) {
+	__m128dx2 ret_sin, ret_cos;
+	_mm128x2_sincos_kernel_pdx2(x, &ret_sin, &ret_cos);
+	return ret_cos;
+}
+
+void _mm128x2_sincos_pdx2(
+	const __m128dx2 theta, __m128dx2* const p_sin, __m128dx2* const p_cos
+) {
+	_mm128x2_sincos_kernel_pdx2(theta, p_sin, p_cos);
+}
+
+/**
+ * @brief Table of atan(i/16) for i = 0 to 16.
+ */
+static const Float64x2 _mm128x2_atan_table[17] = {
+	/*  0/16 */ {+0x0.0000000000000p+0 ,+0x0.0000000000000p+0  },
+	/*  1/16 */ {+0x1.ff55bb72cfdeap-5 ,-0x1.c934d86d23f1dp-60 },
+	/*  2/16 */ {+0x1.fd5ba9aac2f6ep-4 ,-0x1.cd37686760c17p-59 },
+	/*  3/16 */ {+0x1.7b97b4bce5b02p-3 ,+0x1.347b0b4f881cap-58 },
+	/*  4/16 */ {+0x1.f5b75f92c80ddp-3 ,+0x1.8ab6e3cf7afbdp-57 },
+	/*  5/16 */ {+0x1.362773707ebccp-2 ,-0x1.963a544b672d8p-57 },
+	/*  6/16 */ {+0x1.6f61941e4def1p-2 ,-0x1.c63aae6f6e918p-56 },
+	/*  7/16 */ {+0x1.a64eec3cc23fdp-2 ,-0x1.24dec1b50b7ffp-56 },
+	/*  8/16 */ {+0x1.dac670561bb4fp-2 ,+0x1.a2b7f222f65e2p-56 },
+	/*  9/16 */ {+0x1.0657e94db30d0p-1 ,-0x1.d5b495f6349e6p-56 },
+	/* 10/16 */ {+0x1.1e00babdefeb4p-1 ,-0x1.928df287a668fp-58 },
+	/* 11/16 */ {+0x1.345f01cce37bbp-1 ,+0x1.1021137c71102p-55 },
+	/* 12/16 */ {+0x1.4978fa3269ee1p-1 ,+0x1.2419a87f2a458p-56 },
+	/* 13/16 */ {+0x1.5d58987169b18p-1 ,+0x1.0028e4bc5e7cap-57 },
+	/* 14/16 */ {+0x1.700a7c5784634p-1 ,-0x1.8c34d25aadef6p-56 },
+	/* 15/16 */ {+0x1.819d0b7158a4dp-1 ,-0x1.bf76229d3b917p-56 },
+	/* 16/16 */ {+0x1.921fb54442d18p-1 ,+0x1.1a62633145c07p-55 }
+};
+
+/**
+ * @brief Computes atan(y / x) for 0 <= y <= x.
+ *
+ * @details Picks c = i/16 closest to y / x, so that
+ * atan(y / x) = atan(c) + atan(t) where t = (y - c * x) / (x + c * y) and
+ * |t| <= 1/32. atan(t) is then evaluated with a short Taylor series. This
+ * only needs one division, unlike the Newton iteration used by
+ * Float64x2_atan which also needs sincos.
+ */
+static inline __m128dx2 _mm128x2_atan_kernel_pdx2(
+	const __m128dx2 y, const __m128dx2 x
+) {
+	/**
+	 * @remarks (1/32)^20 / 21 is below 2^-106, so the series is truncated
+	 * after the t^21 term.
+	 */
+	const __m128dx2 atan_coef[10] = {
+	/* -1/3  */ _mm128x2_set1_pd_pd(-0x1.5555555555555p-2,-0x1.5555555555555p-56),
+	/* +1/5  */ _mm128x2_set1_pd_pd(+0x1.999999999999ap-3,-0x1.999999999999ap-57),
+	/* -1/7  */ _mm128x2_set1_pd_pd(-0x1.2492492492492p-3,-0x1.2492492492492p-57),
+	/* +1/9  */ _mm128x2_set1_pd_pd(+0x1.c71c71c71c71cp-4,+0x1.c71c71c71c71cp-58),
+	/* -1/11 */ _mm128x2_set1_pd_pd(-0x1.745d1745d1746p-4,+0x1.745d1745d1746p-59),
+	/* +1/13 */ _mm128x2_set1_pd_pd(+0x1.3b13b13b13b14p-4,-0x1.3b13b13b13b14p-58),
+	/* -1/15 */ _mm128x2_set1_pd_pd(-0x1.1111111111111p-4,-0x1.1111111111111p-60),
+	/* +1/17 */ _mm128x2_set1_pd_pd(+0x1.e1e1e1e1e1e1ep-5,+0x1.e1e1e1e1e1e1ep-61),
+	/* -1/19 */ _mm128x2_set1_pd_pd(-0x1.af286bca1af28p-5,-0x1.af286bca1af28p-59),
+	/* +1/21 */ _mm128x2_set1_pd_pd(+0x1.8618618618618p-5,+0x1.8618618618618p-59)
+	};
+
+	__m128d c = _mm_nearbyint_pd(
+		_mm_mul_pd(_mm_div_pd(y.hi, x.hi), _mm_set1_pd(16.0))
+	);
+	// Keeps the table index in bounds for NaN and infinity
+	c = _mm_min_pd(_mm_max_pd(c, _mm_setzero_pd()), _mm_set1_pd(16.0));
+	c = _mm_andnot_pd(_mm_cmpunord_pd(c, c), c);
+	const __m128i index = _mm_cvtpd_epi32(c);
+	c = _mm_mul_pd(c, _mm_set1_pd(0x1.0p-4));
+
+	const __m128dx2 t = _mm128x2_div_pdx2(
+		_mm128x2_sub_pdx2(y, _mm128x2_mul_pdx2_pd(x, c)),
+		_mm128x2_add_pdx2(x, _mm128x2_mul_pdx2_pd(y, c))
+	);
+	const __m128dx2 t_squared = _mm128x2_square_pdx2(t);
+	__m128dx2 poly = atan_coef[9];
+	for (int i = 8; i >= 0; i--) {
+		poly = _mm128x2_add_pdx2(_mm128x2_mul_pdx2(poly, t_squared), atan_coef[i]);
+	}
+	const __m128dx2 atan_t = _mm128x2_add_pdx2(
+		_mm128x2_mul_pdx2(_mm128x2_mul_pdx2(poly, t_squared), t), t
+	);
+
+	return _mm128x2_add_pdx2(
+		_mm128x2_lookup_table_pdx2(_mm128x2_atan_table, index), atan_t
+	);
+}
+
+__m128dx2 _mm128x2_atan2_pdx2(const __m128dx2 y, const __m128dx2 x) {
+	const __m128dx2 abs_y = _mm128x2_fabs_pdx2(y);
+	const __m128dx2 abs_x = _mm128x2_fabs_pdx2(x);
+
+	/* Reduces to atan(num / den) where 0 <= num <= den */
+	const __m128d swap = _mm_cmpgt_pd(abs_y.hi, abs_x.hi);
+	__m128dx2 num, den;
+	num.hi = _internal_mm_blendv_pd(abs_y.hi, abs_x.hi, swap);
+	num.lo = _internal_mm_blendv_pd(abs_y.lo, abs_x.lo, swap);
+	den.hi = _internal_mm_blendv_pd(abs_x.hi, abs_y.hi, swap);
+	den.lo = _internal_mm_blendv_pd(abs_x.lo, abs_y.lo, swap);
+
+	// atan(finite / inf) = atan(0.0) and atan(inf / inf) = atan(1.0)
+	const __m128d const_inf = _mm_get_infinity_pd();
+	const __m128d den_isinf = _mm_cmpeq_pd(den.hi, const_inf);
+	const __m128d num_isinf = _mm_cmpeq_pd(num.hi, const_inf);
+	num.hi = _internal_mm_blendv_pd(num.hi, _mm_and_pd(num_isinf, _mm_set1_pd(1.0)), den_isinf);
+	num.lo = _mm_andnot_pd(den_isinf, num.lo);
+	den.hi = _internal_mm_blendv_pd(den.hi, _mm_set1_pd(1.0), den_isinf);
+	den.lo = _mm_andnot_pd(den_isinf, den.lo);
+
+	__m128dx2 ret = _mm128x2_atan_kernel_pdx2(num, den);
+
+	const __m128dx2 const_pi = _mm128x2_const_pi_pdx2();
+	const __m128dx2 const_pi2 = _mm128x2_mul_power2_pdx2_pd(
+		const_pi, _mm_set1_pd(0.5)
+	);
+	__m128dx2 ret_temp;
+
+	/* atan(y / x) = pi/2 - atan(x / y) */
+	ret_temp = _mm128x2_sub_pdx2(const_pi2, ret);
+	ret.hi = _internal_mm_blendv_pd(ret.hi, ret_temp.hi, swap);
+	ret.lo = _internal_mm_blendv_pd(ret.lo, ret_temp.lo, swap);
+
+	/* x < 0.0 */
+	const __m128d x_signbit = _mm_signbit_pd(x.hi);
+	ret_temp = _mm128x2_sub_pdx2(const_pi, ret);
+	ret.hi = _internal_mm_blendv_pd(ret.hi, ret_temp.hi, x_signbit);
+	ret.lo = _internal_mm_blendv_pd(ret.lo, ret_temp.lo, x_signbit);
+
+	/* y < 0.0 */
+	const __m128d y_sign = _mm_and_pd(y.hi, _mm_get_sign_mask_pd());
+	ret.hi = _mm_xor_pd(ret.hi, y_sign);
+	ret.lo = _mm_xor_pd(ret.lo, y_sign);
+	return ret;
+}
+
+__m128dx2 _mm128x2_atan_pdx2(const __m128dx2 x) {
+	return _mm128x2_atan2_pdx2(x, _mm128x2_set1_pd(1.0));
+}
+
+/**
+ * @brief Computes sqrt(1 - x^2) as sqrt((1 - x) * (1 + x)) to avoid
+ * cancellation when |x| is close to 1.
+ */
+static inline __m128dx2 _mm128x2_sqrt_one_minus_square_pdx2(const __m128dx2 x) {
+	const __m128d one = _mm_set1_pd(1.0);
+	return _mm128x2_sqrt_pdx2(_mm128x2_mul_pdx2(
+		_mm128x2_sub_pd_pdx2(one, x), _mm128x2_add_pd_pdx2(one, x)
+	));
+}
+
+__m128dx2 _mm128x2_asin_pdx2(const __m128dx2 x) {
+	// |x| > 1.0 returns NaN from the square root
+	return _mm128x2_atan2_pdx2(x, _mm128x2_sqrt_one_minus_square_pdx2(x));
+}
+
+__m128dx2 _mm128x2_acos_pdx2(const __m128dx2 x) {
+	// |x| > 1.0 returns NaN from the square root
+	return _mm128x2_atan2_pdx2(_mm128x2_sqrt_one_minus_square_pdx2(x), x);
+}
+
+//------------------------------------------------------------------------------
+// __m128dx2 hyperbolic functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief sinh(|x|) = (expm1(|x|) + expm1(|x|) / exp(|x|)) / 2
+ * cosh(|x|) = (exp(|x|) + 1 / exp(|x|)) / 2
+ *
+ * @details Using expm1 avoids the cancellation in exp(x) - exp(-x) when x
+ * is close to 0, so no separate Taylor series is needed.
+ */
+void _mm128x2_sinhcosh_pdx2(
+	const __m128dx2 theta, __m128dx2* const p_sinh, __m128dx2* const p_cosh
+) {
+	const __m128dx2 abs_x = _mm128x2_fabs_pdx2(theta);
+	const __m128dx2 x_expm1 = _mm128x2_expm1_pdx2(abs_x);
+	const __m128dx2 x_exp = _mm128x2_add_pdx2_pd(x_expm1, _mm_set1_pd(1.0));
+	const __m128dx2 recip_exp = _mm128x2_recip_pdx2(x_exp);
+
+	__m128dx2 ret_sinh = _mm128x2_mul_power2_pdx2_pd(
+		_mm128x2_add_pdx2(x_expm1, _mm128x2_mul_pdx2(x_expm1, recip_exp)),
+		_mm_set1_pd(0.5)
+	);
+	__m128dx2 ret_cosh = _mm128x2_mul_power2_pdx2_pd(
+		_mm128x2_add_pdx2(x_exp, recip_exp),
+		_mm_set1_pd(0.5)
+	);
+
+	// exp(|x|) overflows
+	const __m128d overflow = _mm_cmpge_pd(abs_x.hi, _mm_set1_pd(709.79));
+	ret_sinh.hi = _internal_mm_blendv_pd(ret_sinh.hi, _mm_get_infinity_pd(), overflow);
+	ret_sinh.lo = _internal_mm_blendv_pd(ret_sinh.lo, _mm_setzero_pd(), overflow);
+	ret_cosh.hi = _internal_mm_blendv_pd(ret_cosh.hi, _mm_get_infinity_pd(), overflow);
+	ret_cosh.lo = _internal_mm_blendv_pd(ret_cosh.lo, _mm_setzero_pd(), overflow);
+
+	// sinh(-x) = -sinh(x)
+	const __m128d x_sign = _mm_and_pd(theta.hi, _mm_get_sign_mask_pd());
+	ret_sinh.hi = _mm_xor_pd(ret_sinh.hi, x_sign);
+	ret_sinh.lo = _mm_xor_pd(ret_sinh.lo, x_sign);
+
+	*p_sinh = ret_sinh;
+	*p_cosh = ret_cosh;
+}
+
+__m128dx2 _mm128x2_sinh_pdx2(const __m128dx2 x) {
+	__m128dx2 ret_sinh, ret_cosh;
+	_mm128x2_sinhcosh_pdx2(x, &ret_sinh, &ret_cosh);
+	return ret_sinh;
+}
+
+__m128dx2 _mm128x2_cosh_pdx2(const __m128dx2 x) {
+	__m128dx2 ret_sinh, ret_cosh;
+	_mm128x2_sinhcosh_pdx2(x, &ret_sinh, &ret_cosh);
+	return ret_cosh;
+}
+
+/**
+ * @brief tanh(|x|) = expm1(2|x|) / (expm1(2|x|) + 2)
+ */
+__m128dx2 _mm128x2_tanh_pdx2(const __m128dx2 x) {
+	const __m128dx2 abs_x = _mm128x2_fabs_pdx2(x);
+	const __m128dx2 x_expm1 = _mm128x2_expm1_pdx2(
+		_mm128x2_mul_power2_pdx2_pd(abs_x, _mm_set1_pd(2.0))
+	);
+	__m128dx2 ret = _mm128x2_div_pdx2(
+		x_expm1, _mm128x2_add_pdx2_pd(x_expm1, _mm_set1_pd(2.0))
+	);
+
+	// 1.0 - tanh(40.0) is below 2^-106, and avoids inf / inf
+	const __m128d saturate = _mm_cmpgt_pd(abs_x.hi, _mm_set1_pd(40.0));
+	ret.hi = _internal_mm_blendv_pd(ret.hi, _mm_set1_pd(1.0), saturate);
+	ret.lo = _internal_mm_blendv_pd(ret.lo, _mm_setzero_pd(), saturate);
+
+	// tanh(-x) = -tanh(x)
+	const __m128d x_sign = _mm_and_pd(x.hi, _mm_get_sign_mask_pd());
+	ret.hi = _mm_xor_pd(ret.hi, x_sign);
+	ret.lo = _mm_xor_pd(ret.lo, x_sign);
+	return ret;
+}
@@ -9,15 +9,16 @@
 #define FLOAT64X2_SSE2_H
 
 /**
- * @brief Double-Float64 AVX Dekker Float implementation.
+ * @brief Double-Float64 SSE2 Dekker Float implementation.
  * Source: Creel "Double it Like Dekker" on YouTube.
  *
- * @note Requires AVX or later.
+ * @note Requires SSE2 or later. SSE4.1 is used when available.
  * @warning -Ofast may break this library. -O3 compiles okay on gcc and clang.
  */
 
 #include "Float64x2_def.h"
 #include "../Float64/Float64_SSE2.h"
+#include "../LDF/LDF_fma.h"
 
 #include <stdint.h>
 
@@ -53,24 +54,6 @@ typedef struct __m128dx2 {
 	__m128d lo;
 } __m128dx2;
 
-//------------------------------------------------------------------------------
-// __m128d blendv replacement
-//------------------------------------------------------------------------------
-
-#ifdef __SSE4_1__
-
-static inline __m128d _internal_mm_blendv_pd(__m128d false_case, __m128d true_case, __m128d mask) {
-	return _mm_blendv_pd(false_case, true_case, mask);
-}
-
-#else
-
-static inline __m128d _internal_mm_blendv_pd(__m128d false_case, __m128d true_case, __m128d mask) {
-	return _mm_or_pd(_mm_andnot_pd(false_case, mask), _mm_and_pd(true_case, mask));
-}
-
-#endif
-
 //------------------------------------------------------------------------------
 // __m128dx2 set1 functions
 //------------------------------------------------------------------------------
@@ -179,27 +162,16 @@ static inline __m128dx2 _mm128x2_setr_epi64x(
 // __m128dx2 load operations
 //------------------------------------------------------------------------------
 
-#if 0
-/* Unimplemented */
-
 /**
+ * @brief Loads two interleaved {hi, lo} pairs.
  * @note mem_addr must be aligned on a 16-byte boundary or a general-protection
- * exception may be generated. However, this may change to be a 32-byte boundry
- * in future implementations.
- *
- * @author This code was provided by an answer from stackoverflow:
- * https://stackoverflow.com/a/78839249
- * Which can be found under a CC BY-SA 4.0 license:
- * https://creativecommons.org/licenses/by-sa/4.0/
+ * exception may be generated.
  */
 static inline __m128dx2 _mm128x2_load_pd(const double* mem_addr) {
-	__m128d v0 = _mm_castpd128_pd256(_mm_load_pd(mem_addr));
-	__m128d v1 = _mm_castpd128_pd256(_mm_load_pd(mem_addr + 2));
-	__m128d temp;
-	temp = _mm_load_pd(mem_addr + 4);
-	v0 = _mm_insertf128_pd(v0, temp, 1);
-	temp = _mm_load_pd(mem_addr + 6);
-	v1 = _mm_insertf128_pd(v1, temp, 1);
+	// hi.0, lo.0
+	const __m128d v0 = _mm_load_pd(mem_addr);
+	// hi.1, lo.1
+	const __m128d v1 = _mm_load_pd(mem_addr + 2);
 
 	__m128dx2 val;
 	val.hi = _mm_unpacklo_pd(v0, v1);
@@ -208,19 +180,13 @@ static inline __m128dx2 _mm128x2_load_pd(const double* mem_addr) {
 }
 
 /**
- * @author This code was provided by an answer from stackoverflow:
- * https://stackoverflow.com/a/78839249
- * Which can be found under a CC BY-SA 4.0 license:
- * https://creativecommons.org/licenses/by-sa/4.0/
+ * @brief Loads two interleaved {hi, lo} pairs.
  */
 static inline __m128dx2 _mm128x2_loadu_pd(const double* mem_addr) {
-	__m128d v0 = _mm_loadu_pd(mem_addr);
-	__m128d v1 = _mm_loadu_pd(mem_addr + 2);
-	__m128d temp;
-	temp = _mm_loadu_pd(mem_addr + 4);
-	v0 = _mm_insertf128_pd(v0, temp, 1);
-	temp = _mm_loadu_pd(mem_addr + 6);
-	v1 = _mm_insertf128_pd(v1, temp, 1);
+	// hi.0, lo.0
+	const __m128d v0 = _mm_loadu_pd(mem_addr);
+	// hi.1, lo.1
+	const __m128d v1 = _mm_loadu_pd(mem_addr + 2);
 
 	__m128dx2 val;
 	val.hi = _mm_unpacklo_pd(v0, v1);
@@ -230,8 +196,7 @@ static inline __m128dx2 _mm128x2_loadu_pd(const double* mem_addr) {
 
 /**
  * @note mem_addr must be aligned on a 16-byte boundary or a general-protection
- * exception may be generated. However, this may change to be a 32-byte boundry
- * in future implementations.
+ * exception may be generated.
  */
 static inline __m128dx2 _mm128x2_load_pdx2(const Float64x2* mem_addr) {
 	return _mm128x2_load_pd((const double*)((const void*)mem_addr));
@@ -241,8 +206,6 @@ static inline __m128dx2 _mm128x2_loadu_pdx2(const Float64x2* mem_addr) {
 	return _mm128x2_loadu_pd((const double*)((const void*)mem_addr));
 }
 
-#endif
-
 /**
  * @note mem_addr must be aligned on a 32-byte boundary or a general-protection
  * exception may be generated.
@@ -267,54 +230,30 @@ static inline __m128dx2 _mm128x2_loadu_raw_pd(const double* mem_addr) {
 // __m128dx2 store operations
 //------------------------------------------------------------------------------
 
-#if 0
-/* Unimplemented */
-
 /**
- * @note mem_addr must be aligned on a 32-byte boundary or a general-protection
+ * @brief Stores two interleaved {hi, lo} pairs.
+ * @note mem_addr must be aligned on a 16-byte boundary or a general-protection
  * exception may be generated.
- *
- * @author This code was provided by an answer from stackoverflow:
- * https://stackoverflow.com/a/78839249
- * Which can be found under a CC BY-SA 4.0 license:
- * https://creativecommons.org/licenses/by-sa/4.0/
  */
 static inline void _mm128x2_store_pd(double* mem_addr, __m128dx2 val) {
-	// hi.x, lo.x, hi.z, lo.z
-	__m128d v0 = _mm_unpacklo_pd(val.hi, val.lo);
-	// hi.y, lo.y, hi.w, lo.w
-	__m128d v1 = _mm_unpackhi_pd(val.hi, val.lo);
-	__m128d tmp;
-	// hi.z, lo.z, hi.w, lo.w
-	tmp = _mm_permute2f128_pd(v0, v1, 0x31);
-	_mm_store_pd(mem_addr + 4, tmp);
-	// hi.x, lo.x, hi.y, lo.y
-	tmp = _mm_insertf128_pd(v0, _mm_castpd256_pd128(v1), 1);
-	_mm_store_pd(mem_addr, tmp);
+	// hi.0, lo.0
+	_mm_store_pd(mem_addr    , _mm_unpacklo_pd(val.hi, val.lo));
+	// hi.1, lo.1
+	_mm_store_pd(mem_addr + 2, _mm_unpackhi_pd(val.hi, val.lo));
 }
 
 /**
- * @author This code was provided by an answer from stackoverflow:
- * https://stackoverflow.com/a/78839249
- * Which can be found under a CC BY-SA 4.0 license:
- * https://creativecommons.org/licenses/by-sa/4.0/
+ * @brief Stores two interleaved {hi, lo} pairs.
  */
 static inline void _mm128x2_storeu_pd(double* mem_addr, __m128dx2 val) {
-	// hi.x, lo.x, hi.z, lo.z
-	__m128d v0 = _mm_unpacklo_pd(val.hi, val.lo);
-	// hi.y, lo.y, hi.w, lo.w
-	__m128d v1 = _mm_unpackhi_pd(val.hi, val.lo);
-	__m128d temp;
-	// hi.z, lo.z, hi.w, lo.w
-	temp = _mm_permute2f128_pd(v0, v1, 0x31);
-	_mm_storeu_pd(mem_addr + 4, temp);
-	// hi.x, lo.x, hi.y, lo.y
-	temp = _mm_insertf128_pd(v0, _mm_castpd256_pd128(v1), 1);
-	_mm_storeu_pd(mem_addr, temp);
+	// hi.0, lo.0
+	_mm_storeu_pd(mem_addr    , _mm_unpacklo_pd(val.hi, val.lo));
+	// hi.1, lo.1
+	_mm_storeu_pd(mem_addr + 2, _mm_unpackhi_pd(val.hi, val.lo));
 }
 
 /**
- * @note mem_addr must be aligned on a 32-byte boundary or a general-protection
+ * @note mem_addr must be aligned on a 16-byte boundary or a general-protection
  * exception may be generated.
  */
 static inline void _mm128x2_store_pdx2(Float64x2* mem_addr, __m128dx2 val) {
@@ -325,8 +264,6 @@ static inline void _mm128x2_storeu_pdx2(Float64x2* mem_addr, __m128dx2 val) {
 	_mm128x2_storeu_pd((double*)((void*)mem_addr), val);
 }
 
-#endif
-
 /**
  * @note mem_addr must be aligned on a 32-byte boundary or a general-protection
  * exception may be generated.
@@ -1084,19 +1021,24 @@ static inline __m128dx2 _mm128x2_dekker_split_pd(__m128d x) {
 // }
 
 static inline __m128dx2 _mm128x2_dekker_mul12_pd(__m128d x, __m128d y) {
-	__m128dx2 a = _mm128x2_dekker_split_pd(x);
-	__m128dx2 b = _mm128x2_dekker_split_pd(y);
-	__m128d p = _mm_mul_pd(a.hi, b.hi);
-	__m128d q = _mm_add_pd(
-		_mm_mul_pd(a.hi, b.lo), _mm_mul_pd(a.lo, b.hi)
-	);
-
 	__m128dx2 r;
-	r.hi = _mm_add_pd(p, q);
-	r.lo = _mm_add_pd(
-		_mm_add_pd(_mm_sub_pd(p, r.hi), q),
-		_mm_mul_pd(a.lo, b.lo)
-	);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		r.hi = _mm_mul_pd(x, y);
+		r.lo = _mm_fmsub_pd(x, y, r.hi);
+	#else
+		__m128dx2 a = _mm128x2_dekker_split_pd(x);
+		__m128dx2 b = _mm128x2_dekker_split_pd(y);
+		__m128d p = _mm_mul_pd(a.hi, b.hi);
+		__m128d q = _mm_add_pd(
+			_mm_mul_pd(a.hi, b.lo), _mm_mul_pd(a.lo, b.hi)
+		);
+
+		r.hi = _mm_add_pd(p, q);
+		r.lo = _mm_add_pd(
+			_mm_add_pd(_mm_sub_pd(p, r.hi), q),
+			_mm_mul_pd(a.lo, b.lo)
+		);
+	#endif
 	return r;
 }
 
@@ -1127,18 +1069,23 @@ static inline __m128dx2 _mm128x2_div_pdx2(__m128dx2 x, __m128dx2 y) {
 }
 
 static inline __m128dx2 _mm128x2_dekker_square12_pd(__m128d x) {
-	__m128dx2 a = _mm128x2_dekker_split_pd(x);
-	__m128d p = _mm_mul_pd(a.hi, a.hi);
-	__m128d q = _mm_mul_pd(
-		_mm_set1_pd(2.0), _mm_mul_pd(a.hi, a.lo)
-	);
-
 	__m128dx2 r;
-	r.hi = _mm_add_pd(p, q);
-	r.lo = _mm_add_pd(
-		_mm_add_pd(_mm_sub_pd(p, r.hi), q),
-		_mm_mul_pd(a.lo, a.lo)
-	);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		r.hi = _mm_mul_pd(x, x);
+		r.lo = _mm_fmsub_pd(x, x, r.hi);
+	#else
+		__m128dx2 a = _mm128x2_dekker_split_pd(x);
+		__m128d p = _mm_mul_pd(a.hi, a.hi);
+		__m128d q = _mm_mul_pd(
+			_mm_set1_pd(2.0), _mm_mul_pd(a.hi, a.lo)
+		);
+
+		r.hi = _mm_add_pd(p, q);
+		r.lo = _mm_add_pd(
+			_mm_add_pd(_mm_sub_pd(p, r.hi), q),
+			_mm_mul_pd(a.lo, a.lo)
+		);
+	#endif
 	return r;
 }
 
@@ -1660,17 +1607,14 @@ static inline __m128dx2 _mm128x2_const_phi_pdx2(void) {
 static inline __m128dx2 _mm128x2_fmax_pdx2(__m128dx2 x, __m128dx2 y) {
 	__m128d fmax_cmp =
 		_mm_or_pd(
-			_mm_andnot_pd(
-				_mm_or_pd(
-					_mm_andnot_pd(
-						_mm_signbit_pdx2(x),
-						_mm_isnan_pdx2(y)
-					),
-					_mm_isnan_pdx2(x)
-				),
-				_mm_cmplt_pdx2(y, x)
+			_mm_or_pd(
+				_mm_cmplt_pdx2(x, y),
+				_mm_isnan_pdx2(x)
 			),
-			_mm_cmplt_pdx2(x, y)
+			_mm_and_pd(
+				_mm_signbit_pdx2(x),
+				_mm_cmpeq_pdx2(x, y)
+			)
 		);
 	__m128dx2 ret;
 	ret.hi = _internal_mm_blendv_pd(x.hi, y.hi, fmax_cmp);
@@ -1685,17 +1629,14 @@ static inline __m128dx2 _mm128x2_fmax_pdx2(__m128dx2 x, __m128dx2 y) {
 static inline __m128dx2 _mm128x2_fmin_pdx2(__m128dx2 x, __m128dx2 y) {
 	__m128d fmin_cmp =
 		_mm_or_pd(
-			_mm_andnot_pd(
-				_mm_or_pd(
-					_mm_andnot_pd(
-						_mm_signbit_pdx2(x),
-						_mm_isnan_pdx2(y)
-					),
-					_mm_isnan_pdx2(x)
-				),
-				_mm_cmpgt_pdx2(y, x)
+			_mm_or_pd(
+				_mm_cmpgt_pdx2(x, y),
+				_mm_isnan_pdx2(x)
 			),
-			_mm_cmpgt_pdx2(x, y)
+			_mm_andnot_pd(
+				_mm_signbit_pdx2(x),
+				_mm_cmpeq_pdx2(x, y)
+			)
 		);
 	__m128dx2 ret;
 	ret.hi = _internal_mm_blendv_pd(x.hi, y.hi, fmin_cmp);
@@ -1723,8 +1664,6 @@ static inline __m128dx2 _mm128x2_min_pdx2(__m128dx2 x, __m128dx2 y) {
 // __m128dx2 rounding functions
 //------------------------------------------------------------------------------
 
-#ifdef __SSE4_1__
-
 /** same as aint(x) */
 static inline __m128dx2 _mm128x2_trunc_pdx2(__m128dx2 x) {
 	__m128d int_hi = _mm_trunc_pd(x.hi);
@@ -1779,8 +1718,6 @@ static inline __m128dx2 _mm128x2_round_pdx2(__m128dx2 x) {
 	return ret;
 }
 
-#endif
-
 //------------------------------------------------------------------------------
 // __m128dx2 math.h functions
 //------------------------------------------------------------------------------
@@ -1864,8 +1801,6 @@ static inline __m128dx2 _mm128x2_cbrt_pdx2(__m128dx2 x) {
 
 #endif
 
-#ifdef __SSE4_1__
-
 /**
  * @brief returns the fractional part of a __m128dx2 value.
  * @note int_part cannot not be NULL
@@ -1881,14 +1816,10 @@ static inline __m128dx2 _mm128x2_fmod_pdx2(__m128dx2 x, __m128dx2 y) {
 	return _mm128x2_sub_pdx2(x, _mm128x2_mul_pdx2(y, trunc_part));
 }
 
-#endif
-
 //------------------------------------------------------------------------------
 // __m128dx2 ilogb
 //------------------------------------------------------------------------------
 
-#if defined(__SSE4_1__) && defined(__SSE4_2__)
-
 /**
  * @brief Computes ilogb(x) on a __m128dx2 value
  * @returns __m128i int64_t
@@ -1897,7 +1828,13 @@ static inline __m128i _mm128x2_ilogb_pdx2_epi64(__m128dx2 x) {
 	return _mm_ilogb_pd_epi64(x.hi);
 }
 
-#endif
+/**
+ * @brief Computes ilogb(x) on a __m128dx2 value
+ * @returns int32_t in the lower two elements of a __m128i
+ */
+static inline __m128i _mm128x2_ilogb_pdx2_epi32(__m128dx2 x) {
+	return _mm_ilogb_pd_epi32(x.hi);
+}
 
 //------------------------------------------------------------------------------
 // __m128dx2 ldexp
@@ -1916,6 +1853,16 @@ static inline __m128dx2 _mm128x2_ldexp_pdx2_epi64(__m128dx2 x, __m128i expon) {
 
 #endif
 
+/**
+ * @brief Computes ldexp(x, expon)
+ * @note expon is read from the lower two int32_t elements of the __m128i
+ */
+static inline __m128dx2 _mm128x2_ldexp_pdx2_epi32(__m128dx2 x, __m128i expon) {
+	x.hi = _mm_ldexp_pd_epi32(x.hi, expon);
+	x.lo = _mm_ldexp_pd_epi32(x.lo, expon);
+	return x;
+}
+
 //------------------------------------------------------------------------------
 // __m128dx2 frexp
 //------------------------------------------------------------------------------
@@ -1928,12 +1875,148 @@ static inline __m128dx2 _mm128x2_ldexp_pdx2_epi64(__m128dx2 x, __m128i expon) {
  */
 static inline __m128dx2 _mm128x2_frexp_pdx2_epi64(__m128dx2 x, __m128i* const expon) {
 	x.hi = _mm_frexp_pd_epi64(x.hi, expon);
-	x.lo = _mm_ldexp_pd_epi64(x.lo, _mm_sub_epi64(_mm_set1_epi64x((int64_t)1), *expon));
+	x.lo = _mm_ldexp_pd_epi64(x.lo, _mm_sub_epi64(_mm_setzero_si128(), *expon));
 	return x;
 }
 
 #endif
 
+/**
+ * @brief Computes frexp(x, expon) on a __m128dx2 value
+ * @note expon is stored in the lower two int32_t elements of the __m128i
+ */
+static inline __m128dx2 _mm128x2_frexp_pdx2_epi32(__m128dx2 x, __m128i* const expon) {
+	x.hi = _mm_frexp_pd_epi32(x.hi, expon);
+	x.lo = _mm_ldexp_pd_epi32(x.lo, _mm_sub_epi32(_mm_setzero_si128(), *expon));
+	return x;
+}
+
+//------------------------------------------------------------------------------
+// __m128dx2 exponents and logarithms
+//------------------------------------------------------------------------------
+
+__m128dx2 _mm128x2_exp_pdx2(__m128dx2 x);
+
+__m128dx2 _mm128x2_expm1_pdx2(__m128dx2 x);
+
+static inline __m128dx2 _mm128x2_exp2_pdx2(const __m128dx2 x) {
+	return _mm128x2_exp_pdx2(_mm128x2_mul_pdx2(x, _mm128x2_const_ln2_pdx2()));
+}
+
+static inline __m128dx2 _mm128x2_exp10_pdx2(const __m128dx2 x) {
+	return _mm128x2_exp_pdx2(_mm128x2_mul_pdx2(x, _mm128x2_const_ln10_pdx2()));
+}
+
+/** @note The initial guess is calculated with log from math.h */
+__m128dx2 _mm128x2_log_pdx2(__m128dx2 x);
+
+__m128dx2 _mm128x2_log1p_pdx2(__m128dx2 x);
+
+static inline __m128dx2 _mm128x2_log2_pdx2(const __m128dx2 x) {
+	return _mm128x2_mul_pdx2(_mm128x2_log_pdx2(x), _mm128x2_const_log2e_pdx2());
+}
+
+static inline __m128dx2 _mm128x2_log10_pdx2(const __m128dx2 x) {
+	return _mm128x2_mul_pdx2(_mm128x2_log_pdx2(x), _mm128x2_const_log10e_pdx2());
+}
+
+/** @note This function doesn't use SSE2 for calculations */
+__m128dx2 _mm128x2_pow_pdx2(__m128dx2 x, __m128dx2 y);
+
+/** @note This function doesn't use SSE2 for calculations */
+__m128dx2 _mm128x2_pow_pdx2_pd(__m128dx2 x, __m128d y);
+
+//------------------------------------------------------------------------------
+// __m128dx2 trigonometry
+//------------------------------------------------------------------------------
+
+__m128dx2 _mm128x2_sin_pdx2(__m128dx2 x);
+
+__m128dx2 _mm128x2_cos_pdx2(__m128dx2 x);
+
+/**
+ * @warning p_sin and p_cos must be aligned on a 16-byte boundary or a
+ * general-protection exception may be generated.
+ */
+void _mm128x2_sincos_pdx2(
+	__m128dx2 theta, __m128dx2* p_sin, __m128dx2* p_cos
+);
+
+static inline __m128dx2 _mm128x2_tan_pdx2(__m128dx2 x) {
+	__m128dx2 t_sin, t_cos;
+	_mm128x2_sincos_pdx2(x, &t_sin, &t_cos);
+	return _mm128x2_div_pdx2(t_sin, t_cos);
+}
+
+__m128dx2 _mm128x2_asin_pdx2(__m128dx2 x);
+
+__m128dx2 _mm128x2_acos_pdx2(__m128dx2 x);
+
+__m128dx2 _mm128x2_atan_pdx2(__m128dx2 x);
+
+__m128dx2 _mm128x2_atan2_pdx2(__m128dx2 y, __m128dx2 x);
+
+__m128dx2 _mm128x2_sinh_pdx2(__m128dx2 x);
+
+__m128dx2 _mm128x2_cosh_pdx2(__m128dx2 x);
+
+__m128dx2 _mm128x2_tanh_pdx2(__m128dx2 x);
+
+/**
+ * @warning p_sinh and p_cosh must be aligned on a 16-byte boundary or a
+ * general-protection exception may be generated.
+ */
+void _mm128x2_sinhcosh_pdx2(
+	__m128dx2 theta, __m128dx2* p_sinh, __m128dx2* p_cosh
+);
+
+/**
+ * @brief asinh(|x|) = log1p(|x| + x^2 / (1 + sqrt(x^2 + 1)))
+ * @note log1p(2|x|) is used when x^2 would overflow
+ */
+static inline __m128dx2 _mm128x2_asinh_pdx2(__m128dx2 x) {
+	const __m128dx2 abs_x = _mm128x2_fabs_pdx2(x);
+	const __m128dx2 x_squared = _mm128x2_square_pdx2(x);
+	__m128dx2 arg = _mm128x2_add_pdx2(abs_x,
+		_mm128x2_div_pdx2(x_squared, _mm128x2_add_pd_pdx2(_mm_set1_pd(1.0),
+			_mm128x2_sqrt_pdx2(_mm128x2_add_pdx2_pd(x_squared, _mm_set1_pd(1.0)))
+		))
+	);
+	const __m128d x_huge = _mm_cmpgt_pd(abs_x.hi, _mm_set1_pd(0x1.0p+500));
+	const __m128dx2 arg_huge = _mm128x2_mul_power2_pdx2_pd(abs_x, _mm_set1_pd(2.0));
+	arg.hi = _internal_mm_blendv_pd(arg.hi, arg_huge.hi, x_huge);
+	arg.lo = _internal_mm_blendv_pd(arg.lo, arg_huge.lo, x_huge);
+	return _mm128x2_copysign_pdx2(_mm128x2_log1p_pdx2(arg), x);
+}
+
+/**
+ * @brief acosh(x) = log1p((x - 1) + sqrt((x - 1) * (x + 1)))
+ * @note log1p(2x) is used when x^2 would overflow
+ */
+static inline __m128dx2 _mm128x2_acosh_pdx2(__m128dx2 x) {
+	const __m128dx2 x_m1 = _mm128x2_sub_pdx2_pd(x, _mm_set1_pd(1.0));
+	__m128dx2 arg = _mm128x2_add_pdx2(x_m1,
+		_mm128x2_sqrt_pdx2(_mm128x2_mul_pdx2(
+			x_m1, _mm128x2_add_pdx2_pd(x, _mm_set1_pd(1.0))
+		))
+	);
+	const __m128d x_huge = _mm_cmpgt_pd(x.hi, _mm_set1_pd(0x1.0p+500));
+	const __m128dx2 arg_huge = _mm128x2_mul_power2_pdx2_pd(x, _mm_set1_pd(2.0));
+	arg.hi = _internal_mm_blendv_pd(arg.hi, arg_huge.hi, x_huge);
+	arg.lo = _internal_mm_blendv_pd(arg.lo, arg_huge.lo, x_huge);
+	return _mm128x2_log1p_pdx2(arg);
+}
+
+/**
+ * @brief atanh(x) = log1p(2x / (1 - x)) / 2
+ */
+static inline __m128dx2 _mm128x2_atanh_pdx2(__m128dx2 x) {
+	return _mm128x2_mul_power2_pdx2_pd(_mm128x2_log1p_pdx2(_mm128x2_div_pdx2(
+			_mm128x2_mul_power2_pdx2_pd(x, _mm_set1_pd(2.0)),
+			_mm128x2_sub_pd_pdx2(_mm_set1_pd(1.0), x)
+	)), _mm_set1_pd(0.5));
+}
+
 #ifdef __cplusplus
 }
 #endif
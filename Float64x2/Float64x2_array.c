@@ -0,0 +1,144 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "Float64x2_array.h"
+#include "Float64x2_array_kernels.h"
+#include "Float64x2.h"
+
+//------------------------------------------------------------------------------
+// Float64x2 dispatch
+//------------------------------------------------------------------------------
+
+/** Indexed by LDF_cpu_level. NULL for the scalar level and disabled levels. */
+static const Float64x2_array_kernels* const
+Float64x2_array_levels[LDF_CPU_LEVEL_COUNT] = {
+	NULL,
+	#ifdef LDF_ENABLE_DISPATCH_SSE2
+		&Float64x2_array_kernels_SSE2,
+	#else
+		NULL,
+	#endif
+	#ifdef LDF_ENABLE_DISPATCH_AVX
+		&Float64x2_array_kernels_AVX,
+	#else
+		NULL,
+	#endif
+	#ifdef LDF_ENABLE_DISPATCH_AVX2_FMA
+		&Float64x2_array_kernels_AVX2_FMA,
+	#else
+		NULL,
+	#endif
+	#ifdef LDF_ENABLE_DISPATCH_AVX512
+		&Float64x2_array_kernels_AVX512,
+	#else
+		NULL,
+	#endif
+};
+
+/**
+ * @brief Calls the kernel from the highest supported level that implements
+ * it, and returns. Otherwise the caller falls through to its scalar loop.
+ */
+#define FLOAT64X2_ARRAY_DISPATCH(kernel, ...) \
+	for (int level = (int)LDF_cpu_get_level(); level > 0; level--) { \
+		const Float64x2_array_kernels* table = Float64x2_array_levels[level]; \
+		if (table != NULL && table->kernel != NULL) { \
+			table->kernel(__VA_ARGS__); \
+			return; \
+		} \
+	}
+
+#define FLOAT64X2_ARRAY_UNARY(name, func) \
+void Float64x2_##name##_array(const Float64x2* in, Float64x2* out, size_t n) { \
+	FLOAT64X2_ARRAY_DISPATCH(name##_array, in, out, n) \
+	for (size_t i = 0; i < n; i++) { \
+		out[i] = func(in[i]); \
+	} \
+}
+
+#define FLOAT64X2_ARRAY_BINARY(name, func) \
+void Float64x2_##name##_array( \
+	const Float64x2* x, const Float64x2* y, Float64x2* out, size_t n \
+) { \
+	FLOAT64X2_ARRAY_DISPATCH(name##_array, x, y, out, n) \
+	for (size_t i = 0; i < n; i++) { \
+		out[i] = func(x[i], y[i]); \
+	} \
+}
+
+#define FLOAT64X2_ARRAY_SCALAR_UNARY(name, func) \
+void Float64x2_##name##_array(const Float64x2* in, Float64x2* out, size_t n) { \
+	for (size_t i = 0; i < n; i++) { \
+		out[i] = func(in[i]); \
+	} \
+}
+
+#define FLOAT64X2_ARRAY_SCALAR_BINARY(name, func) \
+void Float64x2_##name##_array( \
+	const Float64x2* x, const Float64x2* y, Float64x2* out, size_t n \
+) { \
+	for (size_t i = 0; i < n; i++) { \
+		out[i] = func(x[i], y[i]); \
+	} \
+}
+
+//------------------------------------------------------------------------------
+// Float64x2 array functions
+//------------------------------------------------------------------------------
+
+FLOAT64X2_ARRAY_BINARY(add, Float64x2_add)
+FLOAT64X2_ARRAY_BINARY(sub, Float64x2_sub)
+FLOAT64X2_ARRAY_BINARY(mul, Float64x2_mul)
+FLOAT64X2_ARRAY_BINARY(div, Float64x2_div)
+FLOAT64X2_ARRAY_BINARY(copysign, Float64x2_copysign)
+FLOAT64X2_ARRAY_BINARY(fdim, Float64x2_fdim)
+FLOAT64X2_ARRAY_BINARY(fmax, Float64x2_fmax)
+FLOAT64X2_ARRAY_BINARY(fmin, Float64x2_fmin)
+FLOAT64X2_ARRAY_BINARY(fmod, Float64x2_fmod)
+FLOAT64X2_ARRAY_SCALAR_BINARY(remainder, Float64x2_remainder)
+FLOAT64X2_ARRAY_BINARY(pow, Float64x2_pow)
+FLOAT64X2_ARRAY_BINARY(atan2, Float64x2_atan2)
+FLOAT64X2_ARRAY_UNARY(fabs, Float64x2_fabs)
+FLOAT64X2_ARRAY_UNARY(sqrt, Float64x2_sqrt)
+FLOAT64X2_ARRAY_UNARY(cbrt, Float64x2_cbrt)
+FLOAT64X2_ARRAY_UNARY(exp, Float64x2_exp)
+FLOAT64X2_ARRAY_UNARY(exp2, Float64x2_exp2)
+FLOAT64X2_ARRAY_UNARY(exp10, Float64x2_exp10)
+FLOAT64X2_ARRAY_UNARY(expm1, Float64x2_expm1)
+FLOAT64X2_ARRAY_UNARY(log, Float64x2_log)
+FLOAT64X2_ARRAY_UNARY(log2, Float64x2_log2)
+FLOAT64X2_ARRAY_UNARY(log10, Float64x2_log10)
+FLOAT64X2_ARRAY_UNARY(log1p, Float64x2_log1p)
+FLOAT64X2_ARRAY_UNARY(sin, Float64x2_sin)
+FLOAT64X2_ARRAY_UNARY(cos, Float64x2_cos)
+FLOAT64X2_ARRAY_UNARY(tan, Float64x2_tan)
+FLOAT64X2_ARRAY_UNARY(asin, Float64x2_asin)
+FLOAT64X2_ARRAY_UNARY(acos, Float64x2_acos)
+FLOAT64X2_ARRAY_UNARY(atan, Float64x2_atan)
+FLOAT64X2_ARRAY_UNARY(sinh, Float64x2_sinh)
+FLOAT64X2_ARRAY_UNARY(cosh, Float64x2_cosh)
+FLOAT64X2_ARRAY_UNARY(tanh, Float64x2_tanh)
+FLOAT64X2_ARRAY_UNARY(asinh, Float64x2_asinh)
+FLOAT64X2_ARRAY_UNARY(acosh, Float64x2_acosh)
+FLOAT64X2_ARRAY_UNARY(atanh, Float64x2_atanh)
+FLOAT64X2_ARRAY_SCALAR_UNARY(erf, Float64x2_erf)
+FLOAT64X2_ARRAY_SCALAR_UNARY(erfc, Float64x2_erfc)
+FLOAT64X2_ARRAY_SCALAR_UNARY(tgamma, Float64x2_tgamma)
+FLOAT64X2_ARRAY_SCALAR_UNARY(lgamma, Float64x2_lgamma)
+FLOAT64X2_ARRAY_UNARY(floor, Float64x2_floor)
+FLOAT64X2_ARRAY_UNARY(ceil, Float64x2_ceil)
+FLOAT64X2_ARRAY_UNARY(trunc, Float64x2_trunc)
+FLOAT64X2_ARRAY_SCALAR_UNARY(round, Float64x2_round)
+FLOAT64X2_ARRAY_SCALAR_UNARY(rint, Float64x2_rint)
+FLOAT64X2_ARRAY_SCALAR_UNARY(nearbyint, Float64x2_nearbyint)
+
+#undef FLOAT64X2_ARRAY_DISPATCH
+#undef FLOAT64X2_ARRAY_UNARY
+#undef FLOAT64X2_ARRAY_BINARY
+#undef FLOAT64X2_ARRAY_SCALAR_UNARY
+#undef FLOAT64X2_ARRAY_SCALAR_BINARY
@@ -0,0 +1,168 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "../LDF/LDF_cpu_dispatch.h"
+
+/**
+ * @brief AVX kernels for Float64x2_array.h. Also compiled as the AVX2+FMA
+ * kernels by Float64x2_array_AVX2.c, which defines
+ * FLOAT64X2_ARRAY_AVX_KERNELS before including this file.
+ */
+
+#ifndef FLOAT64X2_ARRAY_AVX_KERNELS
+	#ifdef LDF_ENABLE_DISPATCH_AVX
+		#define FLOAT64X2_ARRAY_AVX_KERNELS Float64x2_array_kernels_AVX
+		#if defined(__GNUC__) && !defined(__clang__) && !defined(__AVX__)
+			#pragma GCC target("avx")
+		#endif
+	#endif
+#endif
+
+#ifdef FLOAT64X2_ARRAY_AVX_KERNELS
+
+#include "Float64x2_array_kernels.h"
+#include "Float64x2_AVX.h"
+
+#include <immintrin.h>
+
+//------------------------------------------------------------------------------
+// __m256dx2 array kernels
+//------------------------------------------------------------------------------
+
+/**
+ * @brief The tail is padded to a full __m256dx2 with copies of the last
+ * element, so that it is computed the same way as the rest of the array.
+ */
+#define FLOAT64X2_ARRAY_AVX_UNARY(name, func) \
+static void name(const Float64x2* in, Float64x2* out, size_t n) { \
+	size_t i = 0; \
+	for (; i + 4 <= n; i += 4) { \
+		_mm256x2_storeu_pdx2(&out[i], func(_mm256x2_loadu_pdx2(&in[i]))); \
+	} \
+	if (i < n) { \
+		const size_t rem = n - i; \
+		Float64x2 buf[4]; \
+		for (size_t j = 0; j < 4; j++) { \
+			buf[j] = in[i + ((j < rem) ? j : rem - 1)]; \
+		} \
+		_mm256x2_storeu_pdx2(buf, func(_mm256x2_loadu_pdx2(buf))); \
+		for (size_t j = 0; j < rem; j++) { \
+			out[i + j] = buf[j]; \
+		} \
+	} \
+}
+
+#define FLOAT64X2_ARRAY_AVX_BINARY(name, func) \
+static void name( \
+	const Float64x2* x, const Float64x2* y, Float64x2* out, size_t n \
+) { \
+	size_t i = 0; \
+	for (; i + 4 <= n; i += 4) { \
+		_mm256x2_storeu_pdx2(&out[i], func( \
+			_mm256x2_loadu_pdx2(&x[i]), _mm256x2_loadu_pdx2(&y[i]) \
+		)); \
+	} \
+	if (i < n) { \
+		const size_t rem = n - i; \
+		Float64x2 buf_x[4]; \
+		Float64x2 buf_y[4]; \
+		for (size_t j = 0; j < 4; j++) { \
+			buf_x[j] = x[i + ((j < rem) ? j : rem - 1)]; \
+			buf_y[j] = y[i + ((j < rem) ? j : rem - 1)]; \
+		} \
+		_mm256x2_storeu_pdx2(buf_x, func( \
+			_mm256x2_loadu_pdx2(buf_x), _mm256x2_loadu_pdx2(buf_y) \
+		)); \
+		for (size_t j = 0; j < rem; j++) { \
+			out[i + j] = buf_x[j]; \
+		} \
+	} \
+}
+
+FLOAT64X2_ARRAY_AVX_BINARY(Float64x2_add_array_AVX, _mm256x2_add_pdx2)
+FLOAT64X2_ARRAY_AVX_BINARY(Float64x2_sub_array_AVX, _mm256x2_sub_pdx2)
+FLOAT64X2_ARRAY_AVX_BINARY(Float64x2_mul_array_AVX, _mm256x2_mul_pdx2)
+FLOAT64X2_ARRAY_AVX_BINARY(Float64x2_div_array_AVX, _mm256x2_div_pdx2)
+FLOAT64X2_ARRAY_AVX_BINARY(Float64x2_copysign_array_AVX, _mm256x2_copysign_pdx2)
+FLOAT64X2_ARRAY_AVX_BINARY(Float64x2_fdim_array_AVX, _mm256x2_fdim_pdx2)
+FLOAT64X2_ARRAY_AVX_BINARY(Float64x2_fmax_array_AVX, _mm256x2_fmax_pdx2)
+FLOAT64X2_ARRAY_AVX_BINARY(Float64x2_fmin_array_AVX, _mm256x2_fmin_pdx2)
+FLOAT64X2_ARRAY_AVX_BINARY(Float64x2_fmod_array_AVX, _mm256x2_fmod_pdx2)
+FLOAT64X2_ARRAY_AVX_BINARY(Float64x2_pow_array_AVX, _mm256x2_pow_pdx2)
+FLOAT64X2_ARRAY_AVX_BINARY(Float64x2_atan2_array_AVX, _mm256x2_atan2_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_fabs_array_AVX, _mm256x2_fabs_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_sqrt_array_AVX, _mm256x2_sqrt_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_cbrt_array_AVX, _mm256x2_cbrt_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_exp_array_AVX, _mm256x2_exp_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_exp2_array_AVX, _mm256x2_exp2_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_exp10_array_AVX, _mm256x2_exp10_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_expm1_array_AVX, _mm256x2_expm1_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_log_array_AVX, _mm256x2_log_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_log2_array_AVX, _mm256x2_log2_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_log10_array_AVX, _mm256x2_log10_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_log1p_array_AVX, _mm256x2_log1p_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_sin_array_AVX, _mm256x2_sin_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_cos_array_AVX, _mm256x2_cos_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_tan_array_AVX, _mm256x2_tan_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_asin_array_AVX, _mm256x2_asin_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_acos_array_AVX, _mm256x2_acos_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_atan_array_AVX, _mm256x2_atan_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_sinh_array_AVX, _mm256x2_sinh_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_cosh_array_AVX, _mm256x2_cosh_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_tanh_array_AVX, _mm256x2_tanh_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_asinh_array_AVX, _mm256x2_asinh_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_acosh_array_AVX, _mm256x2_acosh_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_atanh_array_AVX, _mm256x2_atanh_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_floor_array_AVX, _mm256x2_floor_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_ceil_array_AVX, _mm256x2_ceil_pdx2)
+FLOAT64X2_ARRAY_AVX_UNARY(Float64x2_trunc_array_AVX, _mm256x2_trunc_pdx2)
+
+#undef FLOAT64X2_ARRAY_AVX_UNARY
+#undef FLOAT64X2_ARRAY_AVX_BINARY
+
+const Float64x2_array_kernels FLOAT64X2_ARRAY_AVX_KERNELS = {
+	.add_array      = Float64x2_add_array_AVX,
+	.sub_array      = Float64x2_sub_array_AVX,
+	.mul_array      = Float64x2_mul_array_AVX,
+	.div_array      = Float64x2_div_array_AVX,
+	.copysign_array = Float64x2_copysign_array_AVX,
+	.fdim_array     = Float64x2_fdim_array_AVX,
+	.fmax_array     = Float64x2_fmax_array_AVX,
+	.fmin_array     = Float64x2_fmin_array_AVX,
+	.fmod_array     = Float64x2_fmod_array_AVX,
+	.pow_array      = Float64x2_pow_array_AVX,
+	.atan2_array    = Float64x2_atan2_array_AVX,
+	.fabs_array     = Float64x2_fabs_array_AVX,
+	.sqrt_array     = Float64x2_sqrt_array_AVX,
+	.cbrt_array     = Float64x2_cbrt_array_AVX,
+	.exp_array      = Float64x2_exp_array_AVX,
+	.exp2_array     = Float64x2_exp2_array_AVX,
+	.exp10_array    = Float64x2_exp10_array_AVX,
+	.expm1_array    = Float64x2_expm1_array_AVX,
+	.log_array      = Float64x2_log_array_AVX,
+	.log2_array     = Float64x2_log2_array_AVX,
+	.log10_array    = Float64x2_log10_array_AVX,
+	.log1p_array    = Float64x2_log1p_array_AVX,
+	.sin_array      = Float64x2_sin_array_AVX,
+	.cos_array      = Float64x2_cos_array_AVX,
+	.tan_array      = Float64x2_tan_array_AVX,
+	.asin_array     = Float64x2_asin_array_AVX,
+	.acos_array     = Float64x2_acos_array_AVX,
+	.atan_array     = Float64x2_atan_array_AVX,
+	.sinh_array     = Float64x2_sinh_array_AVX,
+	.cosh_array     = Float64x2_cosh_array_AVX,
+	.tanh_array     = Float64x2_tanh_array_AVX,
+	.asinh_array    = Float64x2_asinh_array_AVX,
+	.acosh_array    = Float64x2_acosh_array_AVX,
+	.atanh_array    = Float64x2_atanh_array_AVX,
+	.floor_array    = Float64x2_floor_array_AVX,
+	.ceil_array     = Float64x2_ceil_array_AVX,
+	.trunc_array    = Float64x2_trunc_array_AVX,
+};
+
+#endif
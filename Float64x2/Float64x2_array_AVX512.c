@@ -0,0 +1,116 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "../LDF/LDF_cpu_dispatch.h"
+
+/**
+ * @brief AVX512 kernels for Float64x2_array.h. Only AVX512F is required.
+ * The math.h functions fall back to the AVX2+FMA kernels.
+ */
+
+#ifdef LDF_ENABLE_DISPATCH_AVX512
+
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__AVX512F__)
+	#pragma GCC target("avx512f,avx2,fma")
+#endif
+
+#include "Float64x2_array_kernels.h"
+#include "Float64x2_AVX512.h"
+
+#include <immintrin.h>
+
+//------------------------------------------------------------------------------
+// __m512dx2 array kernels
+//------------------------------------------------------------------------------
+
+/**
+ * @brief The tail is padded to a full __m512dx2 with copies of the last
+ * element, so that it is computed the same way as the rest of the array.
+ */
+#define FLOAT64X2_ARRAY_AVX512_UNARY(name, func) \
+static void name(const Float64x2* in, Float64x2* out, size_t n) { \
+	size_t i = 0; \
+	for (; i + 8 <= n; i += 8) { \
+		_mm512x2_storeu_pdx2(&out[i], func(_mm512x2_loadu_pdx2(&in[i]))); \
+	} \
+	if (i < n) { \
+		const size_t rem = n - i; \
+		Float64x2 buf[8]; \
+		for (size_t j = 0; j < 8; j++) { \
+			buf[j] = in[i + ((j < rem) ? j : rem - 1)]; \
+		} \
+		_mm512x2_storeu_pdx2(buf, func(_mm512x2_loadu_pdx2(buf))); \
+		for (size_t j = 0; j < rem; j++) { \
+			out[i + j] = buf[j]; \
+		} \
+	} \
+}
+
+#define FLOAT64X2_ARRAY_AVX512_BINARY(name, func) \
+static void name( \
+	const Float64x2* x, const Float64x2* y, Float64x2* out, size_t n \
+) { \
+	size_t i = 0; \
+	for (; i + 8 <= n; i += 8) { \
+		_mm512x2_storeu_pdx2(&out[i], func( \
+			_mm512x2_loadu_pdx2(&x[i]), _mm512x2_loadu_pdx2(&y[i]) \
+		)); \
+	} \
+	if (i < n) { \
+		const size_t rem = n - i; \
+		Float64x2 buf_x[8]; \
+		Float64x2 buf_y[8]; \
+		for (size_t j = 0; j < 8; j++) { \
+			buf_x[j] = x[i + ((j < rem) ? j : rem - 1)]; \
+			buf_y[j] = y[i + ((j < rem) ? j : rem - 1)]; \
+		} \
+		_mm512x2_storeu_pdx2(buf_x, func( \
+			_mm512x2_loadu_pdx2(buf_x), _mm512x2_loadu_pdx2(buf_y) \
+		)); \
+		for (size_t j = 0; j < rem; j++) { \
+			out[i + j] = buf_x[j]; \
+		} \
+	} \
+}
+
+FLOAT64X2_ARRAY_AVX512_BINARY(Float64x2_add_array_AVX512, _mm512x2_add_pdx2)
+FLOAT64X2_ARRAY_AVX512_BINARY(Float64x2_sub_array_AVX512, _mm512x2_sub_pdx2)
+FLOAT64X2_ARRAY_AVX512_BINARY(Float64x2_mul_array_AVX512, _mm512x2_mul_pdx2)
+FLOAT64X2_ARRAY_AVX512_BINARY(Float64x2_div_array_AVX512, _mm512x2_div_pdx2)
+FLOAT64X2_ARRAY_AVX512_BINARY(Float64x2_copysign_array_AVX512, _mm512x2_copysign_pdx2)
+FLOAT64X2_ARRAY_AVX512_BINARY(Float64x2_fdim_array_AVX512, _mm512x2_fdim_pdx2)
+FLOAT64X2_ARRAY_AVX512_BINARY(Float64x2_fmax_array_AVX512, _mm512x2_fmax_pdx2)
+FLOAT64X2_ARRAY_AVX512_BINARY(Float64x2_fmin_array_AVX512, _mm512x2_fmin_pdx2)
+FLOAT64X2_ARRAY_AVX512_BINARY(Float64x2_fmod_array_AVX512, _mm512x2_fmod_pdx2)
+FLOAT64X2_ARRAY_AVX512_UNARY(Float64x2_fabs_array_AVX512, _mm512x2_fabs_pdx2)
+FLOAT64X2_ARRAY_AVX512_UNARY(Float64x2_sqrt_array_AVX512, _mm512x2_sqrt_pdx2)
+FLOAT64X2_ARRAY_AVX512_UNARY(Float64x2_floor_array_AVX512, _mm512x2_floor_pdx2)
+FLOAT64X2_ARRAY_AVX512_UNARY(Float64x2_ceil_array_AVX512, _mm512x2_ceil_pdx2)
+FLOAT64X2_ARRAY_AVX512_UNARY(Float64x2_trunc_array_AVX512, _mm512x2_trunc_pdx2)
+
+#undef FLOAT64X2_ARRAY_AVX512_UNARY
+#undef FLOAT64X2_ARRAY_AVX512_BINARY
+
+const Float64x2_array_kernels Float64x2_array_kernels_AVX512 = {
+	.add_array      = Float64x2_add_array_AVX512,
+	.sub_array      = Float64x2_sub_array_AVX512,
+	.mul_array      = Float64x2_mul_array_AVX512,
+	.div_array      = Float64x2_div_array_AVX512,
+	.copysign_array = Float64x2_copysign_array_AVX512,
+	.fdim_array     = Float64x2_fdim_array_AVX512,
+	.fmax_array     = Float64x2_fmax_array_AVX512,
+	.fmin_array     = Float64x2_fmin_array_AVX512,
+	.fmod_array     = Float64x2_fmod_array_AVX512,
+	.fabs_array     = Float64x2_fabs_array_AVX512,
+	.sqrt_array     = Float64x2_sqrt_array_AVX512,
+	.floor_array    = Float64x2_floor_array_AVX512,
+	.ceil_array     = Float64x2_ceil_array_AVX512,
+	.trunc_array    = Float64x2_trunc_array_AVX512,
+};
+
+#endif
@@ -0,0 +1,159 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "../LDF/LDF_cpu_dispatch.h"
+
+/**
+ * @brief SSE2 kernels for Float64x2_array.h
+ */
+
+#ifdef LDF_ENABLE_DISPATCH_SSE2
+
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__SSE2__)
+	#pragma GCC target("sse2")
+#endif
+
+#include "Float64x2_array_kernels.h"
+#include "Float64x2_SSE2.h"
+
+#include <emmintrin.h>
+
+//------------------------------------------------------------------------------
+// __m128dx2 array kernels
+//------------------------------------------------------------------------------
+
+/**
+ * @brief The tail is padded to a full __m128dx2 with copies of the last
+ * element, so that it is computed the same way as the rest of the array.
+ */
+#define FLOAT64X2_ARRAY_SSE2_UNARY(name, func) \
+static void name(const Float64x2* in, Float64x2* out, size_t n) { \
+	size_t i = 0; \
+	for (; i + 2 <= n; i += 2) { \
+		_mm128x2_storeu_pdx2(&out[i], func(_mm128x2_loadu_pdx2(&in[i]))); \
+	} \
+	if (i < n) { \
+		const size_t rem = n - i; \
+		Float64x2 buf[2]; \
+		for (size_t j = 0; j < 2; j++) { \
+			buf[j] = in[i + ((j < rem) ? j : rem - 1)]; \
+		} \
+		_mm128x2_storeu_pdx2(buf, func(_mm128x2_loadu_pdx2(buf))); \
+		for (size_t j = 0; j < rem; j++) { \
+			out[i + j] = buf[j]; \
+		} \
+	} \
+}
+
+#define FLOAT64X2_ARRAY_SSE2_BINARY(name, func) \
+static void name( \
+	const Float64x2* x, const Float64x2* y, Float64x2* out, size_t n \
+) { \
+	size_t i = 0; \
+	for (; i + 2 <= n; i += 2) { \
+		_mm128x2_storeu_pdx2(&out[i], func( \
+			_mm128x2_loadu_pdx2(&x[i]), _mm128x2_loadu_pdx2(&y[i]) \
+		)); \
+	} \
+	if (i < n) { \
+		const size_t rem = n - i; \
+		Float64x2 buf_x[2]; \
+		Float64x2 buf_y[2]; \
+		for (size_t j = 0; j < 2; j++) { \
+			buf_x[j] = x[i + ((j < rem) ? j : rem - 1)]; \
+			buf_y[j] = y[i + ((j < rem) ? j : rem - 1)]; \
+		} \
+		_mm128x2_storeu_pdx2(buf_x, func( \
+			_mm128x2_loadu_pdx2(buf_x), _mm128x2_loadu_pdx2(buf_y) \
+		)); \
+		for (size_t j = 0; j < rem; j++) { \
+			out[i + j] = buf_x[j]; \
+		} \
+	} \
+}
+
+FLOAT64X2_ARRAY_SSE2_BINARY(Float64x2_add_array_SSE2, _mm128x2_add_pdx2)
+FLOAT64X2_ARRAY_SSE2_BINARY(Float64x2_sub_array_SSE2, _mm128x2_sub_pdx2)
+FLOAT64X2_ARRAY_SSE2_BINARY(Float64x2_mul_array_SSE2, _mm128x2_mul_pdx2)
+FLOAT64X2_ARRAY_SSE2_BINARY(Float64x2_div_array_SSE2, _mm128x2_div_pdx2)
+FLOAT64X2_ARRAY_SSE2_BINARY(Float64x2_copysign_array_SSE2, _mm128x2_copysign_pdx2)
+FLOAT64X2_ARRAY_SSE2_BINARY(Float64x2_fdim_array_SSE2, _mm128x2_fdim_pdx2)
+FLOAT64X2_ARRAY_SSE2_BINARY(Float64x2_fmax_array_SSE2, _mm128x2_fmax_pdx2)
+FLOAT64X2_ARRAY_SSE2_BINARY(Float64x2_fmin_array_SSE2, _mm128x2_fmin_pdx2)
+FLOAT64X2_ARRAY_SSE2_BINARY(Float64x2_fmod_array_SSE2, _mm128x2_fmod_pdx2)
+FLOAT64X2_ARRAY_SSE2_BINARY(Float64x2_pow_array_SSE2, _mm128x2_pow_pdx2)
+FLOAT64X2_ARRAY_SSE2_BINARY(Float64x2_atan2_array_SSE2, _mm128x2_atan2_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_fabs_array_SSE2, _mm128x2_fabs_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_sqrt_array_SSE2, _mm128x2_sqrt_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_exp_array_SSE2, _mm128x2_exp_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_exp2_array_SSE2, _mm128x2_exp2_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_exp10_array_SSE2, _mm128x2_exp10_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_expm1_array_SSE2, _mm128x2_expm1_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_log_array_SSE2, _mm128x2_log_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_log2_array_SSE2, _mm128x2_log2_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_log10_array_SSE2, _mm128x2_log10_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_log1p_array_SSE2, _mm128x2_log1p_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_sin_array_SSE2, _mm128x2_sin_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_cos_array_SSE2, _mm128x2_cos_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_tan_array_SSE2, _mm128x2_tan_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_asin_array_SSE2, _mm128x2_asin_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_acos_array_SSE2, _mm128x2_acos_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_atan_array_SSE2, _mm128x2_atan_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_sinh_array_SSE2, _mm128x2_sinh_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_cosh_array_SSE2, _mm128x2_cosh_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_tanh_array_SSE2, _mm128x2_tanh_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_asinh_array_SSE2, _mm128x2_asinh_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_acosh_array_SSE2, _mm128x2_acosh_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_atanh_array_SSE2, _mm128x2_atanh_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_floor_array_SSE2, _mm128x2_floor_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_ceil_array_SSE2, _mm128x2_ceil_pdx2)
+FLOAT64X2_ARRAY_SSE2_UNARY(Float64x2_trunc_array_SSE2, _mm128x2_trunc_pdx2)
+
+#undef FLOAT64X2_ARRAY_SSE2_UNARY
+#undef FLOAT64X2_ARRAY_SSE2_BINARY
+
+const Float64x2_array_kernels Float64x2_array_kernels_SSE2 = {
+	.add_array      = Float64x2_add_array_SSE2,
+	.sub_array      = Float64x2_sub_array_SSE2,
+	.mul_array      = Float64x2_mul_array_SSE2,
+	.div_array      = Float64x2_div_array_SSE2,
+	.copysign_array = Float64x2_copysign_array_SSE2,
+	.fdim_array     = Float64x2_fdim_array_SSE2,
+	.fmax_array     = Float64x2_fmax_array_SSE2,
+	.fmin_array     = Float64x2_fmin_array_SSE2,
+	.fmod_array     = Float64x2_fmod_array_SSE2,
+	.pow_array      = Float64x2_pow_array_SSE2,
+	.atan2_array    = Float64x2_atan2_array_SSE2,
+	.fabs_array     = Float64x2_fabs_array_SSE2,
+	.sqrt_array     = Float64x2_sqrt_array_SSE2,
+	.exp_array      = Float64x2_exp_array_SSE2,
+	.exp2_array     = Float64x2_exp2_array_SSE2,
+	.exp10_array    = Float64x2_exp10_array_SSE2,
+	.expm1_array    = Float64x2_expm1_array_SSE2,
+	.log_array      = Float64x2_log_array_SSE2,
+	.log2_array     = Float64x2_log2_array_SSE2,
+	.log10_array    = Float64x2_log10_array_SSE2,
+	.log1p_array    = Float64x2_log1p_array_SSE2,
+	.sin_array      = Float64x2_sin_array_SSE2,
+	.cos_array      = Float64x2_cos_array_SSE2,
+	.tan_array      = Float64x2_tan_array_SSE2,
+	.asin_array     = Float64x2_asin_array_SSE2,
+	.acos_array     = Float64x2_acos_array_SSE2,
+	.atan_array     = Float64x2_atan_array_SSE2,
+	.sinh_array     = Float64x2_sinh_array_SSE2,
+	.cosh_array     = Float64x2_cosh_array_SSE2,
+	.tanh_array     = Float64x2_tanh_array_SSE2,
+	.asinh_array    = Float64x2_asinh_array_SSE2,
+	.acosh_array    = Float64x2_acosh_array_SSE2,
+	.atanh_array    = Float64x2_atanh_array_SSE2,
+	.floor_array    = Float64x2_floor_array_SSE2,
+	.ceil_array     = Float64x2_ceil_array_SSE2,
+	.trunc_array    = Float64x2_trunc_array_SSE2,
+};
+
+#endif
@@ -0,0 +1,95 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#ifndef FLOAT64X2_ARRAY_KERNELS_H
+#define FLOAT64X2_ARRAY_KERNELS_H
+
+/**
+ * @brief Internal table of the Float64x2_array.h kernels. Each
+ * Float64x2_array_<ISA>.c file provides one table.
+ *
+ * @note NULL entries fall back to the next lower level, and then to the
+ * scalar loop in Float64x2_array.c, so a level only needs to implement the
+ * kernels that it speeds up.
+ */
+
+#include "Float64x2_def.h"
+#include "../LDF/LDF_cpu_dispatch.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+typedef void (*Float64x2_array_unary_func)(
+	const Float64x2* in, Float64x2* out, size_t n
+);
+
+typedef void (*Float64x2_array_binary_func)(
+	const Float64x2* x, const Float64x2* y, Float64x2* out, size_t n
+);
+
+typedef struct Float64x2_array_kernels {
+	Float64x2_array_binary_func add_array;
+	Float64x2_array_binary_func sub_array;
+	Float64x2_array_binary_func mul_array;
+	Float64x2_array_binary_func div_array;
+	Float64x2_array_binary_func copysign_array;
+	Float64x2_array_binary_func fdim_array;
+	Float64x2_array_binary_func fmax_array;
+	Float64x2_array_binary_func fmin_array;
+	Float64x2_array_binary_func fmod_array;
+	Float64x2_array_binary_func pow_array;
+	Float64x2_array_binary_func atan2_array;
+	Float64x2_array_unary_func fabs_array;
+	Float64x2_array_unary_func sqrt_array;
+	Float64x2_array_unary_func cbrt_array;
+	Float64x2_array_unary_func exp_array;
+	Float64x2_array_unary_func exp2_array;
+	Float64x2_array_unary_func exp10_array;
+	Float64x2_array_unary_func expm1_array;
+	Float64x2_array_unary_func log_array;
+	Float64x2_array_unary_func log2_array;
+	Float64x2_array_unary_func log10_array;
+	Float64x2_array_unary_func log1p_array;
+	Float64x2_array_unary_func sin_array;
+	Float64x2_array_unary_func cos_array;
+	Float64x2_array_unary_func tan_array;
+	Float64x2_array_unary_func asin_array;
+	Float64x2_array_unary_func acos_array;
+	Float64x2_array_unary_func atan_array;
+	Float64x2_array_unary_func sinh_array;
+	Float64x2_array_unary_func cosh_array;
+	Float64x2_array_unary_func tanh_array;
+	Float64x2_array_unary_func asinh_array;
+	Float64x2_array_unary_func acosh_array;
+	Float64x2_array_unary_func atanh_array;
+	Float64x2_array_unary_func floor_array;
+	Float64x2_array_unary_func ceil_array;
+	Float64x2_array_unary_func trunc_array;
+} Float64x2_array_kernels;
+
+#ifdef LDF_ENABLE_DISPATCH_SSE2
+	extern const Float64x2_array_kernels Float64x2_array_kernels_SSE2;
+#endif
+#ifdef LDF_ENABLE_DISPATCH_AVX
+	extern const Float64x2_array_kernels Float64x2_array_kernels_AVX;
+#endif
+#ifdef LDF_ENABLE_DISPATCH_AVX2_FMA
+	extern const Float64x2_array_kernels Float64x2_array_kernels_AVX2_FMA;
+#endif
+#ifdef LDF_ENABLE_DISPATCH_AVX512
+	extern const Float64x2_array_kernels Float64x2_array_kernels_AVX512;
+#endif
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* FLOAT64X2_ARRAY_KERNELS_H */
@@ -0,0 +1,625 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "Float64x2_blas.h"
+#include "Float64x2_blas_kernels.h"
+#include "Float64x2.h"
+#include "../Float64/Float64_sum.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+//------------------------------------------------------------------------------
+// Float64x2 dispatch
+//------------------------------------------------------------------------------
+
+/** Indexed by LDF_cpu_level. NULL for the scalar level and disabled levels. */
+static const Float64x2_blas_kernels* const
+Float64x2_blas_levels[LDF_CPU_LEVEL_COUNT] = {
+	NULL,
+	#ifdef LDF_ENABLE_DISPATCH_SSE2
+		&Float64x2_blas_kernels_SSE2,
+	#else
+		NULL,
+	#endif
+	#ifdef LDF_ENABLE_DISPATCH_AVX
+		&Float64x2_blas_kernels_AVX,
+	#else
+		NULL,
+	#endif
+	#ifdef LDF_ENABLE_DISPATCH_AVX2_FMA
+		&Float64x2_blas_kernels_AVX2_FMA,
+	#else
+		NULL,
+	#endif
+	#ifdef LDF_ENABLE_DISPATCH_AVX512
+		&Float64x2_blas_kernels_AVX512,
+	#else
+		NULL,
+	#endif
+};
+
+/**
+ * @brief Sets func to the kernel from the highest supported level that
+ * implements it. func is left as NULL otherwise.
+ */
+#define FLOAT64X2_BLAS_FIND(kernel, func) \
+	for (int level = (int)LDF_cpu_get_level(); level > 0 && func == NULL; level--) { \
+		const Float64x2_blas_kernels* table = Float64x2_blas_levels[level]; \
+		if (table != NULL) { \
+			func = table->kernel; \
+		} \
+	}
+
+/** @brief Returns the index of the first element of a strided array */
+static inline ptrdiff_t Float64x2_blas_start(size_t n, ptrdiff_t inc) {
+	return (inc < 0) ? (ptrdiff_t)(n - 1) * -inc : 0;
+}
+
+//------------------------------------------------------------------------------
+// Float64x2 Level-1 BLAS
+//------------------------------------------------------------------------------
+
+Float64x2 Float64x2_dot(
+	size_t n, const Float64x2* x, ptrdiff_t incx, const Float64x2* y, ptrdiff_t incy
+) {
+	if (n == 0) {
+		return Float64x2_set_zero();
+	}
+	if (incx == 1 && incy == 1) {
+		Float64x2_blas_dot_func dot = NULL;
+		FLOAT64X2_BLAS_FIND(dot, dot)
+		if (dot != NULL) {
+			return dot(x, y, n);
+		}
+	}
+	ptrdiff_t ix = Float64x2_blas_start(n, incx);
+	ptrdiff_t iy = Float64x2_blas_start(n, incy);
+	Float64x2 sum = Float64x2_set_zero();
+	for (size_t i = 0; i < n; i++) {
+		sum = Float64x2_add(sum, Float64x2_mul(x[ix], y[iy]));
+		ix += incx;
+		iy += incy;
+	}
+	return sum;
+}
+
+void Float64x2_axpy(
+	size_t n, Float64x2 alpha, const Float64x2* x, ptrdiff_t incx,
+	Float64x2* y, ptrdiff_t incy
+) {
+	if (n == 0) {
+		return;
+	}
+	if (incx == 1 && incy == 1) {
+		Float64x2_blas_axpy_func axpy = NULL;
+		FLOAT64X2_BLAS_FIND(axpy, axpy)
+		if (axpy != NULL) {
+			axpy(alpha, x, y, n);
+			return;
+		}
+	}
+	ptrdiff_t ix = Float64x2_blas_start(n, incx);
+	ptrdiff_t iy = Float64x2_blas_start(n, incy);
+	for (size_t i = 0; i < n; i++) {
+		y[iy] = Float64x2_add(Float64x2_mul(alpha, x[ix]), y[iy]);
+		ix += incx;
+		iy += incy;
+	}
+}
+
+void Float64x2_scal(size_t n, Float64x2 alpha, Float64x2* x, ptrdiff_t incx) {
+	if (n == 0) {
+		return;
+	}
+	if (incx == 1) {
+		Float64x2_blas_scal_func scal = NULL;
+		FLOAT64X2_BLAS_FIND(scal, scal)
+		if (scal != NULL) {
+			scal(alpha, x, n);
+			return;
+		}
+	}
+	ptrdiff_t ix = Float64x2_blas_start(n, incx);
+	for (size_t i = 0; i < n; i++) {
+		x[ix] = Float64x2_mul(alpha, x[ix]);
+		ix += incx;
+	}
+}
+
+Float64x2 Float64x2_nrm2(size_t n, const Float64x2* x, ptrdiff_t incx) {
+	if (n == 0) {
+		return Float64x2_set_zero();
+	}
+	const ptrdiff_t index = Float64x2_blas_start(n, incx) +
+		(ptrdiff_t)Float64x2_iamax(n, x, incx) * incx;
+	const Float64x2 x_max = Float64x2_fabs(x[index]);
+	if (Float64x2_isinf(x_max)) {
+		return x_max;
+	}
+	/**
+	 * Scales by a power of two like Float64x2_hypot. The margins are wider
+	 * than hypot's since up to n squares are summed.
+	 */
+	fp64 scale = 1.0;
+	fp64 unscale = 1.0;
+	if (x_max.hi >= 0x1.0p+480) {
+		scale = 0x1.0p-600;
+		unscale = 0x1.0p+600;
+	} else if (x_max.hi <= 0x1.0p-480) {
+		scale = 0x1.0p+600;
+		unscale = 0x1.0p-600;
+	}
+	Float64x2 sum = Float64x2_set_zero();
+	Float64x2_blas_sumsq_func sumsq = NULL;
+	if (incx == 1) {
+		FLOAT64X2_BLAS_FIND(sumsq, sumsq)
+	}
+	if (sumsq != NULL) {
+		sum = sumsq(x, n, scale);
+	} else {
+		ptrdiff_t ix = Float64x2_blas_start(n, incx);
+		for (size_t i = 0; i < n; i++) {
+			sum = Float64x2_add(sum, Float64x2_square(Float64x2_mul_power2_dx2_d(x[ix], scale)));
+			ix += incx;
+		}
+	}
+	return Float64x2_mul_power2_dx2_d(Float64x2_sqrt(sum), unscale);
+}
+
+Float64x2 Float64x2_asum(size_t n, const Float64x2* x, ptrdiff_t incx) {
+	if (n == 0) {
+		return Float64x2_set_zero();
+	}
+	if (incx == 1) {
+		Float64x2_blas_asum_func asum = NULL;
+		FLOAT64X2_BLAS_FIND(asum, asum)
+		if (asum != NULL) {
+			return asum(x, n);
+		}
+	}
+	ptrdiff_t ix = Float64x2_blas_start(n, incx);
+	Float64x2 sum = Float64x2_set_zero();
+	for (size_t i = 0; i < n; i++) {
+		sum = Float64x2_add(sum, Float64x2_fabs(x[ix]));
+		ix += incx;
+	}
+	return sum;
+}
+
+size_t Float64x2_iamax(size_t n, const Float64x2* x, ptrdiff_t incx) {
+	if (n == 0) {
+		return 0;
+	}
+	if (incx == 1) {
+		Float64x2_blas_iamax_func iamax = NULL;
+		FLOAT64X2_BLAS_FIND(iamax, iamax)
+		if (iamax != NULL) {
+			return iamax(x, n);
+		}
+	}
+	ptrdiff_t ix = Float64x2_blas_start(n, incx);
+	/* Starting below zero lets the loop skip NaN with a single compare */
+	Float64x2 x_max = Float64x2_set_d(-1.0);
+	size_t index = 0;
+	for (size_t i = 0; i < n; i++) {
+		const Float64x2 x_abs = Float64x2_fabs(x[ix]);
+		if (Float64x2_cmpgt(x_abs, x_max)) {
+			x_max = x_abs;
+			index = i;
+		}
+		ix += incx;
+	}
+	return index;
+}
+
+void Float64x2_rot(
+	size_t n, Float64x2* x, ptrdiff_t incx, Float64x2* y, ptrdiff_t incy,
+	Float64x2 c, Float64x2 s
+) {
+	if (n == 0) {
+		return;
+	}
+	if (incx == 1 && incy == 1) {
+		Float64x2_blas_rot_func rot = NULL;
+		FLOAT64X2_BLAS_FIND(rot, rot)
+		if (rot != NULL) {
+			rot(x, y, n, c, s);
+			return;
+		}
+	}
+	ptrdiff_t ix = Float64x2_blas_start(n, incx);
+	ptrdiff_t iy = Float64x2_blas_start(n, incy);
+	for (size_t i = 0; i < n; i++) {
+		const Float64x2 x_val = x[ix];
+		const Float64x2 y_val = y[iy];
+		x[ix] = Float64x2_add(Float64x2_mul(c, x_val), Float64x2_mul(s, y_val));
+		y[iy] = Float64x2_sub(Float64x2_mul(c, y_val), Float64x2_mul(s, x_val));
+		ix += incx;
+		iy += incy;
+	}
+}
+
+//------------------------------------------------------------------------------
+// Float64x2 Level-2 BLAS
+//------------------------------------------------------------------------------
+
+void Float64x2_gemv(
+	LDF_blas_layout layout, LDF_blas_transpose trans,
+	size_t m, size_t n, Float64x2 alpha, const Float64x2* A, size_t lda,
+	const Float64x2* x, ptrdiff_t incx, Float64x2 beta, Float64x2* y, ptrdiff_t incy
+) {
+	const size_t len_x = (trans == LDF_BLAS_NO_TRANS) ? n : m;
+	const size_t len_y = (trans == LDF_BLAS_NO_TRANS) ? m : n;
+	if (len_y == 0) {
+		return;
+	}
+	if (Float64x2_cmpeq_zero(beta)) {
+		ptrdiff_t iy = Float64x2_blas_start(len_y, incy);
+		for (size_t i = 0; i < len_y; i++) {
+			y[iy] = Float64x2_set_zero();
+			iy += incy;
+		}
+	} else if (!Float64x2_cmpeq(beta, Float64x2_set_d(1.0))) {
+		Float64x2_scal(len_y, beta, y, incy);
+	}
+	if (len_x == 0 || Float64x2_cmpeq_zero(alpha)) {
+		return;
+	}
+	/**
+	 * A row-major matrix is the transpose of a column-major one. When the
+	 * columns of op(A) are contiguous, y is accumulated with axpy, otherwise
+	 * each y[i] is a dot product with a contiguous row of op(A).
+	 */
+	const bool axpy_form = (layout == LDF_BLAS_COL_MAJOR) == (trans == LDF_BLAS_NO_TRANS);
+	if (axpy_form) {
+		ptrdiff_t ix = Float64x2_blas_start(len_x, incx);
+		for (size_t j = 0; j < len_x; j++) {
+			Float64x2_axpy(len_y, Float64x2_mul(alpha, x[ix]), &A[j * lda], 1, y, incy);
+			ix += incx;
+		}
+	} else {
+		ptrdiff_t iy = Float64x2_blas_start(len_y, incy);
+		for (size_t i = 0; i < len_y; i++) {
+			y[iy] = Float64x2_add(y[iy], Float64x2_mul(
+				alpha, Float64x2_dot(len_x, &A[i * lda], 1, x, incx)
+			));
+			iy += incy;
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+// Float64x2 Level-3 BLAS
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Cache blocking sizes for gemm, in elements. A kc by gemm_nr sliver
+ * of B and a gemm_mr by kc sliver of A stay in L1, the mc by kc panel of A
+ * stays in L2, and the kc by nc panel of B stays in L3.
+ * @note mc and nc must be multiples of every gemm_mr and gemm_nr.
+ */
+#define FLOAT64X2_GEMM_KC 128
+#define FLOAT64X2_GEMM_MC 64
+#define FLOAT64X2_GEMM_NC 1024
+
+#define FLOAT64X2_GEMM_SCALAR_MR 4
+#define FLOAT64X2_GEMM_SCALAR_NR 4
+
+static void Float64x2_gemm_micro_scalar(
+	size_t k, const Float64x2* A, const Float64x2* B, Float64x2 alpha,
+	Float64x2* C, size_t ldc, size_t mr, size_t nr
+) {
+	Float64x2 acc[FLOAT64X2_GEMM_SCALAR_NR][FLOAT64X2_GEMM_SCALAR_MR];
+	for (size_t j = 0; j < FLOAT64X2_GEMM_SCALAR_NR; j++) {
+		for (size_t i = 0; i < FLOAT64X2_GEMM_SCALAR_MR; i++) {
+			acc[j][i] = Float64x2_set_zero();
+		}
+	}
+	for (size_t p = 0; p < k; p++) {
+		for (size_t j = 0; j < FLOAT64X2_GEMM_SCALAR_NR; j++) {
+			for (size_t i = 0; i < FLOAT64X2_GEMM_SCALAR_MR; i++) {
+				acc[j][i] = Float64x2_add(acc[j][i], Float64x2_mul(A[i], B[j]));
+			}
+		}
+		A += FLOAT64X2_GEMM_SCALAR_MR;
+		B += FLOAT64X2_GEMM_SCALAR_NR;
+	}
+	for (size_t j = 0; j < nr; j++) {
+		for (size_t i = 0; i < mr; i++) {
+			C[i + j * ldc] = Float64x2_add(C[i + j * ldc], Float64x2_mul(alpha, acc[j][i]));
+		}
+	}
+}
+
+/**
+ * @brief Packs an mc by kc block of op(A) into slivers of mr rows, which
+ * are zero padded to a multiple of mr.
+ */
+static void Float64x2_gemm_pack_A(
+	size_t mc, size_t kc, const Float64x2* A, size_t lda, bool trans,
+	size_t mr, Float64x2* buf
+) {
+	for (size_t i = 0; i < mc; i += mr) {
+		for (size_t p = 0; p < kc; p++) {
+			for (size_t r = 0; r < mr; r++) {
+				*buf++ = (i + r >= mc) ? Float64x2_set_zero() :
+					trans ? A[p + (i + r) * lda] : A[(i + r) + p * lda];
+			}
+		}
+	}
+}
+
+/**
+ * @brief Packs a kc by nc block of op(B) into slivers of nr columns, which
+ * are zero padded to a multiple of nr.
+ */
+static void Float64x2_gemm_pack_B(
+	size_t kc, size_t nc, const Float64x2* B, size_t ldb, bool trans,
+	size_t nr, Float64x2* buf
+) {
+	for (size_t j = 0; j < nc; j += nr) {
+		for (size_t p = 0; p < kc; p++) {
+			for (size_t c = 0; c < nr; c++) {
+				*buf++ = (j + c >= nc) ? Float64x2_set_zero() :
+					trans ? B[(j + c) + p * ldb] : B[p + (j + c) * ldb];
+			}
+		}
+	}
+}
+
+static inline size_t Float64x2_gemm_min(size_t x, size_t y) {
+	return (x < y) ? x : y;
+}
+
+/** @brief Column-major C += alpha * op(A) * op(B) */
+static void Float64x2_gemm_col_major(
+	bool trans_a, bool trans_b, size_t m, size_t n, size_t k, Float64x2 alpha,
+	const Float64x2* A, size_t lda, const Float64x2* B, size_t ldb,
+	Float64x2* C, size_t ldc
+) {
+	Float64x2_blas_gemm_func micro = Float64x2_gemm_micro_scalar;
+	size_t mr = FLOAT64X2_GEMM_SCALAR_MR;
+	size_t nr = FLOAT64X2_GEMM_SCALAR_NR;
+	for (int level = (int)LDF_cpu_get_level(); level > 0; level--) {
+		const Float64x2_blas_kernels* table = Float64x2_blas_levels[level];
+		if (table != NULL && table->gemm != NULL) {
+			micro = table->gemm;
+			mr = table->gemm_mr;
+			nr = table->gemm_nr;
+			break;
+		}
+	}
+
+	const size_t max_kc = Float64x2_gemm_min(k, FLOAT64X2_GEMM_KC);
+	const size_t max_mc = Float64x2_gemm_min((m + mr - 1) / mr * mr, FLOAT64X2_GEMM_MC);
+	const size_t max_nc = Float64x2_gemm_min((n + nr - 1) / nr * nr, FLOAT64X2_GEMM_NC);
+	Float64x2* pack_A = (Float64x2*)malloc(max_mc * max_kc * sizeof(Float64x2));
+	Float64x2* pack_B = (Float64x2*)malloc(max_nc * max_kc * sizeof(Float64x2));
+	if (pack_A == NULL || pack_B == NULL) {
+		free(pack_A);
+		free(pack_B);
+		for (size_t j = 0; j < n; j++) {
+			for (size_t i = 0; i < m; i++) {
+				Float64x2 sum = Float64x2_set_zero();
+				for (size_t p = 0; p < k; p++) {
+					sum = Float64x2_add(sum, Float64x2_mul(
+						trans_a ? A[p + i * lda] : A[i + p * lda],
+						trans_b ? B[j + p * ldb] : B[p + j * ldb]
+					));
+				}
+				C[i + j * ldc] = Float64x2_add(C[i + j * ldc], Float64x2_mul(alpha, sum));
+			}
+		}
+		return;
+	}
+
+	for (size_t jc = 0; jc < n; jc += FLOAT64X2_GEMM_NC) {
+		const size_t nc = Float64x2_gemm_min(n - jc, FLOAT64X2_GEMM_NC);
+		for (size_t pc = 0; pc < k; pc += FLOAT64X2_GEMM_KC) {
+			const size_t kc = Float64x2_gemm_min(k - pc, FLOAT64X2_GEMM_KC);
+			Float64x2_gemm_pack_B(
+				kc, nc, trans_b ? &B[jc + pc * ldb] : &B[pc + jc * ldb],
+				ldb, trans_b, nr, pack_B
+			);
+			for (size_t ic = 0; ic < m; ic += FLOAT64X2_GEMM_MC) {
+				const size_t mc = Float64x2_gemm_min(m - ic, FLOAT64X2_GEMM_MC);
+				Float64x2_gemm_pack_A(
+					mc, kc, trans_a ? &A[pc + ic * lda] : &A[ic + pc * lda],
+					lda, trans_a, mr, pack_A
+				);
+				for (size_t jr = 0; jr < nc; jr += nr) {
+					for (size_t ir = 0; ir < mc; ir += mr) {
+						micro(
+							kc, &pack_A[ir * kc], &pack_B[jr * kc], alpha,
+							&C[(ic + ir) + (jc + jr) * ldc], ldc,
+							Float64x2_gemm_min(mr, mc - ir), Float64x2_gemm_min(nr, nc - jr)
+						);
+					}
+				}
+			}
+		}
+	}
+	free(pack_A);
+	free(pack_B);
+}
+
+void Float64x2_gemm(
+	LDF_blas_layout layout, LDF_blas_transpose transa, LDF_blas_transpose transb,
+	size_t m, size_t n, size_t k, Float64x2 alpha, const Float64x2* A, size_t lda,
+	const Float64x2* B, size_t ldb, Float64x2 beta, Float64x2* C, size_t ldc
+) {
+	if (m == 0 || n == 0) {
+		return;
+	}
+	/* A row-major C is the column-major C^T = op(B)^T * op(A)^T */
+	if (layout == LDF_BLAS_ROW_MAJOR) {
+		Float64x2_gemm(
+			LDF_BLAS_COL_MAJOR, transb, transa, n, m, k,
+			alpha, B, ldb, A, lda, beta, C, ldc
+		);
+		return;
+	}
+	if (Float64x2_cmpeq_zero(beta)) {
+		for (size_t j = 0; j < n; j++) {
+			for (size_t i = 0; i < m; i++) {
+				C[i + j * ldc] = Float64x2_set_zero();
+			}
+		}
+	} else if (!Float64x2_cmpeq(beta, Float64x2_set_d(1.0))) {
+		for (size_t j = 0; j < n; j++) {
+			Float64x2_scal(m, beta, &C[j * ldc], 1);
+		}
+	}
+	if (k == 0 || Float64x2_cmpeq_zero(alpha)) {
+		return;
+	}
+	Float64x2_gemm_col_major(
+		transa == LDF_BLAS_TRANS, transb == LDF_BLAS_TRANS, m, n, k, alpha,
+		A, lda, B, ldb, C, ldc
+	);
+}
+
+//------------------------------------------------------------------------------
+// Float64x2 mixed precision BLAS
+//------------------------------------------------------------------------------
+
+Float64x2 Float64x2_dot_d(
+	size_t n, const fp64* x, ptrdiff_t incx, const fp64* y, ptrdiff_t incy
+) {
+	if (n == 0) {
+		return Float64x2_set_zero();
+	}
+	if (incx == 1 && incy == 1) {
+		Float64x2_blas_dot_d_func dot_d = NULL;
+		FLOAT64X2_BLAS_FIND(dot_d, dot_d)
+		if (dot_d != NULL) {
+			return dot_d(x, y, n);
+		}
+	}
+	ptrdiff_t ix = Float64x2_blas_start(n, incx);
+	ptrdiff_t iy = Float64x2_blas_start(n, incy);
+	fp64 p = 0.0;
+	fp64 s = 0.0;
+	for (size_t i = 0; i < n; i++) {
+		Float64x2_blas_dot2_step(&p, &s, x[ix], y[iy]);
+		ix += incx;
+		iy += incy;
+	}
+	return Float64x2_add_d_d(p, s);
+}
+
+Float64x2 Float64x2_sum_d(size_t n, const fp64* x, ptrdiff_t incx) {
+	if (n == 0) {
+		return Float64x2_set_zero();
+	}
+	if (incx == 1) {
+		Float64x2_blas_sum_d_func sum_d = NULL;
+		FLOAT64X2_BLAS_FIND(sum_d, sum_d)
+		if (sum_d != NULL) {
+			return sum_d(x, n);
+		}
+	}
+	ptrdiff_t ix = Float64x2_blas_start(n, incx);
+	fp64 p = 0.0;
+	fp64 s = 0.0;
+	for (size_t i = 0; i < n; i++) {
+		Float64x2_blas_sum2_step(&p, &s, x[ix]);
+		ix += incx;
+	}
+	return Float64x2_add_d_d(p, s);
+}
+
+/** @brief Rows of y that gemv_d accumulates at a time, 4KiB of stack */
+#define FLOAT64X2_GEMV_D_BLOCK 256
+
+void Float64x2_gemv_d(
+	LDF_blas_layout layout, LDF_blas_transpose trans,
+	size_t m, size_t n, Float64x2 alpha, const fp64* A, size_t lda,
+	const fp64* x, ptrdiff_t incx, Float64x2 beta, Float64x2* y, ptrdiff_t incy
+) {
+	const size_t len_x = (trans == LDF_BLAS_NO_TRANS) ? n : m;
+	const size_t len_y = (trans == LDF_BLAS_NO_TRANS) ? m : n;
+	if (len_y == 0) {
+		return;
+	}
+	if (Float64x2_cmpeq_zero(beta)) {
+		ptrdiff_t iy = Float64x2_blas_start(len_y, incy);
+		for (size_t i = 0; i < len_y; i++) {
+			y[iy] = Float64x2_set_zero();
+			iy += incy;
+		}
+	} else if (!Float64x2_cmpeq(beta, Float64x2_set_d(1.0))) {
+		Float64x2_scal(len_y, beta, y, incy);
+	}
+	if (len_x == 0 || Float64x2_cmpeq_zero(alpha)) {
+		return;
+	}
+	const bool axpy_form = (layout == LDF_BLAS_COL_MAJOR) == (trans == LDF_BLAS_NO_TRANS);
+	if (!axpy_form) {
+		ptrdiff_t iy = Float64x2_blas_start(len_y, incy);
+		for (size_t i = 0; i < len_y; i++) {
+			y[iy] = Float64x2_add(y[iy], Float64x2_mul(
+				alpha, Float64x2_dot_d(len_x, &A[i * lda], 1, x, incx)
+			));
+			iy += incy;
+		}
+		return;
+	}
+	/**
+	 * The columns of op(A) are contiguous, so the sums for a block of rows
+	 * are accumulated one column at a time.
+	 */
+	Float64x2_blas_axpy_d_func axpy_d = NULL;
+	FLOAT64X2_BLAS_FIND(axpy_d, axpy_d)
+	ptrdiff_t iy = Float64x2_blas_start(len_y, incy);
+	for (size_t row = 0; row < len_y; row += FLOAT64X2_GEMV_D_BLOCK) {
+		const size_t rows = (len_y - row < FLOAT64X2_GEMV_D_BLOCK) ?
+			len_y - row : FLOAT64X2_GEMV_D_BLOCK;
+		fp64 p[FLOAT64X2_GEMV_D_BLOCK];
+		fp64 s[FLOAT64X2_GEMV_D_BLOCK];
+		for (size_t i = 0; i < rows; i++) {
+			p[i] = 0.0;
+			s[i] = 0.0;
+		}
+		ptrdiff_t ix = Float64x2_blas_start(len_x, incx);
+		for (size_t j = 0; j < len_x; j++) {
+			const fp64* col = &A[row + j * lda];
+			if (axpy_d != NULL) {
+				axpy_d(p, s, col, x[ix], rows);
+			} else {
+				for (size_t i = 0; i < rows; i++) {
+					Float64x2_blas_dot2_step(&p[i], &s[i], col[i], x[ix]);
+				}
+			}
+			ix += incx;
+		}
+		for (size_t i = 0; i < rows; i++) {
+			y[iy] = Float64x2_add(y[iy], Float64x2_mul(alpha, Float64x2_add_d_d(p[i], s[i])));
+			iy += incy;
+		}
+	}
+}
+
+Float64x2 Float64x2_sumK_d(size_t n, const fp64* x, ptrdiff_t incx, int K) {
+	fp64 partials[FLOAT64_SUMK_MAX];
+	K = Float64_sumK_partials(n, x, incx, K, partials);
+	Float64x2 sum = Float64x2_set_zero();
+	for (int k = K - 1; k >= 0; k--) {
+		sum = Float64x2_add_dx2_d(sum, partials[k]);
+	}
+	return sum;
+}
+
+#undef FLOAT64X2_BLAS_FIND
+#undef FLOAT64X2_GEMM_KC
+#undef FLOAT64X2_GEMM_MC
+#undef FLOAT64X2_GEMM_NC
+#undef FLOAT64X2_GEMM_SCALAR_MR
+#undef FLOAT64X2_GEMM_SCALAR_NR
+#undef FLOAT64X2_GEMV_D_BLOCK
@@ -0,0 +1,301 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "../LDF/LDF_cpu_dispatch.h"
+
+/**
+ * @brief AVX512 kernels for Float64x2_blas.h. Only AVX512F is required.
+ */
+
+#ifdef LDF_ENABLE_DISPATCH_AVX512
+
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__AVX512F__)
+	#pragma GCC target("avx512f,avx2,fma")
+#endif
+
+#include "Float64x2_blas_kernels.h"
+#include "Float64x2_AVX512.h"
+#include "Float64x2.h"
+
+#include <immintrin.h>
+
+//------------------------------------------------------------------------------
+// __m512dx2 BLAS kernels
+//------------------------------------------------------------------------------
+
+/** @brief Adds the lanes of a vector in order */
+static inline Float64x2 Float64x2_blas_reduce_AVX512(const __m512dx2 x) {
+	Float64x2 lane[8];
+	_mm512x2_storeu_pdx2(lane, x);
+	Float64x2 sum = lane[0];
+	for (size_t j = 1; j < 8; j++) {
+		sum = Float64x2_add(sum, lane[j]);
+	}
+	return sum;
+}
+
+static Float64x2 Float64x2_dot_AVX512(const Float64x2* x, const Float64x2* y, size_t n) {
+	__m512dx2 sum = _mm512x2_setzero_pdx2();
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		sum = _mm512x2_add_pdx2(sum, _mm512x2_mul_pdx2(
+			_mm512x2_loadu_pdx2(&x[i]), _mm512x2_loadu_pdx2(&y[i])
+		));
+	}
+	Float64x2 ret = Float64x2_blas_reduce_AVX512(sum);
+	for (; i < n; i++) {
+		ret = Float64x2_add(ret, Float64x2_mul(x[i], y[i]));
+	}
+	return ret;
+}
+
+static void Float64x2_axpy_AVX512(Float64x2 alpha, const Float64x2* x, Float64x2* y, size_t n) {
+	const __m512dx2 v_alpha = _mm512x2_set1_pdx2(alpha);
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		_mm512x2_storeu_pdx2(&y[i], _mm512x2_add_pdx2(
+			_mm512x2_mul_pdx2(v_alpha, _mm512x2_loadu_pdx2(&x[i])),
+			_mm512x2_loadu_pdx2(&y[i])
+		));
+	}
+	for (; i < n; i++) {
+		y[i] = Float64x2_add(Float64x2_mul(alpha, x[i]), y[i]);
+	}
+}
+
+static void Float64x2_scal_AVX512(Float64x2 alpha, Float64x2* x, size_t n) {
+	const __m512dx2 v_alpha = _mm512x2_set1_pdx2(alpha);
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		_mm512x2_storeu_pdx2(&x[i], _mm512x2_mul_pdx2(v_alpha, _mm512x2_loadu_pdx2(&x[i])));
+	}
+	for (; i < n; i++) {
+		x[i] = Float64x2_mul(alpha, x[i]);
+	}
+}
+
+static Float64x2 Float64x2_sumsq_AVX512(const Float64x2* x, size_t n, fp64 scale) {
+	const __m512d v_scale = _mm512_set1_pd(scale);
+	__m512dx2 sum = _mm512x2_setzero_pdx2();
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		sum = _mm512x2_add_pdx2(sum, _mm512x2_square_pdx2(
+			_mm512x2_mul_power2_pdx2_pd(_mm512x2_loadu_pdx2(&x[i]), v_scale)
+		));
+	}
+	Float64x2 ret = Float64x2_blas_reduce_AVX512(sum);
+	for (; i < n; i++) {
+		ret = Float64x2_add(ret, Float64x2_square(Float64x2_mul_power2_dx2_d(x[i], scale)));
+	}
+	return ret;
+}
+
+static Float64x2 Float64x2_asum_AVX512(const Float64x2* x, size_t n) {
+	__m512dx2 sum = _mm512x2_setzero_pdx2();
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		sum = _mm512x2_add_pdx2(sum, _mm512x2_fabs_pdx2(_mm512x2_loadu_pdx2(&x[i])));
+	}
+	Float64x2 ret = Float64x2_blas_reduce_AVX512(sum);
+	for (; i < n; i++) {
+		ret = Float64x2_add(ret, Float64x2_fabs(x[i]));
+	}
+	return ret;
+}
+
+/**
+ * @brief Each lane keeps its own maximum and index. The lanes are then
+ * merged, preferring the smallest index on ties, before the scalar tail.
+ */
+static size_t Float64x2_iamax_AVX512(const Float64x2* x, size_t n) {
+	Float64x2 ret_max = Float64x2_set_d(-1.0);
+	size_t ret_index = 0;
+	size_t i = 0;
+	if (n >= 8) {
+		__m512dx2 x_max = _mm512x2_set1_pd(-1.0);
+		__m512d index = _mm512_setzero_pd();
+		__m512d lane_index = _mm512_setr_pd(0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0);
+		const __m512d lane_step = _mm512_set1_pd(8.0);
+		for (; i + 8 <= n; i += 8) {
+			const __m512dx2 x_abs = _mm512x2_fabs_pdx2(_mm512x2_loadu_pdx2(&x[i]));
+			const __mmask8 cmp = _mm512_cmpgt_pdx2_mask(x_abs, x_max);
+			x_max = _mm512x2_mask_blend_pdx2(cmp, x_max, x_abs);
+			index = _mm512_mask_blend_pd(cmp, index, lane_index);
+			lane_index = _mm512_add_pd(lane_index, lane_step);
+		}
+		Float64x2 lane_max[8];
+		fp64 lane_pos[8];
+		_mm512x2_storeu_pdx2(lane_max, x_max);
+		_mm512_storeu_pd(lane_pos, index);
+		for (size_t j = 0; j < 8; j++) {
+			const size_t pos = (size_t)lane_pos[j];
+			if (
+				Float64x2_cmpgt(lane_max[j], ret_max) ||
+				(Float64x2_cmpeq(lane_max[j], ret_max) && pos < ret_index)
+			) {
+				ret_max = lane_max[j];
+				ret_index = pos;
+			}
+		}
+	}
+	for (; i < n; i++) {
+		const Float64x2 x_abs = Float64x2_fabs(x[i]);
+		if (Float64x2_cmpgt(x_abs, ret_max)) {
+			ret_max = x_abs;
+			ret_index = i;
+		}
+	}
+	return ret_index;
+}
+
+static void Float64x2_rot_AVX512(Float64x2* x, Float64x2* y, size_t n, Float64x2 c, Float64x2 s) {
+	const __m512dx2 v_c = _mm512x2_set1_pdx2(c);
+	const __m512dx2 v_s = _mm512x2_set1_pdx2(s);
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		const __m512dx2 x_val = _mm512x2_loadu_pdx2(&x[i]);
+		const __m512dx2 y_val = _mm512x2_loadu_pdx2(&y[i]);
+		_mm512x2_storeu_pdx2(&x[i], _mm512x2_add_pdx2(
+			_mm512x2_mul_pdx2(v_c, x_val), _mm512x2_mul_pdx2(v_s, y_val)
+		));
+		_mm512x2_storeu_pdx2(&y[i], _mm512x2_sub_pdx2(
+			_mm512x2_mul_pdx2(v_c, y_val), _mm512x2_mul_pdx2(v_s, x_val)
+		));
+	}
+	for (; i < n; i++) {
+		const Float64x2 x_val = x[i];
+		const Float64x2 y_val = y[i];
+		x[i] = Float64x2_add(Float64x2_mul(c, x_val), Float64x2_mul(s, y_val));
+		y[i] = Float64x2_sub(Float64x2_mul(c, y_val), Float64x2_mul(s, x_val));
+	}
+}
+
+/**
+ * @brief Register-blocked 8 by 4 gemm tile. Each step of k is a
+ * broadcast of one element of B times a column of A.
+ */
+static void Float64x2_gemm_AVX512(
+	size_t k, const Float64x2* A, const Float64x2* B, Float64x2 alpha,
+	Float64x2* C, size_t ldc, size_t mr, size_t nr
+) {
+	__m512dx2 c0 = _mm512x2_setzero_pdx2();
+	__m512dx2 c1 = _mm512x2_setzero_pdx2();
+	__m512dx2 c2 = _mm512x2_setzero_pdx2();
+	__m512dx2 c3 = _mm512x2_setzero_pdx2();
+	for (size_t p = 0; p < k; p++) {
+		const __m512dx2 a_col = _mm512x2_loadu_pdx2(A);
+		c0 = _mm512x2_add_pdx2(c0, _mm512x2_mul_pdx2(a_col, _mm512x2_set1_pdx2(B[0])));
+		c1 = _mm512x2_add_pdx2(c1, _mm512x2_mul_pdx2(a_col, _mm512x2_set1_pdx2(B[1])));
+		c2 = _mm512x2_add_pdx2(c2, _mm512x2_mul_pdx2(a_col, _mm512x2_set1_pdx2(B[2])));
+		c3 = _mm512x2_add_pdx2(c3, _mm512x2_mul_pdx2(a_col, _mm512x2_set1_pdx2(B[3])));
+		A += 8;
+		B += 4;
+	}
+	const __m512dx2 v_alpha = _mm512x2_set1_pdx2(alpha);
+	Float64x2 tile[8 * 4];
+	_mm512x2_storeu_pdx2(&tile[0], _mm512x2_mul_pdx2(v_alpha, c0));
+	_mm512x2_storeu_pdx2(&tile[8], _mm512x2_mul_pdx2(v_alpha, c1));
+	_mm512x2_storeu_pdx2(&tile[16], _mm512x2_mul_pdx2(v_alpha, c2));
+	_mm512x2_storeu_pdx2(&tile[24], _mm512x2_mul_pdx2(v_alpha, c3));
+	for (size_t j = 0; j < nr; j++) {
+		for (size_t i = 0; i < mr; i++) {
+			C[i + j * ldc] = Float64x2_add(C[i + j * ldc], tile[i + j * 8]);
+		}
+	}
+}
+
+/**
+ * @brief Dot2 and Sum2 with one unnormalized sum per lane. The lanes are
+ * then merged with the scalar steps, in order, before the tail.
+ */
+static Float64x2 Float64x2_dot_d_AVX512(const fp64* x, const fp64* y, size_t n) {
+	__m512d sum_hi = _mm512_setzero_pd();
+	__m512d sum_lo = _mm512_setzero_pd();
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		const __m512dx2 prod = _mm512x2_mul_pd_pd(
+			_mm512_loadu_pd(&x[i]), _mm512_loadu_pd(&y[i])
+		);
+		const __m512dx2 sum = _mm512x2_add_pd_pd(sum_hi, prod.hi);
+		sum_hi = sum.hi;
+		sum_lo = _mm512_add_pd(sum_lo, _mm512_add_pd(sum.lo, prod.lo));
+	}
+	fp64 lane_hi[8];
+	fp64 lane_lo[8];
+	_mm512_storeu_pd(lane_hi, sum_hi);
+	_mm512_storeu_pd(lane_lo, sum_lo);
+	fp64 p = 0.0;
+	fp64 s = 0.0;
+	for (size_t j = 0; j < 8; j++) {
+		Float64x2_blas_sum2_step(&p, &s, lane_hi[j]);
+		s += lane_lo[j];
+	}
+	for (; i < n; i++) {
+		Float64x2_blas_dot2_step(&p, &s, x[i], y[i]);
+	}
+	return Float64x2_add_d_d(p, s);
+}
+
+static Float64x2 Float64x2_sum_d_AVX512(const fp64* x, size_t n) {
+	__m512d sum_hi = _mm512_setzero_pd();
+	__m512d sum_lo = _mm512_setzero_pd();
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		const __m512dx2 sum = _mm512x2_add_pd_pd(sum_hi, _mm512_loadu_pd(&x[i]));
+		sum_hi = sum.hi;
+		sum_lo = _mm512_add_pd(sum_lo, sum.lo);
+	}
+	fp64 lane_hi[8];
+	fp64 lane_lo[8];
+	_mm512_storeu_pd(lane_hi, sum_hi);
+	_mm512_storeu_pd(lane_lo, sum_lo);
+	fp64 p = 0.0;
+	fp64 s = 0.0;
+	for (size_t j = 0; j < 8; j++) {
+		Float64x2_blas_sum2_step(&p, &s, lane_hi[j]);
+		s += lane_lo[j];
+	}
+	for (; i < n; i++) {
+		Float64x2_blas_sum2_step(&p, &s, x[i]);
+	}
+	return Float64x2_add_d_d(p, s);
+}
+
+static void Float64x2_axpy_d_AVX512(fp64* p, fp64* s, const fp64* a, fp64 x, size_t n) {
+	const __m512d v_x = _mm512_set1_pd(x);
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		const __m512dx2 prod = _mm512x2_mul_pd_pd(_mm512_loadu_pd(&a[i]), v_x);
+		const __m512dx2 sum = _mm512x2_add_pd_pd(_mm512_loadu_pd(&p[i]), prod.hi);
+		_mm512_storeu_pd(&p[i], sum.hi);
+		_mm512_storeu_pd(&s[i], _mm512_add_pd(
+			_mm512_loadu_pd(&s[i]), _mm512_add_pd(sum.lo, prod.lo)
+		));
+	}
+	for (; i < n; i++) {
+		Float64x2_blas_dot2_step(&p[i], &s[i], a[i], x);
+	}
+}
+
+const Float64x2_blas_kernels Float64x2_blas_kernels_AVX512 = {
+	.dot     = Float64x2_dot_AVX512,
+	.axpy    = Float64x2_axpy_AVX512,
+	.scal    = Float64x2_scal_AVX512,
+	.sumsq   = Float64x2_sumsq_AVX512,
+	.asum    = Float64x2_asum_AVX512,
+	.iamax   = Float64x2_iamax_AVX512,
+	.rot     = Float64x2_rot_AVX512,
+	.gemm    = Float64x2_gemm_AVX512,
+	.gemm_mr = 8,
+	.gemm_nr = 4,
+	.dot_d   = Float64x2_dot_d_AVX512,
+	.sum_d   = Float64x2_sum_d_AVX512,
+	.axpy_d  = Float64x2_axpy_d_AVX512,
+};
+
+#endif
@@ -0,0 +1,308 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "../LDF/LDF_cpu_dispatch.h"
+
+/**
+ * @brief SSE2 kernels for Float64x2_blas.h
+ */
+
+#ifdef LDF_ENABLE_DISPATCH_SSE2
+
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__SSE2__)
+	#pragma GCC target("sse2")
+#endif
+
+#include "Float64x2_blas_kernels.h"
+#include "Float64x2_SSE2.h"
+#include "Float64x2.h"
+
+#include <emmintrin.h>
+
+//------------------------------------------------------------------------------
+// __m128dx2 BLAS kernels
+//------------------------------------------------------------------------------
+
+/** @brief Selects y where every bit of mask is set, otherwise x */
+static inline __m128dx2 Float64x2_blas_blend_SSE2(__m128dx2 x, __m128dx2 y, __m128d mask) {
+	x.hi = _internal_mm_blendv_pd(x.hi, y.hi, mask);
+	x.lo = _internal_mm_blendv_pd(x.lo, y.lo, mask);
+	return x;
+}
+
+/** @brief Adds the lanes of a vector in order */
+static inline Float64x2 Float64x2_blas_reduce_SSE2(const __m128dx2 x) {
+	Float64x2 lane[2];
+	_mm128x2_storeu_pdx2(lane, x);
+	Float64x2 sum = lane[0];
+	for (size_t j = 1; j < 2; j++) {
+		sum = Float64x2_add(sum, lane[j]);
+	}
+	return sum;
+}
+
+static Float64x2 Float64x2_dot_SSE2(const Float64x2* x, const Float64x2* y, size_t n) {
+	__m128dx2 sum = _mm128x2_setzero_pdx2();
+	size_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		sum = _mm128x2_add_pdx2(sum, _mm128x2_mul_pdx2(
+			_mm128x2_loadu_pdx2(&x[i]), _mm128x2_loadu_pdx2(&y[i])
+		));
+	}
+	Float64x2 ret = Float64x2_blas_reduce_SSE2(sum);
+	for (; i < n; i++) {
+		ret = Float64x2_add(ret, Float64x2_mul(x[i], y[i]));
+	}
+	return ret;
+}
+
+static void Float64x2_axpy_SSE2(Float64x2 alpha, const Float64x2* x, Float64x2* y, size_t n) {
+	const __m128dx2 v_alpha = _mm128x2_set1_pdx2(alpha);
+	size_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		_mm128x2_storeu_pdx2(&y[i], _mm128x2_add_pdx2(
+			_mm128x2_mul_pdx2(v_alpha, _mm128x2_loadu_pdx2(&x[i])),
+			_mm128x2_loadu_pdx2(&y[i])
+		));
+	}
+	for (; i < n; i++) {
+		y[i] = Float64x2_add(Float64x2_mul(alpha, x[i]), y[i]);
+	}
+}
+
+static void Float64x2_scal_SSE2(Float64x2 alpha, Float64x2* x, size_t n) {
+	const __m128dx2 v_alpha = _mm128x2_set1_pdx2(alpha);
+	size_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		_mm128x2_storeu_pdx2(&x[i], _mm128x2_mul_pdx2(v_alpha, _mm128x2_loadu_pdx2(&x[i])));
+	}
+	for (; i < n; i++) {
+		x[i] = Float64x2_mul(alpha, x[i]);
+	}
+}
+
+static Float64x2 Float64x2_sumsq_SSE2(const Float64x2* x, size_t n, fp64 scale) {
+	const __m128d v_scale = _mm_set1_pd(scale);
+	__m128dx2 sum = _mm128x2_setzero_pdx2();
+	size_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		sum = _mm128x2_add_pdx2(sum, _mm128x2_square_pdx2(
+			_mm128x2_mul_power2_pdx2_pd(_mm128x2_loadu_pdx2(&x[i]), v_scale)
+		));
+	}
+	Float64x2 ret = Float64x2_blas_reduce_SSE2(sum);
+	for (; i < n; i++) {
+		ret = Float64x2_add(ret, Float64x2_square(Float64x2_mul_power2_dx2_d(x[i], scale)));
+	}
+	return ret;
+}
+
+static Float64x2 Float64x2_asum_SSE2(const Float64x2* x, size_t n) {
+	__m128dx2 sum = _mm128x2_setzero_pdx2();
+	size_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		sum = _mm128x2_add_pdx2(sum, _mm128x2_fabs_pdx2(_mm128x2_loadu_pdx2(&x[i])));
+	}
+	Float64x2 ret = Float64x2_blas_reduce_SSE2(sum);
+	for (; i < n; i++) {
+		ret = Float64x2_add(ret, Float64x2_fabs(x[i]));
+	}
+	return ret;
+}
+
+/**
+ * @brief Each lane keeps its own maximum and index. The lanes are then
+ * merged, preferring the smallest index on ties, before the scalar tail.
+ */
+static size_t Float64x2_iamax_SSE2(const Float64x2* x, size_t n) {
+	Float64x2 ret_max = Float64x2_set_d(-1.0);
+	size_t ret_index = 0;
+	size_t i = 0;
+	if (n >= 2) {
+		__m128dx2 x_max = _mm128x2_set1_pd(-1.0);
+		__m128d index = _mm_setzero_pd();
+		__m128d lane_index = _mm_setr_pd(0.0, 1.0);
+		const __m128d lane_step = _mm_set1_pd(2.0);
+		for (; i + 2 <= n; i += 2) {
+			const __m128dx2 x_abs = _mm128x2_fabs_pdx2(_mm128x2_loadu_pdx2(&x[i]));
+			const __m128d cmp = _mm_cmpgt_pdx2(x_abs, x_max);
+			x_max = Float64x2_blas_blend_SSE2(x_max, x_abs, cmp);
+			index = _internal_mm_blendv_pd(index, lane_index, cmp);
+			lane_index = _mm_add_pd(lane_index, lane_step);
+		}
+		Float64x2 lane_max[2];
+		fp64 lane_pos[2];
+		_mm128x2_storeu_pdx2(lane_max, x_max);
+		_mm_storeu_pd(lane_pos, index);
+		for (size_t j = 0; j < 2; j++) {
+			const size_t pos = (size_t)lane_pos[j];
+			if (
+				Float64x2_cmpgt(lane_max[j], ret_max) ||
+				(Float64x2_cmpeq(lane_max[j], ret_max) && pos < ret_index)
+			) {
+				ret_max = lane_max[j];
+				ret_index = pos;
+			}
+		}
+	}
+	for (; i < n; i++) {
+		const Float64x2 x_abs = Float64x2_fabs(x[i]);
+		if (Float64x2_cmpgt(x_abs, ret_max)) {
+			ret_max = x_abs;
+			ret_index = i;
+		}
+	}
+	return ret_index;
+}
+
+static void Float64x2_rot_SSE2(Float64x2* x, Float64x2* y, size_t n, Float64x2 c, Float64x2 s) {
+	const __m128dx2 v_c = _mm128x2_set1_pdx2(c);
+	const __m128dx2 v_s = _mm128x2_set1_pdx2(s);
+	size_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		const __m128dx2 x_val = _mm128x2_loadu_pdx2(&x[i]);
+		const __m128dx2 y_val = _mm128x2_loadu_pdx2(&y[i]);
+		_mm128x2_storeu_pdx2(&x[i], _mm128x2_add_pdx2(
+			_mm128x2_mul_pdx2(v_c, x_val), _mm128x2_mul_pdx2(v_s, y_val)
+		));
+		_mm128x2_storeu_pdx2(&y[i], _mm128x2_sub_pdx2(
+			_mm128x2_mul_pdx2(v_c, y_val), _mm128x2_mul_pdx2(v_s, x_val)
+		));
+	}
+	for (; i < n; i++) {
+		const Float64x2 x_val = x[i];
+		const Float64x2 y_val = y[i];
+		x[i] = Float64x2_add(Float64x2_mul(c, x_val), Float64x2_mul(s, y_val));
+		y[i] = Float64x2_sub(Float64x2_mul(c, y_val), Float64x2_mul(s, x_val));
+	}
+}
+
+/**
+ * @brief Register-blocked 2 by 4 gemm tile. Each step of k is a
+ * broadcast of one element of B times a column of A.
+ */
+static void Float64x2_gemm_SSE2(
+	size_t k, const Float64x2* A, const Float64x2* B, Float64x2 alpha,
+	Float64x2* C, size_t ldc, size_t mr, size_t nr
+) {
+	__m128dx2 c0 = _mm128x2_setzero_pdx2();
+	__m128dx2 c1 = _mm128x2_setzero_pdx2();
+	__m128dx2 c2 = _mm128x2_setzero_pdx2();
+	__m128dx2 c3 = _mm128x2_setzero_pdx2();
+	for (size_t p = 0; p < k; p++) {
+		const __m128dx2 a_col = _mm128x2_loadu_pdx2(A);
+		c0 = _mm128x2_add_pdx2(c0, _mm128x2_mul_pdx2(a_col, _mm128x2_set1_pdx2(B[0])));
+		c1 = _mm128x2_add_pdx2(c1, _mm128x2_mul_pdx2(a_col, _mm128x2_set1_pdx2(B[1])));
+		c2 = _mm128x2_add_pdx2(c2, _mm128x2_mul_pdx2(a_col, _mm128x2_set1_pdx2(B[2])));
+		c3 = _mm128x2_add_pdx2(c3, _mm128x2_mul_pdx2(a_col, _mm128x2_set1_pdx2(B[3])));
+		A += 2;
+		B += 4;
+	}
+	const __m128dx2 v_alpha = _mm128x2_set1_pdx2(alpha);
+	Float64x2 tile[2 * 4];
+	_mm128x2_storeu_pdx2(&tile[0], _mm128x2_mul_pdx2(v_alpha, c0));
+	_mm128x2_storeu_pdx2(&tile[2], _mm128x2_mul_pdx2(v_alpha, c1));
+	_mm128x2_storeu_pdx2(&tile[4], _mm128x2_mul_pdx2(v_alpha, c2));
+	_mm128x2_storeu_pdx2(&tile[6], _mm128x2_mul_pdx2(v_alpha, c3));
+	for (size_t j = 0; j < nr; j++) {
+		for (size_t i = 0; i < mr; i++) {
+			C[i + j * ldc] = Float64x2_add(C[i + j * ldc], tile[i + j * 2]);
+		}
+	}
+}
+
+/**
+ * @brief Dot2 and Sum2 with one unnormalized sum per lane. The lanes are
+ * then merged with the scalar steps, in order, before the tail.
+ */
+static Float64x2 Float64x2_dot_d_SSE2(const fp64* x, const fp64* y, size_t n) {
+	__m128d sum_hi = _mm_setzero_pd();
+	__m128d sum_lo = _mm_setzero_pd();
+	size_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		const __m128dx2 prod = _mm128x2_mul_pd_pd(
+			_mm_loadu_pd(&x[i]), _mm_loadu_pd(&y[i])
+		);
+		const __m128dx2 sum = _mm128x2_add_pd_pd(sum_hi, prod.hi);
+		sum_hi = sum.hi;
+		sum_lo = _mm_add_pd(sum_lo, _mm_add_pd(sum.lo, prod.lo));
+	}
+	fp64 lane_hi[2];
+	fp64 lane_lo[2];
+	_mm_storeu_pd(lane_hi, sum_hi);
+	_mm_storeu_pd(lane_lo, sum_lo);
+	fp64 p = 0.0;
+	fp64 s = 0.0;
+	for (size_t j = 0; j < 2; j++) {
+		Float64x2_blas_sum2_step(&p, &s, lane_hi[j]);
+		s += lane_lo[j];
+	}
+	for (; i < n; i++) {
+		Float64x2_blas_dot2_step(&p, &s, x[i], y[i]);
+	}
+	return Float64x2_add_d_d(p, s);
+}
+
+static Float64x2 Float64x2_sum_d_SSE2(const fp64* x, size_t n) {
+	__m128d sum_hi = _mm_setzero_pd();
+	__m128d sum_lo = _mm_setzero_pd();
+	size_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		const __m128dx2 sum = _mm128x2_add_pd_pd(sum_hi, _mm_loadu_pd(&x[i]));
+		sum_hi = sum.hi;
+		sum_lo = _mm_add_pd(sum_lo, sum.lo);
+	}
+	fp64 lane_hi[2];
+	fp64 lane_lo[2];
+	_mm_storeu_pd(lane_hi, sum_hi);
+	_mm_storeu_pd(lane_lo, sum_lo);
+	fp64 p = 0.0;
+	fp64 s = 0.0;
+	for (size_t j = 0; j < 2; j++) {
+		Float64x2_blas_sum2_step(&p, &s, lane_hi[j]);
+		s += lane_lo[j];
+	}
+	for (; i < n; i++) {
+		Float64x2_blas_sum2_step(&p, &s, x[i]);
+	}
+	return Float64x2_add_d_d(p, s);
+}
+
+static void Float64x2_axpy_d_SSE2(fp64* p, fp64* s, const fp64* a, fp64 x, size_t n) {
+	const __m128d v_x = _mm_set1_pd(x);
+	size_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		const __m128dx2 prod = _mm128x2_mul_pd_pd(_mm_loadu_pd(&a[i]), v_x);
+		const __m128dx2 sum = _mm128x2_add_pd_pd(_mm_loadu_pd(&p[i]), prod.hi);
+		_mm_storeu_pd(&p[i], sum.hi);
+		_mm_storeu_pd(&s[i], _mm_add_pd(
+			_mm_loadu_pd(&s[i]), _mm_add_pd(sum.lo, prod.lo)
+		));
+	}
+	for (; i < n; i++) {
+		Float64x2_blas_dot2_step(&p[i], &s[i], a[i], x);
+	}
+}
+
+const Float64x2_blas_kernels Float64x2_blas_kernels_SSE2 = {
+	.dot     = Float64x2_dot_SSE2,
+	.axpy    = Float64x2_axpy_SSE2,
+	.scal    = Float64x2_scal_SSE2,
+	.sumsq   = Float64x2_sumsq_SSE2,
+	.asum    = Float64x2_asum_SSE2,
+	.iamax   = Float64x2_iamax_SSE2,
+	.rot     = Float64x2_rot_SSE2,
+	.gemm    = Float64x2_gemm_SSE2,
+	.gemm_mr = 2,
+	.gemm_nr = 4,
+	.dot_d   = Float64x2_dot_d_SSE2,
+	.sum_d   = Float64x2_sum_d_SSE2,
+	.axpy_d  = Float64x2_axpy_d_SSE2,
+};
+
+#endif
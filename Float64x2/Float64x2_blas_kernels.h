@@ -0,0 +1,130 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#ifndef FLOAT64X2_BLAS_KERNELS_H
+#define FLOAT64X2_BLAS_KERNELS_H
+
+/**
+ * @brief Internal table of the contiguous Float64x2_blas.h kernels. Each
+ * Float64x2_blas_<ISA>.c file provides one table.
+ *
+ * @note NULL entries fall back to the next lower level, and then to the
+ * scalar loops in Float64x2_blas.c.
+ */
+
+#include "Float64x2_def.h"
+#include "Float64x2.h"
+#include "../LDF/LDF_cpu_dispatch.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+/**
+ * @brief One step of Dot2 from Ogita, Rump, and Oishi. The sum is kept
+ * unnormalized as *p + *s until Float64x2_add_d_d(p, s) at the end.
+ */
+static inline void Float64x2_blas_dot2_step(fp64* p, fp64* s, fp64 x, fp64 y) {
+	const Float64x2 prod = Float64x2_mul_d_d(x, y);
+	const Float64x2 sum = Float64x2_add_d_d(*p, prod.hi);
+	*p = sum.hi;
+	*s += sum.lo + prod.lo;
+}
+
+/** @brief One step of Sum2 from Ogita, Rump, and Oishi */
+static inline void Float64x2_blas_sum2_step(fp64* p, fp64* s, fp64 x) {
+	const Float64x2 sum = Float64x2_add_d_d(*p, x);
+	*p = sum.hi;
+	*s += sum.lo;
+}
+
+typedef Float64x2 (*Float64x2_blas_dot_func)(
+	const Float64x2* x, const Float64x2* y, size_t n
+);
+
+typedef void (*Float64x2_blas_axpy_func)(
+	Float64x2 alpha, const Float64x2* x, Float64x2* y, size_t n
+);
+
+typedef void (*Float64x2_blas_scal_func)(Float64x2 alpha, Float64x2* x, size_t n);
+
+/** @brief Returns the sum of (x[i] * scale)^2, where scale is a power of two */
+typedef Float64x2 (*Float64x2_blas_sumsq_func)(
+	const Float64x2* x, size_t n, fp64 scale
+);
+
+typedef Float64x2 (*Float64x2_blas_asum_func)(const Float64x2* x, size_t n);
+
+typedef size_t (*Float64x2_blas_iamax_func)(const Float64x2* x, size_t n);
+
+typedef void (*Float64x2_blas_rot_func)(
+	Float64x2* x, Float64x2* y, size_t n, Float64x2 c, Float64x2 s
+);
+
+/**
+ * @brief C += alpha * A * B for one gemm_mr by gemm_nr tile of C, which is
+ * column-major. A is a packed sliver of k columns of gemm_mr rows, and B is
+ * a packed sliver of k rows of gemm_nr columns. Only the top-left mr by nr
+ * part of the tile is written.
+ */
+typedef void (*Float64x2_blas_gemm_func)(
+	size_t k, const Float64x2* A, const Float64x2* B, Float64x2 alpha,
+	Float64x2* C, size_t ldc, size_t mr, size_t nr
+);
+
+typedef Float64x2 (*Float64x2_blas_dot_d_func)(
+	const fp64* x, const fp64* y, size_t n
+);
+
+typedef Float64x2 (*Float64x2_blas_sum_d_func)(const fp64* x, size_t n);
+
+/**
+ * @brief Dot2 steps for a column of gemv_d: (p[i] + s[i]) += a[i] * x
+ */
+typedef void (*Float64x2_blas_axpy_d_func)(
+	fp64* p, fp64* s, const fp64* a, fp64 x, size_t n
+);
+
+typedef struct Float64x2_blas_kernels {
+	Float64x2_blas_dot_func dot;
+	Float64x2_blas_axpy_func axpy;
+	Float64x2_blas_scal_func scal;
+	Float64x2_blas_sumsq_func sumsq;
+	Float64x2_blas_asum_func asum;
+	Float64x2_blas_iamax_func iamax;
+	Float64x2_blas_rot_func rot;
+	Float64x2_blas_gemm_func gemm;
+	/** rows of the gemm micro-kernel tile */
+	size_t gemm_mr;
+	/** columns of the gemm micro-kernel tile */
+	size_t gemm_nr;
+	Float64x2_blas_dot_d_func dot_d;
+	Float64x2_blas_sum_d_func sum_d;
+	Float64x2_blas_axpy_d_func axpy_d;
+} Float64x2_blas_kernels;
+
+#ifdef LDF_ENABLE_DISPATCH_SSE2
+	extern const Float64x2_blas_kernels Float64x2_blas_kernels_SSE2;
+#endif
+#ifdef LDF_ENABLE_DISPATCH_AVX
+	extern const Float64x2_blas_kernels Float64x2_blas_kernels_AVX;
+#endif
+#ifdef LDF_ENABLE_DISPATCH_AVX2_FMA
+	extern const Float64x2_blas_kernels Float64x2_blas_kernels_AVX2_FMA;
+#endif
+#ifdef LDF_ENABLE_DISPATCH_AVX512
+	extern const Float64x2_blas_kernels Float64x2_blas_kernels_AVX512;
+#endif
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* FLOAT64X2_BLAS_KERNELS_H */
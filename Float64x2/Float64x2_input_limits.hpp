@@ -23,10 +23,10 @@ template<> inline constexpr fp64 exp_max<Float64x2, fp64>() {
 }
 
 template<> inline constexpr fp64 expm1_min<Float64x2, fp64>() {
-	return static_cast<fp64>(709.79);
+	return static_cast<fp64>(-709.79);
 }
 template<> inline constexpr fp64 expm1_max<Float64x2, fp64>() {
-	return static_cast<fp64>(-709.79);
+	return static_cast<fp64>(709.79);
 }
 
 /** @brief ~27.226017 */
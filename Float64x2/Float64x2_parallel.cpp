@@ -0,0 +1,121 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "Float64x2_parallel.hpp"
+#include "Float64x2.hpp"
+
+#include <cmath>
+
+namespace LDF {
+
+/** @brief Returns the index of the first element of a strided array */
+static inline ptrdiff_t Float64x2_parallel_start(size_t n, ptrdiff_t inc) {
+	return (inc < 0) ? (ptrdiff_t)(n - 1) * -inc : 0;
+}
+
+static Float64x2 Float64x2_parallel_add(Float64x2 x, Float64x2 y) {
+	return x + y;
+}
+
+/**
+ * @brief Each block uses four accumulators, which element i of the block
+ * always goes to accumulator i % 4.
+ */
+static Float64x2 Float64x2_parallel_combine(const Float64x2 acc[4]) {
+	return (acc[0] + acc[1]) + (acc[2] + acc[3]);
+}
+
+Float64x2 parallel_sum(
+	size_t n, const Float64x2* x, ptrdiff_t incx, Thread_Pool& pool
+) {
+	const Float64x2 zero = static_cast<Float64x2>(0.0);
+	const ptrdiff_t start = Float64x2_parallel_start(n, incx);
+	return reproducible_reduce(pool, n, zero,
+		[&](size_t begin, size_t end) {
+			Float64x2 acc[4] = {zero, zero, zero, zero};
+			const Float64x2* ptr = x + start + (ptrdiff_t)begin * incx;
+			for (size_t i = 0; i < end - begin; i++) {
+				acc[i % 4] += *ptr;
+				ptr += incx;
+			}
+			return Float64x2_parallel_combine(acc);
+		},
+		Float64x2_parallel_add
+	);
+}
+
+Float64x2 parallel_dot(
+	size_t n, const Float64x2* x, ptrdiff_t incx, const Float64x2* y, ptrdiff_t incy,
+	Thread_Pool& pool
+) {
+	const Float64x2 zero = static_cast<Float64x2>(0.0);
+	const ptrdiff_t start_x = Float64x2_parallel_start(n, incx);
+	const ptrdiff_t start_y = Float64x2_parallel_start(n, incy);
+	return reproducible_reduce(pool, n, zero,
+		[&](size_t begin, size_t end) {
+			Float64x2 acc[4] = {zero, zero, zero, zero};
+			const Float64x2* ptr_x = x + start_x + (ptrdiff_t)begin * incx;
+			const Float64x2* ptr_y = y + start_y + (ptrdiff_t)begin * incy;
+			for (size_t i = 0; i < end - begin; i++) {
+				acc[i % 4] += (*ptr_x) * (*ptr_y);
+				ptr_x += incx;
+				ptr_y += incy;
+			}
+			return Float64x2_parallel_combine(acc);
+		},
+		Float64x2_parallel_add
+	);
+}
+
+Float64x2 parallel_nrm2(
+	size_t n, const Float64x2* x, ptrdiff_t incx, Thread_Pool& pool
+) {
+	const Float64x2 zero = static_cast<Float64x2>(0.0);
+	const ptrdiff_t start = Float64x2_parallel_start(n, incx);
+	/* The maximum is exact, so it does not depend on the order either */
+	const fp64 x_max = reproducible_reduce(pool, n, 0.0,
+		[&](size_t begin, size_t end) {
+			fp64 block_max = 0.0;
+			const Float64x2* ptr = x + start + (ptrdiff_t)begin * incx;
+			for (size_t i = 0; i < end - begin; i++) {
+				block_max = std::fmax(block_max, std::fabs(ptr->hi));
+				ptr += incx;
+			}
+			return block_max;
+		},
+		[](fp64 a, fp64 b) { return std::fmax(a, b); }
+	);
+	if (std::isinf(x_max)) {
+		return static_cast<Float64x2>(x_max);
+	}
+	/* Same margins as Float64x2_nrm2 */
+	fp64 scale = 1.0;
+	fp64 unscale = 1.0;
+	if (x_max >= 0x1.0p+480) {
+		scale = 0x1.0p-600;
+		unscale = 0x1.0p+600;
+	} else if (x_max <= 0x1.0p-480) {
+		scale = 0x1.0p+600;
+		unscale = 0x1.0p-600;
+	}
+	const Float64x2 sum = reproducible_reduce(pool, n, zero,
+		[&](size_t begin, size_t end) {
+			Float64x2 acc[4] = {zero, zero, zero, zero};
+			const Float64x2* ptr = x + start + (ptrdiff_t)begin * incx;
+			for (size_t i = 0; i < end - begin; i++) {
+				acc[i % 4] += square(mul_pwr2(*ptr, scale));
+				ptr += incx;
+			}
+			return Float64x2_parallel_combine(acc);
+		},
+		Float64x2_parallel_add
+	);
+	return mul_pwr2(sqrt(sum), unscale);
+}
+
+} /* LIB-Dekker-Float namespace */
@@ -0,0 +1,78 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#ifndef FLOAT64X2_POLYNOMIAL_HPP
+#define FLOAT64X2_POLYNOMIAL_HPP
+
+/**
+ * @brief LDF::Polynomial_Traits for Float64x2, and for __m256dx2 when AVX is enabled,
+ * so that a Split_Polynomial<Float64x2> can be evaluated four values at a time.
+ */
+
+#include "Float64x2.hpp"
+#include "../LDF/LDF_polynomial.hpp"
+
+#ifdef __AVX__
+	#include "Float64x2_AVX.h"
+#endif
+
+/* LIB-Dekker-Float namespace */
+namespace LDF {
+
+template<> struct Polynomial_Traits<Float64x2> {
+	typedef Float64x2 Float_Type;
+	static Float64x2 zero() {
+		return static_cast<Float64x2>(0.0);
+	}
+	static Float64x2 load(const fp64* data, size_t count, size_t i) {
+		return {data[i], data[count + i]};
+	}
+	static Float64x2 add(const Float64x2& x, const Float64x2& y) {
+		return x + y;
+	}
+	static Float64x2 mul(const Float64x2& x, const Float64x2& y) {
+		return x * y;
+	}
+	static Float64x2 square(const Float64x2& x) {
+		return ::square(x);
+	}
+	static Float64x2 div(const Float64x2& x, const Float64x2& y) {
+		return x / y;
+	}
+};
+
+#ifdef __AVX__
+template<> struct Polynomial_Traits<__m256dx2> {
+	typedef Float64x2 Float_Type;
+	static __m256dx2 zero() {
+		return _mm256x2_setzero_pdx2();
+	}
+	static __m256dx2 load(const fp64* data, size_t count, size_t i) {
+		__m256dx2 ret;
+		ret.hi = _mm256_broadcast_sd(&data[i]);
+		ret.lo = _mm256_broadcast_sd(&data[count + i]);
+		return ret;
+	}
+	static __m256dx2 add(const __m256dx2& x, const __m256dx2& y) {
+		return _mm256x2_add_pdx2(x, y);
+	}
+	static __m256dx2 mul(const __m256dx2& x, const __m256dx2& y) {
+		return _mm256x2_mul_pdx2(x, y);
+	}
+	static __m256dx2 square(const __m256dx2& x) {
+		return _mm256x2_square_pdx2(x);
+	}
+	static __m256dx2 div(const __m256dx2& x, const __m256dx2& y) {
+		return _mm256x2_div_pdx2(x, y);
+	}
+};
+#endif
+
+} /* LIB-Dekker-Float namespace */
+
+#endif /* FLOAT64X2_POLYNOMIAL_HPP */
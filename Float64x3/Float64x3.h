@@ -2344,11 +2344,11 @@ static inline int Float64x3_ilogb(const Float64x3 x) {
  * the form [0.5, 1.0) * 2^expon
  */
 static inline Float64x3 Float64x3_frexp(const Float64x3 x, int* const expon) {
-	Float64x3 ret = {
+	Float64x3 ret = {{
 		frexp(x.val[0], expon),
 		0.0,
 		0.0
-	};
+	}};
 	if (Float64x3_isfinite(x)) {
 		ret.val[1] = ldexp(x.val[1], -(*expon));
 		ret.val[2] = ldexp(x.val[2], -(*expon));
@@ -2449,6 +2449,10 @@ Float64x3 Float64x3_sin(Float64x3 x);
 Float64x3 Float64x3_cos(Float64x3 x);
 void Float64x3_sincos(Float64x3 x, Float64x3* LDF_restrict p_sin, Float64x3* LDF_restrict p_cos);
 Float64x3 Float64x3_tan(Float64x3 x);
+Float64x3 Float64x3_sinpi(Float64x3 x);
+Float64x3 Float64x3_cospi(Float64x3 x);
+void Float64x3_sincospi(Float64x3 x, Float64x3* LDF_restrict p_sin, Float64x3* LDF_restrict p_cos);
+Float64x3 Float64x3_tanpi(Float64x3 x);
 Float64x3 Float64x3_asin(Float64x3 x);
 Float64x3 Float64x3_acos(Float64x3 x);
 Float64x3 Float64x3_atan(Float64x3 x);
@@ -1236,6 +1236,14 @@ namespace std {
 		sincos(x, sin_val, cos_val);
 		return sin_val / cos_val;
 	}
+	Float64x3 sinpi(const Float64x3& x);
+	Float64x3 cospi(const Float64x3& x);
+	void sincospi(const Float64x3& x, Float64x3& p_sin, Float64x3& p_cos);
+	inline Float64x3 tanpi(const Float64x3& x) {
+		Float64x3 sin_val, cos_val;
+		sincospi(x, sin_val, cos_val);
+		return sin_val / cos_val;
+	}
 	Float64x3 asin (const Float64x3& x);
 	Float64x3 acos (const Float64x3& x);
 	Float64x3 atan (const Float64x3& x);
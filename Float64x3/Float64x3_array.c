@@ -0,0 +1,50 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "Float64x3_array.h"
+#include "Float64x3.h"
+
+#define FLOAT64X3_ARRAY_SCALAR_UNARY(name, func) \
+void Float64x3_##name##_array(const Float64x3* in, Float64x3* out, size_t n) { \
+	for (size_t i = 0; i < n; i++) { \
+		out[i] = func(in[i]); \
+	} \
+}
+
+#define FLOAT64X3_ARRAY_SCALAR_BINARY(name, func) \
+void Float64x3_##name##_array( \
+	const Float64x3* x, const Float64x3* y, Float64x3* out, size_t n \
+) { \
+	for (size_t i = 0; i < n; i++) { \
+		out[i] = func(x[i], y[i]); \
+	} \
+}
+
+//------------------------------------------------------------------------------
+// Float64x3 array functions
+//------------------------------------------------------------------------------
+
+FLOAT64X3_ARRAY_SCALAR_BINARY(add, Float64x3_add)
+FLOAT64X3_ARRAY_SCALAR_BINARY(sub, Float64x3_sub)
+FLOAT64X3_ARRAY_SCALAR_BINARY(mul, Float64x3_mul)
+FLOAT64X3_ARRAY_SCALAR_BINARY(div, Float64x3_div)
+FLOAT64X3_ARRAY_SCALAR_BINARY(copysign, Float64x3_copysign)
+FLOAT64X3_ARRAY_SCALAR_BINARY(fdim, Float64x3_fdim)
+FLOAT64X3_ARRAY_SCALAR_BINARY(fmod, Float64x3_fmod)
+FLOAT64X3_ARRAY_SCALAR_BINARY(remainder, Float64x3_remainder)
+FLOAT64X3_ARRAY_SCALAR_UNARY(fabs, Float64x3_fabs)
+FLOAT64X3_ARRAY_SCALAR_UNARY(sqrt, Float64x3_sqrt)
+FLOAT64X3_ARRAY_SCALAR_UNARY(cbrt, Float64x3_cbrt)
+FLOAT64X3_ARRAY_SCALAR_UNARY(floor, Float64x3_floor)
+FLOAT64X3_ARRAY_SCALAR_UNARY(ceil, Float64x3_ceil)
+FLOAT64X3_ARRAY_SCALAR_UNARY(trunc, Float64x3_trunc)
+FLOAT64X3_ARRAY_SCALAR_UNARY(round, Float64x3_round)
+FLOAT64X3_ARRAY_SCALAR_UNARY(rint, Float64x3_rint)
+
+#undef FLOAT64X3_ARRAY_SCALAR_UNARY
+#undef FLOAT64X3_ARRAY_SCALAR_BINARY
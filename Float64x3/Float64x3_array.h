@@ -0,0 +1,184 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#ifndef FLOAT64X3_ARRAY_H
+#define FLOAT64X3_ARRAY_H
+
+/**
+ * @brief Element-wise functions over arrays of Float64x3.
+ *
+ * @note Float64x3 does not have a SIMD implementation yet, so these are
+ * scalar loops. They share the same interface as Float64x2_array.h and
+ * Float64x4_array.h so that code can switch between the types.
+ *
+ * @note The arrays do not need to be aligned. `out` may be the same array as
+ * an input, but the arrays must not otherwise overlap.
+ */
+
+#include "Float64x3_def.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+//------------------------------------------------------------------------------
+// Float64x3 array arithmetic
+//------------------------------------------------------------------------------
+
+/** @brief out[i] = x[i] + y[i] */
+void Float64x3_add_array(
+	const Float64x3* x, const Float64x3* y, Float64x3* out, size_t n
+);
+
+/** @brief out[i] = x[i] - y[i] */
+void Float64x3_sub_array(
+	const Float64x3* x, const Float64x3* y, Float64x3* out, size_t n
+);
+
+/** @brief out[i] = x[i] * y[i] */
+void Float64x3_mul_array(
+	const Float64x3* x, const Float64x3* y, Float64x3* out, size_t n
+);
+
+/** @brief out[i] = x[i] / y[i] */
+void Float64x3_div_array(
+	const Float64x3* x, const Float64x3* y, Float64x3* out, size_t n
+);
+
+//------------------------------------------------------------------------------
+// Float64x3 array math.h functions
+//------------------------------------------------------------------------------
+
+/** @brief out[i] = copysign(x[i], y[i]) */
+void Float64x3_copysign_array(
+	const Float64x3* x, const Float64x3* y, Float64x3* out, size_t n
+);
+
+/** @brief out[i] = fdim(x[i], y[i]) */
+void Float64x3_fdim_array(
+	const Float64x3* x, const Float64x3* y, Float64x3* out, size_t n
+);
+
+/** @brief out[i] = fmod(x[i], y[i]) */
+void Float64x3_fmod_array(
+	const Float64x3* x, const Float64x3* y, Float64x3* out, size_t n
+);
+
+/** @brief out[i] = remainder(x[i], y[i]) */
+void Float64x3_remainder_array(
+	const Float64x3* x, const Float64x3* y, Float64x3* out, size_t n
+);
+
+/** @brief out[i] = fabs(in[i]) */
+void Float64x3_fabs_array(const Float64x3* in, Float64x3* out, size_t n);
+
+/** @brief out[i] = sqrt(in[i]) */
+void Float64x3_sqrt_array(const Float64x3* in, Float64x3* out, size_t n);
+
+/** @brief out[i] = cbrt(in[i]) */
+void Float64x3_cbrt_array(const Float64x3* in, Float64x3* out, size_t n);
+
+//------------------------------------------------------------------------------
+// Float64x3 array rounding
+//------------------------------------------------------------------------------
+
+/** @brief out[i] = floor(in[i]) */
+void Float64x3_floor_array(const Float64x3* in, Float64x3* out, size_t n);
+
+/** @brief out[i] = ceil(in[i]) */
+void Float64x3_ceil_array(const Float64x3* in, Float64x3* out, size_t n);
+
+/** @brief out[i] = trunc(in[i]) */
+void Float64x3_trunc_array(const Float64x3* in, Float64x3* out, size_t n);
+
+/** @brief out[i] = round(in[i]) */
+void Float64x3_round_array(const Float64x3* in, Float64x3* out, size_t n);
+
+/** @brief out[i] = rint(in[i]) */
+void Float64x3_rint_array(const Float64x3* in, Float64x3* out, size_t n);
+
+#ifdef __cplusplus
+	}
+#endif
+
+#ifdef __cplusplus
+
+//------------------------------------------------------------------------------
+// Float64x3 array C++ overloads
+//------------------------------------------------------------------------------
+
+inline void add_array(
+	const Float64x3* x, const Float64x3* y, Float64x3* out, size_t n
+) {
+	Float64x3_add_array(x, y, out, n);
+}
+inline void sub_array(
+	const Float64x3* x, const Float64x3* y, Float64x3* out, size_t n
+) {
+	Float64x3_sub_array(x, y, out, n);
+}
+inline void mul_array(
+	const Float64x3* x, const Float64x3* y, Float64x3* out, size_t n
+) {
+	Float64x3_mul_array(x, y, out, n);
+}
+inline void div_array(
+	const Float64x3* x, const Float64x3* y, Float64x3* out, size_t n
+) {
+	Float64x3_div_array(x, y, out, n);
+}
+inline void copysign_array(
+	const Float64x3* x, const Float64x3* y, Float64x3* out, size_t n
+) {
+	Float64x3_copysign_array(x, y, out, n);
+}
+inline void fdim_array(
+	const Float64x3* x, const Float64x3* y, Float64x3* out, size_t n
+) {
+	Float64x3_fdim_array(x, y, out, n);
+}
+inline void fmod_array(
+	const Float64x3* x, const Float64x3* y, Float64x3* out, size_t n
+) {
+	Float64x3_fmod_array(x, y, out, n);
+}
+inline void remainder_array(
+	const Float64x3* x, const Float64x3* y, Float64x3* out, size_t n
+) {
+	Float64x3_remainder_array(x, y, out, n);
+}
+inline void fabs_array(const Float64x3* in, Float64x3* out, size_t n) {
+	Float64x3_fabs_array(in, out, n);
+}
+inline void sqrt_array(const Float64x3* in, Float64x3* out, size_t n) {
+	Float64x3_sqrt_array(in, out, n);
+}
+inline void cbrt_array(const Float64x3* in, Float64x3* out, size_t n) {
+	Float64x3_cbrt_array(in, out, n);
+}
+inline void floor_array(const Float64x3* in, Float64x3* out, size_t n) {
+	Float64x3_floor_array(in, out, n);
+}
+inline void ceil_array(const Float64x3* in, Float64x3* out, size_t n) {
+	Float64x3_ceil_array(in, out, n);
+}
+inline void trunc_array(const Float64x3* in, Float64x3* out, size_t n) {
+	Float64x3_trunc_array(in, out, n);
+}
+inline void round_array(const Float64x3* in, Float64x3* out, size_t n) {
+	Float64x3_round_array(in, out, n);
+}
+inline void rint_array(const Float64x3* in, Float64x3* out, size_t n) {
+	Float64x3_rint_array(in, out, n);
+}
+
+#endif
+
+#endif /* FLOAT64X3_ARRAY_H */
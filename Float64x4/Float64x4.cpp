@@ -24,10 +24,34 @@
 #include "Float64x4_def.h"
 #include "Float64x4_string.h"
 #include "../Float64x6/Float64x6.hpp"
+#include "../LDF/LDF_trig_reduce.hpp"
 
 #include <cmath>
 #include <limits>
 
+/**
+ * @brief Exports the look up tables used by Float64x4_AVX.c, since
+ * Float64x4_LUT.hpp can only be included from C++.
+ */
+extern "C" {
+	extern const Float64x4* const Float64x4_LUT_inv_fact;
+	extern const Float64x4* const Float64x4_LUT_inv_fact_odd;
+	extern const Float64x4* const Float64x4_LUT_sin_table;
+	extern const Float64x4* const Float64x4_LUT_cos_table;
+	extern const Float64x4* const Float64x4_LUT_exp2_table;
+	extern const fp64* const Float64x4_LUT_log_table_invc;
+	extern const Float64x4* const Float64x4_LUT_log_table_log;
+	extern const Float64x4* const Float64x4_LUT_log_inv_odd;
+	const Float64x4* const Float64x4_LUT_inv_fact = inv_fact;
+	const Float64x4* const Float64x4_LUT_inv_fact_odd = inv_fact_odd;
+	const Float64x4* const Float64x4_LUT_sin_table = sin_table;
+	const Float64x4* const Float64x4_LUT_cos_table = cos_table;
+	const Float64x4* const Float64x4_LUT_exp2_table = exp2_table;
+	const fp64* const Float64x4_LUT_log_table_invc = log_table_invc;
+	const Float64x4* const Float64x4_LUT_log_table_log = log_table_log;
+	const Float64x4* const Float64x4_LUT_log_inv_odd = log_inv_odd;
+}
+
 //------------------------------------------------------------------------------
 // Float64x4 Logarithms and Exponents
 //------------------------------------------------------------------------------
@@ -86,10 +110,69 @@ static inline Float64x4 taylor_expm1(const Float64x4& x, fp64& m) {
 	return s;
 }
 
+/**
+ * @brief Computes exp(x) / 2^m with a table of 2^(j / 256).
+ *
+ * @remarks x is reduced to (256m + j) * ln(2) / 256 + r, where
+ * |r| <= ln(2) / 512, so that exp(x) = 2^m * 2^(j / 256) * exp(r). The Taylor
+ * series of expm1(r) needs terms up to r^18. The terms after r^9 are smaller
+ * than 2^-116 and are summed in Float64x2, and the terms after r^13 are
+ * smaller than 2^-169 and are summed in fp64. This replaces the sixteen serial
+ * squarings of taylor_expm1 with a single multiplication by the table.
+ *
+ * r is reduced with a five part ln(2) / 256, which avoids the error of
+ * rounding ln(2) to Float64x4 when k is large.
+ */
+static inline Float64x4 table_exp(const Float64x4& x, int& m) {
+	const fp64 k = std::floor(
+		x.val[0] * (static_cast<fp64>(exp2_table_size) * LDF::const_log2e<fp64>()) +
+		static_cast<fp64>(0.5)
+	);
+	Float64x4 r = x - k * exp2_ln2_split[0];
+	r -= LDF::mul<Float64x2, fp64, fp64>(k, exp2_ln2_split[1]);
+	r -= LDF::mul<Float64x2, fp64, fp64>(k, exp2_ln2_split[2]);
+	r -= LDF::mul<Float64x2, fp64, fp64>(k, exp2_ln2_split[3]);
+	r -= k * exp2_ln2_split[4];
+	const int k_int = static_cast<int>(k);
+	const int j = k_int & (exp2_table_size - 1);
+	m = (k_int - j) / exp2_table_size;
+
+	/* 1/14! + r/15! + ... + r^4/18! */
+	fp64 tail = inv_fact[15].val[0];
+	tail = tail * r.val[0] + inv_fact[14].val[0];
+	tail = tail * r.val[0] + inv_fact[13].val[0];
+	tail = tail * r.val[0] + inv_fact[12].val[0];
+	tail = tail * r.val[0] + inv_fact[11].val[0];
+
+	/* 1/10! + r/11! + ... + r^8/18! */
+	const Float64x2 r2 = {r.val[0], r.val[1]};
+	Float64x2 q = Float64x2{inv_fact[10].val[0], inv_fact[10].val[1]} + r2 * tail;
+	q = Float64x2{inv_fact[9].val[0], inv_fact[9].val[1]} + r2 * q;
+	q = Float64x2{inv_fact[8].val[0], inv_fact[8].val[1]} + r2 * q;
+	q = Float64x2{inv_fact[7].val[0], inv_fact[7].val[1]} + r2 * q;
+
+	/* 1/2! + r/3! + ... + r^16/18! */
+	Float64x4 p = inv_fact[6] + LDF::mul<Float64x4, Float64x4, Float64x2>(r, q);
+	p = inv_fact[5] + r * p;
+	p = inv_fact[4] + r * p;
+	p = inv_fact[3] + r * p;
+	p = inv_fact[2] + r * p;
+	p = inv_fact[1] + r * p;
+	p = inv_fact[0] + r * p;
+	p = static_cast<fp64>(0.5) + r * p;
+
+	const Float64x4 expm1_r = r + square(r) * p;
+	return exp2_table[j] + exp2_table[j] * expm1_r;
+}
+
 Float64x4 exp(const Float64x4& x) {
 	if (x.val[0] <= static_cast<fp64>(-709.79)) {
-		// Gives a better approximation near extreme values
-		return exp(x.val[0]);
+		/**
+		 * Gives a better approximation near extreme values. The result is
+		 * subnormal, so exp(x.val[1]) = 1 + x.val[1] is enough, but x.val[1]
+		 * would be lost if it were added after rounding.
+		 */
+		return exp(x.val[0]) * (static_cast<fp64>(1.0) + x.val[1]);
 	}
 	/* ln(2^1023 * (1 + (1 - 2^-52)))) = ~709.782712893 */
 	if (x.val[0] >= static_cast<fp64>(709.79)) {
@@ -105,10 +188,9 @@ Float64x4 exp(const Float64x4& x) {
 		return LDF::const_inv_e<Float64x4>();
 	}
 
-	fp64 m;
-	Float64x4 ret = taylor_expm1(x, m);
-	ret += static_cast<fp64>(1.0);
-	return ldexp(ret, static_cast<int>(m));
+	int m;
+	Float64x4 ret = table_exp(x, m);
+	return ldexp(ret, m);
 }
 
 Float64x4 expm1(const Float64x4& x) {
@@ -122,13 +204,13 @@ Float64x4 expm1(const Float64x4& x) {
 		return static_cast<Float64x4>(0.0);
 	}
 
-	fp64 m;
-	Float64x4 ret = taylor_expm1(x, m);
 	if (fabs(x) < mul_pwr2(static_cast<fp64>(0.5), LDF::const_ln2<Float64x4>())) {
-		return ret; // expm1 to higher accuracy
+		fp64 m;
+		return taylor_expm1(x, m); // expm1 to higher accuracy
 	}
-	ret += static_cast<fp64>(1.0);
-	ret = ldexp(ret, static_cast<int>(m));
+	int m;
+	Float64x4 ret = table_exp(x, m);
+	ret = ldexp(ret, m);
 	return ret - static_cast<fp64>(1.0); // expm1 to standard accuracy
 }
 
@@ -167,12 +249,69 @@ Float64x4 log(const Float64x4& x) {
 		return std::numeric_limits<Float64x4>::quiet_NaN();
 	}
 
-	Float64x4 guess = std::log(x.val[0]);   /* Initial approximation */
+	if (!isfinite(x)) {
+		return x;
+	}
 
-	guess = guess.val[0] + x * exp(-guess) - static_cast<fp64>(1.0);
-	guess = guess + x * exp(-guess) - static_cast<fp64>(1.0);
-	guess = guess + x * exp(-guess) - static_cast<fp64>(1.0);
-	return guess;
+	/**
+	 * x = 2^e * m, where m is in [sqrt(0.5), sqrt(2)]. m is multiplied by
+	 * invc ~= 1 / c from the table, where c = i / 128 is the closest point to m,
+	 * so that r = m * invc - 1 is smaller than 2^-7.5. The products are exact,
+	 * and m.val[0] * invc - 1 is exact since it is near 1, so r has no
+	 * cancellation error. When m is within 2^-7 of 1, c = 1 is used instead,
+	 * since -log(invc) and log1p(r) would have opposite signs and cancel.
+	 */
+	int e = ilogb(x.val[0]);
+	Float64x4 m = ldexp(x, -e);
+	if (m.val[0] > LDF::const_sqrt2<fp64>()) {
+		m = mul_pwr2(m, static_cast<fp64>(0.5));
+		e++;
+	}
+	int i = static_cast<int>(
+		m.val[0] * static_cast<fp64>(1 << log_table_bits) + static_cast<fp64>(0.5)
+	) - log_table_offset;
+	if (std::fabs(m.val[0] - static_cast<fp64>(1.0)) < static_cast<fp64>(0x1.0p-7)) {
+		i = (1 << log_table_bits) - log_table_offset;
+	}
+	const fp64 invc = log_table_invc[i];
+	const Float64x2 p_0 = LDF::mul<Float64x2, fp64, fp64>(m.val[0], invc);
+	Float64x4 r = static_cast<Float64x4>(
+		LDF::add<Float64x2, fp64, fp64>(p_0.hi - static_cast<fp64>(1.0), p_0.lo)
+	);
+	r += LDF::mul<Float64x2, fp64, fp64>(m.val[1], invc);
+	r += LDF::mul<Float64x2, fp64, fp64>(m.val[2], invc);
+	r += m.val[3] * invc;
+
+	/**
+	 * log(1 + r) = 2 * atanh(s), where s = r / (2 + r) is smaller than 2^-8.
+	 * atanh(s) / s = 1 + s^2/3 + s^4/5 + ... The terms after s^12/13 are smaller
+	 * than 2^-112 and are summed in Float64x2, and the terms after s^18/19 are
+	 * smaller than 2^-160 and are summed in fp64.
+	 * 2 * s = r - r * s, so log(1 + r) = r - r * s + 2 * s^3 * (1/3 + ...).
+	 * r is exact, which keeps the rounding error of the division in the
+	 * terms that are at most 2^-8 of the result.
+	 */
+	const Float64x4 s = r / (static_cast<fp64>(2.0) + r);
+	const Float64x4 z = square(s);
+	fp64 tail = log_inv_odd[12].val[0];
+	tail = tail * z.val[0] + log_inv_odd[11].val[0];
+	tail = tail * z.val[0] + log_inv_odd[10].val[0];
+	tail = tail * z.val[0] + log_inv_odd[9].val[0];
+
+	const Float64x2 z2 = {z.val[0], z.val[1]};
+	Float64x2 q = Float64x2{log_inv_odd[8].val[0], log_inv_odd[8].val[1]} + z2 * tail;
+	q = Float64x2{log_inv_odd[7].val[0], log_inv_odd[7].val[1]} + z2 * q;
+	q = Float64x2{log_inv_odd[6].val[0], log_inv_odd[6].val[1]} + z2 * q;
+
+	Float64x4 p = log_inv_odd[5] + LDF::mul<Float64x4, Float64x4, Float64x2>(z, q);
+	p = log_inv_odd[4] + z * p;
+	p = log_inv_odd[3] + z * p;
+	p = log_inv_odd[2] + z * p;
+	p = log_inv_odd[1] + z * p;
+	p = log_inv_odd[0] + z * p;
+	const Float64x4 log1p_r = (r - r * s) + mul_pwr2(s * z, static_cast<fp64>(2.0)) * p;
+
+	return (LDF::const_ln2<Float64x4>() * static_cast<fp64>(e) + log_table_log[i]) + log1p_r;
 }
 
 Float64x4 log1p(const Float64x4& x) {
@@ -463,36 +602,100 @@ static void sincos_taylor(
 	p_cos = sqrt(static_cast<fp64>(1.0) - square(p_sin));
 }
 
-/** 
- * @author Taken from libQD qd_real.cpp which can be found under a
- * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+/**
+ * @brief pi/2 split into six parts. The first part has 30 bits, so
+ * n * trig_pi2_split[0] is exact for |n| < 2^23.
  */
-Float64x4 sin(const Float64x4& a) {
+static constexpr fp64 trig_pi2_split[6] = {
+	+0x1.921fb54000000p+0, +0x1.10b4611a62633p-30, +0x1.45c06e0e68948p-86,
+	+0x1.27044533e63a0p-142, +0x1.05df531d89cd9p-198, +0x1.28a5043cc71a0p-254
+};
 
-	/* Strategy.  To compute sin(x), we choose integers a, b so that
-
-			 x = s + a * (pi/2) + b * (pi/1024)
+/** @brief Largest |a| that trig_modulo_pi2 reduces with trig_pi2_split */
+static constexpr fp64 trig_cody_waite_max = 0x1.0p+20;
 
-		 and |s| <= pi/2048.  Using a precomputed table of
-		 sin(k pi / 1024) and cos(k pi / 1024), we can compute
-		 sin(x) from sin(s) and cos(s).  This greatly increases the
-		 convergence of the sine Taylor series.                          */
+/**
+ * @brief Returns t = a - j * (pi/2), where |t| <= pi/4 and j is in [-1, 2].
+ *
+ * @remarks Reducing against a rounded 2pi loses log2(|a| / 2pi) bits, and
+ * fails once the quadrant can no longer be resolved. Instead:
+ * - If |a| <= pi/4, a is returned as is.
+ * - If |a| <= 2^20, n = round(a / (pi/2)) is subtracted with a Cody-Waite
+ * split of pi/2.
+ * - Otherwise a is reduced with LDF::trig_reduce_pi2, which is accurate for
+ * any magnitude.
+ *
+ * @note a must be finite.
+ */
+static inline Float64x4 trig_modulo_pi2(const Float64x4& a, int& j) {
+	j = 0;
+	if (std::fabs(a.val[0]) <= LDF::const_pi4<fp64>()) {
+		return a;
+	}
+	if (std::fabs(a.val[0]) <= trig_cody_waite_max) {
+		const fp64 n = std::floor(
+			a.val[0] * (static_cast<fp64>(2.0) * LDF::const_inv_pi<fp64>()) + 0.5
+		);
+		Float64x4 t = a - n * trig_pi2_split[0];
+		for (int i = 1; i < 6; i++) {
+			t -= LDF::mul<Float64x2, fp64, fp64>(n, trig_pi2_split[i]);
+		}
+		/* j = n mod 4, mapped to [-1, 2] */
+		j = static_cast<int>(static_cast<int32_t>(n) & 3);
+		if (j == 3) {
+			j = -1;
+		}
+		return t;
+	}
+	const fp64 limbs[4] = {a.val[0], a.val[1], a.val[2], a.val[3]};
+	fp64 r[5];
+	j = LDF::trig_reduce_pi2(limbs, 4, r, 5);
+	if (j == 3) {
+		j = -1;
+	}
+	return (((static_cast<Float64x4>(r[0]) + r[1]) + r[2]) + r[3]) + r[4];
+}
 
-	if (isequal_zero(a)) {
-		return 0.0;
+/**
+ * @brief Computes a = s + j / 2 + k / 1024 and returns t = s * pi, where
+ * |s| <= 1/2048, j is in [-1, 2] and k is in [-256, 256].
+ *
+ * @remarks Each limb is reduced modulo 2 by clearing its integer bits, which
+ * is exact. n / 1024 is then subtracted from the sum of the reduced limbs,
+ * which is within [-4, +4], so no bits are lost to cancellation.
+ */
+static inline Float64x4 trigpi_modulo(const Float64x4& a, int& j, int& k) {
+	j = 0;
+	k = 0;
+	if (!isfinite(a)) {
+		return std::numeric_limits<Float64x4>::quiet_NaN();
 	}
+	Float64x4 y = static_cast<fp64>(0.0);
+	for (int i = 0; i < 4; i++) {
+		y += a.val[i] - static_cast<fp64>(2.0) * std::round(a.val[i] * static_cast<fp64>(0.5));
+	}
+	const fp64 n = std::round(y.val[0] * static_cast<fp64>(1024.0));
+	y -= n * static_cast<fp64>(0x1.0p-10);
 
-	// approximately reduce modulo 2*pi
-	Float64x4 z = round(a / LDF::const_2pi<Float64x4>());
-	Float64x4 r = a - LDF::const_2pi<Float64x4>() * z;
+	const fp64 q = std::round(n * static_cast<fp64>(0x1.0p-9));
+	k = static_cast<int>(n - static_cast<fp64>(512.0) * q);
+	/* j = q mod 4, mapped to [-1, 2] */
+	j = static_cast<int>(q) & 3;
+	if (j == 3) {
+		j = -1;
+	}
+	return y * LDF::const_pi<Float64x4>();
+}
 
-	// approximately reduce modulo pi/2 and then modulo pi/1024
-	fp64 q = std::floor(r.val[0] / LDF::const_pi2<fp64>() + 0.5);
-	Float64x4 t = r - LDF::const_pi2<Float64x4>() * q;
-	int j = static_cast<int>(q);
-	q = std::floor(t.val[0] / taylor_pi1024.val[0] + 0.5);
-	t -= taylor_pi1024 * q;
-	int k = static_cast<int>(q);
+/**
+ * @brief Computes sin(t + j * (pi/2) + k * (pi/1024)) for the output of
+ * trig_modulo_pi2 or trigpi_modulo.
+ *
+ * @author Taken from libQD qd_real.cpp which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+static Float64x4 sin_reduced(const Float64x4& t, const int j, const int k) {
+	Float64x4 r;
 	int abs_k = std::abs(k);
 
 	if (j < -2 || j > 2) {
@@ -556,23 +759,42 @@ Float64x4 sin(const Float64x4& a) {
  * @author Taken from libQD qd_real.cpp which can be found under a
  * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
  */
-Float64x4 cos(const Float64x4& a) {
+Float64x4 sin(const Float64x4& a) {
+
+	/* Strategy.  To compute sin(x), we choose integers a, b so that
+
+			 x = s + a * (pi/2) + b * (pi/1024)
+
+		 and |s| <= pi/2048.  Using a precomputed table of
+		 sin(k pi / 1024) and cos(k pi / 1024), we can compute
+		 sin(x) from sin(s) and cos(s).  This greatly increases the
+		 convergence of the sine Taylor series.                          */
 
 	if (isequal_zero(a)) {
-		return 1.0;
+		return 0.0;
+	}
+	if (!isfinite(a)) {
+		return std::numeric_limits<Float64x4>::quiet_NaN();
 	}
 
-	// approximately reduce modulo 2*pi
-	Float64x4 z = round(a / LDF::const_2pi<Float64x4>());
-	Float64x4 r = a - LDF::const_2pi<Float64x4>() * z;
-
-	// approximately reduce modulo pi/2 and then modulo pi/1024
-	fp64 q = std::floor(r.val[0] / LDF::const_pi2<fp64>() + 0.5);
-	Float64x4 t = r - LDF::const_pi2<Float64x4>() * q;
-	int j = static_cast<int>(q);
-	q = std::floor(t.val[0] / taylor_pi1024.val[0] + 0.5);
+	// reduce modulo pi/2 and then modulo pi/1024
+	int j;
+	Float64x4 t = trig_modulo_pi2(a, j);
+	fp64 q = std::floor(t.val[0] / taylor_pi1024.val[0] + 0.5);
 	t -= taylor_pi1024 * q;
 	int k = static_cast<int>(q);
+	return sin_reduced(t, j, k);
+}
+
+/**
+ * @brief Computes cos(t + j * (pi/2) + k * (pi/1024)) for the output of
+ * trig_modulo_pi2 or trigpi_modulo.
+ *
+ * @author Taken from libQD qd_real.cpp which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+static Float64x4 cos_reduced(const Float64x4& t, const int j, const int k) {
+	Float64x4 r;
 	int abs_k = std::abs(k);
 
 	if (j < -2 || j > 2) {
@@ -637,25 +859,35 @@ Float64x4 cos(const Float64x4& a) {
  * @author Taken from libQD qd_real.cpp which can be found under a
  * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
  */
-void sincos(const Float64x4& a, Float64x4& sin_a, Float64x4& cos_a) {
+Float64x4 cos(const Float64x4& a) {
 
 	if (isequal_zero(a)) {
-		sin_a = 0.0;
-		cos_a = 1.0;
-		return;
+		return 1.0;
+	}
+	if (!isfinite(a)) {
+		return std::numeric_limits<Float64x4>::quiet_NaN();
 	}
 
-	// approximately reduce by 2*pi
-	Float64x4 z = round(a / LDF::const_2pi<Float64x4>());
-	Float64x4 t = a - LDF::const_2pi<Float64x4>() * z;
-
-	// approximately reduce by pi/2 and then by pi/1024.
-	fp64 q = std::floor(t.val[0] / LDF::const_pi2<fp64>() + 0.5);
-	t -= LDF::const_pi2<Float64x4>() * q;
-	int j = static_cast<int>(q);
-	q = std::floor(t.val[0] / taylor_pi1024.val[0] + 0.5);
+	// reduce modulo pi/2 and then modulo pi/1024
+	int j;
+	Float64x4 t = trig_modulo_pi2(a, j);
+	fp64 q = std::floor(t.val[0] / taylor_pi1024.val[0] + 0.5);
 	t -= taylor_pi1024 * q;
 	int k = static_cast<int>(q);
+	return cos_reduced(t, j, k);
+}
+
+/**
+ * @brief Computes sin and cos of t + j * (pi/2) + k * (pi/1024) for the
+ * output of trig_modulo_pi2 or trigpi_modulo.
+ *
+ * @author Taken from libQD qd_real.cpp which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+static void sincos_reduced(
+	const Float64x4& t, const int j, const int k,
+	Float64x4& sin_a, Float64x4& cos_a
+) {
 	int abs_k = std::abs(k);
 
 	if (j < -2 || j > 2) {
@@ -728,6 +960,61 @@ void sincos(const Float64x4& a, Float64x4& sin_a, Float64x4& cos_a) {
 	}
 }
 
+/** 
+ * @author Taken from libQD qd_real.cpp which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+void sincos(const Float64x4& a, Float64x4& sin_a, Float64x4& cos_a) {
+
+	if (isequal_zero(a)) {
+		sin_a = 0.0;
+		cos_a = 1.0;
+		return;
+	}
+	if (!isfinite(a)) {
+		sin_a = std::numeric_limits<Float64x4>::quiet_NaN();
+		cos_a = std::numeric_limits<Float64x4>::quiet_NaN();
+		return;
+	}
+
+	// reduce modulo pi/2 and then modulo pi/1024
+	int j;
+	Float64x4 t = trig_modulo_pi2(a, j);
+	fp64 q = std::floor(t.val[0] / taylor_pi1024.val[0] + 0.5);
+	t -= taylor_pi1024 * q;
+	int k = static_cast<int>(q);
+	sincos_reduced(t, j, k, sin_a, cos_a);
+}
+
+Float64x4 sinpi(const Float64x4& a) {
+	if (isequal_zero(a)) {
+		return 0.0;
+	}
+	int j, k;
+	Float64x4 t = trigpi_modulo(a, j, k);
+	return sin_reduced(t, j, k);
+}
+
+Float64x4 cospi(const Float64x4& a) {
+	if (isequal_zero(a)) {
+		return 1.0;
+	}
+	int j, k;
+	Float64x4 t = trigpi_modulo(a, j, k);
+	return cos_reduced(t, j, k);
+}
+
+void sincospi(const Float64x4& a, Float64x4& sin_a, Float64x4& cos_a) {
+	if (isequal_zero(a)) {
+		sin_a = 0.0;
+		cos_a = 1.0;
+		return;
+	}
+	int j, k;
+	Float64x4 t = trigpi_modulo(a, j, k);
+	sincos_reduced(t, j, k, sin_a, cos_a);
+}
+
 /** 
  * @author Taken from libQD qd_real.cpp which can be found under a
  * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
@@ -1179,6 +1466,18 @@ void Float64x4_sincos(Float64x4 theta, Float64x4* LDF_restrict p_sin, Float64x4*
 Float64x4 Float64x4_tan(Float64x4 x) {
 	return tan(x);
 }
+Float64x4 Float64x4_sinpi(Float64x4 x) {
+	return sinpi(x);
+}
+Float64x4 Float64x4_cospi(Float64x4 x) {
+	return cospi(x);
+}
+void Float64x4_sincospi(Float64x4 x, Float64x4* LDF_restrict p_sin, Float64x4* LDF_restrict p_cos) {
+	sincospi(x, *p_sin, *p_cos);
+}
+Float64x4 Float64x4_tanpi(Float64x4 x) {
+	return tanpi(x);
+}
 Float64x4 Float64x4_asin(Float64x4 x) {
 	return asin(x);
 }
@@ -1203,6 +1502,15 @@ Float64x4 Float64x4_tanh(Float64x4 x) {
 void Float64x4_sinhcosh(Float64x4 theta, Float64x4* LDF_restrict p_sinh, Float64x4* LDF_restrict p_cosh) {
 	sinhcosh(theta, *p_sinh, *p_cosh);
 }
+Float64x4 Float64x4_asinh(Float64x4 x) {
+	return asinh(x);
+}
+Float64x4 Float64x4_acosh(Float64x4 x) {
+	return acosh(x);
+}
+Float64x4 Float64x4_atanh(Float64x4 x) {
+	return atanh(x);
+}
 
 Float64x4 Float64x4_erf(Float64x4 x) {
 	return erf(x);
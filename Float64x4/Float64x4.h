@@ -2682,6 +2682,12 @@ Float64x4 Float64x4_sin(Float64x4 x);
 Float64x4 Float64x4_cos(Float64x4 x);
 void Float64x4_sincos(Float64x4 x, Float64x4* LDF_restrict p_sin, Float64x4* LDF_restrict p_cos);
 Float64x4 Float64x4_tan(Float64x4 x);
+/** @brief Computes sin(pi * x) with an exact argument reduction */
+Float64x4 Float64x4_sinpi(Float64x4 x);
+/** @brief Computes cos(pi * x) with an exact argument reduction */
+Float64x4 Float64x4_cospi(Float64x4 x);
+void Float64x4_sincospi(Float64x4 x, Float64x4* LDF_restrict p_sin, Float64x4* LDF_restrict p_cos);
+Float64x4 Float64x4_tanpi(Float64x4 x);
 Float64x4 Float64x4_asin(Float64x4 x);
 Float64x4 Float64x4_acos(Float64x4 x);
 Float64x4 Float64x4_atan(Float64x4 x);
@@ -1268,6 +1268,16 @@ namespace std {
 		sincos(x, sin_val, cos_val);
 		return sin_val / cos_val;
 	}
+	/** @brief Calculates `sin(pi * x)` with an exact argument reduction */
+	Float64x4 sinpi(const Float64x4& x);
+	/** @brief Calculates `cos(pi * x)` with an exact argument reduction */
+	Float64x4 cospi(const Float64x4& x);
+	void sincospi(const Float64x4& x, Float64x4& p_sin, Float64x4& p_cos);
+	inline Float64x4 tanpi(const Float64x4& x) {
+		Float64x4 sin_val, cos_val;
+		sincospi(x, sin_val, cos_val);
+		return sin_val / cos_val;
+	}
 	Float64x4 asin (const Float64x4& x);
 	Float64x4 acos (const Float64x4& x);
 	Float64x4 atan (const Float64x4& x);
@@ -6,191 +6,931 @@
 **	this project. If not, see https://opensource.org/license/MIT
 */
 
+/**
+ * Compiles this file for AVX even when the rest of the library targets an
+ * older CPU, so that the runtime dispatch in Float64x4_array.c can use it.
+ */
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__AVX__)
+	#pragma GCC target("avx")
+#endif
+
 #include "Float64x4.h"
 #include "Float64x4_AVX.h"
 #include "Float64x2/Float64x2_AVX.h"
 #include "Float64x4_def.h"
 
+/**
+ * @brief Look up tables from Float64x4_LUT.hpp, which are exported by
+ * Float64x4.cpp since the header can only be included from C++.
+ */
+extern const Float64x4* const Float64x4_LUT_inv_fact;
+extern const Float64x4* const Float64x4_LUT_inv_fact_odd;
+extern const Float64x4* const Float64x4_LUT_sin_table;
+extern const Float64x4* const Float64x4_LUT_cos_table;
+extern const Float64x4* const Float64x4_LUT_exp2_table;
+extern const fp64* const Float64x4_LUT_log_table_invc;
+extern const Float64x4* const Float64x4_LUT_log_table_log;
+extern const Float64x4* const Float64x4_LUT_log_inv_odd;
+
+//------------------------------------------------------------------------------
+// __m256dx4 helper functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Selects y for each lane where the sign bit of mask is set,
+ * otherwise x.
+ */
+static inline __m256dx4 _mm256x4_blendv_pdx4(
+	const __m256dx4 x, const __m256dx4 y, const __m256d mask
+) {
+	__m256dx4 ret;
+	ret.val[0] = _mm256_blendv_pd(x.val[0], y.val[0], mask);
+	ret.val[1] = _mm256_blendv_pd(x.val[1], y.val[1], mask);
+	ret.val[2] = _mm256_blendv_pd(x.val[2], y.val[2], mask);
+	ret.val[3] = _mm256_blendv_pd(x.val[3], y.val[3], mask);
+	return ret;
+}
+
+/**
+ * @brief Sets each lane to value where the sign bit of mask is set.
+ */
+static inline __m256dx4 _mm256x4_blendv_pdx4_pd(
+	const __m256dx4 x, const __m256d value, const __m256d mask
+) {
+	__m256dx4 ret;
+	ret.val[0] = _mm256_blendv_pd(x.val[0], value, mask);
+	ret.val[1] = _mm256_blendv_pd(x.val[1], _mm256_setzero_pd(), mask);
+	ret.val[2] = _mm256_blendv_pd(x.val[2], _mm256_setzero_pd(), mask);
+	ret.val[3] = _mm256_blendv_pd(x.val[3], _mm256_setzero_pd(), mask);
+	return ret;
+}
+
+/**
+ * @brief Flips the sign of each lane where the sign bit of mask is set.
+ */
+static inline __m256dx4 _mm256x4_xor_sign_pdx4(__m256dx4 x, const __m256d mask) {
+	const __m256d sign_mask = _mm256_and_pd(mask, _mm256_get_sign_mask_pd());
+	x.val[0] = _mm256_xor_pd(x.val[0], sign_mask);
+	x.val[1] = _mm256_xor_pd(x.val[1], sign_mask);
+	x.val[2] = _mm256_xor_pd(x.val[2], sign_mask);
+	x.val[3] = _mm256_xor_pd(x.val[3], sign_mask);
+	return x;
+}
+
+static inline __m256dx4 _mm256x4_from_pdx2(const __m256dx2 x) {
+	__m256dx4 ret;
+	ret.val[0] = x.hi;
+	ret.val[1] = x.lo;
+	ret.val[2] = _mm256_setzero_pd();
+	ret.val[3] = _mm256_setzero_pd();
+	return ret;
+}
+
+static inline __m256dx2 _mm256x2_from_pdx4(const __m256dx4 x) {
+	__m256dx2 ret;
+	ret.hi = x.val[0];
+	ret.lo = x.val[1];
+	return ret;
+}
+
+/**
+ * @brief Loads table[index] for each lane.
+ * @note index must be within the bounds of table.
+ */
+static inline __m256d _mm256_lookup_table_pd(
+	const fp64* const table, const __m128i index
+) {
+	#ifdef __AVX2__
+		return _mm256_i32gather_pd(table, index, sizeof(double));
+	#else
+		int32_t i[4];
+		_mm_storeu_si128((__m128i*)i, index);
+		return _mm256_set_pd(table[i[3]], table[i[2]], table[i[1]], table[i[0]]);
+	#endif
+}
+
+/**
+ * @brief Loads table[index] for each lane.
+ * @note index must be within the bounds of table.
+ */
+static inline __m256dx4 _mm256x4_lookup_table_pdx4(
+	const Float64x4* const table, const __m128i index
+) {
+	__m256dx4 ret;
+	#ifdef __AVX2__
+		// Float64x4 is four doubles wide
+		const __m128i offset = _mm_slli_epi32(index, 2);
+		ret.val[0] = _mm256_i32gather_pd(&table[0].val[0], offset, sizeof(double));
+		ret.val[1] = _mm256_i32gather_pd(&table[0].val[1], offset, sizeof(double));
+		ret.val[2] = _mm256_i32gather_pd(&table[0].val[2], offset, sizeof(double));
+		ret.val[3] = _mm256_i32gather_pd(&table[0].val[3], offset, sizeof(double));
+	#else
+		int32_t i[4];
+		_mm_storeu_si128((__m128i*)i, index);
+		for (int v = 0; v < 4; v++) {
+			ret.val[v] = _mm256_set_pd(
+				table[i[3]].val[v], table[i[2]].val[v],
+				table[i[1]].val[v], table[i[0]].val[v]
+			);
+		}
+	#endif
+	return ret;
+}
+
 //------------------------------------------------------------------------------
 // __m256dx4 exponents and logarithms
 //------------------------------------------------------------------------------
 
+/**
+ * @brief Exponential.  Computes expm1(x) in quad-double precision when x
+ * is between -0.5ln(2) and +0.5ln(2), otherwise exp(x) = 2^m * (ret + 1).
+ *
+ * @author Taken from libQD qd_real.cpp which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ *
+ * @note x.val[0] must be finite and within [-750.0, +710.0] so that m fits
+ * inside of an int32_t.
+ */
+static inline __m256dx4 _mm256x4_taylor_expm1_pdx4(
+	const __m256dx4 x, __m128i* m_bin
+) {
+	/* Strategy:  We first reduce the size of x by noting that
+
+			exp(kr + m * log(2)) = 2^m * exp(r)^k
+
+		where m and k are integers.  By choosing m appropriately
+		we can make |kr| <= log(2) / 2 = 0.346574.  Then exp(r) is
+		evaluated using the familiar Taylor series.  Reducing the
+		argument substantially speeds up the convergence.       */
+
+	// const __m256d k = _mm256_set1_pd(0x1.0p+16);
+	const __m256d inv_k = _mm256_set1_pd(0x1.0p-16);
+
+	__m256d m = _mm256_floor_pd(_mm256_add_pd(
+		_mm256_mul_pd(x.val[0], _mm256_const_log2e_pd()), _mm256_set1_pd(0.5)
+	));
+	*m_bin = _mm256_cvttpd_epi32(m);
+
+	__m256dx4 r = _mm256x4_mul_power2_pdx4_pd(
+		_mm256x4_sub_pdx4(x, _mm256x4_mul_pdx4_pd(_mm256x4_const_ln2_pdx4(), m)), inv_k
+	);
+	__m256dx4 s, p, t;
+
+	p = _mm256x4_square_pdx4(r);
+	s = _mm256x4_add_pdx4(r, _mm256x4_mul_power2_pdx4_pd(p, _mm256_set1_pd(0.5)));
+	// Same number of terms as the scalar version (3! to 11!)
+	for (int i = 0; i < 9; i++) {
+		p = _mm256x4_mul_pdx4(p, r);
+		t = _mm256x4_mul_pdx4(p, _mm256x4_set1_pdx4(Float64x4_LUT_inv_fact[i]));
+		s = _mm256x4_add_pdx4(s, t);
+	}
+
+	for (int i = 0; i < 16; i++) {
+		s = _mm256x4_add_pdx4(
+			_mm256x4_mul_power2_pdx4_pd(s, _mm256_set1_pd(2.0)),
+			_mm256x4_square_pdx4(s)
+		);
+	}
+	return s;
+}
+
+/**
+ * @brief Computes exp(x) / 2^m with a table of 2^(j / 256), using the same
+ * algorithm as table_exp in Float64x4.cpp.
+ *
+ * @remarks x is reduced to (256m + j) * ln(2) / 256 + r, where
+ * |r| <= ln(2) / 512, so that exp(x) = 2^m * 2^(j / 256) * exp(r). r is
+ * reduced with a five part ln(2) / 256, which avoids the error of rounding
+ * ln(2) to Float64x4 when k is large. The terms of expm1(r) after r^9 are
+ * summed in Float64x2, and the terms after r^13 are summed in fp64.
+ *
+ * @note x.val[0] must be within [-750.0, +710.0] so that |k| < 2^19.
+ */
+static inline __m256dx4 _mm256x4_table_exp_pdx4(
+	const __m256dx4 x, __m128i* m_bin
+) {
+	/* ln(2) / 256 split into five parts */
+	const __m256d ln2_0 = _mm256_set1_pd(+0x1.62e42fef80000p-9  );
+	const __m256d ln2_1 = _mm256_set1_pd(+0x1.1cf79abc9e3b4p-44 );
+	const __m256d ln2_2 = _mm256_set1_pd(-0x1.9ff0342542fc3p-98 );
+	const __m256d ln2_3 = _mm256_set1_pd(-0x1.79b31ace93a4fp-153);
+	const __m256d ln2_4 = _mm256_set1_pd(+0x1.068badc5d57d1p-207);
+	const Float64x4* const inv_fact = Float64x4_LUT_inv_fact;
+
+	const __m256d k = _mm256_floor_pd(_mm256_add_pd(_mm256_mul_pd(
+		x.val[0], _mm256_mul_pd(_mm256_set1_pd(256.0), _mm256_const_log2e_pd())
+	), _mm256_set1_pd(0.5)));
+	// k * ln2_0 is exact since ln2_0 has 34 bits
+	__m256dx4 r = _mm256x4_sub_pdx4_pd(x, _mm256_mul_pd(k, ln2_0));
+	r = _mm256x4_sub_pdx4_pdx2(r, _mm256x2_dekker_mul12_pd(k, ln2_1));
+	r = _mm256x4_sub_pdx4_pdx2(r, _mm256x2_dekker_mul12_pd(k, ln2_2));
+	r = _mm256x4_sub_pdx4_pdx2(r, _mm256x2_dekker_mul12_pd(k, ln2_3));
+	r = _mm256x4_sub_pdx4_pd(r, _mm256_mul_pd(k, ln2_4));
+
+	/* k = 256m + j */
+	const __m128i k_bin = _mm256_cvtpd_epi32(k);
+	const __m128i j = _mm_and_si128(k_bin, _mm_set1_epi32(255));
+	*m_bin = _mm_srai_epi32(k_bin, 8);
+
+	/* 1/14! + r/15! + ... + r^4/18! */
+	__m256d tail = _mm256_set1_pd(inv_fact[15].val[0]);
+	for (int i = 14; i >= 11; i--) {
+		tail = _mm256_add_pd(
+			_mm256_mul_pd(tail, r.val[0]), _mm256_set1_pd(inv_fact[i].val[0])
+		);
+	}
+
+	/* 1/10! + r/11! + ... + r^8/18! */
+	const __m256dx2 r2 = _mm256x2_from_pdx4(r);
+	__m256dx2 q = _mm256x2_add_pdx2(
+		_mm256x2_set1_pd_pd(inv_fact[10].val[0], inv_fact[10].val[1]),
+		_mm256x2_mul_pdx2_pd(r2, tail)
+	);
+	for (int i = 9; i >= 7; i--) {
+		q = _mm256x2_add_pdx2(
+			_mm256x2_set1_pd_pd(inv_fact[i].val[0], inv_fact[i].val[1]),
+			_mm256x2_mul_pdx2(r2, q)
+		);
+	}
+
+	/* 1/2! + r/3! + ... + r^16/18! */
+	__m256dx4 p = _mm256x4_add_pdx4(
+		_mm256x4_set1_pdx4(inv_fact[6]), _mm256x4_mul_pdx4_pdx2(r, q)
+	);
+	for (int i = 5; i >= 0; i--) {
+		p = _mm256x4_add_pdx4(
+			_mm256x4_set1_pdx4(inv_fact[i]), _mm256x4_mul_pdx4(r, p)
+		);
+	}
+	p = _mm256x4_add_pd_pdx4(_mm256_set1_pd(0.5), _mm256x4_mul_pdx4(r, p));
+
+	const __m256dx4 expm1_r = _mm256x4_add_pdx4(
+		r, _mm256x4_mul_pdx4(_mm256x4_square_pdx4(r), p)
+	);
+	const __m256dx4 table = _mm256x4_lookup_table_pdx4(Float64x4_LUT_exp2_table, j);
+	return _mm256x4_add_pdx4(table, _mm256x4_mul_pdx4(table, expm1_r));
+}
+
+/**
+ * @brief Clamps x.val[0] to [-750.0, +710.0] so that exp(x) underflows to
+ * zero or overflows to infinity. NaN is clamped to -750.0 and must be
+ * blended back in afterwards.
+ */
+static inline __m256dx4 _mm256x4_exp_clamp_pdx4(__m256dx4 x) {
+	const __m256d exp_lower = _mm256_set1_pd(-750.0);
+	const __m256d exp_upper = _mm256_set1_pd(+710.0);
+	__m256d in_range = _mm256_and_pd(
+		_mm256_cmp_pd(x.val[0], exp_lower, _CMP_GT_OQ),
+		_mm256_cmp_pd(x.val[0], exp_upper, _CMP_LT_OQ)
+	);
+	x.val[0] = _mm256_min_pd(_mm256_max_pd(x.val[0], exp_lower), exp_upper);
+	x.val[1] = _mm256_and_pd(x.val[1], in_range);
+	x.val[2] = _mm256_and_pd(x.val[2], in_range);
+	x.val[3] = _mm256_and_pd(x.val[3], in_range);
+	return x;
+}
+
 __m256dx4 _mm256x4_exp_pdx4(const __m256dx4 x) {
-	Float64x4 val[4];
-	_mm256x4_store_pdx4(val, x);
-	val[0] = Float64x4_exp(val[0]);
-	val[1] = Float64x4_exp(val[1]);
-	val[2] = Float64x4_exp(val[2]);
-	val[3] = Float64x4_exp(val[3]);
-	return _mm256x4_load_pdx4(val);
+	__m128i m_bin;
+	__m256dx4 ret = _mm256x4_table_exp_pdx4(
+		_mm256x4_exp_clamp_pdx4(x), &m_bin
+	);
+	ret = _mm256x4_ldexp_pdx4_epi32(ret, m_bin);
+	// Clears the lower parts when exp(x) overflows
+	ret = _mm256x4_blendv_pdx4_pd(ret, ret.val[0], _mm256_isinf_pd(ret.val[0]));
+
+	// Propagates NaN
+	return _mm256x4_blendv_pdx4_pd(ret, x.val[0], _mm256_isnan_pd(x.val[0]));
 }
 
 __m256dx4 _mm256x4_expm1_pdx4(const __m256dx4 x) {
-	Float64x4 val[4];
-	_mm256x4_store_pdx4(val, x);
-	val[0] = Float64x4_expm1(val[0]);
-	val[1] = Float64x4_expm1(val[1]);
-	val[2] = Float64x4_expm1(val[2]);
-	val[3] = Float64x4_expm1(val[3]);
-	return _mm256x4_load_pdx4(val);
+	const __m256dx4 x_clamp = _mm256x4_exp_clamp_pdx4(x);
+	// m is zero when |x| < 0.5 * ln(2)
+	__m128i m_taylor;
+	const __m256dx4 ret_expm1 = _mm256x4_taylor_expm1_pdx4(x_clamp, &m_taylor);
+
+	__m128i m_bin;
+	__m256dx4 ret = _mm256x4_table_exp_pdx4(x_clamp, &m_bin);
+	ret = _mm256x4_ldexp_pdx4_epi32(ret, m_bin);
+	ret = _mm256x4_sub_pdx4_pd(ret, _mm256_set1_pd(1.0));
+
+	// Check if x was in range
+	const __m256d half_ln2 = _mm256_set1_pd(0.5 * 0x1.62e42fefa39efp-1);
+	const __m256d ret_cmp = _mm256_cmp_pd(
+		_mm256_fabs_pd(x.val[0]), half_ln2, _CMP_LT_OQ
+	);
+	ret = _mm256x4_blendv_pdx4(ret, ret_expm1, ret_cmp);
+
+	// Avoids inf - inf when subtracting 1.0
+	ret = _mm256x4_blendv_pdx4_pd(ret, _mm256_get_infinity_pd(),
+		_mm256_cmp_pd(x.val[0], _mm256_set1_pd(709.79), _CMP_GE_OQ)
+	);
+
+	// Propagates NaN
+	return _mm256x4_blendv_pdx4_pd(ret, x.val[0], _mm256_isnan_pd(x.val[0]));
 }
 
+/**
+ * @brief Logarithm.  Computes log(x) in quad-double precision.
+ * @note This is a natural logarithm (i.e., base e).
+ *
+ * @details Uses the same algorithm as log in Float64x4.cpp. x = 2^e * m,
+ * where m is in [sqrt(0.5), sqrt(2)]. m is multiplied by invc ~= 1 / c from
+ * the table, where c = i / 128 is the closest point to m, so that
+ * r = m * invc - 1 is exact and smaller than 2^-7.5. c = 1 is used when m is
+ * within 2^-7 of 1, since -log(invc) and log1p(r) would cancel.
+ * log(1 + r) = 2 * atanh(s), where s = r / (2 + r), and 2 * s = r - r * s.
+ */
 __m256dx4 _mm256x4_log_pdx4(const __m256dx4 x) {
-	Float64x4 val[4];
-	_mm256x4_store_pdx4(val, x);
-	val[0] = Float64x4_log(val[0]);
-	val[1] = Float64x4_log(val[1]);
-	val[2] = Float64x4_log(val[2]);
-	val[3] = Float64x4_log(val[3]);
-	return _mm256x4_load_pdx4(val);
+	const Float64x4* const inv_odd = Float64x4_LUT_log_inv_odd;
+	const __m256d one = _mm256_set1_pd(1.0);
+
+	/* x = 2^e * m */
+	const __m128i expon = _mm256x4_ilogb_pdx4_epi32(x);
+	__m256dx4 m = _mm256x4_ldexp_pdx4_epi32(x, _mm_sub_epi32(_mm_setzero_si128(), expon));
+	const __m256d m_large = _mm256_cmp_pd(m.val[0], _mm256_const_sqrt2_pd(), _CMP_GT_OQ);
+	m = _mm256x4_mul_power2_pdx4_pd(m, _mm256_blendv_pd(one, _mm256_set1_pd(0.5), m_large));
+	const __m256d e = _mm256_add_pd(_mm256_cvtepi32_pd(expon), _mm256_and_pd(m_large, one));
+
+	__m256d c = _mm256_floor_pd(_mm256_add_pd(
+		_mm256_mul_pd(m.val[0], _mm256_set1_pd(128.0)), _mm256_set1_pd(0.5)
+	));
+	const __m256d near_one = _mm256_cmp_pd(
+		_mm256_fabs_pd(_mm256_sub_pd(m.val[0], one)), _mm256_set1_pd(0x1.0p-7), _CMP_LT_OQ
+	);
+	c = _mm256_blendv_pd(c, _mm256_set1_pd(128.0), near_one);
+	// Keeps the table index in bounds for zero, NaN, and infinity
+	c = _mm256_min_pd(_mm256_max_pd(c, _mm256_set1_pd(90.0)), _mm256_set1_pd(181.0));
+	const __m128i index = _mm256_cvtpd_epi32(_mm256_sub_pd(c, _mm256_set1_pd(90.0)));
+	const __m256d invc = _mm256_lookup_table_pd(Float64x4_LUT_log_table_invc, index);
+
+	/* r = m * invc - 1 */
+	const __m256dx2 p_0 = _mm256x2_dekker_mul12_pd(m.val[0], invc);
+	__m256dx4 r = _mm256x4_add_pd_pd(_mm256_sub_pd(p_0.hi, one), p_0.lo);
+	r = _mm256x4_add_pdx4_pdx2(r, _mm256x2_dekker_mul12_pd(m.val[1], invc));
+	r = _mm256x4_add_pdx4_pdx2(r, _mm256x2_dekker_mul12_pd(m.val[2], invc));
+	r = _mm256x4_add_pdx4_pdx2(r, _mm256x2_dekker_mul12_pd(m.val[3], invc));
+
+	/* log(1 + r) = r - r * s + 2 * s^3 * (1/3 + s^2/5 + ...) */
+	const __m256dx4 s = _mm256x4_div_pdx4(r, _mm256x4_add_pdx4_pd(r, _mm256_set1_pd(2.0)));
+	const __m256dx4 z = _mm256x4_square_pdx4(s);
+	__m256d tail = _mm256_set1_pd(inv_odd[12].val[0]);
+	for (int i = 11; i >= 9; i--) {
+		tail = _mm256_add_pd(
+			_mm256_mul_pd(tail, z.val[0]), _mm256_set1_pd(inv_odd[i].val[0])
+		);
+	}
+	const __m256dx2 z2 = _mm256x2_from_pdx4(z);
+	__m256dx2 q = _mm256x2_add_pdx2(
+		_mm256x2_set1_pd_pd(inv_odd[8].val[0], inv_odd[8].val[1]),
+		_mm256x2_mul_pdx2_pd(z2, tail)
+	);
+	for (int i = 7; i >= 6; i--) {
+		q = _mm256x2_add_pdx2(
+			_mm256x2_set1_pd_pd(inv_odd[i].val[0], inv_odd[i].val[1]),
+			_mm256x2_mul_pdx2(z2, q)
+		);
+	}
+	__m256dx4 p = _mm256x4_add_pdx4(
+		_mm256x4_set1_pdx4(inv_odd[5]), _mm256x4_mul_pdx4_pdx2(z, q)
+	);
+	for (int i = 4; i >= 0; i--) {
+		p = _mm256x4_add_pdx4(
+			_mm256x4_set1_pdx4(inv_odd[i]), _mm256x4_mul_pdx4(z, p)
+		);
+	}
+	const __m256dx4 log1p_r = _mm256x4_add_pdx4(
+		_mm256x4_sub_pdx4(r, _mm256x4_mul_pdx4(r, s)),
+		_mm256x4_mul_pdx4(_mm256x4_mul_power2_pdx4_pd(
+			_mm256x4_mul_pdx4(s, z), _mm256_set1_pd(2.0)
+		), p)
+	);
+
+	__m256dx4 ret = _mm256x4_add_pdx4(
+		_mm256x4_mul_pdx4_pd(_mm256x4_const_ln2_pdx4(), e),
+		_mm256x4_lookup_table_pdx4(Float64x4_LUT_log_table_log, index)
+	);
+	ret = _mm256x4_add_pdx4(ret, log1p_r);
+
+	// log(+inf) = +inf
+	ret = _mm256x4_blendv_pdx4_pd(ret, x.val[0],
+		_mm256_cmp_pd(x.val[0], _mm256_get_infinity_pd(), _CMP_EQ_OQ)
+	);
+
+	// log(0.0) = -inf
+	ret = _mm256x4_blendv_pdx4_pd(ret, _mm256_negate_pd(_mm256_get_infinity_pd()),
+		_mm256_cmp_pd(x.val[0], _mm256_setzero_pd(), _CMP_EQ_OQ)
+	);
+
+	// log(x < 0.0) = NaN, and propagates NaN
+	const __m256d x_isnan = _mm256_cmp_pd(x.val[0], _mm256_setzero_pd(), _CMP_NGE_UQ);
+	ret = _mm256x4_blendv_pdx4_pd(ret, _mm256_get_qNaN_pd(), x_isnan);
+	ret.val[1] = _mm256_blendv_pd(ret.val[1], _mm256_get_qNaN_pd(), x_isnan);
+	return ret;
 }
 
+/**
+ * @brief log1p(x) = 2 * atanh(x / (2 + x)) when |x| is small, otherwise
+ * log(1 + x).
+ *
+ * @remarks The atanh series only needs even powers of z = x / (2 + x),
+ * which converges about twice as fast as the log1p Taylor series.
+ */
 __m256dx4 _mm256x4_log1p_pdx4(const __m256dx4 x) {
-	Float64x4 val[4];
-	_mm256x4_store_pdx4(val, x);
-	val[0] = Float64x4_log1p(val[0]);
-	val[1] = Float64x4_log1p(val[1]);
-	val[2] = Float64x4_log1p(val[2]);
-	val[3] = Float64x4_log1p(val[3]);
-	return _mm256x4_load_pdx4(val);
+	const __m256d use_series = _mm256_cmp_pd(
+		_mm256_fabs_pd(x.val[0]), _mm256_set1_pd(0x1.0p-8), _CMP_LT_OQ
+	);
+	const int series_mask = _mm256_movemask_pd(use_series);
+
+	__m256dx4 ret_series = x;
+	if (series_mask != 0x0) {
+		/**
+		 * @remarks |z| < 2^-9, so (z^2)^12 / 25 is below 2^-212
+		 */
+		const Float64x4 inv_odd[12] = {
+		/* 1/3  */ {{+0x1.5555555555555p-2,+0x1.5555555555555p-56,+0x1.5555555555555p-110,+0x1.5555555555555p-164}},
+		/* 1/5  */ {{+0x1.999999999999ap-3,-0x1.999999999999ap-57,+0x1.999999999999ap-111,-0x1.999999999999ap-165}},
+		/* 1/7  */ {{+0x1.2492492492492p-3,+0x1.2492492492492p-57,+0x1.2492492492492p-111,+0x1.2492492492492p-165}},
+		/* 1/9  */ {{+0x1.c71c71c71c71cp-4,+0x1.c71c71c71c71cp-58,+0x1.c71c71c71c71cp-112,+0x1.c71c71c71c71cp-166}},
+		/* 1/11 */ {{+0x1.745d1745d1746p-4,-0x1.745d1745d1746p-59,+0x1.745d1745d1746p-114,-0x1.745d1745d1746p-169}},
+		/* 1/13 */ {{+0x1.3b13b13b13b14p-4,-0x1.3b13b13b13b14p-58,+0x1.3b13b13b13b14p-112,-0x1.3b13b13b13b14p-166}},
+		/* 1/15 */ {{+0x1.1111111111111p-4,+0x1.1111111111111p-60,+0x1.1111111111111p-116,+0x1.1111111111111p-172}},
+		/* 1/17 */ {{+0x1.e1e1e1e1e1e1ep-5,+0x1.e1e1e1e1e1e1ep-61,+0x1.e1e1e1e1e1e1ep-117,+0x1.e1e1e1e1e1e1ep-173}},
+		/* 1/19 */ {{+0x1.af286bca1af28p-5,+0x1.af286bca1af28p-59,+0x1.af286bca1af28p-113,+0x1.af286bca1af28p-167}},
+		/* 1/21 */ {{+0x1.8618618618618p-5,+0x1.8618618618618p-59,+0x1.8618618618618p-113,+0x1.8618618618618p-167}},
+		/* 1/23 */ {{+0x1.642c8590b2164p-5,+0x1.642c8590b2164p-60,+0x1.642c8590b2164p-115,+0x1.642c8590b2164p-170}},
+		/* 1/25 */ {{+0x1.47ae147ae147bp-5,-0x1.eb851eb851eb8p-61,-0x1.47ae147ae147bp-115,+0x1.eb851eb851eb8p-171}}
+		};
+		const __m256dx4 z = _mm256x4_div_pdx4(
+			x, _mm256x4_add_pd_pdx4(_mm256_set1_pd(2.0), x)
+		);
+		const __m256dx4 z_squared = _mm256x4_square_pdx4(z);
+		__m256dx4 poly = _mm256x4_set1_pdx4(inv_odd[11]);
+		for (int i = 10; i >= 0; i--) {
+			poly = _mm256x4_add_pdx4(
+				_mm256x4_mul_pdx4(poly, z_squared), _mm256x4_set1_pdx4(inv_odd[i])
+			);
+		}
+		// 2 * z = x - x * z, which keeps the rounding error of the division
+		// in the terms that are at most 2^-8 of the result
+		ret_series = _mm256x4_add_pdx4(
+			_mm256x4_sub_pdx4(x, _mm256x4_mul_pdx4(x, z)),
+			_mm256x4_mul_power2_pdx4_pd(
+				_mm256x4_mul_pdx4(_mm256x4_mul_pdx4(poly, z_squared), z),
+				_mm256_set1_pd(2.0)
+			)
+		);
+		if (series_mask == 0xF) {
+			return ret_series;
+		}
+	}
+
+	/**
+	 * log1p(x) = log(u) + (x - (u - 1)) / u, where u = 1 + x. The second term
+	 * corrects for the rounding of u, and u - 1 is exact.
+	 */
+	const __m256d one = _mm256_set1_pd(1.0);
+	const __m256dx4 u = _mm256x4_add_pdx4_pd(x, one);
+	// log(x <= -1.0) is handled by _mm256x4_log_pdx4
+	__m256dx4 ret = _mm256x4_log_pdx4(u);
+	const __m256dx4 u_err = _mm256x4_sub_pdx4(x, _mm256x4_sub_pdx4_pd(u, one));
+	const __m256dx4 ret_corrected = _mm256x4_add_pdx4(ret, _mm256x4_div_pdx4(u_err, u));
+	// Keeps log(u) when u is zero or infinite, since the correction is NaN
+	const __m256d u_finite = _mm256_and_pd(
+		_mm256_cmp_pd(u.val[0], _mm256_setzero_pd(), _CMP_GT_OQ),
+		_mm256_cmp_pd(u.val[0], _mm256_get_infinity_pd(), _CMP_LT_OQ)
+	);
+	ret = _mm256x4_blendv_pdx4(ret, ret_corrected, u_finite);
+	ret = _mm256x4_blendv_pdx4(ret, ret_series, use_series);
+
+	// log1p(+inf) = +inf
+	return _mm256x4_blendv_pdx4_pd(ret, x.val[0],
+		_mm256_cmp_pd(x.val[0], _mm256_get_infinity_pd(), _CMP_EQ_OQ)
+	);
 }
 
 __m256dx4 _mm256x4_pow_pdx4(const __m256dx4 x, const __m256dx4 y) {
-	Float64x4 x_val[4];
-	Float64x4 y_val[4];
-	_mm256x4_store_pdx4(x_val, x);
-	_mm256x4_store_pdx4(y_val, y);
-	x_val[0] = Float64x4_pow(x_val[0], y_val[0]);
-	x_val[1] = Float64x4_pow(x_val[1], y_val[1]);
-	x_val[2] = Float64x4_pow(x_val[2], y_val[2]);
-	x_val[3] = Float64x4_pow(x_val[3], y_val[3]);
-	return _mm256x4_load_pdx4(x_val);
+	__m256dx4 ret = _mm256x4_exp_pdx4(_mm256x4_mul_pdx4(_mm256x4_log_pdx4(x), y));
+	// pow(0.0, y) = (y == 0.0) ? 1.0 : 0.0
+	const __m256d x_iszero = _mm256_cmpeq_zero_pdx4(x);
+	const __m256d y_iszero = _mm256_cmpeq_zero_pdx4(y);
+	return _mm256x4_blendv_pdx4_pd(ret,
+		_mm256_and_pd(y_iszero, _mm256_set1_pd(1.0)), x_iszero
+	);
 }
 
 __m256dx4 _mm256x4_pow_pdx4_pd(const __m256dx4 x, const __m256d y) {
-	Float64x4 x_val[4];
-	fp64 y_val[4];
-	_mm256x4_store_pdx4(x_val, x);
-	_mm256_store_pd(y_val, y);
-	x_val[0] = Float64x4_pow_dx4_d(x_val[0], y_val[0]);
-	x_val[1] = Float64x4_pow_dx4_d(x_val[1], y_val[1]);
-	x_val[2] = Float64x4_pow_dx4_d(x_val[2], y_val[2]);
-	x_val[3] = Float64x4_pow_dx4_d(x_val[3], y_val[3]);
-	return _mm256x4_load_pdx4(x_val);
+	__m256dx4 ret = _mm256x4_exp_pdx4(_mm256x4_mul_pdx4_pd(_mm256x4_log_pdx4(x), y));
+	// pow(0.0, y) = (y == 0.0) ? 1.0 : 0.0
+	const __m256d x_iszero = _mm256_cmpeq_zero_pdx4(x);
+	const __m256d y_iszero = _mm256_cmp_pd(y, _mm256_setzero_pd(), _CMP_EQ_OQ);
+	return _mm256x4_blendv_pdx4_pd(ret,
+		_mm256_and_pd(y_iszero, _mm256_set1_pd(1.0)), x_iszero
+	);
 }
 
 //------------------------------------------------------------------------------
 // __m256dx4 trigonometry
 //------------------------------------------------------------------------------
 
+/**
+ * @brief Computes sin(x) and cos(x) using Taylor series.
+ * @note Assumes |x| <= pi/2048.
+ *
+ * @author Taken from libQD qd_real.cpp which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+static inline void _mm256x4_sincos_taylor_pdx4(
+	const __m256dx4 x, __m256dx4* const p_sin, __m256dx4* const p_cos
+) {
+	/**
+	 * @remarks (pi/2048)^18 / 19! is below 2^-212, so the series is
+	 * truncated after the 17! term instead of checking a threshold.
+	 */
+	const __m256dx4 neg_x_squared = _mm256x4_negate_pdx4(_mm256x4_square_pdx4(x));
+	__m256dx4 x_power = x;
+	__m256dx4 sum = _mm256x4_setzero_pdx4();
+	for (int i = 0; i < 8; i++) {
+		x_power = _mm256x4_mul_pdx4(x_power, neg_x_squared);
+		sum = _mm256x4_add_pdx4(sum, _mm256x4_mul_pdx4(
+			x_power, _mm256x4_set1_pdx4(Float64x4_LUT_inv_fact_odd[i])
+		));
+	}
+	*p_sin = _mm256x4_add_pdx4(sum, x);
+	*p_cos = _mm256x4_sqrt_pdx4(_mm256x4_sub_pd_pdx4(
+		_mm256_set1_pd(1.0), _mm256x4_square_pdx4(*p_sin)
+	));
+}
+
+/**
+ * @brief Computes sin(t + n * (pi/1024)) and cos(t + n * (pi/1024)), where n
+ * is an integer and |t| <= pi/2048.
+ *
+ * @details n = j * 512 + k. sin(k * pi/1024) and cos(k * pi/1024) are
+ * gathered from Float64x4_LUT.hpp, and the quadrant j is applied with blends.
+ */
+static inline void _mm256x4_sincos_reduced_pdx4(
+	const __m256dx4 t, const __m256d n, __m256dx4* const p_sin, __m256dx4* const p_cos
+) {
+	/* n = j * 512 + k where k is within [-256, +255] */
+	const __m256d j = _mm256_floor_pd(_mm256_mul_pd(
+		_mm256_add_pd(n, _mm256_set1_pd(256.0)), _mm256_set1_pd(0x1.0p-9)
+	));
+	const __m256d k = _mm256_sub_pd(n, _mm256_mul_pd(j, _mm256_set1_pd(512.0)));
+	const __m256d k_iszero = _mm256_cmp_pd(k, _mm256_setzero_pd(), _CMP_EQ_OQ);
+	// The tables start at k = 1
+	__m256d k_index = _mm256_sub_pd(_mm256_fabs_pd(k), _mm256_set1_pd(1.0));
+	// Keeps the table index in bounds for k == 0, NaN, infinity, and huge values
+	k_index = _mm256_min_pd(_mm256_max_pd(k_index, _mm256_setzero_pd()), _mm256_set1_pd(255.0));
+	k_index = _mm256_andnot_pd(_mm256_cmp_pd(k_index, k_index, _CMP_UNORD_Q), k_index);
+	const __m128i index = _mm256_cvtpd_epi32(k_index);
+
+	/* sin(t + k * pi/1024) and cos(t + k * pi/1024) */
+	__m256dx4 t_sin, t_cos;
+	_mm256x4_sincos_taylor_pdx4(t, &t_sin, &t_cos);
+	__m256dx4 u = _mm256x4_lookup_table_pdx4(Float64x4_LUT_cos_table, index);
+	__m256dx4 v = _mm256x4_lookup_table_pdx4(Float64x4_LUT_sin_table, index);
+	u = _mm256x4_blendv_pdx4_pd(u, _mm256_set1_pd(1.0), k_iszero);
+	v = _mm256x4_blendv_pdx4_pd(v, _mm256_setzero_pd(), k_iszero);
+	// sin(-k * pi/1024) = -sin(k * pi/1024)
+	v = _mm256x4_xor_sign_pdx4(v, k);
+
+	const __m256dx4 sin_val = _mm256x4_add_pdx4(
+		_mm256x4_mul_pdx4(u, t_sin), _mm256x4_mul_pdx4(v, t_cos)
+	);
+	const __m256dx4 cos_val = _mm256x4_sub_pdx4(
+		_mm256x4_mul_pdx4(u, t_cos), _mm256x4_mul_pdx4(v, t_sin)
+	);
+
+	/* Applies the quadrant (j mod 4) */
+	const __m256d quadrant = _mm256_sub_pd(j, _mm256_mul_pd(
+		_mm256_floor_pd(_mm256_mul_pd(j, _mm256_set1_pd(0.25))), _mm256_set1_pd(4.0)
+	));
+	const __m256d quadrant_1 = _mm256_cmp_pd(quadrant, _mm256_set1_pd(1.0), _CMP_EQ_OQ);
+	const __m256d quadrant_2 = _mm256_cmp_pd(quadrant, _mm256_set1_pd(2.0), _CMP_EQ_OQ);
+	const __m256d quadrant_3 = _mm256_cmp_pd(quadrant, _mm256_set1_pd(3.0), _CMP_EQ_OQ);
+	const __m256d swap = _mm256_or_pd(quadrant_1, quadrant_3);
+
+	*p_sin = _mm256x4_xor_sign_pdx4(
+		_mm256x4_blendv_pdx4(sin_val, cos_val, swap),
+		_mm256_or_pd(quadrant_2, quadrant_3)
+	);
+	*p_cos = _mm256x4_xor_sign_pdx4(
+		_mm256x4_blendv_pdx4(cos_val, sin_val, swap),
+		_mm256_or_pd(quadrant_1, quadrant_2)
+	);
+}
+
+/**
+ * @brief Computes sin(x) and cos(x) for all four lanes at once.
+ *
+ * @details x is reduced to x = t + j * (pi/2) + k * (pi/1024) with
+ * |t| <= pi/2048, which is the same reduction used by libQD. Both steps are
+ * done at once with n = j * 512 + k, subtracting n * (pi/1024) from x using
+ * a six part pi/1024 so that the reduction stays accurate for large n.
+ * sin(k * pi/1024) and cos(k * pi/1024) are then gathered from
+ * Float64x4_LUT.hpp, and the quadrant j is applied with blends.
+ *
+ * Lanes where |x| > 2^20, infinity, or NaN are passed to Float64x4_sincos,
+ * since the six part pi/1024 runs out of bits when n is large.
+ */
+static inline void _mm256x4_sincos_kernel_pdx4(
+	const __m256dx4 x, __m256dx4* const p_sin, __m256dx4* const p_cos
+) {
+	/* pi/1024 split into six doubles */
+	const __m256d pi1024[6] = {
+		_mm256_set1_pd(+0x1.921fb54442d18p-9  ),
+		_mm256_set1_pd(+0x1.1a62633145c07p-63 ),
+		_mm256_set1_pd(-0x1.f1976b7ed8fbcp-119),
+		_mm256_set1_pd(+0x1.4cf98e804177dp-173),
+		_mm256_set1_pd(+0x1.31d89cd9128a5p-227),
+		_mm256_set1_pd(+0x1.0f31c6809bbdfp-285)
+	};
+	const __m256d inv_pi1024 = _mm256_set1_pd(0x1.45f306dc9c883p+8);
+
+	const __m256d n = _mm256_round_pd(
+		_mm256_mul_pd(x.val[0], inv_pi1024), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC
+	);
+
+	/* t = x - n * (pi/1024) */
+	__m256d p_err;
+	__m256d p = _mm256_two_prod_pd(n, pi1024[0], &p_err);
+	__m256dx4 t;
+	t.val[0] = x.val[1];
+	t.val[1] = x.val[2];
+	t.val[2] = x.val[3];
+	t.val[3] = _mm256_setzero_pd();
+	// x.val[0] - n * pi1024[0] is exact since both are within a factor of two
+	t = _mm256x4_add_pdx4_pd(t, _mm256_sub_pd(x.val[0], p));
+	t = _mm256x4_sub_pdx4_pd(t, p_err);
+	for (int i = 1; i < 5; i++) {
+		p = _mm256_two_prod_pd(n, pi1024[i], &p_err);
+		t = _mm256x4_sub_pdx4_pd(t, p);
+		t = _mm256x4_sub_pdx4_pd(t, p_err);
+	}
+	t = _mm256x4_sub_pdx4_pd(t, _mm256_mul_pd(n, pi1024[5]));
+
+	_mm256x4_sincos_reduced_pdx4(t, n, p_sin, p_cos);
+
+	/* |x| > 2^20, infinity, and NaN */
+	const __m256d x_large = _mm256_cmp_pd(
+		_mm256_fabs_pd(x.val[0]), _mm256_set1_pd(0x1.0p+20), _CMP_NLE_UQ
+	);
+	const int large_mask = _mm256_movemask_pd(x_large);
+	if (large_mask != 0x0) {
+		Float64x4 val[4];
+		Float64x4 sin_large[4];
+		Float64x4 cos_large[4];
+		_mm256x4_storeu_pdx4(val, x);
+		_mm256x4_storeu_pdx4(sin_large, *p_sin);
+		_mm256x4_storeu_pdx4(cos_large, *p_cos);
+		for (int i = 0; i < 4; i++) {
+			if (large_mask & (1 << i)) {
+				Float64x4_sincos(val[i], &sin_large[i], &cos_large[i]);
+			}
+		}
+		*p_sin = _mm256x4_loadu_pdx4(sin_large);
+		*p_cos = _mm256x4_loadu_pdx4(cos_large);
+	}
+}
+
 __m256dx4 _mm256x4_sin_pdx4(const __m256dx4 x) {
-	Float64x4 val[4];
-	_mm256x4_store_pdx4(val, x);
-	val[0] = Float64x4_sin(val[0]);
-	val[1] = Float64x4_sin(val[1]);
-	val[2] = Float64x4_sin(val[2]);
-	val[3] = Float64x4_sin(val[3]);
-	return _mm256x4_load_pdx4(val);
+	__m256dx4 ret_sin, ret_cos;
+	_mm256x4_sincos_kernel_pdx4(x, &ret_sin, &ret_cos);
+	return ret_sin;
 }
 
 __m256dx4 _mm256x4_cos_pdx4(const __m256dx4 x) {
-	Float64x4 val[4];
-	_mm256x4_store_pdx4(val, x);
-	val[0] = Float64x4_cos(val[0]);
-	val[1] = Float64x4_cos(val[1]);
-	val[2] = Float64x4_cos(val[2]);
-	val[3] = Float64x4_cos(val[3]);
-	return _mm256x4_load_pdx4(val);
+	__m256dx4 ret_sin, ret_cos;
+	_mm256x4_sincos_kernel_pdx4(x, &ret_sin, &ret_cos);
+	return ret_cos;
 }
 
 void _mm256x4_sincos_pdx4(
 	const __m256dx4 theta, __m256dx4* const p_sin, __m256dx4* const p_cos
 ) {
-	Float64x4 val[4];
-	Float64x4 sin_val[4];
-	Float64x4 cos_val[4];
-	_mm256x4_store_pdx4(val, theta);
-	Float64x4_sincos(val[0], &sin_val[0], &cos_val[0]);
-	Float64x4_sincos(val[1], &sin_val[1], &cos_val[1]);
-	Float64x4_sincos(val[2], &sin_val[2], &cos_val[2]);
-	Float64x4_sincos(val[3], &sin_val[3], &cos_val[3]);
-	*p_sin = _mm256x4_load_pdx4(sin_val);
-	*p_cos = _mm256x4_load_pdx4(cos_val);
+	_mm256x4_sincos_kernel_pdx4(theta, p_sin, p_cos);
 }
 
-__m256dx4 _mm256x4_asin_pdx4(const __m256dx4 x) {
-	Float64x4 val[4];
-	_mm256x4_store_pdx4(val, x);
-	val[0] = Float64x4_asin(val[0]);
-	val[1] = Float64x4_asin(val[1]);
-	val[2] = Float64x4_asin(val[2]);
-	val[3] = Float64x4_asin(val[3]);
-	return _mm256x4_load_pdx4(val);
+/**
+ * @brief Computes sin(pi * x) and cos(pi * x) for all four lanes at once.
+ *
+ * @details x is reduced exactly to x = s + n / 1024 with |s| <= 1/2048, by
+ * first reducing each limb modulo 2. t = s * pi is then passed to the same
+ * table lookup as _mm256x4_sincos_kernel_pdx4.
+ */
+static inline void _mm256x4_sincospi_kernel_pdx4(
+	const __m256dx4 x, __m256dx4* const p_sin, __m256dx4* const p_cos
+) {
+	const __m256d two = _mm256_set1_pd(2.0);
+	const __m256d half = _mm256_set1_pd(0.5);
+	/* limb - 2 * round(limb / 2) is exact */
+	__m256dx4 y = _mm256x4_setzero_pdx4();
+	for (int i = 0; i < 4; i++) {
+		y = _mm256x4_add_pdx4_pd(y, _mm256_sub_pd(x.val[i], _mm256_mul_pd(two, _mm256_round_pd(
+			_mm256_mul_pd(x.val[i], half), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC
+		))));
+	}
+
+	const __m256d n = _mm256_round_pd(
+		_mm256_mul_pd(y.val[0], _mm256_set1_pd(1024.0)), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC
+	);
+	/* s = y - n / 1024 */
+	y = _mm256x4_sub_pdx4_pd(y, _mm256_mul_pd(n, _mm256_set1_pd(0x1.0p-10)));
+	const __m256dx4 t = _mm256x4_mul_pdx4(y, _mm256x4_const_pi_pdx4());
+
+	_mm256x4_sincos_reduced_pdx4(t, n, p_sin, p_cos);
 }
 
-__m256dx4 _mm256x4_acos_pdx4(const __m256dx4 x) {
-	Float64x4 val[4];
-	_mm256x4_store_pdx4(val, x);
-	val[0] = Float64x4_acos(val[0]);
-	val[1] = Float64x4_acos(val[1]);
-	val[2] = Float64x4_acos(val[2]);
-	val[3] = Float64x4_acos(val[3]);
-	return _mm256x4_load_pdx4(val);
+__m256dx4 _mm256x4_sinpi_pdx4(const __m256dx4 x) {
+	__m256dx4 ret_sin, ret_cos;
+	_mm256x4_sincospi_kernel_pdx4(x, &ret_sin, &ret_cos);
+	return ret_sin;
 }
 
-__m256dx4 _mm256x4_atan_pdx4(const __m256dx4 x) {
-	Float64x4 val[4];
-	_mm256x4_store_pdx4(val, x);
-	val[0] = Float64x4_atan(val[0]);
-	val[1] = Float64x4_atan(val[1]);
-	val[2] = Float64x4_atan(val[2]);
-	val[3] = Float64x4_atan(val[3]);
-	return _mm256x4_load_pdx4(val);
+__m256dx4 _mm256x4_cospi_pdx4(const __m256dx4 x) {
+	__m256dx4 ret_sin, ret_cos;
+	_mm256x4_sincospi_kernel_pdx4(x, &ret_sin, &ret_cos);
+	return ret_cos;
 }
 
+void _mm256x4_sincospi_pdx4(
+	const __m256dx4 x, __m256dx4* const p_sin, __m256dx4* const p_cos
+) {
+	_mm256x4_sincospi_kernel_pdx4(x, p_sin, p_cos);
+}
+
+/**
+ * @author Taken from libQD qd_real.cpp which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
 __m256dx4 _mm256x4_atan2_pdx4(const __m256dx4 y, const __m256dx4 x) {
-	Float64x4 y_val[4];
-	Float64x4 x_val[4];
-	_mm256x4_store_pdx4(y_val, y);
-	_mm256x4_store_pdx4(x_val, x);
-	y_val[0] = Float64x4_atan2(y_val[0], x_val[0]);
-	y_val[1] = Float64x4_atan2(y_val[1], x_val[1]);
-	y_val[2] = Float64x4_atan2(y_val[2], x_val[2]);
-	y_val[3] = Float64x4_atan2(y_val[3], x_val[3]);
-	return _mm256x4_load_pdx4(y_val);
+	/* Strategy: Instead of using Taylor series to compute
+		arctan, we instead use Newton's iteration to solve
+		the equation
+
+		sin(z) = y/r    or    cos(z) = x/r
+
+		where r = sqrt(x^2 + y^2).
+		The iteration is given by
+
+		z' = z + (y - sin(z)) / cos(z)          (for equation 1)
+		z' = z - (x - cos(z)) / sin(z)          (for equation 2)
+
+		Here, x and y are normalized so that x^2 + y^2 = 1.
+		If |x| > |y|, then first iteration is used since the
+		denominator is larger.  Otherwise, the second is used.
+
+		libQD starts from a double and uses three iterations. Here the
+		initial guess comes from _mm256x2_atan2_pdx2, so only one
+		iteration is needed. */
+
+	const __m256dx4 guess = _mm256x4_from_pdx2(_mm256x2_atan2_pdx2(
+		_mm256x2_from_pdx4(y), _mm256x2_from_pdx4(x)
+	));
+	const __m256dx4 radius = _mm256x4_sqrt_pdx4(_mm256x4_add_pdx4(
+		_mm256x4_square_pdx4(x), _mm256x4_square_pdx4(y)
+	));
+	__m256dx4 sin_z, cos_z;
+	_mm256x4_sincos_kernel_pdx4(guess, &sin_z, &cos_z);
+
+	const __m256d use_iter_1 = _mm256_cmp_pd(
+		_mm256_fabs_pd(x.val[0]), _mm256_fabs_pd(y.val[0]), _CMP_GT_OQ
+	);
+	/* (y / r) or (x / r) */
+	const __m256dx4 w = _mm256x4_div_pdx4(
+		_mm256x4_blendv_pdx4(x, y, use_iter_1), radius
+	);
+	const __m256dx4 num = _mm256x4_blendv_pdx4(
+		_mm256x4_sub_pdx4(cos_z, w), _mm256x4_sub_pdx4(w, sin_z), use_iter_1
+	);
+	const __m256dx4 den = _mm256x4_blendv_pdx4(sin_z, cos_z, use_iter_1);
+	__m256dx4 ret = _mm256x4_add_pdx4(guess, _mm256x4_div_pdx4(num, den));
+
+	// Infinite inputs make the iteration return NaN
+	const __m256d use_guess = _mm256_andnot_pd(
+		_mm256_isnan_pd(guess.val[0]), _mm256_isnan_pd(ret.val[0])
+	);
+	ret = _mm256x4_blendv_pdx4(ret, guess, use_guess);
+
+	/* atan2(+-0, +0) = +-0 and atan2(+-0, -0) = +-pi, without rounding pi to the guess */
+	const __m256d is_zero = _mm256_and_pd(
+		_mm256_cmp_pd(x.val[0], _mm256_setzero_pd(), _CMP_EQ_OQ),
+		_mm256_cmp_pd(y.val[0], _mm256_setzero_pd(), _CMP_EQ_OQ)
+	);
+	const __m256dx4 const_pi = _mm256x4_const_pi_pdx4();
+	const __m256d y_sign = _mm256_and_pd(y.val[0], _mm256_get_sign_mask_pd());
+	__m256dx4 ret_zero;
+	for (int i = 0; i < 4; i++) {
+		ret_zero.val[i] = _mm256_xor_pd(
+			_mm256_blendv_pd(_mm256_setzero_pd(), const_pi.val[i], x.val[0]), y_sign
+		);
+	}
+	return _mm256x4_blendv_pdx4(ret, ret_zero, is_zero);
 }
 
-__m256dx4 _mm256x4_sinh_pdx4(const __m256dx4 x) {
-	Float64x4 val[4];
-	_mm256x4_store_pdx4(val, x);
-	val[0] = Float64x4_sinh(val[0]);
-	val[1] = Float64x4_sinh(val[1]);
-	val[2] = Float64x4_sinh(val[2]);
-	val[3] = Float64x4_sinh(val[3]);
-	return _mm256x4_load_pdx4(val);
+__m256dx4 _mm256x4_atan_pdx4(const __m256dx4 x) {
+	return _mm256x4_atan2_pdx4(x, _mm256x4_set1_pd(1.0));
 }
 
-__m256dx4 _mm256x4_tanh_pdx4(const __m256dx4 x) {
-	Float64x4 val[4];
-	_mm256x4_store_pdx4(val, x);
-	val[0] = Float64x4_tanh(val[0]);
-	val[1] = Float64x4_tanh(val[1]);
-	val[2] = Float64x4_tanh(val[2]);
-	val[3] = Float64x4_tanh(val[3]);
-	return _mm256x4_load_pdx4(val);
+/**
+ * @brief Computes sqrt(1 - x^2) as sqrt((1 - x) * (1 + x)) to avoid
+ * cancellation when |x| is close to 1.
+ */
+static inline __m256dx4 _mm256x4_sqrt_one_minus_square_pdx4(const __m256dx4 x) {
+	const __m256d one = _mm256_set1_pd(1.0);
+	return _mm256x4_sqrt_pdx4(_mm256x4_mul_pdx4(
+		_mm256x4_sub_pd_pdx4(one, x), _mm256x4_add_pd_pdx4(one, x)
+	));
 }
 
+__m256dx4 _mm256x4_asin_pdx4(const __m256dx4 x) {
+	// |x| > 1.0 returns NaN from the square root
+	return _mm256x4_atan2_pdx4(x, _mm256x4_sqrt_one_minus_square_pdx4(x));
+}
+
+__m256dx4 _mm256x4_acos_pdx4(const __m256dx4 x) {
+	// |x| > 1.0 returns NaN from the square root
+	return _mm256x4_atan2_pdx4(_mm256x4_sqrt_one_minus_square_pdx4(x), x);
+}
+
+//------------------------------------------------------------------------------
+// __m256dx4 hyperbolic functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief sinh(|x|) = (expm1(|x|) + expm1(|x|) / exp(|x|)) / 2
+ * cosh(|x|) = (exp(|x|) + 1 / exp(|x|)) / 2
+ *
+ * @details Using expm1 avoids the cancellation in exp(x) - exp(-x) when x
+ * is close to 0, so no separate Taylor series is needed.
+ */
 void _mm256x4_sinhcosh_pdx4(
 	const __m256dx4 theta, __m256dx4* const p_sinh, __m256dx4* const p_cosh
 ) {
-	Float64x4 val[4];
-	Float64x4 sinh_val[4];
-	Float64x4 cosh_val[4];
-	_mm256x4_store_pdx4(val, theta);
-	Float64x4_sinhcosh(val[0], &sinh_val[0], &cosh_val[0]);
-	Float64x4_sinhcosh(val[1], &sinh_val[1], &cosh_val[1]);
-	Float64x4_sinhcosh(val[2], &sinh_val[2], &cosh_val[2]);
-	Float64x4_sinhcosh(val[3], &sinh_val[3], &cosh_val[3]);
-	*p_sinh = _mm256x4_load_pdx4(sinh_val);
-	*p_cosh = _mm256x4_load_pdx4(cosh_val);
+	const __m256dx4 abs_x = _mm256x4_fabs_pdx4(theta);
+	const __m256dx4 x_expm1 = _mm256x4_expm1_pdx4(abs_x);
+	const __m256dx4 x_exp = _mm256x4_add_pdx4_pd(x_expm1, _mm256_set1_pd(1.0));
+	const __m256dx4 recip_exp = _mm256x4_recip_pdx4(x_exp);
+
+	__m256dx4 ret_sinh = _mm256x4_mul_power2_pdx4_pd(
+		_mm256x4_add_pdx4(x_expm1, _mm256x4_mul_pdx4(x_expm1, recip_exp)),
+		_mm256_set1_pd(0.5)
+	);
+	__m256dx4 ret_cosh = _mm256x4_mul_power2_pdx4_pd(
+		_mm256x4_add_pdx4(x_exp, recip_exp),
+		_mm256_set1_pd(0.5)
+	);
+
+	/**
+	 * exp(-|x|) is below 2^-216 * exp(|x|) when |x| > 75. This also avoids
+	 * multiplying by exp(|x|) when it is large enough for the Dekker split
+	 * to overflow.
+	 */
+	const __m256dx4 half_exp = _mm256x4_mul_power2_pdx4_pd(x_exp, _mm256_set1_pd(0.5));
+	const __m256d x_large = _mm256_cmp_pd(abs_x.val[0], _mm256_set1_pd(75.0), _CMP_GT_OQ);
+	ret_sinh = _mm256x4_blendv_pdx4(ret_sinh, half_exp, x_large);
+	ret_cosh = _mm256x4_blendv_pdx4(ret_cosh, half_exp, x_large);
+
+	// exp(|x|) overflows
+	const __m256d overflow = _mm256_cmp_pd(abs_x.val[0], _mm256_set1_pd(709.79), _CMP_GE_OQ);
+	ret_sinh = _mm256x4_blendv_pdx4_pd(ret_sinh, _mm256_get_infinity_pd(), overflow);
+	ret_cosh = _mm256x4_blendv_pdx4_pd(ret_cosh, _mm256_get_infinity_pd(), overflow);
+
+	// sinh(-x) = -sinh(x)
+	*p_sinh = _mm256x4_xor_sign_pdx4(ret_sinh, theta.val[0]);
+	*p_cosh = ret_cosh;
+}
+
+__m256dx4 _mm256x4_sinh_pdx4(const __m256dx4 x) {
+	__m256dx4 ret_sinh, ret_cosh;
+	_mm256x4_sinhcosh_pdx4(x, &ret_sinh, &ret_cosh);
+	return ret_sinh;
+}
+
+__m256dx4 _mm256x4_cosh_pdx4(const __m256dx4 x) {
+	__m256dx4 ret_sinh, ret_cosh;
+	_mm256x4_sinhcosh_pdx4(x, &ret_sinh, &ret_cosh);
+	return ret_cosh;
+}
+
+/**
+ * @brief tanh(|x|) = expm1(2|x|) / (expm1(2|x|) + 2)
+ */
+__m256dx4 _mm256x4_tanh_pdx4(const __m256dx4 x) {
+	const __m256dx4 abs_x = _mm256x4_fabs_pdx4(x);
+	const __m256dx4 x_expm1 = _mm256x4_expm1_pdx4(
+		_mm256x4_mul_power2_pdx4_pd(abs_x, _mm256_set1_pd(2.0))
+	);
+	__m256dx4 ret = _mm256x4_div_pdx4(
+		x_expm1, _mm256x4_add_pdx4_pd(x_expm1, _mm256_set1_pd(2.0))
+	);
+
+	// 1.0 - tanh(75.0) is below 2^-212, and avoids inf / inf
+	ret = _mm256x4_blendv_pdx4_pd(ret, _mm256_set1_pd(1.0),
+		_mm256_cmp_pd(abs_x.val[0], _mm256_set1_pd(75.0), _CMP_GT_OQ)
+	);
+
+	// tanh(-x) = -tanh(x)
+	return _mm256x4_xor_sign_pdx4(ret, x.val[0]);
 }
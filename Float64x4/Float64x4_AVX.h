@@ -1588,29 +1588,37 @@ static inline __m256d _mm256_two_diff_pd(const __m256d x, const __m256d y, __m25
 /** @brief Computes fl(x * y) and err(x * y). */
 static inline __m256d _mm256_two_prod_pd(const __m256d x, const __m256d y, __m256d* LDF_restrict const err) {
 	__m256d p = _mm256_mul_pd(x, y);
-	__m256dx2 a = _mm256x2_dekker_split_pd(x);
-	__m256dx2 b = _mm256x2_dekker_split_pd(y);
-	*err = _mm256_add_pd(
-		_mm256_add_pd(
+	#ifdef LDF_ENABLE_FMA_SIMD
+		*err = _mm256_fmsub_pd(x, y, p);
+	#else
+		__m256dx2 a = _mm256x2_dekker_split_pd(x);
+		__m256dx2 b = _mm256x2_dekker_split_pd(y);
+		*err = _mm256_add_pd(
 			_mm256_add_pd(
-				_mm256_sub_pd(_mm256_mul_pd(a.hi, b.hi), p),
-				_mm256_mul_pd(a.hi, b.lo)
-			), _mm256_mul_pd(a.lo, b.hi)
-		), _mm256_mul_pd(a.lo, b.lo)
-	);
+				_mm256_add_pd(
+					_mm256_sub_pd(_mm256_mul_pd(a.hi, b.hi), p),
+					_mm256_mul_pd(a.hi, b.lo)
+				), _mm256_mul_pd(a.lo, b.hi)
+			), _mm256_mul_pd(a.lo, b.lo)
+		);
+	#endif
 	return p;
 }
 
 /** @brief Computes fl(x * x) and err(x * x). Faster than _mm256_two_prod_pd(x, x, err) */
 static inline __m256d _mm256_two_sqr_pd(const __m256d x, __m256d* LDF_restrict const err) {
 	__m256d q = _mm256_mul_pd(x, x);
-	__m256dx2 a = _mm256x2_dekker_split_pd(x);
-	*err = _mm256_add_pd(
-		_mm256_add_pd(
-			_mm256_sub_pd(_mm256_mul_pd(a.hi, a.hi), q),
-			_mm256_mul_pd(_mm256_set1_pd(2.0), _mm256_mul_pd(a.hi, a.lo))
-		), _mm256_mul_pd(a.lo, a.lo)
-	);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		*err = _mm256_fmsub_pd(x, x, q);
+	#else
+		__m256dx2 a = _mm256x2_dekker_split_pd(x);
+		*err = _mm256_add_pd(
+			_mm256_add_pd(
+				_mm256_sub_pd(_mm256_mul_pd(a.hi, a.hi), q),
+				_mm256_mul_pd(_mm256_set1_pd(2.0), _mm256_mul_pd(a.hi, a.lo))
+			), _mm256_mul_pd(a.lo, a.lo)
+		);
+	#endif
 	return q;
 }
 
@@ -3707,17 +3715,14 @@ static inline __m256dx4 _mm256x4_const_phi_pdx4(void) {
 static inline __m256dx4 _mm256x4_fmax_pdx4(__m256dx4 x, __m256dx4 y) {
 	__m256d fmax_cmp =
 		_mm256_or_pd(
-			_mm256_andnot_pd(
-				_mm256_or_pd(
-					_mm256_andnot_pd(
-						_mm256_signbit_pdx4(x),
-						_mm256_isnan_pdx4(y)
-					),
-					_mm256_isnan_pdx4(x)
-				),
-				_mm256_cmplt_pdx4(y, x)
+			_mm256_or_pd(
+				_mm256_cmplt_pdx4(x, y),
+				_mm256_isnan_pdx4(x)
 			),
-			_mm256_cmplt_pdx4(x, y)
+			_mm256_and_pd(
+				_mm256_signbit_pdx4(x),
+				_mm256_cmpeq_pdx4(x, y)
+			)
 		);
 	__m256dx4 ret;
 	ret.val[0] = _mm256_blendv_pd(x.val[0], y.val[0], fmax_cmp);
@@ -3734,17 +3739,14 @@ static inline __m256dx4 _mm256x4_fmax_pdx4(__m256dx4 x, __m256dx4 y) {
 static inline __m256dx4 _mm256x4_fmin_pdx4(__m256dx4 x, __m256dx4 y) {
 	__m256d fmin_cmp =
 		_mm256_or_pd(
-			_mm256_andnot_pd(
-				_mm256_or_pd(
-					_mm256_andnot_pd(
-						_mm256_signbit_pdx4(x),
-						_mm256_isnan_pdx4(y)
-					),
-					_mm256_isnan_pdx4(x)
-				),
-				_mm256_cmpgt_pdx4(y, x)
+			_mm256_or_pd(
+				_mm256_cmpgt_pdx4(x, y),
+				_mm256_isnan_pdx4(x)
 			),
-			_mm256_cmpgt_pdx4(x, y)
+			_mm256_andnot_pd(
+				_mm256_signbit_pdx4(x),
+				_mm256_cmpeq_pdx4(x, y)
+			)
 		);
 	__m256dx4 ret;
 	ret.val[0] = _mm256_blendv_pd(x.val[0], y.val[0], fmin_cmp);
@@ -3779,34 +3781,43 @@ static inline __m256dx4 _mm256x4_min_pdx4(__m256dx4 x, __m256dx4 y) {
 //------------------------------------------------------------------------------
 
 static inline __m256dx4 _mm256x4_trunc_pdx4(__m256dx4 x) {
-	__m256dx4 ret = {{
-		_mm256_trunc_pd(x.val[0]),
-		_mm256_trunc_pd(x.val[1]),
-		_mm256_trunc_pd(x.val[2]),
-		_mm256_trunc_pd(x.val[3]),
-	}};
+	__m256dx4 ret;
+	ret.val[0] = _mm256_trunc_pd(x.val[0]);
+	// lower limbs are only rounded when the higher limbs are integers
+	__m256d cmp_int = _mm256_cmp_pd(ret.val[0], x.val[0], _CMP_EQ_OQ);
+	ret.val[1] = _mm256_and_pd(_mm256_trunc_pd(x.val[1]), cmp_int);
+	cmp_int = _mm256_and_pd(cmp_int, _mm256_cmp_pd(ret.val[1], x.val[1], _CMP_EQ_OQ));
+	ret.val[2] = _mm256_and_pd(_mm256_trunc_pd(x.val[2]), cmp_int);
+	cmp_int = _mm256_and_pd(cmp_int, _mm256_cmp_pd(ret.val[2], x.val[2], _CMP_EQ_OQ));
+	ret.val[3] = _mm256_and_pd(_mm256_trunc_pd(x.val[3]), cmp_int);
 	_mm256x4_renorm_pdx4(&ret);
 	return ret;
 }
 
 static inline __m256dx4 _mm256x4_floor_pdx4(__m256dx4 x) {
-	__m256dx4 ret = {{
-		_mm256_floor_pd(x.val[0]),
-		_mm256_floor_pd(x.val[1]),
-		_mm256_floor_pd(x.val[2]),
-		_mm256_floor_pd(x.val[3]),
-	}};
+	__m256dx4 ret;
+	ret.val[0] = _mm256_floor_pd(x.val[0]);
+	// lower limbs are only rounded when the higher limbs are integers
+	__m256d cmp_int = _mm256_cmp_pd(ret.val[0], x.val[0], _CMP_EQ_OQ);
+	ret.val[1] = _mm256_and_pd(_mm256_floor_pd(x.val[1]), cmp_int);
+	cmp_int = _mm256_and_pd(cmp_int, _mm256_cmp_pd(ret.val[1], x.val[1], _CMP_EQ_OQ));
+	ret.val[2] = _mm256_and_pd(_mm256_floor_pd(x.val[2]), cmp_int);
+	cmp_int = _mm256_and_pd(cmp_int, _mm256_cmp_pd(ret.val[2], x.val[2], _CMP_EQ_OQ));
+	ret.val[3] = _mm256_and_pd(_mm256_floor_pd(x.val[3]), cmp_int);
 	_mm256x4_renorm_pdx4(&ret);
 	return ret;
 }
 
 static inline __m256dx4 _mm256x4_ceil_pdx4(__m256dx4 x) {
-	__m256dx4 ret = {{
-		_mm256_ceil_pd(x.val[0]),
-		_mm256_ceil_pd(x.val[1]),
-		_mm256_ceil_pd(x.val[2]),
-		_mm256_ceil_pd(x.val[3]),
-	}};
+	__m256dx4 ret;
+	ret.val[0] = _mm256_ceil_pd(x.val[0]);
+	// lower limbs are only rounded when the higher limbs are integers
+	__m256d cmp_int = _mm256_cmp_pd(ret.val[0], x.val[0], _CMP_EQ_OQ);
+	ret.val[1] = _mm256_and_pd(_mm256_ceil_pd(x.val[1]), cmp_int);
+	cmp_int = _mm256_and_pd(cmp_int, _mm256_cmp_pd(ret.val[1], x.val[1], _CMP_EQ_OQ));
+	ret.val[2] = _mm256_and_pd(_mm256_ceil_pd(x.val[2]), cmp_int);
+	cmp_int = _mm256_and_pd(cmp_int, _mm256_cmp_pd(ret.val[2], x.val[2], _CMP_EQ_OQ));
+	ret.val[3] = _mm256_and_pd(_mm256_ceil_pd(x.val[3]), cmp_int);
 	_mm256x4_renorm_pdx4(&ret);
 	return ret;
 }
@@ -4007,70 +4018,44 @@ static inline __m256dx4 _mm256x4_frexp_pdx4_epi32(__m256dx4 x, __m128i* const ex
 // __m256dx4 exponents and logarithms
 //------------------------------------------------------------------------------
 
-/** @note This function doesn't use AVX for calculations */
 __m256dx4 _mm256x4_exp_pdx4(__m256dx4 x);
 
-/** @note This function doesn't use AVX for calculations */
 __m256dx4 _mm256x4_expm1_pdx4(__m256dx4 x);
 
-/** @note This function doesn't use AVX for calculations */
 static inline __m256dx4 _mm256x4_exp2_pdx4(const __m256dx4 a) {
 	return _mm256x4_exp_pdx4(_mm256x4_mul_pdx4(a, _mm256x4_const_ln2_pdx4()));
 }
 
-/** @note This function doesn't use AVX for calculations */
 static inline __m256dx4 _mm256x4_exp10_pdx4(const __m256dx4 a) {
 	return _mm256x4_exp_pdx4(_mm256x4_mul_pdx4(a, _mm256x4_const_ln10_pdx4()));
 }
 
-/** @note This function doesn't use AVX for calculations */
+/** @note The initial guess is calculated with _mm256x2_log1p_pdx2 */
 __m256dx4 _mm256x4_log_pdx4(__m256dx4 x);
 
-/** @note This function doesn't use AVX for calculations */
 __m256dx4 _mm256x4_log1p_pdx4(__m256dx4 x);
 
-/** @note This function doesn't use AVX for calculations */
 static inline __m256dx4 _mm256x4_log2_pdx4(const __m256dx4 x) {
 	return _mm256x4_mul_pdx4(_mm256x4_log_pdx4(x), _mm256x4_const_log2e_pdx4());
 }
 
-/** @note This function doesn't use AVX for calculations */
 static inline __m256dx4 _mm256x4_log10_pdx4(const __m256dx4 x) {
 	return _mm256x4_mul_pdx4(_mm256x4_log_pdx4(x), _mm256x4_const_log10e_pdx4());
 }
 
-/** @note This function doesn't use AVX for calculations */
 __m256dx4 _mm256x4_pow_pdx4(__m256dx4 x, __m256dx4 y);
 
-/** @note This function doesn't use AVX for calculations */
 __m256dx4 _mm256x4_pow_pdx4_pd(__m256dx4 x, __m256d y);
 
-#if 0
-	// Avoiding multiple __m256dx4 to Float64x4 conversions
-
-	/** @note This function doesn't use AVX for calculations */
-	static inline __m256dx4 _mm256x4_pow_pdx4(const __m256dx4 x, const __m256dx4 y) {
-		return _mm256x4_exp_pdx4(_mm256x4_mul_pdx4(_mm256x4_log_pdx4(x), y));
-	}
-
-	/** @note This function doesn't use AVX for calculations */
-	static inline __m256dx4 _mm256x4_pow_pdx4_pd(const __m256dx4 x, const __m256d y) {
-		return _mm256x4_exp_pdx4(_mm256x4_mul_pdx4_pd(_mm256x4_log_pdx4(x), y));
-	}
-#endif
-
 //------------------------------------------------------------------------------
 // __m256dx4 trigonometry
 //------------------------------------------------------------------------------
 
-/** @note This function doesn't use AVX for calculations */
 __m256dx4 _mm256x4_sin_pdx4(__m256dx4 x);
 
-/** @note This function doesn't use AVX for calculations */
 __m256dx4 _mm256x4_cos_pdx4(__m256dx4 x);
 
 /**
- * @note This function doesn't use AVX for calculations
  * @warning p_sin and p_cos must be aligned on a 32-byte boundary or a
  * general-protection exception may be generated.
  */
@@ -4078,75 +4063,106 @@ void _mm256x4_sincos_pdx4(
 	__m256dx4 theta, __m256dx4* p_sin, __m256dx4* p_cos
 );
 
-/** @note This function doesn't use AVX for calculations */
 static inline __m256dx4 _mm256x4_tan_pdx4(__m256dx4 x) {
 	__m256dx4 t_sin, t_cos;
 	_mm256x4_sincos_pdx4(x, &t_sin, &t_cos);
 	return _mm256x4_div_pdx4(t_sin, t_cos);
 }
 
-/** @note This function doesn't use AVX for calculations */
+/** @brief Computes sin(pi * x) with an exact argument reduction */
+__m256dx4 _mm256x4_sinpi_pdx4(__m256dx4 x);
+
+/** @brief Computes cos(pi * x) with an exact argument reduction */
+__m256dx4 _mm256x4_cospi_pdx4(__m256dx4 x);
+
+/**
+ * @warning p_sin and p_cos must be aligned on a 32-byte boundary or a
+ * general-protection exception may be generated.
+ */
+void _mm256x4_sincospi_pdx4(
+	__m256dx4 x, __m256dx4* p_sin, __m256dx4* p_cos
+);
+
+static inline __m256dx4 _mm256x4_tanpi_pdx4(__m256dx4 x) {
+	__m256dx4 t_sin, t_cos;
+	_mm256x4_sincospi_pdx4(x, &t_sin, &t_cos);
+	return _mm256x4_div_pdx4(t_sin, t_cos);
+}
+
 __m256dx4 _mm256x4_asin_pdx4(__m256dx4 x);
 
-/** @note This function doesn't use AVX for calculations */
 __m256dx4 _mm256x4_acos_pdx4(__m256dx4 x);
 
-/** @note This function doesn't use AVX for calculations */
 __m256dx4 _mm256x4_atan_pdx4(__m256dx4 x);
 
-/** @note This function doesn't use AVX for calculations */
+/** @note The initial guess is calculated with _mm256x2_atan2_pdx2 */
 __m256dx4 _mm256x4_atan2_pdx4(__m256dx4 y, __m256dx4 x);
 
-/** @note sinh is inaccurate when x is close to 0, which is why it isn't inlined */
 __m256dx4 _mm256x4_sinh_pdx4(__m256dx4 x);
 
-/** @note This function doesn't use AVX for calculations */
-static inline __m256dx4 _mm256x4_cosh_pdx4(__m256dx4 x) {
-	__m256dx4 exp_x = _mm256x4_exp_pdx4(x);
-	return _mm256x4_mul_power2_pdx4_pd(
-		_mm256x4_add_pdx4(exp_x, _mm256x4_recip_pdx4(exp_x)),
-	_mm256_set1_pd(0.5));
-}
+__m256dx4 _mm256x4_cosh_pdx4(__m256dx4 x);
 
-/** @note This function doesn't use AVX for calculations */
 __m256dx4 _mm256x4_tanh_pdx4(__m256dx4 x);
 
 /**
- * @note This function doesn't use AVX for calculations
- * @warning p_sin and p_cos must be aligned on a 32-byte boundary or a
+ * @warning p_sinh and p_cosh must be aligned on a 32-byte boundary or a
  * general-protection exception may be generated.
  */
 void _mm256x4_sinhcosh_pdx4(
 	__m256dx4 theta, __m256dx4* p_sinh, __m256dx4* p_cosh
 );
 
-/** @note This function doesn't use AVX for calculations */
+/**
+ * @brief asinh(|x|) = log1p(|x| + x^2 / (1 + sqrt(x^2 + 1)))
+ * @note log1p(2|x|) is used when x^2 would overflow
+ */
 static inline __m256dx4 _mm256x4_asinh_pdx4(__m256dx4 x) {
-	return _mm256x4_log_pdx4(_mm256x4_add_pdx4(x,
-		_mm256x4_sqrt_pdx4(
-			_mm256x4_sub_pdx4_pd(_mm256x4_square_pdx4(x), _mm256_set1_pd(1.0))
-		)
-	));
+	const __m256dx4 abs_x = _mm256x4_fabs_pdx4(x);
+	const __m256dx4 x_squared = _mm256x4_square_pdx4(x);
+	__m256dx4 arg = _mm256x4_add_pdx4(abs_x,
+		_mm256x4_div_pdx4(x_squared, _mm256x4_add_pd_pdx4(_mm256_set1_pd(1.0),
+			_mm256x4_sqrt_pdx4(_mm256x4_add_pdx4_pd(x_squared, _mm256_set1_pd(1.0)))
+		))
+	);
+	const __m256d x_huge = _mm256_cmp_pd(abs_x.val[0], _mm256_set1_pd(0x1.0p+500), _CMP_GT_OQ);
+	const __m256dx4 arg_huge = _mm256x4_mul_power2_pdx4_pd(abs_x, _mm256_set1_pd(2.0));
+	arg.val[0] = _mm256_blendv_pd(arg.val[0], arg_huge.val[0], x_huge);
+	arg.val[1] = _mm256_blendv_pd(arg.val[1], arg_huge.val[1], x_huge);
+	arg.val[2] = _mm256_blendv_pd(arg.val[2], arg_huge.val[2], x_huge);
+	arg.val[3] = _mm256_blendv_pd(arg.val[3], arg_huge.val[3], x_huge);
+	return _mm256x4_copysign_pdx4(_mm256x4_log1p_pdx4(arg), x);
 }
 
-/** @note This function doesn't use AVX for calculations */
+/**
+ * @brief acosh(x) = log1p((x - 1) + sqrt((x - 1) * (x + 1)))
+ * @note log1p(2x) is used when x^2 would overflow
+ */
 static inline __m256dx4 _mm256x4_acosh_pdx4(__m256dx4 x) {
-	return _mm256x4_log_pdx4(_mm256x4_add_pdx4(x,
-		_mm256x4_sqrt_pdx4(
-			_mm256x4_add_pdx4_pd(_mm256x4_square_pdx4(x), _mm256_set1_pd(1.0))
-		)
-	));
+	const __m256dx4 x_m1 = _mm256x4_sub_pdx4_pd(x, _mm256_set1_pd(1.0));
+	__m256dx4 arg = _mm256x4_add_pdx4(x_m1,
+		_mm256x4_sqrt_pdx4(_mm256x4_mul_pdx4(
+			x_m1, _mm256x4_add_pdx4_pd(x, _mm256_set1_pd(1.0))
+		))
+	);
+	const __m256d x_huge = _mm256_cmp_pd(x.val[0], _mm256_set1_pd(0x1.0p+500), _CMP_GT_OQ);
+	const __m256dx4 arg_huge = _mm256x4_mul_power2_pdx4_pd(x, _mm256_set1_pd(2.0));
+	arg.val[0] = _mm256_blendv_pd(arg.val[0], arg_huge.val[0], x_huge);
+	arg.val[1] = _mm256_blendv_pd(arg.val[1], arg_huge.val[1], x_huge);
+	arg.val[2] = _mm256_blendv_pd(arg.val[2], arg_huge.val[2], x_huge);
+	arg.val[3] = _mm256_blendv_pd(arg.val[3], arg_huge.val[3], x_huge);
+	return _mm256x4_log1p_pdx4(arg);
 }
 
-/** @note This function doesn't use AVX for calculations */
+/**
+ * @brief atanh(x) = log1p(2x / (1 - x)) / 2
+ */
 static inline __m256dx4 _mm256x4_atanh_pdx4(__m256dx4 x) {
-	return _mm256x4_mul_power2_pdx4_pd(_mm256x4_log_pdx4(_mm256x4_div_pdx4(
-			_mm256x4_add_pd_pdx4(_mm256_set1_pd(1.0), x),
+	return _mm256x4_mul_power2_pdx4_pd(_mm256x4_log1p_pdx4(_mm256x4_div_pdx4(
+			_mm256x4_mul_power2_pdx4_pd(x, _mm256_set1_pd(2.0)),
 			_mm256x4_sub_pd_pdx4(_mm256_set1_pd(1.0), x)
 	)), _mm256_set1_pd(0.5));
 }
 
-
 #ifdef __cplusplus
 	}
 #endif
@@ -0,0 +1,3776 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+/*
+**	Portions of this file were part of the libQD library, licensed
+**	under a modifed BSD license that can be found below:
+**	https://www.davidhbailey.com/dhbsoftware/LBNL-BSD-License.docx
+**	Or alternatively from this website:
+**	https://www.davidhbailey.com/dhbsoftware/
+**	A copy of the LBNL-BSD-License can also be found at:
+**	LIB-Dekker-Float/libQD/LBNL-BSD-License.txt
+*/
+
+#ifndef FLOAT64X4_AVX512_H
+#define FLOAT64X4_AVX512_H
+
+/**
+ * @note Requires AVX512F or later. AVX512F always provides FMA, so the
+ * error-free products use _mm512_fmsub_pd directly.
+ * @note Comparisons return a __mmask8 instead of a __m512d bitmask.
+ * @warning -Ofast may break this library. -O3 compiles okay on gcc and clang.
+ */
+
+#include "../LDF/LDF_restrict.h"
+#include "Float64x4_def.h"
+#include "../Float64/Float64_AVX512.h"
+#include "../Float64x2/Float64x2_AVX512.h"
+
+#include <stdint.h>
+
+#if (!defined(__AVX512F__) && defined(__GNUC__))
+	#error "__AVX512F__ is not enabled in your compiler. Try -mavx512f"
+#endif
+
+#include <immintrin.h>
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+/**
+ * @brief Holds eight Quad-Float64 dekker floats
+ */
+typedef struct __m512dx4 {
+	__m512d val[4];
+} __m512dx4;
+
+//------------------------------------------------------------------------------
+// __m512dx4 set1 functions
+//------------------------------------------------------------------------------
+
+static inline __m512dx4 _mm512x4_setzero_pdx4(void) {
+	__m512dx4 ret;
+	ret.val[0] = _mm512_setzero_pd();
+	ret.val[1] = _mm512_setzero_pd();
+	ret.val[2] = _mm512_setzero_pd();
+	ret.val[3] = _mm512_setzero_pd();
+	return ret;
+}
+
+static inline __m512dx4 _mm512x4_set1_pdx4(const Float64x4 value) {
+	__m512dx4 ret;
+	ret.val[0] = _mm512_set1_pd(value.val[0]);
+	ret.val[1] = _mm512_set1_pd(value.val[1]);
+	ret.val[2] = _mm512_set1_pd(value.val[2]);
+	ret.val[3] = _mm512_set1_pd(value.val[3]);
+	return ret;
+}
+
+static inline __m512dx4 _mm512x4_set1_pdx2(const Float64x2 value) {
+	__m512dx4 ret;
+	ret.val[0] = _mm512_set1_pd(value.hi);
+	ret.val[1] = _mm512_set1_pd(value.lo);
+	ret.val[2] = _mm512_setzero_pd();
+	ret.val[3] = _mm512_setzero_pd();
+	return ret;
+}
+
+static inline __m512dx4 _mm512x4_set1_pd(double x) {
+	__m512dx4 ret;
+	ret.val[0] = _mm512_set1_pd(x);
+	ret.val[1] = _mm512_setzero_pd();
+	ret.val[2] = _mm512_setzero_pd();
+	ret.val[3] = _mm512_setzero_pd();
+	return ret;
+}
+
+static inline __m512dx4 _mm512x4_set1_epi64(long long x) {
+	__m512dx4 ret;
+	ret.val[0] = _mm512_castsi512_pd(_mm512_set1_epi64(x));
+	ret.val[1] = _mm512_castsi512_pd(_mm512_set1_epi64(x));
+	ret.val[2] = _mm512_castsi512_pd(_mm512_set1_epi64(x));
+	ret.val[3] = _mm512_castsi512_pd(_mm512_set1_epi64(x));
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 set functions
+//------------------------------------------------------------------------------
+
+static inline __m512dx4 _mm512x4_set_pdx4(
+	const Float64x4 e7, const Float64x4 e6, const Float64x4 e5, const Float64x4 e4,
+	const Float64x4 e3, const Float64x4 e2, const Float64x4 e1, const Float64x4 e0
+) {
+	__m512dx4 ret;
+	ret.val[0] = _mm512_set_pd(
+		e7.val[0], e6.val[0], e5.val[0], e4.val[0], e3.val[0], e2.val[0], e1.val[0], e0.val[0]
+	);
+	ret.val[1] = _mm512_set_pd(
+		e7.val[1], e6.val[1], e5.val[1], e4.val[1], e3.val[1], e2.val[1], e1.val[1], e0.val[1]
+	);
+	ret.val[2] = _mm512_set_pd(
+		e7.val[2], e6.val[2], e5.val[2], e4.val[2], e3.val[2], e2.val[2], e1.val[2], e0.val[2]
+	);
+	ret.val[3] = _mm512_set_pd(
+		e7.val[3], e6.val[3], e5.val[3], e4.val[3], e3.val[3], e2.val[3], e1.val[3], e0.val[3]
+	);
+	return ret;
+}
+
+static inline __m512dx4 _mm512x4_set_pdx2(
+	const Float64x2 e7, const Float64x2 e6, const Float64x2 e5, const Float64x2 e4,
+	const Float64x2 e3, const Float64x2 e2, const Float64x2 e1, const Float64x2 e0
+) {
+	__m512dx4 ret;
+	ret.val[0] = _mm512_set_pd(e7.hi, e6.hi, e5.hi, e4.hi, e3.hi, e2.hi, e1.hi, e0.hi);
+	ret.val[1] = _mm512_set_pd(e7.lo, e6.lo, e5.lo, e4.lo, e3.lo, e2.lo, e1.lo, e0.lo);
+	ret.val[2] = _mm512_setzero_pd();
+	ret.val[3] = _mm512_setzero_pd();
+	return ret;
+}
+
+static inline __m512dx4 _mm512x4_set_pd(
+	double e7, double e6, double e5, double e4,
+	double e3, double e2, double e1, double e0
+) {
+	__m512dx4 ret;
+	ret.val[0] = _mm512_set_pd(e7, e6, e5, e4, e3, e2, e1, e0);
+	ret.val[1] = _mm512_setzero_pd();
+	ret.val[2] = _mm512_setzero_pd();
+	ret.val[3] = _mm512_setzero_pd();
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 setr (set reverse) functions
+//------------------------------------------------------------------------------
+
+static inline __m512dx4 _mm512x4_setr_pdx4(
+	const Float64x4 e7, const Float64x4 e6, const Float64x4 e5, const Float64x4 e4,
+	const Float64x4 e3, const Float64x4 e2, const Float64x4 e1, const Float64x4 e0
+) {
+	__m512dx4 ret;
+	ret.val[0] = _mm512_setr_pd(
+		e7.val[0], e6.val[0], e5.val[0], e4.val[0], e3.val[0], e2.val[0], e1.val[0], e0.val[0]
+	);
+	ret.val[1] = _mm512_setr_pd(
+		e7.val[1], e6.val[1], e5.val[1], e4.val[1], e3.val[1], e2.val[1], e1.val[1], e0.val[1]
+	);
+	ret.val[2] = _mm512_setr_pd(
+		e7.val[2], e6.val[2], e5.val[2], e4.val[2], e3.val[2], e2.val[2], e1.val[2], e0.val[2]
+	);
+	ret.val[3] = _mm512_setr_pd(
+		e7.val[3], e6.val[3], e5.val[3], e4.val[3], e3.val[3], e2.val[3], e1.val[3], e0.val[3]
+	);
+	return ret;
+}
+
+static inline __m512dx4 _mm512x4_setr_pdx2(
+	const Float64x2 e7, const Float64x2 e6, const Float64x2 e5, const Float64x2 e4,
+	const Float64x2 e3, const Float64x2 e2, const Float64x2 e1, const Float64x2 e0
+) {
+	__m512dx4 ret;
+	ret.val[0] = _mm512_setr_pd(e7.hi, e6.hi, e5.hi, e4.hi, e3.hi, e2.hi, e1.hi, e0.hi);
+	ret.val[1] = _mm512_setr_pd(e7.lo, e6.lo, e5.lo, e4.lo, e3.lo, e2.lo, e1.lo, e0.lo);
+	ret.val[2] = _mm512_setzero_pd();
+	ret.val[3] = _mm512_setzero_pd();
+	return ret;
+}
+
+static inline __m512dx4 _mm512x4_setr_pd(
+	double e7, double e6, double e5, double e4,
+	double e3, double e2, double e1, double e0
+) {
+	__m512dx4 ret;
+	ret.val[0] = _mm512_setr_pd(e7, e6, e5, e4, e3, e2, e1, e0);
+	ret.val[1] = _mm512_setzero_pd();
+	ret.val[2] = _mm512_setzero_pd();
+	ret.val[3] = _mm512_setzero_pd();
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 transpose
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Converts eight consecutive Float64x4 values into a __m512dx4.
+ * x.val[0] holds {e0, e1}, x.val[1] holds {e2, e3} and so on.
+ */
+static inline __m512dx4 _mm512x4_transpose_pdx4(__m512dx4 x) {
+	const __m512i idx_lo = _mm512_setr_epi64(0, 4,  8, 12, 1, 5,  9, 13);
+	const __m512i idx_hi = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+	__m512d temp[4];
+	// e0.0, e1.0, e2.0, e3.0, e0.1, e1.1, e2.1, e3.1
+	temp[0] = _mm512_permutex2var_pd(x.val[0], idx_lo, x.val[1]);
+	// e0.2, e1.2, e2.2, e3.2, e0.3, e1.3, e2.3, e3.3
+	temp[1] = _mm512_permutex2var_pd(x.val[0], idx_hi, x.val[1]);
+	// e4.0, e5.0, e6.0, e7.0, e4.1, e5.1, e6.1, e7.1
+	temp[2] = _mm512_permutex2var_pd(x.val[2], idx_lo, x.val[3]);
+	// e4.2, e5.2, e6.2, e7.2, e4.3, e5.3, e6.3, e7.3
+	temp[3] = _mm512_permutex2var_pd(x.val[2], idx_hi, x.val[3]);
+	x.val[0] = _mm512_shuffle_f64x2(temp[0], temp[2], 0x44);
+	x.val[1] = _mm512_shuffle_f64x2(temp[0], temp[2], 0xEE);
+	x.val[2] = _mm512_shuffle_f64x2(temp[1], temp[3], 0x44);
+	x.val[3] = _mm512_shuffle_f64x2(temp[1], temp[3], 0xEE);
+	return x;
+}
+
+/**
+ * @brief Converts a __m512dx4 into eight consecutive Float64x4 values.
+ * Inverse of _mm512x4_transpose_pdx4.
+ */
+static inline __m512dx4 _mm512x4_untranspose_pdx4(__m512dx4 x) {
+	const __m512i idx_lo = _mm512_setr_epi64(0, 4,  8, 12, 1, 5,  9, 13);
+	const __m512i idx_hi = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+	__m512d temp[4];
+	// e0.0, e1.0, e2.0, e3.0, e0.1, e1.1, e2.1, e3.1
+	temp[0] = _mm512_shuffle_f64x2(x.val[0], x.val[1], 0x44);
+	// e4.0, e5.0, e6.0, e7.0, e4.1, e5.1, e6.1, e7.1
+	temp[1] = _mm512_shuffle_f64x2(x.val[0], x.val[1], 0xEE);
+	// e0.2, e1.2, e2.2, e3.2, e0.3, e1.3, e2.3, e3.3
+	temp[2] = _mm512_shuffle_f64x2(x.val[2], x.val[3], 0x44);
+	// e4.2, e5.2, e6.2, e7.2, e4.3, e5.3, e6.3, e7.3
+	temp[3] = _mm512_shuffle_f64x2(x.val[2], x.val[3], 0xEE);
+	x.val[0] = _mm512_permutex2var_pd(temp[0], idx_lo, temp[2]);
+	x.val[1] = _mm512_permutex2var_pd(temp[0], idx_hi, temp[2]);
+	x.val[2] = _mm512_permutex2var_pd(temp[1], idx_lo, temp[3]);
+	x.val[3] = _mm512_permutex2var_pd(temp[1], idx_hi, temp[3]);
+	return x;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 load operations
+//------------------------------------------------------------------------------
+
+/**
+ * @note mem_addr must be aligned on a 64-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline __m512dx4 _mm512x4_load_pd(const double* mem_addr) {
+	__m512dx4 ret;
+	ret.val[0] = _mm512_load_pd(mem_addr +  0);
+	ret.val[1] = _mm512_load_pd(mem_addr +  8);
+	ret.val[2] = _mm512_load_pd(mem_addr + 16);
+	ret.val[3] = _mm512_load_pd(mem_addr + 24);
+	return _mm512x4_transpose_pdx4(ret);
+}
+
+static inline __m512dx4 _mm512x4_loadu_pd(const double* mem_addr) {
+	__m512dx4 ret;
+	ret.val[0] = _mm512_loadu_pd(mem_addr +  0);
+	ret.val[1] = _mm512_loadu_pd(mem_addr +  8);
+	ret.val[2] = _mm512_loadu_pd(mem_addr + 16);
+	ret.val[3] = _mm512_loadu_pd(mem_addr + 24);
+	return _mm512x4_transpose_pdx4(ret);
+}
+
+/**
+ * @note mem_addr must be aligned on a 64-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline __m512dx4 _mm512x4_load_pdx4(const Float64x4* mem_addr) {
+	return _mm512x4_load_pd((const double*)((const void*)mem_addr));
+}
+
+static inline __m512dx4 _mm512x4_loadu_pdx4(const Float64x4* mem_addr) {
+	return _mm512x4_loadu_pd((const double*)((const void*)mem_addr));
+}
+
+/**
+ * @note mem_addr must be aligned on a 64-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline __m512dx4 _mm512x4_load_raw_pd(const double* mem_addr) {
+	__m512dx4 ret;
+	ret.val[0] = _mm512_load_pd(mem_addr +  0);
+	ret.val[1] = _mm512_load_pd(mem_addr +  8);
+	ret.val[2] = _mm512_load_pd(mem_addr + 16);
+	ret.val[3] = _mm512_load_pd(mem_addr + 24);
+	return ret;
+}
+
+static inline __m512dx4 _mm512x4_loadu_raw_pd(const double* mem_addr) {
+	__m512dx4 ret;
+	ret.val[0] = _mm512_loadu_pd(mem_addr +  0);
+	ret.val[1] = _mm512_loadu_pd(mem_addr +  8);
+	ret.val[2] = _mm512_loadu_pd(mem_addr + 16);
+	ret.val[3] = _mm512_loadu_pd(mem_addr + 24);
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 store operations
+//------------------------------------------------------------------------------
+
+/**
+ * @note mem_addr must be aligned on a 64-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline void _mm512x4_store_pd(double* mem_addr, __m512dx4 src) {
+	src = _mm512x4_untranspose_pdx4(src);
+	_mm512_store_pd(mem_addr +  0, src.val[0]);
+	_mm512_store_pd(mem_addr +  8, src.val[1]);
+	_mm512_store_pd(mem_addr + 16, src.val[2]);
+	_mm512_store_pd(mem_addr + 24, src.val[3]);
+}
+
+static inline void _mm512x4_storeu_pd(double* mem_addr, __m512dx4 src) {
+	src = _mm512x4_untranspose_pdx4(src);
+	_mm512_storeu_pd(mem_addr +  0, src.val[0]);
+	_mm512_storeu_pd(mem_addr +  8, src.val[1]);
+	_mm512_storeu_pd(mem_addr + 16, src.val[2]);
+	_mm512_storeu_pd(mem_addr + 24, src.val[3]);
+}
+
+/**
+ * @note mem_addr must be aligned on a 64-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline void _mm512x4_store_pdx4(Float64x4* mem_addr, __m512dx4 src) {
+	_mm512x4_store_pd((double*)((void*)mem_addr), src);
+}
+
+static inline void _mm512x4_storeu_pdx4(Float64x4* mem_addr, __m512dx4 src) {
+	_mm512x4_storeu_pd((double*)((void*)mem_addr), src);
+}
+
+/**
+ * @note mem_addr must be aligned on a 64-byte boundary or a general-protection
+ * exception may be generated.
+ */
+static inline void _mm512_store_raw_pdx4(double* mem_addr, __m512dx4 src) {
+	_mm512_store_pd(mem_addr +  0, src.val[0]);
+	_mm512_store_pd(mem_addr +  8, src.val[1]);
+	_mm512_store_pd(mem_addr + 16, src.val[2]);
+	_mm512_store_pd(mem_addr + 24, src.val[3]);
+}
+
+static inline void _mm512_storeu_raw_pdx4(double* mem_addr, __m512dx4 src) {
+	_mm512_storeu_pd(mem_addr +  0, src.val[0]);
+	_mm512_storeu_pd(mem_addr +  8, src.val[1]);
+	_mm512_storeu_pd(mem_addr + 16, src.val[2]);
+	_mm512_storeu_pd(mem_addr + 24, src.val[3]);
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 bitwise operations
+//------------------------------------------------------------------------------
+
+/**
+ * @brief bitwise not `~x`
+ */
+static inline __m512dx4 _mm512x4_not_pdx4(__m512dx4 x) {
+	x.val[0] = _mm512_castsi512_pd(_mm512_ternarylogic_epi64(
+		_mm512_castpd_si512(x.val[0]), _mm512_castpd_si512(x.val[0]), _mm512_castpd_si512(x.val[0]), 0x01
+	));
+	x.val[1] = _mm512_castsi512_pd(_mm512_ternarylogic_epi64(
+		_mm512_castpd_si512(x.val[1]), _mm512_castpd_si512(x.val[1]), _mm512_castpd_si512(x.val[1]), 0x01
+	));
+	x.val[2] = _mm512_castsi512_pd(_mm512_ternarylogic_epi64(
+		_mm512_castpd_si512(x.val[2]), _mm512_castpd_si512(x.val[2]), _mm512_castpd_si512(x.val[2]), 0x01
+	));
+	x.val[3] = _mm512_castsi512_pd(_mm512_ternarylogic_epi64(
+		_mm512_castpd_si512(x.val[3]), _mm512_castpd_si512(x.val[3]), _mm512_castpd_si512(x.val[3]), 0x01
+	));
+	return x;
+}
+
+/**
+ * @brief bitwise and `x & y`
+ */
+static inline __m512dx4 _mm512x4_and_pdx4(__m512dx4 x, const __m512dx4 y) {
+	x.val[0] = _mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(x.val[0]), _mm512_castpd_si512(y.val[0])));
+	x.val[1] = _mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(x.val[1]), _mm512_castpd_si512(y.val[1])));
+	x.val[2] = _mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(x.val[2]), _mm512_castpd_si512(y.val[2])));
+	x.val[3] = _mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(x.val[3]), _mm512_castpd_si512(y.val[3])));
+	return x;
+}
+
+/**
+ * @brief bitwise andnot `~x & y`
+ */
+static inline __m512dx4 _mm512x4_andnot_pdx4(__m512dx4 x, const __m512dx4 y) {
+	x.val[0] = _mm512_castsi512_pd(_mm512_andnot_si512(_mm512_castpd_si512(x.val[0]), _mm512_castpd_si512(y.val[0])));
+	x.val[1] = _mm512_castsi512_pd(_mm512_andnot_si512(_mm512_castpd_si512(x.val[1]), _mm512_castpd_si512(y.val[1])));
+	x.val[2] = _mm512_castsi512_pd(_mm512_andnot_si512(_mm512_castpd_si512(x.val[2]), _mm512_castpd_si512(y.val[2])));
+	x.val[3] = _mm512_castsi512_pd(_mm512_andnot_si512(_mm512_castpd_si512(x.val[3]), _mm512_castpd_si512(y.val[3])));
+	return x;
+}
+
+/**
+ * @brief bitwise or `x | y`
+ */
+static inline __m512dx4 _mm512x4_or_pdx4(__m512dx4 x, const __m512dx4 y) {
+	x.val[0] = _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x.val[0]), _mm512_castpd_si512(y.val[0])));
+	x.val[1] = _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x.val[1]), _mm512_castpd_si512(y.val[1])));
+	x.val[2] = _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x.val[2]), _mm512_castpd_si512(y.val[2])));
+	x.val[3] = _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(x.val[3]), _mm512_castpd_si512(y.val[3])));
+	return x;
+}
+
+/**
+ * @brief bitwise xor `x ^ y`
+ */
+static inline __m512dx4 _mm512x4_xor_pdx4(__m512dx4 x, const __m512dx4 y) {
+	x.val[0] = _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(x.val[0]), _mm512_castpd_si512(y.val[0])));
+	x.val[1] = _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(x.val[1]), _mm512_castpd_si512(y.val[1])));
+	x.val[2] = _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(x.val[2]), _mm512_castpd_si512(y.val[2])));
+	x.val[3] = _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(x.val[3]), _mm512_castpd_si512(y.val[3])));
+	return x;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 masked operations
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Selects y where the mask is set, and x otherwise.
+ * Replaces the blendv emulation used by __m256dx4.
+ */
+static inline __m512dx4 _mm512x4_mask_blend_pdx4(__mmask8 k, __m512dx4 x, const __m512dx4 y) {
+	x.val[0] = _mm512_mask_blend_pd(k, x.val[0], y.val[0]);
+	x.val[1] = _mm512_mask_blend_pd(k, x.val[1], y.val[1]);
+	x.val[2] = _mm512_mask_blend_pd(k, x.val[2], y.val[2]);
+	x.val[3] = _mm512_mask_blend_pd(k, x.val[3], y.val[3]);
+	return x;
+}
+
+/**
+ * @brief Zeros the lanes where the mask is not set.
+ */
+static inline __m512dx4 _mm512x4_maskz_mov_pdx4(__mmask8 k, __m512dx4 x) {
+	x.val[0] = _mm512_maskz_mov_pd(k, x.val[0]);
+	x.val[1] = _mm512_maskz_mov_pd(k, x.val[1]);
+	x.val[2] = _mm512_maskz_mov_pd(k, x.val[2]);
+	x.val[3] = _mm512_maskz_mov_pd(k, x.val[3]);
+	return x;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 comparison functions
+//------------------------------------------------------------------------------
+
+/* __m512dx4 compare __m512dx4 */
+
+	/**
+	 * @brief _CMP_ORD_Q
+	 */
+	static inline __mmask8 _mm512_cmpord_pdx4_mask(__m512dx4 x, __m512dx4 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.val[0], y.val[0], _CMP_ORD_Q);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, x.val[1], y.val[1], _CMP_ORD_Q);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, x.val[2], y.val[2], _CMP_ORD_Q);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, x.val[3], y.val[3], _CMP_ORD_Q);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_UNORD_Q
+	 */
+	static inline __mmask8 _mm512_cmpunord_pdx4_mask(__m512dx4 x, __m512dx4 y) {
+		return
+			_mm512_cmp_pd_mask(x.val[0], y.val[0], _CMP_UNORD_Q) |
+			_mm512_cmp_pd_mask(x.val[1], y.val[1], _CMP_UNORD_Q) |
+			_mm512_cmp_pd_mask(x.val[2], y.val[2], _CMP_UNORD_Q) |
+			_mm512_cmp_pd_mask(x.val[3], y.val[3], _CMP_UNORD_Q);
+	}
+
+	/**
+	 * @brief _CMP_EQ_OQ
+	 */
+	static inline __mmask8 _mm512_cmpeq_pdx4_mask(__m512dx4 x, __m512dx4 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.val[0], y.val[0], _CMP_EQ_OQ);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, x.val[1], y.val[1], _CMP_EQ_OQ);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, x.val[2], y.val[2], _CMP_EQ_OQ);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, x.val[3], y.val[3], _CMP_EQ_OQ);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_NEQ_OQ
+	 */
+	static inline __mmask8 _mm512_cmpneq_pdx4_mask(__m512dx4 x, __m512dx4 y) {
+		return
+			_mm512_cmp_pd_mask(x.val[0], y.val[0], _CMP_NEQ_OQ) |
+			_mm512_cmp_pd_mask(x.val[1], y.val[1], _CMP_NEQ_OQ) |
+			_mm512_cmp_pd_mask(x.val[2], y.val[2], _CMP_NEQ_OQ) |
+			_mm512_cmp_pd_mask(x.val[3], y.val[3], _CMP_NEQ_OQ);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_UQ
+	 */
+	static inline __mmask8 _mm512_cmplg_pdx4_mask(__m512dx4 x, __m512dx4 y) {
+		return
+			_mm512_cmp_pd_mask(x.val[0], y.val[0], _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(x.val[1], y.val[1], _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(x.val[2], y.val[2], _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(x.val[3], y.val[3], _CMP_NEQ_UQ);
+	}
+
+	/**
+	 * @brief _CMP_EQ_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnlg_pdx4_mask(__m512dx4 x, __m512dx4 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.val[0], y.val[0], _CMP_EQ_UQ);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, x.val[1], y.val[1], _CMP_EQ_UQ);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, x.val[2], y.val[2], _CMP_EQ_UQ);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, x.val[3], y.val[3], _CMP_EQ_UQ);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_LT_OQ
+	 */
+	static inline __mmask8 _mm512_cmplt_pdx4_mask(__m512dx4 x, __m512dx4 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.val[3], y.val[3], _CMP_LT_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[2], y.val[2], _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[2], y.val[2], _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[1], y.val[1], _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[1], y.val[1], _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[0], y.val[0], _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[0], y.val[0], _CMP_EQ_OQ);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_LE_OQ
+	 */
+	static inline __mmask8 _mm512_cmple_pdx4_mask(__m512dx4 x, __m512dx4 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.val[3], y.val[3], _CMP_LE_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[2], y.val[2], _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[2], y.val[2], _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[1], y.val[1], _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[1], y.val[1], _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[0], y.val[0], _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[0], y.val[0], _CMP_EQ_OQ);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_GT_OQ
+	 */
+	static inline __mmask8 _mm512_cmpgt_pdx4_mask(__m512dx4 x, __m512dx4 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.val[3], y.val[3], _CMP_GT_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[2], y.val[2], _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[2], y.val[2], _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[1], y.val[1], _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[1], y.val[1], _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[0], y.val[0], _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[0], y.val[0], _CMP_EQ_OQ);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_GE_OQ
+	 */
+	static inline __mmask8 _mm512_cmpge_pdx4_mask(__m512dx4 x, __m512dx4 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.val[3], y.val[3], _CMP_GE_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[2], y.val[2], _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[2], y.val[2], _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[1], y.val[1], _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[1], y.val[1], _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[0], y.val[0], _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[0], y.val[0], _CMP_EQ_OQ);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_NLT_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnlt_pdx4_mask(__m512dx4 x, __m512dx4 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.val[3], y.val[3], _CMP_NLT_UQ);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[2], y.val[2], _CMP_NEQ_UQ) | cmp,
+			x.val[2], y.val[2], _CMP_NLT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[1], y.val[1], _CMP_NEQ_UQ) | cmp,
+			x.val[1], y.val[1], _CMP_NLT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[0], y.val[0], _CMP_NEQ_UQ) | cmp,
+			x.val[0], y.val[0], _CMP_NLT_UQ
+		);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_NLE_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnle_pdx4_mask(__m512dx4 x, __m512dx4 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.val[3], y.val[3], _CMP_NLE_UQ);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[2], y.val[2], _CMP_NEQ_UQ) | cmp,
+			x.val[2], y.val[2], _CMP_NLT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[1], y.val[1], _CMP_NEQ_UQ) | cmp,
+			x.val[1], y.val[1], _CMP_NLT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[0], y.val[0], _CMP_NEQ_UQ) | cmp,
+			x.val[0], y.val[0], _CMP_NLT_UQ
+		);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_NGT_UQ
+	 */
+	static inline __mmask8 _mm512_cmpngt_pdx4_mask(__m512dx4 x, __m512dx4 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.val[3], y.val[3], _CMP_NGT_UQ);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[2], y.val[2], _CMP_NEQ_UQ) | cmp,
+			x.val[2], y.val[2], _CMP_NGT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[1], y.val[1], _CMP_NEQ_UQ) | cmp,
+			x.val[1], y.val[1], _CMP_NGT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[0], y.val[0], _CMP_NEQ_UQ) | cmp,
+			x.val[0], y.val[0], _CMP_NGT_UQ
+		);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_NGE_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnge_pdx4_mask(__m512dx4 x, __m512dx4 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.val[3], y.val[3], _CMP_NGE_UQ);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[2], y.val[2], _CMP_NEQ_UQ) | cmp,
+			x.val[2], y.val[2], _CMP_NGT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[1], y.val[1], _CMP_NEQ_UQ) | cmp,
+			x.val[1], y.val[1], _CMP_NGT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[0], y.val[0], _CMP_NEQ_UQ) | cmp,
+			x.val[0], y.val[0], _CMP_NGT_UQ
+		);
+		return cmp;
+	}
+
+/* __m512dx4 compare __m512dx2 */
+
+	/**
+	 * @brief _CMP_ORD_Q
+	 */
+	static inline __mmask8 _mm512_cmpord_pdx4_pdx2_mask(__m512dx4 x, __m512dx2 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.val[0], y.hi, _CMP_ORD_Q);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, x.val[1], y.lo, _CMP_ORD_Q);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, x.val[2], _mm512_setzero_pd(), _CMP_ORD_Q);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, x.val[3], _mm512_setzero_pd(), _CMP_ORD_Q);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_UNORD_Q
+	 */
+	static inline __mmask8 _mm512_cmpunord_pdx4_pdx2_mask(__m512dx4 x, __m512dx2 y) {
+		return
+			_mm512_cmp_pd_mask(x.val[0], y.hi, _CMP_UNORD_Q) |
+			_mm512_cmp_pd_mask(x.val[1], y.lo, _CMP_UNORD_Q) |
+			_mm512_cmp_pd_mask(x.val[2], _mm512_setzero_pd(), _CMP_UNORD_Q) |
+			_mm512_cmp_pd_mask(x.val[3], _mm512_setzero_pd(), _CMP_UNORD_Q);
+	}
+
+	/**
+	 * @brief _CMP_EQ_OQ
+	 */
+	static inline __mmask8 _mm512_cmpeq_pdx4_pdx2_mask(__m512dx4 x, __m512dx2 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.val[0], y.hi, _CMP_EQ_OQ);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, x.val[1], y.lo, _CMP_EQ_OQ);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, x.val[2], _mm512_setzero_pd(), _CMP_EQ_OQ);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, x.val[3], _mm512_setzero_pd(), _CMP_EQ_OQ);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_NEQ_OQ
+	 */
+	static inline __mmask8 _mm512_cmpneq_pdx4_pdx2_mask(__m512dx4 x, __m512dx2 y) {
+		return
+			_mm512_cmp_pd_mask(x.val[0], y.hi, _CMP_NEQ_OQ) |
+			_mm512_cmp_pd_mask(x.val[1], y.lo, _CMP_NEQ_OQ) |
+			_mm512_cmp_pd_mask(x.val[2], _mm512_setzero_pd(), _CMP_NEQ_OQ) |
+			_mm512_cmp_pd_mask(x.val[3], _mm512_setzero_pd(), _CMP_NEQ_OQ);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_UQ
+	 */
+	static inline __mmask8 _mm512_cmplg_pdx4_pdx2_mask(__m512dx4 x, __m512dx2 y) {
+		return
+			_mm512_cmp_pd_mask(x.val[0], y.hi, _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(x.val[1], y.lo, _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(x.val[2], _mm512_setzero_pd(), _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(x.val[3], _mm512_setzero_pd(), _CMP_NEQ_UQ);
+	}
+
+	/**
+	 * @brief _CMP_EQ_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnlg_pdx4_pdx2_mask(__m512dx4 x, __m512dx2 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.val[0], y.hi, _CMP_EQ_UQ);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, x.val[1], y.lo, _CMP_EQ_UQ);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, x.val[2], _mm512_setzero_pd(), _CMP_EQ_UQ);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, x.val[3], _mm512_setzero_pd(), _CMP_EQ_UQ);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_LT_OQ
+	 */
+	static inline __mmask8 _mm512_cmplt_pdx4_pdx2_mask(__m512dx4 x, __m512dx2 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.val[3], _mm512_setzero_pd(), _CMP_LT_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[2], _mm512_setzero_pd(), _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[2], _mm512_setzero_pd(), _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[1], y.lo, _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[1], y.lo, _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[0], y.hi, _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[0], y.hi, _CMP_EQ_OQ);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_LE_OQ
+	 */
+	static inline __mmask8 _mm512_cmple_pdx4_pdx2_mask(__m512dx4 x, __m512dx2 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.val[3], _mm512_setzero_pd(), _CMP_LE_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[2], _mm512_setzero_pd(), _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[2], _mm512_setzero_pd(), _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[1], y.lo, _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[1], y.lo, _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[0], y.hi, _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[0], y.hi, _CMP_EQ_OQ);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_GT_OQ
+	 */
+	static inline __mmask8 _mm512_cmpgt_pdx4_pdx2_mask(__m512dx4 x, __m512dx2 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.val[3], _mm512_setzero_pd(), _CMP_GT_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[2], _mm512_setzero_pd(), _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[2], _mm512_setzero_pd(), _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[1], y.lo, _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[1], y.lo, _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[0], y.hi, _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[0], y.hi, _CMP_EQ_OQ);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_GE_OQ
+	 */
+	static inline __mmask8 _mm512_cmpge_pdx4_pdx2_mask(__m512dx4 x, __m512dx2 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.val[3], _mm512_setzero_pd(), _CMP_GE_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[2], _mm512_setzero_pd(), _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[2], _mm512_setzero_pd(), _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[1], y.lo, _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[1], y.lo, _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.val[0], y.hi, _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.val[0], y.hi, _CMP_EQ_OQ);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_NLT_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnlt_pdx4_pdx2_mask(__m512dx4 x, __m512dx2 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.val[3], _mm512_setzero_pd(), _CMP_NLT_UQ);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[2], _mm512_setzero_pd(), _CMP_NEQ_UQ) | cmp,
+			x.val[2], _mm512_setzero_pd(), _CMP_NLT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[1], y.lo, _CMP_NEQ_UQ) | cmp,
+			x.val[1], y.lo, _CMP_NLT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[0], y.hi, _CMP_NEQ_UQ) | cmp,
+			x.val[0], y.hi, _CMP_NLT_UQ
+		);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_NLE_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnle_pdx4_pdx2_mask(__m512dx4 x, __m512dx2 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.val[3], _mm512_setzero_pd(), _CMP_NLE_UQ);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[2], _mm512_setzero_pd(), _CMP_NEQ_UQ) | cmp,
+			x.val[2], _mm512_setzero_pd(), _CMP_NLT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[1], y.lo, _CMP_NEQ_UQ) | cmp,
+			x.val[1], y.lo, _CMP_NLT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[0], y.hi, _CMP_NEQ_UQ) | cmp,
+			x.val[0], y.hi, _CMP_NLT_UQ
+		);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_NGT_UQ
+	 */
+	static inline __mmask8 _mm512_cmpngt_pdx4_pdx2_mask(__m512dx4 x, __m512dx2 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.val[3], _mm512_setzero_pd(), _CMP_NGT_UQ);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[2], _mm512_setzero_pd(), _CMP_NEQ_UQ) | cmp,
+			x.val[2], _mm512_setzero_pd(), _CMP_NGT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[1], y.lo, _CMP_NEQ_UQ) | cmp,
+			x.val[1], y.lo, _CMP_NGT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[0], y.hi, _CMP_NEQ_UQ) | cmp,
+			x.val[0], y.hi, _CMP_NGT_UQ
+		);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_NGE_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnge_pdx4_pdx2_mask(__m512dx4 x, __m512dx2 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.val[3], _mm512_setzero_pd(), _CMP_NGE_UQ);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[2], _mm512_setzero_pd(), _CMP_NEQ_UQ) | cmp,
+			x.val[2], _mm512_setzero_pd(), _CMP_NGT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[1], y.lo, _CMP_NEQ_UQ) | cmp,
+			x.val[1], y.lo, _CMP_NGT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[0], y.hi, _CMP_NEQ_UQ) | cmp,
+			x.val[0], y.hi, _CMP_NGT_UQ
+		);
+		return cmp;
+	}
+
+/* __m512dx2 compare __m512dx4 */
+
+	/**
+	 * @brief _CMP_ORD_Q
+	 */
+	static inline __mmask8 _mm512_cmpord_pdx2_pdx4_mask(__m512dx2 x, __m512dx4 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.hi, y.val[0], _CMP_ORD_Q);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, x.lo, y.val[1], _CMP_ORD_Q);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, _mm512_setzero_pd(), y.val[2], _CMP_ORD_Q);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, _mm512_setzero_pd(), y.val[3], _CMP_ORD_Q);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_UNORD_Q
+	 */
+	static inline __mmask8 _mm512_cmpunord_pdx2_pdx4_mask(__m512dx2 x, __m512dx4 y) {
+		return
+			_mm512_cmp_pd_mask(x.hi, y.val[0], _CMP_UNORD_Q) |
+			_mm512_cmp_pd_mask(x.lo, y.val[1], _CMP_UNORD_Q) |
+			_mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[2], _CMP_UNORD_Q) |
+			_mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[3], _CMP_UNORD_Q);
+	}
+
+	/**
+	 * @brief _CMP_EQ_OQ
+	 */
+	static inline __mmask8 _mm512_cmpeq_pdx2_pdx4_mask(__m512dx2 x, __m512dx4 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.hi, y.val[0], _CMP_EQ_OQ);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, x.lo, y.val[1], _CMP_EQ_OQ);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, _mm512_setzero_pd(), y.val[2], _CMP_EQ_OQ);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, _mm512_setzero_pd(), y.val[3], _CMP_EQ_OQ);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_NEQ_OQ
+	 */
+	static inline __mmask8 _mm512_cmpneq_pdx2_pdx4_mask(__m512dx2 x, __m512dx4 y) {
+		return
+			_mm512_cmp_pd_mask(x.hi, y.val[0], _CMP_NEQ_OQ) |
+			_mm512_cmp_pd_mask(x.lo, y.val[1], _CMP_NEQ_OQ) |
+			_mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[2], _CMP_NEQ_OQ) |
+			_mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[3], _CMP_NEQ_OQ);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_UQ
+	 */
+	static inline __mmask8 _mm512_cmplg_pdx2_pdx4_mask(__m512dx2 x, __m512dx4 y) {
+		return
+			_mm512_cmp_pd_mask(x.hi, y.val[0], _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(x.lo, y.val[1], _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[2], _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[3], _CMP_NEQ_UQ);
+	}
+
+	/**
+	 * @brief _CMP_EQ_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnlg_pdx2_pdx4_mask(__m512dx2 x, __m512dx4 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(x.hi, y.val[0], _CMP_EQ_UQ);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, x.lo, y.val[1], _CMP_EQ_UQ);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, _mm512_setzero_pd(), y.val[2], _CMP_EQ_UQ);
+		cmp = _mm512_mask_cmp_pd_mask(cmp, _mm512_setzero_pd(), y.val[3], _CMP_EQ_UQ);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_LT_OQ
+	 */
+	static inline __mmask8 _mm512_cmplt_pdx2_pdx4_mask(__m512dx2 x, __m512dx4 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[3], _CMP_LT_OQ);
+		cmp = _mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[2], _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, _mm512_setzero_pd(), y.val[2], _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.lo, y.val[1], _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.lo, y.val[1], _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.hi, y.val[0], _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.hi, y.val[0], _CMP_EQ_OQ);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_LE_OQ
+	 */
+	static inline __mmask8 _mm512_cmple_pdx2_pdx4_mask(__m512dx2 x, __m512dx4 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[3], _CMP_LE_OQ);
+		cmp = _mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[2], _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, _mm512_setzero_pd(), y.val[2], _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.lo, y.val[1], _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.lo, y.val[1], _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.hi, y.val[0], _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.hi, y.val[0], _CMP_EQ_OQ);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_GT_OQ
+	 */
+	static inline __mmask8 _mm512_cmpgt_pdx2_pdx4_mask(__m512dx2 x, __m512dx4 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[3], _CMP_GT_OQ);
+		cmp = _mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[2], _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, _mm512_setzero_pd(), y.val[2], _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.lo, y.val[1], _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.lo, y.val[1], _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.hi, y.val[0], _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.hi, y.val[0], _CMP_EQ_OQ);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_GE_OQ
+	 */
+	static inline __mmask8 _mm512_cmpge_pdx2_pdx4_mask(__m512dx2 x, __m512dx4 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[3], _CMP_GE_OQ);
+		cmp = _mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[2], _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, _mm512_setzero_pd(), y.val[2], _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.lo, y.val[1], _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.lo, y.val[1], _CMP_EQ_OQ);
+		cmp = _mm512_cmp_pd_mask(x.hi, y.val[0], _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(cmp, x.hi, y.val[0], _CMP_EQ_OQ);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_NLT_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnlt_pdx2_pdx4_mask(__m512dx2 x, __m512dx4 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[3], _CMP_NLT_UQ);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[2], _CMP_NEQ_UQ) | cmp,
+			_mm512_setzero_pd(), y.val[2], _CMP_NLT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.lo, y.val[1], _CMP_NEQ_UQ) | cmp,
+			x.lo, y.val[1], _CMP_NLT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.hi, y.val[0], _CMP_NEQ_UQ) | cmp,
+			x.hi, y.val[0], _CMP_NLT_UQ
+		);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_NLE_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnle_pdx2_pdx4_mask(__m512dx2 x, __m512dx4 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[3], _CMP_NLE_UQ);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[2], _CMP_NEQ_UQ) | cmp,
+			_mm512_setzero_pd(), y.val[2], _CMP_NLT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.lo, y.val[1], _CMP_NEQ_UQ) | cmp,
+			x.lo, y.val[1], _CMP_NLT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.hi, y.val[0], _CMP_NEQ_UQ) | cmp,
+			x.hi, y.val[0], _CMP_NLT_UQ
+		);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_NGT_UQ
+	 */
+	static inline __mmask8 _mm512_cmpngt_pdx2_pdx4_mask(__m512dx2 x, __m512dx4 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[3], _CMP_NGT_UQ);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[2], _CMP_NEQ_UQ) | cmp,
+			_mm512_setzero_pd(), y.val[2], _CMP_NGT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.lo, y.val[1], _CMP_NEQ_UQ) | cmp,
+			x.lo, y.val[1], _CMP_NGT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.hi, y.val[0], _CMP_NEQ_UQ) | cmp,
+			x.hi, y.val[0], _CMP_NGT_UQ
+		);
+		return cmp;
+	}
+
+	/**
+	 * @brief _CMP_NGE_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnge_pdx2_pdx4_mask(__m512dx2 x, __m512dx4 y) {
+		__mmask8 cmp = _mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[3], _CMP_NGE_UQ);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[2], _CMP_NEQ_UQ) | cmp,
+			_mm512_setzero_pd(), y.val[2], _CMP_NGT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.lo, y.val[1], _CMP_NEQ_UQ) | cmp,
+			x.lo, y.val[1], _CMP_NGT_UQ
+		);
+		cmp = _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.hi, y.val[0], _CMP_NEQ_UQ) | cmp,
+			x.hi, y.val[0], _CMP_NGT_UQ
+		);
+		return cmp;
+	}
+
+/* __m512dx4 compare __m512d */
+
+	/**
+	 * @brief _CMP_ORD_Q
+	 */
+	static inline __mmask8 _mm512_cmpord_pdx4_pd_mask(__m512dx4 x, __m512d y) {
+		return _mm512_cmp_pd_mask(x.val[0], y, _CMP_ORD_Q);
+	}
+
+	/**
+	 * @brief _CMP_UNORD_Q
+	 */
+	static inline __mmask8 _mm512_cmpunord_pdx4_pd_mask(__m512dx4 x, __m512d y) {
+		return _mm512_cmp_pd_mask(x.val[0], y, _CMP_UNORD_Q);
+	}
+
+	/**
+	 * @brief _CMP_EQ_OQ
+	 */
+	static inline __mmask8 _mm512_cmpeq_pdx4_pd_mask(__m512dx4 x, __m512d y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[0], y, _CMP_EQ_OQ),
+			x.val[1], _mm512_setzero_pd(), _CMP_EQ_OQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_OQ
+	 */
+	static inline __mmask8 _mm512_cmpneq_pdx4_pd_mask(__m512dx4 x, __m512d y) {
+		return
+			_mm512_cmp_pd_mask(x.val[0], y, _CMP_NEQ_OQ) |
+			_mm512_cmp_pd_mask(x.val[1], _mm512_setzero_pd(), _CMP_NEQ_OQ);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_UQ
+	 */
+	static inline __mmask8 _mm512_cmplg_pdx4_pd_mask(__m512dx4 x, __m512d y) {
+		return
+			_mm512_cmp_pd_mask(x.val[0], y, _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(x.val[1], _mm512_setzero_pd(), _CMP_NEQ_UQ);
+	}
+
+	/**
+	 * @brief _CMP_EQ_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnlg_pdx4_pd_mask(__m512dx4 x, __m512d y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[0], y, _CMP_EQ_UQ),
+			x.val[1], _mm512_setzero_pd(), _CMP_EQ_UQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_LT_OQ
+	 */
+	static inline __mmask8 _mm512_cmplt_pdx4_pd_mask(__m512dx4 x, __m512d y) {
+		return
+			_mm512_cmp_pd_mask(x.val[0], y, _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(
+				_mm512_cmp_pd_mask(x.val[0], y, _CMP_EQ_OQ),
+				x.val[1], _mm512_setzero_pd(), _CMP_LT_OQ
+			);
+	}
+
+	/**
+	 * @brief _CMP_LE_OQ
+	 */
+	static inline __mmask8 _mm512_cmple_pdx4_pd_mask(__m512dx4 x, __m512d y) {
+		return
+			_mm512_cmp_pd_mask(x.val[0], y, _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(
+				_mm512_cmp_pd_mask(x.val[0], y, _CMP_EQ_OQ),
+				x.val[1], _mm512_setzero_pd(), _CMP_LE_OQ
+			);
+	}
+
+	/**
+	 * @brief _CMP_GT_OQ
+	 */
+	static inline __mmask8 _mm512_cmpgt_pdx4_pd_mask(__m512dx4 x, __m512d y) {
+		return
+			_mm512_cmp_pd_mask(x.val[0], y, _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(
+				_mm512_cmp_pd_mask(x.val[0], y, _CMP_EQ_OQ),
+				x.val[1], _mm512_setzero_pd(), _CMP_GT_OQ
+			);
+	}
+
+	/**
+	 * @brief _CMP_GE_OQ
+	 */
+	static inline __mmask8 _mm512_cmpge_pdx4_pd_mask(__m512dx4 x, __m512d y) {
+		return
+			_mm512_cmp_pd_mask(x.val[0], y, _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(
+				_mm512_cmp_pd_mask(x.val[0], y, _CMP_EQ_OQ),
+				x.val[1], _mm512_setzero_pd(), _CMP_GE_OQ
+			);
+	}
+
+	/**
+	 * @brief _CMP_NLT_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnlt_pdx4_pd_mask(__m512dx4 x, __m512d y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[0], y, _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(x.val[1], _mm512_setzero_pd(), _CMP_NLT_UQ),
+			x.val[0], y, _CMP_NLT_UQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_NLE_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnle_pdx4_pd_mask(__m512dx4 x, __m512d y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[0], y, _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(x.val[1], _mm512_setzero_pd(), _CMP_NLE_UQ),
+			x.val[0], y, _CMP_NLT_UQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_NGT_UQ
+	 */
+	static inline __mmask8 _mm512_cmpngt_pdx4_pd_mask(__m512dx4 x, __m512d y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[0], y, _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(x.val[1], _mm512_setzero_pd(), _CMP_NGT_UQ),
+			x.val[0], y, _CMP_NGT_UQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_NGE_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnge_pdx4_pd_mask(__m512dx4 x, __m512d y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x.val[0], y, _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(x.val[1], _mm512_setzero_pd(), _CMP_NGE_UQ),
+			x.val[0], y, _CMP_NGT_UQ
+		);
+	}
+
+/* __m512d compare __m512dx4 */
+
+	/**
+	 * @brief _CMP_ORD_Q
+	 */
+	static inline __mmask8 _mm512_cmpord_pd_pdx4_mask(__m512d x, __m512dx4 y) {
+		return _mm512_cmp_pd_mask(x, y.val[0], _CMP_ORD_Q);
+	}
+
+	/**
+	 * @brief _CMP_UNORD_Q
+	 */
+	static inline __mmask8 _mm512_cmpunord_pd_pdx4_mask(__m512d x, __m512dx4 y) {
+		return _mm512_cmp_pd_mask(x, y.val[0], _CMP_UNORD_Q);
+	}
+
+	/**
+	 * @brief _CMP_EQ_OQ
+	 */
+	static inline __mmask8 _mm512_cmpeq_pd_pdx4_mask(__m512d x, __m512dx4 y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x, y.val[0], _CMP_EQ_OQ),
+			_mm512_setzero_pd(), y.val[1], _CMP_EQ_OQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_OQ
+	 */
+	static inline __mmask8 _mm512_cmpneq_pd_pdx4_mask(__m512d x, __m512dx4 y) {
+		return
+			_mm512_cmp_pd_mask(x, y.val[0], _CMP_NEQ_OQ) |
+			_mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[1], _CMP_NEQ_OQ);
+	}
+
+	/**
+	 * @brief _CMP_NEQ_UQ
+	 */
+	static inline __mmask8 _mm512_cmplg_pd_pdx4_mask(__m512d x, __m512dx4 y) {
+		return
+			_mm512_cmp_pd_mask(x, y.val[0], _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[1], _CMP_NEQ_UQ);
+	}
+
+	/**
+	 * @brief _CMP_EQ_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnlg_pd_pdx4_mask(__m512d x, __m512dx4 y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x, y.val[0], _CMP_EQ_UQ),
+			_mm512_setzero_pd(), y.val[1], _CMP_EQ_UQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_LT_OQ
+	 */
+	static inline __mmask8 _mm512_cmplt_pd_pdx4_mask(__m512d x, __m512dx4 y) {
+		return
+			_mm512_cmp_pd_mask(x, y.val[0], _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(
+				_mm512_cmp_pd_mask(x, y.val[0], _CMP_EQ_OQ),
+				_mm512_setzero_pd(), y.val[1], _CMP_LT_OQ
+			);
+	}
+
+	/**
+	 * @brief _CMP_LE_OQ
+	 */
+	static inline __mmask8 _mm512_cmple_pd_pdx4_mask(__m512d x, __m512dx4 y) {
+		return
+			_mm512_cmp_pd_mask(x, y.val[0], _CMP_LT_OQ) |
+			_mm512_mask_cmp_pd_mask(
+				_mm512_cmp_pd_mask(x, y.val[0], _CMP_EQ_OQ),
+				_mm512_setzero_pd(), y.val[1], _CMP_LE_OQ
+			);
+	}
+
+	/**
+	 * @brief _CMP_GT_OQ
+	 */
+	static inline __mmask8 _mm512_cmpgt_pd_pdx4_mask(__m512d x, __m512dx4 y) {
+		return
+			_mm512_cmp_pd_mask(x, y.val[0], _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(
+				_mm512_cmp_pd_mask(x, y.val[0], _CMP_EQ_OQ),
+				_mm512_setzero_pd(), y.val[1], _CMP_GT_OQ
+			);
+	}
+
+	/**
+	 * @brief _CMP_GE_OQ
+	 */
+	static inline __mmask8 _mm512_cmpge_pd_pdx4_mask(__m512d x, __m512dx4 y) {
+		return
+			_mm512_cmp_pd_mask(x, y.val[0], _CMP_GT_OQ) |
+			_mm512_mask_cmp_pd_mask(
+				_mm512_cmp_pd_mask(x, y.val[0], _CMP_EQ_OQ),
+				_mm512_setzero_pd(), y.val[1], _CMP_GE_OQ
+			);
+	}
+
+	/**
+	 * @brief _CMP_NLT_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnlt_pd_pdx4_mask(__m512d x, __m512dx4 y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x, y.val[0], _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[1], _CMP_NLT_UQ),
+			x, y.val[0], _CMP_NLT_UQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_NLE_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnle_pd_pdx4_mask(__m512d x, __m512dx4 y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x, y.val[0], _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[1], _CMP_NLE_UQ),
+			x, y.val[0], _CMP_NLT_UQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_NGT_UQ
+	 */
+	static inline __mmask8 _mm512_cmpngt_pd_pdx4_mask(__m512d x, __m512dx4 y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x, y.val[0], _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[1], _CMP_NGT_UQ),
+			x, y.val[0], _CMP_NGT_UQ
+		);
+	}
+
+	/**
+	 * @brief _CMP_NGE_UQ
+	 */
+	static inline __mmask8 _mm512_cmpnge_pd_pdx4_mask(__m512d x, __m512dx4 y) {
+		return _mm512_mask_cmp_pd_mask(
+			_mm512_cmp_pd_mask(x, y.val[0], _CMP_NEQ_UQ) |
+			_mm512_cmp_pd_mask(_mm512_setzero_pd(), y.val[1], _CMP_NGE_UQ),
+			x, y.val[0], _CMP_NGT_UQ
+		);
+	}
+
+//------------------------------------------------------------------------------
+// __m512dx4 compare to zero functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief _CMP_EQ_OQ
+ * @note Assumes that if x.val[0] is zero then x.val[1 - 3] are also zero.
+ */
+static inline __mmask8 _mm512_cmpeq_zero_pdx4_mask(__m512dx4 x) {
+	return _mm512_cmp_pd_mask(x.val[0], _mm512_setzero_pd(), _CMP_EQ_OQ);
+}
+
+/**
+ * @brief _CMP_NEQ_OQ
+ * @note Assumes that if x.val[0] is zero then x.val[1 - 3] are also zero.
+ */
+static inline __mmask8 _mm512_cmpneq_zero_pdx4_mask(__m512dx4 x) {
+	return _mm512_cmp_pd_mask(x.val[0], _mm512_setzero_pd(), _CMP_NEQ_OQ);
+}
+
+/**
+ * @brief _CMP_NEQ_UQ
+ * @note Assumes that if x.val[0] is zero then x.val[1 - 3] are also zero.
+ */
+static inline __mmask8 _mm512_cmplg_zero_pdx4_mask(__m512dx4 x) {
+	return _mm512_cmp_pd_mask(x.val[0], _mm512_setzero_pd(), _CMP_NEQ_UQ);
+}
+
+/**
+ * @brief _CMP_EQ_UQ
+ * @note Assumes that if x.val[0] is zero then x.val[1 - 3] are also zero.
+ */
+static inline __mmask8 _mm512_cmpnlg_zero_pdx4_mask(__m512dx4 x) {
+	return _mm512_cmp_pd_mask(x.val[0], _mm512_setzero_pd(), _CMP_EQ_UQ);
+}
+
+/**
+ * @brief _CMP_LT_OQ
+ * @note Assumes that if x.val[0] is zero then x.val[1 - 3] are also zero.
+ */
+static inline __mmask8 _mm512_cmplt_zero_pdx4_mask(__m512dx4 x) {
+	return _mm512_cmp_pd_mask(x.val[0], _mm512_setzero_pd(), _CMP_LT_OQ);
+}
+
+/**
+ * @brief _CMP_LE_OQ
+ * @note Assumes that if x.val[0] is zero then x.val[1 - 3] are also zero.
+ */
+static inline __mmask8 _mm512_cmple_zero_pdx4_mask(__m512dx4 x) {
+	return _mm512_cmp_pd_mask(x.val[0], _mm512_setzero_pd(), _CMP_LE_OQ);
+}
+
+/**
+ * @brief _CMP_GT_OQ
+ * @note Assumes that if x.val[0] is zero then x.val[1 - 3] are also zero.
+ */
+static inline __mmask8 _mm512_cmpgt_zero_pdx4_mask(__m512dx4 x) {
+	return _mm512_cmp_pd_mask(x.val[0], _mm512_setzero_pd(), _CMP_GT_OQ);
+}
+
+/**
+ * @brief _CMP_GE_OQ
+ * @note Assumes that if x.val[0] is zero then x.val[1 - 3] are also zero.
+ */
+static inline __mmask8 _mm512_cmpge_zero_pdx4_mask(__m512dx4 x) {
+	return _mm512_cmp_pd_mask(x.val[0], _mm512_setzero_pd(), _CMP_GE_OQ);
+}
+
+/**
+ * @brief _CMP_NLT_UQ
+ * @note Assumes that if x.val[0] is zero then x.val[1 - 3] are also zero.
+ */
+static inline __mmask8 _mm512_cmpnlt_zero_pdx4_mask(__m512dx4 x) {
+	return _mm512_cmp_pd_mask(x.val[0], _mm512_setzero_pd(), _CMP_NLT_UQ);
+}
+
+/**
+ * @brief _CMP_NLE_UQ
+ * @note Assumes that if x.val[0] is zero then x.val[1 - 3] are also zero.
+ */
+static inline __mmask8 _mm512_cmpnle_zero_pdx4_mask(__m512dx4 x) {
+	return _mm512_cmp_pd_mask(x.val[0], _mm512_setzero_pd(), _CMP_NLE_UQ);
+}
+
+/**
+ * @brief _CMP_NGT_UQ
+ * @note Assumes that if x.val[0] is zero then x.val[1 - 3] are also zero.
+ */
+static inline __mmask8 _mm512_cmpngt_zero_pdx4_mask(__m512dx4 x) {
+	return _mm512_cmp_pd_mask(x.val[0], _mm512_setzero_pd(), _CMP_NGT_UQ);
+}
+
+/**
+ * @brief _CMP_NGE_UQ
+ * @note Assumes that if x.val[0] is zero then x.val[1 - 3] are also zero.
+ */
+static inline __mmask8 _mm512_cmpnge_zero_pdx4_mask(__m512dx4 x) {
+	return _mm512_cmp_pd_mask(x.val[0], _mm512_setzero_pd(), _CMP_NGE_UQ);
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 qd_real functions
+//------------------------------------------------------------------------------
+
+/** 
+ * @author Taken and/or modified from libQD which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+
+/** @brief Computes fl(x + y) and err(x + y). Assumes |x| >= |y|. */
+static inline __m512d _mm512_quick_two_sum_pd(const __m512d x, const __m512d y, __m512d* LDF_restrict const err) {
+	__m512d s = _mm512_add_pd(x, y);
+	*err = _mm512_sub_pd(y, _mm512_sub_pd(s, x));
+	return s;
+}
+
+/** @brief Computes fl(x - y) and err(x - y). Assumes |x| >= |y|. */
+static inline __m512d _mm512_quick_two_diff_pd(const __m512d x, const __m512d y, __m512d* LDF_restrict const err) {
+	__m512d s = _mm512_sub_pd(x, y);
+	*err = _mm512_sub_pd(_mm512_sub_pd(x, s), y);
+	return s;
+}
+
+/** @brief Computes fl(x + y) and err(x + y). */
+static inline __m512d _mm512_two_sum_pd(const __m512d x, const __m512d y, __m512d* LDF_restrict const err) {
+	__m512d s = _mm512_add_pd(x, y);
+	__m512d bb = _mm512_sub_pd(s, x);
+	*err = _mm512_add_pd(
+		_mm512_sub_pd(x, _mm512_sub_pd(s, bb)),
+		_mm512_sub_pd(y, bb)
+	);
+	return s;
+}
+
+/** @brief Computes fl(x - y) and err(x - y). */
+static inline __m512d _mm512_two_diff_pd(const __m512d x, const __m512d y, __m512d* LDF_restrict const err) {
+	__m512d s = _mm512_sub_pd(x, y);
+	__m512d bb = _mm512_sub_pd(s, x);
+	*err = _mm512_sub_pd(
+		_mm512_sub_pd(x, _mm512_sub_pd(s, bb)),
+		_mm512_add_pd(y, bb)
+	);
+	return s;
+}
+
+/** @brief Computes fl(x * y) and err(x * y). */
+static inline __m512d _mm512_two_prod_pd(const __m512d x, const __m512d y, __m512d* LDF_restrict const err) {
+	__m512d p = _mm512_mul_pd(x, y);
+	*err = _mm512_fmsub_pd(x, y, p);
+	return p;
+}
+
+/** @brief Computes fl(x * x) and err(x * x). */
+static inline __m512d _mm512_two_sqr_pd(const __m512d x, __m512d* LDF_restrict const err) {
+	__m512d q = _mm512_mul_pd(x, x);
+	*err = _mm512_fmsub_pd(x, x, q);
+	return q;
+}
+
+/** 
+ * @brief Adds `c` to the dd-pair `(a, b)`. If the result does not fit in two
+ * doubles, then the sum is output into `s` and `(a, b)` contains the
+ * remainder. Otherwise `s` is zero and `(a, b)` contains the sum.
+ */
+static inline __m512d _mm512_quick_three_accum_pd(
+	__m512d* LDF_restrict const a,
+	__m512d* LDF_restrict const b,
+	const __m512d c
+) {
+	__m512d s;
+	__mmask8 za, zb; // bool
+
+	s = _mm512_two_sum_pd(*b, c, b);
+	s = _mm512_two_sum_pd(*a, s, a);
+
+	za = _mm512_cmp_pd_mask(*a, _mm512_setzero_pd(), _CMP_NEQ_UQ);
+	zb = _mm512_cmp_pd_mask(*b, _mm512_setzero_pd(), _CMP_NEQ_UQ);
+
+	*b = _mm512_mask_blend_pd(zb, *a, *b);
+	*a = _mm512_mask_blend_pd(za & zb, s, *a);
+	return _mm512_maskz_mov_pd(za & zb, s);
+}
+
+static inline void _mm512_three_sum_pd(
+	__m512d* LDF_restrict const a,
+	__m512d* LDF_restrict const b,
+	__m512d* LDF_restrict const c
+) {
+	__m512d t1, t2, t3;
+	t1 = _mm512_two_sum_pd(*a, *b, &t2);
+	*a = _mm512_two_sum_pd(*c, t1, &t3);
+	*b = _mm512_two_sum_pd(t2, t3, c  );
+}
+
+static inline void _mm512_three_sum2_pd(
+	__m512d* LDF_restrict const a,
+	__m512d* LDF_restrict const b,
+	const __m512d c
+) {
+	__m512d t1, t2, t3;
+	t1 = _mm512_two_sum_pd(*a, *b, &t2);
+	*a = _mm512_two_sum_pd( c, t1, &t3);
+	*b = _mm512_add_pd(t2, t3);
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 qd_real renormalization
+//------------------------------------------------------------------------------
+
+/**
+ * @brief The branches of qd_real::renorm are evaluated with mask registers.
+ * Each lane follows the same path as the scalar code: zero terms are
+ * skipped, and the non-zero terms are shifted towards val[0].
+ */
+static inline void _mm512x4_accurate_renorm_pdx4(__m512dx4* LDF_restrict const x) {
+	__m512d s0;
+
+	s0        = _mm512_quick_two_sum_pd(x->val[2], x->val[3], &x->val[3]);
+	s0        = _mm512_quick_two_sum_pd(x->val[1],        s0, &x->val[2]);
+	x->val[0] = _mm512_quick_two_sum_pd(x->val[0],        s0, &x->val[1]);
+
+	// if (s1 != 0.0)
+	const __mmask8 cmp_s1 = _mm512_cmp_pd_mask(x->val[1], _mm512_setzero_pd(), _CMP_NEQ_UQ);
+	__m512d a, b, c, d;
+	a = _mm512_mask_blend_pd(cmp_s1, x->val[0], x->val[1]);
+	a = _mm512_quick_two_sum_pd(a, x->val[2], &b);
+
+	// if (s2 != 0.0) or if (s1 != 0.0)
+	const __mmask8 cmp_s2 = _mm512_cmp_pd_mask(b, _mm512_setzero_pd(), _CMP_NEQ_UQ);
+	c = _mm512_mask_blend_pd(cmp_s2, a, b);
+	c = _mm512_quick_two_sum_pd(c, x->val[3], &d);
+
+	// 4 terms: {s0, a, c, d}
+	// 3 terms: {s0, c, d, 0} or {a, c, d, 0}
+	// 2 terms: {c, d, 0, 0}
+	const __m512d e0 = _mm512_mask_blend_pd(cmp_s2, c, a);
+	const __m512d e1 = _mm512_mask_blend_pd(cmp_s2, d, c);
+	const __m512d e2 = _mm512_maskz_mov_pd(cmp_s2, d);
+	x->val[0] = _mm512_mask_blend_pd(cmp_s1, e0, x->val[0]);
+	x->val[1] = _mm512_mask_blend_pd(cmp_s1, e1, e0);
+	x->val[2] = _mm512_mask_blend_pd(cmp_s1, e2, e1);
+	x->val[3] = _mm512_maskz_mov_pd(cmp_s1 & cmp_s2, d);
+
+	const __mmask8 cmp_finite = _mm512_isfinite_pd(x->val[0]);
+	x->val[1] = _mm512_maskz_mov_pd(cmp_finite, x->val[1]);
+	x->val[2] = _mm512_maskz_mov_pd(cmp_finite, x->val[2]);
+	x->val[3] = _mm512_maskz_mov_pd(cmp_finite, x->val[3]);
+}
+
+static inline void _mm512x4_quick_renorm_pdx4(__m512dx4* LDF_restrict const x) {
+	__m512d t0, t1, t2;
+	__m512d s;
+	s         = x->val[3];
+	s         = _mm512_quick_two_sum_pd(x->val[2], s, &t2);
+	s         = _mm512_quick_two_sum_pd(x->val[1], s, &t1);
+	x->val[0] = _mm512_quick_two_sum_pd(x->val[0], s, &t0);
+
+	s         = _mm512_quick_two_sum_pd(t1, t2, &t1);
+	x->val[1] = _mm512_quick_two_sum_pd(t0, s , &t0);
+	x->val[2] = _mm512_quick_two_sum_pd(t0, t1, &t0);
+	x->val[3] = t0;
+}
+
+static inline void _mm512x4_renorm_pdx4(__m512dx4* LDF_restrict const x) {
+	// #ifdef FLOAT64X4_IEEE_MODE
+	// 	_mm512x4_accurate_renorm_pdx4(x);
+	// #else
+		_mm512x4_quick_renorm_pdx4(x);
+	// #endif
+}
+
+/**
+ * @brief The branches of qd_real::renorm are evaluated with mask registers.
+ * pos[i] is set for the lanes where the running sum is stored in val[i],
+ * and a lane only advances when the remainder is non-zero.
+ */
+static inline void _mm512x4_accurate_renorm_err_pdx4(
+	__m512dx4* LDF_restrict const x,
+	__m512d* LDF_restrict const err
+) {
+	const __mmask8 cmp_inf = _mm512_isinf_pd(x->val[0]);
+	const __m512dx4 x_inf = *x;
+	__m512d s0;
+
+	s0        = _mm512_quick_two_sum_pd(x->val[3], *err, err       );
+	s0        = _mm512_quick_two_sum_pd(x->val[2], s0  , &x->val[3]);
+	s0        = _mm512_quick_two_sum_pd(x->val[1], s0  , &x->val[2]);
+	x->val[0] = _mm512_quick_two_sum_pd(x->val[0], s0  , &x->val[1]);
+
+	__m512d sum, rem;
+	__mmask8 cmp_rem;
+	__mmask8 pos[4];
+
+	// if (s1 != 0.0)
+	pos[1] = _mm512_cmp_pd_mask(x->val[1], _mm512_setzero_pd(), _CMP_NEQ_UQ);
+	pos[0] = (__mmask8)~pos[1];
+	pos[2] = 0;
+	pos[3] = 0;
+	sum = _mm512_mask_blend_pd(pos[1], x->val[0], x->val[1]);
+
+	/* s[k] = quick_two_sum(s[k], x->val[2], &s[k + 1]) */
+	sum = _mm512_quick_two_sum_pd(sum, x->val[2], &rem);
+	cmp_rem = _mm512_cmp_pd_mask(rem, _mm512_setzero_pd(), _CMP_NEQ_UQ);
+	x->val[1] = _mm512_mask_mov_pd(x->val[1], pos[1] & cmp_rem, sum);
+	x->val[0] = _mm512_mask_mov_pd(x->val[0], pos[0] & cmp_rem, sum);
+	sum = _mm512_mask_mov_pd(sum, cmp_rem, rem);
+	pos[2] = pos[1] & cmp_rem;
+	pos[1] = (pos[1] & (__mmask8)~cmp_rem) | (pos[0] & cmp_rem);
+	pos[0] = pos[0] & (__mmask8)~cmp_rem;
+
+	/* s[k] = quick_two_sum(s[k], x->val[3], &s[k + 1]) */
+	sum = _mm512_quick_two_sum_pd(sum, x->val[3], &rem);
+	cmp_rem = _mm512_cmp_pd_mask(rem, _mm512_setzero_pd(), _CMP_NEQ_UQ);
+	x->val[2] = _mm512_mask_mov_pd(x->val[2], pos[2] & cmp_rem, sum);
+	x->val[1] = _mm512_mask_mov_pd(x->val[1], pos[1] & cmp_rem, sum);
+	x->val[0] = _mm512_mask_mov_pd(x->val[0], pos[0] & cmp_rem, sum);
+	sum = _mm512_mask_mov_pd(sum, cmp_rem, rem);
+	pos[3] = pos[2] & cmp_rem;
+	pos[2] = (pos[2] & (__mmask8)~cmp_rem) | (pos[1] & cmp_rem);
+	pos[1] = (pos[1] & (__mmask8)~cmp_rem) | (pos[0] & cmp_rem);
+	pos[0] = pos[0] & (__mmask8)~cmp_rem;
+
+	/* s[k] = quick_two_sum(s[k], *err, &s[k + 1]), or s3 += *err */
+	const __m512d sum_3 = _mm512_add_pd(sum, *err);
+	sum = _mm512_quick_two_sum_pd(sum, *err, &rem);
+	cmp_rem = _mm512_cmp_pd_mask(rem, _mm512_setzero_pd(), _CMP_NEQ_UQ) & (__mmask8)~pos[3];
+	x->val[2] = _mm512_mask_mov_pd(x->val[2], pos[2] & cmp_rem, sum);
+	x->val[1] = _mm512_mask_mov_pd(x->val[1], pos[1] & cmp_rem, sum);
+	x->val[0] = _mm512_mask_mov_pd(x->val[0], pos[0] & cmp_rem, sum);
+	sum = _mm512_mask_mov_pd(sum, cmp_rem, rem);
+	sum = _mm512_mask_mov_pd(sum, pos[3], sum_3);
+	pos[3] = pos[3] | (pos[2] & cmp_rem);
+	pos[2] = (pos[2] & (__mmask8)~cmp_rem) | (pos[1] & cmp_rem);
+	pos[1] = (pos[1] & (__mmask8)~cmp_rem) | (pos[0] & cmp_rem);
+	pos[0] = pos[0] & (__mmask8)~cmp_rem;
+
+	/* stores the running sum, and zeros the terms after it */
+	x->val[0] = _mm512_mask_mov_pd(x->val[0], pos[0], sum);
+	x->val[1] = _mm512_mask_mov_pd(x->val[1], pos[1], sum);
+	x->val[2] = _mm512_mask_mov_pd(x->val[2], pos[2], sum);
+	x->val[3] = _mm512_mask_mov_pd(x->val[3], pos[3], sum);
+	x->val[1] = _mm512_maskz_mov_pd((__mmask8)~pos[0], x->val[1]);
+	x->val[2] = _mm512_maskz_mov_pd((__mmask8)~(pos[0] | pos[1]), x->val[2]);
+	x->val[3] = _mm512_maskz_mov_pd(pos[3], x->val[3]);
+
+	*x = _mm512x4_mask_blend_pdx4(cmp_inf, *x, x_inf);
+}
+
+static inline void _mm512x4_quick_renorm_err_pdx4(
+	__m512dx4* LDF_restrict const x, __m512d* LDF_restrict const err
+) {
+	__m512d t0, t1, t2, t3;
+	__m512d s;
+	s         = _mm512_quick_two_sum_pd(x->val[3], *err, &t3);
+	s         = _mm512_quick_two_sum_pd(x->val[2], s   , &t2);
+	s         = _mm512_quick_two_sum_pd(x->val[1], s   , &t1);
+	x->val[0] = _mm512_quick_two_sum_pd(x->val[0], s   , &t0);
+
+	s         = _mm512_quick_two_sum_pd(t2, t3, &t2);
+	s         = _mm512_quick_two_sum_pd(t1, s , &t1);
+	x->val[1] = _mm512_quick_two_sum_pd(t0, s , &t0);
+
+	s         = _mm512_quick_two_sum_pd(t1, t2, &t1);
+	x->val[2] = _mm512_quick_two_sum_pd(t0, s , &t0);
+	
+	x->val[3] = _mm512_add_pd(t0, t1);
+}
+
+static inline void _mm512x4_renorm_err_pdx4(
+	__m512dx4* LDF_restrict const x, __m512d* LDF_restrict const err
+) {
+	// #ifdef FLOAT64X4_IEEE_MODE
+	// 	_mm512x4_accurate_renorm_err_pdx4(x, err);
+	// #else
+		_mm512x4_quick_renorm_err_pdx4(x, err);
+	// #endif
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 Arithmetic
+//------------------------------------------------------------------------------
+
+/* Negation */
+
+/**
+ * @brief Negates a __m512dx4 value (multiplies by -1.0)
+ */
+static inline __m512dx4 _mm512x4_negate_pdx4(__m512dx4 x) {
+	x.val[0] = _mm512_negate_pd(x.val[0]);
+	x.val[1] = _mm512_negate_pd(x.val[1]);
+	x.val[2] = _mm512_negate_pd(x.val[2]);
+	x.val[3] = _mm512_negate_pd(x.val[3]);
+	return x;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 Addition
+//------------------------------------------------------------------------------
+/** 
+ * @author Taken and/or modified from libQD which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+
+/* __m512dx4 + __m512dx4 */
+
+static inline __m512dx4 _mm512x4_add_quick_pdx4(__m512dx4 x, __m512dx4 y) {
+	/*
+	__m512d s0, s1, s2, s3;
+	__m512d t0, t1, t2, t3;
+	
+	s0 = _mm512_two_sum_pd(x.val[0], y.val[0], t0);
+	s1 = _mm512_two_sum_pd(x.val[1], y.val[1], t1);
+	s2 = _mm512_two_sum_pd(x.val[2], y.val[2], t2);
+	s3 = _mm512_two_sum_pd(x.val[3], y.val[3], t3);
+
+	s1 = _mm512_two_sum_pd(s1, t0, t0);
+	_mm512_three_sum_pd(s2, t0, t1);
+	_mm512_three_sum2_pd(s3, t0, t2);
+	t0 = t0 + t1 + t3;
+
+	_mm512x4_renorm_err_pdx4(s0, s1, s2, s3, t0);
+	return __m512dx4(s0, s1, s2, s3, t0);
+	*/
+
+	/* Same as above, but addition re-organized to minimize
+		data dependency ... unfortunately some compilers are
+		not very smart to do this automatically */
+	__m512dx4 s;
+	__m512d t0, t1, t2, t3;
+
+	__m512d v0, v1, v2, v3;
+	__m512d u0, u1, u2, u3;
+	__m512d w0, w1, w2, w3;
+
+	s.val[0] = _mm512_add_pd(x.val[0], y.val[0]);
+	s.val[1] = _mm512_add_pd(x.val[1], y.val[1]);
+	s.val[2] = _mm512_add_pd(x.val[2], y.val[2]);
+	s.val[3] = _mm512_add_pd(x.val[3], y.val[3]);
+
+	v0 = _mm512_sub_pd(s.val[0], x.val[0]);
+	v1 = _mm512_sub_pd(s.val[1], x.val[1]);
+	v2 = _mm512_sub_pd(s.val[2], x.val[2]);
+	v3 = _mm512_sub_pd(s.val[3], x.val[3]);
+
+	u0 = _mm512_sub_pd(s.val[0], v0);
+	u1 = _mm512_sub_pd(s.val[1], v1);
+	u2 = _mm512_sub_pd(s.val[2], v2);
+	u3 = _mm512_sub_pd(s.val[3], v3);
+
+	w0 = _mm512_sub_pd(x.val[0], u0);
+	w1 = _mm512_sub_pd(x.val[1], u1);
+	w2 = _mm512_sub_pd(x.val[2], u2);
+	w3 = _mm512_sub_pd(x.val[3], u3);
+
+	u0 = _mm512_sub_pd(y.val[0], v0);
+	u1 = _mm512_sub_pd(y.val[1], v1);
+	u2 = _mm512_sub_pd(y.val[2], v2);
+	u3 = _mm512_sub_pd(y.val[3], v3);
+
+	t0 = _mm512_add_pd(w0, u0);
+	t1 = _mm512_add_pd(w1, u1);
+	t2 = _mm512_add_pd(w2, u2);
+	t3 = _mm512_add_pd(w3, u3);
+
+	s.val[1] = _mm512_two_sum_pd(s.val[1], t0, &t0);
+	_mm512_three_sum_pd (&s.val[2], &t0, &t1);
+	_mm512_three_sum2_pd(&s.val[3], &t0,  t2);
+	t0 = _mm512_add_pd(_mm512_add_pd(t0, t1), t3);
+
+	/* renormalize */
+	_mm512x4_renorm_err_pdx4(&s, &t0);
+	return s;
+}
+
+static inline __m512dx4 _mm512x4_add_pdx4(__m512dx4 x, __m512dx4 y) {
+	// #ifdef __M512DX4_IEEE_MODE
+	// 	return _mm512x4_add_accurate_pdx4(x, y);
+	// #else
+		return _mm512x4_add_quick_pdx4(x, y);
+	// #endif
+}
+
+/* __m512dx4 + __m512dx2 */
+
+static inline __m512dx4 _mm512x4_add_pdx4_pdx2(const __m512dx4 x, const __m512dx2 y) {
+	__m512dx4 s;
+	__m512d t0, t1;
+
+	s.val[0] = _mm512_two_sum_pd(x.val[0], y.hi, &t0);
+	s.val[1] = _mm512_two_sum_pd(x.val[1], y.lo, &t1);
+
+	s.val[1] = _mm512_two_sum_pd(s.val[1], t0, &t0);
+
+	s.val[2] = x.val[2];
+	_mm512_three_sum_pd(&s.val[2], &t0, &t1);
+
+	s.val[3] = _mm512_two_sum_pd(t0, x.val[3], &t0);
+	t0 = _mm512_add_pd(t0, t1);
+
+	_mm512x4_renorm_err_pdx4(&s, &t0);
+	return s;
+}
+
+/* __m512dx2 + __m512dx4 */
+
+static inline __m512dx4 _mm512x4_add_pdx2_pdx4(const __m512dx2 x, const __m512dx4 y) {
+	__m512dx4 s;
+	__m512d t0, t1;
+
+	s.val[0] = _mm512_two_sum_pd(x.hi, y.val[0], &t0);
+	s.val[1] = _mm512_two_sum_pd(x.lo, y.val[1], &t1);
+
+	s.val[1] = _mm512_two_sum_pd(s.val[1], t0, &t0);
+
+	s.val[2] = y.val[2];
+	_mm512_three_sum_pd(&s.val[2], &t0, &t1);
+
+	s.val[3] = _mm512_two_sum_pd(t0, y.val[3], &t0);
+	t0 = _mm512_add_pd(t0, t1);
+
+	_mm512x4_renorm_err_pdx4(&s, &t0);
+	return s;
+}
+
+/* __m512dx4 + __m512d */
+
+static inline __m512dx4 _mm512x4_add_pdx4_pd(const __m512dx4 x, const __m512d y) {
+	__m512dx4 ret;
+	__m512d e;
+
+	ret.val[0] = _mm512_two_sum_pd(x.val[0], y, &e);
+	ret.val[1] = _mm512_two_sum_pd(x.val[1], e, &e);
+	ret.val[2] = _mm512_two_sum_pd(x.val[2], e, &e);
+	ret.val[3] = _mm512_two_sum_pd(x.val[3], e, &e);
+
+	_mm512x4_renorm_err_pdx4(&ret, &e);
+	return ret;
+}
+
+/* __m512d + __m512dx4 */
+
+static inline __m512dx4 _mm512x4_add_pd_pdx4(const __m512d x, const __m512dx4 y) {
+	__m512dx4 ret;
+	__m512d e;
+
+	ret.val[0] = _mm512_two_sum_pd(x, y.val[0], &e);
+	ret.val[1] = _mm512_two_sum_pd(e, y.val[1], &e);
+	ret.val[2] = _mm512_two_sum_pd(e, y.val[2], &e);
+	ret.val[3] = _mm512_two_sum_pd(e, y.val[3], &e);
+
+	_mm512x4_renorm_err_pdx4(&ret, &e);
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 Optimized Addition
+//------------------------------------------------------------------------------
+
+/* __m512dx2 + __m512dx2 */
+
+static inline __m512dx4 _mm512x4_add_pdx2_pdx2(const __m512dx2 x, const __m512dx2 y) {
+	__m512dx4 s;
+	__m512d t0, t1;
+
+	s.val[0] = _mm512_two_sum_pd(x.hi, y.hi, &t0);
+	s.val[1] = _mm512_two_sum_pd(x.lo, y.lo, &t1);
+
+	s.val[1] = _mm512_two_sum_pd(s.val[1], t0, &t0);
+	s.val[2] = _mm512_two_sum_pd(t0, t1, &t0);
+	s.val[3] = t0;
+
+	_mm512x4_renorm_err_pdx4(&s, &t1);
+	return s;
+}
+
+/* __m512dx2 + __m512d */
+
+static inline __m512dx4 _mm512x4_add_pdx2_pd(const __m512dx2 x, const __m512d y) {
+	__m512dx4 s;
+	__m512d t0;
+
+	s.val[0] = _mm512_two_sum_pd(x.hi, y, &t0);
+	s.val[1] = x.lo;
+
+	s.val[1] = _mm512_two_sum_pd(s.val[1], t0, &t0);
+	s.val[2] = t0;
+	s.val[3] = _mm512_setzero_pd();
+	return s; // renormalization not needed
+}
+
+/* __m512d + __m512dx2 */
+
+static inline __m512dx4 _mm512x4_add_pd_pdx2(const __m512d x, const __m512dx2 y) {
+	__m512dx4 s;
+	__m512d t0;
+
+	s.val[0] = _mm512_two_sum_pd(x, y.hi, &t0);
+	s.val[1] = y.lo;
+
+	s.val[1] = _mm512_two_sum_pd(s.val[1], t0, &t0);
+	s.val[2] = t0;
+	s.val[3] = _mm512_setzero_pd();
+	return s; // renormalization not needed
+}
+
+/* __m512d + __m512d */
+
+static inline __m512dx4 _mm512x4_add_pd_pd(const __m512d x, const __m512d y) {
+	__m512dx4 s;
+	__m512d t0;
+
+	s.val[0] = _mm512_two_sum_pd(x, y, &t0);
+	s.val[1] = t0;
+	s.val[2] = _mm512_setzero_pd();
+	s.val[3] = _mm512_setzero_pd();
+	return s; // renormalization not needed
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 Subtraction
+//------------------------------------------------------------------------------
+/** 
+ * @author Taken and/or modified from libQD which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+
+/* __m512dx4 - __m512dx4 */
+
+/** @brief Orginally qd_real::sloppy_add */
+static inline __m512dx4 _mm512x4_sub_quick_pdx4(const __m512dx4 x, const __m512dx4 y) {
+	/*
+	__m512d s0, s1, s2, s3;
+	__m512d t0, t1, t2, t3;
+	
+	s0 = _mm512_two_sum_pd(x.val[0], y.val[0], t0);
+	s1 = _mm512_two_sum_pd(x.val[1], y.val[1], t1);
+	s2 = _mm512_two_sum_pd(x.val[2], y.val[2], t2);
+	s3 = _mm512_two_sum_pd(x.val[3], y.val[3], t3);
+
+	s1 = _mm512_two_sum_pd(s1, t0, t0);
+	_mm512_three_sum_pd(s2, t0, t1);
+	_mm512_three_sum2_pd(s3, t0, t2);
+	t0 = t0 + t1 + t3;
+
+	_mm512x4_renorm_err_pdx4(s0, s1, s2, s3, t0);
+	return __m512dx4(s0, s1, s2, s3, t0);
+	*/
+
+	/* Same as above, but addition re-organized to minimize
+		data dependency ... unfortunately some compilers are
+		not very smart to do this automatically */
+	__m512dx4 s;
+	__m512d t0, t1, t2, t3;
+
+	__m512d v0, v1, v2, v3;
+	__m512d u0, u1, u2, u3;
+	__m512d w0, w1, w2, w3;
+
+	s.val[0] = _mm512_sub_pd(x.val[0], y.val[0]);
+	s.val[1] = _mm512_sub_pd(x.val[1], y.val[1]);
+	s.val[2] = _mm512_sub_pd(x.val[2], y.val[2]);
+	s.val[3] = _mm512_sub_pd(x.val[3], y.val[3]);
+
+	v0 = _mm512_sub_pd(s.val[0], x.val[0]);
+	v1 = _mm512_sub_pd(s.val[1], x.val[1]);
+	v2 = _mm512_sub_pd(s.val[2], x.val[2]);
+	v3 = _mm512_sub_pd(s.val[3], x.val[3]);
+
+	u0 = _mm512_sub_pd(s.val[0], v0);
+	u1 = _mm512_sub_pd(s.val[1], v1);
+	u2 = _mm512_sub_pd(s.val[2], v2);
+	u3 = _mm512_sub_pd(s.val[3], v3);
+
+	w0 = _mm512_sub_pd(x.val[0], u0);
+	w1 = _mm512_sub_pd(x.val[1], u1);
+	w2 = _mm512_sub_pd(x.val[2], u2);
+	w3 = _mm512_sub_pd(x.val[3], u3);
+
+	// u is negative
+	u0 = _mm512_add_pd(y.val[0], v0);
+	u1 = _mm512_add_pd(y.val[1], v1);
+	u2 = _mm512_add_pd(y.val[2], v2);
+	u3 = _mm512_add_pd(y.val[3], v3);
+
+	t0 = _mm512_sub_pd(w0, u0);
+	t1 = _mm512_sub_pd(w1, u1);
+	t2 = _mm512_sub_pd(w2, u2);
+	t3 = _mm512_sub_pd(w3, u3);
+
+	s.val[1] = _mm512_two_sum_pd(s.val[1], t0, &t0);
+	_mm512_three_sum_pd (&s.val[2], &t0, &t1);
+	_mm512_three_sum2_pd(&s.val[3], &t0,  t2);
+	t0 = _mm512_add_pd(_mm512_add_pd(t0, t1), t3);
+
+	/* renormalize */
+	_mm512x4_renorm_err_pdx4(&s, &t0);
+	return s;
+}
+
+static inline __m512dx4 _mm512x4_sub_pdx4(const __m512dx4 x, const __m512dx4 y) {
+	// #ifdef __M512DX4_IEEE_MODE
+	// 	return _mm512x4_sub_accurate_pdx4(x, y);
+	// #else
+		return _mm512x4_sub_quick_pdx4(x, y);
+	// #endif
+}
+
+/* __m512dx4 - __m512dx2 */
+
+static inline __m512dx4 _mm512x4_sub_pdx4_pdx2(const __m512dx4 x, const __m512dx2 y) {
+	__m512dx4 s;
+	__m512d t0, t1;
+
+	s.val[0] = _mm512_two_diff_pd(x.val[0], y.hi, &t0);
+	s.val[1] = _mm512_two_diff_pd(x.val[1], y.lo, &t1);
+
+	s.val[1] = _mm512_two_sum_pd(s.val[1], t0, &t0);
+
+	s.val[2] = x.val[2];
+	_mm512_three_sum_pd(&s.val[2], &t0, &t1);
+
+	s.val[3] = _mm512_two_sum_pd(t0, x.val[3], &t0);
+	t0 = _mm512_add_pd(t0, t1);
+
+	_mm512x4_renorm_err_pdx4(&s, &t0);
+	return s;
+}
+
+/* __m512dx2 - __m512dx4 */
+
+static inline __m512dx4 _mm512x4_sub_pdx2_pdx4(const __m512dx2 x, const __m512dx4 y) {
+	__m512dx4 s;
+	__m512d t0, t1;
+
+	s.val[0] = _mm512_two_diff_pd(x.hi, y.val[0], &t0);
+	s.val[1] = _mm512_two_diff_pd(x.lo, y.val[1], &t1);
+
+	s.val[1] = _mm512_two_sum_pd(s.val[1], t0, &t0);
+
+	s.val[2] = _mm512_negate_pd(y.val[2]);
+	_mm512_three_sum_pd(&s.val[2], &t0, &t1);
+
+	s.val[3] = _mm512_two_diff_pd(t0, y.val[3], &t0);
+	t0 = _mm512_add_pd(t0, t1);
+
+	_mm512x4_renorm_err_pdx4(&s, &t0);
+	return s;
+}
+
+/* __m512dx4 - __m512d */
+
+static inline __m512dx4 _mm512x4_sub_pdx4_pd(const __m512dx4 x, const __m512d y) {
+	__m512dx4 ret;
+	__m512d e;
+
+	ret.val[0] = _mm512_two_diff_pd(x.val[0], y, &e);
+	ret.val[1] = _mm512_two_sum_pd(x.val[1], e, &e);
+	ret.val[2] = _mm512_two_sum_pd(x.val[2], e, &e);
+	ret.val[3] = _mm512_two_sum_pd(x.val[3], e, &e);
+
+	_mm512x4_renorm_err_pdx4(&ret, &e);
+	return ret;
+}
+
+/* __m512d - __m512dx4 */
+
+static inline __m512dx4 _mm512x4_sub_pd_pdx4(const __m512d x, const __m512dx4 y) {
+	__m512dx4 ret;
+	__m512d e;
+
+	ret.val[0] = _mm512_two_diff_pd(x, y.val[0], &e);
+	ret.val[1] = _mm512_two_diff_pd(e, y.val[1], &e);
+	ret.val[2] = _mm512_two_diff_pd(e, y.val[2], &e);
+	ret.val[3] = _mm512_two_diff_pd(e, y.val[3], &e);
+
+	_mm512x4_renorm_err_pdx4(&ret, &e);
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 Optimized Subtraction
+//------------------------------------------------------------------------------
+
+/* __m512dx2 - __m512dx2 */
+
+static inline __m512dx4 _mm512x4_sub_pdx2_pdx2(const __m512dx2 x, const __m512dx2 y) {
+	__m512dx4 s;
+	__m512d t0, t1;
+
+	s.val[0] = _mm512_two_diff_pd(x.hi, y.hi, &t0);
+	s.val[1] = _mm512_two_diff_pd(x.lo, y.lo, &t1);
+
+	s.val[1] = _mm512_two_sum_pd(s.val[1], t0, &t0);
+	s.val[2] = _mm512_two_sum_pd(t0, t1, &t0);
+	s.val[3] = t0;
+
+	_mm512x4_renorm_err_pdx4(&s, &t1);
+	return s;
+}
+
+/* __m512dx2 - __m512d */
+
+static inline __m512dx4 _mm512x4_sub_pdx2_pd(const __m512dx2 x, const __m512d y) {
+	__m512dx4 s;
+	__m512d t0;
+
+	s.val[0] = _mm512_two_diff_pd(x.hi, y, &t0);
+	s.val[1] = x.lo;
+
+	s.val[1] = _mm512_two_sum_pd(s.val[1], t0, &t0);
+	s.val[2] = t0;
+	s.val[3] = _mm512_setzero_pd();
+	return s; // renormalization not needed
+}
+
+/* __m512d - __m512dx2 */
+
+static inline __m512dx4 _mm512x4_sub_pd_pdx2(const __m512d x, const __m512dx2 y) {
+	__m512dx4 s;
+	__m512d t0;
+
+	s.val[0] = _mm512_two_diff_pd(x, y.hi, &t0);
+	s.val[1] = _mm512_negate_pd(y.lo);
+
+	s.val[1] = _mm512_two_sum_pd(s.val[1], t0, &t0);
+	s.val[2] = t0;
+	s.val[3] = _mm512_setzero_pd();
+	return s; // renormalization not needed
+}
+
+/* __m512d - __m512d */
+
+static inline __m512dx4 _mm512x4_sub_pd_pd(const __m512d x, const __m512d y) {
+	__m512dx4 s;
+	__m512d t0;
+
+	s.val[0] = _mm512_two_diff_pd(x, y, &t0);
+	s.val[1] = t0;
+	s.val[2] = _mm512_setzero_pd();
+	s.val[3] = _mm512_setzero_pd();
+	return s; // renormalization not needed
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 Multiplication
+//------------------------------------------------------------------------------
+/** 
+ * @author Taken and/or modified from libQD which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+
+/* __m512dx4 * __m512dx4 */
+
+/** @brief Orginally qd_real::accurate_mul */
+static inline __m512dx4 _mm512x4_mul_accurate_pdx4(const __m512dx4 x, const __m512dx4 y) {
+	__m512d p0, p1, p2, p3, p4, p5;
+	__m512d q0, q1, q2, q3, q4, q5;
+	__m512d p6, p7, p8, p9;
+	__m512d q6, q7, q8, q9;
+	__m512d r0, r1;
+	__m512d t0, t1;
+	__m512d s0, s1, s2;
+
+	p0 = _mm512_two_prod_pd(x.val[0], y.val[0], &q0);
+
+	p1 = _mm512_two_prod_pd(x.val[0], y.val[1], &q1);
+	p2 = _mm512_two_prod_pd(x.val[1], y.val[0], &q2);
+
+	p3 = _mm512_two_prod_pd(x.val[0], y.val[2], &q3);
+	p4 = _mm512_two_prod_pd(x.val[1], y.val[1], &q4);
+	p5 = _mm512_two_prod_pd(x.val[2], y.val[0], &q5);
+
+	/* Start Accumulation */
+	_mm512_three_sum_pd(&p1, &p2, &q0);
+
+	/* Six-Three Sum of p2, q1, q2, p3, p4, p5. */
+	_mm512_three_sum_pd(&p2, &q1, &q2);
+	_mm512_three_sum_pd(&p3, &p4, &p5);
+	/* compute (s0, s1, s2) = (p2, q1, q2) + (p3, p4, p5). */
+	s0 = _mm512_two_sum_pd(p2, p3, &t0);
+	s1 = _mm512_two_sum_pd(q1, p4, &t1);
+	s2 = _mm512_add_pd(q2, p5);
+	s1 = _mm512_two_sum_pd(s1, t0, &t0);
+	s2 = _mm512_add_pd(s2, _mm512_add_pd(t0, t1));
+
+	/* O(eps^3) order terms */
+	p6 = _mm512_two_prod_pd(x.val[0], y.val[3], &q6);
+	p7 = _mm512_two_prod_pd(x.val[1], y.val[2], &q7);
+	p8 = _mm512_two_prod_pd(x.val[2], y.val[1], &q8);
+	p9 = _mm512_two_prod_pd(x.val[3], y.val[0], &q9);
+
+	/* Nine-Two-Sum of q0, s1, q3, q4, q5, p6, p7, p8, p9. */
+	q0 = _mm512_two_sum_pd(q0, q3, &q3);
+	q4 = _mm512_two_sum_pd(q4, q5, &q5);
+	p6 = _mm512_two_sum_pd(p6, p7, &p7);
+	p8 = _mm512_two_sum_pd(p8, p9, &p9);
+	/* Compute (t0, t1) = (q0, q3) + (q4, q5). */
+	t0 = _mm512_two_sum_pd(q0, q4, &t1);
+	t1 = _mm512_add_pd(t1, _mm512_add_pd(q3, q5));
+	/* Compute (r0, r1) = (p6, p7) + (p8, p9). */
+	r0 = _mm512_two_sum_pd(p6, p8, &r1);
+	r1 = _mm512_add_pd(r1, _mm512_add_pd(p7, p9));
+	/* Compute (q3, q4) = (t0, t1) + (r0, r1). */
+	q3 = _mm512_two_sum_pd(t0, r0, &q4);
+	q4 = _mm512_add_pd(q4, _mm512_add_pd(t1, r1));
+	/* Compute (t0, t1) = (q3, q4) + s1. */
+	t0 = _mm512_two_sum_pd(q3, s1, &t1);
+	t1 = _mm512_add_pd(t1, q4);
+
+	/* O(eps^4) terms -- Nine-One-Sum */
+	t1 = _mm512_add_pd(t1, _mm512_add_pd(_mm512_add_pd(_mm512_add_pd(_mm512_add_pd(_mm512_add_pd(
+	_mm512_add_pd(
+		_mm512_add_pd(
+			_mm512_mul_pd(x.val[1], y.val[3]),
+			_mm512_mul_pd(x.val[2], y.val[2])
+		), _mm512_mul_pd(x.val[3], y.val[1])
+	), q6), q7), q8), q9), s2));
+	
+	__m512dx4 ret = {{p0, p1, s0, t0}};
+	_mm512x4_renorm_err_pdx4(&ret, &t1);
+	return ret;
+}
+
+/** @brief Orginally qd_real::sloppy_mul */
+static inline __m512dx4 _mm512x4_mul_quick_pdx4(const __m512dx4 x, const __m512dx4 y) {
+	__m512d p0, p1, p2, p3, p4, p5;
+	__m512d q0, q1, q2, q3, q4, q5;
+	__m512d t0, t1;
+	__m512d s0, s1, s2;
+
+	p0 = _mm512_two_prod_pd(x.val[0], y.val[0], &q0);
+
+	p1 = _mm512_two_prod_pd(x.val[0], y.val[1], &q1);
+	p2 = _mm512_two_prod_pd(x.val[1], y.val[0], &q2);
+
+	p3 = _mm512_two_prod_pd(x.val[0], y.val[2], &q3);
+	p4 = _mm512_two_prod_pd(x.val[1], y.val[1], &q4);
+	p5 = _mm512_two_prod_pd(x.val[2], y.val[0], &q5);
+
+	/* Start Accumulation */
+	_mm512_three_sum_pd(&p1, &p2, &q0);
+
+	/* Six-Three Sum of p2, q1, q2, p3, p4, p5. */
+	_mm512_three_sum_pd(&p2, &q1, &q2);
+	_mm512_three_sum_pd(&p3, &p4, &p5);
+	/* compute (s0, s1, s2) = (p2, q1, q2) + (p3, p4, p5). */
+	s0 = _mm512_two_sum_pd(p2, p3, &t0);
+	s1 = _mm512_two_sum_pd(q1, p4, &t1);
+	s2 = _mm512_add_pd(q2, p5);
+	s1 = _mm512_two_sum_pd(s1, t0, &t0);
+	s2 = _mm512_add_pd(s2, _mm512_add_pd(t0, t1));
+
+	/* O(eps^3) order terms */
+	s1 = _mm512_add_pd(s1, _mm512_add_pd(_mm512_add_pd(_mm512_add_pd(_mm512_add_pd(
+	_mm512_add_pd(
+		_mm512_add_pd(
+			_mm512_add_pd(
+				_mm512_mul_pd(x.val[0], y.val[3]),
+				_mm512_mul_pd(x.val[1], y.val[2])
+			), _mm512_mul_pd(x.val[2], y.val[1])
+		), _mm512_mul_pd(x.val[3], y.val[0])
+	), q0), q3), q4), q5));
+	__m512dx4 ret = {{p0, p1, s0, s1}};
+	_mm512x4_renorm_err_pdx4(&ret, &s2);
+	return ret;
+}
+
+static inline __m512dx4 _mm512x4_mul_pdx4(const __m512dx4 x, const __m512dx4 y) {
+	#ifdef __M512DX4_IEEE_MODE
+		return _mm512x4_mul_accurate_pdx4(x, y);
+	#else
+		return _mm512x4_mul_quick_pdx4(x, y);
+	#endif
+}
+
+/* __m512dx4 * __m512dx2 */
+
+static inline __m512dx4 _mm512x4_mul_pdx4_pdx2(const __m512dx4 x, const __m512dx2 y) {
+	__m512dx4 p;
+	__m512d p_err;
+	__m512d q0, q1, q2, q3, q4;
+	__m512d s0, s1, s2;
+	__m512d t0, t1;
+
+	p.val[0] = _mm512_two_prod_pd(x.val[0], y.hi, &q0);
+	p.val[1] = _mm512_two_prod_pd(x.val[0], y.lo, &q1);
+	p.val[2] = _mm512_two_prod_pd(x.val[1], y.hi, &q2);
+	p.val[3] = _mm512_two_prod_pd(x.val[1], y.lo, &q3);
+	p_err    = _mm512_two_prod_pd(x.val[2], y.hi, &q4);
+	
+	_mm512_three_sum_pd(&p.val[1], &p.val[2], &q0);
+	
+	/* Five-Three-Sum */
+	_mm512_three_sum_pd(&p.val[2], &p.val[3], &p_err);
+	q1 = _mm512_two_sum_pd(q1      , q2, &q2);
+	s0 = _mm512_two_sum_pd(p.val[2], q1, &t0);
+	s1 = _mm512_two_sum_pd(p.val[3], q2, &t1);
+	s1 = _mm512_two_sum_pd(s1      , t0, &t0);
+	s2 = _mm512_add_pd(_mm512_add_pd(t0, t1), p_err);
+	p.val[2] = s0;
+
+	p.val[3] = _mm512_add_pd(_mm512_add_pd(_mm512_add_pd(
+		_mm512_mul_pd(x.val[2], y.hi), _mm512_mul_pd(x.val[3], y.lo)
+	), q3), q4);
+	_mm512_three_sum2_pd(&p.val[3], &q0, s1);
+	p_err = _mm512_add_pd(q0, s2);
+
+	_mm512x4_renorm_err_pdx4(&p, &p_err);
+	return p;
+}
+
+/* __m512dx2 * __m512dx4 */
+
+static inline __m512dx4 _mm512x4_mul_pdx2_pdx4(const __m512dx2 x, const __m512dx4 y) {
+	__m512dx4 p;
+	__m512d p_err;
+	__m512d q0, q1, q2, q3, q4;
+	__m512d s0, s1, s2;
+	__m512d t0, t1;
+
+	p.val[0] = _mm512_two_prod_pd(x.hi, y.val[0], &q0);
+	p.val[1] = _mm512_two_prod_pd(x.lo, y.val[0], &q1);
+	p.val[2] = _mm512_two_prod_pd(x.hi, y.val[1], &q2);
+	p.val[3] = _mm512_two_prod_pd(x.lo, y.val[1], &q3);
+	p_err    = _mm512_two_prod_pd(x.hi, y.val[2], &q4);
+	
+	_mm512_three_sum_pd(&p.val[1], &p.val[2], &q0);
+	
+	/* Five-Three-Sum */
+	_mm512_three_sum_pd(&p.val[2], &p.val[3], &p_err);
+	q1 = _mm512_two_sum_pd(q1      , q2, &q2);
+	s0 = _mm512_two_sum_pd(p.val[2], q1, &t0);
+	s1 = _mm512_two_sum_pd(p.val[3], q2, &t1);
+	s1 = _mm512_two_sum_pd(s1      , t0, &t0);
+	s2 = _mm512_add_pd(_mm512_add_pd(t0, t1), p_err);
+	p.val[2] = s0;
+
+	p.val[3] = _mm512_add_pd(_mm512_add_pd(_mm512_add_pd(
+		_mm512_mul_pd(y.val[2], x.hi), _mm512_mul_pd(y.val[3], x.lo)
+	), q3), q4);
+	_mm512_three_sum2_pd(&p.val[3], &q0, s1);
+	p_err = _mm512_add_pd(q0, s2);
+
+	_mm512x4_renorm_err_pdx4(&p, &p_err);
+	return p;
+}
+
+/* __m512dx4 * __m512d */
+
+static inline __m512dx4 _mm512x4_mul_pdx4_pd(const __m512dx4 x, const __m512d y) {
+	__m512d p0, p1, p2, p3;
+	__m512d q0, q1, q2;
+	__m512dx4 s;
+	__m512d s_err;
+
+	p0 = _mm512_two_prod_pd(x.val[0], y, &q0);
+	p1 = _mm512_two_prod_pd(x.val[1], y, &q1);
+	p2 = _mm512_two_prod_pd(x.val[2], y, &q2);
+	p3 = _mm512_mul_pd(x.val[3], y);
+
+	s.val[0] = p0;
+
+	s.val[1] = _mm512_two_sum_pd(q0, p1, &s.val[2]);
+
+	_mm512_three_sum_pd(&s.val[2], &q1, &p2);
+
+	_mm512_three_sum2_pd(&q1, &q2, p3);
+	s.val[3] = q1;
+
+	s_err = _mm512_add_pd(q2, p2);
+
+	_mm512x4_renorm_err_pdx4(&s, &s_err);
+	return s;
+}
+
+/* __m512d * __m512dx4 */
+
+static inline __m512dx4 _mm512x4_mul_pd_pdx4(const __m512d x, const __m512dx4 y) {
+	__m512d p0, p1, p2, p3;
+	__m512d q0, q1, q2;
+	__m512dx4 s;
+	__m512d s_err;
+
+	p0 = _mm512_two_prod_pd(x, y.val[0], &q0);
+	p1 = _mm512_two_prod_pd(x, y.val[1], &q1);
+	p2 = _mm512_two_prod_pd(x, y.val[2], &q2);
+	p3 = _mm512_mul_pd(x, y.val[3]);
+
+	s.val[0] = p0;
+
+	s.val[1] = _mm512_two_sum_pd(q0, p1, &s.val[2]);
+
+	_mm512_three_sum_pd(&s.val[2], &q1, &p2);
+
+	_mm512_three_sum2_pd(&q1, &q2, p3);
+	s.val[3] = q1;
+
+	s_err = _mm512_add_pd(q2, p2);
+
+	_mm512x4_renorm_err_pdx4(&s, &s_err);
+	return s;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 Optimized Mutliplication
+//------------------------------------------------------------------------------
+
+/* __m512dx2 * __m512dx2 */
+
+static inline __m512dx4 _mm512x4_mul_pdx2_pdx2(const __m512dx2 x, const __m512dx2 y) {
+	__m512dx4 p;
+	__m512d p_err;
+	__m512d q0, q1, q2, q3;
+	__m512d s0, s1, s2;
+	__m512d t0, t1;
+
+	p.val[0] = _mm512_two_prod_pd(x.hi, y.hi, &q0);
+	p.val[1] = _mm512_two_prod_pd(x.lo, y.hi, &q1);
+	p.val[2] = _mm512_two_prod_pd(x.hi, y.lo, &q2);
+	p.val[3] = _mm512_two_prod_pd(x.lo, y.lo, &q3);
+	
+	_mm512_three_sum_pd(&p.val[1], &p.val[2], &q0);
+	
+	/* Five-Three-Sum */
+	p.val[2] = _mm512_two_sum_pd(p.val[2], p.val[3], &p.val[3]);
+	q1 = _mm512_two_sum_pd(q1      , q2, &q2);
+	s0 = _mm512_two_sum_pd(p.val[2], q1, &t0);
+	s1 = _mm512_two_sum_pd(p.val[3], q2, &t1);
+	s1 = _mm512_two_sum_pd(s1      , t0, &t0);
+	s2 = _mm512_add_pd(t0, t1);
+	p.val[2] = s0;
+
+	p.val[3] = q3;
+	_mm512_three_sum2_pd(&p.val[3], &q0, s1);
+	p_err = _mm512_add_pd(q0, s2);
+
+	_mm512x4_renorm_err_pdx4(&p, &p_err);
+	return p;
+}
+
+/* __m512dx2 * __m512d */
+
+/**
+ * @brief Multiplies a __m512dx2 value with a __m512d value. Storing the result as
+ * a __m512dx4 value
+ */
+static inline __m512dx4 _mm512x4_mul_pdx2_pd(const __m512dx2 x, const __m512d y) {
+	__m512d p0, p1;
+	__m512d q0, q1;
+	__m512dx4 s;
+
+	p0 = _mm512_two_prod_pd(x.hi, y, &q0);
+	p1 = _mm512_two_prod_pd(x.lo, y, &q1);
+
+	s.val[0] = p0;
+	s.val[1] = _mm512_two_sum_pd(q0, p1, &s.val[2]);
+	s.val[2] = _mm512_two_sum_pd(s.val[2], q1, &q1);
+	s.val[3] = q1;
+
+	_mm512x4_renorm_pdx4(&s);
+	return s;
+}
+
+/* __m512d * __m512dx2 */
+
+/**
+ * @brief Multiplies a __m512d value with a __m512dx2 value. Storing the result as
+ * a __m512dx4 value
+ */
+static inline __m512dx4 _mm512x4_mul_pd_pdx2(const __m512d x, const __m512dx2 y) {
+	__m512d p0, p1;
+	__m512d q0, q1;
+	__m512dx4 s;
+
+	p0 = _mm512_two_prod_pd(x, y.hi, &q0);
+	p1 = _mm512_two_prod_pd(x, y.lo, &q1);
+
+	s.val[0] = p0;
+	s.val[1] = _mm512_two_sum_pd(q0, p1, &s.val[2]);
+	s.val[2] = _mm512_two_sum_pd(s.val[2], q1, &q1);
+	s.val[3] = q1;
+
+	_mm512x4_renorm_pdx4(&s);
+	return s;
+}
+
+/* __m512d * __m512d */
+
+/**
+ * @brief Multiplies a __m512d value with another __m512d value. Storing the result
+ * as a __m512dx4 value.
+ * @note __m512dx2 can store the values from this function exactly.
+ */
+static inline __m512dx4 _mm512x4_mul_pd_pd(const __m512d x, const __m512d y) {
+	__m512dx4 s;
+	s.val[0] = _mm512_two_prod_pd(x, y, &s.val[1]);
+	s.val[2] = _mm512_setzero_pd();
+	s.val[3] = _mm512_setzero_pd(); 
+	return s; // renormalization not needed
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 Square
+//------------------------------------------------------------------------------
+/** 
+ * @author Taken/Modified from libQD which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+
+static inline __m512dx4 _mm512x4_square_pdx4(const __m512dx4 x) {
+	__m512dx4 p;
+	__m512d p_err_hi, p_err_lo;
+	__m512d q0, q1, q2, q3;
+	__m512d s0, s1;
+	__m512d t0, t1;
+	
+	p.val[0] = _mm512_two_sqr_pd(x.val[0], &q0);
+	// q2 is used as temp storage for 2.0 * x.val[0]
+	q2 = _mm512_mul_pd(_mm512_set1_pd(2.0), x.val[0]);
+	p.val[1] = _mm512_two_prod_pd(q2, x.val[1], &q1);
+	p.val[2] = _mm512_two_prod_pd(q2, x.val[2], &q2);
+	p.val[3] = _mm512_two_sqr_pd(x.val[1], &q3);
+
+	p.val[1] = _mm512_two_sum_pd(q0, p.val[1], &q0);
+
+	q0 = _mm512_two_sum_pd(q0, q1, &q1);
+	p.val[2] = _mm512_two_sum_pd(p.val[2], p.val[3], &p.val[3]);
+
+	s0 = _mm512_two_sum_pd(q0, p.val[2], &t0);
+	s1 = _mm512_two_sum_pd(q1, p.val[3], &t1);
+
+	s1 = _mm512_two_sum_pd(s1, t0, &t0);
+	t0 = _mm512_add_pd(t0, t1);
+
+	s1 = _mm512_quick_two_sum_pd(s1, t0, &t0);
+	p.val[2] = _mm512_quick_two_sum_pd(s0, s1, &t1);
+	p.val[3] = _mm512_quick_two_sum_pd(t1, t0, &q0);
+
+	p_err_hi = _mm512_mul_pd(_mm512_set1_pd(2.0), _mm512_mul_pd(x.val[0], x.val[3]));
+	p_err_lo = _mm512_mul_pd(_mm512_set1_pd(2.0), _mm512_mul_pd(x.val[1], x.val[2]));
+
+	p_err_hi = _mm512_two_sum_pd(p_err_hi, p_err_lo, &p_err_lo);
+	q2 = _mm512_two_sum_pd(q2, q3, &q3);
+
+	t0 = _mm512_two_sum_pd(p_err_hi, q2, &t1);
+	t1 = t1 + p_err_lo + q3;
+
+	p.val[3] = _mm512_two_sum_pd(p.val[3], t0, &p_err_hi);
+	p_err_hi = _mm512_add_pd(_mm512_add_pd(p_err_hi, q0), t1);
+
+	_mm512x4_renorm_err_pdx4(&p, &p_err_hi);
+	return p;
+}
+
+/**
+ * @brief Squares a __m512dx2 value with the result stored as a __m512dx4
+ */
+static inline __m512dx4 _mm512x4_square_pdx2(const __m512dx2 x) {
+	__m512dx4 p;
+	__m512d p_err;
+	__m512d q0, q1, q2;
+	__m512d s0, s1;
+	__m512d t0, t1;
+	
+	p.val[0] = _mm512_two_sqr_pd(x.hi, &q0);
+	p.val[1] = _mm512_two_prod_pd(2.0 * x.hi, x.lo, &q1);
+	p.val[2] = _mm512_two_sqr_pd(x.lo, &q2);
+
+	p.val[1] = _mm512_two_sum_pd(q0, p.val[1], &q0);
+
+	q0 = _mm512_two_sum_pd(q0, q1, &q1);
+	s0 = _mm512_two_sum_pd(q0, p.val[2], &t0);
+
+	s1 = _mm512_two_sum_pd(q1, t0, &t0);
+	s1 = _mm512_quick_two_sum_pd(s1, t0, &t0);
+	p.val[2] = _mm512_quick_two_sum_pd(s0, s1, &t1);
+	p.val[3] = _mm512_quick_two_sum_pd(t1, t0, &q0);
+
+	p.val[3] = _mm512_two_sum_pd(p.val[3], q2, &p_err);
+	p_err = _mm512_add_pd(p_err, q0);
+
+	_mm512x4_renorm_err_pdx4(&p, &p_err);
+	return p;
+}
+
+/**
+ * @brief Squares a __m512d value with the result stored as a __m512dx4.
+ * @note __m512dx2 can store the values from this function exactly.
+ */
+static inline __m512dx4 _mm512x4_square_pd(const __m512d x) {
+	__m512dx4 p;
+	p.val[0] = _mm512_two_sqr_pd(x, &p.val[1]);
+	p.val[2] = _mm512_setzero_pd();
+	p.val[3] = _mm512_setzero_pd();
+	return p; // renormalization not needed
+}
+
+
+//------------------------------------------------------------------------------
+// __m512dx4 Division
+//------------------------------------------------------------------------------
+/** 
+ * @author Taken and/or modified from libQD which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+
+/* __m512dx4 / __m512dx4 */
+
+/** @brief Orginally qd_real::accurate_div */
+static inline __m512dx4 _mm512x4_div_accurate_pdx4(const __m512dx4 x, const __m512dx4 y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(x.val[0], y.val[0]);
+	r = _mm512x4_sub_pdx4(x, _mm512x4_mul_pdx4_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y.val[0]);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx4_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y.val[0]);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx4_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y.val[0]);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx4_pd(y, q.val[3]));
+
+	__m512d err = _mm512_div_pd(r.val[0], y.val[0]);
+	_mm512x4_renorm_err_pdx4(&q, &err);
+	return q;
+}
+
+/** @brief Orginally qd_real::sloppy_div */
+static inline __m512dx4 _mm512x4_div_quick_pdx4(const __m512dx4 x, const __m512dx4 y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(x.val[0], y.val[0]);
+	r = _mm512x4_sub_pdx4(x, _mm512x4_mul_pdx4_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y.val[0]);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx4_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y.val[0]);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx4_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y.val[0]);
+	_mm512x4_renorm_pdx4(&q);
+	return q;
+}
+
+static inline __m512dx4 _mm512x4_div_pdx4(const __m512dx4 x, const __m512dx4 y) {
+	#ifdef __M512DX4_IEEE_MODE
+		return _mm512x4_div_accurate_pdx4(x, y);
+	#else
+		return _mm512x4_div_quick_pdx4(x, y);
+	#endif
+}
+
+/* __m512dx4 / __m512dx2 */
+
+static inline __m512dx4 _mm512x4_div_accurate_pdx4_pdx2(const __m512dx4 x, const __m512dx2 y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(x.val[0], y.hi);
+	r = _mm512x4_sub_pdx4(x, _mm512x4_mul_pdx2_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y.hi);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx2_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y.hi);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx2_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y.hi);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx2_pd(y, q.val[3]));
+
+	__m512d err = _mm512_div_pd(r.val[0], y.hi);
+	_mm512x4_renorm_err_pdx4(&q, &err);
+	return q;
+}
+
+static inline __m512dx4 _mm512x4_div_quick_pdx4_pdx2(const __m512dx4 x, const __m512dx2 y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(x.val[0], y.hi);
+	r = _mm512x4_sub_pdx4(x, _mm512x4_mul_pdx2_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y.hi);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx2_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y.hi);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx2_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y.hi);
+	_mm512x4_renorm_pdx4(&q);
+	return q;
+}
+
+static inline __m512dx4 _mm512x4_div_pdx4_pdx2(const __m512dx4 x, const __m512dx2 y) {
+	#ifdef __M512DX4_IEEE_MODE
+		return _mm512x4_div_accurate_pdx4_pdx2(x, y);
+	#else
+		return _mm512x4_div_quick_pdx4_pdx2(x, y);
+	#endif
+}
+
+/* __m512dx4 / __m512d */
+
+static inline __m512dx4 _mm512x4_div_accurate_pdx4_pd(const __m512dx4 x, const __m512d y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(x.val[0], y);
+	r = _mm512x4_sub_pdx4_pdx2(x, _mm512x2_mul_pd_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y);
+	r = _mm512x4_sub_pdx4_pdx2(r, _mm512x2_mul_pd_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y);
+	r = _mm512x4_sub_pdx4_pdx2(r, _mm512x2_mul_pd_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y);
+	r = _mm512x4_sub_pdx4_pdx2(r, _mm512x2_mul_pd_pd(y, q.val[3]));
+	
+	__m512d err = _mm512_div_pd(r.val[0], y);
+	_mm512x4_renorm_err_pdx4(&q, &err);
+	return q;
+}
+
+static inline __m512dx4 _mm512x4_div_quick_pdx4_pd(const __m512dx4 x, const __m512d y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(x.val[0], y);
+	r = _mm512x4_sub_pdx4_pdx2(x, _mm512x2_mul_pd_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y);
+	r = _mm512x4_sub_pdx4_pdx2(r, _mm512x2_mul_pd_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y);
+	r = _mm512x4_sub_pdx4_pdx2(r, _mm512x2_mul_pd_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y);
+	_mm512x4_renorm_pdx4(&q);
+	return q;
+}
+
+static inline __m512dx4 _mm512x4_div_pdx4_pd(const __m512dx4 x, const __m512d y) {
+	#ifdef __M512DX4_IEEE_MODE
+		return _mm512x4_div_accurate_pdx4_pd(x, y);
+	#else
+		return _mm512x4_div_quick_pdx4_pd(x, y);
+	#endif
+}
+
+/* __m512dx2 / __m512dx4 */
+
+static inline __m512dx4 _mm512x4_div_accurate_pdx2_pdx4(const __m512dx2 x, const __m512dx4 y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(x.hi, y.val[0]);
+	r = _mm512x4_sub_pdx2_pdx4(x, _mm512x4_mul_pdx4_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y.val[0]);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx4_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y.val[0]);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx4_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y.val[0]);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx4_pd(y, q.val[3]));
+
+	__m512d err = _mm512_div_pd(r.val[0], y.val[0]);
+	_mm512x4_renorm_err_pdx4(&q, &err);
+	return q;
+}
+
+static inline __m512dx4 _mm512x4_div_quick_pdx2_pdx4(const __m512dx2 x, const __m512dx4 y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(x.hi, y.val[0]);
+	r = _mm512x4_sub_pdx2_pdx4(x, _mm512x4_mul_pdx4_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y.val[0]);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx4_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y.val[0]);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx4_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y.val[0]);
+	_mm512x4_renorm_pdx4(&q);
+	return q;
+}
+
+static inline __m512dx4 _mm512x4_div_pdx2_pdx4(const __m512dx2 x, const __m512dx4 y) {
+	#ifdef __M512DX4_IEEE_MODE
+		return _mm512x4_div_accurate_pdx2_pdx4(x, y);
+	#else
+		return _mm512x4_div_quick_pdx2_pdx4(x, y);
+	#endif
+}
+
+/* __m512d / __m512dx4 */
+
+static inline __m512dx4 _mm512x4_div_accurate_pd_pdx4(const __m512d x, const __m512dx4 y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(x, y.val[0]);
+	r = _mm512x4_sub_pd_pdx4(x, _mm512x4_mul_pdx4_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y.val[0]);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx4_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y.val[0]);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx4_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y.val[0]);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx4_pd(y, q.val[3]));
+
+	__m512d err = _mm512_div_pd(r.val[0], y.val[0]);
+	_mm512x4_renorm_err_pdx4(&q, &err);
+	return q;
+}
+
+static inline __m512dx4 _mm512x4_div_quick_pd_pdx4(const __m512d x, const __m512dx4 y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(x, y.val[0]);
+	r = _mm512x4_sub_pd_pdx4(x, _mm512x4_mul_pdx4_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y.val[0]);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx4_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y.val[0]);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx4_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y.val[0]);
+	_mm512x4_renorm_pdx4(&q);
+	return q;
+}
+
+static inline __m512dx4 _mm512x4_div_pd_pdx4(const __m512d x, const __m512dx4 y) {
+	#ifdef __M512DX4_IEEE_MODE
+		return _mm512x4_div_accurate_pd_pdx4(x, y);
+	#else
+		return _mm512x4_div_quick_pd_pdx4(x, y);
+	#endif
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 Optimized Division
+//------------------------------------------------------------------------------
+
+/* __m512dx2 / __m512dx2 */
+
+static inline __m512dx4 _mm512x4_div_accurate_pdx2_pdx2(const __m512dx2 x, const __m512dx2 y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(x.hi, y.hi);
+	r = _mm512x4_sub_pdx2_pdx4(x, _mm512x4_mul_pdx2_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y.hi);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx2_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y.hi);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx2_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y.hi);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx2_pd(y, q.val[3]));
+
+	__m512d err = _mm512_div_pd(r.val[0], y.hi);
+	_mm512x4_renorm_err_pdx4(&q, &err);
+	return q;
+}
+
+static inline __m512dx4 _mm512x4_div_quick_pdx2_pdx2(const __m512dx2 x, const __m512dx2 y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(x.hi, y.hi);
+	r = _mm512x4_sub_pdx2_pdx4(x, _mm512x4_mul_pdx2_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y.hi);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx2_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y.hi);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx2_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y.hi);
+	_mm512x4_renorm_pdx4(&q);
+	return q;
+}
+
+static inline __m512dx4 _mm512x4_div_pdx2_pdx2(const __m512dx2 x, const __m512dx2 y) {
+	#ifdef __M512DX4_IEEE_MODE
+		return _mm512x4_div_accurate_pdx2_pdx2(x, y);
+	#else
+		return _mm512x4_div_quick_pdx2_pdx2(x, y);
+	#endif
+}
+
+/* __m512dx2 / __m512d */
+
+static inline __m512dx4 _mm512x4_div_accurate_pdx2_pd(const __m512dx2 x, const __m512d y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(x.hi, y);
+	r = _mm512x4_sub_pdx2_pdx2(x, _mm512x2_mul_pd_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y);
+	r = _mm512x4_sub_pdx4_pdx2(r, _mm512x2_mul_pd_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y);
+	r = _mm512x4_sub_pdx4_pdx2(r, _mm512x2_mul_pd_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y);
+	r = _mm512x4_sub_pdx4_pdx2(r, _mm512x2_mul_pd_pd(y, q.val[3]));
+
+	__m512d err = _mm512_div_pd(r.val[0], y);
+	_mm512x4_renorm_err_pdx4(&q, &err);
+	return q;
+}
+
+static inline __m512dx4 _mm512x4_div_quick_pdx2_pd(const __m512dx2 x, const __m512d y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(x.hi, y);
+	r = _mm512x4_sub_pdx2_pdx2(x, _mm512x2_mul_pd_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y);
+	r = _mm512x4_sub_pdx4_pdx2(r, _mm512x2_mul_pd_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y);
+	r = _mm512x4_sub_pdx4_pdx2(r, _mm512x2_mul_pd_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y);
+	_mm512x4_renorm_pdx4(&q);
+	return q;
+}
+
+static inline __m512dx4 _mm512x4_div_pdx2_pd(const __m512dx2 x, const __m512d y) {
+	#ifdef __M512DX4_IEEE_MODE
+		return _mm512x4_div_accurate_pdx2_pd(x, y);
+	#else
+		return _mm512x4_div_quick_pdx2_pd(x, y);
+	#endif
+}
+
+/* __m512d / __m512dx2 */
+
+static inline __m512dx4 _mm512x4_div_accurate_pd_pdx2(const __m512d x, const __m512dx2 y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(x, y.hi);
+	r = _mm512x4_sub_pd_pdx4(x, _mm512x4_mul_pdx2_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y.hi);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx2_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y.hi);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx2_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y.hi);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx2_pd(y, q.val[3]));
+
+	__m512d err = _mm512_div_pd(r.val[0], y.hi);
+	_mm512x4_renorm_err_pdx4(&q, &err);
+	return q;
+}
+
+static inline __m512dx4 _mm512x4_div_quick_pd_pdx2(const __m512d x, const __m512dx2 y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(x, y.hi);
+	r = _mm512x4_sub_pd_pdx4(x, _mm512x4_mul_pdx2_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y.hi);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx2_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y.hi);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx2_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y.hi);
+	_mm512x4_renorm_pdx4(&q);
+	return q;
+}
+
+static inline __m512dx4 _mm512x4_div_pd_pdx2(const __m512d x, const __m512dx2 y) {
+	#ifdef __M512DX4_IEEE_MODE
+		return _mm512x4_div_accurate_pd_pdx2(x, y);
+	#else
+		return _mm512x4_div_quick_pd_pdx2(x, y);
+	#endif
+}
+
+/* __m512d / __m512d */
+
+static inline __m512dx4 _mm512x4_div_accurate_pd_pd(const __m512d x, const __m512d y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(x, y);
+	r = _mm512x4_sub_pd_pdx2(x, _mm512x2_mul_pd_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y);
+	r = _mm512x4_sub_pdx4_pdx2(r, _mm512x2_mul_pd_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y);
+	r = _mm512x4_sub_pdx4_pdx2(r, _mm512x2_mul_pd_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y);
+	r = _mm512x4_sub_pdx4_pdx2(r, _mm512x2_mul_pd_pd(y, q.val[3]));
+
+	__m512d err = _mm512_div_pd(r.val[0], y);
+	_mm512x4_renorm_err_pdx4(&q, &err);
+	return q;
+}
+
+static inline __m512dx4 _mm512x4_div_quick_pd_pd(const __m512d x, const __m512d y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(x, y);
+	r = _mm512x4_sub_pd_pdx2(x, _mm512x2_mul_pd_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y);
+	r = _mm512x4_sub_pdx4_pdx2(r, _mm512x2_mul_pd_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y);
+	r = _mm512x4_sub_pdx4_pdx2(r, _mm512x2_mul_pd_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y);
+	_mm512x4_renorm_pdx4(&q);
+	return q;
+}
+
+static inline __m512dx4 _mm512x4_div_pd_pd(const __m512d x, const __m512d y) {
+	#ifdef __M512DX4_IEEE_MODE
+		return _mm512x4_div_accurate_pd_pd(x, y);
+	#else
+		return _mm512x4_div_quick_pd_pd(x, y);
+	#endif
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 Reciprocal
+//------------------------------------------------------------------------------
+/** 
+ * @author Taken and/or modified from libQD which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+
+/* 1.0 / __m512dx4 */
+
+static inline __m512dx4 _mm512x4_recip_accurate_pdx4(const __m512dx4 y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(_mm512_set1_pd(1.0), y.val[0]);
+	r = _mm512x4_sub_pd_pdx4(_mm512_set1_pd(1.0), _mm512x4_mul_pdx4_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y.val[0]);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx4_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y.val[0]);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx4_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y.val[0]);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx4_pd(y, q.val[3]));
+
+	__m512d err = _mm512_div_pd(r.val[0], y.val[0]);
+	_mm512x4_renorm_err_pdx4(&q, &err);
+	return q;
+}
+
+static inline __m512dx4 _mm512x4_recip_quick_pdx4(const __m512dx4 y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(_mm512_set1_pd(1.0), y.val[0]);
+	r = _mm512x4_sub_pd_pdx4(_mm512_set1_pd(1.0), _mm512x4_mul_pdx4_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y.val[0]);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx4_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y.val[0]);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx4_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y.val[0]);
+	_mm512x4_renorm_pdx4(&q);
+	return q;
+}
+
+static inline __m512dx4 _mm512x4_recip_pdx4(const __m512dx4 y) {
+	#ifdef __M512DX4_IEEE_MODE
+		return _mm512x4_recip_accurate_pdx4(y);
+	#else
+		return _mm512x4_recip_quick_pdx4(y);
+	#endif
+}
+
+/* 1.0 / __m512dx2 */
+
+static inline __m512dx4 _mm512x4_recip_accurate_pdx2(const __m512dx2 y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(_mm512_set1_pd(1.0), y.hi);
+	r = _mm512x4_sub_pd_pdx4(_mm512_set1_pd(1.0), _mm512x4_mul_pdx2_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y.hi);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx2_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y.hi);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx2_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y.hi);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx2_pd(y, q.val[3]));
+
+	__m512d err = _mm512_div_pd(r.val[0], y.hi);
+	_mm512x4_renorm_err_pdx4(&q, &err);
+	return q;
+}
+
+static inline __m512dx4 _mm512x4_recip_quick_pdx2(const __m512dx2 y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(_mm512_set1_pd(1.0), y.hi);
+	r = _mm512x4_sub_pd_pdx4(_mm512_set1_pd(1.0), _mm512x4_mul_pdx2_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y.hi);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx2_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y.hi);
+	r = _mm512x4_sub_pdx4(r, _mm512x4_mul_pdx2_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y.hi);
+	_mm512x4_renorm_pdx4(&q);
+	return q;
+}
+
+static inline __m512dx4 _mm512x4_recip_pdx2(const __m512dx2 y) {
+	#ifdef __M512DX4_IEEE_MODE
+		return _mm512x4_recip_accurate_pdx2(y);
+	#else
+		return _mm512x4_recip_quick_pdx2(y);
+	#endif
+}
+
+/* 1.0 / __m512d */
+
+static inline __m512dx4 _mm512x4_recip_accurate_pd(const __m512d y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(_mm512_set1_pd(1.0), y);
+	r = _mm512x4_sub_pd_pdx2(_mm512_set1_pd(1.0), _mm512x2_mul_pd_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y);
+	r = _mm512x4_sub_pdx4_pdx2(r, _mm512x2_mul_pd_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y);
+	r = _mm512x4_sub_pdx4_pdx2(r, _mm512x2_mul_pd_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y);
+	r = _mm512x4_sub_pdx4_pdx2(r, _mm512x2_mul_pd_pd(y, q.val[3]));
+
+	__m512d err = _mm512_div_pd(r.val[0], y);
+	_mm512x4_renorm_err_pdx4(&q, &err);
+	return q;
+}
+
+static inline __m512dx4 _mm512x4_recip_quick_pd(const __m512d y) {
+	__m512dx4 q, r;
+
+	q.val[0] = _mm512_div_pd(_mm512_set1_pd(1.0), y);
+	r = _mm512x4_sub_pd_pdx2(_mm512_set1_pd(1.0), _mm512x2_mul_pd_pd(y, q.val[0]));
+
+	q.val[1] = _mm512_div_pd(r.val[0], y);
+	r = _mm512x4_sub_pdx4_pdx2(r, _mm512x2_mul_pd_pd(y, q.val[1]));
+
+	q.val[2] = _mm512_div_pd(r.val[0], y);
+	r = _mm512x4_sub_pdx4_pdx2(r, _mm512x2_mul_pd_pd(y, q.val[2]));
+
+	q.val[3] = _mm512_div_pd(r.val[0], y);
+	_mm512x4_renorm_pdx4(&q);
+	return q;
+}
+
+static inline __m512dx4 _mm512x4_recip_pd(const __m512d y) {
+	#ifdef __M512DX4_IEEE_MODE
+		return _mm512x4_recip_accurate_pd(y);
+	#else
+		return _mm512x4_recip_quick_pd(y);
+	#endif
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 specialized arithmetic
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Multiplies by a known power of two (such as 2.0, 0.5, etc.) or zero
+ */
+static inline __m512dx4 _mm512x4_mul_power2_pdx4_pd(__m512dx4 x, const __m512d y) {
+	x.val[0] *= y;
+	x.val[1] *= y;
+	x.val[2] *= y;
+	x.val[3] *= y;
+	return x;
+}
+
+/**
+ * @brief Multiplies by a known power of two (such as 2.0, 0.5, etc.) or zero
+ */
+static inline __m512dx4 _mm512x4_mul_power2_pd_pdx4(const __m512d x, __m512dx4 y) {
+	y.val[0] *= x;
+	y.val[1] *= x;
+	y.val[2] *= x;
+	y.val[3] *= x;
+	return y;
+}
+
+/**
+ * @brief Multiplies by a known power of two (such as 2.0, 0.5, etc.) or zero.
+ * The result is stored as a __m512dx4
+ */
+static inline __m512dx4 _mm512x4_mul_power2_pd_pd(const __m512d x, const __m512d y) {
+	__m512dx4 ret;
+	ret.val[0] = x * y;
+	ret.val[1] = _mm512_setzero_pd();
+	ret.val[2] = _mm512_setzero_pd();
+	ret.val[3] = _mm512_setzero_pd();
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 Mathematical Constants
+//------------------------------------------------------------------------------
+
+/**
+ * @brief ~2.718281828 Returns the value of euler's number
+ */
+static inline __m512dx4 _mm512x4_const_e_pdx4(void) {
+	const __m512dx4 ret = {{
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x4005BF0A8B145769)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3CA4D57EE2B1013A)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xB92618713A31D3E2)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x35CC5A6D2B53C26D))
+	}};
+	return ret;
+}
+
+/**
+ * @brief ~1.442695041 Returns the value of log2(e)
+ */
+static inline __m512dx4 _mm512x4_const_log2e_pdx4(void) {
+	const __m512dx4 ret = {{
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FF71547652B82FE)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3C7777D0FFDA0D24)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xB9160BB8A5442AB9)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xB594B52D3BA6D74D))
+	}};
+	return ret;
+}
+
+/**
+ * @brief ~0.434294482 Returns the value of log10(e)
+ */
+static inline __m512dx4 _mm512x4_const_log10e_pdx4(void) {
+	const __m512dx4 ret = {{
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FDBCB7B1526E50E)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3C695355BAAAFAD3)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x38FEE191F71A3012)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3587268808E8FCB5))
+	}};
+	return ret;
+}
+
+/**
+ * @brief ~3.141592654 Returns the value of pi
+ */
+static inline __m512dx4 _mm512x4_const_pi_pdx4(void) {
+	const __m512dx4 ret = {{
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x400921FB54442D18)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3CA1A62633145C07)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xB92F1976B7ED8FBC)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x35C4CF98E804177D))
+	}};
+	return ret;
+}
+
+/**
+ * @brief ~0.318309886 Returns the value of 1 / pi
+ */
+static inline __m512dx4 _mm512x4_const_inv_pi_pdx4(void) {
+	const __m512dx4 ret = {{
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FD45F306DC9C883)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xBC76B01EC5417056)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xB916447E493AD4CE)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x35BE21C820FF28B2))
+	}};
+	return ret;
+}
+
+/**
+ * @brief ~0.564189584 Returns the value of 1 / sqrt(pi)
+ */
+static inline __m512dx4 _mm512x4_const_inv_sqrtpi_pdx4(void) {
+	const __m512dx4 ret = {{
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FE20DD750429B6D)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3C61AE3A914FED80)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xB8F3CBBEBF65F145)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xB58E0C574632F53E))
+	}};
+	return ret;
+}
+
+/**
+ * @brief ~0.693147181 Returns the value of ln(2)
+ */
+static inline __m512dx4 _mm512x4_const_ln2_pdx4(void) {
+	const __m512dx4 ret = {{
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FE62E42FEFA39EF)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3C7ABC9E3B39803F)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3907B57A079A1934)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xB5AACE93A4EBE5D1))
+	}};
+	return ret;
+}
+
+/**
+ * @brief ~2.302585093 Returns the value of ln(10)
+ */
+static inline __m512dx4 _mm512x4_const_ln10_pdx4(void) {
+	const __m512dx4 ret = {{
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x40026BB1BBB55516)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xBCAF48AD494EA3E9)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xB949EBAE3AE0260C)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xB5E2D10378BE1CF1))
+	}};
+	return ret;
+}
+
+/**
+ * @brief ~1.414213562 Returns the value of sqrt(2)
+ */
+static inline __m512dx4 _mm512x4_const_sqrt2_pdx4(void) {
+	const __m512dx4 ret = {{
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FF6A09E667F3BCD)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xBC9BDD3413B26456)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x39357D3E3ADEC175)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x35B2775099DA2F59))
+	}};
+	return ret;
+}
+
+/**
+ * @brief ~1.732050808 Returns the value of sqrt(3)
+ */
+static inline __m512dx4 _mm512x4_const_sqrt3_pdx4(void) {
+	const __m512dx4 ret = {{
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FFBB67AE8584CAA)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3C9CEC95D0B5C1E3)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xB91F11DB689F2CCF)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x35B3DA4798C720A6))
+	}};
+	return ret;
+}
+
+/**
+ * @brief ~0.577350269 Returns the value of 1 / sqrt(3)
+ */
+static inline __m512dx4 _mm512x4_const_inv_sqrt3_pdx4(void) {
+	const __m512dx4 ret = {{
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FE279A74590331C)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3C834863E0792BED)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xB92A82F9E6C53222)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xB5CCB0F41134253A))
+	}};
+	return ret;
+}
+
+/**
+ * @brief ~0.577215665 Returns the value of gamma (The Euler–Mascheroni constant)
+ */
+static inline __m512dx4 _mm512x4_const_egamma_pdx4(void) {
+	const __m512dx4 ret = {{
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FE2788CFC6FB619)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xBC56CB90701FBFAB)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xB8F34A95E3133C51)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3599730064300F7D))
+	}};
+	return ret;
+}
+
+/**
+ * @brief ~1.618033989 Returns the value of phi (The golden ratio)
+ */
+static inline __m512dx4 _mm512x4_const_phi_pdx4(void) {
+	const __m512dx4 ret = {{
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x3FF9E3779B97F4A8)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xBC8F506319FCFD19)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0x392B906821044ED8)),
+		_mm512_castsi512_pd(_mm512_set1_epi64((int64_t)0xB5A8BB1B5C0F272C))
+	}};
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 floating point classify
+//------------------------------------------------------------------------------
+
+/* values */
+
+	/**
+	 * @brief Returns a __m512dx4 value set to positive infinity
+	 */
+	static inline __m512dx4 _mm512x4_get_infinity_pdx4(void) {
+		__m512dx4 ret = {{
+			_mm512_get_infinity_pd(),
+			_mm512_get_infinity_pd(),
+			_mm512_get_infinity_pd(),
+			_mm512_get_infinity_pd()
+		}};
+		return ret;
+	}
+
+	/**
+	 * @brief Returns a __m512dx4 value set to signaling NaN
+	 */
+	static inline __m512dx4 _mm512x4_get_sNaN_pdx4(void) {
+		__m512dx4 ret = {{
+			_mm512_get_sNaN_pd(),
+			_mm512_get_sNaN_pd(),
+			_mm512_get_sNaN_pd(),
+			_mm512_get_sNaN_pd()
+		}};
+		return ret;
+	}
+
+	/**
+	 * @brief Returns a __m512dx4 value set to quiet NaN
+	 */
+	static inline __m512dx4 _mm512x4_get_qNaN_pdx4(void) {
+		__m512dx4 ret = {{
+			_mm512_get_qNaN_pd(),
+			_mm512_get_qNaN_pd(),
+			_mm512_get_qNaN_pd(),
+			_mm512_get_qNaN_pd()
+		}};
+		return ret;
+	}
+
+/* Float Classify */
+
+	/** @brief Returns true if x is negative */
+	static inline __mmask8 _mm512_signbit_pdx4(const __m512dx4 x) {
+		return _mm512_signbit_pd(x.val[0]);
+	}
+
+	/** @brief Returns true if x is finite */
+	static inline __mmask8 _mm512_isfinite_pdx4(const __m512dx4 x) {
+		return _mm512_isfinite_pd(x.val[0]);
+	}
+
+	/** @brief Returns true if x is +-infinity */
+	static inline __mmask8 _mm512_isinf_pdx4(const __m512dx4 x) {
+		return _mm512_isinf_pd(x.val[0]);
+	}
+
+	/** @brief Returns true if x is any kind of NaN */
+	static inline __mmask8 _mm512_isnan_pdx4(const __m512dx4 x) {
+		return _mm512_isnan_pd(x.val[0]);
+	}
+
+	/** @brief Returns true if x is normal */
+	static inline __mmask8 _mm512_isnormal_pdx4(const __m512dx4 x) {
+		return _mm512_isnormal_pd(x.val[0]) & (
+			_mm512_isnormal_pd(x.val[1]) |
+			_mm512_cmp_pd_mask(x.val[1], _mm512_setzero_pd(), _CMP_EQ_OQ)
+		) & (
+			_mm512_isnormal_pd(x.val[2]) |
+			_mm512_cmp_pd_mask(x.val[2], _mm512_setzero_pd(), _CMP_EQ_OQ)
+		) & (
+			_mm512_isnormal_pd(x.val[3]) |
+			_mm512_cmp_pd_mask(x.val[3], _mm512_setzero_pd(), _CMP_EQ_OQ)
+		);
+	}
+
+	/** @brief Returns true if x is denormal and non-zero */
+	static inline __mmask8 _mm512_isdenormal_pdx4(const __m512dx4 x) {
+		return
+			_mm512_isdenormal_pd(x.val[0]) | _mm512_isdenormal_pd(x.val[1]) |
+			_mm512_isdenormal_pd(x.val[2]) | _mm512_isdenormal_pd(x.val[3]);
+	}
+
+	/** @brief Returns true if x and y are unordered */
+	static inline __mmask8 _mm512_isunordered_pdx4(const __m512dx4 x, const __m512dx4 y) {
+		return _mm512_isunordered_pd(x.val[0], y.val[0]);
+	}
+
+//------------------------------------------------------------------------------
+// __m512dx4 max/min functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Returns the fmax of x and y. Correctly handling NaN.
+ * You may use _mm512x4_max_pdx4 as a faster alternative.
+ */
+static inline __m512dx4 _mm512x4_fmax_pdx4(__m512dx4 x, __m512dx4 y) {
+	// returns y if x < y, or if x is NaN and y is not NaN
+	const __mmask8 fmax_cmp = _mm512_cmplt_pdx4_mask(x, y) | (
+		_mm512_isnan_pdx4(x) & _mm512_cmp_pd_mask(y.val[0], y.val[0], _CMP_ORD_Q)
+	);
+	return _mm512x4_mask_blend_pdx4(fmax_cmp, x, y);
+}
+
+/**
+ * @brief Returns the fmin of x and y. Correctly handling NaN.
+ * You may use _mm512x4_min_pdx4 as a faster alternative.
+ */
+static inline __m512dx4 _mm512x4_fmin_pdx4(__m512dx4 x, __m512dx4 y) {
+	// returns y if x > y, or if x is NaN and y is not NaN
+	const __mmask8 fmin_cmp = _mm512_cmpgt_pdx4_mask(x, y) | (
+		_mm512_isnan_pdx4(x) & _mm512_cmp_pd_mask(y.val[0], y.val[0], _CMP_ORD_Q)
+	);
+	return _mm512x4_mask_blend_pdx4(fmin_cmp, x, y);
+}
+
+static inline __m512dx4 _mm512x4_max_pdx4(__m512dx4 x, __m512dx4 y) {
+	return _mm512x4_mask_blend_pdx4(_mm512_cmplt_pdx4_mask(x, y), x, y);
+}
+
+static inline __m512dx4 _mm512x4_min_pdx4(__m512dx4 x, __m512dx4 y) {
+	return _mm512x4_mask_blend_pdx4(_mm512_cmpgt_pdx4_mask(x, y), x, y);
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 rounding functions
+//------------------------------------------------------------------------------
+
+static inline __m512dx4 _mm512x4_trunc_pdx4(__m512dx4 x) {
+	__m512dx4 ret;
+	ret.val[0] = _mm512_trunc_pd(x.val[0]);
+	// lower limbs are only rounded when the higher limbs are integers
+	__mmask8 cmp_int = _mm512_cmp_pd_mask(ret.val[0], x.val[0], _CMP_EQ_OQ);
+	ret.val[1] = _mm512_maskz_mov_pd(cmp_int, _mm512_trunc_pd(x.val[1]));
+	cmp_int &= _mm512_cmp_pd_mask(ret.val[1], x.val[1], _CMP_EQ_OQ);
+	ret.val[2] = _mm512_maskz_mov_pd(cmp_int, _mm512_trunc_pd(x.val[2]));
+	cmp_int &= _mm512_cmp_pd_mask(ret.val[2], x.val[2], _CMP_EQ_OQ);
+	ret.val[3] = _mm512_maskz_mov_pd(cmp_int, _mm512_trunc_pd(x.val[3]));
+	_mm512x4_renorm_pdx4(&ret);
+	return ret;
+}
+
+static inline __m512dx4 _mm512x4_floor_pdx4(__m512dx4 x) {
+	__m512dx4 ret;
+	ret.val[0] = _mm512_floor_pd(x.val[0]);
+	// lower limbs are only rounded when the higher limbs are integers
+	__mmask8 cmp_int = _mm512_cmp_pd_mask(ret.val[0], x.val[0], _CMP_EQ_OQ);
+	ret.val[1] = _mm512_maskz_mov_pd(cmp_int, _mm512_floor_pd(x.val[1]));
+	cmp_int &= _mm512_cmp_pd_mask(ret.val[1], x.val[1], _CMP_EQ_OQ);
+	ret.val[2] = _mm512_maskz_mov_pd(cmp_int, _mm512_floor_pd(x.val[2]));
+	cmp_int &= _mm512_cmp_pd_mask(ret.val[2], x.val[2], _CMP_EQ_OQ);
+	ret.val[3] = _mm512_maskz_mov_pd(cmp_int, _mm512_floor_pd(x.val[3]));
+	_mm512x4_renorm_pdx4(&ret);
+	return ret;
+}
+
+static inline __m512dx4 _mm512x4_ceil_pdx4(__m512dx4 x) {
+	__m512dx4 ret;
+	ret.val[0] = _mm512_ceil_pd(x.val[0]);
+	// lower limbs are only rounded when the higher limbs are integers
+	__mmask8 cmp_int = _mm512_cmp_pd_mask(ret.val[0], x.val[0], _CMP_EQ_OQ);
+	ret.val[1] = _mm512_maskz_mov_pd(cmp_int, _mm512_ceil_pd(x.val[1]));
+	cmp_int &= _mm512_cmp_pd_mask(ret.val[1], x.val[1], _CMP_EQ_OQ);
+	ret.val[2] = _mm512_maskz_mov_pd(cmp_int, _mm512_ceil_pd(x.val[2]));
+	cmp_int &= _mm512_cmp_pd_mask(ret.val[2], x.val[2], _CMP_EQ_OQ);
+	ret.val[3] = _mm512_maskz_mov_pd(cmp_int, _mm512_ceil_pd(x.val[3]));
+	_mm512x4_renorm_pdx4(&ret);
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 math.h functions
+//------------------------------------------------------------------------------
+
+static inline __m512dx4 _mm512x4_fabs_pdx4(__m512dx4 x) {
+	return _mm512x4_mask_blend_pdx4(
+		_mm512_signbit_pd(x.val[0]), x, _mm512x4_negate_pdx4(x)
+	);
+}
+
+static inline __m512dx4 _mm512x4_fdim_pdx4(__m512dx4 x, __m512dx4 y) {
+	__m512dx4 ret = _mm512x4_sub_pdx4(x, y);
+	// NaN remains NaN, and -0.0 becomes +0.0
+	return _mm512x4_maskz_mov_pdx4(_mm512_cmpnle_zero_pdx4_mask(ret), ret);
+}
+
+static inline __m512dx4 _mm512x4_copysign_pdx4(__m512dx4 x, __m512dx4 y) {
+	return _mm512x4_mask_blend_pdx4(
+		_mm512_signbit_pd(_mm512_castsi512_pd(_mm512_xor_si512(
+			_mm512_castpd_si512(x.val[0]), _mm512_castpd_si512(y.val[0])
+		))), x, _mm512x4_negate_pdx4(x)
+	);
+}
+
+static inline __m512dx4 _mm512x4_copysign_pdx4_pd(__m512dx4 x, __m512d y) {
+	return _mm512x4_mask_blend_pdx4(
+		_mm512_signbit_pd(_mm512_castsi512_pd(_mm512_xor_si512(
+			_mm512_castpd_si512(x.val[0]), _mm512_castpd_si512(y)
+		))), x, _mm512x4_negate_pdx4(x)
+	);
+}
+
+static inline __m512dx4 _mm512x4_sqrt_pdx4(__m512dx4 x) {
+	__m512dx2 guess = {x.val[0], x.val[1]};
+	guess = _mm512x2_sqrt_pdx2(guess);
+	return _mm512x4_maskz_mov_pdx4(
+		// returns 0.0 on division by 0.0
+		_mm512_cmpneq_zero_pdx2_mask(guess),
+		_mm512x4_mul_power2_pdx4_pd(
+			_mm512x4_add_pdx2_pdx4(guess, _mm512x4_div_pdx4_pdx2(x, guess)),
+			_mm512_set1_pd(0.5)
+		)
+	);
+}
+
+/**
+* @brief returns the fraction part of a Float64x4 value. int_part may be NULL
+*/
+static inline __m512dx4 _mm512x4_modf_pdx4(const __m512dx4 x, __m512dx4* const int_part) {
+	__m512dx4 trunc_part = _mm512x4_trunc_pdx4(x);
+	if (int_part != NULL) {
+		*int_part = trunc_part;
+	}
+	return _mm512x4_sub_pdx4(x, trunc_part);
+}
+
+static inline __m512dx4 _mm512x4_fmod_pdx4(const __m512dx4 x, const __m512dx4 y) {
+	__m512dx4 trunc_part = _mm512x4_trunc_pdx4(_mm512x4_div_pdx4(x, y));
+	return _mm512x4_sub_pdx4(x, _mm512x4_mul_pdx4(y, trunc_part));
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 ilogb
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Computes ilogb(x) on a __m512dx4 value
+ * @returns __m512i int64_t
+ */
+static inline __m512i _mm512x4_ilogb_pdx4_epi64(__m512dx4 x) {
+	return _mm512_ilogb_pd_epi64(x.val[0]);
+}
+
+/**
+ * @brief Computes ilogb(x) on a __m512dx4 value
+ * @returns __m256i int32_t
+ */
+static inline __m256i _mm512x4_ilogb_pdx4_epi32(__m512dx4 x) {
+	return _mm512_ilogb_pd_epi32(x.val[0]);
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 ldexp
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Computes ldexp(x, expon)
+ */
+static inline __m512dx4 _mm512x4_ldexp_pdx4_epi64(__m512dx4 x, __m512i expon) {
+	x.val[0] = _mm512_ldexp_pd_epi64(x.val[0], expon);
+	x.val[1] = _mm512_ldexp_pd_epi64(x.val[1], expon);
+	x.val[2] = _mm512_ldexp_pd_epi64(x.val[2], expon);
+	x.val[3] = _mm512_ldexp_pd_epi64(x.val[3], expon);
+	return x;
+}
+
+/**
+ * @brief Computes ldexp(x, expon)
+ */
+static inline __m512dx4 _mm512x4_ldexp_pdx4_epi32(__m512dx4 x, __m256i expon) {
+	x.val[0] = _mm512_ldexp_pd_epi32(x.val[0], expon);
+	x.val[1] = _mm512_ldexp_pd_epi32(x.val[1], expon);
+	x.val[2] = _mm512_ldexp_pd_epi32(x.val[2], expon);
+	x.val[3] = _mm512_ldexp_pd_epi32(x.val[3], expon);
+	return x;
+}
+
+//------------------------------------------------------------------------------
+// __m512dx4 frexp
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Computes frexp(x, expon) on a __m512dx4 value
+ * @returns sign extended __m512i int64_t
+ */
+static inline __m512dx4 _mm512x4_frexp_pdx4_epi64(__m512dx4 x, __m512i* const expon) {
+	x.val[0] = _mm512_frexp_pd_epi64(x.val[0], expon);
+	const __m512i ldexp_value = _mm512_sub_epi64(_mm512_setzero_si512(), *expon);
+	x.val[1] = _mm512_ldexp_pd_epi64(x.val[1], ldexp_value);
+	x.val[2] = _mm512_ldexp_pd_epi64(x.val[2], ldexp_value);
+	x.val[3] = _mm512_ldexp_pd_epi64(x.val[3], ldexp_value);
+	return x;
+}
+
+/**
+ * @brief Computes frexp(x, expon) on a __m512dx4 value
+ * @returns __m256i int32_t
+ */
+static inline __m512dx4 _mm512x4_frexp_pdx4_epi32(__m512dx4 x, __m256i* const expon) {
+	x.val[0] = _mm512_frexp_pd_epi32(x.val[0], expon);
+	const __m256i ldexp_value = _mm256_sub_epi32(_mm256_setzero_si256(), *expon);
+	x.val[1] = _mm512_ldexp_pd_epi32(x.val[1], ldexp_value);
+	x.val[2] = _mm512_ldexp_pd_epi32(x.val[2], ldexp_value);
+	x.val[3] = _mm512_ldexp_pd_epi32(x.val[3], ldexp_value);
+	return x;
+}
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* FLOAT64X4_AVX512_H */
@@ -19,6 +19,10 @@
  * inv_fact_odd
  * sin_table
  * cos_table
+ * exp2_table
+ * log_table_invc
+ * log_table_log
+ * log_inv_odd
  */
 
 // static const int n_inv_fact = 15;
@@ -784,4 +788,495 @@ static constexpr Float64x4 cos_table[] {
 /* 256 */ {0x1.6a09e667f3bcdp-1,-0x1.bdd3413b26456p-55,+0x1.57d3e3adec175p-109,+0x1.2775099da2f59p-165}
 };
 
+/**
+ * @brief 2^(j / 256) for j = 0 to 255
+ */
+static constexpr Float64x4 exp2_table[] = {
+/*   0 */ {0x1.0000000000000p+0 ,+0x0.0000000000000p+0 ,+0x0.0000000000000p+0 ,+0x0.0000000000000p+0 },
+/*   1 */ {0x1.00b1afa5abcbfp+0 ,-0x1.4f6b2a7609f71p-55,-0x1.b55dd523f3c08p-111,+0x1.92e83d6771c04p-165},
+/*   2 */ {0x1.0163da9fb3335p+0 ,+0x1.b61299ab8cdb7p-54,+0x1.bf48007d80987p-109,-0x1.f41dbfbf87955p-164},
+/*   3 */ {0x1.02168143b0281p+0 ,-0x1.2bf310fc54eb6p-55,+0x1.9953ea727ff0bp-109,+0x1.4cfffbd5b4b6ep-164},
+/*   4 */ {0x1.02c9a3e778061p+0 ,-0x1.19083535b085dp-56,-0x1.9085b0a3d74d5p-110,-0x1.d1a3b22f7f8a5p-167},
+/*   5 */ {0x1.037d42e11bbccp+0 ,+0x1.56811eeade11ap-57,+0x1.1313d5abd77e9p-111,-0x1.e2c5fdf73ad7ap-167},
+/*   6 */ {0x1.04315e86e7f85p+0 ,-0x1.0a31c1977c96ep-54,-0x1.912fbf44b4040p-112,+0x1.6bd9157a6e913p-166},
+/*   7 */ {0x1.04e5f72f654b1p+0 ,+0x1.4c3793aa0d08dp-55,-0x1.f9c132b72afe2p-109,+0x1.f8705c13238bdp-163},
+/*   8 */ {0x1.059b0d3158574p+0 ,+0x1.d73e2a475b465p-55,+0x1.05ff94f8d257ep-110,-0x1.05a283dafd0ebp-167},
+/*   9 */ {0x1.0650a0e3c1f89p+0 ,-0x1.5cb7b5799c397p-54,+0x1.3e0adfe6c4c98p-108,+0x1.e5545218f9811p-162},
+/*  10 */ {0x1.0706b29ddf6dep+0 ,-0x1.c91dfe2b13c27p-55,+0x1.fb41f2e2c24abp-110,+0x1.d78c45d4b1abcp-166},
+/*  11 */ {0x1.07bd42b72a836p+0 ,+0x1.3233454458700p-55,-0x1.92b8d5099366ep-111,-0x1.357bf5cc5c89ep-165},
+/*  12 */ {0x1.0874518759bc8p+0 ,+0x1.186be4bb284ffp-57,+0x1.15820d96b414fp-111,-0x1.d9b17cbfca113p-166},
+/*  13 */ {0x1.092bdf66607e0p+0 ,-0x1.68063800a3fd1p-54,+0x1.4189ff8d63ef8p-111,+0x1.57021f8e7028fp-171},
+/*  14 */ {0x1.09e3ecac6f383p+0 ,+0x1.1487818316136p-54,-0x1.48b45d1fdc259p-108,+0x1.873fe65bab5e1p-163},
+/*  15 */ {0x1.0a9c79b1f3919p+0 ,+0x1.5d16c873d1d38p-55,-0x1.cf8d9770223ddp-109,+0x1.e431e25b7bf41p-164},
+/*  16 */ {0x1.0b5586cf9890fp+0 ,+0x1.8a62e4adc610bp-54,-0x1.67c9bd6ebf74cp-108,-0x1.8a7aeaea2bd4dp-163},
+/*  17 */ {0x1.0c0f145e46c85p+0 ,+0x1.4f98906d21cefp-54,+0x1.39d71c412378ep-111,-0x1.d6d974dc9b1e8p-168},
+/*  18 */ {0x1.0cc922b7247f7p+0 ,+0x1.01edc16e24f71p-54,+0x1.e8aac564e6fe3p-108,-0x1.0e2bce026a817p-164},
+/*  19 */ {0x1.0d83b23395decp+0 ,-0x1.bc14de43f316ap-54,-0x1.696bec12e389cp-110,-0x1.f379d2015bd7ep-164},
+/*  20 */ {0x1.0e3ec32d3d1a2p+0 ,+0x1.03a1727c57b53p-59,-0x1.5aa76994e9ddbp-113,+0x1.e9f966a4534e7p-168},
+/*  21 */ {0x1.0efa55fdfa9c5p+0 ,-0x1.49db9bc54021bp-54,-0x1.d4ad57103f1fcp-108,-0x1.3a3d44ca4f48fp-166},
+/*  22 */ {0x1.0fb66affed31bp+0 ,-0x1.b9bedc44ebd7bp-57,-0x1.aeb1f49d84259p-112,-0x1.ad6ffd7659f8bp-166},
+/*  23 */ {0x1.1073028d7233ep+0 ,+0x1.d46eb1692fdd5p-55,+0x1.f57015b4875a8p-110,-0x1.5a82b161e6eb2p-165},
+/*  24 */ {0x1.11301d0125b51p+0 ,-0x1.6c51039449b3ap-54,+0x1.9d58b988f562dp-109,-0x1.11a8bd8e8794fp-164},
+/*  25 */ {0x1.11edbab5e2ab6p+0 ,-0x1.ca454f703fb72p-54,+0x1.3454b21b02588p-112,-0x1.c0b67214976dbp-166},
+/*  26 */ {0x1.12abdc06c31ccp+0 ,-0x1.1b514b36ca5c7p-58,-0x1.08d8f42083120p-112,-0x1.ac538d1f9f14cp-166},
+/*  27 */ {0x1.136a814f204abp+0 ,-0x1.7108fba48dcf0p-57,+0x1.c9a4e34e91caap-111,+0x1.18787bf27033cp-167},
+/*  28 */ {0x1.1429aaea92de0p+0 ,-0x1.32fbf9af1369ep-54,-0x1.2fe7bb4c76416p-108,+0x1.ebb748874e197p-162},
+/*  29 */ {0x1.14e95934f312ep+0 ,-0x1.b91e839bf44abp-55,-0x1.7ddfed6937232p-109,+0x1.89a7e61474379p-163},
+/*  30 */ {0x1.15a98c8a58e51p+0 ,+0x1.2406ab9eeab0ap-55,-0x1.01b575279c474p-110,+0x1.b376c26892895p-164},
+/*  31 */ {0x1.166a45471c3c2p+0 ,+0x1.8f23b82ea1a32p-58,+0x1.cec6f65f9f480p-112,-0x1.0aa77a3170949p-167},
+/*  32 */ {0x1.172b83c7d517bp+0 ,-0x1.19041b9d78a76p-55,+0x1.4f2406aa13ff0p-109,-0x1.453cb606e1ecap-163},
+/*  33 */ {0x1.17ed48695bbc0p+0 ,+0x1.09e3fe2ac5a64p-56,+0x1.0f94cec9c9210p-111,+0x1.2d26f48a616fap-165},
+/*  34 */ {0x1.18af9388c8deap+0 ,-0x1.11023d1970f6cp-54,+0x1.725f0040b97c5p-110,-0x1.ee6be2d7bf769p-164},
+/*  35 */ {0x1.1972658375d2fp+0 ,+0x1.4aadd85f17e08p-54,+0x1.629678a30a399p-109,-0x1.962d2e662c304p-165},
+/*  36 */ {0x1.1a35beb6fcb75p+0 ,+0x1.e5b4c7b4968e4p-55,+0x1.ad36183926ae8p-111,-0x1.47391ec6daf4dp-166},
+/*  37 */ {0x1.1af99f8138a1cp+0 ,+0x1.7bf85a4b69280p-54,-0x1.5c2c423bf7bd0p-110,-0x1.3c8fedf7d0e70p-164},
+/*  38 */ {0x1.1bbe084045cd4p+0 ,-0x1.95386352ef607p-54,-0x1.40ca69503718ep-109,+0x1.5519a1b448ba6p-164},
+/*  39 */ {0x1.1c82f95281c6bp+0 ,+0x1.009778010f8c9p-54,-0x1.875b881c94e67p-110,-0x1.c4ce38daec4b1p-166},
+/*  40 */ {0x1.1d4873168b9aap+0 ,+0x1.e016e00a2643cp-54,+0x1.ea62d0881b918p-110,+0x1.66cf051d7219cp-164},
+/*  41 */ {0x1.1e0e75eb44027p+0 ,-0x1.6fdd8088cb6dep-54,-0x1.0459f81668706p-108,+0x1.daf8e7b74e08ep-167},
+/*  42 */ {0x1.1ed5022fcd91dp+0 ,-0x1.1df98027bb78cp-54,+0x1.e504d36c47475p-108,-0x1.b2410cfccb25ep-163},
+/*  43 */ {0x1.1f9c18438ce4dp+0 ,-0x1.bf524a097af5cp-54,-0x1.786d77f83061cp-109,+0x1.634b35369fc46p-164},
+/*  44 */ {0x1.2063b88628cd6p+0 ,+0x1.dc775814a8495p-55,-0x1.781dbc16f1ea4p-111,+0x1.001099379cc70p-166},
+/*  45 */ {0x1.212be3578a819p+0 ,+0x1.3592d2cfcaac9p-54,-0x1.664b40209c8aap-110,+0x1.60cd4702f74e0p-166},
+/*  46 */ {0x1.21f49917ddc96p+0 ,+0x1.2a97e9494a5eep-55,-0x1.693c2b3b7106bp-109,+0x1.0ee7411dce4f2p-163},
+/*  47 */ {0x1.22bdda27912d1p+0 ,+0x1.d34fb5577d69fp-55,-0x1.b872152843078p-110,+0x1.04fe3dc6980efp-164},
+/*  48 */ {0x1.2387a6e756238p+0 ,+0x1.9b07eb6c70573p-54,-0x1.4d89f9af532e0p-109,+0x1.6fb4f26f1203dp-163},
+/*  49 */ {0x1.2451ffb82140ap+0 ,+0x1.acfcc911ca996p-55,+0x1.8463b513c7000p-110,+0x1.be9bd35f18832p-164},
+/*  50 */ {0x1.251ce4fb2a63fp+0 ,+0x1.ac155bef4f4a4p-55,+0x1.1a9c8afdcf797p-112,-0x1.b2d0e6b4b585ap-166},
+/*  51 */ {0x1.25e85711ece75p+0 ,+0x1.3e1a24ac31b2cp-54,+0x1.5ba6e76088bcdp-108,+0x1.9710a202d0051p-164},
+/*  52 */ {0x1.26b4565e27cddp+0 ,+0x1.2bd339940e9d9p-55,+0x1.277393a461b77p-110,+0x1.5ff44e6b07d57p-164},
+/*  53 */ {0x1.2780e341ddf29p+0 ,+0x1.e067c05f9e76cp-54,-0x1.bd4b7cee4538bp-108,+0x1.83dd95bbf759dp-162},
+/*  54 */ {0x1.284dfe1f56381p+0 ,-0x1.a4c3a8c3f0d7ep-54,+0x1.67fdaa2e52d7dp-108,-0x1.fbe4347674cc1p-162},
+/*  55 */ {0x1.291ba7591bb70p+0 ,-0x1.2cc7228401cbdp-55,+0x1.7a3902d46e4c4p-114,+0x1.78d934130a09cp-168},
+/*  56 */ {0x1.29e9df51fdee1p+0 ,+0x1.612e8afad1255p-55,+0x1.de54485604690p-111,+0x1.ff6c05035fb63p-167},
+/*  57 */ {0x1.2ab8a66d10f13p+0 ,-0x1.95743191690a7p-54,-0x1.dde6d7e73b7f6p-109,+0x1.72c2e20e68b56p-164},
+/*  58 */ {0x1.2b87fd0dad990p+0 ,-0x1.10adcd6381aa4p-59,+0x1.0885fb8796dbdp-113,-0x1.d7374d094dab5p-167},
+/*  59 */ {0x1.2c57e39771b2fp+0 ,-0x1.50145a6eb5124p-54,-0x1.e245c425cbfd4p-108,-0x1.257d2aa4d1885p-163},
+/*  60 */ {0x1.2d285a6e4030bp+0 ,+0x1.0024754db41d5p-54,-0x1.ee9d8f8cb9307p-110,+0x1.8a6b1344562a5p-172},
+/*  61 */ {0x1.2df961f641589p+0 ,+0x1.d16cffbbce198p-54,+0x1.aadc67a5cf780p-109,+0x1.cbaecb31c45d0p-164},
+/*  62 */ {0x1.2ecafa93e2f56p+0 ,+0x1.1ca0f45d52383p-56,+0x1.d7b08dee6d12ap-111,-0x1.d55986c401254p-167},
+/*  63 */ {0x1.2f9d24abd886bp+0 ,-0x1.53c55532bda93p-57,+0x1.286089c742098p-111,+0x1.fe862b642cd29p-165},
+/*  64 */ {0x1.306fe0a31b715p+0 ,+0x1.6f46ad23182e4p-55,+0x1.7b7b2f09cd0d9p-110,-0x1.60afd0e50e934p-164},
+/*  65 */ {0x1.31432edeeb2fdp+0 ,+0x1.959a3f3f3fcd1p-55,-0x1.91ceb071b81b5p-109,-0x1.fe76a9972ece4p-163},
+/*  66 */ {0x1.32170fc4cd831p+0 ,+0x1.a9ce78e18047cp-55,+0x1.b778c882b85e8p-110,+0x1.6d904af8508ebp-170},
+/*  67 */ {0x1.32eb83ba8ea32p+0 ,-0x1.c45e83cb4f318p-54,-0x1.b78c73a0898b9p-108,-0x1.c1f269743ed5cp-165},
+/*  68 */ {0x1.33c08b26416ffp+0 ,+0x1.32721843659a6p-54,-0x1.406a2ea6cfc6bp-108,+0x1.ceca6b31560e5p-163},
+/*  69 */ {0x1.3496266e3fa2dp+0 ,-0x1.35a75930881a4p-55,-0x1.475af6a7b6cc9p-111,-0x1.8306e48634f78p-165},
+/*  70 */ {0x1.356c55f929ff1p+0 ,-0x1.b5cee5c4e4628p-55,-0x1.8e524e520d5f2p-109,-0x1.b221b61a20663p-163},
+/*  71 */ {0x1.36431a2de883bp+0 ,-0x1.c3144a06cb85ep-55,+0x1.f8bb041238096p-109,+0x1.2b4bdcdba06bcp-163},
+/*  72 */ {0x1.371a7373aa9cbp+0 ,-0x1.63aeabf42eae2p-54,+0x1.87e3e12516bfap-108,-0x1.cb320de689626p-163},
+/*  73 */ {0x1.37f26231e754ap+0 ,-0x1.9f5ca9eceb23cp-54,+0x1.57469ed7e12f8p-111,+0x1.952f7d21b78c0p-165},
+/*  74 */ {0x1.38cae6d05d866p+0 ,-0x1.e958d3c9904bdp-54,+0x1.0a77a61404f21p-109,+0x1.31eb2e8f05544p-164},
+/*  75 */ {0x1.39a401b7140efp+0 ,-0x1.9a9a5fc8e2934p-54,-0x1.18ff8ae910b7ap-108,-0x1.7d31251f5fa8bp-169},
+/*  76 */ {0x1.3a7db34e59ff7p+0 ,-0x1.5e436d661f5e3p-56,+0x1.9b0b1ff17c296p-111,+0x1.dd62680ce9bf9p-165},
+/*  77 */ {0x1.3b57fbfec6cf4p+0 ,+0x1.54c66e26fff18p-54,+0x1.d68f8b2e3be80p-108,+0x1.f82d9e731b45ep-165},
+/*  78 */ {0x1.3c32dc313a8e5p+0 ,-0x1.efff8375d29c3p-54,-0x1.1143f2a93395ap-109,+0x1.fae9fc9ecebcep-172},
+/*  79 */ {0x1.3d0e544ede173p+0 ,+0x1.fe8d08c284c71p-56,+0x1.1ba164ea65915p-115,+0x1.91360970f7041p-173},
+/*  80 */ {0x1.3dea64c123422p+0 ,+0x1.ada0911f09ebcp-55,-0x1.808ba68fa8fb7p-109,-0x1.ecc1d5dde0688p-163},
+/*  81 */ {0x1.3ec70df1c5175p+0 ,-0x1.af6637b8c9bcap-55,-0x1.9bcdef349ba26p-111,-0x1.6f7b5edb77433p-166},
+/*  82 */ {0x1.3fa4504ac801cp+0 ,-0x1.7d023f956f9f3p-54,-0x1.0473e3724200dp-108,-0x1.db37b0c9cf81dp-163},
+/*  83 */ {0x1.40822c367a024p+0 ,+0x1.bddf8b6f4d048p-55,+0x1.28b1c754495cfp-109,+0x1.2c0b383f3ab2fp-163},
+/*  84 */ {0x1.4160a21f72e2ap+0 ,-0x1.ef3691c309278p-58,-0x1.32b43eafc6518p-114,+0x1.58d104f99fbdep-170},
+/*  85 */ {0x1.423fb2709468ap+0 ,-0x1.8462dc0b314ddp-54,-0x1.1cad978fffe80p-108,+0x1.fce4161f057c7p-162},
+/*  86 */ {0x1.431f5d950a897p+0 ,-0x1.1c7dde35f7999p-55,+0x1.903c496195fefp-109,-0x1.3f085f6c04737p-163},
+/*  87 */ {0x1.43ffa3f84b9d4p+0 ,+0x1.880be9704c003p-55,-0x1.94966ca4958dfp-109,+0x1.e765bf74b68fcp-163},
+/*  88 */ {0x1.44e086061892dp+0 ,+0x1.89b7a04ef80d0p-59,-0x1.0ac312de3d922p-114,+0x1.647572d3d3cc9p-170},
+/*  89 */ {0x1.45c2042a7d232p+0 ,-0x1.8641982fb1f8ep-57,-0x1.85a39e45a5ac8p-112,-0x1.b12c9ea7256e0p-166},
+/*  90 */ {0x1.46a41ed1d0057p+0 ,+0x1.c944bd1648a76p-54,+0x1.7df404ff21f3ap-108,-0x1.f2535962c1947p-163},
+/*  91 */ {0x1.4786d668b3237p+0 ,-0x1.c20f0ed445733p-54,-0x1.cb6afa23d3b08p-110,-0x1.3ba4ae0446f00p-166},
+/*  92 */ {0x1.486a2b5c13cd0p+0 ,+0x1.3c1a3b69062f0p-56,+0x1.e1eebae743ac0p-111,-0x1.0fe3226ce36fap-165},
+/*  93 */ {0x1.494e1e192aed2p+0 ,-0x1.3b2895e499ea0p-55,+0x1.f5c05bb2372a6p-109,+0x1.f3946783b045fp-163},
+/*  94 */ {0x1.4a32af0d7d3dep+0 ,+0x1.9cb62f3d1be56p-54,+0x1.91876c761e2c7p-110,+0x1.148bd3ccb9ef9p-164},
+/*  95 */ {0x1.4b17dea6db7d7p+0 ,-0x1.125b87f2897f0p-55,+0x1.824406a11ee2dp-110,-0x1.e0f83e72f83e0p-164},
+/*  96 */ {0x1.4bfdad5362a27p+0 ,+0x1.d4397afec42e2p-56,+0x1.c06c7745c2b39p-113,-0x1.4303e8da76367p-167},
+/*  97 */ {0x1.4ce41b817c114p+0 ,+0x1.05e29690abd5dp-54,-0x1.b977421877867p-109,-0x1.48080c474533ep-166},
+/*  98 */ {0x1.4dcb299fddd0dp+0 ,+0x1.8ecdbbc6a7833p-54,+0x1.212c969559b43p-110,-0x1.5053a96e53d3fp-167},
+/*  99 */ {0x1.4eb2d81d8abffp+0 ,-0x1.5257d2e5d7a52p-54,-0x1.e770e5a11db22p-109,+0x1.fbd18b21cf091p-163},
+/* 100 */ {0x1.4f9b2769d2ca7p+0 ,-0x1.4b309d25957e3p-54,-0x1.1aa1fd7b685cdp-112,-0x1.9633309167b63p-166},
+/* 101 */ {0x1.508417f4531eep+0 ,+0x1.a249b49b7465fp-56,-0x1.f426d5f0a11f8p-111,+0x1.ef78d2f1c2ae1p-167},
+/* 102 */ {0x1.516daa2cf6642p+0 ,-0x1.f768569bd93efp-55,+0x1.90e718226177dp-112,+0x1.d8234800e226fp-166},
+/* 103 */ {0x1.5257de83f4eefp+0 ,-0x1.c998d43efef71p-56,-0x1.0974a1675d1e8p-110,-0x1.f0607db1aeb10p-164},
+/* 104 */ {0x1.5342b569d4f82p+0 ,-0x1.07abe1db13cadp-55,+0x1.fa733951f214cp-111,+0x1.6c125192e4f11p-170},
+/* 105 */ {0x1.542e2f4f6ad27p+0 ,+0x1.7926d192d5f7ep-55,-0x1.126782ea06baap-110,+0x1.e36f571ce3744p-165},
+/* 106 */ {0x1.551a4ca5d920fp+0 ,-0x1.d689cefede59bp-55,+0x1.9c991771b0493p-110,+0x1.6619a8757394dp-164},
+/* 107 */ {0x1.56070dde910d2p+0 ,-0x1.0fb6e168eebf0p-54,+0x1.91129ae575c71p-108,+0x1.95f762c1a6b46p-162},
+/* 108 */ {0x1.56f4736b527dap+0 ,+0x1.9bb2c011d93adp-54,-0x1.ff86852a613ffp-111,-0x1.419c6c698ca83p-167},
+/* 109 */ {0x1.57e27dbe2c4cfp+0 ,-0x1.0b98c8a57b9c4p-54,-0x1.d39891f4faa20p-108,-0x1.51580bc71b6efp-164},
+/* 110 */ {0x1.58d12d497c7fdp+0 ,+0x1.295e15b9a1de8p-55,-0x1.a26d92ad1e4c6p-109,-0x1.ecc87fc6855f7p-163},
+/* 111 */ {0x1.59c0827ff07ccp+0 ,-0x1.7e2cee467e60fp-54,+0x1.d0c772f1bbc25p-109,+0x1.dd2a8c7b82480p-164},
+/* 112 */ {0x1.5ab07dd485429p+0 ,+0x1.6324c054647adp-54,-0x1.744ee506fdafep-109,-0x1.f9604249d341dp-164},
+/* 113 */ {0x1.5ba11fba87a03p+0 ,-0x1.b77a14c233e1ap-54,+0x1.476dfb1884200p-108,-0x1.c588ed5ed6e83p-163},
+/* 114 */ {0x1.5c9268a5946b7p+0 ,+0x1.c4b1b816986a2p-60,+0x1.ec2735254978cp-119,-0x1.8639dddd6547cp-174},
+/* 115 */ {0x1.5d84590998b93p+0 ,-0x1.cd6a7a8b45643p-54,+0x1.26dcfecd1b7fbp-108,-0x1.537002e4c37a7p-165},
+/* 116 */ {0x1.5e76f15ad2148p+0 ,+0x1.ba6f93080e65ep-54,-0x1.95f9ab75fa7d6p-108,-0x1.7ac424d4ae719p-164},
+/* 117 */ {0x1.5f6a320dceb71p+0 ,-0x1.9eadde3cdcf92p-55,+0x1.0e1a6fbc77479p-109,-0x1.f1a17f7641226p-163},
+/* 118 */ {0x1.605e1b976dc09p+0 ,-0x1.3e2429b56de47p-54,-0x1.32c54b92e2588p-110,-0x1.e6118dd8cc352p-166},
+/* 119 */ {0x1.6152ae6cdf6f4p+0 ,+0x1.e4b3e4ab84c27p-54,-0x1.5a3ca64325ac8p-111,+0x1.6aeaa25ba114cp-167},
+/* 120 */ {0x1.6247eb03a5585p+0 ,-0x1.383c17e40b497p-54,+0x1.5d8e757cfb991p-111,+0x1.d6e2bbcbe76c5p-166},
+/* 121 */ {0x1.633dd1d1929fdp+0 ,+0x1.84710beb964e5p-54,+0x1.72e21510bddb6p-108,-0x1.3d3192474956dp-165},
+/* 122 */ {0x1.6434634ccc320p+0 ,-0x1.c483c759d8933p-55,+0x1.3904000c1c40fp-110,-0x1.e7308591f84d3p-164},
+/* 123 */ {0x1.652b9febc8fb7p+0 ,-0x1.ae3d5c9a73e09p-54,+0x1.3fda68a873c1ap-108,+0x1.d58325cf3eaacp-162},
+/* 124 */ {0x1.6623882552225p+0 ,-0x1.bb60987591c34p-54,+0x1.4a337f4dc0a3bp-108,-0x1.0743c0045e1abp-163},
+/* 125 */ {0x1.671c1c70833f6p+0 ,-0x1.e8732586c6134p-55,+0x1.f59e80d44da25p-109,-0x1.4182f1b621010p-163},
+/* 126 */ {0x1.68155d44ca973p+0 ,+0x1.038ae44f73e65p-57,-0x1.f2803633b04ffp-113,+0x1.a85dcc663c880p-168},
+/* 127 */ {0x1.690f4b19e9538p+0 ,+0x1.804bd9aeb445dp-55,-0x1.8f8eac8bcebaap-109,-0x1.f958a6f715c38p-163},
+/* 128 */ {0x1.6a09e667f3bcdp+0 ,-0x1.bdd3413b26456p-54,+0x1.57d3e3adec175p-108,+0x1.2775099da2f59p-164},
+/* 129 */ {0x1.6b052fa75173ep+0 ,+0x1.a38f52c9a9d0ep-56,+0x1.96bba59626d18p-111,-0x1.f4505aecfb340p-166},
+/* 130 */ {0x1.6c012750bdabfp+0 ,-0x1.2895667ff0b0dp-56,+0x1.fef5c58766c19p-111,-0x1.df2150986031fp-165},
+/* 131 */ {0x1.6cfdcddd47645p+0 ,+0x1.c7aa9b6f17309p-54,-0x1.880cb27e97d9ep-111,-0x1.7a07e35404d45p-166},
+/* 132 */ {0x1.6dfb23c651a2fp+0 ,-0x1.bbe3a683c88abp-57,+0x1.a59f88abbe778p-115,-0x1.064f8efbd78c4p-170},
+/* 133 */ {0x1.6ef9298593ae5p+0 ,-0x1.0b9749e1ac8b2p-54,-0x1.a8db3ca2ad190p-110,+0x1.ad77ca32b09bdp-164},
+/* 134 */ {0x1.6ff7df9519484p+0 ,-0x1.83c0f25860ef6p-55,-0x1.001923f4a956ep-110,-0x1.07db5b86422d0p-165},
+/* 135 */ {0x1.70f7466f42e87p+0 ,+0x1.9d644d45aa65fp-58,-0x1.d9ca88f47a2a1p-113,+0x1.a4aed1eb18feep-167},
+/* 136 */ {0x1.71f75e8ec5f74p+0 ,-0x1.16e4786887a99p-55,-0x1.269796953a4c3p-109,+0x1.4415bb4c8b5e2p-165},
+/* 137 */ {0x1.72f8286ead08ap+0 ,-0x1.20aa02cd62c72p-54,-0x1.88dfb7e0baf87p-109,+0x1.97b1039a6c129p-165},
+/* 138 */ {0x1.73f9a48a58174p+0 ,-0x1.0a8d96c65d53cp-54,+0x1.82ae217f3a768p-108,+0x1.759553e8436ddp-164},
+/* 139 */ {0x1.74fbd35d7cbfdp+0 ,+0x1.047fd618a6e1cp-54,+0x1.b42033fadb904p-108,+0x1.b1be014777c22p-162},
+/* 140 */ {0x1.75feb564267c9p+0 ,-0x1.0245957316dd3p-54,-0x1.8f8e7fa19e5e8p-108,-0x1.1aad74949e463p-162},
+/* 141 */ {0x1.77024b1ab6e09p+0 ,+0x1.b7877169147f8p-54,-0x1.eb9c5d1e7b193p-112,-0x1.8463d6f893a19p-166},
+/* 142 */ {0x1.780694fde5d3fp+0 ,+0x1.866b80a02162dp-54,-0x1.44d42307932f7p-108,-0x1.ca04fb3f115cdp-164},
+/* 143 */ {0x1.790b938ac1cf6p+0 ,+0x1.349a862aadd3ep-54,-0x1.0b109d64fbd5fp-110,+0x1.7c251ce77e6f3p-164},
+/* 144 */ {0x1.7a11473eb0187p+0 ,-0x1.41577ee04992fp-55,-0x1.4217a932d10d4p-113,+0x1.4c7a086cd25f0p-170},
+/* 145 */ {0x1.7b17b0976cfdbp+0 ,-0x1.bebb58468dc88p-54,-0x1.303754b0bc06dp-109,+0x1.e6670f6eb538fp-164},
+/* 146 */ {0x1.7c1ed0130c132p+0 ,+0x1.f124cd1164dd6p-54,-0x1.d4d236cc2bb03p-108,-0x1.f5c40acd8f7b6p-162},
+/* 147 */ {0x1.7d26a62ff86f0p+0 ,+0x1.1bddbfb72b8b4p-54,-0x1.9da5eb6946f8cp-108,-0x1.40baa90ea0f80p-162},
+/* 148 */ {0x1.7e2f336cf4e62p+0 ,+0x1.05d02ba15797ep-56,+0x1.70a1427f8fcdfp-112,+0x1.7ce41841f54acp-166},
+/* 149 */ {0x1.7f3878491c491p+0 ,-0x1.07f11cf9311aep-55,+0x1.19f0b3685b7ffp-109,+0x1.65bf7120a57efp-163},
+/* 150 */ {0x1.80427543e1a12p+0 ,-0x1.27c86626d972bp-54,+0x1.d4e0d71c9b16ep-109,+0x1.8a672bf7c4a3fp-164},
+/* 151 */ {0x1.814d2add106d9p+0 ,+0x1.464370d151d4dp-54,+0x1.c694d6561d277p-108,-0x1.f4d51f8eaf0a8p-162},
+/* 152 */ {0x1.82589994cce13p+0 ,-0x1.d4c1dd41532d8p-54,+0x1.0f6ad65cbbac1p-112,-0x1.59a58c8404046p-169},
+/* 153 */ {0x1.8364c1eb941f7p+0 ,+0x1.99b9a31df2bd5p-54,+0x1.e5100ab05208bp-109,-0x1.362088efd3685p-163},
+/* 154 */ {0x1.8471a4623c7adp+0 ,-0x1.8d684a341cdfbp-55,-0x1.591e15c16efd1p-109,+0x1.14dd786648360p-164},
+/* 155 */ {0x1.857f4179f5b21p+0 ,-0x1.ba748f8b216d0p-58,+0x1.a58e6e72eee90p-112,+0x1.9b2eb810adc37p-166},
+/* 156 */ {0x1.868d99b4492edp+0 ,-0x1.fc6f89bd4f6bap-54,-0x1.f16f65181d921p-109,+0x1.abbcb2b5b718dp-163},
+/* 157 */ {0x1.879cad931a436p+0 ,+0x1.5d2d7d2db47bdp-55,-0x1.79679c19ea91fp-110,-0x1.f9878c000234fp-165},
+/* 158 */ {0x1.88ac7d98a6699p+0 ,+0x1.994c2f37cb53ap-54,+0x1.d61283ef385dep-108,+0x1.70ab20f965a78p-164},
+/* 159 */ {0x1.89bd0a478580fp+0 ,+0x1.d53954475202bp-54,-0x1.ffd8e923800f4p-108,+0x1.c66dfbebdfb7bp-167},
+/* 160 */ {0x1.8ace5422aa0dbp+0 ,+0x1.6e9f156864b27p-54,-0x1.30644a7836333p-110,-0x1.f6b9724e25e80p-165},
+/* 161 */ {0x1.8be05bad61778p+0 ,+0x1.ecb5efc43446ep-54,+0x1.e4ef1b4f47e60p-108,+0x1.35f1704d3110dp-162},
+/* 162 */ {0x1.8cf3216b5448cp+0 ,-0x1.0d55e32e9e3aap-56,-0x1.3dab3db839dd6p-111,-0x1.30d5cdae77689p-166},
+/* 163 */ {0x1.8e06a5e0866d9p+0 ,-0x1.7114a6fc9b2e6p-54,+0x1.1d162ae347ca3p-108,+0x1.c5d013e7b74d5p-162},
+/* 164 */ {0x1.8f1ae99157736p+0 ,+0x1.5cc13a2e3976cp-55,+0x1.3bf26d2b85163p-114,-0x1.16b9f662b35bbp-168},
+/* 165 */ {0x1.902fed0282c8ap+0 ,+0x1.592ca85fe3fd2p-54,+0x1.9aaeca60a407ap-108,+0x1.b156ea2a7bdb1p-165},
+/* 166 */ {0x1.9145b0b91ffc6p+0 ,-0x1.dd6792e582524p-54,+0x1.c03855204534ap-109,-0x1.de7b0ac7385c5p-163},
+/* 167 */ {0x1.925c353aa2fe2p+0 ,-0x1.3455fa639db7fp-55,-0x1.a049aab220b43p-109,-0x1.b019dfc343a44p-163},
+/* 168 */ {0x1.93737b0cdc5e5p+0 ,-0x1.75fc781b57ebcp-57,+0x1.697e257ac0db2p-111,-0x1.7cd9101645fb8p-168},
+/* 169 */ {0x1.948b82b5f98e5p+0 ,-0x1.dc3d6797d2d99p-55,-0x1.4a682ed507e0bp-109,-0x1.06d02eb861513p-163},
+/* 170 */ {0x1.95a44cbc8520fp+0 ,-0x1.64b7c96a5f039p-56,-0x1.07053c9a98bbbp-113,+0x1.07559656b567dp-167},
+/* 171 */ {0x1.96bdd9a7670b3p+0 ,-0x1.ba5967f19c896p-58,+0x1.c4833e2a01129p-112,-0x1.c3ff8edb00c83p-166},
+/* 172 */ {0x1.97d829fde4e50p+0 ,-0x1.d185b7c1b85d1p-54,+0x1.7edb9d7144b6fp-108,+0x1.a06021331cd53p-162},
+/* 173 */ {0x1.98f33e47a22a2p+0 ,+0x1.cabdaa24c78edp-56,-0x1.f2ec2c877c312p-110,+0x1.2f105c01ed4abp-164},
+/* 174 */ {0x1.9a0f170ca07bap+0 ,-0x1.173bd91cee632p-54,-0x1.053987854965fp-110,-0x1.a2c3aa8bd94cdp-164},
+/* 175 */ {0x1.9b2bb4d53fe0dp+0 ,-0x1.dd84e4df6d518p-54,+0x1.f67e4fe184b31p-110,-0x1.343aadd54c9a7p-164},
+/* 176 */ {0x1.9c49182a3f090p+0 ,+0x1.c7c46b071f2bep-56,+0x1.6376b7943085cp-110,+0x1.86c90b4577a73p-164},
+/* 177 */ {0x1.9d674194bb8d5p+0 ,-0x1.516bea3dd8233p-54,-0x1.519baeb91c698p-110,+0x1.b1b50040aa081p-166},
+/* 178 */ {0x1.9e86319e32323p+0 ,+0x1.824ca78e64c6ep-56,+0x1.0f92c082bbae0p-116,-0x1.427e8c0b1d160p-170},
+/* 179 */ {0x1.9fa5e8d07f29ep+0 ,-0x1.4a9ceaaf1facep-55,+0x1.4f0e6fc88785dp-109,-0x1.1f85741a7ae1fp-163},
+/* 180 */ {0x1.a0c667b5de565p+0 ,-0x1.359495d1cd533p-54,+0x1.354084551b4fbp-109,-0x1.d768929d5ccd9p-163},
+/* 181 */ {0x1.a1e7aed8eb8bbp+0 ,+0x1.c6618ee8be70ep-54,+0x1.b7f2fb72d78c0p-108,+0x1.58c32df177667p-162},
+/* 182 */ {0x1.a309bec4a2d33p+0 ,+0x1.6305c7ddc36abp-54,+0x1.547fa22c26d17p-108,-0x1.c562749eae011p-162},
+/* 183 */ {0x1.a42c980460ad8p+0 ,-0x1.aa780589fb120p-54,-0x1.d6e9e41d89183p-108,-0x1.c4c783ea0516ap-163},
+/* 184 */ {0x1.a5503b23e255dp+0 ,-0x1.d2f6edb8d41e1p-54,-0x1.bfd7adfd63f48p-111,+0x1.f7be57fa76630p-167},
+/* 185 */ {0x1.a674a8af46052p+0 ,+0x1.50f5630670366p-57,+0x1.b8696ee520475p-112,+0x1.400185eb6ff28p-169},
+/* 186 */ {0x1.a799e1330b358p+0 ,+0x1.bcb7ecac563c7p-54,-0x1.678693176f751p-108,-0x1.eb7724d5b0b12p-162},
+/* 187 */ {0x1.a8bfe53c12e59p+0 ,-0x1.4f867b2ba15a9p-54,+0x1.01f0d566ba176p-108,-0x1.e62e908c15405p-166},
+/* 188 */ {0x1.a9e6b5579fdbfp+0 ,+0x1.0fac90ef7fd31p-54,+0x1.8b16ae39e8cb9p-109,+0x1.783da5cfa6280p-163},
+/* 189 */ {0x1.ab0e521356ebap+0 ,+0x1.89c31dae94545p-55,-0x1.af43b90f0d971p-110,-0x1.92d5ab9aa462fp-164},
+/* 190 */ {0x1.ac36bbfd3f37ap+0 ,-0x1.f9234cae76cd0p-55,-0x1.c60dbfc7696f8p-111,-0x1.e9a15c61562f2p-166},
+/* 191 */ {0x1.ad5ff3a3c2774p+0 ,+0x1.7ef3bb6b1b8e5p-54,-0x1.31a55d12f2b84p-108,-0x1.64e3dca70b487p-162},
+/* 192 */ {0x1.ae89f995ad3adp+0 ,+0x1.7a1cd345dcc81p-54,+0x1.a7fbc3ae675eap-108,+0x1.102c58b5ae09dp-162},
+/* 193 */ {0x1.afb4ce622f2ffp+0 ,-0x1.4b2fc0f315ecdp-54,+0x1.252d2a6932f30p-108,-0x1.3c8459be5a677p-162},
+/* 194 */ {0x1.b0e07298db666p+0 ,-0x1.bdef54c80e425p-54,+0x1.41cbb95c55600p-109,-0x1.617eaacd29acbp-166},
+/* 195 */ {0x1.b20ce6c9a8952p+0 ,+0x1.4dd024a0756ccp-54,-0x1.883daf6928c9ep-108,+0x1.33c9d6a4a404fp-164},
+/* 196 */ {0x1.b33a2b84f15fbp+0 ,-0x1.2805e3084d708p-57,+0x1.2babc0edda4d9p-111,-0x1.b906f0923cc11p-165},
+/* 197 */ {0x1.b468415b749b1p+0 ,-0x1.f763de9df7c90p-56,-0x1.3e5401cf3f56fp-111,+0x1.bc07648129408p-167},
+/* 198 */ {0x1.b59728de5593ap+0 ,-0x1.c71dfbbba6de3p-54,-0x1.c7470081df7dfp-111,-0x1.283eb35b5ded5p-165},
+/* 199 */ {0x1.b6c6e29f1c52ap+0 ,+0x1.2a8f352883f6ep-54,+0x1.7a1ee98a99862p-109,+0x1.cb34828fa2795p-163},
+/* 200 */ {0x1.b7f76f2fb5e47p+0 ,-0x1.5584f7e54ac3bp-56,+0x1.aa64481e1ab72p-111,+0x1.6c4b55984ec34p-165},
+/* 201 */ {0x1.b928cf22749e4p+0 ,-0x1.b721654cb65c6p-54,+0x1.5111ed9312467p-109,-0x1.a45da6f4707a7p-165},
+/* 202 */ {0x1.ba5b030a1064ap+0 ,-0x1.efcd30e54292ep-54,-0x1.ad1bf91503c67p-113,-0x1.15237453168c4p-168},
+/* 203 */ {0x1.bb8e0b79a6f1fp+0 ,-0x1.f52d1c9696205p-60,-0x1.1b499b8052088p-115,+0x1.2b063be33485cp-172},
+/* 204 */ {0x1.bcc1e904bc1d2p+0 ,+0x1.23dd07a2d9e84p-55,+0x1.9a164050e1258p-109,-0x1.5320da933db6fp-163},
+/* 205 */ {0x1.bdf69c3f3a207p+0 ,-0x1.c262360ea5b52p-60,-0x1.b2ab8c26584ffp-114,-0x1.238a7d576f506p-171},
+/* 206 */ {0x1.bf2c25bd71e09p+0 ,-0x1.efdca3f6b9c73p-54,+0x1.27e81cecd59dap-110,-0x1.204a9700c202bp-164},
+/* 207 */ {0x1.c06286141b33dp+0 ,-0x1.d8a5aa1fbca34p-55,-0x1.6fd5d0fdf4695p-110,-0x1.7c3998480a35ep-164},
+/* 208 */ {0x1.c199bdd85529cp+0 ,+0x1.11065895048ddp-55,+0x1.99e51125928dap-110,-0x1.9edbffbc68cc6p-164},
+/* 209 */ {0x1.c2d1cd9fa652cp+0 ,-0x1.6e51617c8a5d7p-54,-0x1.5af0e37eae5dep-110,+0x1.6b31fb0554a09p-164},
+/* 210 */ {0x1.c40ab5fffd07ap+0 ,+0x1.b4537e083c60ap-54,+0x1.4a6cdfa70f4f8p-109,-0x1.155990467ec03p-163},
+/* 211 */ {0x1.c544778fafb22p+0 ,+0x1.12f072493b5afp-54,+0x1.7634e44f583acp-109,-0x1.020c47027b954p-163},
+/* 212 */ {0x1.c67f12e57d14bp+0 ,+0x1.2884dff483cadp-54,-0x1.fc44c329d5cb2p-109,-0x1.7031515057034p-163},
+/* 213 */ {0x1.c7ba88988c933p+0 ,-0x1.e76bbbe255559p-55,-0x1.239845875b500p-110,+0x1.300490cdcb024p-165},
+/* 214 */ {0x1.c8f6d9406e7b5p+0 ,+0x1.1acbc48805c44p-56,+0x1.6edaac100b8fap-111,-0x1.cc4c35f12ae27p-165},
+/* 215 */ {0x1.ca3405751c4dbp+0 ,-0x1.7f2bed10d08f5p-55,+0x1.45233cc94585ap-114,+0x1.4d078a09334b3p-168},
+/* 216 */ {0x1.cb720dcef9069p+0 ,+0x1.503cbd1e949dbp-56,+0x1.d8765566b032ep-110,-0x1.22c12a6620655p-164},
+/* 217 */ {0x1.ccb0f2e6d1675p+0 ,-0x1.d220f86009093p-56,+0x1.e0424e773b3b3p-110,+0x1.bebc9ee6641c1p-166},
+/* 218 */ {0x1.cdf0b555dc3fap+0 ,-0x1.dd83b53829d72p-55,-0x1.aea073a742049p-112,-0x1.517eb8b8f55bdp-169},
+/* 219 */ {0x1.cf3155b5bab74p+0 ,-0x1.a08e9b86dff57p-54,-0x1.743fe56ba6df7p-110,+0x1.28d9af9d1c0d8p-164},
+/* 220 */ {0x1.d072d4a07897cp+0 ,-0x1.cbc3743797a9cp-54,-0x1.e7044039da0f6p-108,-0x1.666b7ef178e6ep-165},
+/* 221 */ {0x1.d1b532b08c968p+0 ,+0x1.55636219a36eep-54,-0x1.96ce6c611cd73p-108,+0x1.ad51c7f8df4f4p-164},
+/* 222 */ {0x1.d2f87080d89f2p+0 ,-0x1.d487b719d8578p-54,+0x1.2da62b2a9fae7p-111,-0x1.1b36db8d71617p-168},
+/* 223 */ {0x1.d43c8eacaa1d6p+0 ,+0x1.3db53bf5a1614p-54,+0x1.420bd107a56f7p-108,-0x1.4aade9bc911bdp-162},
+/* 224 */ {0x1.d5818dcfba487p+0 ,+0x1.2ed02d75b3707p-55,-0x1.ab053b05531fcp-111,+0x1.dbfc8e0bec68fp-166},
+/* 225 */ {0x1.d6c76e862e6d3p+0 ,+0x1.fe87a4a8165a0p-58,+0x1.b1701f59c75ffp-114,+0x1.9b333105bbac0p-168},
+/* 226 */ {0x1.d80e316c98398p+0 ,-0x1.11ec18beddfe8p-54,-0x1.ed04e7ac8765ap-110,+0x1.00ddf98d2838dp-164},
+/* 227 */ {0x1.d955d71ff6075p+0 ,+0x1.a052dbb9af6bep-54,+0x1.30dc526492014p-108,-0x1.aea6e3e4fdcdep-163},
+/* 228 */ {0x1.da9e603db3285p+0 ,+0x1.c2300696db532p-54,+0x1.7f6246f0ec615p-108,-0x1.36a366c6e306dp-164},
+/* 229 */ {0x1.dbe7cd63a8315p+0 ,-0x1.b76f1926b8be4p-54,-0x1.0838f11e6612dp-108,-0x1.7b73e54ed3c91p-164},
+/* 230 */ {0x1.dd321f301b460p+0 ,+0x1.2da5778f018c3p-54,-0x1.c6cdead661cf3p-108,+0x1.3edcd40f0d22fp-162},
+/* 231 */ {0x1.de7d5641c0658p+0 ,-0x1.ca5528e79ba8fp-54,+0x1.4f9fd822b5ee1p-109,-0x1.3465433467effp-163},
+/* 232 */ {0x1.dfc97337b9b5fp+0 ,-0x1.1a5cd4f184b5cp-54,+0x1.b7225a944efd6p-108,-0x1.12ab6d1b636bcp-162},
+/* 233 */ {0x1.e11676b197d17p+0 ,-0x1.2b529bd5c7f44p-56,+0x1.386309ca5072ap-110,+0x1.d8ea423a92622p-165},
+/* 234 */ {0x1.e264614f5a129p+0 ,-0x1.7b627817a1496p-54,-0x1.b9818808c409ap-108,-0x1.fb36a1d6378aep-164},
+/* 235 */ {0x1.e3b333b16ee12p+0 ,-0x1.9f4a431fdc68bp-54,+0x1.8b86d919ec784p-108,-0x1.3873cc87b7277p-162},
+/* 236 */ {0x1.e502ee78b3ff6p+0 ,+0x1.39e8980a9cc8fp-55,+0x1.1e92cb3c2d278p-109,-0x1.e851e2d07789ep-164},
+/* 237 */ {0x1.e653924676d76p+0 ,-0x1.63ff87522b735p-55,+0x1.1bdfc8db5a718p-110,+0x1.c4f0bad6a032cp-167},
+/* 238 */ {0x1.e7a51fbc74c83p+0 ,+0x1.2d522ca0c8de2p-54,-0x1.8a757b0b6a9cbp-108,+0x1.18d2905b36468p-162},
+/* 239 */ {0x1.e8f7977cdb740p+0 ,-0x1.1089480b054b1p-54,+0x1.306ae5803b7cbp-109,-0x1.e7d11105a6fb7p-165},
+/* 240 */ {0x1.ea4afa2a490dap+0 ,-0x1.e9c23179c2893p-54,-0x1.fc0f242bbf3dep-109,-0x1.888f60a4227fdp-163},
+/* 241 */ {0x1.eb9f4867cca6ep+0 ,+0x1.4832f2293e4f2p-54,-0x1.90fc40251cbe8p-108,-0x1.b9f28f5817318p-162},
+/* 242 */ {0x1.ecf482d8e67f1p+0 ,-0x1.c93f3b411ad8cp-54,-0x1.0b9dfef44b43bp-108,-0x1.8c6ab7f905f8cp-163},
+/* 243 */ {0x1.ee4aaa2188510p+0 ,+0x1.1c68da487568dp-54,+0x1.31c8db5077e24p-110,+0x1.eb41aef0c793bp-165},
+/* 244 */ {0x1.efa1bee615a27p+0 ,+0x1.dc7f486a4b6b0p-54,+0x1.f6dd5d229ff69p-108,-0x1.b90d81c2130d1p-164},
+/* 245 */ {0x1.f0f9c1cb6412ap+0 ,-0x1.3220065181d45p-54,-0x1.3f8114293b05bp-108,+0x1.51505b40c3684p-162},
+/* 246 */ {0x1.f252b376bba97p+0 ,+0x1.3a1a5bf0d8e43p-54,+0x1.4c6ad5476b516p-108,+0x1.7a070ecd44112p-163},
+/* 247 */ {0x1.f3ac948dd7274p+0 ,-0x1.95a5a3ed837dep-56,+0x1.40a183fe4cc10p-112,-0x1.ea0f600d391cbp-166},
+/* 248 */ {0x1.f50765b6e4540p+0 ,+0x1.9d3e12dd8a18bp-54,-0x1.4019bffc80ef3p-110,+0x1.2ba29b8908965p-164},
+/* 249 */ {0x1.f6632798844f8p+0 ,+0x1.fa37b3539343ep-54,+0x1.726a45a4c9e13p-109,+0x1.7f36d3fd3abb5p-163},
+/* 250 */ {0x1.f7bfdad9cbe14p+0 ,-0x1.dbb12d006350ap-54,+0x1.5c5ce7280fa4dp-108,+0x1.1a251fab0b01ep-163},
+/* 251 */ {0x1.f91d802243c89p+0 ,-0x1.12ea8a779f689p-57,-0x1.89324bfc3ef57p-111,+0x1.21aa387264c9cp-165},
+/* 252 */ {0x1.fa7c1819e90d8p+0 ,+0x1.74853f3a5931ep-55,+0x1.dc060c36f7651p-112,-0x1.2cfc37316ebd2p-166},
+/* 253 */ {0x1.fbdba3692d514p+0 ,-0x1.9677315098eb6p-56,+0x1.b0cd4d28a9a32p-110,+0x1.1aa8ba7a70892p-164},
+/* 254 */ {0x1.fd3c22b8f71f1p+0 ,+0x1.2eb74966579e7p-57,+0x1.2f096934ec56cp-111,-0x1.f2dabbc58add1p-167},
+/* 255 */ {0x1.fe9d96b2a23d9p+0 ,+0x1.4a6037442fde3p-56,+0x1.baf85e8130af3p-112,-0x1.495c50127475cp-166}
+};
+static constexpr int exp2_table_bits = 8;
+static constexpr int exp2_table_size = 1 << exp2_table_bits;
+
+/**
+ * @brief ln(2) / 256 split into five parts. The first part has 34 bits, so
+ * k * exp2_ln2_split[0] is exact for |k| < 2^19.
+ */
+static constexpr fp64 exp2_ln2_split[5] = {
+	+0x1.62e42fef80000p-9, +0x1.1cf79abc9e3b4p-44, -0x1.9ff0342542fc3p-98,
+	-0x1.79b31ace93a4fp-153, +0x1.068badc5d57d1p-207
+};
+
+/**
+ * @brief Table for log. log_table_invc[i - 90] is 128 / i rounded to fp64,
+ * for 128 / i in [sqrt(0.5), sqrt(2)].
+ */
+static constexpr fp64 log_table_invc[] = {
+/*  90 */ 0x1.6c16c16c16c17p+0,
+/*  91 */ 0x1.6816816816817p+0,
+/*  92 */ 0x1.642c8590b2164p+0,
+/*  93 */ 0x1.6058160581606p+0,
+/*  94 */ 0x1.5c9882b931057p+0,
+/*  95 */ 0x1.58ed2308158edp+0,
+/*  96 */ 0x1.5555555555555p+0,
+/*  97 */ 0x1.51d07eae2f815p+0,
+/*  98 */ 0x1.4e5e0a72f0539p+0,
+/*  99 */ 0x1.4afd6a052bf5bp+0,
+/* 100 */ 0x1.47ae147ae147bp+0,
+/* 101 */ 0x1.446f86562d9fbp+0,
+/* 102 */ 0x1.4141414141414p+0,
+/* 103 */ 0x1.3e22cbce4a902p+0,
+/* 104 */ 0x1.3b13b13b13b14p+0,
+/* 105 */ 0x1.3813813813814p+0,
+/* 106 */ 0x1.3521cfb2b78c1p+0,
+/* 107 */ 0x1.323e34a2b10bfp+0,
+/* 108 */ 0x1.2f684bda12f68p+0,
+/* 109 */ 0x1.2c9fb4d812ca0p+0,
+/* 110 */ 0x1.29e4129e4129ep+0,
+/* 111 */ 0x1.27350b8812735p+0,
+/* 112 */ 0x1.2492492492492p+0,
+/* 113 */ 0x1.21fb78121fb78p+0,
+/* 114 */ 0x1.1f7047dc11f70p+0,
+/* 115 */ 0x1.1cf06ada2811dp+0,
+/* 116 */ 0x1.1a7b9611a7b96p+0,
+/* 117 */ 0x1.1811811811812p+0,
+/* 118 */ 0x1.15b1e5f75270dp+0,
+/* 119 */ 0x1.135c81135c811p+0,
+/* 120 */ 0x1.1111111111111p+0,
+/* 121 */ 0x1.0ecf56be69c90p+0,
+/* 122 */ 0x1.0c9714fbcda3bp+0,
+/* 123 */ 0x1.0a6810a6810a7p+0,
+/* 124 */ 0x1.0842108421084p+0,
+/* 125 */ 0x1.0624dd2f1a9fcp+0,
+/* 126 */ 0x1.0410410410410p+0,
+/* 127 */ 0x1.0204081020408p+0,
+/* 128 */ 0x1.0000000000000p+0,
+/* 129 */ 0x1.fc07f01fc07f0p-1,
+/* 130 */ 0x1.f81f81f81f820p-1,
+/* 131 */ 0x1.f44659e4a4271p-1,
+/* 132 */ 0x1.f07c1f07c1f08p-1,
+/* 133 */ 0x1.ecc07b301ecc0p-1,
+/* 134 */ 0x1.e9131abf0b767p-1,
+/* 135 */ 0x1.e573ac901e574p-1,
+/* 136 */ 0x1.e1e1e1e1e1e1ep-1,
+/* 137 */ 0x1.de5d6e3f8868ap-1,
+/* 138 */ 0x1.dae6076b981dbp-1,
+/* 139 */ 0x1.d77b654b82c34p-1,
+/* 140 */ 0x1.d41d41d41d41dp-1,
+/* 141 */ 0x1.d0cb58f6ec074p-1,
+/* 142 */ 0x1.cd85689039b0bp-1,
+/* 143 */ 0x1.ca4b3055ee191p-1,
+/* 144 */ 0x1.c71c71c71c71cp-1,
+/* 145 */ 0x1.c3f8f01c3f8f0p-1,
+/* 146 */ 0x1.c0e070381c0e0p-1,
+/* 147 */ 0x1.bdd2b899406f7p-1,
+/* 148 */ 0x1.bacf914c1bad0p-1,
+/* 149 */ 0x1.b7d6c3dda338bp-1,
+/* 150 */ 0x1.b4e81b4e81b4fp-1,
+/* 151 */ 0x1.b2036406c80d9p-1,
+/* 152 */ 0x1.af286bca1af28p-1,
+/* 153 */ 0x1.ac5701ac5701bp-1,
+/* 154 */ 0x1.a98ef606a63bep-1,
+/* 155 */ 0x1.a6d01a6d01a6dp-1,
+/* 156 */ 0x1.a41a41a41a41ap-1,
+/* 157 */ 0x1.a16d3f97a4b02p-1,
+/* 158 */ 0x1.9ec8e951033d9p-1,
+/* 159 */ 0x1.9c2d14ee4a102p-1,
+/* 160 */ 0x1.999999999999ap-1,
+/* 161 */ 0x1.970e4f80cb872p-1,
+/* 162 */ 0x1.948b0fcd6e9e0p-1,
+/* 163 */ 0x1.920fb49d0e229p-1,
+/* 164 */ 0x1.8f9c18f9c18fap-1,
+/* 165 */ 0x1.8d3018d3018d3p-1,
+/* 166 */ 0x1.8acb90f6bf3aap-1,
+/* 167 */ 0x1.886e5f0abb04ap-1,
+/* 168 */ 0x1.8618618618618p-1,
+/* 169 */ 0x1.83c977ab2beddp-1,
+/* 170 */ 0x1.8181818181818p-1,
+/* 171 */ 0x1.7f405fd017f40p-1,
+/* 172 */ 0x1.7d05f417d05f4p-1,
+/* 173 */ 0x1.7ad2208e0ecc3p-1,
+/* 174 */ 0x1.78a4c8178a4c8p-1,
+/* 175 */ 0x1.767dce434a9b1p-1,
+/* 176 */ 0x1.745d1745d1746p-1,
+/* 177 */ 0x1.724287f46debcp-1,
+/* 178 */ 0x1.702e05c0b8170p-1,
+/* 179 */ 0x1.6e1f76b4337c7p-1,
+/* 180 */ 0x1.6c16c16c16c17p-1,
+/* 181 */ 0x1.6a13cd1537290p-1
+};
+
+/**
+ * @brief log_table_log[i] = -log(log_table_invc[i])
+ */
+static constexpr Float64x4 log_table_log[] = {
+/*  90 */ {-0x1.68ac83e9c6a15p-2,+0x1.acd8a9145ff44p-57,+0x1.15a21fe0b1c6ep-111,-0x1.fc54b9dcd7bedp-165},
+/*  91 */ {-0x1.5d5bddf595f31p-2,-0x1.d5f75b9a23ae4p-59,-0x1.9702a60c4de63p-113,-0x1.4b44263dc8c13p-170},
+/*  92 */ {-0x1.522ae0738a3d7p-2,-0x1.3840b263acb43p-56,-0x1.888231891aabep-111,-0x1.4ad678e459fe9p-165},
+/*  93 */ {-0x1.4718dc271c41cp-2,-0x1.d8fb4c14c56eep-56,+0x1.c866cbcc88d07p-112,-0x1.87461233d8a54p-167},
+/*  94 */ {-0x1.3c25277333183p-2,-0x1.152d81af5713ap-56,+0x1.1154214fcfa36p-110,+0x1.44642471b67b2p-164},
+/*  95 */ {-0x1.314f1e1d35ce3p-2,-0x1.22966f61a3c23p-56,-0x1.ba87290c39572p-110,+0x1.e771c60523bc6p-164},
+/*  96 */ {-0x1.269621134db91p-2,-0x1.e0efadd9db02ap-56,-0x1.385461e921b99p-111,+0x1.008edd4fda62cp-165},
+/*  97 */ {-0x1.1bf99635a6b95p-2,+0x1.e9575c2124912p-56,-0x1.2233884a95400p-110,+0x1.3459046fa8b92p-166},
+/*  98 */ {-0x1.1178e8227e47ap-2,-0x1.b8ce2d07f1cb7p-56,+0x1.a01c44ae02789p-110,-0x1.2fd1a7134d94bp-164},
+/*  99 */ {-0x1.07138604d5864p-2,+0x1.24e912b16ec8bp-60,-0x1.df429aec44d38p-117,+0x1.4a378bc7f18f1p-173},
+/* 100 */ {-0x1.f991c6cb3b37ap-3,-0x1.ecca0cdf30143p-58,+0x1.64f89bb123836p-113,-0x1.74cb2aa0aabdcp-170},
+/* 101 */ {-0x1.e530effe71013p-3,+0x1.f7627ef82f3f0p-57,-0x1.61924609a69b5p-111,+0x1.04e8c9b7707b3p-166},
+/* 102 */ {-0x1.d1037f2655e7bp-3,+0x1.3f3adb7b71cbcp-58,-0x1.e03fc22bd8feep-114,+0x1.733901e0b0692p-169},
+/* 103 */ {-0x1.bd087383bd8aap-3,+0x1.1165504ad749ep-59,+0x1.1555826b9dff3p-114,+0x1.93e090e93e061p-169},
+/* 104 */ {-0x1.a93ed3c8ad9e5p-3,-0x1.bcafa9de97202p-57,-0x1.ccdcee3115f1fp-111,-0x1.24d87a1ea0b16p-165},
+/* 105 */ {-0x1.95a5adcf70182p-3,-0x1.8a16283fdbd1cp-57,+0x1.e04b19df57e30p-113,-0x1.6ea7c7fff6c06p-170},
+/* 106 */ {-0x1.823c16551a3c0p-3,-0x1.6dcd318f4187ep-57,-0x1.f481eacf6db47p-113,+0x1.41ad1bc2f3253p-168},
+/* 107 */ {-0x1.6f0128b756ab9p-3,+0x1.37967087859b9p-59,-0x1.a3ef3637e22a4p-113,+0x1.1cf525d09f543p-167},
+/* 108 */ {-0x1.5bf406b543db0p-3,+0x1.1f5b44c0df7f7p-61,+0x1.25a7abe3c6680p-115,-0x1.23ef6909149d6p-174},
+/* 109 */ {-0x1.4913d8333b563p-3,+0x1.0d5604930f137p-58,-0x1.046ddd0c49961p-112,+0x1.97356d70a9300p-166},
+/* 110 */ {-0x1.365fcb0159014p-3,-0x1.bea08d2dca256p-57,+0x1.bf1efc9fe606ep-111,-0x1.d704252e20a0dp-166},
+/* 111 */ {-0x1.23d712a49c201p-3,-0x1.51c7e9efae297p-57,+0x1.49309bfb61ce3p-111,-0x1.e241ad09651f1p-165},
+/* 112 */ {-0x1.1178e8227e47ap-3,+0x1.0e63a5f01c693p-58,-0x1.03c776a3fb0efp-112,-0x1.ec469c4d3652ep-167},
+/* 113 */ {-0x1.fe89139dbd565p-4,+0x1.ac9f4215f9394p-58,-0x1.d23d841377071p-112,-0x1.cdbd1df6862e3p-166},
+/* 114 */ {-0x1.da7276384469ep-4,-0x1.401fa71733017p-58,+0x1.0554118a2fe2ep-112,+0x1.7e17470fe0052p-166},
+/* 115 */ {-0x1.b6ac88dad5b1dp-4,+0x1.002bf768e52d0p-58,-0x1.6a6e9bac4ae3cp-112,+0x1.1cce253e32fa9p-166},
+/* 116 */ {-0x1.9335e5d594988p-4,+0x1.478a85704ccb7p-58,-0x1.112e6b065fe5ep-113,-0x1.29a646f475b97p-168},
+/* 117 */ {-0x1.700d30aeac0e8p-4,-0x1.a36a677b4c8b2p-59,+0x1.8747b9d920b79p-113,-0x1.708fe736a9231p-167},
+/* 118 */ {-0x1.4d3115d207eacp-4,-0x1.da7d0b1e10b2fp-60,-0x1.7d34a76de4fddp-114,+0x1.a9d1880d2fe64p-168},
+/* 119 */ {-0x1.2aa04a44717a1p-4,-0x1.aea2c72d05c08p-58,+0x1.56d15ca352247p-112,+0x1.acdb6ccb1b73ap-166},
+/* 120 */ {-0x1.08598b59e3a06p-4,+0x1.dd7009902bf32p-58,+0x1.53ed0393a700ep-112,+0x1.2c8e26fbf1126p-166},
+/* 121 */ {-0x1.ccb73cdddb2d0p-5,+0x1.e48fb0500efd5p-59,-0x1.ac00b6b1f34ccp-113,+0x1.4511a13725a8bp-168},
+/* 122 */ {-0x1.894aa149fb34bp-5,+0x1.2ba0b44cfaee5p-59,+0x1.0afcb9f93ac8bp-114,-0x1.c99dd25c36e18p-169},
+/* 123 */ {-0x1.466aed42de3f9p-5,+0x1.9badefe942718p-60,+0x1.ab4be430070f9p-115,-0x1.d50f34d59ae4bp-169},
+/* 124 */ {-0x1.0415d89e74440p-5,-0x1.c05cf1d753621p-59,-0x1.3bc1c184cef09p-114,+0x1.2e9e6f1099262p-170},
+/* 125 */ {-0x1.8492528c8cac5p-6,+0x1.d192d0619fa68p-60,-0x1.1dbd58307947dp-117,-0x1.7b88c9b9cbdbdp-171},
+/* 126 */ {-0x1.0205658935837p-6,-0x1.27c8e8416e717p-60,+0x1.19642aac13124p-116,+0x1.e6c1f429bf202p-172},
+/* 127 */ {-0x1.010157588de69p-7,-0x1.46662d417cecep-62,-0x1.e91702f8418aap-120,-0x1.9b9c9c9e82075p-177},
+/* 128 */ {0x0.0000000000000p+0 ,+0x0.0000000000000p+0 ,+0x0.0000000000000p+0 ,+0x0.0000000000000p+0 },
+/* 129 */ {0x1.fe02a6b106799p-8 ,-0x1.e44b7e3711e7fp-67,+0x1.a567b6587df3fp-121,-0x1.1b811a1d41910p-175},
+/* 130 */ {0x1.fc0a8b0fc03c4p-7 ,-0x1.83092c5964281p-62,-0x1.52414fc416fd7p-116,-0x1.e4087e10515c4p-170},
+/* 131 */ {0x1.7b91b07d5b126p-6 ,-0x1.6d80ab38e9430p-62,-0x1.032b0efd5adc5p-118,-0x1.e5bb2d22092fap-173},
+/* 132 */ {0x1.f829b0e7832f8p-6 ,+0x1.33e3f04f1ef25p-60,-0x1.814544147acc9p-114,-0x1.6e9fb1967c6a3p-169},
+/* 133 */ {0x1.39e87b9febd68p-5 ,-0x1.5bfa937f551b7p-59,+0x1.c8d57ae1e11c3p-114,-0x1.e4a706d9bfa6fp-168},
+/* 134 */ {0x1.77458f632dcffp-5 ,+0x1.8d3ca87b92968p-63,+0x1.07937ee036553p-117,-0x1.277e8b50d72f9p-174},
+/* 135 */ {0x1.b42dd711971b9p-5 ,+0x1.0a34531f67db5p-59,+0x1.629579c4c681fp-113,-0x1.4d670619998f6p-167},
+/* 136 */ {0x1.f0a30c01162a8p-5 ,+0x1.85f325c5bbacdp-59,-0x1.d9cb2e2cb3228p-118,+0x1.4f5d78db4e8c0p-173},
+/* 137 */ {0x1.16536eea37ae3p-4 ,+0x1.2189705cf74cap-58,+0x1.6cdb48520b4cep-113,-0x1.9735540eb744ep-167},
+/* 138 */ {0x1.341d7961bd1d0p-4 ,-0x1.3599f227becbbp-58,-0x1.47ef2f89ad244p-115,+0x1.a9d4c76cb1bacp-173},
+/* 139 */ {0x1.51b073f06183cp-4 ,-0x1.5b61c65e5741ap-58,+0x1.812f271f826edp-114,-0x1.b2f2146969ee7p-168},
+/* 140 */ {0x1.6f0d28ae56b4ep-4 ,-0x1.20db323097324p-59,+0x1.919ca183deca2p-113,-0x1.da106e3f6863bp-167},
+/* 141 */ {0x1.8c345d6319b23p-4 ,-0x1.294d2f5668495p-58,+0x1.96ae04c07c81bp-113,+0x1.8e1a09cef2892p-168},
+/* 142 */ {0x1.a926d3a4ad562p-4 ,-0x1.d7a16eab1e2adp-59,+0x1.99a9f67e22ed2p-116,+0x1.552b9a0033a7ep-171},
+/* 143 */ {0x1.c5e548f5bc743p-4 ,+0x1.2eb0bf7c0b0d9p-59,-0x1.11c4d32a0e479p-113,-0x1.1a5fd328d8568p-169},
+/* 144 */ {0x1.e27076e2af2eap-4 ,-0x1.61578001e015ap-60,+0x1.55db94ebc402dp-116,+0x1.313ab4c977b56p-170},
+/* 145 */ {0x1.fec9131dbeabcp-4 ,-0x1.5746b9981b36cp-58,-0x1.44016e1d457eep-112,+0x1.0836d4f8f6f51p-169},
+/* 146 */ {0x1.0d77e7cd08e5bp-3 ,+0x1.9a5dc5e9030adp-57,-0x1.71dbd9a581397p-111,-0x1.c926ec8a78e50p-166},
+/* 147 */ {0x1.1b72ad52f67a2p-3 ,-0x1.fbe7ee5c69946p-57,+0x1.0d7bc7ec84caap-111,-0x1.a6e200f5a8f27p-166},
+/* 148 */ {0x1.29552f81ff521p-3 ,+0x1.301771c407dc0p-57,-0x1.977b021b7c785p-111,+0x1.1a94cafc15d3ap-165},
+/* 149 */ {0x1.371fc201e8f75p-3 ,+0x1.e6cb62af18a02p-62,-0x1.8fe0cd92558acp-116,-0x1.524059b2e2ad6p-171},
+/* 150 */ {0x1.44d2b6ccb7d1cp-3 ,+0x1.7d3d950f87e23p-59,+0x1.950595f322e9bp-113,-0x1.77c2d94fa5411p-167},
+/* 151 */ {0x1.526e5e3a1b438p-3 ,-0x1.546ff8a470d3ap-57,+0x1.a71bcc63b5444p-111,+0x1.550f0da0d49a4p-165},
+/* 152 */ {0x1.5ff3070a793d6p-3 ,-0x1.bc60efafc6f6cp-58,-0x1.140655471953ep-113,+0x1.a49dc38b012a3p-167},
+/* 153 */ {0x1.6d60fe719d21bp-3 ,+0x1.d551d97132e87p-57,+0x1.f2768c9609739p-112,-0x1.7446ef17073cfp-166},
+/* 154 */ {0x1.7ab890210d907p-3 ,-0x1.1072534a57e7dp-57,+0x1.aa47fe1494d87p-111,-0x1.a2fea68f289adp-168},
+/* 155 */ {0x1.87fa06520c911p-3 ,-0x1.9f7fdbfa08d9ap-57,-0x1.09daa8fb49481p-112,-0x1.2c4f02080f75fp-166},
+/* 156 */ {0x1.9525a9cf456b6p-3 ,-0x1.26fb3e2b1d1dap-57,+0x1.899417da79eedp-117,+0x1.5df4e3497fb7fp-171},
+/* 157 */ {0x1.a23bc1fe2b561p-3 ,+0x1.24dc46c1ea664p-57,-0x1.1e381c9324e9bp-112,+0x1.76fb8ad127556p-166},
+/* 158 */ {0x1.af3c94e80bff3p-3 ,+0x1.a3398064df33ep-57,-0x1.e34c4b23a32d1p-111,-0x1.4f3bd6b13ba2ap-165},
+/* 159 */ {0x1.bc286742d8cd4p-3 ,+0x1.cfce744870f57p-58,-0x1.7474f08d6e4e1p-113,-0x1.e5283b6f6bac3p-167},
+/* 160 */ {0x1.c8ff7c79a9a20p-3 ,-0x1.4f689f8434011p-57,+0x1.a24ae3b2f53a0p-111,-0x1.d3c9d1f232109p-167},
+/* 161 */ {0x1.d5c216b4fbb94p-3 ,-0x1.a37794d03657dp-58,+0x1.87c6ce7a257f8p-113,+0x1.83fa96e6683ecp-167},
+/* 162 */ {0x1.e27076e2af2e8p-3 ,-0x1.61578001e015ep-59,+0x1.55db94ebc4023p-115,-0x1.796ff5e132f5dp-169},
+/* 163 */ {0x1.ef0adcbdc5935p-3 ,+0x1.e8637950dc20dp-57,-0x1.34c52d7b3cbe3p-111,+0x1.71151e52c1a51p-167},
+/* 164 */ {0x1.fb9186d5e3e29p-3 ,+0x1.355519b0de535p-57,+0x1.682480b088ab6p-113,-0x1.8469ed1f7af04p-167},
+/* 165 */ {0x1.0402594b4d041p-2 ,-0x1.08ec217a5022dp-57,-0x1.0d9dc4cf9a1f9p-111,+0x1.f4243b14b65fep-165},
+/* 166 */ {0x1.0a324e27390e2p-2 ,+0x1.bdcfde8061c03p-56,+0x1.faa3780d6bef8p-110,-0x1.04243924438bcp-165},
+/* 167 */ {0x1.1058bf9ae4ad4p-2 ,+0x1.3f415699663ecp-63,-0x1.96634e8c81dc6p-117,+0x1.46fbf46e2087ep-171},
+/* 168 */ {0x1.1675cababa60fp-2 ,+0x1.ce63eab883727p-61,+0x1.1f833e825228bp-119,+0x1.e9514323c639ep-173},
+/* 169 */ {0x1.1c898c16999fbp-2 ,+0x1.9f1a39d500e3cp-56,-0x1.68223be88a50ap-111,+0x1.91fd26c955957p-165},
+/* 170 */ {0x1.22941fbcf7966p-2 ,-0x1.dbd7ac258a2bdp-58,+0x1.3d2e9aad37a78p-112,+0x1.ee0f274df2ea1p-166},
+/* 171 */ {0x1.2895a13de86a4p-2 ,+0x1.7ad24c13f040fp-56,-0x1.3a52b8aa6834fp-111,+0x1.68069bde615d8p-165},
+/* 172 */ {0x1.2e8e2bae11d31p-2 ,-0x1.1e99b72bd7bf2p-57,-0x1.464244294826fp-111,+0x1.d1a9da2891ef3p-166},
+/* 173 */ {0x1.347dd9a987d56p-2 ,-0x1.16ea62c048cfbp-56,-0x1.72b77ad3fa626p-110,-0x1.e1e401f0d7606p-165},
+/* 174 */ {0x1.3a64c556945eap-2 ,+0x1.cbcd735d03424p-60,-0x1.485c31181fd5fp-119,-0x1.ce8440eae1dadp-176},
+/* 175 */ {0x1.404308686a7e4p-2 ,-0x1.f79f6c1059cdbp-57,+0x1.85e41827d9d92p-112,-0x1.7496756e228f8p-166},
+/* 176 */ {0x1.4618bc21c5ec2p-2 ,-0x1.7a42642661c62p-61,+0x1.05772cd24c009p-116,-0x1.99c5b7d2efd53p-170},
+/* 177 */ {0x1.4be5f957778a1p-2 ,-0x1.4b366b609027ap-58,+0x1.26b953458673dp-112,+0x1.78d4a5605d5eep-167},
+/* 178 */ {0x1.51aad872df82ep-2 ,-0x1.d8db0a7cc1543p-56,-0x1.f7158586541a0p-110,-0x1.e50a5ccd6ebe4p-166},
+/* 179 */ {0x1.5767717455a6cp-2 ,-0x1.fb2a49af933e8p-57,-0x1.4a1d1f2f339b1p-114,-0x1.46ca5a481b7d4p-169},
+/* 180 */ {0x1.5d1bdbf5809cap-2 ,-0x1.7dc9c7c23801fp-56,+0x1.487ce02d29ad1p-110,-0x1.d49efa15cb0dfp-164},
+/* 181 */ {0x1.62c82f2b9c796p-2 ,-0x1.090a0dd59fe35p-58,+0x1.39c89b1577497p-112,-0x1.cbb4affd37330p-166}
+};
+static constexpr int log_table_bits = 7;
+static constexpr int log_table_offset = 90;
+
+/**
+ * @brief 1 / (2k + 1) for k = 1 to 13, used by the atanh series in log
+ */
+static constexpr Float64x4 log_inv_odd[] = {
+/* 1/ 3 */ {0x1.5555555555555p-2 ,+0x1.5555555555555p-56,+0x1.5555555555555p-110,+0x1.5555555555555p-164},
+/* 1/ 5 */ {0x1.999999999999ap-3 ,-0x1.999999999999ap-57,+0x1.999999999999ap-111,-0x1.999999999999ap-165},
+/* 1/ 7 */ {0x1.2492492492492p-3 ,+0x1.2492492492492p-57,+0x1.2492492492492p-111,+0x1.2492492492492p-165},
+/* 1/ 9 */ {0x1.c71c71c71c71cp-4 ,+0x1.c71c71c71c71cp-58,+0x1.c71c71c71c71cp-112,+0x1.c71c71c71c71cp-166},
+/* 1/11 */ {0x1.745d1745d1746p-4 ,-0x1.745d1745d1746p-59,+0x1.745d1745d1746p-114,-0x1.745d1745d1746p-169},
+/* 1/13 */ {0x1.3b13b13b13b14p-4 ,-0x1.3b13b13b13b14p-58,+0x1.3b13b13b13b14p-112,-0x1.3b13b13b13b14p-166},
+/* 1/15 */ {0x1.1111111111111p-4 ,+0x1.1111111111111p-60,+0x1.1111111111111p-116,+0x1.1111111111111p-172},
+/* 1/17 */ {0x1.e1e1e1e1e1e1ep-5 ,+0x1.e1e1e1e1e1e1ep-61,+0x1.e1e1e1e1e1e1ep-117,+0x1.e1e1e1e1e1e1ep-173},
+/* 1/19 */ {0x1.af286bca1af28p-5 ,+0x1.af286bca1af28p-59,+0x1.af286bca1af28p-113,+0x1.af286bca1af28p-167},
+/* 1/21 */ {0x1.8618618618618p-5 ,+0x1.8618618618618p-59,+0x1.8618618618618p-113,+0x1.8618618618618p-167},
+/* 1/23 */ {0x1.642c8590b2164p-5 ,+0x1.642c8590b2164p-60,+0x1.642c8590b2164p-115,+0x1.642c8590b2164p-170},
+/* 1/25 */ {0x1.47ae147ae147bp-5 ,-0x1.eb851eb851eb8p-61,-0x1.47ae147ae147bp-115,+0x1.eb851eb851eb8p-171},
+/* 1/27 */ {0x1.2f684bda12f68p-5 ,+0x1.2f684bda12f68p-59,+0x1.2f684bda12f68p-113,+0x1.2f684bda12f68p-167}
+};
+
 #endif /* FLOAT64X4_LUT_HPP */
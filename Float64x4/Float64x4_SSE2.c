@@ -0,0 +1,678 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "Float64x4.h"
+#include "Float64x4_SSE2.h"
+#include "Float64x2/Float64x2_SSE2.h"
+#include "Float64x4_def.h"
+
+#include <emmintrin.h>
+
+/**
+ * @brief Look up tables from Float64x4_LUT.hpp, which are exported by
+ * Float64x4.cpp since the header can only be included from C++.
+ */
+extern const Float64x4* const Float64x4_LUT_inv_fact;
+extern const Float64x4* const Float64x4_LUT_inv_fact_odd;
+extern const Float64x4* const Float64x4_LUT_sin_table;
+extern const Float64x4* const Float64x4_LUT_cos_table;
+
+//------------------------------------------------------------------------------
+// __m128dx4 helper functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Selects y for each lane where the sign bit of mask is set,
+ * otherwise x.
+ */
+static inline __m128dx4 _mm128x4_blendv_pdx4(
+	const __m128dx4 x, const __m128dx4 y, const __m128d mask
+) {
+	__m128dx4 ret;
+	ret.val[0] = _internal_mm_blendv_pd(x.val[0], y.val[0], mask);
+	ret.val[1] = _internal_mm_blendv_pd(x.val[1], y.val[1], mask);
+	ret.val[2] = _internal_mm_blendv_pd(x.val[2], y.val[2], mask);
+	ret.val[3] = _internal_mm_blendv_pd(x.val[3], y.val[3], mask);
+	return ret;
+}
+
+/**
+ * @brief Sets each lane to value where the sign bit of mask is set.
+ */
+static inline __m128dx4 _mm128x4_blendv_pdx4_pd(
+	const __m128dx4 x, const __m128d value, const __m128d mask
+) {
+	__m128dx4 ret;
+	ret.val[0] = _internal_mm_blendv_pd(x.val[0], value, mask);
+	ret.val[1] = _internal_mm_blendv_pd(x.val[1], _mm_setzero_pd(), mask);
+	ret.val[2] = _internal_mm_blendv_pd(x.val[2], _mm_setzero_pd(), mask);
+	ret.val[3] = _internal_mm_blendv_pd(x.val[3], _mm_setzero_pd(), mask);
+	return ret;
+}
+
+/**
+ * @brief Flips the sign of each lane where the sign bit of mask is set.
+ */
+static inline __m128dx4 _mm128x4_xor_sign_pdx4(__m128dx4 x, const __m128d mask) {
+	const __m128d sign_mask = _mm_and_pd(mask, _mm_get_sign_mask_pd());
+	x.val[0] = _mm_xor_pd(x.val[0], sign_mask);
+	x.val[1] = _mm_xor_pd(x.val[1], sign_mask);
+	x.val[2] = _mm_xor_pd(x.val[2], sign_mask);
+	x.val[3] = _mm_xor_pd(x.val[3], sign_mask);
+	return x;
+}
+
+static inline __m128dx4 _mm128x4_from_pdx2(const __m128dx2 x) {
+	__m128dx4 ret;
+	ret.val[0] = x.hi;
+	ret.val[1] = x.lo;
+	ret.val[2] = _mm_setzero_pd();
+	ret.val[3] = _mm_setzero_pd();
+	return ret;
+}
+
+static inline __m128dx2 _mm128x2_from_pdx4(const __m128dx4 x) {
+	__m128dx2 ret;
+	ret.hi = x.val[0];
+	ret.lo = x.val[1];
+	return ret;
+}
+
+/**
+ * @brief Loads table[index] for each lane.
+ * @note index must be within the bounds of table.
+ */
+static inline __m128dx4 _mm128x4_lookup_table_pdx4(
+	const Float64x4* const table, const __m128i index
+) {
+	__m128dx4 ret;
+	const int32_t i_0 = _mm_cvtsi128_si32(index);
+	const int32_t i_1 = _mm_cvtsi128_si32(_mm_shuffle_epi32(index, _MM_SHUFFLE(1, 1, 1, 1)));
+	for (int v = 0; v < 4; v++) {
+		ret.val[v] = _mm_set_pd(table[i_1].val[v], table[i_0].val[v]);
+	}
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// __m128dx4 exponents and logarithms
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Exponential.  Computes expm1(x) in quad-double precision when x
+ * is between -0.5ln(2) and +0.5ln(2), otherwise exp(x) = 2^m * (ret + 1).
+ *
+ * @author Taken from libQD qd_real.cpp which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ *
+ * @note x.val[0] must be finite and within [-750.0, +710.0] so that m fits
+ * inside of an int32_t.
+ */
+static inline __m128dx4 _mm128x4_taylor_expm1_pdx4(
+	const __m128dx4 x, __m128i* m_bin
+) {
+	/* Strategy:  We first reduce the size of x by noting that
+
+			exp(kr + m * log(2)) = 2^m * exp(r)^k
+
+		where m and k are integers.  By choosing m appropriately
+		we can make |kr| <= log(2) / 2 = 0.346574.  Then exp(r) is
+		evaluated using the familiar Taylor series.  Reducing the
+		argument substantially speeds up the convergence.       */
+
+	// const __m128d k = _mm_set1_pd(0x1.0p+16);
+	const __m128d inv_k = _mm_set1_pd(0x1.0p-16);
+
+	__m128d m = _mm_floor_pd(_mm_add_pd(
+		_mm_mul_pd(x.val[0], _mm_const_log2e_pd()), _mm_set1_pd(0.5)
+	));
+	*m_bin = _mm_cvttpd_epi32(m);
+
+	__m128dx4 r = _mm128x4_mul_power2_pdx4_pd(
+		_mm128x4_sub_pdx4(x, _mm128x4_mul_pdx4_pd(_mm128x4_const_ln2_pdx4(), m)), inv_k
+	);
+	__m128dx4 s, p, t;
+
+	p = _mm128x4_square_pdx4(r);
+	s = _mm128x4_add_pdx4(r, _mm128x4_mul_power2_pdx4_pd(p, _mm_set1_pd(0.5)));
+	// Same number of terms as the scalar version (3! to 11!)
+	for (int i = 0; i < 9; i++) {
+		p = _mm128x4_mul_pdx4(p, r);
+		t = _mm128x4_mul_pdx4(p, _mm128x4_set1_pdx4(Float64x4_LUT_inv_fact[i]));
+		s = _mm128x4_add_pdx4(s, t);
+	}
+
+	for (int i = 0; i < 16; i++) {
+		s = _mm128x4_add_pdx4(
+			_mm128x4_mul_power2_pdx4_pd(s, _mm_set1_pd(2.0)),
+			_mm128x4_square_pdx4(s)
+		);
+	}
+	return s;
+}
+
+/**
+ * @brief Clamps x.val[0] to [-750.0, +710.0] so that exp(x) underflows to
+ * zero or overflows to infinity. NaN is clamped to -750.0 and must be
+ * blended back in afterwards.
+ */
+static inline __m128dx4 _mm128x4_exp_clamp_pdx4(__m128dx4 x) {
+	const __m128d exp_lower = _mm_set1_pd(-750.0);
+	const __m128d exp_upper = _mm_set1_pd(+710.0);
+	__m128d in_range = _mm_and_pd(
+		_mm_cmpgt_pd(x.val[0], exp_lower),
+		_mm_cmplt_pd(x.val[0], exp_upper)
+	);
+	x.val[0] = _mm_min_pd(_mm_max_pd(x.val[0], exp_lower), exp_upper);
+	x.val[1] = _mm_and_pd(x.val[1], in_range);
+	x.val[2] = _mm_and_pd(x.val[2], in_range);
+	x.val[3] = _mm_and_pd(x.val[3], in_range);
+	return x;
+}
+
+__m128dx4 _mm128x4_exp_pdx4(const __m128dx4 x) {
+	__m128i m_bin;
+	__m128dx4 ret = _mm128x4_taylor_expm1_pdx4(
+		_mm128x4_exp_clamp_pdx4(x), &m_bin
+	);
+	ret = _mm128x4_add_pdx4_pd(ret, _mm_set1_pd(1.0));
+	ret = _mm128x4_ldexp_pdx4_epi32(ret, m_bin);
+
+	// Propagates NaN
+	return _mm128x4_blendv_pdx4_pd(ret, x.val[0], _mm_isnan_pd(x.val[0]));
+}
+
+__m128dx4 _mm128x4_expm1_pdx4(const __m128dx4 x) {
+	__m128i m_bin;
+	__m128dx4 ret_expm1 = _mm128x4_taylor_expm1_pdx4(
+		_mm128x4_exp_clamp_pdx4(x), &m_bin
+	);
+
+	__m128dx4 ret = _mm128x4_add_pdx4_pd(ret_expm1, _mm_set1_pd(1.0));
+	ret = _mm128x4_ldexp_pdx4_epi32(ret, m_bin);
+	ret = _mm128x4_sub_pdx4_pd(ret, _mm_set1_pd(1.0));
+
+	// Check if x was in range
+	const __m128d half_ln2 = _mm_set1_pd(0.5 * 0x1.62e42fefa39efp-1);
+	const __m128d ret_cmp = _mm_cmplt_pd(
+		_mm_fabs_pd(x.val[0]), half_ln2
+	);
+	ret = _mm128x4_blendv_pdx4(ret, ret_expm1, ret_cmp);
+
+	// Avoids inf - inf when subtracting 1.0
+	ret = _mm128x4_blendv_pdx4_pd(ret, _mm_get_infinity_pd(),
+		_mm_cmpge_pd(x.val[0], _mm_set1_pd(709.79))
+	);
+
+	// Propagates NaN
+	return _mm128x4_blendv_pdx4_pd(ret, x.val[0], _mm_isnan_pd(x.val[0]));
+}
+
+/**
+ * @brief Logarithm.  Computes log(x) in quad-double precision.
+ * @note This is a natural logarithm (i.e., base e).
+ *
+ * @author Taken from libQD qd_real.cpp which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+__m128dx4 _mm128x4_log_pdx4(const __m128dx4 x) {
+	/* Strategy.  The Taylor series for log converges much more
+		slowly than that of exp, due to the lack of the factorial
+		term in the denominator.  Hence this routine instead tries
+		to determine the root of the function
+
+			f(x) = exp(x) - a
+
+		using Newton iteration.  The iteration is given by
+
+			x' = x - f(x)/f'(x)
+			= x - (1 - a * exp(-x))
+			= x + a * exp(-x) - 1
+			= x + a * expm1(-x) + (a - 1).
+
+		The last form avoids cancellation when a is close to 1.
+
+		libQD starts from a double and uses three iterations. Here the
+		initial guess comes from _mm128x2_log_pdx2, so only one iteration
+		is needed since Newton's iteration approximately doubles the number
+		of digits per iteration. */
+
+	/**
+	 * x is scaled to [1.0, 2.0) so that the error of the guess is small
+	 * relative to log(x), except for [0.5, 2.0) where log(x) is close to 0.
+	 * log(x) = log(x * 2^-expon) + expon * log(2)
+	 */
+	__m128i expon = _mm128x4_ilogb_pdx4_epi32(x);
+	expon = _mm_andnot_si128(_mm_or_si128(
+		_mm_cmpeq_epi32(expon, _mm_setzero_si128()),
+		_mm_cmpeq_epi32(expon, _mm_set1_epi32(-1))
+	), expon);
+	const __m128dx4 x_scaled = _mm128x4_ldexp_pdx4_epi32(
+		x, _mm_sub_epi32(_mm_setzero_si128(), expon)
+	);
+
+	const __m128dx4 x_m1 = _mm128x4_sub_pdx4_pd(x_scaled, _mm_set1_pd(1.0));
+
+	/**
+	 * Initial approximation. log1p(x - 1) keeps the relative error of the
+	 * guess small when x is close to 1.
+	 */
+	const __m128dx4 guess = _mm128x4_from_pdx2(
+		_mm128x2_log1p_pdx2(_mm128x2_from_pdx4(x_m1))
+	);
+
+	__m128dx4 ret = _mm128x4_add_pdx4(
+		_mm128x4_add_pdx4(guess, _mm128x4_mul_pdx4(
+			x_scaled, _mm128x4_expm1_pdx4(_mm128x4_negate_pdx4(guess))
+		)),
+		x_m1
+	);
+	ret = _mm128x4_add_pdx4(ret, _mm128x4_mul_pdx4_pd(
+		_mm128x4_const_ln2_pdx4(), _mm_cvtepi32_pd(expon)
+	));
+
+	// log(+inf) = +inf
+	ret = _mm128x4_blendv_pdx4_pd(ret, x.val[0],
+		_mm_cmpeq_pd(x.val[0], _mm_get_infinity_pd())
+	);
+
+	// log(0.0) = -inf
+	ret = _mm128x4_blendv_pdx4_pd(ret, _mm_negate_pd(_mm_get_infinity_pd()),
+		_mm_cmpeq_pd(x.val[0], _mm_setzero_pd())
+	);
+
+	// log(x < 0.0) = NaN, and propagates NaN
+	const __m128d x_isnan = _mm_cmpnge_pd(x.val[0], _mm_setzero_pd());
+	ret = _mm128x4_blendv_pdx4_pd(ret, _mm_get_qNaN_pd(), x_isnan);
+	ret.val[1] = _internal_mm_blendv_pd(ret.val[1], _mm_get_qNaN_pd(), x_isnan);
+	return ret;
+}
+
+/**
+ * @brief log1p(x) = 2 * atanh(x / (2 + x)) when |x| is small, otherwise
+ * log(1 + x).
+ *
+ * @remarks The atanh series only needs even powers of z = x / (2 + x),
+ * which converges about twice as fast as the log1p Taylor series.
+ */
+__m128dx4 _mm128x4_log1p_pdx4(const __m128dx4 x) {
+	const __m128d use_series = _mm_cmplt_pd(
+		_mm_fabs_pd(x.val[0]), _mm_set1_pd(0x1.0p-8)
+	);
+	const int series_mask = _mm_movemask_pd(use_series);
+
+	__m128dx4 ret_series = x;
+	if (series_mask != 0x0) {
+		/**
+		 * @remarks |z| < 2^-9, so (z^2)^12 / 25 is below 2^-212
+		 */
+		const Float64x4 inv_odd[12] = {
+		/* 1/3  */ {{+0x1.5555555555555p-2,+0x1.5555555555555p-56,+0x1.5555555555555p-110,+0x1.5555555555555p-164}},
+		/* 1/5  */ {{+0x1.999999999999ap-3,-0x1.999999999999ap-57,+0x1.999999999999ap-111,-0x1.999999999999ap-165}},
+		/* 1/7  */ {{+0x1.2492492492492p-3,+0x1.2492492492492p-57,+0x1.2492492492492p-111,+0x1.2492492492492p-165}},
+		/* 1/9  */ {{+0x1.c71c71c71c71cp-4,+0x1.c71c71c71c71cp-58,+0x1.c71c71c71c71cp-112,+0x1.c71c71c71c71cp-166}},
+		/* 1/11 */ {{+0x1.745d1745d1746p-4,-0x1.745d1745d1746p-59,+0x1.745d1745d1746p-114,-0x1.745d1745d1746p-169}},
+		/* 1/13 */ {{+0x1.3b13b13b13b14p-4,-0x1.3b13b13b13b14p-58,+0x1.3b13b13b13b14p-112,-0x1.3b13b13b13b14p-166}},
+		/* 1/15 */ {{+0x1.1111111111111p-4,+0x1.1111111111111p-60,+0x1.1111111111111p-116,+0x1.1111111111111p-172}},
+		/* 1/17 */ {{+0x1.e1e1e1e1e1e1ep-5,+0x1.e1e1e1e1e1e1ep-61,+0x1.e1e1e1e1e1e1ep-117,+0x1.e1e1e1e1e1e1ep-173}},
+		/* 1/19 */ {{+0x1.af286bca1af28p-5,+0x1.af286bca1af28p-59,+0x1.af286bca1af28p-113,+0x1.af286bca1af28p-167}},
+		/* 1/21 */ {{+0x1.8618618618618p-5,+0x1.8618618618618p-59,+0x1.8618618618618p-113,+0x1.8618618618618p-167}},
+		/* 1/23 */ {{+0x1.642c8590b2164p-5,+0x1.642c8590b2164p-60,+0x1.642c8590b2164p-115,+0x1.642c8590b2164p-170}},
+		/* 1/25 */ {{+0x1.47ae147ae147bp-5,-0x1.eb851eb851eb8p-61,-0x1.47ae147ae147bp-115,+0x1.eb851eb851eb8p-171}}
+		};
+		const __m128dx4 z = _mm128x4_div_pdx4(
+			x, _mm128x4_add_pd_pdx4(_mm_set1_pd(2.0), x)
+		);
+		const __m128dx4 z_squared = _mm128x4_square_pdx4(z);
+		__m128dx4 poly = _mm128x4_set1_pdx4(inv_odd[11]);
+		for (int i = 10; i >= 0; i--) {
+			poly = _mm128x4_add_pdx4(
+				_mm128x4_mul_pdx4(poly, z_squared), _mm128x4_set1_pdx4(inv_odd[i])
+			);
+		}
+		ret_series = _mm128x4_mul_power2_pdx4_pd(_mm128x4_add_pdx4(
+			_mm128x4_mul_pdx4(_mm128x4_mul_pdx4(poly, z_squared), z), z
+		), _mm_set1_pd(2.0));
+		if (series_mask == 0x3) {
+			return ret_series;
+		}
+	}
+
+	// log(x <= -1.0) is handled by _mm128x4_log_pdx4
+	__m128dx4 ret = _mm128x4_log_pdx4(_mm128x4_add_pdx4_pd(x, _mm_set1_pd(1.0)));
+	ret = _mm128x4_blendv_pdx4(ret, ret_series, use_series);
+
+	// log1p(+inf) = +inf
+	return _mm128x4_blendv_pdx4_pd(ret, x.val[0],
+		_mm_cmpeq_pd(x.val[0], _mm_get_infinity_pd())
+	);
+}
+
+__m128dx4 _mm128x4_pow_pdx4(const __m128dx4 x, const __m128dx4 y) {
+	__m128dx4 ret = _mm128x4_exp_pdx4(_mm128x4_mul_pdx4(_mm128x4_log_pdx4(x), y));
+	// pow(0.0, y) = (y == 0.0) ? 1.0 : 0.0
+	const __m128d x_iszero = _mm_cmpeq_zero_pdx4(x);
+	const __m128d y_iszero = _mm_cmpeq_zero_pdx4(y);
+	return _mm128x4_blendv_pdx4_pd(ret,
+		_mm_and_pd(y_iszero, _mm_set1_pd(1.0)), x_iszero
+	);
+}
+
+__m128dx4 _mm128x4_pow_pdx4_pd(const __m128dx4 x, const __m128d y) {
+	__m128dx4 ret = _mm128x4_exp_pdx4(_mm128x4_mul_pdx4_pd(_mm128x4_log_pdx4(x), y));
+	// pow(0.0, y) = (y == 0.0) ? 1.0 : 0.0
+	const __m128d x_iszero = _mm_cmpeq_zero_pdx4(x);
+	const __m128d y_iszero = _mm_cmpeq_pd(y, _mm_setzero_pd());
+	return _mm128x4_blendv_pdx4_pd(ret,
+		_mm_and_pd(y_iszero, _mm_set1_pd(1.0)), x_iszero
+	);
+}
+
+//------------------------------------------------------------------------------
+// __m128dx4 trigonometry
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Computes sin(x) and cos(x) using Taylor series.
+ * @note Assumes |x| <= pi/2048.
+ *
+ * @author Taken from libQD qd_real.cpp which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+static inline void _mm128x4_sincos_taylor_pdx4(
+	const __m128dx4 x, __m128dx4* const p_sin, __m128dx4* const p_cos
+) {
+	/**
+	 * @remarks (pi/2048)^18 / 19! is below 2^-212, so the series is
+	 * truncated after the 17! term instead of checking a threshold.
+	 */
+	const __m128dx4 neg_x_squared = _mm128x4_negate_pdx4(_mm128x4_square_pdx4(x));
+	__m128dx4 x_power = x;
+	__m128dx4 sum = _mm128x4_setzero_pdx4();
+	for (int i = 0; i < 8; i++) {
+		x_power = _mm128x4_mul_pdx4(x_power, neg_x_squared);
+		sum = _mm128x4_add_pdx4(sum, _mm128x4_mul_pdx4(
+			x_power, _mm128x4_set1_pdx4(Float64x4_LUT_inv_fact_odd[i])
+		));
+	}
+	*p_sin = _mm128x4_add_pdx4(sum, x);
+	*p_cos = _mm128x4_sqrt_pdx4(_mm128x4_sub_pd_pdx4(
+		_mm_set1_pd(1.0), _mm128x4_square_pdx4(*p_sin)
+	));
+}
+
+/**
+ * @brief Computes sin(x) and cos(x) for both lanes at once.
+ *
+ * @details x is reduced to x = t + j * (pi/2) + k * (pi/1024) with
+ * |t| <= pi/2048, which is the same reduction used by libQD. Both steps are
+ * done at once with n = j * 512 + k, subtracting n * (pi/1024) from x using
+ * a six part pi/1024 so that the reduction stays accurate for large n.
+ * sin(k * pi/1024) and cos(k * pi/1024) are then loaded from
+ * Float64x4_LUT.hpp, and the quadrant j is applied with blends.
+ */
+static inline void _mm128x4_sincos_kernel_pdx4(
+	const __m128dx4 x, __m128dx4* const p_sin, __m128dx4* const p_cos
+) {
+	/* pi/1024 split into six doubles */
+	const __m128d pi1024[6] = {
+		_mm_set1_pd(+0x1.921fb54442d18p-9  ),
+		_mm_set1_pd(+0x1.1a62633145c07p-63 ),
+		_mm_set1_pd(-0x1.f1976b7ed8fbcp-119),
+		_mm_set1_pd(+0x1.4cf98e804177dp-173),
+		_mm_set1_pd(+0x1.31d89cd9128a5p-227),
+		_mm_set1_pd(+0x1.0f31c6809bbdfp-285)
+	};
+	const __m128d inv_pi1024 = _mm_set1_pd(0x1.45f306dc9c883p+8);
+
+	const __m128d n = _mm_nearbyint_pd(_mm_mul_pd(x.val[0], inv_pi1024));
+
+	/* t = x - n * (pi/1024) */
+	__m128d p_err;
+	__m128d p = _mm_two_prod_pd(n, pi1024[0], &p_err);
+	__m128dx4 t;
+	t.val[0] = x.val[1];
+	t.val[1] = x.val[2];
+	t.val[2] = x.val[3];
+	t.val[3] = _mm_setzero_pd();
+	// x.val[0] - n * pi1024[0] is exact since both are within a factor of two
+	t = _mm128x4_add_pdx4_pd(t, _mm_sub_pd(x.val[0], p));
+	t = _mm128x4_sub_pdx4_pd(t, p_err);
+	for (int i = 1; i < 5; i++) {
+		p = _mm_two_prod_pd(n, pi1024[i], &p_err);
+		t = _mm128x4_sub_pdx4_pd(t, p);
+		t = _mm128x4_sub_pdx4_pd(t, p_err);
+	}
+	t = _mm128x4_sub_pdx4_pd(t, _mm_mul_pd(n, pi1024[5]));
+
+	/* n = j * 512 + k where k is within [-256, +255] */
+	const __m128d j = _mm_floor_pd(_mm_mul_pd(
+		_mm_add_pd(n, _mm_set1_pd(256.0)), _mm_set1_pd(0x1.0p-9)
+	));
+	const __m128d k = _mm_sub_pd(n, _mm_mul_pd(j, _mm_set1_pd(512.0)));
+	const __m128d k_iszero = _mm_cmpeq_pd(k, _mm_setzero_pd());
+	// The tables start at k = 1
+	__m128d k_index = _mm_sub_pd(_mm_fabs_pd(k), _mm_set1_pd(1.0));
+	// Keeps the table index in bounds for k == 0, NaN, infinity, and huge values
+	k_index = _mm_min_pd(_mm_max_pd(k_index, _mm_setzero_pd()), _mm_set1_pd(255.0));
+	k_index = _mm_andnot_pd(_mm_cmpunord_pd(k_index, k_index), k_index);
+	const __m128i index = _mm_cvtpd_epi32(k_index);
+
+	/* sin(t + k * pi/1024) and cos(t + k * pi/1024) */
+	__m128dx4 t_sin, t_cos;
+	_mm128x4_sincos_taylor_pdx4(t, &t_sin, &t_cos);
+	__m128dx4 u = _mm128x4_lookup_table_pdx4(Float64x4_LUT_cos_table, index);
+	__m128dx4 v = _mm128x4_lookup_table_pdx4(Float64x4_LUT_sin_table, index);
+	u = _mm128x4_blendv_pdx4_pd(u, _mm_set1_pd(1.0), k_iszero);
+	v = _mm128x4_blendv_pdx4_pd(v, _mm_setzero_pd(), k_iszero);
+	// sin(-k * pi/1024) = -sin(k * pi/1024)
+	v = _mm128x4_xor_sign_pdx4(v, k);
+
+	const __m128dx4 sin_val = _mm128x4_add_pdx4(
+		_mm128x4_mul_pdx4(u, t_sin), _mm128x4_mul_pdx4(v, t_cos)
+	);
+	const __m128dx4 cos_val = _mm128x4_sub_pdx4(
+		_mm128x4_mul_pdx4(u, t_cos), _mm128x4_mul_pdx4(v, t_sin)
+	);
+
+	/* Applies the quadrant (j mod 4) */
+	const __m128d quadrant = _mm_sub_pd(j, _mm_mul_pd(
+		_mm_floor_pd(_mm_mul_pd(j, _mm_set1_pd(0.25))), _mm_set1_pd(4.0)
+	));
+	const __m128d quadrant_1 = _mm_cmpeq_pd(quadrant, _mm_set1_pd(1.0));
+	const __m128d quadrant_2 = _mm_cmpeq_pd(quadrant, _mm_set1_pd(2.0));
+	const __m128d quadrant_3 = _mm_cmpeq_pd(quadrant, _mm_set1_pd(3.0));
+	const __m128d swap = _mm_or_pd(quadrant_1, quadrant_3);
+
+	*p_sin = _mm128x4_xor_sign_pdx4(
+		_mm128x4_blendv_pdx4(sin_val, cos_val, swap),
+		_mm_or_pd(quadrant_2, quadrant_3)
+	);
+	*p_cos = _mm128x4_xor_sign_pdx4(
+		_mm128x4_blendv_pdx4(cos_val, sin_val, swap),
+		_mm_or_pd(quadrant_1, quadrant_2)
+	);
+}
+
+__m128dx4 _mm128x4_sin_pdx4(const __m128dx4 x) {
+	__m128dx4 ret_sin, ret_cos;
+	_mm128x4_sincos_kernel_pdx4(x, &ret_sin, &ret_cos);
+	return ret_sin;
+}
+
+__m128dx4 _mm128x4_cos_pdx4(const __m128dx4 x) {
+	__m128dx4 ret_sin, ret_cos;
+	_mm128x4_sincos_kernel_pdx4(x, &ret_sin, &ret_cos);
+	return ret_cos;
+}
+
+void _mm128x4_sincos_pdx4(
+	const __m128dx4 theta, __m128dx4* const p_sin, __m128dx4* const p_cos
+) {
+	_mm128x4_sincos_kernel_pdx4(theta, p_sin, p_cos);
+}
+
+/**
+ * @author Taken from libQD qd_real.cpp which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+__m128dx4 _mm128x4_atan2_pdx4(const __m128dx4 y, const __m128dx4 x) {
+	/* Strategy: Instead of using Taylor series to compute
+		arctan, we instead use Newton's iteration to solve
+		the equation
+
+		sin(z) = y/r    or    cos(z) = x/r
+
+		where r = sqrt(x^2 + y^2).
+		The iteration is given by
+
+		z' = z + (y - sin(z)) / cos(z)          (for equation 1)
+		z' = z - (x - cos(z)) / sin(z)          (for equation 2)
+
+		Here, x and y are normalized so that x^2 + y^2 = 1.
+		If |x| > |y|, then first iteration is used since the
+		denominator is larger.  Otherwise, the second is used.
+
+		libQD starts from a double and uses three iterations. Here the
+		initial guess comes from _mm128x2_atan2_pdx2, so only one
+		iteration is needed. */
+
+	const __m128dx4 guess = _mm128x4_from_pdx2(_mm128x2_atan2_pdx2(
+		_mm128x2_from_pdx4(y), _mm128x2_from_pdx4(x)
+	));
+	const __m128dx4 radius = _mm128x4_sqrt_pdx4(_mm128x4_add_pdx4(
+		_mm128x4_square_pdx4(x), _mm128x4_square_pdx4(y)
+	));
+	__m128dx4 sin_z, cos_z;
+	_mm128x4_sincos_kernel_pdx4(guess, &sin_z, &cos_z);
+
+	const __m128d use_iter_1 = _mm_cmpgt_pd(
+		_mm_fabs_pd(x.val[0]), _mm_fabs_pd(y.val[0])
+	);
+	/* (y / r) or (x / r) */
+	const __m128dx4 w = _mm128x4_div_pdx4(
+		_mm128x4_blendv_pdx4(x, y, use_iter_1), radius
+	);
+	const __m128dx4 num = _mm128x4_blendv_pdx4(
+		_mm128x4_sub_pdx4(cos_z, w), _mm128x4_sub_pdx4(w, sin_z), use_iter_1
+	);
+	const __m128dx4 den = _mm128x4_blendv_pdx4(sin_z, cos_z, use_iter_1);
+	__m128dx4 ret = _mm128x4_add_pdx4(guess, _mm128x4_div_pdx4(num, den));
+
+	// Infinite inputs make the iteration return NaN
+	const __m128d use_guess = _mm_andnot_pd(
+		_mm_isnan_pd(guess.val[0]), _mm_isnan_pd(ret.val[0])
+	);
+	return _mm128x4_blendv_pdx4(ret, guess, use_guess);
+}
+
+__m128dx4 _mm128x4_atan_pdx4(const __m128dx4 x) {
+	return _mm128x4_atan2_pdx4(x, _mm128x4_set1_pd(1.0));
+}
+
+/**
+ * @brief Computes sqrt(1 - x^2) as sqrt((1 - x) * (1 + x)) to avoid
+ * cancellation when |x| is close to 1.
+ */
+static inline __m128dx4 _mm128x4_sqrt_one_minus_square_pdx4(const __m128dx4 x) {
+	const __m128d one = _mm_set1_pd(1.0);
+	return _mm128x4_sqrt_pdx4(_mm128x4_mul_pdx4(
+		_mm128x4_sub_pd_pdx4(one, x), _mm128x4_add_pd_pdx4(one, x)
+	));
+}
+
+__m128dx4 _mm128x4_asin_pdx4(const __m128dx4 x) {
+	// |x| > 1.0 returns NaN from the square root
+	return _mm128x4_atan2_pdx4(x, _mm128x4_sqrt_one_minus_square_pdx4(x));
+}
+
+__m128dx4 _mm128x4_acos_pdx4(const __m128dx4 x) {
+	// |x| > 1.0 returns NaN from the square root
+	return _mm128x4_atan2_pdx4(_mm128x4_sqrt_one_minus_square_pdx4(x), x);
+}
+
+//------------------------------------------------------------------------------
+// __m128dx4 hyperbolic functions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief sinh(|x|) = (expm1(|x|) + expm1(|x|) / exp(|x|)) / 2
+ * cosh(|x|) = (exp(|x|) + 1 / exp(|x|)) / 2
+ *
+ * @details Using expm1 avoids the cancellation in exp(x) - exp(-x) when x
+ * is close to 0, so no separate Taylor series is needed.
+ */
+void _mm128x4_sinhcosh_pdx4(
+	const __m128dx4 theta, __m128dx4* const p_sinh, __m128dx4* const p_cosh
+) {
+	const __m128dx4 abs_x = _mm128x4_fabs_pdx4(theta);
+	const __m128dx4 x_expm1 = _mm128x4_expm1_pdx4(abs_x);
+	const __m128dx4 x_exp = _mm128x4_add_pdx4_pd(x_expm1, _mm_set1_pd(1.0));
+	const __m128dx4 recip_exp = _mm128x4_recip_pdx4(x_exp);
+
+	__m128dx4 ret_sinh = _mm128x4_mul_power2_pdx4_pd(
+		_mm128x4_add_pdx4(x_expm1, _mm128x4_mul_pdx4(x_expm1, recip_exp)),
+		_mm_set1_pd(0.5)
+	);
+	__m128dx4 ret_cosh = _mm128x4_mul_power2_pdx4_pd(
+		_mm128x4_add_pdx4(x_exp, recip_exp),
+		_mm_set1_pd(0.5)
+	);
+
+	/**
+	 * exp(-|x|) is below 2^-216 * exp(|x|) when |x| > 75. This also avoids
+	 * multiplying by exp(|x|) when it is large enough for the Dekker split
+	 * to overflow.
+	 */
+	const __m128dx4 half_exp = _mm128x4_mul_power2_pdx4_pd(x_exp, _mm_set1_pd(0.5));
+	const __m128d x_large = _mm_cmpgt_pd(abs_x.val[0], _mm_set1_pd(75.0));
+	ret_sinh = _mm128x4_blendv_pdx4(ret_sinh, half_exp, x_large);
+	ret_cosh = _mm128x4_blendv_pdx4(ret_cosh, half_exp, x_large);
+
+	// exp(|x|) overflows
+	const __m128d overflow = _mm_cmpge_pd(abs_x.val[0], _mm_set1_pd(709.79));
+	ret_sinh = _mm128x4_blendv_pdx4_pd(ret_sinh, _mm_get_infinity_pd(), overflow);
+	ret_cosh = _mm128x4_blendv_pdx4_pd(ret_cosh, _mm_get_infinity_pd(), overflow);
+
+	// sinh(-x) = -sinh(x)
+	*p_sinh = _mm128x4_xor_sign_pdx4(ret_sinh, theta.val[0]);
+	*p_cosh = ret_cosh;
+}
+
+__m128dx4 _mm128x4_sinh_pdx4(const __m128dx4 x) {
+	__m128dx4 ret_sinh, ret_cosh;
+	_mm128x4_sinhcosh_pdx4(x, &ret_sinh, &ret_cosh);
+	return ret_sinh;
+}
+
+__m128dx4 _mm128x4_cosh_pdx4(const __m128dx4 x) {
+	__m128dx4 ret_sinh, ret_cosh;
+	_mm128x4_sinhcosh_pdx4(x, &ret_sinh, &ret_cosh);
+	return ret_cosh;
+}
+
+/**
+ * @brief tanh(|x|) = expm1(2|x|) / (expm1(2|x|) + 2)
+ */
+__m128dx4 _mm128x4_tanh_pdx4(const __m128dx4 x) {
+	const __m128dx4 abs_x = _mm128x4_fabs_pdx4(x);
+	const __m128dx4 x_expm1 = _mm128x4_expm1_pdx4(
+		_mm128x4_mul_power2_pdx4_pd(abs_x, _mm_set1_pd(2.0))
+	);
+	__m128dx4 ret = _mm128x4_div_pdx4(
+		x_expm1, _mm128x4_add_pdx4_pd(x_expm1, _mm_set1_pd(2.0))
+	);
+
+	// 1.0 - tanh(75.0) is below 2^-212, and avoids inf / inf
+	ret = _mm128x4_blendv_pdx4_pd(ret, _mm_set1_pd(1.0),
+		_mm_cmpgt_pd(abs_x.val[0], _mm_set1_pd(75.0))
+	);
+
+	// tanh(-x) = -tanh(x)
+	return _mm128x4_xor_sign_pdx4(ret, x.val[0]);
+}
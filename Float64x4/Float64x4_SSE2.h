@@ -20,7 +20,7 @@
 #define FLOAT64X4_SSE2_H
 
 /**
- * @note Requires AVX or later.
+ * @note Requires SSE2 or later. SSE4.1 is used when available.
  * @warning -Ofast may break this library. -O3 compiles okay on gcc and clang.
  */
 
@@ -208,33 +208,44 @@ static inline __m128dx4 _mm128x4_setr_epi64x(
 // __m128dx4 load operations
 //------------------------------------------------------------------------------
 
-#if 0
-/* Unimplemented */
-
 /**
- * @note mem_addr must be aligned on a 32-byte boundary or a general-protection
+ * @brief Loads two Float64x4 values.
+ * @note mem_addr must be aligned on a 16-byte boundary or a general-protection
  * exception may be generated.
  */
 static inline __m128dx4 _mm128x4_load_pd(const double* mem_addr) {
+	// {x.0, x.1}, {x.2, x.3}, {y.0, y.1}, {y.2, y.3}
+	const __m128d v0 = _mm_load_pd(mem_addr + 0);
+	const __m128d v1 = _mm_load_pd(mem_addr + 2);
+	const __m128d v2 = _mm_load_pd(mem_addr + 4);
+	const __m128d v3 = _mm_load_pd(mem_addr + 6);
 	__m128dx4 ret;
-	ret.val[0] = _mm_load_pd(mem_addr +  0);
-	ret.val[1] = _mm_load_pd(mem_addr +  4);
-	ret.val[2] = _mm_load_pd(mem_addr +  8);
-	ret.val[3] = _mm_load_pd(mem_addr + 12);
-	return _mm128x4_transpose_pdx4(ret);
+	ret.val[0] = _mm_unpacklo_pd(v0, v2);
+	ret.val[1] = _mm_unpackhi_pd(v0, v2);
+	ret.val[2] = _mm_unpacklo_pd(v1, v3);
+	ret.val[3] = _mm_unpackhi_pd(v1, v3);
+	return ret;
 }
 
+/**
+ * @brief Loads two Float64x4 values.
+ */
 static inline __m128dx4 _mm128x4_loadu_pd(const double* mem_addr) {
+	// {x.0, x.1}, {x.2, x.3}, {y.0, y.1}, {y.2, y.3}
+	const __m128d v0 = _mm_loadu_pd(mem_addr + 0);
+	const __m128d v1 = _mm_loadu_pd(mem_addr + 2);
+	const __m128d v2 = _mm_loadu_pd(mem_addr + 4);
+	const __m128d v3 = _mm_loadu_pd(mem_addr + 6);
 	__m128dx4 ret;
-	ret.val[0] = _mm_loadu_pd(mem_addr +  0);
-	ret.val[1] = _mm_loadu_pd(mem_addr +  4);
-	ret.val[2] = _mm_loadu_pd(mem_addr +  8);
-	ret.val[3] = _mm_loadu_pd(mem_addr + 12);
-	return _mm128x4_transpose_pdx4(ret);
+	ret.val[0] = _mm_unpacklo_pd(v0, v2);
+	ret.val[1] = _mm_unpackhi_pd(v0, v2);
+	ret.val[2] = _mm_unpacklo_pd(v1, v3);
+	ret.val[3] = _mm_unpackhi_pd(v1, v3);
+	return ret;
 }
 
 /**
- * @note mem_addr must be aligned on a 32-byte boundary or a general-protection
+ * @note mem_addr must be aligned on a 16-byte boundary or a general-protection
  * exception may be generated.
  */
 static inline __m128dx4 _mm128x4_load_pdx4(const Float64x4* mem_addr) {
@@ -245,27 +256,25 @@ static inline __m128dx4 _mm128x4_loadu_pdx4(const Float64x4* mem_addr) {
 	return _mm128x4_loadu_pd((const double*)((const void*)mem_addr));
 }
 
-#endif
-
 /**
- * @note mem_addr must be aligned on a 32-byte boundary or a general-protection
+ * @note mem_addr must be aligned on a 16-byte boundary or a general-protection
  * exception may be generated.
  */
 static inline __m128dx4 _mm128x4_load_raw_pd(const double* mem_addr) {
 	__m128dx4 ret;
-	ret.val[0] = _mm_load_pd(mem_addr +  0);
-	ret.val[1] = _mm_load_pd(mem_addr +  4);
-	ret.val[2] = _mm_load_pd(mem_addr +  8);
-	ret.val[3] = _mm_load_pd(mem_addr + 12);
+	ret.val[0] = _mm_load_pd(mem_addr + 0);
+	ret.val[1] = _mm_load_pd(mem_addr + 2);
+	ret.val[2] = _mm_load_pd(mem_addr + 4);
+	ret.val[3] = _mm_load_pd(mem_addr + 6);
 	return ret;
 }
 
 static inline __m128dx4 _mm128x4_loadu_raw_pd(const double* mem_addr) {
 	__m128dx4 ret;
-	ret.val[0] = _mm_loadu_pd(mem_addr +  0);
-	ret.val[1] = _mm_loadu_pd(mem_addr +  4);
-	ret.val[2] = _mm_loadu_pd(mem_addr +  8);
-	ret.val[3] = _mm_loadu_pd(mem_addr + 12);
+	ret.val[0] = _mm_loadu_pd(mem_addr + 0);
+	ret.val[1] = _mm_loadu_pd(mem_addr + 2);
+	ret.val[2] = _mm_loadu_pd(mem_addr + 4);
+	ret.val[3] = _mm_loadu_pd(mem_addr + 6);
 	return ret;
 }
 
@@ -273,31 +282,30 @@ static inline __m128dx4 _mm128x4_loadu_raw_pd(const double* mem_addr) {
 // __m128dx4 store operations
 //------------------------------------------------------------------------------
 
-#if 0
-/* Unimplemented */
-
 /**
- * @note mem_addr must be aligned on a 32-byte boundary or a general-protection
+ * @brief Stores two Float64x4 values.
+ * @note mem_addr must be aligned on a 16-byte boundary or a general-protection
  * exception may be generated.
  */
 static inline void _mm128x4_store_pd(double* mem_addr, __m128dx4 src) {
-	src = _mm128x4_transpose_pdx4(src);
-	_mm_store_pd(mem_addr +  0, src.val[0]);
-	_mm_store_pd(mem_addr +  4, src.val[1]);
-	_mm_store_pd(mem_addr +  8, src.val[2]);
-	_mm_store_pd(mem_addr + 12, src.val[3]);
+	_mm_store_pd(mem_addr + 0, _mm_unpacklo_pd(src.val[0], src.val[1]));
+	_mm_store_pd(mem_addr + 2, _mm_unpacklo_pd(src.val[2], src.val[3]));
+	_mm_store_pd(mem_addr + 4, _mm_unpackhi_pd(src.val[0], src.val[1]));
+	_mm_store_pd(mem_addr + 6, _mm_unpackhi_pd(src.val[2], src.val[3]));
 }
 
+/**
+ * @brief Stores two Float64x4 values.
+ */
 static inline void _mm128x4_storeu_pd(double* mem_addr, __m128dx4 src) {
-	src = _mm128x4_transpose_pdx4(src);
-	_mm_storeu_pd(mem_addr +  0, src.val[0]);
-	_mm_storeu_pd(mem_addr +  4, src.val[1]);
-	_mm_storeu_pd(mem_addr +  8, src.val[2]);
-	_mm_storeu_pd(mem_addr + 12, src.val[3]);
+	_mm_storeu_pd(mem_addr + 0, _mm_unpacklo_pd(src.val[0], src.val[1]));
+	_mm_storeu_pd(mem_addr + 2, _mm_unpacklo_pd(src.val[2], src.val[3]));
+	_mm_storeu_pd(mem_addr + 4, _mm_unpackhi_pd(src.val[0], src.val[1]));
+	_mm_storeu_pd(mem_addr + 6, _mm_unpackhi_pd(src.val[2], src.val[3]));
 }
 
 /**
- * @note mem_addr must be aligned on a 32-byte boundary or a general-protection
+ * @note mem_addr must be aligned on a 16-byte boundary or a general-protection
  * exception may be generated.
  */
 static inline void _mm128x4_store_pdx4(Float64x4* mem_addr, __m128dx4 src) {
@@ -308,24 +316,22 @@ static inline void _mm128x4_storeu_pdx4(Float64x4* mem_addr, __m128dx4 src) {
 	_mm128x4_storeu_pd((double*)((void*)mem_addr), src);
 }
 
-#endif
-
 /**
- * @note mem_addr must be aligned on a 32-byte boundary or a general-protection
+ * @note mem_addr must be aligned on a 16-byte boundary or a general-protection
  * exception may be generated.
  */
 static inline void _mm_store_raw_pdx4(double* mem_addr, __m128dx4 src) {
-	_mm_store_pd(mem_addr +  0, src.val[0]);
-	_mm_store_pd(mem_addr +  4, src.val[1]);
-	_mm_store_pd(mem_addr +  8, src.val[2]);
-	_mm_store_pd(mem_addr + 12, src.val[3]);
+	_mm_store_pd(mem_addr + 0, src.val[0]);
+	_mm_store_pd(mem_addr + 2, src.val[1]);
+	_mm_store_pd(mem_addr + 4, src.val[2]);
+	_mm_store_pd(mem_addr + 6, src.val[3]);
 }
 
 static inline void _mm_storeu_raw_pdx4(double* mem_addr, __m128dx4 src) {
-	_mm_storeu_pd(mem_addr +  0, src.val[0]);
-	_mm_storeu_pd(mem_addr +  4, src.val[1]);
-	_mm_storeu_pd(mem_addr +  8, src.val[2]);
-	_mm_storeu_pd(mem_addr + 12, src.val[3]);
+	_mm_storeu_pd(mem_addr + 0, src.val[0]);
+	_mm_storeu_pd(mem_addr + 2, src.val[1]);
+	_mm_storeu_pd(mem_addr + 4, src.val[2]);
+	_mm_storeu_pd(mem_addr + 6, src.val[3]);
 }
 
 //------------------------------------------------------------------------------
@@ -1103,29 +1109,37 @@ static inline __m128d _mm_two_diff_pd(const __m128d x, const __m128d y, __m128d*
 /** @brief Computes fl(x * y) and err(x * y). */
 static inline __m128d _mm_two_prod_pd(const __m128d x, const __m128d y, __m128d* LDF_restrict const err) {
 	__m128d p = _mm_mul_pd(x, y);
-	__m128dx2 a = _mm128x2_dekker_split_pd(x);
-	__m128dx2 b = _mm128x2_dekker_split_pd(y);
-	*err = _mm_add_pd(
-		_mm_add_pd(
+	#ifdef LDF_ENABLE_FMA_SIMD
+		*err = _mm_fmsub_pd(x, y, p);
+	#else
+		__m128dx2 a = _mm128x2_dekker_split_pd(x);
+		__m128dx2 b = _mm128x2_dekker_split_pd(y);
+		*err = _mm_add_pd(
 			_mm_add_pd(
-				_mm_sub_pd(_mm_mul_pd(a.hi, b.hi), p),
-				_mm_mul_pd(a.hi, b.lo)
-			), _mm_mul_pd(a.lo, b.hi)
-		), _mm_mul_pd(a.lo, b.lo)
-	);
+				_mm_add_pd(
+					_mm_sub_pd(_mm_mul_pd(a.hi, b.hi), p),
+					_mm_mul_pd(a.hi, b.lo)
+				), _mm_mul_pd(a.lo, b.hi)
+			), _mm_mul_pd(a.lo, b.lo)
+		);
+	#endif
 	return p;
 }
 
 /** @brief Computes fl(x * x) and err(x * x). Faster than _mm_two_prod_pd(x, x, err) */
 static inline __m128d _mm_two_sqr_pd(const __m128d x, __m128d* LDF_restrict const err) {
 	__m128d q = _mm_mul_pd(x, x);
-	__m128dx2 a = _mm128x2_dekker_split_pd(x);
-	*err = _mm_add_pd(
-		_mm_add_pd(
-			_mm_sub_pd(_mm_mul_pd(a.hi, a.hi), q),
-			_mm_mul_pd(_mm_set1_pd(2.0), _mm_mul_pd(a.hi, a.lo))
-		), _mm_mul_pd(a.lo, a.lo)
-	);
+	#ifdef LDF_ENABLE_FMA_SIMD
+		*err = _mm_fmsub_pd(x, x, q);
+	#else
+		__m128dx2 a = _mm128x2_dekker_split_pd(x);
+		*err = _mm_add_pd(
+			_mm_add_pd(
+				_mm_sub_pd(_mm_mul_pd(a.hi, a.hi), q),
+				_mm_mul_pd(_mm_set1_pd(2.0), _mm_mul_pd(a.hi, a.lo))
+			), _mm_mul_pd(a.lo, a.lo)
+		);
+	#endif
 	return q;
 }
 
@@ -3222,17 +3236,14 @@ static inline __m128dx4 _mm128x4_const_phi_pdx4(void) {
 static inline __m128dx4 _mm128x4_fmax_pdx4(__m128dx4 x, __m128dx4 y) {
 	__m128d fmax_cmp =
 		_mm_or_pd(
-			_mm_andnot_pd(
-				_mm_or_pd(
-					_mm_andnot_pd(
-						_mm_signbit_pdx4(x),
-						_mm_isnan_pdx4(y)
-					),
-					_mm_isnan_pdx4(x)
-				),
-				_mm_cmplt_pdx4(y, x)
+			_mm_or_pd(
+				_mm_cmplt_pdx4(x, y),
+				_mm_isnan_pdx4(x)
 			),
-			_mm_cmplt_pdx4(x, y)
+			_mm_and_pd(
+				_mm_signbit_pdx4(x),
+				_mm_cmpeq_pdx4(x, y)
+			)
 		);
 	__m128dx4 ret;
 	ret.val[0] = _internal_mm_blendv_pd(x.val[0], y.val[0], fmax_cmp);
@@ -3249,17 +3260,14 @@ static inline __m128dx4 _mm128x4_fmax_pdx4(__m128dx4 x, __m128dx4 y) {
 static inline __m128dx4 _mm128x4_fmin_pdx4(__m128dx4 x, __m128dx4 y) {
 	__m128d fmin_cmp =
 		_mm_or_pd(
-			_mm_andnot_pd(
-				_mm_or_pd(
-					_mm_andnot_pd(
-						_mm_signbit_pdx4(x),
-						_mm_isnan_pdx4(y)
-					),
-					_mm_isnan_pdx4(x)
-				),
-				_mm_cmpgt_pdx4(y, x)
+			_mm_or_pd(
+				_mm_cmpgt_pdx4(x, y),
+				_mm_isnan_pdx4(x)
 			),
-			_mm_cmpgt_pdx4(x, y)
+			_mm_andnot_pd(
+				_mm_signbit_pdx4(x),
+				_mm_cmpeq_pdx4(x, y)
+			)
 		);
 	__m128dx4 ret;
 	ret.val[0] = _internal_mm_blendv_pd(x.val[0], y.val[0], fmin_cmp);
@@ -3293,43 +3301,48 @@ static inline __m128dx4 _mm128x4_min_pdx4(__m128dx4 x, __m128dx4 y) {
 // __m128dx4 rounding functions
 //------------------------------------------------------------------------------
 
-#ifdef __SSE4_1__
-
 static inline __m128dx4 _mm128x4_trunc_pdx4(__m128dx4 x) {
-	__m128dx4 ret = {{
-		_mm_trunc_pd(x.val[0]),
-		_mm_trunc_pd(x.val[1]),
-		_mm_trunc_pd(x.val[2]),
-		_mm_trunc_pd(x.val[3]),
-	}};
+	__m128dx4 ret;
+	ret.val[0] = _mm_trunc_pd(x.val[0]);
+	// lower limbs are only rounded when the higher limbs are integers
+	__m128d cmp_int = _mm_cmpeq_pd(ret.val[0], x.val[0]);
+	ret.val[1] = _mm_and_pd(_mm_trunc_pd(x.val[1]), cmp_int);
+	cmp_int = _mm_and_pd(cmp_int, _mm_cmpeq_pd(ret.val[1], x.val[1]));
+	ret.val[2] = _mm_and_pd(_mm_trunc_pd(x.val[2]), cmp_int);
+	cmp_int = _mm_and_pd(cmp_int, _mm_cmpeq_pd(ret.val[2], x.val[2]));
+	ret.val[3] = _mm_and_pd(_mm_trunc_pd(x.val[3]), cmp_int);
 	_mm128x4_renorm_pdx4(&ret);
 	return ret;
 }
 
 static inline __m128dx4 _mm128x4_floor_pdx4(__m128dx4 x) {
-	__m128dx4 ret = {{
-		_mm_floor_pd(x.val[0]),
-		_mm_floor_pd(x.val[1]),
-		_mm_floor_pd(x.val[2]),
-		_mm_floor_pd(x.val[3]),
-	}};
+	__m128dx4 ret;
+	ret.val[0] = _mm_floor_pd(x.val[0]);
+	// lower limbs are only rounded when the higher limbs are integers
+	__m128d cmp_int = _mm_cmpeq_pd(ret.val[0], x.val[0]);
+	ret.val[1] = _mm_and_pd(_mm_floor_pd(x.val[1]), cmp_int);
+	cmp_int = _mm_and_pd(cmp_int, _mm_cmpeq_pd(ret.val[1], x.val[1]));
+	ret.val[2] = _mm_and_pd(_mm_floor_pd(x.val[2]), cmp_int);
+	cmp_int = _mm_and_pd(cmp_int, _mm_cmpeq_pd(ret.val[2], x.val[2]));
+	ret.val[3] = _mm_and_pd(_mm_floor_pd(x.val[3]), cmp_int);
 	_mm128x4_renorm_pdx4(&ret);
 	return ret;
 }
 
 static inline __m128dx4 _mm128x4_ceil_pdx4(__m128dx4 x) {
-	__m128dx4 ret = {{
-		_mm_ceil_pd(x.val[0]),
-		_mm_ceil_pd(x.val[1]),
-		_mm_ceil_pd(x.val[2]),
-		_mm_ceil_pd(x.val[3]),
-	}};
+	__m128dx4 ret;
+	ret.val[0] = _mm_ceil_pd(x.val[0]);
+	// lower limbs are only rounded when the higher limbs are integers
+	__m128d cmp_int = _mm_cmpeq_pd(ret.val[0], x.val[0]);
+	ret.val[1] = _mm_and_pd(_mm_ceil_pd(x.val[1]), cmp_int);
+	cmp_int = _mm_and_pd(cmp_int, _mm_cmpeq_pd(ret.val[1], x.val[1]));
+	ret.val[2] = _mm_and_pd(_mm_ceil_pd(x.val[2]), cmp_int);
+	cmp_int = _mm_and_pd(cmp_int, _mm_cmpeq_pd(ret.val[2], x.val[2]));
+	ret.val[3] = _mm_and_pd(_mm_ceil_pd(x.val[3]), cmp_int);
 	_mm128x4_renorm_pdx4(&ret);
 	return ret;
 }
 
-#endif
-
 //------------------------------------------------------------------------------
 // __m128dx4 math.h functions
 //------------------------------------------------------------------------------
@@ -3419,8 +3432,6 @@ static inline __m128dx4 _mm128x4_cbrt_pdx4(__m128dx4 x) {
 
 #endif
 
-#ifdef __SSE4_1__
-
 /**
 * @brief returns the fraction part of a Float64x4 value. int_part may be NULL
 */
@@ -3437,14 +3448,10 @@ static inline __m128dx4 _mm128x4_fmod_pdx4(const __m128dx4 x, const __m128dx4 y)
 	return _mm128x4_sub_pdx4(x, _mm128x4_mul_pdx4(y, trunc_part));
 }
 
-#endif
-
 //------------------------------------------------------------------------------
 // __m128dx4 ilogb
 //------------------------------------------------------------------------------
 
-#if defined(__SSE4_1__) && defined(__SSE4_2__)
-
 /**
  * @brief Computes ilogb(x) on a __m128dx4 value
  * @returns __m128i int64_t
@@ -3453,7 +3460,13 @@ static inline __m128i _mm128x4_ilogb_pdx4_epi64(__m128dx4 x) {
 	return _mm_ilogb_pd_epi64(x.val[0]);
 }
 
-#endif
+/**
+ * @brief Computes ilogb(x) on a __m128dx4 value
+ * @returns int32_t in the lower two elements of a __m128i
+ */
+static inline __m128i _mm128x4_ilogb_pdx4_epi32(__m128dx4 x) {
+	return _mm_ilogb_pd_epi32(x.val[0]);
+}
 
 //------------------------------------------------------------------------------
 // __m128dx4 ldexp
@@ -3474,6 +3487,18 @@ static inline __m128dx4 _mm128x4_ldexp_pdx4_epi64(__m128dx4 x, __m128i expon) {
 
 #endif
 
+/**
+ * @brief Computes ldexp(x, expon)
+ * @note expon is read from the lower two int32_t elements of the __m128i
+ */
+static inline __m128dx4 _mm128x4_ldexp_pdx4_epi32(__m128dx4 x, __m128i expon) {
+	x.val[0] = _mm_ldexp_pd_epi32(x.val[0], expon);
+	x.val[1] = _mm_ldexp_pd_epi32(x.val[1], expon);
+	x.val[2] = _mm_ldexp_pd_epi32(x.val[2], expon);
+	x.val[3] = _mm_ldexp_pd_epi32(x.val[3], expon);
+	return x;
+}
+
 //------------------------------------------------------------------------------
 // __m128dx4 frexp
 //------------------------------------------------------------------------------
@@ -3486,7 +3511,7 @@ static inline __m128dx4 _mm128x4_ldexp_pdx4_epi64(__m128dx4 x, __m128i expon) {
  */
 static inline __m128dx4 _mm128x4_frexp_pdx4_epi64(__m128dx4 x, __m128i* const expon) {
 	x.val[0] = _mm_frexp_pd_epi64(x.val[0], expon);
-	const __m128i ldexp_value = _mm_sub_epi64(_mm_set1_epi64x((int64_t)1), *expon);
+	const __m128i ldexp_value = _mm_sub_epi64(_mm_setzero_si128(), *expon);
 	x.val[1] = _mm_ldexp_pd_epi64(x.val[1], ldexp_value);
 	x.val[2] = _mm_ldexp_pd_epi64(x.val[2], ldexp_value);
 	x.val[3] = _mm_ldexp_pd_epi64(x.val[3], ldexp_value);
@@ -3495,6 +3520,148 @@ static inline __m128dx4 _mm128x4_frexp_pdx4_epi64(__m128dx4 x, __m128i* const ex
 
 #endif
 
+/**
+ * @brief Computes frexp(x, expon) on a __m128dx4 value
+ * @note expon is stored in the lower two int32_t elements of the __m128i
+ */
+static inline __m128dx4 _mm128x4_frexp_pdx4_epi32(__m128dx4 x, __m128i* const expon) {
+	x.val[0] = _mm_frexp_pd_epi32(x.val[0], expon);
+	const __m128i ldexp_value = _mm_sub_epi32(_mm_setzero_si128(), *expon);
+	x.val[1] = _mm_ldexp_pd_epi32(x.val[1], ldexp_value);
+	x.val[2] = _mm_ldexp_pd_epi32(x.val[2], ldexp_value);
+	x.val[3] = _mm_ldexp_pd_epi32(x.val[3], ldexp_value);
+	return x;
+}
+
+//------------------------------------------------------------------------------
+// __m128dx4 exponents and logarithms
+//------------------------------------------------------------------------------
+
+__m128dx4 _mm128x4_exp_pdx4(__m128dx4 x);
+
+__m128dx4 _mm128x4_expm1_pdx4(__m128dx4 x);
+
+static inline __m128dx4 _mm128x4_exp2_pdx4(const __m128dx4 a) {
+	return _mm128x4_exp_pdx4(_mm128x4_mul_pdx4(a, _mm128x4_const_ln2_pdx4()));
+}
+
+static inline __m128dx4 _mm128x4_exp10_pdx4(const __m128dx4 a) {
+	return _mm128x4_exp_pdx4(_mm128x4_mul_pdx4(a, _mm128x4_const_ln10_pdx4()));
+}
+
+/** @note The initial guess is calculated with _mm128x2_log1p_pdx2 */
+__m128dx4 _mm128x4_log_pdx4(__m128dx4 x);
+
+__m128dx4 _mm128x4_log1p_pdx4(__m128dx4 x);
+
+static inline __m128dx4 _mm128x4_log2_pdx4(const __m128dx4 x) {
+	return _mm128x4_mul_pdx4(_mm128x4_log_pdx4(x), _mm128x4_const_log2e_pdx4());
+}
+
+static inline __m128dx4 _mm128x4_log10_pdx4(const __m128dx4 x) {
+	return _mm128x4_mul_pdx4(_mm128x4_log_pdx4(x), _mm128x4_const_log10e_pdx4());
+}
+
+__m128dx4 _mm128x4_pow_pdx4(__m128dx4 x, __m128dx4 y);
+
+__m128dx4 _mm128x4_pow_pdx4_pd(__m128dx4 x, __m128d y);
+
+//------------------------------------------------------------------------------
+// __m128dx4 trigonometry
+//------------------------------------------------------------------------------
+
+__m128dx4 _mm128x4_sin_pdx4(__m128dx4 x);
+
+__m128dx4 _mm128x4_cos_pdx4(__m128dx4 x);
+
+/**
+ * @warning p_sin and p_cos must be aligned on a 16-byte boundary or a
+ * general-protection exception may be generated.
+ */
+void _mm128x4_sincos_pdx4(
+	__m128dx4 theta, __m128dx4* p_sin, __m128dx4* p_cos
+);
+
+static inline __m128dx4 _mm128x4_tan_pdx4(__m128dx4 x) {
+	__m128dx4 t_sin, t_cos;
+	_mm128x4_sincos_pdx4(x, &t_sin, &t_cos);
+	return _mm128x4_div_pdx4(t_sin, t_cos);
+}
+
+__m128dx4 _mm128x4_asin_pdx4(__m128dx4 x);
+
+__m128dx4 _mm128x4_acos_pdx4(__m128dx4 x);
+
+__m128dx4 _mm128x4_atan_pdx4(__m128dx4 x);
+
+/** @note The initial guess is calculated with _mm128x2_atan2_pdx2 */
+__m128dx4 _mm128x4_atan2_pdx4(__m128dx4 y, __m128dx4 x);
+
+__m128dx4 _mm128x4_sinh_pdx4(__m128dx4 x);
+
+__m128dx4 _mm128x4_cosh_pdx4(__m128dx4 x);
+
+__m128dx4 _mm128x4_tanh_pdx4(__m128dx4 x);
+
+/**
+ * @warning p_sinh and p_cosh must be aligned on a 16-byte boundary or a
+ * general-protection exception may be generated.
+ */
+void _mm128x4_sinhcosh_pdx4(
+	__m128dx4 theta, __m128dx4* p_sinh, __m128dx4* p_cosh
+);
+
+/**
+ * @brief asinh(|x|) = log1p(|x| + x^2 / (1 + sqrt(x^2 + 1)))
+ * @note log1p(2|x|) is used when x^2 would overflow
+ */
+static inline __m128dx4 _mm128x4_asinh_pdx4(__m128dx4 x) {
+	const __m128dx4 abs_x = _mm128x4_fabs_pdx4(x);
+	const __m128dx4 x_squared = _mm128x4_square_pdx4(x);
+	__m128dx4 arg = _mm128x4_add_pdx4(abs_x,
+		_mm128x4_div_pdx4(x_squared, _mm128x4_add_pd_pdx4(_mm_set1_pd(1.0),
+			_mm128x4_sqrt_pdx4(_mm128x4_add_pdx4_pd(x_squared, _mm_set1_pd(1.0)))
+		))
+	);
+	const __m128d x_huge = _mm_cmpgt_pd(abs_x.val[0], _mm_set1_pd(0x1.0p+500));
+	const __m128dx4 arg_huge = _mm128x4_mul_power2_pdx4_pd(abs_x, _mm_set1_pd(2.0));
+	arg.val[0] = _internal_mm_blendv_pd(arg.val[0], arg_huge.val[0], x_huge);
+	arg.val[1] = _internal_mm_blendv_pd(arg.val[1], arg_huge.val[1], x_huge);
+	arg.val[2] = _internal_mm_blendv_pd(arg.val[2], arg_huge.val[2], x_huge);
+	arg.val[3] = _internal_mm_blendv_pd(arg.val[3], arg_huge.val[3], x_huge);
+	return _mm128x4_copysign_pdx4(_mm128x4_log1p_pdx4(arg), x);
+}
+
+/**
+ * @brief acosh(x) = log1p((x - 1) + sqrt((x - 1) * (x + 1)))
+ * @note log1p(2x) is used when x^2 would overflow
+ */
+static inline __m128dx4 _mm128x4_acosh_pdx4(__m128dx4 x) {
+	const __m128dx4 x_m1 = _mm128x4_sub_pdx4_pd(x, _mm_set1_pd(1.0));
+	__m128dx4 arg = _mm128x4_add_pdx4(x_m1,
+		_mm128x4_sqrt_pdx4(_mm128x4_mul_pdx4(
+			x_m1, _mm128x4_add_pdx4_pd(x, _mm_set1_pd(1.0))
+		))
+	);
+	const __m128d x_huge = _mm_cmpgt_pd(x.val[0], _mm_set1_pd(0x1.0p+500));
+	const __m128dx4 arg_huge = _mm128x4_mul_power2_pdx4_pd(x, _mm_set1_pd(2.0));
+	arg.val[0] = _internal_mm_blendv_pd(arg.val[0], arg_huge.val[0], x_huge);
+	arg.val[1] = _internal_mm_blendv_pd(arg.val[1], arg_huge.val[1], x_huge);
+	arg.val[2] = _internal_mm_blendv_pd(arg.val[2], arg_huge.val[2], x_huge);
+	arg.val[3] = _internal_mm_blendv_pd(arg.val[3], arg_huge.val[3], x_huge);
+	return _mm128x4_log1p_pdx4(arg);
+}
+
+/**
+ * @brief atanh(x) = log1p(2x / (1 - x)) / 2
+ */
+static inline __m128dx4 _mm128x4_atanh_pdx4(__m128dx4 x) {
+	return _mm128x4_mul_power2_pdx4_pd(_mm128x4_log1p_pdx4(_mm128x4_div_pdx4(
+			_mm128x4_mul_power2_pdx4_pd(x, _mm_set1_pd(2.0)),
+			_mm128x4_sub_pd_pdx4(_mm_set1_pd(1.0), x)
+	)), _mm_set1_pd(0.5));
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,137 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "Float64x4_array.h"
+#include "Float64x4_array_kernels.h"
+#include "Float64x4.h"
+
+//------------------------------------------------------------------------------
+// Float64x4 dispatch
+//------------------------------------------------------------------------------
+
+/** Indexed by LDF_cpu_level. NULL for the scalar level and disabled levels. */
+static const Float64x4_array_kernels* const
+Float64x4_array_levels[LDF_CPU_LEVEL_COUNT] = {
+	NULL,
+	#ifdef LDF_ENABLE_DISPATCH_SSE2
+		&Float64x4_array_kernels_SSE2,
+	#else
+		NULL,
+	#endif
+	#ifdef LDF_ENABLE_DISPATCH_AVX
+		&Float64x4_array_kernels_AVX,
+	#else
+		NULL,
+	#endif
+	#ifdef LDF_ENABLE_DISPATCH_AVX2_FMA
+		&Float64x4_array_kernels_AVX2_FMA,
+	#else
+		NULL,
+	#endif
+	#ifdef LDF_ENABLE_DISPATCH_AVX512
+		&Float64x4_array_kernels_AVX512,
+	#else
+		NULL,
+	#endif
+};
+
+/**
+ * @brief Calls the kernel from the highest supported level that implements
+ * it, and returns. Otherwise the caller falls through to its scalar loop.
+ */
+#define FLOAT64X4_ARRAY_DISPATCH(kernel, ...) \
+	for (int level = (int)LDF_cpu_get_level(); level > 0; level--) { \
+		const Float64x4_array_kernels* table = Float64x4_array_levels[level]; \
+		if (table != NULL && table->kernel != NULL) { \
+			table->kernel(__VA_ARGS__); \
+			return; \
+		} \
+	}
+
+#define FLOAT64X4_ARRAY_UNARY(name, func) \
+void Float64x4_##name##_array(const Float64x4* in, Float64x4* out, size_t n) { \
+	FLOAT64X4_ARRAY_DISPATCH(name##_array, in, out, n) \
+	for (size_t i = 0; i < n; i++) { \
+		out[i] = func(in[i]); \
+	} \
+}
+
+#define FLOAT64X4_ARRAY_BINARY(name, func) \
+void Float64x4_##name##_array( \
+	const Float64x4* x, const Float64x4* y, Float64x4* out, size_t n \
+) { \
+	FLOAT64X4_ARRAY_DISPATCH(name##_array, x, y, out, n) \
+	for (size_t i = 0; i < n; i++) { \
+		out[i] = func(x[i], y[i]); \
+	} \
+}
+
+#define FLOAT64X4_ARRAY_SCALAR_UNARY(name, func) \
+void Float64x4_##name##_array(const Float64x4* in, Float64x4* out, size_t n) { \
+	for (size_t i = 0; i < n; i++) { \
+		out[i] = func(in[i]); \
+	} \
+}
+
+#define FLOAT64X4_ARRAY_SCALAR_BINARY(name, func) \
+void Float64x4_##name##_array( \
+	const Float64x4* x, const Float64x4* y, Float64x4* out, size_t n \
+) { \
+	for (size_t i = 0; i < n; i++) { \
+		out[i] = func(x[i], y[i]); \
+	} \
+}
+
+//------------------------------------------------------------------------------
+// Float64x4 array functions
+//------------------------------------------------------------------------------
+
+FLOAT64X4_ARRAY_BINARY(add, Float64x4_add)
+FLOAT64X4_ARRAY_BINARY(sub, Float64x4_sub)
+FLOAT64X4_ARRAY_BINARY(mul, Float64x4_mul)
+FLOAT64X4_ARRAY_BINARY(div, Float64x4_div)
+FLOAT64X4_ARRAY_BINARY(copysign, Float64x4_copysign)
+FLOAT64X4_ARRAY_BINARY(fdim, Float64x4_fdim)
+FLOAT64X4_ARRAY_BINARY(fmod, Float64x4_fmod)
+FLOAT64X4_ARRAY_SCALAR_BINARY(remainder, Float64x4_remainder)
+FLOAT64X4_ARRAY_BINARY(pow, Float64x4_pow)
+FLOAT64X4_ARRAY_BINARY(atan2, Float64x4_atan2)
+FLOAT64X4_ARRAY_UNARY(fabs, Float64x4_fabs)
+FLOAT64X4_ARRAY_UNARY(sqrt, Float64x4_sqrt)
+FLOAT64X4_ARRAY_UNARY(cbrt, Float64x4_cbrt)
+FLOAT64X4_ARRAY_UNARY(exp, Float64x4_exp)
+FLOAT64X4_ARRAY_UNARY(exp2, Float64x4_exp2)
+FLOAT64X4_ARRAY_UNARY(exp10, Float64x4_exp10)
+FLOAT64X4_ARRAY_UNARY(expm1, Float64x4_expm1)
+FLOAT64X4_ARRAY_UNARY(log, Float64x4_log)
+FLOAT64X4_ARRAY_UNARY(log2, Float64x4_log2)
+FLOAT64X4_ARRAY_UNARY(log10, Float64x4_log10)
+FLOAT64X4_ARRAY_UNARY(log1p, Float64x4_log1p)
+FLOAT64X4_ARRAY_UNARY(sin, Float64x4_sin)
+FLOAT64X4_ARRAY_UNARY(cos, Float64x4_cos)
+FLOAT64X4_ARRAY_UNARY(tan, Float64x4_tan)
+FLOAT64X4_ARRAY_UNARY(asin, Float64x4_asin)
+FLOAT64X4_ARRAY_UNARY(acos, Float64x4_acos)
+FLOAT64X4_ARRAY_UNARY(atan, Float64x4_atan)
+FLOAT64X4_ARRAY_UNARY(sinh, Float64x4_sinh)
+FLOAT64X4_ARRAY_UNARY(cosh, Float64x4_cosh)
+FLOAT64X4_ARRAY_UNARY(tanh, Float64x4_tanh)
+FLOAT64X4_ARRAY_UNARY(asinh, Float64x4_asinh)
+FLOAT64X4_ARRAY_UNARY(acosh, Float64x4_acosh)
+FLOAT64X4_ARRAY_UNARY(atanh, Float64x4_atanh)
+FLOAT64X4_ARRAY_UNARY(floor, Float64x4_floor)
+FLOAT64X4_ARRAY_UNARY(ceil, Float64x4_ceil)
+FLOAT64X4_ARRAY_UNARY(trunc, Float64x4_trunc)
+FLOAT64X4_ARRAY_SCALAR_UNARY(round, Float64x4_round)
+FLOAT64X4_ARRAY_SCALAR_UNARY(rint, Float64x4_rint)
+
+#undef FLOAT64X4_ARRAY_DISPATCH
+#undef FLOAT64X4_ARRAY_UNARY
+#undef FLOAT64X4_ARRAY_BINARY
+#undef FLOAT64X4_ARRAY_SCALAR_UNARY
+#undef FLOAT64X4_ARRAY_SCALAR_BINARY
@@ -0,0 +1,340 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#ifndef FLOAT64X4_ARRAY_H
+#define FLOAT64X4_ARRAY_H
+
+/**
+ * @brief Element-wise functions over arrays of Float64x4.
+ *
+ * The SSE2, AVX, AVX2+FMA, or AVX512 implementation is selected at runtime
+ * with LDF_cpu_get_level() from LDF/LDF_cpu_dispatch.h, so the library does
+ * not need to be compiled with -mavx to use AVX. Functions without a SIMD
+ * implementation, and the tail of each array, use the scalar functions.
+ *
+ * @note The arrays do not need to be aligned. Arrays aligned to 64 bytes
+ * are faster. `out` may be the same array as an input, but the arrays must
+ * not otherwise overlap.
+ *
+ * @note Each Float64x4_array_<ISA>.c file targets its own instruction set
+ * with `#pragma GCC target` on GCC. Other compilers need to compile those
+ * files with the matching flags (-mavx, -mavx2 -mfma, -mavx512f), along with
+ * Float64x4/Float64x4_SSE2.c and Float64x4/Float64x4_AVX.c.
+ */
+
+#include "Float64x4_def.h"
+#include "../LDF/LDF_cpu_dispatch.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+//------------------------------------------------------------------------------
+// Float64x4 array arithmetic
+//------------------------------------------------------------------------------
+
+/** @brief out[i] = x[i] + y[i] */
+void Float64x4_add_array(
+	const Float64x4* x, const Float64x4* y, Float64x4* out, size_t n
+);
+
+/** @brief out[i] = x[i] - y[i] */
+void Float64x4_sub_array(
+	const Float64x4* x, const Float64x4* y, Float64x4* out, size_t n
+);
+
+/** @brief out[i] = x[i] * y[i] */
+void Float64x4_mul_array(
+	const Float64x4* x, const Float64x4* y, Float64x4* out, size_t n
+);
+
+/** @brief out[i] = x[i] / y[i] */
+void Float64x4_div_array(
+	const Float64x4* x, const Float64x4* y, Float64x4* out, size_t n
+);
+
+//------------------------------------------------------------------------------
+// Float64x4 array math.h functions
+//------------------------------------------------------------------------------
+
+/** @brief out[i] = copysign(x[i], y[i]) */
+void Float64x4_copysign_array(
+	const Float64x4* x, const Float64x4* y, Float64x4* out, size_t n
+);
+
+/** @brief out[i] = fdim(x[i], y[i]) */
+void Float64x4_fdim_array(
+	const Float64x4* x, const Float64x4* y, Float64x4* out, size_t n
+);
+
+/** @brief out[i] = fmod(x[i], y[i]) */
+void Float64x4_fmod_array(
+	const Float64x4* x, const Float64x4* y, Float64x4* out, size_t n
+);
+
+/** @brief out[i] = remainder(x[i], y[i]) */
+void Float64x4_remainder_array(
+	const Float64x4* x, const Float64x4* y, Float64x4* out, size_t n
+);
+
+/** @brief out[i] = fabs(in[i]) */
+void Float64x4_fabs_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = sqrt(in[i]) */
+void Float64x4_sqrt_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = cbrt(in[i]) */
+void Float64x4_cbrt_array(const Float64x4* in, Float64x4* out, size_t n);
+
+//------------------------------------------------------------------------------
+// Float64x4 array exponents and logarithms
+//------------------------------------------------------------------------------
+
+/** @brief out[i] = pow(x[i], y[i]) */
+void Float64x4_pow_array(
+	const Float64x4* x, const Float64x4* y, Float64x4* out, size_t n
+);
+
+/** @brief out[i] = exp(in[i]) */
+void Float64x4_exp_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = exp2(in[i]) */
+void Float64x4_exp2_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = exp10(in[i]) */
+void Float64x4_exp10_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = expm1(in[i]) */
+void Float64x4_expm1_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = log(in[i]) */
+void Float64x4_log_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = log2(in[i]) */
+void Float64x4_log2_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = log10(in[i]) */
+void Float64x4_log10_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = log1p(in[i]) */
+void Float64x4_log1p_array(const Float64x4* in, Float64x4* out, size_t n);
+
+//------------------------------------------------------------------------------
+// Float64x4 array trigonometry
+//------------------------------------------------------------------------------
+
+/** @brief out[i] = atan2(y[i], x[i]) */
+void Float64x4_atan2_array(
+	const Float64x4* y, const Float64x4* x, Float64x4* out, size_t n
+);
+
+/** @brief out[i] = sin(in[i]) */
+void Float64x4_sin_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = cos(in[i]) */
+void Float64x4_cos_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = tan(in[i]) */
+void Float64x4_tan_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = asin(in[i]) */
+void Float64x4_asin_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = acos(in[i]) */
+void Float64x4_acos_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = atan(in[i]) */
+void Float64x4_atan_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = sinh(in[i]) */
+void Float64x4_sinh_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = cosh(in[i]) */
+void Float64x4_cosh_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = tanh(in[i]) */
+void Float64x4_tanh_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = asinh(in[i]) */
+void Float64x4_asinh_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = acosh(in[i]) */
+void Float64x4_acosh_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = atanh(in[i]) */
+void Float64x4_atanh_array(const Float64x4* in, Float64x4* out, size_t n);
+
+//------------------------------------------------------------------------------
+// Float64x4 array rounding
+//------------------------------------------------------------------------------
+
+/** @brief out[i] = floor(in[i]) */
+void Float64x4_floor_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = ceil(in[i]) */
+void Float64x4_ceil_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = trunc(in[i]) */
+void Float64x4_trunc_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = round(in[i]) */
+void Float64x4_round_array(const Float64x4* in, Float64x4* out, size_t n);
+
+/** @brief out[i] = rint(in[i]) */
+void Float64x4_rint_array(const Float64x4* in, Float64x4* out, size_t n);
+
+#ifdef __cplusplus
+	}
+#endif
+
+#ifdef __cplusplus
+
+//------------------------------------------------------------------------------
+// Float64x4 array C++ overloads
+//------------------------------------------------------------------------------
+
+inline void add_array(
+	const Float64x4* x, const Float64x4* y, Float64x4* out, size_t n
+) {
+	Float64x4_add_array(x, y, out, n);
+}
+inline void sub_array(
+	const Float64x4* x, const Float64x4* y, Float64x4* out, size_t n
+) {
+	Float64x4_sub_array(x, y, out, n);
+}
+inline void mul_array(
+	const Float64x4* x, const Float64x4* y, Float64x4* out, size_t n
+) {
+	Float64x4_mul_array(x, y, out, n);
+}
+inline void div_array(
+	const Float64x4* x, const Float64x4* y, Float64x4* out, size_t n
+) {
+	Float64x4_div_array(x, y, out, n);
+}
+inline void copysign_array(
+	const Float64x4* x, const Float64x4* y, Float64x4* out, size_t n
+) {
+	Float64x4_copysign_array(x, y, out, n);
+}
+inline void fdim_array(
+	const Float64x4* x, const Float64x4* y, Float64x4* out, size_t n
+) {
+	Float64x4_fdim_array(x, y, out, n);
+}
+inline void fmod_array(
+	const Float64x4* x, const Float64x4* y, Float64x4* out, size_t n
+) {
+	Float64x4_fmod_array(x, y, out, n);
+}
+inline void remainder_array(
+	const Float64x4* x, const Float64x4* y, Float64x4* out, size_t n
+) {
+	Float64x4_remainder_array(x, y, out, n);
+}
+inline void pow_array(
+	const Float64x4* x, const Float64x4* y, Float64x4* out, size_t n
+) {
+	Float64x4_pow_array(x, y, out, n);
+}
+inline void atan2_array(
+	const Float64x4* y, const Float64x4* x, Float64x4* out, size_t n
+) {
+	Float64x4_atan2_array(y, x, out, n);
+}
+inline void fabs_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_fabs_array(in, out, n);
+}
+inline void sqrt_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_sqrt_array(in, out, n);
+}
+inline void cbrt_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_cbrt_array(in, out, n);
+}
+inline void exp_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_exp_array(in, out, n);
+}
+inline void exp2_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_exp2_array(in, out, n);
+}
+inline void exp10_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_exp10_array(in, out, n);
+}
+inline void expm1_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_expm1_array(in, out, n);
+}
+inline void log_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_log_array(in, out, n);
+}
+inline void log2_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_log2_array(in, out, n);
+}
+inline void log10_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_log10_array(in, out, n);
+}
+inline void log1p_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_log1p_array(in, out, n);
+}
+inline void sin_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_sin_array(in, out, n);
+}
+inline void cos_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_cos_array(in, out, n);
+}
+inline void tan_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_tan_array(in, out, n);
+}
+inline void asin_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_asin_array(in, out, n);
+}
+inline void acos_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_acos_array(in, out, n);
+}
+inline void atan_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_atan_array(in, out, n);
+}
+inline void sinh_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_sinh_array(in, out, n);
+}
+inline void cosh_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_cosh_array(in, out, n);
+}
+inline void tanh_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_tanh_array(in, out, n);
+}
+inline void asinh_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_asinh_array(in, out, n);
+}
+inline void acosh_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_acosh_array(in, out, n);
+}
+inline void atanh_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_atanh_array(in, out, n);
+}
+inline void floor_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_floor_array(in, out, n);
+}
+inline void ceil_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_ceil_array(in, out, n);
+}
+inline void trunc_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_trunc_array(in, out, n);
+}
+inline void round_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_round_array(in, out, n);
+}
+inline void rint_array(const Float64x4* in, Float64x4* out, size_t n) {
+	Float64x4_rint_array(in, out, n);
+}
+
+#endif
+
+#endif /* FLOAT64X4_ARRAY_H */
@@ -0,0 +1,164 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "../LDF/LDF_cpu_dispatch.h"
+
+/**
+ * @brief AVX kernels for Float64x4_array.h. Also compiled as the AVX2+FMA
+ * kernels by Float64x4_array_AVX2.c, which defines
+ * FLOAT64X4_ARRAY_AVX_KERNELS before including this file.
+ */
+
+#ifndef FLOAT64X4_ARRAY_AVX_KERNELS
+	#ifdef LDF_ENABLE_DISPATCH_AVX
+		#define FLOAT64X4_ARRAY_AVX_KERNELS Float64x4_array_kernels_AVX
+		#if defined(__GNUC__) && !defined(__clang__) && !defined(__AVX__)
+			#pragma GCC target("avx")
+		#endif
+	#endif
+#endif
+
+#ifdef FLOAT64X4_ARRAY_AVX_KERNELS
+
+#include "Float64x4_array_kernels.h"
+#include "Float64x4_AVX.h"
+
+#include <immintrin.h>
+
+//------------------------------------------------------------------------------
+// __m256dx4 array kernels
+//------------------------------------------------------------------------------
+
+/**
+ * @brief The tail is padded to a full __m256dx4 with copies of the last
+ * element, so that it is computed the same way as the rest of the array.
+ */
+#define FLOAT64X4_ARRAY_AVX_UNARY(name, func) \
+static void name(const Float64x4* in, Float64x4* out, size_t n) { \
+	size_t i = 0; \
+	for (; i + 4 <= n; i += 4) { \
+		_mm256x4_storeu_pdx4(&out[i], func(_mm256x4_loadu_pdx4(&in[i]))); \
+	} \
+	if (i < n) { \
+		const size_t rem = n - i; \
+		Float64x4 buf[4]; \
+		for (size_t j = 0; j < 4; j++) { \
+			buf[j] = in[i + ((j < rem) ? j : rem - 1)]; \
+		} \
+		_mm256x4_storeu_pdx4(buf, func(_mm256x4_loadu_pdx4(buf))); \
+		for (size_t j = 0; j < rem; j++) { \
+			out[i + j] = buf[j]; \
+		} \
+	} \
+}
+
+#define FLOAT64X4_ARRAY_AVX_BINARY(name, func) \
+static void name( \
+	const Float64x4* x, const Float64x4* y, Float64x4* out, size_t n \
+) { \
+	size_t i = 0; \
+	for (; i + 4 <= n; i += 4) { \
+		_mm256x4_storeu_pdx4(&out[i], func( \
+			_mm256x4_loadu_pdx4(&x[i]), _mm256x4_loadu_pdx4(&y[i]) \
+		)); \
+	} \
+	if (i < n) { \
+		const size_t rem = n - i; \
+		Float64x4 buf_x[4]; \
+		Float64x4 buf_y[4]; \
+		for (size_t j = 0; j < 4; j++) { \
+			buf_x[j] = x[i + ((j < rem) ? j : rem - 1)]; \
+			buf_y[j] = y[i + ((j < rem) ? j : rem - 1)]; \
+		} \
+		_mm256x4_storeu_pdx4(buf_x, func( \
+			_mm256x4_loadu_pdx4(buf_x), _mm256x4_loadu_pdx4(buf_y) \
+		)); \
+		for (size_t j = 0; j < rem; j++) { \
+			out[i + j] = buf_x[j]; \
+		} \
+	} \
+}
+
+FLOAT64X4_ARRAY_AVX_BINARY(Float64x4_add_array_AVX, _mm256x4_add_pdx4)
+FLOAT64X4_ARRAY_AVX_BINARY(Float64x4_sub_array_AVX, _mm256x4_sub_pdx4)
+FLOAT64X4_ARRAY_AVX_BINARY(Float64x4_mul_array_AVX, _mm256x4_mul_pdx4)
+FLOAT64X4_ARRAY_AVX_BINARY(Float64x4_div_array_AVX, _mm256x4_div_pdx4)
+FLOAT64X4_ARRAY_AVX_BINARY(Float64x4_copysign_array_AVX, _mm256x4_copysign_pdx4)
+FLOAT64X4_ARRAY_AVX_BINARY(Float64x4_fdim_array_AVX, _mm256x4_fdim_pdx4)
+FLOAT64X4_ARRAY_AVX_BINARY(Float64x4_fmod_array_AVX, _mm256x4_fmod_pdx4)
+FLOAT64X4_ARRAY_AVX_BINARY(Float64x4_pow_array_AVX, _mm256x4_pow_pdx4)
+FLOAT64X4_ARRAY_AVX_BINARY(Float64x4_atan2_array_AVX, _mm256x4_atan2_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_fabs_array_AVX, _mm256x4_fabs_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_sqrt_array_AVX, _mm256x4_sqrt_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_cbrt_array_AVX, _mm256x4_cbrt_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_exp_array_AVX, _mm256x4_exp_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_exp2_array_AVX, _mm256x4_exp2_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_exp10_array_AVX, _mm256x4_exp10_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_expm1_array_AVX, _mm256x4_expm1_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_log_array_AVX, _mm256x4_log_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_log2_array_AVX, _mm256x4_log2_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_log10_array_AVX, _mm256x4_log10_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_log1p_array_AVX, _mm256x4_log1p_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_sin_array_AVX, _mm256x4_sin_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_cos_array_AVX, _mm256x4_cos_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_tan_array_AVX, _mm256x4_tan_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_asin_array_AVX, _mm256x4_asin_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_acos_array_AVX, _mm256x4_acos_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_atan_array_AVX, _mm256x4_atan_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_sinh_array_AVX, _mm256x4_sinh_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_cosh_array_AVX, _mm256x4_cosh_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_tanh_array_AVX, _mm256x4_tanh_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_asinh_array_AVX, _mm256x4_asinh_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_acosh_array_AVX, _mm256x4_acosh_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_atanh_array_AVX, _mm256x4_atanh_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_floor_array_AVX, _mm256x4_floor_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_ceil_array_AVX, _mm256x4_ceil_pdx4)
+FLOAT64X4_ARRAY_AVX_UNARY(Float64x4_trunc_array_AVX, _mm256x4_trunc_pdx4)
+
+#undef FLOAT64X4_ARRAY_AVX_UNARY
+#undef FLOAT64X4_ARRAY_AVX_BINARY
+
+const Float64x4_array_kernels FLOAT64X4_ARRAY_AVX_KERNELS = {
+	.add_array      = Float64x4_add_array_AVX,
+	.sub_array      = Float64x4_sub_array_AVX,
+	.mul_array      = Float64x4_mul_array_AVX,
+	.div_array      = Float64x4_div_array_AVX,
+	.copysign_array = Float64x4_copysign_array_AVX,
+	.fdim_array     = Float64x4_fdim_array_AVX,
+	.fmod_array     = Float64x4_fmod_array_AVX,
+	.pow_array      = Float64x4_pow_array_AVX,
+	.atan2_array    = Float64x4_atan2_array_AVX,
+	.fabs_array     = Float64x4_fabs_array_AVX,
+	.sqrt_array     = Float64x4_sqrt_array_AVX,
+	.cbrt_array     = Float64x4_cbrt_array_AVX,
+	.exp_array      = Float64x4_exp_array_AVX,
+	.exp2_array     = Float64x4_exp2_array_AVX,
+	.exp10_array    = Float64x4_exp10_array_AVX,
+	.expm1_array    = Float64x4_expm1_array_AVX,
+	.log_array      = Float64x4_log_array_AVX,
+	.log2_array     = Float64x4_log2_array_AVX,
+	.log10_array    = Float64x4_log10_array_AVX,
+	.log1p_array    = Float64x4_log1p_array_AVX,
+	.sin_array      = Float64x4_sin_array_AVX,
+	.cos_array      = Float64x4_cos_array_AVX,
+	.tan_array      = Float64x4_tan_array_AVX,
+	.asin_array     = Float64x4_asin_array_AVX,
+	.acos_array     = Float64x4_acos_array_AVX,
+	.atan_array     = Float64x4_atan_array_AVX,
+	.sinh_array     = Float64x4_sinh_array_AVX,
+	.cosh_array     = Float64x4_cosh_array_AVX,
+	.tanh_array     = Float64x4_tanh_array_AVX,
+	.asinh_array    = Float64x4_asinh_array_AVX,
+	.acosh_array    = Float64x4_acosh_array_AVX,
+	.atanh_array    = Float64x4_atanh_array_AVX,
+	.floor_array    = Float64x4_floor_array_AVX,
+	.ceil_array     = Float64x4_ceil_array_AVX,
+	.trunc_array    = Float64x4_trunc_array_AVX,
+};
+
+#endif
@@ -0,0 +1,112 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "../LDF/LDF_cpu_dispatch.h"
+
+/**
+ * @brief AVX512 kernels for Float64x4_array.h. Only AVX512F is required.
+ * The math.h functions fall back to the AVX2+FMA kernels.
+ */
+
+#ifdef LDF_ENABLE_DISPATCH_AVX512
+
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__AVX512F__)
+	#pragma GCC target("avx512f,avx2,fma")
+#endif
+
+#include "Float64x4_array_kernels.h"
+#include "Float64x4_AVX512.h"
+
+#include <immintrin.h>
+
+//------------------------------------------------------------------------------
+// __m512dx4 array kernels
+//------------------------------------------------------------------------------
+
+/**
+ * @brief The tail is padded to a full __m512dx4 with copies of the last
+ * element, so that it is computed the same way as the rest of the array.
+ */
+#define FLOAT64X4_ARRAY_AVX512_UNARY(name, func) \
+static void name(const Float64x4* in, Float64x4* out, size_t n) { \
+	size_t i = 0; \
+	for (; i + 8 <= n; i += 8) { \
+		_mm512x4_storeu_pdx4(&out[i], func(_mm512x4_loadu_pdx4(&in[i]))); \
+	} \
+	if (i < n) { \
+		const size_t rem = n - i; \
+		Float64x4 buf[8]; \
+		for (size_t j = 0; j < 8; j++) { \
+			buf[j] = in[i + ((j < rem) ? j : rem - 1)]; \
+		} \
+		_mm512x4_storeu_pdx4(buf, func(_mm512x4_loadu_pdx4(buf))); \
+		for (size_t j = 0; j < rem; j++) { \
+			out[i + j] = buf[j]; \
+		} \
+	} \
+}
+
+#define FLOAT64X4_ARRAY_AVX512_BINARY(name, func) \
+static void name( \
+	const Float64x4* x, const Float64x4* y, Float64x4* out, size_t n \
+) { \
+	size_t i = 0; \
+	for (; i + 8 <= n; i += 8) { \
+		_mm512x4_storeu_pdx4(&out[i], func( \
+			_mm512x4_loadu_pdx4(&x[i]), _mm512x4_loadu_pdx4(&y[i]) \
+		)); \
+	} \
+	if (i < n) { \
+		const size_t rem = n - i; \
+		Float64x4 buf_x[8]; \
+		Float64x4 buf_y[8]; \
+		for (size_t j = 0; j < 8; j++) { \
+			buf_x[j] = x[i + ((j < rem) ? j : rem - 1)]; \
+			buf_y[j] = y[i + ((j < rem) ? j : rem - 1)]; \
+		} \
+		_mm512x4_storeu_pdx4(buf_x, func( \
+			_mm512x4_loadu_pdx4(buf_x), _mm512x4_loadu_pdx4(buf_y) \
+		)); \
+		for (size_t j = 0; j < rem; j++) { \
+			out[i + j] = buf_x[j]; \
+		} \
+	} \
+}
+
+FLOAT64X4_ARRAY_AVX512_BINARY(Float64x4_add_array_AVX512, _mm512x4_add_pdx4)
+FLOAT64X4_ARRAY_AVX512_BINARY(Float64x4_sub_array_AVX512, _mm512x4_sub_pdx4)
+FLOAT64X4_ARRAY_AVX512_BINARY(Float64x4_mul_array_AVX512, _mm512x4_mul_pdx4)
+FLOAT64X4_ARRAY_AVX512_BINARY(Float64x4_div_array_AVX512, _mm512x4_div_pdx4)
+FLOAT64X4_ARRAY_AVX512_BINARY(Float64x4_copysign_array_AVX512, _mm512x4_copysign_pdx4)
+FLOAT64X4_ARRAY_AVX512_BINARY(Float64x4_fdim_array_AVX512, _mm512x4_fdim_pdx4)
+FLOAT64X4_ARRAY_AVX512_BINARY(Float64x4_fmod_array_AVX512, _mm512x4_fmod_pdx4)
+FLOAT64X4_ARRAY_AVX512_UNARY(Float64x4_fabs_array_AVX512, _mm512x4_fabs_pdx4)
+FLOAT64X4_ARRAY_AVX512_UNARY(Float64x4_sqrt_array_AVX512, _mm512x4_sqrt_pdx4)
+FLOAT64X4_ARRAY_AVX512_UNARY(Float64x4_floor_array_AVX512, _mm512x4_floor_pdx4)
+FLOAT64X4_ARRAY_AVX512_UNARY(Float64x4_ceil_array_AVX512, _mm512x4_ceil_pdx4)
+FLOAT64X4_ARRAY_AVX512_UNARY(Float64x4_trunc_array_AVX512, _mm512x4_trunc_pdx4)
+
+#undef FLOAT64X4_ARRAY_AVX512_UNARY
+#undef FLOAT64X4_ARRAY_AVX512_BINARY
+
+const Float64x4_array_kernels Float64x4_array_kernels_AVX512 = {
+	.add_array      = Float64x4_add_array_AVX512,
+	.sub_array      = Float64x4_sub_array_AVX512,
+	.mul_array      = Float64x4_mul_array_AVX512,
+	.div_array      = Float64x4_div_array_AVX512,
+	.copysign_array = Float64x4_copysign_array_AVX512,
+	.fdim_array     = Float64x4_fdim_array_AVX512,
+	.fmod_array     = Float64x4_fmod_array_AVX512,
+	.fabs_array     = Float64x4_fabs_array_AVX512,
+	.sqrt_array     = Float64x4_sqrt_array_AVX512,
+	.floor_array    = Float64x4_floor_array_AVX512,
+	.ceil_array     = Float64x4_ceil_array_AVX512,
+	.trunc_array    = Float64x4_trunc_array_AVX512,
+};
+
+#endif
@@ -0,0 +1,155 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "../LDF/LDF_cpu_dispatch.h"
+
+/**
+ * @brief SSE2 kernels for Float64x4_array.h
+ */
+
+#ifdef LDF_ENABLE_DISPATCH_SSE2
+
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__SSE2__)
+	#pragma GCC target("sse2")
+#endif
+
+#include "Float64x4_array_kernels.h"
+#include "Float64x4_SSE2.h"
+
+#include <emmintrin.h>
+
+//------------------------------------------------------------------------------
+// __m128dx4 array kernels
+//------------------------------------------------------------------------------
+
+/**
+ * @brief The tail is padded to a full __m128dx4 with copies of the last
+ * element, so that it is computed the same way as the rest of the array.
+ */
+#define FLOAT64X4_ARRAY_SSE2_UNARY(name, func) \
+static void name(const Float64x4* in, Float64x4* out, size_t n) { \
+	size_t i = 0; \
+	for (; i + 2 <= n; i += 2) { \
+		_mm128x4_storeu_pdx4(&out[i], func(_mm128x4_loadu_pdx4(&in[i]))); \
+	} \
+	if (i < n) { \
+		const size_t rem = n - i; \
+		Float64x4 buf[2]; \
+		for (size_t j = 0; j < 2; j++) { \
+			buf[j] = in[i + ((j < rem) ? j : rem - 1)]; \
+		} \
+		_mm128x4_storeu_pdx4(buf, func(_mm128x4_loadu_pdx4(buf))); \
+		for (size_t j = 0; j < rem; j++) { \
+			out[i + j] = buf[j]; \
+		} \
+	} \
+}
+
+#define FLOAT64X4_ARRAY_SSE2_BINARY(name, func) \
+static void name( \
+	const Float64x4* x, const Float64x4* y, Float64x4* out, size_t n \
+) { \
+	size_t i = 0; \
+	for (; i + 2 <= n; i += 2) { \
+		_mm128x4_storeu_pdx4(&out[i], func( \
+			_mm128x4_loadu_pdx4(&x[i]), _mm128x4_loadu_pdx4(&y[i]) \
+		)); \
+	} \
+	if (i < n) { \
+		const size_t rem = n - i; \
+		Float64x4 buf_x[2]; \
+		Float64x4 buf_y[2]; \
+		for (size_t j = 0; j < 2; j++) { \
+			buf_x[j] = x[i + ((j < rem) ? j : rem - 1)]; \
+			buf_y[j] = y[i + ((j < rem) ? j : rem - 1)]; \
+		} \
+		_mm128x4_storeu_pdx4(buf_x, func( \
+			_mm128x4_loadu_pdx4(buf_x), _mm128x4_loadu_pdx4(buf_y) \
+		)); \
+		for (size_t j = 0; j < rem; j++) { \
+			out[i + j] = buf_x[j]; \
+		} \
+	} \
+}
+
+FLOAT64X4_ARRAY_SSE2_BINARY(Float64x4_add_array_SSE2, _mm128x4_add_pdx4)
+FLOAT64X4_ARRAY_SSE2_BINARY(Float64x4_sub_array_SSE2, _mm128x4_sub_pdx4)
+FLOAT64X4_ARRAY_SSE2_BINARY(Float64x4_mul_array_SSE2, _mm128x4_mul_pdx4)
+FLOAT64X4_ARRAY_SSE2_BINARY(Float64x4_div_array_SSE2, _mm128x4_div_pdx4)
+FLOAT64X4_ARRAY_SSE2_BINARY(Float64x4_copysign_array_SSE2, _mm128x4_copysign_pdx4)
+FLOAT64X4_ARRAY_SSE2_BINARY(Float64x4_fdim_array_SSE2, _mm128x4_fdim_pdx4)
+FLOAT64X4_ARRAY_SSE2_BINARY(Float64x4_fmod_array_SSE2, _mm128x4_fmod_pdx4)
+FLOAT64X4_ARRAY_SSE2_BINARY(Float64x4_pow_array_SSE2, _mm128x4_pow_pdx4)
+FLOAT64X4_ARRAY_SSE2_BINARY(Float64x4_atan2_array_SSE2, _mm128x4_atan2_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_fabs_array_SSE2, _mm128x4_fabs_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_sqrt_array_SSE2, _mm128x4_sqrt_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_exp_array_SSE2, _mm128x4_exp_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_exp2_array_SSE2, _mm128x4_exp2_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_exp10_array_SSE2, _mm128x4_exp10_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_expm1_array_SSE2, _mm128x4_expm1_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_log_array_SSE2, _mm128x4_log_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_log2_array_SSE2, _mm128x4_log2_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_log10_array_SSE2, _mm128x4_log10_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_log1p_array_SSE2, _mm128x4_log1p_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_sin_array_SSE2, _mm128x4_sin_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_cos_array_SSE2, _mm128x4_cos_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_tan_array_SSE2, _mm128x4_tan_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_asin_array_SSE2, _mm128x4_asin_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_acos_array_SSE2, _mm128x4_acos_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_atan_array_SSE2, _mm128x4_atan_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_sinh_array_SSE2, _mm128x4_sinh_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_cosh_array_SSE2, _mm128x4_cosh_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_tanh_array_SSE2, _mm128x4_tanh_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_asinh_array_SSE2, _mm128x4_asinh_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_acosh_array_SSE2, _mm128x4_acosh_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_atanh_array_SSE2, _mm128x4_atanh_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_floor_array_SSE2, _mm128x4_floor_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_ceil_array_SSE2, _mm128x4_ceil_pdx4)
+FLOAT64X4_ARRAY_SSE2_UNARY(Float64x4_trunc_array_SSE2, _mm128x4_trunc_pdx4)
+
+#undef FLOAT64X4_ARRAY_SSE2_UNARY
+#undef FLOAT64X4_ARRAY_SSE2_BINARY
+
+const Float64x4_array_kernels Float64x4_array_kernels_SSE2 = {
+	.add_array      = Float64x4_add_array_SSE2,
+	.sub_array      = Float64x4_sub_array_SSE2,
+	.mul_array      = Float64x4_mul_array_SSE2,
+	.div_array      = Float64x4_div_array_SSE2,
+	.copysign_array = Float64x4_copysign_array_SSE2,
+	.fdim_array     = Float64x4_fdim_array_SSE2,
+	.fmod_array     = Float64x4_fmod_array_SSE2,
+	.pow_array      = Float64x4_pow_array_SSE2,
+	.atan2_array    = Float64x4_atan2_array_SSE2,
+	.fabs_array     = Float64x4_fabs_array_SSE2,
+	.sqrt_array     = Float64x4_sqrt_array_SSE2,
+	.exp_array      = Float64x4_exp_array_SSE2,
+	.exp2_array     = Float64x4_exp2_array_SSE2,
+	.exp10_array    = Float64x4_exp10_array_SSE2,
+	.expm1_array    = Float64x4_expm1_array_SSE2,
+	.log_array      = Float64x4_log_array_SSE2,
+	.log2_array     = Float64x4_log2_array_SSE2,
+	.log10_array    = Float64x4_log10_array_SSE2,
+	.log1p_array    = Float64x4_log1p_array_SSE2,
+	.sin_array      = Float64x4_sin_array_SSE2,
+	.cos_array      = Float64x4_cos_array_SSE2,
+	.tan_array      = Float64x4_tan_array_SSE2,
+	.asin_array     = Float64x4_asin_array_SSE2,
+	.acos_array     = Float64x4_acos_array_SSE2,
+	.atan_array     = Float64x4_atan_array_SSE2,
+	.sinh_array     = Float64x4_sinh_array_SSE2,
+	.cosh_array     = Float64x4_cosh_array_SSE2,
+	.tanh_array     = Float64x4_tanh_array_SSE2,
+	.asinh_array    = Float64x4_asinh_array_SSE2,
+	.acosh_array    = Float64x4_acosh_array_SSE2,
+	.atanh_array    = Float64x4_atanh_array_SSE2,
+	.floor_array    = Float64x4_floor_array_SSE2,
+	.ceil_array     = Float64x4_ceil_array_SSE2,
+	.trunc_array    = Float64x4_trunc_array_SSE2,
+};
+
+#endif
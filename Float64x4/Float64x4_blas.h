@@ -0,0 +1,161 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#ifndef FLOAT64X4_BLAS_H
+#define FLOAT64X4_BLAS_H
+
+/**
+ * @brief Level-1, GEMV, and GEMM BLAS functions over arrays of Float64x4, and
+ * mixed precision functions that read fp64 arrays into Float64x4 sums.
+ *
+ * Arguments follow the reference BLAS order. `inc` is the stride between
+ * elements, and a negative stride walks the array backwards, so that element
+ * i is x[(n - 1 - i) * -inc]. Contiguous arrays (inc == 1) use the SSE2,
+ * AVX, AVX2+FMA, or AVX512 kernels selected at runtime with
+ * LDF_cpu_get_level(), and strided arrays use the scalar functions.
+ *
+ * @note The reductions are summed in a different order by each level, so
+ * the last few bits of dot, nrm2, and asum may differ between CPUs.
+ */
+
+#include "Float64x4_def.h"
+#include "../LDF/LDF_blas.h"
+#include "../LDF/LDF_cpu_dispatch.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+//------------------------------------------------------------------------------
+// Float64x4 Level-1 BLAS
+//------------------------------------------------------------------------------
+
+/** @brief Returns the sum of x[i] * y[i] */
+Float64x4 Float64x4_dot(
+	size_t n, const Float64x4* x, ptrdiff_t incx, const Float64x4* y, ptrdiff_t incy
+);
+
+/** @brief y[i] = alpha * x[i] + y[i] */
+void Float64x4_axpy(
+	size_t n, Float64x4 alpha, const Float64x4* x, ptrdiff_t incx,
+	Float64x4* y, ptrdiff_t incy
+);
+
+/** @brief x[i] = alpha * x[i] */
+void Float64x4_scal(size_t n, Float64x4 alpha, Float64x4* x, ptrdiff_t incx);
+
+/**
+ * @brief Returns the Euclidean norm sqrt(sum of x[i]^2).
+ * @note The squares are scaled by a power of two, like Float64x4_hypot, so that
+ * the result only overflows when the norm itself does.
+ */
+Float64x4 Float64x4_nrm2(size_t n, const Float64x4* x, ptrdiff_t incx);
+
+/** @brief Returns the sum of fabs(x[i]) */
+Float64x4 Float64x4_asum(size_t n, const Float64x4* x, ptrdiff_t incx);
+
+/**
+ * @brief Returns the zero-based index of the first element with the largest
+ * fabs(x[i]). NaN elements are skipped.
+ * @note Returns 0 when n is 0 or every element is NaN.
+ */
+size_t Float64x4_iamax(size_t n, const Float64x4* x, ptrdiff_t incx);
+
+/**
+ * @brief Applies a plane rotation:
+ * x[i] = c * x[i] + s * y[i]
+ * y[i] = c * y[i] - s * x[i]
+ */
+void Float64x4_rot(
+	size_t n, Float64x4* x, ptrdiff_t incx, Float64x4* y, ptrdiff_t incy,
+	Float64x4 c, Float64x4 s
+);
+
+//------------------------------------------------------------------------------
+// Float64x4 Level-2 BLAS
+//------------------------------------------------------------------------------
+
+/**
+ * @brief y = alpha * op(A) * x + beta * y, where A is an m by n matrix and
+ * op(A) is A or its transpose.
+ * @note x has n elements and y has m elements when trans is
+ * LDF_BLAS_NO_TRANS, and the other way around when it is LDF_BLAS_TRANS.
+ * y is not read when beta is zero.
+ */
+void Float64x4_gemv(
+	LDF_blas_layout layout, LDF_blas_transpose trans,
+	size_t m, size_t n, Float64x4 alpha, const Float64x4* A, size_t lda,
+	const Float64x4* x, ptrdiff_t incx, Float64x4 beta, Float64x4* y, ptrdiff_t incy
+);
+
+//------------------------------------------------------------------------------
+// Float64x4 Level-3 BLAS
+//------------------------------------------------------------------------------
+
+/**
+ * @brief C = alpha * op(A) * op(B) + beta * C, where op(A) is m by k, op(B)
+ * is k by n, and C is m by n.
+ *
+ * op(A) and op(B) are packed into cache-sized panels, which are multiplied
+ * by the register-blocked micro-kernel of the level selected by
+ * LDF_cpu_get_level().
+ *
+ * @note C is not read when beta is zero. Uses malloc for the panels, and
+ * falls back to an unpacked loop if the allocation fails.
+ */
+void Float64x4_gemm(
+	LDF_blas_layout layout, LDF_blas_transpose transa, LDF_blas_transpose transb,
+	size_t m, size_t n, size_t k, Float64x4 alpha, const Float64x4* A, size_t lda,
+	const Float64x4* B, size_t ldb, Float64x4 beta, Float64x4* C, size_t ldc
+);
+
+//------------------------------------------------------------------------------
+// Float64x4 mixed precision BLAS
+//------------------------------------------------------------------------------
+
+/**
+ * @brief The _d functions read fp64 arrays, which halves the memory traffic
+ * compared to widening the arrays to Float64x4 first. The products are
+ * computed exactly and added to a Float64x4 sum, which is as
+ * accurate as DotK and SumK from Ogita, Rump, and Oishi, "Accurate Sum and
+ * Dot Product" (2005) with K = 4.
+ */
+
+/** @brief Returns the sum of x[i] * y[i] */
+Float64x4 Float64x4_dot_d(
+	size_t n, const fp64* x, ptrdiff_t incx, const fp64* y, ptrdiff_t incy
+);
+
+/** @brief Returns the sum of x[i] */
+Float64x4 Float64x4_sum_d(size_t n, const fp64* x, ptrdiff_t incx);
+
+/**
+ * @brief Returns the sum of x[i] computed with Float64_sumK_partials, which
+ * is as accurate as summing in K-fold precision and is bitwise identical on
+ * every CPU.
+ */
+Float64x4 Float64x4_sumK_d(size_t n, const fp64* x, ptrdiff_t incx, int K);
+
+/**
+ * @brief y = alpha * op(A) * x + beta * y, where A is an m by n fp64 matrix.
+ * op(A) * x is summed with Float64x4_dot_d before it is multiplied by alpha.
+ * @note y is not read when beta is zero.
+ */
+void Float64x4_gemv_d(
+	LDF_blas_layout layout, LDF_blas_transpose trans,
+	size_t m, size_t n, Float64x4 alpha, const fp64* A, size_t lda,
+	const fp64* x, ptrdiff_t incx, Float64x4 beta, Float64x4* y, ptrdiff_t incy
+);
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* FLOAT64X4_BLAS_H */
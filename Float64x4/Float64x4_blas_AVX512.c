@@ -0,0 +1,273 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "../LDF/LDF_cpu_dispatch.h"
+
+/**
+ * @brief AVX512 kernels for Float64x4_blas.h. Only AVX512F is required.
+ */
+
+#ifdef LDF_ENABLE_DISPATCH_AVX512
+
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__AVX512F__)
+	#pragma GCC target("avx512f,avx2,fma")
+#endif
+
+#include "Float64x4_blas_kernels.h"
+#include "Float64x4_AVX512.h"
+#include "Float64x4.h"
+
+#include <immintrin.h>
+
+//------------------------------------------------------------------------------
+// __m512dx4 BLAS kernels
+//------------------------------------------------------------------------------
+
+/** @brief Adds the lanes of a vector in order */
+static inline Float64x4 Float64x4_blas_reduce_AVX512(const __m512dx4 x) {
+	Float64x4 lane[8];
+	_mm512x4_storeu_pdx4(lane, x);
+	Float64x4 sum = lane[0];
+	for (size_t j = 1; j < 8; j++) {
+		sum = Float64x4_add(sum, lane[j]);
+	}
+	return sum;
+}
+
+static Float64x4 Float64x4_dot_AVX512(const Float64x4* x, const Float64x4* y, size_t n) {
+	__m512dx4 sum = _mm512x4_setzero_pdx4();
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		sum = _mm512x4_add_pdx4(sum, _mm512x4_mul_pdx4(
+			_mm512x4_loadu_pdx4(&x[i]), _mm512x4_loadu_pdx4(&y[i])
+		));
+	}
+	Float64x4 ret = Float64x4_blas_reduce_AVX512(sum);
+	for (; i < n; i++) {
+		ret = Float64x4_add(ret, Float64x4_mul(x[i], y[i]));
+	}
+	return ret;
+}
+
+static void Float64x4_axpy_AVX512(Float64x4 alpha, const Float64x4* x, Float64x4* y, size_t n) {
+	const __m512dx4 v_alpha = _mm512x4_set1_pdx4(alpha);
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		_mm512x4_storeu_pdx4(&y[i], _mm512x4_add_pdx4(
+			_mm512x4_mul_pdx4(v_alpha, _mm512x4_loadu_pdx4(&x[i])),
+			_mm512x4_loadu_pdx4(&y[i])
+		));
+	}
+	for (; i < n; i++) {
+		y[i] = Float64x4_add(Float64x4_mul(alpha, x[i]), y[i]);
+	}
+}
+
+static void Float64x4_scal_AVX512(Float64x4 alpha, Float64x4* x, size_t n) {
+	const __m512dx4 v_alpha = _mm512x4_set1_pdx4(alpha);
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		_mm512x4_storeu_pdx4(&x[i], _mm512x4_mul_pdx4(v_alpha, _mm512x4_loadu_pdx4(&x[i])));
+	}
+	for (; i < n; i++) {
+		x[i] = Float64x4_mul(alpha, x[i]);
+	}
+}
+
+static Float64x4 Float64x4_sumsq_AVX512(const Float64x4* x, size_t n, fp64 scale) {
+	const __m512d v_scale = _mm512_set1_pd(scale);
+	__m512dx4 sum = _mm512x4_setzero_pdx4();
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		sum = _mm512x4_add_pdx4(sum, _mm512x4_square_pdx4(
+			_mm512x4_mul_power2_pdx4_pd(_mm512x4_loadu_pdx4(&x[i]), v_scale)
+		));
+	}
+	Float64x4 ret = Float64x4_blas_reduce_AVX512(sum);
+	for (; i < n; i++) {
+		ret = Float64x4_add(ret, Float64x4_square(Float64x4_mul_power2_dx4_d(x[i], scale)));
+	}
+	return ret;
+}
+
+static Float64x4 Float64x4_asum_AVX512(const Float64x4* x, size_t n) {
+	__m512dx4 sum = _mm512x4_setzero_pdx4();
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		sum = _mm512x4_add_pdx4(sum, _mm512x4_fabs_pdx4(_mm512x4_loadu_pdx4(&x[i])));
+	}
+	Float64x4 ret = Float64x4_blas_reduce_AVX512(sum);
+	for (; i < n; i++) {
+		ret = Float64x4_add(ret, Float64x4_fabs(x[i]));
+	}
+	return ret;
+}
+
+/**
+ * @brief Each lane keeps its own maximum and index. The lanes are then
+ * merged, preferring the smallest index on ties, before the scalar tail.
+ */
+static size_t Float64x4_iamax_AVX512(const Float64x4* x, size_t n) {
+	Float64x4 ret_max = Float64x4_set_d(-1.0);
+	size_t ret_index = 0;
+	size_t i = 0;
+	if (n >= 8) {
+		__m512dx4 x_max = _mm512x4_set1_pd(-1.0);
+		__m512d index = _mm512_setzero_pd();
+		__m512d lane_index = _mm512_setr_pd(0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0);
+		const __m512d lane_step = _mm512_set1_pd(8.0);
+		for (; i + 8 <= n; i += 8) {
+			const __m512dx4 x_abs = _mm512x4_fabs_pdx4(_mm512x4_loadu_pdx4(&x[i]));
+			const __mmask8 cmp = _mm512_cmpgt_pdx4_mask(x_abs, x_max);
+			x_max = _mm512x4_mask_blend_pdx4(cmp, x_max, x_abs);
+			index = _mm512_mask_blend_pd(cmp, index, lane_index);
+			lane_index = _mm512_add_pd(lane_index, lane_step);
+		}
+		Float64x4 lane_max[8];
+		fp64 lane_pos[8];
+		_mm512x4_storeu_pdx4(lane_max, x_max);
+		_mm512_storeu_pd(lane_pos, index);
+		for (size_t j = 0; j < 8; j++) {
+			const size_t pos = (size_t)lane_pos[j];
+			if (
+				Float64x4_cmpgt(lane_max[j], ret_max) ||
+				(Float64x4_cmpeq(lane_max[j], ret_max) && pos < ret_index)
+			) {
+				ret_max = lane_max[j];
+				ret_index = pos;
+			}
+		}
+	}
+	for (; i < n; i++) {
+		const Float64x4 x_abs = Float64x4_fabs(x[i]);
+		if (Float64x4_cmpgt(x_abs, ret_max)) {
+			ret_max = x_abs;
+			ret_index = i;
+		}
+	}
+	return ret_index;
+}
+
+static void Float64x4_rot_AVX512(Float64x4* x, Float64x4* y, size_t n, Float64x4 c, Float64x4 s) {
+	const __m512dx4 v_c = _mm512x4_set1_pdx4(c);
+	const __m512dx4 v_s = _mm512x4_set1_pdx4(s);
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		const __m512dx4 x_val = _mm512x4_loadu_pdx4(&x[i]);
+		const __m512dx4 y_val = _mm512x4_loadu_pdx4(&y[i]);
+		_mm512x4_storeu_pdx4(&x[i], _mm512x4_add_pdx4(
+			_mm512x4_mul_pdx4(v_c, x_val), _mm512x4_mul_pdx4(v_s, y_val)
+		));
+		_mm512x4_storeu_pdx4(&y[i], _mm512x4_sub_pdx4(
+			_mm512x4_mul_pdx4(v_c, y_val), _mm512x4_mul_pdx4(v_s, x_val)
+		));
+	}
+	for (; i < n; i++) {
+		const Float64x4 x_val = x[i];
+		const Float64x4 y_val = y[i];
+		x[i] = Float64x4_add(Float64x4_mul(c, x_val), Float64x4_mul(s, y_val));
+		y[i] = Float64x4_sub(Float64x4_mul(c, y_val), Float64x4_mul(s, x_val));
+	}
+}
+
+/**
+ * @brief Register-blocked 8 by 4 gemm tile. Each step of k is a
+ * broadcast of one element of B times a column of A.
+ */
+static void Float64x4_gemm_AVX512(
+	size_t k, const Float64x4* A, const Float64x4* B, Float64x4 alpha,
+	Float64x4* C, size_t ldc, size_t mr, size_t nr
+) {
+	__m512dx4 c0 = _mm512x4_setzero_pdx4();
+	__m512dx4 c1 = _mm512x4_setzero_pdx4();
+	__m512dx4 c2 = _mm512x4_setzero_pdx4();
+	__m512dx4 c3 = _mm512x4_setzero_pdx4();
+	for (size_t p = 0; p < k; p++) {
+		const __m512dx4 a_col = _mm512x4_loadu_pdx4(A);
+		c0 = _mm512x4_add_pdx4(c0, _mm512x4_mul_pdx4(a_col, _mm512x4_set1_pdx4(B[0])));
+		c1 = _mm512x4_add_pdx4(c1, _mm512x4_mul_pdx4(a_col, _mm512x4_set1_pdx4(B[1])));
+		c2 = _mm512x4_add_pdx4(c2, _mm512x4_mul_pdx4(a_col, _mm512x4_set1_pdx4(B[2])));
+		c3 = _mm512x4_add_pdx4(c3, _mm512x4_mul_pdx4(a_col, _mm512x4_set1_pdx4(B[3])));
+		A += 8;
+		B += 4;
+	}
+	const __m512dx4 v_alpha = _mm512x4_set1_pdx4(alpha);
+	Float64x4 tile[8 * 4];
+	_mm512x4_storeu_pdx4(&tile[0], _mm512x4_mul_pdx4(v_alpha, c0));
+	_mm512x4_storeu_pdx4(&tile[8], _mm512x4_mul_pdx4(v_alpha, c1));
+	_mm512x4_storeu_pdx4(&tile[16], _mm512x4_mul_pdx4(v_alpha, c2));
+	_mm512x4_storeu_pdx4(&tile[24], _mm512x4_mul_pdx4(v_alpha, c3));
+	for (size_t j = 0; j < nr; j++) {
+		for (size_t i = 0; i < mr; i++) {
+			C[i + j * ldc] = Float64x4_add(C[i + j * ldc], tile[i + j * 8]);
+		}
+	}
+}
+
+/**
+ * @brief The exact products are added to one Float64x4 sum per lane, which
+ * are then added in order before the tail.
+ */
+static Float64x4 Float64x4_dot_d_AVX512(const fp64* x, const fp64* y, size_t n) {
+	__m512dx4 sum = _mm512x4_setzero_pdx4();
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		sum = _mm512x4_add_pdx4_pdx2(sum, _mm512x2_mul_pd_pd(
+			_mm512_loadu_pd(&x[i]), _mm512_loadu_pd(&y[i])
+		));
+	}
+	Float64x4 ret = Float64x4_blas_reduce_AVX512(sum);
+	for (; i < n; i++) {
+		ret = Float64x4_add_dx4_dx2(ret, Float64x2_mul_d_d(x[i], y[i]));
+	}
+	return ret;
+}
+
+static Float64x4 Float64x4_sum_d_AVX512(const fp64* x, size_t n) {
+	__m512dx4 sum = _mm512x4_setzero_pdx4();
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		sum = _mm512x4_add_pdx4_pd(sum, _mm512_loadu_pd(&x[i]));
+	}
+	Float64x4 ret = Float64x4_blas_reduce_AVX512(sum);
+	for (; i < n; i++) {
+		ret = Float64x4_add_dx4_d(ret, x[i]);
+	}
+	return ret;
+}
+
+static void Float64x4_axpy_d_AVX512(Float64x4* y, const fp64* a, fp64 x, size_t n) {
+	const __m512d v_x = _mm512_set1_pd(x);
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		_mm512x4_storeu_pdx4(&y[i], _mm512x4_add_pdx4_pdx2(
+			_mm512x4_loadu_pdx4(&y[i]), _mm512x2_mul_pd_pd(_mm512_loadu_pd(&a[i]), v_x)
+		));
+	}
+	for (; i < n; i++) {
+		y[i] = Float64x4_add_dx4_dx2(y[i], Float64x2_mul_d_d(a[i], x));
+	}
+}
+
+const Float64x4_blas_kernels Float64x4_blas_kernels_AVX512 = {
+	.dot     = Float64x4_dot_AVX512,
+	.axpy    = Float64x4_axpy_AVX512,
+	.scal    = Float64x4_scal_AVX512,
+	.sumsq   = Float64x4_sumsq_AVX512,
+	.asum    = Float64x4_asum_AVX512,
+	.iamax   = Float64x4_iamax_AVX512,
+	.rot     = Float64x4_rot_AVX512,
+	.gemm    = Float64x4_gemm_AVX512,
+	.gemm_mr = 8,
+	.gemm_nr = 4,
+	.dot_d   = Float64x4_dot_d_AVX512,
+	.sum_d   = Float64x4_sum_d_AVX512,
+	.axpy_d  = Float64x4_axpy_d_AVX512,
+};
+
+#endif
@@ -0,0 +1,276 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "../LDF/LDF_cpu_dispatch.h"
+
+/**
+ * @brief SSE2 kernels for Float64x4_blas.h
+ */
+
+#ifdef LDF_ENABLE_DISPATCH_SSE2
+
+#if defined(__GNUC__) && !defined(__clang__) && !defined(__SSE2__)
+	#pragma GCC target("sse2")
+#endif
+
+#include "Float64x4_blas_kernels.h"
+#include "Float64x4_SSE2.h"
+#include "Float64x4.h"
+
+#include <emmintrin.h>
+
+//------------------------------------------------------------------------------
+// __m128dx4 BLAS kernels
+//------------------------------------------------------------------------------
+
+/** @brief Selects y where every bit of mask is set, otherwise x */
+static inline __m128dx4 Float64x4_blas_blend_SSE2(__m128dx4 x, __m128dx4 y, __m128d mask) {
+	x.val[0] = _internal_mm_blendv_pd(x.val[0], y.val[0], mask);
+	x.val[1] = _internal_mm_blendv_pd(x.val[1], y.val[1], mask);
+	x.val[2] = _internal_mm_blendv_pd(x.val[2], y.val[2], mask);
+	x.val[3] = _internal_mm_blendv_pd(x.val[3], y.val[3], mask);
+	return x;
+}
+
+/** @brief Adds the lanes of a vector in order */
+static inline Float64x4 Float64x4_blas_reduce_SSE2(const __m128dx4 x) {
+	Float64x4 lane[2];
+	_mm128x4_storeu_pdx4(lane, x);
+	Float64x4 sum = lane[0];
+	for (size_t j = 1; j < 2; j++) {
+		sum = Float64x4_add(sum, lane[j]);
+	}
+	return sum;
+}
+
+static Float64x4 Float64x4_dot_SSE2(const Float64x4* x, const Float64x4* y, size_t n) {
+	__m128dx4 sum = _mm128x4_setzero_pdx4();
+	size_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		sum = _mm128x4_add_pdx4(sum, _mm128x4_mul_pdx4(
+			_mm128x4_loadu_pdx4(&x[i]), _mm128x4_loadu_pdx4(&y[i])
+		));
+	}
+	Float64x4 ret = Float64x4_blas_reduce_SSE2(sum);
+	for (; i < n; i++) {
+		ret = Float64x4_add(ret, Float64x4_mul(x[i], y[i]));
+	}
+	return ret;
+}
+
+static void Float64x4_axpy_SSE2(Float64x4 alpha, const Float64x4* x, Float64x4* y, size_t n) {
+	const __m128dx4 v_alpha = _mm128x4_set1_pdx4(alpha);
+	size_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		_mm128x4_storeu_pdx4(&y[i], _mm128x4_add_pdx4(
+			_mm128x4_mul_pdx4(v_alpha, _mm128x4_loadu_pdx4(&x[i])),
+			_mm128x4_loadu_pdx4(&y[i])
+		));
+	}
+	for (; i < n; i++) {
+		y[i] = Float64x4_add(Float64x4_mul(alpha, x[i]), y[i]);
+	}
+}
+
+static void Float64x4_scal_SSE2(Float64x4 alpha, Float64x4* x, size_t n) {
+	const __m128dx4 v_alpha = _mm128x4_set1_pdx4(alpha);
+	size_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		_mm128x4_storeu_pdx4(&x[i], _mm128x4_mul_pdx4(v_alpha, _mm128x4_loadu_pdx4(&x[i])));
+	}
+	for (; i < n; i++) {
+		x[i] = Float64x4_mul(alpha, x[i]);
+	}
+}
+
+static Float64x4 Float64x4_sumsq_SSE2(const Float64x4* x, size_t n, fp64 scale) {
+	const __m128d v_scale = _mm_set1_pd(scale);
+	__m128dx4 sum = _mm128x4_setzero_pdx4();
+	size_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		sum = _mm128x4_add_pdx4(sum, _mm128x4_square_pdx4(
+			_mm128x4_mul_power2_pdx4_pd(_mm128x4_loadu_pdx4(&x[i]), v_scale)
+		));
+	}
+	Float64x4 ret = Float64x4_blas_reduce_SSE2(sum);
+	for (; i < n; i++) {
+		ret = Float64x4_add(ret, Float64x4_square(Float64x4_mul_power2_dx4_d(x[i], scale)));
+	}
+	return ret;
+}
+
+static Float64x4 Float64x4_asum_SSE2(const Float64x4* x, size_t n) {
+	__m128dx4 sum = _mm128x4_setzero_pdx4();
+	size_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		sum = _mm128x4_add_pdx4(sum, _mm128x4_fabs_pdx4(_mm128x4_loadu_pdx4(&x[i])));
+	}
+	Float64x4 ret = Float64x4_blas_reduce_SSE2(sum);
+	for (; i < n; i++) {
+		ret = Float64x4_add(ret, Float64x4_fabs(x[i]));
+	}
+	return ret;
+}
+
+/**
+ * @brief Each lane keeps its own maximum and index. The lanes are then
+ * merged, preferring the smallest index on ties, before the scalar tail.
+ */
+static size_t Float64x4_iamax_SSE2(const Float64x4* x, size_t n) {
+	Float64x4 ret_max = Float64x4_set_d(-1.0);
+	size_t ret_index = 0;
+	size_t i = 0;
+	if (n >= 2) {
+		__m128dx4 x_max = _mm128x4_set1_pd(-1.0);
+		__m128d index = _mm_setzero_pd();
+		__m128d lane_index = _mm_setr_pd(0.0, 1.0);
+		const __m128d lane_step = _mm_set1_pd(2.0);
+		for (; i + 2 <= n; i += 2) {
+			const __m128dx4 x_abs = _mm128x4_fabs_pdx4(_mm128x4_loadu_pdx4(&x[i]));
+			const __m128d cmp = _mm_cmpgt_pdx4(x_abs, x_max);
+			x_max = Float64x4_blas_blend_SSE2(x_max, x_abs, cmp);
+			index = _internal_mm_blendv_pd(index, lane_index, cmp);
+			lane_index = _mm_add_pd(lane_index, lane_step);
+		}
+		Float64x4 lane_max[2];
+		fp64 lane_pos[2];
+		_mm128x4_storeu_pdx4(lane_max, x_max);
+		_mm_storeu_pd(lane_pos, index);
+		for (size_t j = 0; j < 2; j++) {
+			const size_t pos = (size_t)lane_pos[j];
+			if (
+				Float64x4_cmpgt(lane_max[j], ret_max) ||
+				(Float64x4_cmpeq(lane_max[j], ret_max) && pos < ret_index)
+			) {
+				ret_max = lane_max[j];
+				ret_index = pos;
+			}
+		}
+	}
+	for (; i < n; i++) {
+		const Float64x4 x_abs = Float64x4_fabs(x[i]);
+		if (Float64x4_cmpgt(x_abs, ret_max)) {
+			ret_max = x_abs;
+			ret_index = i;
+		}
+	}
+	return ret_index;
+}
+
+static void Float64x4_rot_SSE2(Float64x4* x, Float64x4* y, size_t n, Float64x4 c, Float64x4 s) {
+	const __m128dx4 v_c = _mm128x4_set1_pdx4(c);
+	const __m128dx4 v_s = _mm128x4_set1_pdx4(s);
+	size_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		const __m128dx4 x_val = _mm128x4_loadu_pdx4(&x[i]);
+		const __m128dx4 y_val = _mm128x4_loadu_pdx4(&y[i]);
+		_mm128x4_storeu_pdx4(&x[i], _mm128x4_add_pdx4(
+			_mm128x4_mul_pdx4(v_c, x_val), _mm128x4_mul_pdx4(v_s, y_val)
+		));
+		_mm128x4_storeu_pdx4(&y[i], _mm128x4_sub_pdx4(
+			_mm128x4_mul_pdx4(v_c, y_val), _mm128x4_mul_pdx4(v_s, x_val)
+		));
+	}
+	for (; i < n; i++) {
+		const Float64x4 x_val = x[i];
+		const Float64x4 y_val = y[i];
+		x[i] = Float64x4_add(Float64x4_mul(c, x_val), Float64x4_mul(s, y_val));
+		y[i] = Float64x4_sub(Float64x4_mul(c, y_val), Float64x4_mul(s, x_val));
+	}
+}
+
+/**
+ * @brief Register-blocked 2 by 2 gemm tile. Each step of k is a
+ * broadcast of one element of B times a column of A.
+ */
+static void Float64x4_gemm_SSE2(
+	size_t k, const Float64x4* A, const Float64x4* B, Float64x4 alpha,
+	Float64x4* C, size_t ldc, size_t mr, size_t nr
+) {
+	__m128dx4 c0 = _mm128x4_setzero_pdx4();
+	__m128dx4 c1 = _mm128x4_setzero_pdx4();
+	for (size_t p = 0; p < k; p++) {
+		const __m128dx4 a_col = _mm128x4_loadu_pdx4(A);
+		c0 = _mm128x4_add_pdx4(c0, _mm128x4_mul_pdx4(a_col, _mm128x4_set1_pdx4(B[0])));
+		c1 = _mm128x4_add_pdx4(c1, _mm128x4_mul_pdx4(a_col, _mm128x4_set1_pdx4(B[1])));
+		A += 2;
+		B += 2;
+	}
+	const __m128dx4 v_alpha = _mm128x4_set1_pdx4(alpha);
+	Float64x4 tile[2 * 2];
+	_mm128x4_storeu_pdx4(&tile[0], _mm128x4_mul_pdx4(v_alpha, c0));
+	_mm128x4_storeu_pdx4(&tile[2], _mm128x4_mul_pdx4(v_alpha, c1));
+	for (size_t j = 0; j < nr; j++) {
+		for (size_t i = 0; i < mr; i++) {
+			C[i + j * ldc] = Float64x4_add(C[i + j * ldc], tile[i + j * 2]);
+		}
+	}
+}
+
+/**
+ * @brief The exact products are added to one Float64x4 sum per lane, which
+ * are then added in order before the tail.
+ */
+static Float64x4 Float64x4_dot_d_SSE2(const fp64* x, const fp64* y, size_t n) {
+	__m128dx4 sum = _mm128x4_setzero_pdx4();
+	size_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		sum = _mm128x4_add_pdx4_pdx2(sum, _mm128x2_mul_pd_pd(
+			_mm_loadu_pd(&x[i]), _mm_loadu_pd(&y[i])
+		));
+	}
+	Float64x4 ret = Float64x4_blas_reduce_SSE2(sum);
+	for (; i < n; i++) {
+		ret = Float64x4_add_dx4_dx2(ret, Float64x2_mul_d_d(x[i], y[i]));
+	}
+	return ret;
+}
+
+static Float64x4 Float64x4_sum_d_SSE2(const fp64* x, size_t n) {
+	__m128dx4 sum = _mm128x4_setzero_pdx4();
+	size_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		sum = _mm128x4_add_pdx4_pd(sum, _mm_loadu_pd(&x[i]));
+	}
+	Float64x4 ret = Float64x4_blas_reduce_SSE2(sum);
+	for (; i < n; i++) {
+		ret = Float64x4_add_dx4_d(ret, x[i]);
+	}
+	return ret;
+}
+
+static void Float64x4_axpy_d_SSE2(Float64x4* y, const fp64* a, fp64 x, size_t n) {
+	const __m128d v_x = _mm_set1_pd(x);
+	size_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		_mm128x4_storeu_pdx4(&y[i], _mm128x4_add_pdx4_pdx2(
+			_mm128x4_loadu_pdx4(&y[i]), _mm128x2_mul_pd_pd(_mm_loadu_pd(&a[i]), v_x)
+		));
+	}
+	for (; i < n; i++) {
+		y[i] = Float64x4_add_dx4_dx2(y[i], Float64x2_mul_d_d(a[i], x));
+	}
+}
+
+const Float64x4_blas_kernels Float64x4_blas_kernels_SSE2 = {
+	.dot     = Float64x4_dot_SSE2,
+	.axpy    = Float64x4_axpy_SSE2,
+	.scal    = Float64x4_scal_SSE2,
+	.sumsq   = Float64x4_sumsq_SSE2,
+	.asum    = Float64x4_asum_SSE2,
+	.iamax   = Float64x4_iamax_SSE2,
+	.rot     = Float64x4_rot_SSE2,
+	.gemm    = Float64x4_gemm_SSE2,
+	.gemm_mr = 2,
+	.gemm_nr = 2,
+	.dot_d   = Float64x4_dot_d_SSE2,
+	.sum_d   = Float64x4_sum_d_SSE2,
+	.axpy_d  = Float64x4_axpy_d_SSE2,
+};
+
+#endif
@@ -0,0 +1,111 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#ifndef FLOAT64X4_BLAS_KERNELS_H
+#define FLOAT64X4_BLAS_KERNELS_H
+
+/**
+ * @brief Internal table of the contiguous Float64x4_blas.h kernels. Each
+ * Float64x4_blas_<ISA>.c file provides one table.
+ *
+ * @note NULL entries fall back to the next lower level, and then to the
+ * scalar loops in Float64x4_blas.c.
+ */
+
+#include "Float64x4_def.h"
+#include "Float64x4.h"
+#include "../LDF/LDF_cpu_dispatch.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+
+typedef Float64x4 (*Float64x4_blas_dot_func)(
+	const Float64x4* x, const Float64x4* y, size_t n
+);
+
+typedef void (*Float64x4_blas_axpy_func)(
+	Float64x4 alpha, const Float64x4* x, Float64x4* y, size_t n
+);
+
+typedef void (*Float64x4_blas_scal_func)(Float64x4 alpha, Float64x4* x, size_t n);
+
+/** @brief Returns the sum of (x[i] * scale)^2, where scale is a power of two */
+typedef Float64x4 (*Float64x4_blas_sumsq_func)(
+	const Float64x4* x, size_t n, fp64 scale
+);
+
+typedef Float64x4 (*Float64x4_blas_asum_func)(const Float64x4* x, size_t n);
+
+typedef size_t (*Float64x4_blas_iamax_func)(const Float64x4* x, size_t n);
+
+typedef void (*Float64x4_blas_rot_func)(
+	Float64x4* x, Float64x4* y, size_t n, Float64x4 c, Float64x4 s
+);
+
+/**
+ * @brief C += alpha * A * B for one gemm_mr by gemm_nr tile of C, which is
+ * column-major. A is a packed sliver of k columns of gemm_mr rows, and B is
+ * a packed sliver of k rows of gemm_nr columns. Only the top-left mr by nr
+ * part of the tile is written.
+ */
+typedef void (*Float64x4_blas_gemm_func)(
+	size_t k, const Float64x4* A, const Float64x4* B, Float64x4 alpha,
+	Float64x4* C, size_t ldc, size_t mr, size_t nr
+);
+
+typedef Float64x4 (*Float64x4_blas_dot_d_func)(
+	const fp64* x, const fp64* y, size_t n
+);
+
+typedef Float64x4 (*Float64x4_blas_sum_d_func)(const fp64* x, size_t n);
+
+/** @brief y[i] += a[i] * x, where the product is exact */
+typedef void (*Float64x4_blas_axpy_d_func)(
+	Float64x4* y, const fp64* a, fp64 x, size_t n
+);
+
+typedef struct Float64x4_blas_kernels {
+	Float64x4_blas_dot_func dot;
+	Float64x4_blas_axpy_func axpy;
+	Float64x4_blas_scal_func scal;
+	Float64x4_blas_sumsq_func sumsq;
+	Float64x4_blas_asum_func asum;
+	Float64x4_blas_iamax_func iamax;
+	Float64x4_blas_rot_func rot;
+	Float64x4_blas_gemm_func gemm;
+	/** rows of the gemm micro-kernel tile */
+	size_t gemm_mr;
+	/** columns of the gemm micro-kernel tile */
+	size_t gemm_nr;
+	Float64x4_blas_dot_d_func dot_d;
+	Float64x4_blas_sum_d_func sum_d;
+	Float64x4_blas_axpy_d_func axpy_d;
+} Float64x4_blas_kernels;
+
+#ifdef LDF_ENABLE_DISPATCH_SSE2
+	extern const Float64x4_blas_kernels Float64x4_blas_kernels_SSE2;
+#endif
+#ifdef LDF_ENABLE_DISPATCH_AVX
+	extern const Float64x4_blas_kernels Float64x4_blas_kernels_AVX;
+#endif
+#ifdef LDF_ENABLE_DISPATCH_AVX2_FMA
+	extern const Float64x4_blas_kernels Float64x4_blas_kernels_AVX2_FMA;
+#endif
+#ifdef LDF_ENABLE_DISPATCH_AVX512
+	extern const Float64x4_blas_kernels Float64x4_blas_kernels_AVX512;
+#endif
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* FLOAT64X4_BLAS_KERNELS_H */
@@ -0,0 +1,56 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#ifndef FLOAT64X4_PARALLEL_HPP
+#define FLOAT64X4_PARALLEL_HPP
+
+/**
+ * @brief Multithreaded sum, dot, and nrm2 over arrays of Float64x4.
+ *
+ * The array is split into blocks of LDF::reproducible_block_size elements,
+ * and each block is summed in a fixed order. The block sums are then added
+ * together in a fixed pairwise tree, so the results are bitwise identical for
+ * any thread count, and on any CPU, since the blocks are summed with the
+ * portable Float64x4 arithmetic instead of the dispatched SIMD kernels.
+ *
+ * Arguments follow Float64x4_blas.h, so a negative stride walks the array
+ * backwards.
+ */
+
+#include "Float64x4_def.h"
+#include "../LDF/LDF_thread_pool.hpp"
+
+#include <cstddef>
+
+/* LIB-Dekker-Float namespace */
+namespace LDF {
+
+/** @brief Returns the sum of x[i] */
+Float64x4 parallel_sum(
+	size_t n, const Float64x4* x, ptrdiff_t incx,
+	Thread_Pool& pool = Thread_Pool::get_default()
+);
+
+/** @brief Returns the sum of x[i] * y[i] */
+Float64x4 parallel_dot(
+	size_t n, const Float64x4* x, ptrdiff_t incx, const Float64x4* y, ptrdiff_t incy,
+	Thread_Pool& pool = Thread_Pool::get_default()
+);
+
+/**
+ * @brief Returns the Euclidean norm sqrt(sum of x[i]^2).
+ * @note The squares are scaled by a power of two, like Float64x4_nrm2.
+ */
+Float64x4 parallel_nrm2(
+	size_t n, const Float64x4* x, ptrdiff_t incx,
+	Thread_Pool& pool = Thread_Pool::get_default()
+);
+
+} /* LIB-Dekker-Float namespace */
+
+#endif /* FLOAT64X4_PARALLEL_HPP */
@@ -0,0 +1,80 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#ifndef FLOAT64X4_POLYNOMIAL_HPP
+#define FLOAT64X4_POLYNOMIAL_HPP
+
+/**
+ * @brief LDF::Polynomial_Traits for Float64x4, and for __m256dx4 when AVX is enabled,
+ * so that a Split_Polynomial<Float64x4> can be evaluated four values at a time.
+ */
+
+#include "Float64x4.hpp"
+#include "../LDF/LDF_polynomial.hpp"
+
+#ifdef __AVX__
+	#include "Float64x4_AVX.h"
+#endif
+
+/* LIB-Dekker-Float namespace */
+namespace LDF {
+
+template<> struct Polynomial_Traits<Float64x4> {
+	typedef Float64x4 Float_Type;
+	static Float64x4 zero() {
+		return static_cast<Float64x4>(0.0);
+	}
+	static Float64x4 load(const fp64* data, size_t count, size_t i) {
+		return {{data[i], data[count + i], data[2 * count + i], data[3 * count + i]}};
+	}
+	static Float64x4 add(const Float64x4& x, const Float64x4& y) {
+		return x + y;
+	}
+	static Float64x4 mul(const Float64x4& x, const Float64x4& y) {
+		return x * y;
+	}
+	static Float64x4 square(const Float64x4& x) {
+		return ::square(x);
+	}
+	static Float64x4 div(const Float64x4& x, const Float64x4& y) {
+		return x / y;
+	}
+};
+
+#ifdef __AVX__
+template<> struct Polynomial_Traits<__m256dx4> {
+	typedef Float64x4 Float_Type;
+	static __m256dx4 zero() {
+		return _mm256x4_setzero_pdx4();
+	}
+	static __m256dx4 load(const fp64* data, size_t count, size_t i) {
+		__m256dx4 ret;
+		ret.val[0] = _mm256_broadcast_sd(&data[i]);
+		ret.val[1] = _mm256_broadcast_sd(&data[count + i]);
+		ret.val[2] = _mm256_broadcast_sd(&data[2 * count + i]);
+		ret.val[3] = _mm256_broadcast_sd(&data[3 * count + i]);
+		return ret;
+	}
+	static __m256dx4 add(const __m256dx4& x, const __m256dx4& y) {
+		return _mm256x4_add_pdx4(x, y);
+	}
+	static __m256dx4 mul(const __m256dx4& x, const __m256dx4& y) {
+		return _mm256x4_mul_pdx4(x, y);
+	}
+	static __m256dx4 square(const __m256dx4& x) {
+		return _mm256x4_square_pdx4(x);
+	}
+	static __m256dx4 div(const __m256dx4& x, const __m256dx4& y) {
+		return _mm256x4_div_pdx4(x, y);
+	}
+};
+#endif
+
+} /* LIB-Dekker-Float namespace */
+
+#endif /* FLOAT64X4_POLYNOMIAL_HPP */
@@ -21,6 +21,7 @@
 #include "Float80x2_string.h"
 
 #include "Float80x2_LUT.hpp"
+#include "../LDF/LDF_trig_reduce.hpp"
 
 #include <cmath>
 #include <cstddef>
@@ -268,36 +269,99 @@ static Float80x2 cos_taylor(const Float80x2& a) {
 }
 
 
-/** 
- * @author Taken from libQD qd_real.cpp which can be found under a
- * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+/**
+ * @brief pi/2 split into four parts. The first part has 42 bits, so
+ * n * trig_pi2_split[0] is exact for |n| < 2^22.
  */
-Float80x2 sin(const Float80x2& a) {
-
-	/* Strategy.  To compute sin(x), we choose integers a, b so that
+static constexpr fp80 trig_pi2_split[4] = {
+	+0xc.90fdaa221400000p-3L, +0xa.308d313198a2e03p-45L,
+	+0xe.0e6894812704453p-110L, +0xf.98e804177d4c762p-176L
+};
 
-			 x = s + a * (pi/2) + b * (pi/1024)
+/** @brief Largest |a| that trig_modulo_pi2 reduces with trig_pi2_split */
+static constexpr fp80 trig_cody_waite_max = 0x1.0p+20L;
 
-		 and |s| <= pi/2048.  Using a precomputed table of
-		 sin(k pi / 1024) and cos(k pi / 1024), we can compute
-		 sin(x) from sin(s) and cos(s).  This greatly increases the
-		 convergence of the sine Taylor series.                          */
-
-	if (isequal_zero(a)) {
-		return static_cast<fp80>(0.0);
+/**
+ * @brief Returns t = a - j * (pi/2), where |t| <= pi/4 and j is in [-1, 2].
+ *
+ * @remarks Reducing against a rounded 2pi loses log2(|a| / 2pi) bits, and
+ * fails once the quadrant can no longer be resolved. Instead:
+ * - If |a| <= pi/4, a is returned as is.
+ * - If |a| <= 2^20, n = round(a / (pi/2)) is subtracted with a Cody-Waite
+ * split of pi/2.
+ * - Otherwise a is reduced with LDF::trig_reduce_pi2, which is accurate for
+ * any magnitude.
+ *
+ * @note a must be finite.
+ */
+static inline Float80x2 trig_modulo_pi2(const Float80x2& a, int& j) {
+	j = 0;
+	if (std::fabs(a.hi) <= LDF::const_pi4<fp80>()) {
+		return a;
+	}
+	if (std::fabs(a.hi) <= trig_cody_waite_max) {
+		const fp80 n = std::floor(
+			a.hi * (static_cast<fp80>(2.0) * LDF::const_inv_pi<fp80>()) + static_cast<fp80>(0.5)
+		);
+		Float80x2 t = a - n * trig_pi2_split[0];
+		t -= LDF::mul<Float80x2, fp80, fp80>(n, trig_pi2_split[1]);
+		t -= LDF::mul<Float80x2, fp80, fp80>(n, trig_pi2_split[2]);
+		t -= n * trig_pi2_split[3];
+		/* j = n mod 4, mapped to [-1, 2] */
+		j = static_cast<int>(static_cast<int32_t>(n) & 3);
+		if (j == 3) {
+			j = -1;
+		}
+		return t;
 	}
+	const fp80 limbs[2] = {a.hi, a.lo};
+	fp80 r[3];
+	j = LDF::trig_reduce_pi2(limbs, 2, r, 3);
+	if (j == 3) {
+		j = -1;
+	}
+	return (static_cast<Float80x2>(r[0]) + r[1]) + r[2];
+}
 
-	// approximately reduce modulo 2*pi
-	Float80x2 z = round(a / LDF::const_2pi<Float80x2>());
-	Float80x2 r = a - LDF::const_2pi<Float80x2>() * z;
+/**
+ * @brief Computes a = s + j / 2 + k / 1024 and returns t = s * pi, where
+ * |s| <= 1/2048, j is in [-1, 2] and k is in [-256, 256].
+ *
+ * @remarks Each limb is reduced modulo 2 by clearing its integer bits, which
+ * is exact. n / 1024 is then subtracted from the sum of the reduced limbs,
+ * which is within [-2, +2], so no bits are lost to cancellation.
+ */
+static inline Float80x2 trigpi_modulo(const Float80x2& a, int& j, int& k) {
+	j = 0;
+	k = 0;
+	if (!isfinite(a)) {
+		return std::numeric_limits<Float80x2>::quiet_NaN();
+	}
+	const fp80 y_hi = a.hi - static_cast<fp80>(2.0) * std::round(a.hi * static_cast<fp80>(0.5));
+	const fp80 y_lo = a.lo - static_cast<fp80>(2.0) * std::round(a.lo * static_cast<fp80>(0.5));
+	Float80x2 y = LDF::add<Float80x2, fp80, fp80>(y_hi, y_lo);
+	const fp80 n = std::round(y.hi * static_cast<fp80>(1024.0));
+	y = LDF::add<Float80x2, fp80, fp80>(y.hi - n * static_cast<fp80>(0x1.0p-10), y.lo);
+
+	const fp80 q = std::round(n * static_cast<fp80>(0x1.0p-9));
+	k = static_cast<int>(n - static_cast<fp80>(512.0) * q);
+	/* j = q mod 4, mapped to [-1, 2] */
+	j = static_cast<int>(q) & 3;
+	if (j == 3) {
+		j = -1;
+	}
+	return y * LDF::const_pi<Float80x2>();
+}
 
-	// approximately reduce modulo pi/2 and then modulo pi/1024
-	fp80 q = std::floor(r.hi / LDF::const_pi2<fp80>() + static_cast<fp80>(0.5));
-	Float80x2 t = r - LDF::const_pi2<Float80x2>() * q;
-	int j = static_cast<int>(q);
-	q = std::floor(t.hi / taylor_pi1024.hi + static_cast<fp80>(0.5));
-	t -= taylor_pi1024 * q;
-	int k = static_cast<int>(q);
+/**
+ * @brief Computes sin(t + j * (pi/2) + k * (pi/1024)) for the output of
+ * trig_modulo_pi2 or trigpi_modulo.
+ *
+ * @author Taken from libQD qd_real.cpp which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+static Float80x2 sin_reduced(const Float80x2& t, const int j, const int k) {
+	Float80x2 r;
 	int abs_k = std::abs(k);
 
 	if (j < -2 || j > 2) {
@@ -361,23 +425,42 @@ Float80x2 sin(const Float80x2& a) {
  * @author Taken from libQD qd_real.cpp which can be found under a
  * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
  */
-Float80x2 cos(const Float80x2& a) {
+Float80x2 sin(const Float80x2& a) {
+
+	/* Strategy.  To compute sin(x), we choose integers a, b so that
+
+			 x = s + a * (pi/2) + b * (pi/1024)
+
+		 and |s| <= pi/2048.  Using a precomputed table of
+		 sin(k pi / 1024) and cos(k pi / 1024), we can compute
+		 sin(x) from sin(s) and cos(s).  This greatly increases the
+		 convergence of the sine Taylor series.                          */
 
 	if (isequal_zero(a)) {
-		return static_cast<fp80>(1.0);
+		return static_cast<fp80>(0.0);
+	}
+	if (!isfinite(a)) {
+		return std::numeric_limits<Float80x2>::quiet_NaN();
 	}
 
-	// approximately reduce modulo 2*pi
-	Float80x2 z = round(a / LDF::const_2pi<Float80x2>());
-	Float80x2 r = a - LDF::const_2pi<Float80x2>() * z;
-
-	// approximately reduce modulo pi/2 and then modulo pi/1024
-	fp80 q = std::floor(r.hi / LDF::const_pi2<fp80>() + static_cast<fp80>(0.5));
-	Float80x2 t = r - LDF::const_pi2<Float80x2>() * q;
-	int j = static_cast<int>(q);
-	q = std::floor(t.hi / taylor_pi1024.hi + static_cast<fp80>(0.5));
+	// reduce modulo pi/2 and then modulo pi/1024
+	int j;
+	Float80x2 t = trig_modulo_pi2(a, j);
+	fp80 q = std::floor(t.hi / taylor_pi1024.hi + static_cast<fp80>(0.5));
 	t -= taylor_pi1024 * q;
 	int k = static_cast<int>(q);
+	return sin_reduced(t, j, k);
+}
+
+/**
+ * @brief Computes cos(t + j * (pi/2) + k * (pi/1024)) for the output of
+ * trig_modulo_pi2 or trigpi_modulo.
+ *
+ * @author Taken from libQD qd_real.cpp which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+static Float80x2 cos_reduced(const Float80x2& t, const int j, const int k) {
+	Float80x2 r;
 	int abs_k = std::abs(k);
 
 	if (j < -2 || j > 2) {
@@ -442,25 +525,35 @@ Float80x2 cos(const Float80x2& a) {
  * @author Taken from libQD qd_real.cpp which can be found under a
  * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
  */
-void sincos(const Float80x2& a, Float80x2& sin_a, Float80x2& cos_a) {
+Float80x2 cos(const Float80x2& a) {
 
 	if (isequal_zero(a)) {
-		sin_a = static_cast<fp80>(0.0);
-		cos_a = static_cast<fp80>(1.0);
-		return;
+		return static_cast<fp80>(1.0);
+	}
+	if (!isfinite(a)) {
+		return std::numeric_limits<Float80x2>::quiet_NaN();
 	}
 
-	// approximately reduce modulo 2*pi
-	Float80x2 z = round(a / LDF::const_2pi<Float80x2>());
-	Float80x2 r = a - LDF::const_2pi<Float80x2>() * z;
-
-	// approximately reduce modulo pi/2 and then modulo pi/1024
-	fp80 q = std::floor(r.hi / LDF::const_pi2<fp80>() + static_cast<fp80>(0.5));
-	Float80x2 t = r - LDF::const_pi2<Float80x2>() * q;
-	int j = static_cast<int>(q);
-	q = std::floor(t.hi / taylor_pi1024.hi + static_cast<fp80>(0.5));
+	// reduce modulo pi/2 and then modulo pi/1024
+	int j;
+	Float80x2 t = trig_modulo_pi2(a, j);
+	fp80 q = std::floor(t.hi / taylor_pi1024.hi + static_cast<fp80>(0.5));
 	t -= taylor_pi1024 * q;
 	int k = static_cast<int>(q);
+	return cos_reduced(t, j, k);
+}
+
+/**
+ * @brief Computes sin and cos of t + j * (pi/2) + k * (pi/1024) for the
+ * output of trig_modulo_pi2 or trigpi_modulo.
+ *
+ * @author Taken from libQD qd_real.cpp which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+static void sincos_reduced(
+	const Float80x2& t, const int j, const int k,
+	Float80x2& sin_a, Float80x2& cos_a
+) {
 	int abs_k = std::abs(k);
 
 	if (j < -2 || j > 2) {
@@ -533,6 +626,61 @@ void sincos(const Float80x2& a, Float80x2& sin_a, Float80x2& cos_a) {
 	}
 }
 
+/** 
+ * @author Taken from libQD qd_real.cpp which can be found under a
+ * LBNL-BSD license from https://www.davidhbailey.com/dhbsoftware/
+ */
+void sincos(const Float80x2& a, Float80x2& sin_a, Float80x2& cos_a) {
+
+	if (isequal_zero(a)) {
+		sin_a = static_cast<fp80>(0.0);
+		cos_a = static_cast<fp80>(1.0);
+		return;
+	}
+	if (!isfinite(a)) {
+		sin_a = std::numeric_limits<Float80x2>::quiet_NaN();
+		cos_a = std::numeric_limits<Float80x2>::quiet_NaN();
+		return;
+	}
+
+	// reduce modulo pi/2 and then modulo pi/1024
+	int j;
+	Float80x2 t = trig_modulo_pi2(a, j);
+	fp80 q = std::floor(t.hi / taylor_pi1024.hi + static_cast<fp80>(0.5));
+	t -= taylor_pi1024 * q;
+	int k = static_cast<int>(q);
+	sincos_reduced(t, j, k, sin_a, cos_a);
+}
+
+Float80x2 sinpi(const Float80x2& a) {
+	if (isequal_zero(a)) {
+		return static_cast<fp80>(0.0);
+	}
+	int j, k;
+	Float80x2 t = trigpi_modulo(a, j, k);
+	return sin_reduced(t, j, k);
+}
+
+Float80x2 cospi(const Float80x2& a) {
+	if (isequal_zero(a)) {
+		return static_cast<fp80>(1.0);
+	}
+	int j, k;
+	Float80x2 t = trigpi_modulo(a, j, k);
+	return cos_reduced(t, j, k);
+}
+
+void sincospi(const Float80x2& a, Float80x2& sin_a, Float80x2& cos_a) {
+	if (isequal_zero(a)) {
+		sin_a = static_cast<fp80>(0.0);
+		cos_a = static_cast<fp80>(1.0);
+		return;
+	}
+	int j, k;
+	Float80x2 t = trigpi_modulo(a, j, k);
+	sincos_reduced(t, j, k, sin_a, cos_a);
+}
+
 //------------------------------------------------------------------------------
 // Float80x2 pown
 //------------------------------------------------------------------------------
@@ -20,6 +20,7 @@
 typedef long double Float80x2_Math;
 
 #include "../LDF/LDF_arithmetic.hpp"
+#include "../LDF/LDF_fma.h"
 
 //------------------------------------------------------------------------------
 // Float80x2 LDF Type Information
@@ -236,6 +237,12 @@ Float80x2 LDF::sub<Float80x2, Float80x2, Float80x2>
 template <> inline
 Float80x2 LDF::mul<Float80x2, fp80, fp80>
 (const fp80& x, const fp80& y) {
+#ifdef LDF_ENABLE_FMA_FLOAT80
+	Float80x2 r;
+	r.hi = x * y;
+	r.lo = std::fma(x, y, -r.hi);
+	return r;
+#else
 	Float80x2 a = dekker_split(x);
 	Float80x2 b = dekker_split(y);
 	fp80 p = a.hi * b.hi;
@@ -245,6 +252,7 @@ Float80x2 LDF::mul<Float80x2, fp80, fp80>
 	r.hi = p + q;
 	r.lo = p - r.hi + q + a.lo * b.lo;
 	return r;
+#endif
 }
 
 template <> inline
@@ -278,6 +286,12 @@ Float80x2 LDF::div<Float80x2, Float80x2, Float80x2>
 template <> inline
 Float80x2 LDF::square<Float80x2, fp80>
 (const fp80& x) {
+#ifdef LDF_ENABLE_FMA_FLOAT80
+	Float80x2 r;
+	r.hi = x * x;
+	r.lo = std::fma(x, x, -r.hi);
+	return r;
+#else
 	Float80x2 a = dekker_split(x);
 	fp80 p = a.hi * a.hi;
 	fp80 q = static_cast<fp80>(2.0) * (a.hi * a.lo);
@@ -286,6 +300,7 @@ Float80x2 LDF::square<Float80x2, fp80>
 	r.hi = p + q;
 	r.lo = ((p - r.hi) + q) + (a.lo * a.lo);
 	return r;
+#endif
 }
 
 template <> inline
@@ -1057,6 +1072,19 @@ namespace std {
 		return sin_val / cos_val;
 	}
 
+	/** @brief Calculates `sin(pi * x)` with an exact argument reduction */
+	Float80x2 sinpi(const Float80x2& x);
+	/** @brief Calculates `cos(pi * x)` with an exact argument reduction */
+	Float80x2 cospi(const Float80x2& x);
+
+	void sincospi(const Float80x2& x, Float80x2& p_sin, Float80x2& p_cos);
+
+	inline Float80x2 tanpi(const Float80x2& x) {
+		Float80x2 sin_val, cos_val;
+		sincospi(x, sin_val, cos_val);
+		return sin_val / cos_val;
+	}
+
 	/** 
 	 * @note casts to Float80x2_Math for calculation as this function is not
 	 * currently implemeneted.
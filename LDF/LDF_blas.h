@@ -0,0 +1,37 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#ifndef LDF_BLAS_H
+#define LDF_BLAS_H
+
+/**
+ * @brief Matrix layout and transpose options for the BLAS functions. The
+ * values match CBLAS, so CBLAS_LAYOUT and CBLAS_TRANSPOSE can be cast.
+ */
+
+#include "../LDF_config.h"
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+typedef enum LDF_blas_layout {
+	LDF_BLAS_ROW_MAJOR = 101,
+	LDF_BLAS_COL_MAJOR = 102
+} LDF_blas_layout;
+
+typedef enum LDF_blas_transpose {
+	LDF_BLAS_NO_TRANS = 111,
+	LDF_BLAS_TRANS    = 112
+} LDF_blas_transpose;
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* LDF_BLAS_H */
@@ -0,0 +1,155 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "LDF_cpu_dispatch.h"
+
+#include <stdint.h>
+
+#ifdef LDF_CPU_DISPATCH_X86
+	#if defined(_MSC_VER) && !defined(__clang__)
+		#include <intrin.h>
+	#elif defined(__GNUC__)
+		#include <cpuid.h>
+	#endif
+#endif
+
+//------------------------------------------------------------------------------
+// cpuid
+//------------------------------------------------------------------------------
+
+#ifdef LDF_CPU_DISPATCH_X86
+
+/**
+ * @brief Executes cpuid with the given leaf and subleaf.
+ * @note regs is written as {eax, ebx, ecx, edx}
+ */
+static void LDF_cpuid(uint32_t regs[4], uint32_t leaf, uint32_t subleaf) {
+	#if defined(_MSC_VER) && !defined(__clang__)
+		int temp[4];
+		__cpuidex(temp, (int)leaf, (int)subleaf);
+		for (int i = 0; i < 4; i++) {
+			regs[i] = (uint32_t)temp[i];
+		}
+	#elif defined(__GNUC__)
+		unsigned int eax, ebx, ecx, edx;
+		__cpuid_count(leaf, subleaf, eax, ebx, ecx, edx);
+		regs[0] = eax; regs[1] = ebx; regs[2] = ecx; regs[3] = edx;
+	#else
+		(void)leaf; (void)subleaf;
+		regs[0] = 0; regs[1] = 0; regs[2] = 0; regs[3] = 0;
+	#endif
+}
+
+/**
+ * @brief Reads XCR0, which holds the register states saved by the OS.
+ * @note Only call this when cpuid reports OSXSAVE.
+ */
+static uint64_t LDF_xgetbv0(void) {
+	#if defined(_MSC_VER) && !defined(__clang__)
+		return (uint64_t)_xgetbv(0);
+	#elif defined(__GNUC__)
+		uint32_t lo, hi;
+		__asm__ __volatile__ ("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+		return ((uint64_t)hi << 32) | (uint64_t)lo;
+	#else
+		return 0;
+	#endif
+}
+
+#endif /* LDF_CPU_DISPATCH_X86 */
+
+//------------------------------------------------------------------------------
+// LDF_cpu_level
+//------------------------------------------------------------------------------
+
+LDF_cpu_level LDF_cpu_detect_level(void) {
+	#ifdef LDF_CPU_DISPATCH_X86
+		uint32_t leaf_0[4], leaf_1[4], leaf_7[4] = {0, 0, 0, 0};
+		LDF_cpuid(leaf_0, 0, 0);
+		const uint32_t max_leaf = leaf_0[0];
+		if (max_leaf < 1) {
+			return LDF_CPU_LEVEL_SCALAR;
+		}
+		LDF_cpuid(leaf_1, 1, 0);
+		if (max_leaf >= 7) {
+			LDF_cpuid(leaf_7, 7, 0);
+		}
+
+		const int has_sse2    = (leaf_1[3] >> 26) & 1;
+		const int has_fma     = (leaf_1[2] >> 12) & 1;
+		const int has_osxsave = (leaf_1[2] >> 27) & 1;
+		const int has_avx     = (leaf_1[2] >> 28) & 1;
+		const int has_avx2    = (leaf_7[1] >>  5) & 1;
+		const int has_avx512f = (leaf_7[1] >> 16) & 1;
+
+		if (!has_sse2) {
+			return LDF_CPU_LEVEL_SCALAR;
+		}
+		if (!has_avx || !has_osxsave) {
+			return LDF_CPU_LEVEL_SSE2;
+		}
+		const uint64_t xcr0 = LDF_xgetbv0();
+		// XMM and YMM state
+		if ((xcr0 & 0x06) != 0x06) {
+			return LDF_CPU_LEVEL_SSE2;
+		}
+		if (!has_avx2 || !has_fma) {
+			return LDF_CPU_LEVEL_AVX;
+		}
+		// opmask, upper ZMM0-15, and ZMM16-31 state
+		if (!has_avx512f || (xcr0 & 0xE0) != 0xE0) {
+			return LDF_CPU_LEVEL_AVX2_FMA;
+		}
+		return LDF_CPU_LEVEL_AVX512;
+	#else
+		return LDF_CPU_LEVEL_SCALAR;
+	#endif
+}
+
+/** -1 until the level has been detected */
+static int LDF_cpu_level_cache = -1;
+
+LDF_cpu_level LDF_cpu_get_level(void) {
+	if (LDF_cpu_level_cache < 0) {
+		LDF_cpu_level_cache = (int)LDF_cpu_detect_level();
+	}
+	return (LDF_cpu_level)LDF_cpu_level_cache;
+}
+
+LDF_cpu_level LDF_cpu_set_level(LDF_cpu_level level) {
+	const LDF_cpu_level detected = LDF_cpu_detect_level();
+	if ((int)level > (int)detected) {
+		level = detected;
+	}
+	if ((int)level < 0) {
+		level = LDF_CPU_LEVEL_SCALAR;
+	}
+	LDF_cpu_level_cache = (int)level;
+	return level;
+}
+
+const char* LDF_cpu_level_name(LDF_cpu_level level) {
+	switch (level) {
+		case LDF_CPU_LEVEL_SCALAR  : return "Scalar";
+		case LDF_CPU_LEVEL_SSE2    : return "SSE2";
+		case LDF_CPU_LEVEL_AVX     : return "AVX";
+		case LDF_CPU_LEVEL_AVX2_FMA: return "AVX2+FMA";
+		case LDF_CPU_LEVEL_AVX512  : return "AVX512";
+		default: return "Unknown";
+	}
+}
+
+#if defined(__GNUC__)
+/**
+ * @brief Detects the level at startup, so that the dispatched functions don't
+ * race to initialize it from multiple threads.
+ */
+__attribute__((constructor)) static void LDF_cpu_level_init(void) {
+	(void)LDF_cpu_get_level();
+}
+#endif
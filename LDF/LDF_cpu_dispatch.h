@@ -0,0 +1,116 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#ifndef LDF_CPU_DISPATCH_H
+#define LDF_CPU_DISPATCH_H
+
+/**
+ * @brief Detects which SIMD implementations can run on the current CPU.
+ *
+ * The level is detected once with cpuid/xgetbv, so that a single binary can
+ * select between the SSE2, AVX, AVX2+FMA, and AVX512 kernels at runtime.
+ * A level is only reported when the operating system also saves the
+ * corresponding vector registers.
+ */
+
+#include "../LDF_config.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+	#define LDF_CPU_DISPATCH_X86
+#endif
+
+/**
+ * LDF_ENABLE_DISPATCH_<level> is defined when the kernels for that level are
+ * compiled and linked. All levels are enabled on x86 by default.
+ */
+
+#ifdef LDF_TOGGLE_DISPATCH_SSE2
+	#if LDF_TOGGLE_DISPATCH_SSE2 != 0
+		#define LDF_ENABLE_DISPATCH_SSE2
+	#endif
+#elif defined(LDF_CPU_DISPATCH_X86)
+	#define LDF_ENABLE_DISPATCH_SSE2
+#endif
+
+#ifdef LDF_TOGGLE_DISPATCH_AVX
+	#if LDF_TOGGLE_DISPATCH_AVX != 0
+		#define LDF_ENABLE_DISPATCH_AVX
+	#endif
+#elif defined(LDF_CPU_DISPATCH_X86)
+	#define LDF_ENABLE_DISPATCH_AVX
+#endif
+
+#ifdef LDF_TOGGLE_DISPATCH_AVX2_FMA
+	#if LDF_TOGGLE_DISPATCH_AVX2_FMA != 0
+		#define LDF_ENABLE_DISPATCH_AVX2_FMA
+	#endif
+#elif defined(LDF_CPU_DISPATCH_X86)
+	#define LDF_ENABLE_DISPATCH_AVX2_FMA
+#endif
+
+#ifdef LDF_TOGGLE_DISPATCH_AVX512
+	#if LDF_TOGGLE_DISPATCH_AVX512 != 0
+		#define LDF_ENABLE_DISPATCH_AVX512
+	#endif
+#elif defined(LDF_CPU_DISPATCH_X86)
+	#define LDF_ENABLE_DISPATCH_AVX512
+#endif
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+/**
+ * @brief SIMD implementations ordered from slowest to fastest. Each level
+ * implies that all of the lower levels are also supported.
+ */
+typedef enum LDF_cpu_level {
+	/** portable C implementation */
+	LDF_CPU_LEVEL_SCALAR   = 0,
+	/** __m128dx2 */
+	LDF_CPU_LEVEL_SSE2     = 1,
+	/** __m256dx2 */
+	LDF_CPU_LEVEL_AVX      = 2,
+	/** __m256dx2 with _mm256_fmsub_pd */
+	LDF_CPU_LEVEL_AVX2_FMA = 3,
+	/** __m512dx2, only AVX512F is required */
+	LDF_CPU_LEVEL_AVX512   = 4
+} LDF_cpu_level;
+
+#define LDF_CPU_LEVEL_COUNT 5
+
+/**
+ * @brief Queries cpuid every time it is called. Use LDF_cpu_get_level
+ * instead, which caches the result.
+ */
+LDF_cpu_level LDF_cpu_detect_level(void);
+
+/**
+ * @brief Returns the level used by the dispatched functions. This is the
+ * detected level unless it has been lowered with LDF_cpu_set_level.
+ */
+LDF_cpu_level LDF_cpu_get_level(void);
+
+/**
+ * @brief Overrides the level used by the dispatched functions. Useful for
+ * testing, or for getting the same results on every machine.
+ * @note The level is clamped to the detected level.
+ * @returns the level that was set.
+ */
+LDF_cpu_level LDF_cpu_set_level(LDF_cpu_level level);
+
+/**
+ * @brief Returns the name of a level, such as "AVX2+FMA"
+ */
+const char* LDF_cpu_level_name(LDF_cpu_level level);
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif /* LDF_CPU_DISPATCH_H */
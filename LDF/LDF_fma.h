@@ -0,0 +1,46 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#ifndef LDF_FMA_H
+#define LDF_FMA_H
+
+/**
+ * @brief Selects between the Dekker split and the fused-multiply-add
+ * implementations of the exact product (two_prod/mul12).
+ *
+ * LDF_ENABLE_FMA is defined when fp32/fp64 fma is done in hardware.
+ * LDF_ENABLE_FMA_FLOAT80 is defined when fp80 fma should be used. This is off
+ * by default since x87 has no fused-multiply-add instruction, and `fmal` is
+ * emulated in software.
+ * LDF_ENABLE_FMA_SIMD is defined when the FMA3 intrinsics (`_mm256_fmsub_pd`
+ * etc.) can be used by the SSE/AVX implementations.
+ */
+
+#include "../LDF_config.h"
+
+#ifdef LDF_TOGGLE_FMA
+	#if LDF_TOGGLE_FMA != 0
+		#define LDF_ENABLE_FMA
+	#endif
+#else
+	#if defined(__FMA__) || defined(__FMA4__) || defined(__ARM_FEATURE_FMA)
+		#define LDF_ENABLE_FMA
+	#endif
+#endif
+
+#if defined(LDF_ENABLE_FMA) && defined(__FMA__)
+	#define LDF_ENABLE_FMA_SIMD
+#endif
+
+#ifdef LDF_TOGGLE_FMA_FLOAT80
+	#if LDF_TOGGLE_FMA_FLOAT80 != 0
+		#define LDF_ENABLE_FMA_FLOAT80
+	#endif
+#endif
+
+#endif /* LDF_FMA_H */
@@ -0,0 +1,214 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#ifndef LDF_POLYNOMIAL_HPP
+#define LDF_POLYNOMIAL_HPP
+
+/**
+ * @brief Horner and Estrin evaluation of polynomials and rational functions
+ * with Dekker-Float coefficients.
+ *
+ * The same Split_Polynomial can be evaluated with scalar or SIMD values. The
+ * value types are described by a Polynomial_Traits specialization, which are
+ * provided by Float64x2_polynomial.hpp and Float64x4_polynomial.hpp.
+ *
+ * Horner's scheme uses the fewest operations, but every step depends on the
+ * previous one. Estrin's scheme uses log2(n) extra squarings, but the
+ * dependency chain is only O(log2(n)) steps long, which is usually faster for
+ * high degree polynomials.
+ */
+
+#include "LDF_float_types.h"
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+/* LIB-Dekker-Float namespace */
+namespace LDF {
+
+/**
+ * @brief Specializations describe how to evaluate polynomials with values of
+ * type V:
+ * - `Float_Type` the Dekker-Float type of the coefficients.
+ * - `V zero()`
+ * - `V load(const fp64* data, size_t count, size_t i)` broadcasts coefficient
+ *   i, where limb j of coefficient i is stored at data[j * count + i].
+ * - `V add(V x, V y)`, `V mul(V x, V y)`, `V square(V x)`, `V div(V x, V y)`
+ */
+template <typename V> struct Polynomial_Traits;
+
+/**
+ * @brief Stores the coefficients of c[0] + c[1] * x + ... + c[n - 1] * x^(n - 1)
+ * with each limb in its own array, so that the hi parts are contiguous, then
+ * the lo parts, and so on.
+ */
+template <typename T>
+class Split_Polynomial {
+public:
+	static constexpr size_t Limb_Count = sizeof(T) / sizeof(fp64);
+
+	Split_Polynomial() : coef_count(0) {}
+
+	/** @brief Copies count coefficients, starting with the constant term */
+	Split_Polynomial(const T* coef, size_t count) :
+		coef_count(count), limbs(count * Limb_Count)
+	{
+		for (size_t i = 0; i < count; i++) {
+			fp64 limb[Limb_Count];
+			std::memcpy(limb, &coef[i], sizeof(T));
+			for (size_t j = 0; j < Limb_Count; j++) {
+				limbs[j * count + i] = limb[j];
+			}
+		}
+	}
+
+	/** @brief Returns the number of coefficients, which is the degree + 1 */
+	size_t size() const {
+		return coef_count;
+	}
+
+	/** @brief Returns coefficient i */
+	T coef(size_t i) const {
+		fp64 limb[Limb_Count];
+		for (size_t j = 0; j < Limb_Count; j++) {
+			limb[j] = limbs[j * coef_count + i];
+		}
+		T ret;
+		std::memcpy(&ret, limb, sizeof(T));
+		return ret;
+	}
+
+	/** @brief limb j of coefficient i is stored at data()[j * size() + i] */
+	const fp64* data() const {
+		return limbs.data();
+	}
+
+private:
+	size_t coef_count;
+	std::vector<fp64> limbs;
+};
+
+//------------------------------------------------------------------------------
+// Polynomials
+//------------------------------------------------------------------------------
+
+/** @brief Evaluates coefficients [begin, begin + count) with Horner's scheme */
+template <typename V, typename T>
+V polynomial_horner(
+	const Split_Polynomial<T>& poly, size_t begin, size_t count, const V& x
+) {
+	typedef Polynomial_Traits<V> Traits;
+	if (count == 0) {
+		return Traits::zero();
+	}
+	const fp64* data = poly.data();
+	const size_t size = poly.size();
+	V ret = Traits::load(data, size, begin + count - 1);
+	for (size_t i = count - 1; i-- > 0;) {
+		ret = Traits::add(Traits::mul(ret, x), Traits::load(data, size, begin + i));
+	}
+	return ret;
+}
+
+/**
+ * @brief Evaluates coefficients [begin, begin + count) with Estrin's scheme.
+ * powers[k] holds x^(2^k). The low 2^k coefficients and the remaining high
+ * coefficients are evaluated independently, then combined with
+ * low + x^(2^k) * high.
+ */
+template <typename V, typename T>
+V polynomial_estrin(
+	const Split_Polynomial<T>& poly, size_t begin, size_t count, const V* powers
+) {
+	typedef Polynomial_Traits<V> Traits;
+	const fp64* data = poly.data();
+	const size_t size = poly.size();
+	if (count == 1) {
+		return Traits::load(data, size, begin);
+	}
+	if (count == 2) {
+		return Traits::add(
+			Traits::load(data, size, begin),
+			Traits::mul(powers[0], Traits::load(data, size, begin + 1))
+		);
+	}
+	int k = 0;
+	while (((size_t)2 << k) < count) {
+		k++;
+	}
+	const size_t low_count = (size_t)1 << k;
+	V low = polynomial_estrin(poly, begin, low_count, powers);
+	V high = polynomial_estrin(poly, begin + low_count, count - low_count, powers);
+	return Traits::add(low, Traits::mul(powers[k], high));
+}
+
+/**
+ * @brief Sets powers[k] = x^(2^k) for every 2^k < count, which is what
+ * polynomial_estrin uses for count coefficients.
+ */
+template <typename V>
+void polynomial_estrin_powers(const V& x, size_t count, V* powers) {
+	typedef Polynomial_Traits<V> Traits;
+	powers[0] = x;
+	for (int k = 1; ((size_t)1 << k) < count; k++) {
+		powers[k] = Traits::square(powers[k - 1]);
+	}
+}
+
+/** @brief Returns the polynomial evaluated at x with Horner's scheme */
+template <typename V, typename T>
+V horner(const Split_Polynomial<T>& poly, const V& x) {
+	return polynomial_horner(poly, 0, poly.size(), x);
+}
+
+/** @brief Returns the polynomial evaluated at x with Estrin's scheme */
+template <typename V, typename T>
+V estrin(const Split_Polynomial<T>& poly, const V& x) {
+	typedef Polynomial_Traits<V> Traits;
+	if (poly.size() == 0) {
+		return Traits::zero();
+	}
+	V powers[sizeof(size_t) * 8];
+	polynomial_estrin_powers(x, poly.size(), powers);
+	return polynomial_estrin(poly, 0, poly.size(), powers);
+}
+
+//------------------------------------------------------------------------------
+// Rational functions
+//------------------------------------------------------------------------------
+
+/** @brief Returns num(x) / den(x) with Horner's scheme */
+template <typename V, typename T>
+V rational_horner(
+	const Split_Polynomial<T>& num, const Split_Polynomial<T>& den, const V& x
+) {
+	typedef Polynomial_Traits<V> Traits;
+	return Traits::div(horner(num, x), horner(den, x));
+}
+
+/**
+ * @brief Returns num(x) / den(x) with Estrin's scheme. The powers of x are
+ * shared by both polynomials.
+ */
+template <typename V, typename T>
+V rational_estrin(
+	const Split_Polynomial<T>& num, const Split_Polynomial<T>& den, const V& x
+) {
+	typedef Polynomial_Traits<V> Traits;
+	V powers[sizeof(size_t) * 8];
+	polynomial_estrin_powers(x, (num.size() > den.size()) ? num.size() : den.size(), powers);
+	return Traits::div(
+		(num.size() == 0) ? Traits::zero() : polynomial_estrin(num, 0, num.size(), powers),
+		(den.size() == 0) ? Traits::zero() : polynomial_estrin(den, 0, den.size(), powers)
+	);
+}
+
+} /* LIB-Dekker-Float namespace */
+
+#endif /* LDF_POLYNOMIAL_HPP */
@@ -0,0 +1,122 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "LDF_thread_pool.hpp"
+
+namespace LDF {
+
+/** Set on worker threads, and on the calling thread while it runs tasks */
+static thread_local bool Thread_Pool_inside_task = false;
+
+Thread_Pool::Thread_Pool(size_t thread_count) :
+	current_task(nullptr), current_count(0), next_index(0),
+	busy_workers(0), generation(0), stopping(false)
+{
+	if (thread_count == 0) {
+		thread_count = std::thread::hardware_concurrency();
+	}
+	for (size_t i = 1; i < thread_count; i++) {
+		workers.emplace_back(&Thread_Pool::worker_loop, this);
+	}
+}
+
+Thread_Pool::~Thread_Pool() {
+	{
+		std::lock_guard<std::mutex> lock(state_mutex);
+		stopping = true;
+	}
+	work_ready.notify_all();
+	for (std::thread& worker : workers) {
+		worker.join();
+	}
+}
+
+void Thread_Pool::execute_tasks() {
+	for (;;) {
+		size_t i = next_index.fetch_add(1, std::memory_order_relaxed);
+		if (i >= current_count) {
+			return;
+		}
+		try {
+			(*current_task)(i);
+		} catch (...) {
+			std::lock_guard<std::mutex> lock(state_mutex);
+			if (!first_exception) {
+				first_exception = std::current_exception();
+			}
+		}
+	}
+}
+
+void Thread_Pool::worker_loop() {
+	Thread_Pool_inside_task = true;
+	uint64_t seen_generation = 0;
+	std::unique_lock<std::mutex> lock(state_mutex);
+	for (;;) {
+		work_ready.wait(lock, [&] {
+			return stopping || generation != seen_generation;
+		});
+		if (stopping) {
+			return;
+		}
+		seen_generation = generation;
+		lock.unlock();
+		execute_tasks();
+		lock.lock();
+		busy_workers--;
+		if (busy_workers == 0) {
+			work_done.notify_one();
+		}
+	}
+}
+
+void Thread_Pool::run(size_t task_count, const std::function<void(size_t)>& task) {
+	if (task_count == 0) {
+		return;
+	}
+	if (workers.empty() || task_count == 1 || Thread_Pool_inside_task) {
+		for (size_t i = 0; i < task_count; i++) {
+			task(i);
+		}
+		return;
+	}
+	std::lock_guard<std::mutex> run_lock(run_mutex);
+	{
+		std::lock_guard<std::mutex> lock(state_mutex);
+		current_task = &task;
+		current_count = task_count;
+		next_index.store(0, std::memory_order_relaxed);
+		busy_workers = workers.size();
+		first_exception = nullptr;
+		generation++;
+	}
+	work_ready.notify_all();
+
+	Thread_Pool_inside_task = true;
+	execute_tasks();
+	Thread_Pool_inside_task = false;
+
+	std::exception_ptr exception;
+	{
+		std::unique_lock<std::mutex> lock(state_mutex);
+		work_done.wait(lock, [&] { return busy_workers == 0; });
+		current_task = nullptr;
+		exception = first_exception;
+		first_exception = nullptr;
+	}
+	if (exception) {
+		std::rethrow_exception(exception);
+	}
+}
+
+Thread_Pool& Thread_Pool::get_default() {
+	static Thread_Pool pool;
+	return pool;
+}
+
+} /* LIB-Dekker-Float namespace */
@@ -0,0 +1,145 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#ifndef LDF_THREAD_POOL_HPP
+#define LDF_THREAD_POOL_HPP
+
+/**
+ * @brief A small std::thread pool, and a reduction that gives bitwise
+ * identical results regardless of the number of threads.
+ *
+ * @note Link with -pthread (Threads::Threads in CMake).
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* LIB-Dekker-Float namespace */
+namespace LDF {
+
+class Thread_Pool {
+public:
+	/**
+	 * @brief Starts thread_count - 1 worker threads, since the thread that
+	 * calls run() also executes tasks.
+	 * @param thread_count 0 uses std::thread::hardware_concurrency().
+	 */
+	explicit Thread_Pool(size_t thread_count = 0);
+
+	/** @brief Joins the worker threads */
+	~Thread_Pool();
+
+	Thread_Pool(const Thread_Pool&) = delete;
+	Thread_Pool& operator=(const Thread_Pool&) = delete;
+
+	/** @brief Returns the number of threads, including the calling thread */
+	size_t thread_count() const {
+		return workers.size() + 1;
+	}
+
+	/**
+	 * @brief Calls task(i) for every i in [0, task_count), and returns once all
+	 * of the tasks have finished. Tasks may run in any order on any thread.
+	 * If a task throws, the first exception is rethrown by run().
+	 * @note Calling run() from inside a task executes the inner tasks serially
+	 * on the current thread.
+	 */
+	void run(size_t task_count, const std::function<void(size_t)>& task);
+
+	/**
+	 * @brief Returns a pool shared by the whole program, which is created on
+	 * first use with std::thread::hardware_concurrency() threads.
+	 */
+	static Thread_Pool& get_default();
+
+private:
+	void worker_loop();
+	void execute_tasks();
+
+	std::vector<std::thread> workers;
+
+	/** Serializes calls to run() from different threads */
+	std::mutex run_mutex;
+
+	std::mutex state_mutex;
+	std::condition_variable work_ready;
+	std::condition_variable work_done;
+	const std::function<void(size_t)>* current_task;
+	size_t current_count;
+	std::atomic<size_t> next_index;
+	size_t busy_workers;
+	uint64_t generation;
+	bool stopping;
+	std::exception_ptr first_exception;
+};
+
+/**
+ * @brief Number of elements reduced by each block of reproducible_reduce.
+ * Changing this changes the rounding of the results.
+ */
+constexpr size_t reproducible_block_size = 4096;
+
+/**
+ * @brief Splits [0, n) into blocks of reproducible_block_size elements, calls
+ * block_func(begin, end) on each block in parallel, and combines the partial
+ * results with combine_func(x, y) in a pairwise tree.
+ *
+ * The blocks and the shape of the tree only depend on n, so the result is
+ * bitwise identical for any thread count, as long as block_func is
+ * deterministic.
+ */
+template <typename T, typename Block_Func, typename Combine_Func>
+T reproducible_reduce(
+	Thread_Pool& pool, size_t n, const T& zero,
+	const Block_Func& block_func, const Combine_Func& combine_func
+) {
+	if (n == 0) {
+		return zero;
+	}
+	const size_t block_count =
+		(n + reproducible_block_size - 1) / reproducible_block_size;
+	std::vector<T> partial(block_count, zero);
+
+	/* Several blocks per task to amortize the scheduling overhead */
+	const size_t task_count = pool.thread_count() * 4;
+	const size_t blocks_per_task = (block_count + task_count - 1) / task_count;
+	pool.run(
+		(block_count + blocks_per_task - 1) / blocks_per_task,
+		[&](size_t task) {
+			size_t block = task * blocks_per_task;
+			size_t block_end = block + blocks_per_task;
+			if (block_end > block_count) {
+				block_end = block_count;
+			}
+			for (; block < block_end; block++) {
+				size_t begin = block * reproducible_block_size;
+				size_t end = begin + reproducible_block_size;
+				partial[block] = block_func(begin, (end < n) ? end : n);
+			}
+		}
+	);
+
+	/* ((p0 + p1) + (p2 + p3)) + ((p4 + p5) + ...) */
+	for (size_t stride = 1; stride < block_count; stride *= 2) {
+		for (size_t i = 0; i + stride < block_count; i += 2 * stride) {
+			partial[i] = combine_func(partial[i], partial[i + stride]);
+		}
+	}
+	return partial[0];
+}
+
+} /* LIB-Dekker-Float namespace */
+
+#endif /* LDF_THREAD_POOL_HPP */
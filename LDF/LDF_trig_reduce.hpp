@@ -0,0 +1,64 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#ifndef LDF_TRIG_REDUCE_HPP
+#define LDF_TRIG_REDUCE_HPP
+
+/**
+ * @brief Payne-Hanek reduction of large trigonometric arguments modulo pi/2.
+ *
+ * The input is the unevaluated sum of the limbs of a Dekker-Float. Each limb
+ * is multiplied by a stored 2/pi table using integer arithmetic, keeping only
+ * the bits that affect the result modulo 4. The cost only depends on the
+ * number of limbs, so any finite input is reduced in bounded time.
+ */
+
+#include "LDF_float_types.h"
+
+#include <cstddef>
+
+/* LIB-Dekker-Float namespace */
+namespace LDF {
+
+#ifdef LDF_ENABLE_FLOAT64
+/**
+ * @brief Computes x = r + j * (pi/2), where x is the sum of x_count limbs
+ * and |r| <= pi/4.
+ *
+ * @param ret Receives ret_count non-overlapping limbs of r, in order of
+ * decreasing magnitude. Each limb holds up to 53 bits of r, truncated.
+ * @returns j modulo 4, in the range [0, 3].
+ *
+ * @note r is accurate to about 600 bits, minus the number of leading zeros
+ * that cancel out when x is close to a multiple of pi/2.
+ * @note If any limb is not finite, ret is set to NaN and 0 is returned.
+ */
+int trig_reduce_pi2(
+	const LDF_Float64* x, size_t x_count, LDF_Float64* ret, size_t ret_count
+);
+#endif
+
+#ifdef LDF_ENABLE_FLOAT80
+/**
+ * @brief Computes x = r + j * (pi/2), where x is the sum of x_count limbs
+ * and |r| <= pi/4.
+ *
+ * @param ret Receives ret_count non-overlapping limbs of r, in order of
+ * decreasing magnitude. Each limb holds up to 64 bits of r, truncated.
+ * @returns j modulo 4, in the range [0, 3].
+ *
+ * @note If any limb is not finite, ret is set to NaN and 0 is returned.
+ */
+int trig_reduce_pi2(
+	const LDF_Float80* x, size_t x_count, LDF_Float80* ret, size_t ret_count
+);
+#endif
+
+} /* LIB-Dekker-Float namespace */
+
+#endif /* LDF_TRIG_REDUCE_HPP */
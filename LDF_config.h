@@ -27,6 +27,29 @@
 // #define LDF_TOGGLE_CXX20_NUMBERS          0
 // #define LDF_TOGGLE_CXX17_IF_CONSTEXPR     0
 
+/**
+ * Computes the error term of `x * y` with a single fused-multiply-add instead
+ * of splitting both operands. Automatically enabled when compiling with
+ * `-mfma` (`__FMA__`).
+ */
+// #define LDF_TOGGLE_FMA                    0
+
+/**
+ * Same as LDF_TOGGLE_FMA but for Float80x2. Disabled by default since `fmal`
+ * is emulated in software on x87.
+ */
+// #define LDF_TOGGLE_FMA_FLOAT80            0
+
+/**
+ * Selects which SIMD kernels the runtime CPU dispatch (LDF_cpu_dispatch.h)
+ * can use. All levels are enabled by default on x86. Disable a level if its
+ * `*_array_<ISA>.c` files are not compiled.
+ */
+// #define LDF_TOGGLE_DISPATCH_SSE2          0
+// #define LDF_TOGGLE_DISPATCH_AVX           0
+// #define LDF_TOGGLE_DISPATCH_AVX2_FMA      0
+// #define LDF_TOGGLE_DISPATCH_AVX512        0
+
 //------------------------------------------------------------------------------
 // C/C++ Keyword Overrides
 //------------------------------------------------------------------------------
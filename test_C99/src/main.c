@@ -11,6 +11,8 @@
 #include "Float64x4/Float64x4_AVX.h"
 #include "Float64x4/Float64x4.h"
 
+#include "test_common.h"
+
 #include <stdio.h>
 #include <limits.h>
 #include <float.h>
@@ -82,6 +84,15 @@ int main(void) {
 	
 	func();
 
+	int fails = 0;
+	fails += test_lgamma();
+	fails += test_dispatch();
+	fails += test_array();
+	fails += test_blas();
+	fails += test_gemm();
+	fails += test_sum();
+	printf("%d test failure%s\n", fails, (fails == 1) ? "" : "s");
+
 	fflush(stdout);
-	return 0;
+	return (fails == 0) ? 0 : 1;
 }
@@ -0,0 +1,312 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "test_common.h"
+
+#include "LDF/LDF_cpu_dispatch.h"
+#include "Float64x3/Float64x3.h"
+#include "Float64x3/Float64x3_array.h"
+#include "Float64x4/Float64x4.h"
+#include "Float64x4/Float64x4_array.h"
+#include "Float32x2/Float32x2_array.h"
+
+#include <math.h>
+#include <string.h>
+
+/* Not a multiple of 16, so that the scalar tail is tested at every level */
+#define TEST_ARRAY_COUNT 37
+
+//------------------------------------------------------------------------------
+// Float64x4
+//------------------------------------------------------------------------------
+
+typedef struct Float64x4_unary_case {
+	const char* name;
+	void (*array_func)(const Float64x4*, Float64x4*, size_t);
+	Float64x4 (*scalar_func)(Float64x4);
+	fp64 min;
+	fp64 max;
+	fp64 tolerance;
+} Float64x4_unary_case;
+
+typedef struct Float64x4_binary_case {
+	const char* name;
+	void (*array_func)(const Float64x4*, const Float64x4*, Float64x4*, size_t);
+	Float64x4 (*scalar_func)(Float64x4, Float64x4);
+	fp64 tolerance;
+} Float64x4_binary_case;
+
+/**
+ * @brief Compares with a relative tolerance. A tolerance of zero requires
+ * the same bits.
+ */
+static int Float64x4_close(const Float64x4 x, const Float64x4 ref, const fp64 tolerance) {
+	if (isnan(ref.val[0])) {
+		return isnan(x.val[0]);
+	}
+	if (tolerance == 0.0 || isinf(ref.val[0])) {
+		return memcmp(&x, &ref, sizeof(Float64x4)) == 0;
+	}
+	const Float64x4 diff = Float64x4_sub(x, ref);
+	return fabs(diff.val[0]) <= tolerance * fabs(ref.val[0]);
+}
+
+static const Float64x4_unary_case Float64x4_unary_cases[] = {
+	{"fabs" , Float64x4_fabs_array , Float64x4_fabs , -8.0  , 8.0  , 0.0       },
+	{"sqrt" , Float64x4_sqrt_array , Float64x4_sqrt , 0.01  , 100.0, 0x1.0p-200},
+	{"cbrt" , Float64x4_cbrt_array , Float64x4_cbrt , -8.0  , 8.0  , 0x1.0p-200},
+	{"exp"  , Float64x4_exp_array  , Float64x4_exp  , -20.0 , 20.0 , 0x1.0p-200},
+	{"expm1", Float64x4_expm1_array, Float64x4_expm1, -1.0  , 1.0  , 0x1.0p-200},
+	{"log"  , Float64x4_log_array  , Float64x4_log  , 0.01  , 100.0, 0x1.0p-200},
+	{"log1p", Float64x4_log1p_array, Float64x4_log1p, -0.5  , 4.0  , 0x1.0p-200},
+	{"sin"  , Float64x4_sin_array  , Float64x4_sin  , -4.0  , 4.0  , 0x1.0p-200},
+	{"cos"  , Float64x4_cos_array  , Float64x4_cos  , -4.0  , 4.0  , 0x1.0p-200},
+	{"tan"  , Float64x4_tan_array  , Float64x4_tan  , -1.5  , 1.5  , 0x1.0p-200},
+	{"atan" , Float64x4_atan_array , Float64x4_atan , -4.0  , 4.0  , 0x1.0p-200},
+	{"sinh" , Float64x4_sinh_array , Float64x4_sinh , -4.0  , 4.0  , 0x1.0p-200},
+	{"tanh" , Float64x4_tanh_array , Float64x4_tanh , -4.0  , 4.0  , 0x1.0p-200},
+	{"floor", Float64x4_floor_array, Float64x4_floor, -1.0e6, 1.0e6, 0.0       },
+	{"trunc", Float64x4_trunc_array, Float64x4_trunc, -1.0e6, 1.0e6, 0.0       },
+	/* No SIMD kernel, so every level uses the scalar loop */
+	{"round", Float64x4_round_array, Float64x4_round, -1.0e6, 1.0e6, 0.0       }
+};
+
+static const Float64x4_binary_case Float64x4_binary_cases[] = {
+	{"add"      , Float64x4_add_array      , Float64x4_add      , 0x1.0p-200},
+	{"sub"      , Float64x4_sub_array      , Float64x4_sub      , 0x1.0p-200},
+	{"mul"      , Float64x4_mul_array      , Float64x4_mul      , 0x1.0p-200},
+	{"div"      , Float64x4_div_array      , Float64x4_div      , 0x1.0p-200},
+	{"copysign" , Float64x4_copysign_array , Float64x4_copysign , 0.0       },
+	/* No SIMD kernel, so every level uses the scalar loop */
+	{"remainder", Float64x4_remainder_array, Float64x4_remainder, 0.0       }
+};
+
+static int test_Float64x4_array_level(const LDF_cpu_level level) {
+	int fails = 0;
+	uint64_t state = UINT64_C(0x14);
+	Float64x4 x[TEST_ARRAY_COUNT];
+	Float64x4 y[TEST_ARRAY_COUNT];
+	Float64x4 out[TEST_ARRAY_COUNT];
+	Float64x4 ref[TEST_ARRAY_COUNT];
+
+	for (size_t c = 0; c < sizeof(Float64x4_unary_cases) / sizeof(Float64x4_unary_cases[0]); c++) {
+		const Float64x4_unary_case* test = &Float64x4_unary_cases[c];
+		test_fill_Float64x4(&state, x, TEST_ARRAY_COUNT, test->min, test->max);
+		for (size_t i = 0; i < TEST_ARRAY_COUNT; i++) {
+			ref[i] = test->scalar_func(x[i]);
+		}
+		test->array_func(x, out, TEST_ARRAY_COUNT);
+		// out may be the same array as in
+		test->array_func(x, x, TEST_ARRAY_COUNT);
+		size_t mismatches = 0;
+		for (size_t i = 0; i < TEST_ARRAY_COUNT; i++) {
+			mismatches += !Float64x4_close(out[i], ref[i], test->tolerance);
+			mismatches += !Float64x4_close(x[i], ref[i], test->tolerance);
+		}
+		if (mismatches != 0) {
+			printf(
+				"FAIL Float64x4_%s_array at level %s: %zu mismatches\n",
+				test->name, LDF_cpu_level_name(level), mismatches
+			);
+			fails++;
+		}
+	}
+
+	for (size_t c = 0; c < sizeof(Float64x4_binary_cases) / sizeof(Float64x4_binary_cases[0]); c++) {
+		const Float64x4_binary_case* test = &Float64x4_binary_cases[c];
+		test_fill_Float64x4(&state, x, TEST_ARRAY_COUNT, -8.0, 8.0);
+		test_fill_Float64x4(&state, y, TEST_ARRAY_COUNT, 0.125, 8.0);
+		for (size_t i = 0; i < TEST_ARRAY_COUNT; i++) {
+			ref[i] = test->scalar_func(x[i], y[i]);
+		}
+		test->array_func(x, y, out, TEST_ARRAY_COUNT);
+		size_t mismatches = 0;
+		for (size_t i = 0; i < TEST_ARRAY_COUNT; i++) {
+			mismatches += !Float64x4_close(out[i], ref[i], test->tolerance);
+		}
+		if (mismatches != 0) {
+			printf(
+				"FAIL Float64x4_%s_array at level %s: %zu mismatches\n",
+				test->name, LDF_cpu_level_name(level), mismatches
+			);
+			fails++;
+		}
+	}
+
+	// n = 0 must not touch the arrays
+	memset(out, 0x7F, sizeof(out));
+	memcpy(ref, out, sizeof(out));
+	Float64x4_sin_array(x, out, 0);
+	Float64x4_mul_array(x, y, out, 0);
+	fails += TEST_CHECK(memcmp(out, ref, sizeof(out)) == 0);
+	return fails;
+}
+
+//------------------------------------------------------------------------------
+// Float32x2
+//------------------------------------------------------------------------------
+
+typedef struct Float32x2_unary_case {
+	const char* name;
+	void (*array_func)(const Float32x2*, Float32x2*, size_t);
+	fp32 min;
+	fp32 max;
+	fp32 tolerance;
+} Float32x2_unary_case;
+
+static int Float32x2_close(const Float32x2 x, const Float32x2 ref, const fp32 tolerance) {
+	if (isnan(ref.hi)) {
+		return isnan(x.hi);
+	}
+	if (tolerance == 0.0f || isinf(ref.hi)) {
+		return memcmp(&x, &ref, sizeof(Float32x2)) == 0;
+	}
+	const fp64 diff =
+		((fp64)x.hi - (fp64)ref.hi) + ((fp64)x.lo - (fp64)ref.lo);
+	return fabs(diff) <= (fp64)tolerance * fabs((fp64)ref.hi);
+}
+
+static void fill_Float32x2(
+	uint64_t* state, Float32x2* x, const size_t n, const fp32 min, const fp32 max
+) {
+	for (size_t i = 0; i < n; i++) {
+		x[i].hi = (fp32)test_rand_fp64(state, min, max);
+		x[i].lo = x[i].hi * (fp32)test_rand_fp64(state, -0x1.0p-25, 0x1.0p-25);
+	}
+}
+
+static const Float32x2_unary_case Float32x2_unary_cases[] = {
+	{"fabs" , Float32x2_fabs_array , -8.0f  , 8.0f  , 0.0f       },
+	{"sqrt" , Float32x2_sqrt_array , 0.01f  , 100.0f, 0x1.0p-44f },
+	{"exp"  , Float32x2_exp_array  , -20.0f , 20.0f , 0x1.0p-42f },
+	{"log"  , Float32x2_log_array  , 0.01f  , 100.0f, 0x1.0p-42f },
+	{"sin"  , Float32x2_sin_array  , -4.0f  , 4.0f  , 0x1.0p-42f },
+	{"cos"  , Float32x2_cos_array  , -4.0f  , 4.0f  , 0x1.0p-42f },
+	{"floor", Float32x2_floor_array, -1.0e6f, 1.0e6f, 0.0f       },
+	/* No SIMD kernel, so every level uses the scalar loop */
+	{"cbrt" , Float32x2_cbrt_array , -8.0f  , 8.0f  , 0.0f       },
+	{"erf"  , Float32x2_erf_array  , -3.0f  , 3.0f  , 0.0f       }
+};
+
+/**
+ * @brief Float32x2 has no C scalar API, so each level is compared against
+ * the scalar level of the array function.
+ */
+static int test_Float32x2_array(const LDF_cpu_level detected) {
+	int fails = 0;
+	uint64_t state = UINT64_C(0x32);
+	Float32x2 x[TEST_ARRAY_COUNT];
+	Float32x2 y[TEST_ARRAY_COUNT];
+	Float32x2 out[TEST_ARRAY_COUNT];
+	Float32x2 ref[TEST_ARRAY_COUNT];
+
+	for (size_t c = 0; c < sizeof(Float32x2_unary_cases) / sizeof(Float32x2_unary_cases[0]); c++) {
+		const Float32x2_unary_case* test = &Float32x2_unary_cases[c];
+		fill_Float32x2(&state, x, TEST_ARRAY_COUNT, test->min, test->max);
+		LDF_cpu_set_level(LDF_CPU_LEVEL_SCALAR);
+		test->array_func(x, ref, TEST_ARRAY_COUNT);
+		for (int level = 1; level <= (int)detected; level++) {
+			LDF_cpu_set_level((LDF_cpu_level)level);
+			test->array_func(x, out, TEST_ARRAY_COUNT);
+			size_t mismatches = 0;
+			for (size_t i = 0; i < TEST_ARRAY_COUNT; i++) {
+				mismatches += !Float32x2_close(out[i], ref[i], test->tolerance);
+			}
+			if (mismatches != 0) {
+				printf(
+					"FAIL Float32x2_%s_array at level %s: %zu mismatches\n",
+					test->name, LDF_cpu_level_name((LDF_cpu_level)level), mismatches
+				);
+				fails++;
+			}
+		}
+	}
+
+	fill_Float32x2(&state, x, TEST_ARRAY_COUNT, -8.0f, 8.0f);
+	fill_Float32x2(&state, y, TEST_ARRAY_COUNT, 0.125f, 8.0f);
+	LDF_cpu_set_level(LDF_CPU_LEVEL_SCALAR);
+	Float32x2_div_array(x, y, ref, TEST_ARRAY_COUNT);
+	for (int level = 1; level <= (int)detected; level++) {
+		LDF_cpu_set_level((LDF_cpu_level)level);
+		memcpy(out, x, sizeof(out));
+		// out may be the same array as x
+		Float32x2_div_array(out, y, out, TEST_ARRAY_COUNT);
+		size_t mismatches = 0;
+		for (size_t i = 0; i < TEST_ARRAY_COUNT; i++) {
+			mismatches += !Float32x2_close(out[i], ref[i], 0x1.0p-44f);
+		}
+		if (mismatches != 0) {
+			printf(
+				"FAIL Float32x2_div_array at level %s: %zu mismatches\n",
+				LDF_cpu_level_name((LDF_cpu_level)level), mismatches
+			);
+			fails++;
+		}
+	}
+	return fails;
+}
+
+//------------------------------------------------------------------------------
+// Float64x3
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Float64x3 only has scalar loops, so the results must have the same
+ * bits as the scalar functions.
+ */
+static int test_Float64x3_array(void) {
+	int fails = 0;
+	uint64_t state = UINT64_C(0x3);
+	Float64x3 x[TEST_ARRAY_COUNT];
+	Float64x3 y[TEST_ARRAY_COUNT];
+	Float64x3 out[TEST_ARRAY_COUNT];
+	Float64x3 ref[TEST_ARRAY_COUNT];
+	for (size_t i = 0; i < TEST_ARRAY_COUNT; i++) {
+		x[i] = Float64x3_add(
+			Float64x3_set_d(test_rand_fp64(&state, 0.125, 8.0)),
+			Float64x3_set_d(test_rand_fp64(&state, -0x1.0p-60, 0x1.0p-60))
+		);
+		y[i] = Float64x3_set_d(test_rand_fp64(&state, 0.125, 8.0));
+	}
+
+	for (size_t i = 0; i < TEST_ARRAY_COUNT; i++) {
+		ref[i] = Float64x3_div(x[i], y[i]);
+	}
+	Float64x3_div_array(x, y, out, TEST_ARRAY_COUNT);
+	fails += TEST_CHECK(memcmp(out, ref, sizeof(out)) == 0);
+
+	for (size_t i = 0; i < TEST_ARRAY_COUNT; i++) {
+		ref[i] = Float64x3_sqrt(x[i]);
+	}
+	memcpy(out, x, sizeof(out));
+	Float64x3_sqrt_array(out, out, TEST_ARRAY_COUNT);
+	fails += TEST_CHECK(memcmp(out, ref, sizeof(out)) == 0);
+
+	memset(out, 0x7F, sizeof(out));
+	memcpy(ref, out, sizeof(out));
+	Float64x3_sqrt_array(x, out, 0);
+	Float64x3_add_array(x, y, out, 0);
+	fails += TEST_CHECK(memcmp(out, ref, sizeof(out)) == 0);
+	return fails;
+}
+
+int test_array(void) {
+	int fails = 0;
+	const LDF_cpu_level detected = LDF_cpu_detect_level();
+	const LDF_cpu_level initial = LDF_cpu_get_level();
+
+	for (int level = 0; level <= (int)detected; level++) {
+		LDF_cpu_set_level((LDF_cpu_level)level);
+		fails += test_Float64x4_array_level((LDF_cpu_level)level);
+	}
+	fails += test_Float32x2_array(detected);
+	fails += test_Float64x3_array();
+
+	LDF_cpu_set_level(initial);
+	return fails;
+}
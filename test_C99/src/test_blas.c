@@ -0,0 +1,382 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "test_common.h"
+
+#include "LDF/LDF_cpu_dispatch.h"
+#include "Float64x2/Float64x2.h"
+#include "Float64x2/Float64x2_blas.h"
+#include "Float64x4/Float64x4.h"
+#include "Float64x4/Float64x4_blas.h"
+
+#include <math.h>
+#include <string.h>
+
+/* Not a multiple of 32, so that the scalar tail is tested at every level */
+#define TEST_BLAS_COUNT 53
+/* Large enough for the widest stride */
+#define TEST_BLAS_SIZE (3 * TEST_BLAS_COUNT)
+
+typedef struct blas_stride {
+	ptrdiff_t incx;
+	ptrdiff_t incy;
+} blas_stride;
+
+/* Contiguous arrays use the SIMD kernels, and the others the scalar loops */
+static const blas_stride blas_strides[] = {
+	{ 1,  1},
+	{ 2, -1},
+	{-3,  2}
+};
+
+/** @brief |x - ref| <= tolerance * bound */
+static int Float64x2_within(const Float64x2 x, const Float64x2 ref, const fp64 tolerance, const fp64 bound) {
+	const Float64x2 diff = Float64x2_sub(x, ref);
+	return fabs(diff.hi) <= tolerance * bound;
+}
+
+/** @brief |x - ref| <= tolerance * bound */
+static int Float64x4_within(const Float64x4 x, const Float64x4 ref, const fp64 tolerance, const fp64 bound) {
+	const Float64x4 diff = Float64x4_sub(x, ref);
+	return fabs(diff.val[0]) <= tolerance * bound;
+}
+
+//------------------------------------------------------------------------------
+// Float64x2
+//------------------------------------------------------------------------------
+
+static int test_Float64x2_blas_stride(const blas_stride stride) {
+	int fails = 0;
+	const size_t n = TEST_BLAS_COUNT;
+	const ptrdiff_t incx = stride.incx;
+	const ptrdiff_t incy = stride.incy;
+	uint64_t state = UINT64_C(0x15);
+	Float64x2 x[TEST_BLAS_SIZE];
+	Float64x2 y[TEST_BLAS_SIZE];
+	Float64x2 out[TEST_BLAS_SIZE];
+	test_fill_Float64x2(&state, x, TEST_BLAS_SIZE, -8.0, 8.0);
+	test_fill_Float64x2(&state, y, TEST_BLAS_SIZE, -8.0, 8.0);
+	const Float64x2 alpha = Float64x2_add_d_d(1.5, 0x1.0p-60);
+
+	/* dot, asum, and nrm2 against a naive loop */ {
+		Float64x2 dot = Float64x2_set_zero();
+		Float64x2 asum = Float64x2_set_zero();
+		Float64x2 sum_sqr = Float64x2_set_zero();
+		fp64 dot_bound = 0.0;
+		for (size_t i = 0; i < n; i++) {
+			const Float64x2 xi = x[test_strided_index(n, incx, i)];
+			const Float64x2 yi = y[test_strided_index(n, incy, i)];
+			dot = Float64x2_add(dot, Float64x2_mul(xi, yi));
+			asum = Float64x2_add(asum, Float64x2_fabs(xi));
+			sum_sqr = Float64x2_add(sum_sqr, Float64x2_square(xi));
+			dot_bound += fabs(xi.hi * yi.hi);
+		}
+		const Float64x2 nrm2 = Float64x2_sqrt(sum_sqr);
+		fails += TEST_CHECK(Float64x2_within(
+			Float64x2_dot(n, x, incx, y, incy), dot, 0x1.0p-96, dot_bound
+		));
+		fails += TEST_CHECK(Float64x2_within(
+			Float64x2_asum(n, x, incx), asum, 0x1.0p-96, asum.hi
+		));
+		fails += TEST_CHECK(Float64x2_within(
+			Float64x2_nrm2(n, x, incx), nrm2, 0x1.0p-96, nrm2.hi
+		));
+	}
+
+	/* axpy */ {
+		memcpy(out, y, sizeof(out));
+		Float64x2_axpy(n, alpha, x, incx, out, incy);
+		size_t mismatches = 0;
+		for (size_t i = 0; i < n; i++) {
+			const size_t ix = test_strided_index(n, incx, i);
+			const size_t iy = test_strided_index(n, incy, i);
+			const Float64x2 ref = Float64x2_add(Float64x2_mul(alpha, x[ix]), y[iy]);
+			mismatches += !Float64x2_within(out[iy], ref, 0x1.0p-100, 32.0);
+		}
+		fails += TEST_CHECK(mismatches == 0);
+	}
+
+	/* scal, which must not touch the elements between the strides */ {
+		memcpy(out, x, sizeof(out));
+		Float64x2_scal(n, alpha, out, incx);
+		size_t mismatches = 0;
+		for (size_t i = 0; i < n; i++) {
+			const size_t ix = test_strided_index(n, incx, i);
+			const Float64x2 ref = Float64x2_mul(alpha, x[ix]);
+			mismatches += !Float64x2_within(out[ix], ref, 0x1.0p-100, fabs(ref.hi));
+			// Marks the element as checked
+			out[ix] = x[ix];
+		}
+		fails += TEST_CHECK(mismatches == 0);
+		fails += TEST_CHECK(memcmp(out, x, sizeof(out)) == 0);
+	}
+
+	/* rot */ {
+		const Float64x2 c = Float64x2_set_d(0.6);
+		const Float64x2 s = Float64x2_set_d(0.8);
+		Float64x2 rx[TEST_BLAS_SIZE];
+		memcpy(rx, x, sizeof(rx));
+		memcpy(out, y, sizeof(out));
+		Float64x2_rot(n, rx, incx, out, incy, c, s);
+		size_t mismatches = 0;
+		for (size_t i = 0; i < n; i++) {
+			const size_t ix = test_strided_index(n, incx, i);
+			const size_t iy = test_strided_index(n, incy, i);
+			const Float64x2 ref_x = Float64x2_add(Float64x2_mul(c, x[ix]), Float64x2_mul(s, y[iy]));
+			const Float64x2 ref_y = Float64x2_sub(Float64x2_mul(c, y[iy]), Float64x2_mul(s, x[ix]));
+			mismatches += !Float64x2_within(rx[ix], ref_x, 0x1.0p-100, 16.0);
+			mismatches += !Float64x2_within(out[iy], ref_y, 0x1.0p-100, 16.0);
+		}
+		fails += TEST_CHECK(mismatches == 0);
+	}
+
+	/* iamax returns the first of two equal maxima, and skips NaN */ {
+		memcpy(out, x, sizeof(out));
+		out[test_strided_index(n, incx, 3)] = Float64x2_set_d(NAN);
+		out[test_strided_index(n, incx, 17)] = Float64x2_set_d(-16.0);
+		out[test_strided_index(n, incx, 41)] = Float64x2_set_d(16.0);
+		fails += TEST_CHECK(Float64x2_iamax(n, out, incx) == 17);
+	}
+	return fails;
+}
+
+static int test_Float64x2_blas(void) {
+	int fails = 0;
+	for (size_t s = 0; s < sizeof(blas_strides) / sizeof(blas_strides[0]); s++) {
+		fails += test_Float64x2_blas_stride(blas_strides[s]);
+	}
+
+	/* nrm2 must not overflow when the squares would */ {
+		const Float64x2 big[2] = {
+			Float64x2_set_d(3.0e200), Float64x2_set_d(4.0e200)
+		};
+		const Float64x2 nrm2 = Float64x2_nrm2(2, big, 1);
+		fails += TEST_CHECK(fabs(nrm2.hi - 5.0e200) <= 0x1.0p-50 * 5.0e200);
+	}
+
+	/* n = 0 */ {
+		const Float64x2 x[1] = { Float64x2_set_d(1.0) };
+		const Float64x2 dot = Float64x2_dot(0, x, 1, x, 1);
+		fails += TEST_CHECK(dot.hi == 0.0 && dot.lo == 0.0);
+		fails += TEST_CHECK(Float64x2_iamax(0, x, 1) == 0);
+	}
+	return fails;
+}
+
+//------------------------------------------------------------------------------
+// Float64x4
+//------------------------------------------------------------------------------
+
+static int test_Float64x4_blas_stride(const blas_stride stride) {
+	int fails = 0;
+	const size_t n = TEST_BLAS_COUNT;
+	const ptrdiff_t incx = stride.incx;
+	const ptrdiff_t incy = stride.incy;
+	uint64_t state = UINT64_C(0x154);
+	Float64x4 x[TEST_BLAS_SIZE];
+	Float64x4 y[TEST_BLAS_SIZE];
+	Float64x4 out[TEST_BLAS_SIZE];
+	test_fill_Float64x4(&state, x, TEST_BLAS_SIZE, -8.0, 8.0);
+	test_fill_Float64x4(&state, y, TEST_BLAS_SIZE, -8.0, 8.0);
+	const Float64x4 alpha = Float64x4_add(Float64x4_set_d(1.5), Float64x4_set_d(0x1.0p-120));
+
+	/* dot and asum against a naive loop */ {
+		Float64x4 dot = Float64x4_set_zero();
+		Float64x4 asum = Float64x4_set_zero();
+		fp64 dot_bound = 0.0;
+		for (size_t i = 0; i < n; i++) {
+			const Float64x4 xi = x[test_strided_index(n, incx, i)];
+			const Float64x4 yi = y[test_strided_index(n, incy, i)];
+			dot = Float64x4_add(dot, Float64x4_mul(xi, yi));
+			asum = Float64x4_add(asum, Float64x4_fabs(xi));
+			dot_bound += fabs(xi.val[0] * yi.val[0]);
+		}
+		fails += TEST_CHECK(Float64x4_within(
+			Float64x4_dot(n, x, incx, y, incy), dot, 0x1.0p-196, dot_bound
+		));
+		fails += TEST_CHECK(Float64x4_within(
+			Float64x4_asum(n, x, incx), asum, 0x1.0p-196, asum.val[0]
+		));
+	}
+
+	/* axpy */ {
+		memcpy(out, y, sizeof(out));
+		Float64x4_axpy(n, alpha, x, incx, out, incy);
+		size_t mismatches = 0;
+		for (size_t i = 0; i < n; i++) {
+			const size_t ix = test_strided_index(n, incx, i);
+			const size_t iy = test_strided_index(n, incy, i);
+			const Float64x4 ref = Float64x4_add(Float64x4_mul(alpha, x[ix]), y[iy]);
+			mismatches += !Float64x4_within(out[iy], ref, 0x1.0p-200, 32.0);
+		}
+		fails += TEST_CHECK(mismatches == 0);
+	}
+
+	/* iamax */ {
+		memcpy(out, x, sizeof(out));
+		out[test_strided_index(n, incx, 29)] = Float64x4_set_d(-16.0);
+		out[test_strided_index(n, incx, 52)] = Float64x4_set_d(16.0);
+		fails += TEST_CHECK(Float64x4_iamax(n, out, incx) == 29);
+	}
+	return fails;
+}
+
+static int test_Float64x4_blas(void) {
+	int fails = 0;
+	for (size_t s = 0; s < sizeof(blas_strides) / sizeof(blas_strides[0]); s++) {
+		fails += test_Float64x4_blas_stride(blas_strides[s]);
+	}
+	return fails;
+}
+
+//------------------------------------------------------------------------------
+// Mixed precision
+//------------------------------------------------------------------------------
+
+/* The number of cancelling groups */
+#define TEST_BLAS_D_GROUPS 25
+#define TEST_BLAS_D_TAIL 3
+/* Not a multiple of 8, so that the SIMD tails are used */
+#define TEST_BLAS_D_DOT_COUNT (3 * TEST_BLAS_D_GROUPS + TEST_BLAS_D_TAIL)
+#define TEST_BLAS_D_SUM_COUNT (4 * TEST_BLAS_D_GROUPS + TEST_BLAS_D_TAIL)
+#define TEST_BLAS_D_SIZE (3 * TEST_BLAS_D_SUM_COUNT)
+
+/**
+ * @brief Fills x and y with ill-conditioned data whose exact dot product, or
+ * sum when y is NULL, is 1 + 2^-60 + 3 * 2^-80. The condition number is about
+ * 2^48. The elements between the strides are NaN.
+ *
+ * @details a * b = p + e ranges from 2^-20 to 2^42, where p = fl(a * b).
+ * The dot product uses the groups (a, b), (-p, 1), and (-e, 1), so the
+ * rounding errors of the products must be kept. The sum uses the groups p, e,
+ * -p, and -e. The groups are followed by the tail and shuffled.
+ *
+ * @returns The sum of |x[i] * y[i]|
+ */
+static fp64 fill_ill_conditioned_d(
+	uint64_t* state, fp64* x, const ptrdiff_t incx, fp64* y, const ptrdiff_t incy
+) {
+	static const fp64 tail_x[TEST_BLAS_D_TAIL] = { 1.0, 0x1.0p-60, 3.0 };
+	static const fp64 tail_y[TEST_BLAS_D_TAIL] = { 1.0, 1.0, 0x1.0p-80 };
+	const size_t group = (y == NULL) ? 4 : 3;
+	const size_t n = group * TEST_BLAS_D_GROUPS + TEST_BLAS_D_TAIL;
+	fp64 px[TEST_BLAS_D_SUM_COUNT];
+	fp64 py[TEST_BLAS_D_SUM_COUNT];
+	for (size_t i = 0; i < TEST_BLAS_D_GROUPS; i++) {
+		const fp64 a = ldexp(
+			test_rand_fp64(state, 1.0, 2.0), (int)(test_rand_u64(state) % 31) - 10
+		);
+		const fp64 b = ldexp(
+			test_rand_fp64(state, 1.0, 2.0), (int)(test_rand_u64(state) % 31) - 10
+		);
+		const Float64x2 prod = Float64x2_mul_d_d(a, b);
+		fp64* gx = &px[group * i];
+		fp64* gy = &py[group * i];
+		if (y == NULL) {
+			gx[0] = prod.hi; gx[1] = prod.lo; gx[2] = -prod.hi; gx[3] = -prod.lo;
+			gy[0] = 1.0;     gy[1] = 1.0;     gy[2] = 1.0;      gy[3] = 1.0;
+		} else {
+			gx[0] = a; gx[1] = -prod.hi; gx[2] = -prod.lo;
+			gy[0] = b; gy[1] = 1.0;      gy[2] = 1.0;
+		}
+	}
+	for (size_t i = 0; i < TEST_BLAS_D_TAIL; i++) {
+		px[n - TEST_BLAS_D_TAIL + i] = (y == NULL) ? tail_x[i] * tail_y[i] : tail_x[i];
+		py[n - TEST_BLAS_D_TAIL + i] = (y == NULL) ? 1.0 : tail_y[i];
+	}
+	for (size_t i = n - 1; i > 0; i--) {
+		const size_t j = (size_t)(test_rand_u64(state) % (i + 1));
+		fp64 temp = px[i]; px[i] = px[j]; px[j] = temp;
+		temp = py[i]; py[i] = py[j]; py[j] = temp;
+	}
+
+	for (size_t i = 0; i < TEST_BLAS_D_SIZE; i++) {
+		x[i] = NAN;
+		if (y != NULL) {
+			y[i] = NAN;
+		}
+	}
+	fp64 abs_sum = 0.0;
+	for (size_t i = 0; i < n; i++) {
+		abs_sum += fabs(px[i] * py[i]);
+		x[test_strided_index(n, incx, i)] = px[i];
+		if (y != NULL) {
+			y[test_strided_index(n, incy, i)] = py[i];
+		}
+	}
+	return abs_sum;
+}
+
+/**
+ * @brief Dot2 and Sum2 must be within the bounds from Ogita, Rump, and Oishi,
+ * where a fp64 sum would be off by about 2^-13.
+ */
+static int test_blas_d_stride(const blas_stride stride) {
+	int fails = 0;
+	const size_t n_dot = TEST_BLAS_D_DOT_COUNT;
+	const size_t n_sum = TEST_BLAS_D_SUM_COUNT;
+	const ptrdiff_t incx = stride.incx;
+	const ptrdiff_t incy = stride.incy;
+	uint64_t state = UINT64_C(0x17);
+	fp64 x[TEST_BLAS_D_SIZE];
+	fp64 y[TEST_BLAS_D_SIZE];
+	fp64 sum_x[TEST_BLAS_D_SIZE];
+	const Float64x2 exact = Float64x2_add_d_d(1.0, 0x1.00003p-60);
+	const Float64x4 exact_x4 = Float64x4_add(
+		Float64x4_set_d(1.0), Float64x4_set_d(0x1.00003p-60)
+	);
+
+	for (int trial = 0; trial < 4; trial++) {
+		const fp64 dot_bound = fill_ill_conditioned_d(&state, x, incx, y, incy);
+		const fp64 sum_bound = fill_ill_conditioned_d(&state, sum_x, incx, NULL, 0);
+
+		const Float64x2 dot = Float64x2_sub(Float64x2_dot_d(n_dot, x, incx, y, incy), exact);
+		const Float64x2 sum = Float64x2_sub(Float64x2_sum_d(n_sum, sum_x, incx), exact);
+		fails += TEST_CHECK(fabs(dot.hi) <= 0x1.0p-104 + test_dot2_bound(n_dot, dot_bound));
+		fails += TEST_CHECK(fabs(sum.hi) <= 0x1.0p-104 + test_dot2_bound(n_sum - 1, sum_bound));
+
+		// Float64x4 adds the exact products, so only the Float64x4 additions round
+		const Float64x4 dot_x4 = Float64x4_sub(Float64x4_dot_d(n_dot, x, incx, y, incy), exact_x4);
+		const Float64x4 sum_x4 = Float64x4_sub(Float64x4_sum_d(n_sum, sum_x, incx), exact_x4);
+		fails += TEST_CHECK(fabs(dot_x4.val[0]) <= 0x1.0p-200 * (fp64)n_dot * dot_bound);
+		fails += TEST_CHECK(fabs(sum_x4.val[0]) <= 0x1.0p-200 * (fp64)n_sum * sum_bound);
+	}
+	return fails;
+}
+
+static int test_blas_d(void) {
+	int fails = 0;
+	for (size_t s = 0; s < sizeof(blas_strides) / sizeof(blas_strides[0]); s++) {
+		fails += test_blas_d_stride(blas_strides[s]);
+	}
+
+	/* n = 0 */ {
+		const fp64 x[1] = { 1.0 };
+		const Float64x2 dot = Float64x2_dot_d(0, x, 1, x, 1);
+		const Float64x4 sum_x4 = Float64x4_sum_d(0, x, 1);
+		fails += TEST_CHECK(dot.hi == 0.0 && dot.lo == 0.0);
+		fails += TEST_CHECK(sum_x4.val[0] == 0.0);
+	}
+	return fails;
+}
+
+int test_blas(void) {
+	int fails = 0;
+	const LDF_cpu_level detected = LDF_cpu_detect_level();
+	const LDF_cpu_level initial = LDF_cpu_get_level();
+	for (int level = 0; level <= (int)detected; level++) {
+		LDF_cpu_set_level((LDF_cpu_level)level);
+		const int level_fails = test_Float64x2_blas() + test_Float64x4_blas() + test_blas_d();
+		if (level_fails != 0) {
+			printf("FAIL Level-1 BLAS at level %s\n", LDF_cpu_level_name((LDF_cpu_level)level));
+		}
+		fails += level_fails;
+	}
+	LDF_cpu_set_level(initial);
+	return fails;
+}
@@ -0,0 +1,127 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#ifndef TEST_COMMON_H
+#define TEST_COMMON_H
+
+/**
+ * @brief Helpers shared by the test_*.c files. Each test function returns
+ * the number of failed checks, and prints the location of each failure.
+ */
+
+#include "Float64/Float64.h"
+#include "Float64x2/Float64x2.h"
+#include "Float64x4/Float64x4.h"
+
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * @brief Evaluates to 1 and prints the expression when cond is false,
+ * otherwise evaluates to 0.
+ */
+#define TEST_CHECK(cond) test_check((cond) ? 1 : 0, #cond, __FILE__, __LINE__)
+
+static inline int test_check(
+	const int passed, const char* expr, const char* file, const int line
+) {
+	if (passed) {
+		return 0;
+	}
+	printf("FAIL %s:%d: %s\n", file, line, expr);
+	return 1;
+}
+
+/**
+ * @brief splitmix64, so that every run uses the same inputs.
+ */
+static inline uint64_t test_rand_u64(uint64_t* state) {
+	uint64_t z = (*state += UINT64_C(0x9E3779B97F4A7C15));
+	z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+	z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+	return z ^ (z >> 31);
+}
+
+/**
+ * @brief Returns a random fp64 within [min, max)
+ */
+static inline fp64 test_rand_fp64(uint64_t* state, const fp64 min, const fp64 max) {
+	const fp64 u = (fp64)(test_rand_u64(state) >> 11) * 0x1.0p-53;
+	return min + (max - min) * u;
+}
+
+/**
+ * @brief Fills x with random values within [min, max), with random lower
+ * limbs so that every limb of the SIMD kernels is exercised.
+ */
+static inline void test_fill_Float64x2(
+	uint64_t* state, Float64x2* x, const size_t n, const fp64 min, const fp64 max
+) {
+	for (size_t i = 0; i < n; i++) {
+		const fp64 hi = test_rand_fp64(state, min, max);
+		x[i] = Float64x2_add_d_d(hi, hi * test_rand_fp64(state, -0x1.0p-53, 0x1.0p-53));
+	}
+}
+
+/** @copydoc test_fill_Float64x2 */
+static inline void test_fill_Float64x4(
+	uint64_t* state, Float64x4* x, const size_t n, const fp64 min, const fp64 max
+) {
+	for (size_t i = 0; i < n; i++) {
+		x[i].val[0] = test_rand_fp64(state, min, max);
+		for (int j = 1; j < 4; j++) {
+			x[i].val[j] = x[i].val[j - 1] * test_rand_fp64(state, -0x1.0p-54, 0x1.0p-54);
+		}
+	}
+}
+
+/**
+ * @brief Error bound of Dot2 and Sum2 from Ogita, Rump, and Oishi,
+ * gamma(n)^2 * abs_sum where gamma(n) = n * u / (1 - n * u), and abs_sum is
+ * the sum of |x[i] * y[i]|.
+ */
+static inline fp64 test_dot2_bound(const size_t n, const fp64 abs_sum) {
+	const fp64 nu = (fp64)n * 0x1.0p-53;
+	const fp64 gamma = nu / (1.0 - nu);
+	return gamma * gamma * abs_sum;
+}
+
+/**
+ * @brief Index of element i of a strided array. A negative stride walks the
+ * array backwards, like the BLAS functions.
+ */
+static inline size_t test_strided_index(const size_t n, const ptrdiff_t inc, const size_t i) {
+	return (inc >= 0) ? i * (size_t)inc : (n - 1 - i) * (size_t)(-inc);
+}
+
+//------------------------------------------------------------------------------
+// Tests
+//------------------------------------------------------------------------------
+
+/** @brief _mm256_lgamma_pd on subnormals and near its negative roots */
+int test_lgamma(void);
+
+/** @brief LDF_cpu_dispatch.h, and the Float64x2 array kernels at each level */
+int test_dispatch(void);
+
+/** @brief The Float64x4, Float32x2, and Float64x3 array APIs */
+int test_array(void);
+
+/**
+ * @brief Level-1 BLAS, with contiguous, strided, and negative strides, and
+ * the mixed precision dot_d and sum_d on ill-conditioned data
+ */
+int test_blas(void);
+
+/** @brief GEMM, GEMV, and GEMV_d for both layouts and transposes */
+int test_gemm(void);
+
+/** @brief SumK and AccSum on ill-conditioned sums, and their reproducibility */
+int test_sum(void);
+
+#endif /* TEST_COMMON_H */
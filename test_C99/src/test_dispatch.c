@@ -0,0 +1,181 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "test_common.h"
+
+#include "LDF/LDF_cpu_dispatch.h"
+#include "Float64x2/Float64x2.h"
+#include "Float64x2/Float64x2_array.h"
+
+#include <math.h>
+#include <string.h>
+
+/* Not a multiple of 8, so that the scalar tail is tested at every level */
+#define TEST_DISPATCH_COUNT 67
+
+typedef struct dispatch_unary_case {
+	const char* name;
+	void (*array_func)(const Float64x2*, Float64x2*, size_t);
+	Float64x2 (*scalar_func)(Float64x2);
+	fp64 min;
+	fp64 max;
+	fp64 tolerance;
+} dispatch_unary_case;
+
+typedef struct dispatch_binary_case {
+	const char* name;
+	void (*array_func)(const Float64x2*, const Float64x2*, Float64x2*, size_t);
+	Float64x2 (*scalar_func)(Float64x2, Float64x2);
+	fp64 tolerance;
+} dispatch_binary_case;
+
+/**
+ * @brief The SIMD kernels may round differently from the scalar functions,
+ * for example when they use FMA, so results are compared with a relative
+ * tolerance. A tolerance of zero requires the same bits.
+ */
+static int Float64x2_close(const Float64x2 x, const Float64x2 ref, const fp64 tolerance) {
+	if (isnan(ref.hi)) {
+		return isnan(x.hi);
+	}
+	if (tolerance == 0.0 || isinf(ref.hi)) {
+		return memcmp(&x, &ref, sizeof(Float64x2)) == 0;
+	}
+	const Float64x2 diff = Float64x2_sub(x, ref);
+	return fabs(diff.hi) <= tolerance * fabs(ref.hi);
+}
+
+static size_t count_mismatches(
+	const Float64x2* out, const Float64x2* ref, const size_t n, const fp64 tolerance
+) {
+	size_t mismatches = 0;
+	for (size_t i = 0; i < n; i++) {
+		if (!Float64x2_close(out[i], ref[i], tolerance)) {
+			mismatches++;
+		}
+	}
+	return mismatches;
+}
+
+static int report(const char* name, const LDF_cpu_level level, const size_t mismatches) {
+	if (mismatches == 0) {
+		return 0;
+	}
+	printf(
+		"FAIL Float64x2_%s_array at level %s: %zu of %d elements differ from the scalar function\n",
+		name, LDF_cpu_level_name(level), mismatches, TEST_DISPATCH_COUNT
+	);
+	return 1;
+}
+
+static const dispatch_unary_case unary_cases[] = {
+	{"fabs" , Float64x2_fabs_array , Float64x2_fabs , -8.0 , 8.0  , 0.0      },
+	{"sqrt" , Float64x2_sqrt_array , Float64x2_sqrt , 0.01 , 100.0, 0x1.0p-100},
+	{"cbrt" , Float64x2_cbrt_array , Float64x2_cbrt , -8.0 , 8.0  , 0x1.0p-98},
+	{"exp"  , Float64x2_exp_array  , Float64x2_exp  , -20.0, 20.0 , 0x1.0p-98},
+	{"expm1", Float64x2_expm1_array, Float64x2_expm1, -1.0 , 1.0  , 0x1.0p-98},
+	{"log"  , Float64x2_log_array  , Float64x2_log  , 0.01 , 100.0, 0x1.0p-98},
+	// log(x) is small near 1, so every level must use the table algorithm
+	{"log"  , Float64x2_log_array  , Float64x2_log  , 0.985, 1.015, 0x1.0p-100},
+	{"log1p", Float64x2_log1p_array, Float64x2_log1p, -0.5 , 4.0  , 0x1.0p-98},
+	{"sin"  , Float64x2_sin_array  , Float64x2_sin  , -4.0 , 4.0  , 0x1.0p-98},
+	{"cos"  , Float64x2_cos_array  , Float64x2_cos  , -4.0 , 4.0  , 0x1.0p-98},
+	{"tan"  , Float64x2_tan_array  , Float64x2_tan  , -1.5 , 1.5  , 0x1.0p-98},
+	{"atan" , Float64x2_atan_array , Float64x2_atan , -4.0 , 4.0  , 0x1.0p-98},
+	{"sinh" , Float64x2_sinh_array , Float64x2_sinh , -4.0 , 4.0  , 0x1.0p-98},
+	{"tanh" , Float64x2_tanh_array , Float64x2_tanh , -4.0 , 4.0  , 0x1.0p-98},
+	{"floor", Float64x2_floor_array, Float64x2_floor, -1.0e6, 1.0e6, 0.0     }
+};
+
+static const dispatch_binary_case binary_cases[] = {
+	{"add" , Float64x2_add_array , Float64x2_add , 0x1.0p-100},
+	{"sub" , Float64x2_sub_array , Float64x2_sub , 0x1.0p-100},
+	{"mul" , Float64x2_mul_array , Float64x2_mul , 0x1.0p-100},
+	{"div" , Float64x2_div_array , Float64x2_div , 0x1.0p-100},
+	{"fmax", Float64x2_fmax_array, Float64x2_fmax, 0.0       },
+	{"fmin", Float64x2_fmin_array, Float64x2_fmin, 0.0       }
+};
+
+/**
+ * @brief Compares each array function at the current level against the
+ * scalar function, both out of place and in place.
+ */
+static int test_dispatch_level(const LDF_cpu_level level) {
+	int fails = 0;
+	uint64_t state = UINT64_C(0x13);
+	Float64x2 x[TEST_DISPATCH_COUNT];
+	Float64x2 y[TEST_DISPATCH_COUNT];
+	Float64x2 out[TEST_DISPATCH_COUNT];
+	Float64x2 ref[TEST_DISPATCH_COUNT];
+
+	for (size_t c = 0; c < sizeof(unary_cases) / sizeof(unary_cases[0]); c++) {
+		const dispatch_unary_case* test = &unary_cases[c];
+		test_fill_Float64x2(&state, x, TEST_DISPATCH_COUNT, test->min, test->max);
+		for (size_t i = 0; i < TEST_DISPATCH_COUNT; i++) {
+			ref[i] = test->scalar_func(x[i]);
+		}
+		test->array_func(x, out, TEST_DISPATCH_COUNT);
+		fails += report(test->name, level,
+			count_mismatches(out, ref, TEST_DISPATCH_COUNT, test->tolerance)
+		);
+		// out may be the same array as in
+		memcpy(out, x, sizeof(out));
+		test->array_func(out, out, TEST_DISPATCH_COUNT);
+		fails += report(test->name, level,
+			count_mismatches(out, ref, TEST_DISPATCH_COUNT, test->tolerance)
+		);
+	}
+
+	for (size_t c = 0; c < sizeof(binary_cases) / sizeof(binary_cases[0]); c++) {
+		const dispatch_binary_case* test = &binary_cases[c];
+		test_fill_Float64x2(&state, x, TEST_DISPATCH_COUNT, -8.0, 8.0);
+		test_fill_Float64x2(&state, y, TEST_DISPATCH_COUNT, 0.125, 8.0);
+		for (size_t i = 0; i < TEST_DISPATCH_COUNT; i++) {
+			ref[i] = test->scalar_func(x[i], y[i]);
+		}
+		test->array_func(x, y, out, TEST_DISPATCH_COUNT);
+		fails += report(test->name, level,
+			count_mismatches(out, ref, TEST_DISPATCH_COUNT, test->tolerance)
+		);
+	}
+
+	// n = 0 must not touch the arrays
+	memset(out, 0x7F, sizeof(out));
+	memcpy(ref, out, sizeof(out));
+	Float64x2_exp_array(x, out, 0);
+	Float64x2_add_array(x, y, out, 0);
+	fails += TEST_CHECK(memcmp(out, ref, sizeof(out)) == 0);
+	return fails;
+}
+
+int test_dispatch(void) {
+	int fails = 0;
+	const LDF_cpu_level detected = LDF_cpu_detect_level();
+	const LDF_cpu_level initial = LDF_cpu_get_level();
+	fails += TEST_CHECK(detected >= LDF_CPU_LEVEL_SCALAR);
+	fails += TEST_CHECK((int)detected < LDF_CPU_LEVEL_COUNT);
+	fails += TEST_CHECK(initial <= detected);
+
+	for (int level = 0; level < LDF_CPU_LEVEL_COUNT; level++) {
+		const char* name = LDF_cpu_level_name((LDF_cpu_level)level);
+		fails += TEST_CHECK(name != NULL && name[0] != '\0');
+	}
+
+	// Levels above the detected level are clamped
+	fails += TEST_CHECK(LDF_cpu_set_level(LDF_CPU_LEVEL_AVX512) == detected);
+	fails += TEST_CHECK(LDF_cpu_get_level() == detected);
+
+	for (int level = 0; level <= (int)detected; level++) {
+		fails += TEST_CHECK(LDF_cpu_set_level((LDF_cpu_level)level) == (LDF_cpu_level)level);
+		fails += TEST_CHECK(LDF_cpu_get_level() == (LDF_cpu_level)level);
+		fails += test_dispatch_level((LDF_cpu_level)level);
+	}
+
+	LDF_cpu_set_level(initial);
+	return fails;
+}
@@ -0,0 +1,453 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "test_common.h"
+
+#include "LDF/LDF_blas.h"
+#include "LDF/LDF_cpu_dispatch.h"
+#include "Float64x2/Float64x2.h"
+#include "Float64x2/Float64x2_blas.h"
+#include "Float64x4/Float64x4.h"
+#include "Float64x4/Float64x4_blas.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct gemm_size {
+	size_t m;
+	size_t n;
+	size_t k;
+} gemm_size;
+
+/**
+ * @brief Odd sizes test the edges of the micro-kernels, and the last size
+ * is larger than the MC and KC blocks.
+ */
+static const gemm_size gemm_sizes[] = {
+	{ 1,  1,   1},
+	{ 7,  5,   3},
+	{67, 13, 131}
+};
+
+static const LDF_blas_layout gemm_layouts[] = {
+	LDF_BLAS_ROW_MAJOR, LDF_BLAS_COL_MAJOR
+};
+
+static const LDF_blas_transpose gemm_transposes[] = {
+	LDF_BLAS_NO_TRANS, LDF_BLAS_TRANS
+};
+
+/** @brief Index of element (row, col) of a matrix */
+static size_t matrix_index(
+	const LDF_blas_layout layout, const size_t ld, const size_t row, const size_t col
+) {
+	return (layout == LDF_BLAS_ROW_MAJOR) ? row * ld + col : col * ld + row;
+}
+
+/** @brief Index of element (row, col) of op(A) */
+static size_t op_index(
+	const LDF_blas_layout layout, const LDF_blas_transpose trans, const size_t ld,
+	const size_t row, const size_t col
+) {
+	return (trans == LDF_BLAS_NO_TRANS) ?
+		matrix_index(layout, ld, row, col) : matrix_index(layout, ld, col, row);
+}
+
+/** @brief Leading dimension of a rows by cols matrix, with some padding */
+static size_t padded_ld(const LDF_blas_layout layout, const size_t rows, const size_t cols) {
+	return ((layout == LDF_BLAS_ROW_MAJOR) ? cols : rows) + 3;
+}
+
+//------------------------------------------------------------------------------
+// Float64x2
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Compares Float64x2_gemm against a naive triple loop. Each element
+ * may differ by a small multiple of the sum of the absolute products.
+ */
+static int test_Float64x2_gemm_case(
+	const LDF_blas_layout layout, const LDF_blas_transpose transa,
+	const LDF_blas_transpose transb, const gemm_size size, const int beta_zero
+) {
+	const size_t m = size.m, n = size.n, k = size.k;
+	// op(A) is m by k, and op(B) is k by n
+	const size_t lda = (transa == LDF_BLAS_NO_TRANS) ? padded_ld(layout, m, k) : padded_ld(layout, k, m);
+	const size_t ldb = (transb == LDF_BLAS_NO_TRANS) ? padded_ld(layout, k, n) : padded_ld(layout, n, k);
+	const size_t ldc = padded_ld(layout, m, n);
+	const size_t size_a = lda * ((m > k) ? m : k);
+	const size_t size_b = ldb * ((k > n) ? k : n);
+	const size_t size_c = ldc * ((m > n) ? m : n);
+	Float64x2* A = (Float64x2*)malloc(size_a * sizeof(Float64x2));
+	Float64x2* B = (Float64x2*)malloc(size_b * sizeof(Float64x2));
+	Float64x2* C = (Float64x2*)malloc(size_c * sizeof(Float64x2));
+	Float64x2* C_init = (Float64x2*)malloc(size_c * sizeof(Float64x2));
+	if (A == NULL || B == NULL || C == NULL || C_init == NULL) {
+		free(A); free(B); free(C); free(C_init);
+		return TEST_CHECK(!"malloc failed");
+	}
+	uint64_t state = UINT64_C(0x16) + m * 1000 + k;
+	test_fill_Float64x2(&state, A, size_a, -2.0, 2.0);
+	test_fill_Float64x2(&state, B, size_b, -2.0, 2.0);
+	test_fill_Float64x2(&state, C_init, size_c, -2.0, 2.0);
+	const Float64x2 alpha = Float64x2_add_d_d(0.75, 0x1.0p-70);
+	const Float64x2 beta = beta_zero ? Float64x2_set_zero() : Float64x2_set_d(-1.25);
+	if (beta_zero) {
+		// C is not read when beta is zero
+		for (size_t i = 0; i < size_c; i++) {
+			C_init[i] = Float64x2_set_d(NAN);
+		}
+	}
+	memcpy(C, C_init, size_c * sizeof(Float64x2));
+
+	Float64x2_gemm(layout, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+
+	size_t mismatches = 0;
+	for (size_t i = 0; i < m; i++) {
+		for (size_t j = 0; j < n; j++) {
+			Float64x2 sum = Float64x2_set_zero();
+			fp64 bound = 0.0;
+			for (size_t p = 0; p < k; p++) {
+				const Float64x2 a = A[op_index(layout, transa, lda, i, p)];
+				const Float64x2 b = B[op_index(layout, transb, ldb, p, j)];
+				sum = Float64x2_add(sum, Float64x2_mul(a, b));
+				bound += fabs(a.hi * b.hi);
+			}
+			const size_t ic = matrix_index(layout, ldc, i, j);
+			Float64x2 ref = Float64x2_mul(alpha, sum);
+			if (!beta_zero) {
+				ref = Float64x2_add(ref, Float64x2_mul(beta, C_init[ic]));
+				bound += fabs(beta.hi * C_init[ic].hi);
+			}
+			const Float64x2 diff = Float64x2_sub(C[ic], ref);
+			if (!(fabs(diff.hi) <= 0x1.0p-96 * (bound + 1.0))) {
+				mismatches++;
+			}
+		}
+	}
+	free(A); free(B); free(C); free(C_init);
+	if (mismatches != 0) {
+		printf(
+			"FAIL Float64x2_gemm %s %c%c m=%zu n=%zu k=%zu beta=%s: %zu mismatches\n",
+			(layout == LDF_BLAS_ROW_MAJOR) ? "row" : "col",
+			(transa == LDF_BLAS_NO_TRANS) ? 'N' : 'T',
+			(transb == LDF_BLAS_NO_TRANS) ? 'N' : 'T',
+			m, n, k, beta_zero ? "0" : "-1.25", mismatches
+		);
+		return 1;
+	}
+	return 0;
+}
+
+/** @brief Compares Float64x2_gemv, with a negative incy, against a naive loop */
+static int test_Float64x2_gemv_case(
+	const LDF_blas_layout layout, const LDF_blas_transpose trans, const gemm_size size
+) {
+	const size_t m = size.m, n = size.n;
+	const size_t lda = padded_ld(layout, m, n);
+	const size_t len_x = (trans == LDF_BLAS_NO_TRANS) ? n : m;
+	const size_t len_y = (trans == LDF_BLAS_NO_TRANS) ? m : n;
+	const size_t size_a = lda * ((m > n) ? m : n);
+	Float64x2* A = (Float64x2*)malloc(size_a * sizeof(Float64x2));
+	Float64x2* x = (Float64x2*)malloc(len_x * sizeof(Float64x2));
+	Float64x2* y = (Float64x2*)malloc(len_y * sizeof(Float64x2));
+	Float64x2* y_init = (Float64x2*)malloc(len_y * sizeof(Float64x2));
+	if (A == NULL || x == NULL || y == NULL || y_init == NULL) {
+		free(A); free(x); free(y); free(y_init);
+		return TEST_CHECK(!"malloc failed");
+	}
+	uint64_t state = UINT64_C(0x162) + m * 1000 + n;
+	test_fill_Float64x2(&state, A, size_a, -2.0, 2.0);
+	test_fill_Float64x2(&state, x, len_x, -2.0, 2.0);
+	test_fill_Float64x2(&state, y_init, len_y, -2.0, 2.0);
+	memcpy(y, y_init, len_y * sizeof(Float64x2));
+	const Float64x2 alpha = Float64x2_set_d(1.5);
+	const Float64x2 beta = Float64x2_set_d(0.5);
+
+	Float64x2_gemv(layout, trans, m, n, alpha, A, lda, x, 1, beta, y, -1);
+
+	size_t mismatches = 0;
+	for (size_t i = 0; i < len_y; i++) {
+		Float64x2 sum = Float64x2_set_zero();
+		fp64 bound = 0.0;
+		for (size_t j = 0; j < len_x; j++) {
+			const Float64x2 a = A[op_index(layout, trans, lda, i, j)];
+			sum = Float64x2_add(sum, Float64x2_mul(a, x[j]));
+			bound += fabs(a.hi * x[j].hi);
+		}
+		const size_t iy = test_strided_index(len_y, -1, i);
+		const Float64x2 ref = Float64x2_add(
+			Float64x2_mul(alpha, sum), Float64x2_mul(beta, y_init[iy])
+		);
+		const Float64x2 diff = Float64x2_sub(y[iy], ref);
+		if (!(fabs(diff.hi) <= 0x1.0p-96 * (bound + 1.0))) {
+			mismatches++;
+		}
+	}
+	free(A); free(x); free(y); free(y_init);
+	if (mismatches != 0) {
+		printf(
+			"FAIL Float64x2_gemv %s %c m=%zu n=%zu: %zu mismatches\n",
+			(layout == LDF_BLAS_ROW_MAJOR) ? "row" : "col",
+			(trans == LDF_BLAS_NO_TRANS) ? 'N' : 'T', m, n, mismatches
+		);
+		return 1;
+	}
+	return 0;
+}
+
+//------------------------------------------------------------------------------
+// Float64x4
+//------------------------------------------------------------------------------
+
+/** @brief Float64x4 version of test_Float64x2_gemm_case, with beta != 0 */
+static int test_Float64x4_gemm_case(
+	const LDF_blas_layout layout, const LDF_blas_transpose transa,
+	const LDF_blas_transpose transb, const gemm_size size
+) {
+	const size_t m = size.m, n = size.n, k = size.k;
+	const size_t lda = (transa == LDF_BLAS_NO_TRANS) ? padded_ld(layout, m, k) : padded_ld(layout, k, m);
+	const size_t ldb = (transb == LDF_BLAS_NO_TRANS) ? padded_ld(layout, k, n) : padded_ld(layout, n, k);
+	const size_t ldc = padded_ld(layout, m, n);
+	const size_t size_a = lda * ((m > k) ? m : k);
+	const size_t size_b = ldb * ((k > n) ? k : n);
+	const size_t size_c = ldc * ((m > n) ? m : n);
+	Float64x4* A = (Float64x4*)malloc(size_a * sizeof(Float64x4));
+	Float64x4* B = (Float64x4*)malloc(size_b * sizeof(Float64x4));
+	Float64x4* C = (Float64x4*)malloc(size_c * sizeof(Float64x4));
+	Float64x4* C_init = (Float64x4*)malloc(size_c * sizeof(Float64x4));
+	if (A == NULL || B == NULL || C == NULL || C_init == NULL) {
+		free(A); free(B); free(C); free(C_init);
+		return TEST_CHECK(!"malloc failed");
+	}
+	uint64_t state = UINT64_C(0x164) + m * 1000 + k;
+	test_fill_Float64x4(&state, A, size_a, -2.0, 2.0);
+	test_fill_Float64x4(&state, B, size_b, -2.0, 2.0);
+	test_fill_Float64x4(&state, C_init, size_c, -2.0, 2.0);
+	memcpy(C, C_init, size_c * sizeof(Float64x4));
+	const Float64x4 alpha = Float64x4_set_d(0.75);
+	const Float64x4 beta = Float64x4_set_d(-1.25);
+
+	Float64x4_gemm(layout, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+
+	size_t mismatches = 0;
+	for (size_t i = 0; i < m; i++) {
+		for (size_t j = 0; j < n; j++) {
+			Float64x4 sum = Float64x4_set_zero();
+			fp64 bound = 0.0;
+			for (size_t p = 0; p < k; p++) {
+				const Float64x4 a = A[op_index(layout, transa, lda, i, p)];
+				const Float64x4 b = B[op_index(layout, transb, ldb, p, j)];
+				sum = Float64x4_add(sum, Float64x4_mul(a, b));
+				bound += fabs(a.val[0] * b.val[0]);
+			}
+			const size_t ic = matrix_index(layout, ldc, i, j);
+			const Float64x4 ref = Float64x4_add(
+				Float64x4_mul(alpha, sum), Float64x4_mul(beta, C_init[ic])
+			);
+			bound += fabs(beta.val[0] * C_init[ic].val[0]);
+			const Float64x4 diff = Float64x4_sub(C[ic], ref);
+			if (!(fabs(diff.val[0]) <= 0x1.0p-196 * (bound + 1.0))) {
+				mismatches++;
+			}
+		}
+	}
+	free(A); free(B); free(C); free(C_init);
+	if (mismatches != 0) {
+		printf(
+			"FAIL Float64x4_gemm %s %c%c m=%zu n=%zu k=%zu: %zu mismatches\n",
+			(layout == LDF_BLAS_ROW_MAJOR) ? "row" : "col",
+			(transa == LDF_BLAS_NO_TRANS) ? 'N' : 'T',
+			(transb == LDF_BLAS_NO_TRANS) ? 'N' : 'T',
+			m, n, k, mismatches
+		);
+		return 1;
+	}
+	return 0;
+}
+
+//------------------------------------------------------------------------------
+// Mixed precision
+//------------------------------------------------------------------------------
+
+/* The number of cancelling groups in each row of op(A) */
+#define TEST_GEMV_D_GROUPS 14
+#define TEST_GEMV_D_TAIL 3
+#define TEST_GEMV_D_ROWS 7
+#define TEST_GEMV_D_COLS (3 * TEST_GEMV_D_GROUPS + TEST_GEMV_D_TAIL)
+
+/**
+ * @brief Compares Float64x2_gemv_d and Float64x4_gemv_d against the exact
+ * result. Row i of op(A) * x has the groups (a, b), (-p, 1), and (-e, 1)
+ * where a * b = p + e and p = fl(a * b), which cancel exactly, followed by
+ * the tail (i + 1) + 2^-60 + 3 * 2^-80.
+ */
+static int test_gemv_d_case(const LDF_blas_layout layout, const LDF_blas_transpose trans) {
+	static const fp64 tail_x[TEST_GEMV_D_TAIL] = { 1.0, 1.0, 0x1.0p-80 };
+	const size_t len_x = TEST_GEMV_D_COLS;
+	const size_t len_y = TEST_GEMV_D_ROWS;
+	const size_t m = (trans == LDF_BLAS_NO_TRANS) ? len_y : len_x;
+	const size_t n = (trans == LDF_BLAS_NO_TRANS) ? len_x : len_y;
+	const size_t lda = padded_ld(layout, m, n);
+	const size_t size_a = lda * ((m > n) ? m : n);
+	fp64 op_a[TEST_GEMV_D_ROWS][TEST_GEMV_D_COLS];
+	fp64 x[TEST_GEMV_D_COLS];
+	fp64* A = (fp64*)malloc(size_a * sizeof(fp64));
+	if (A == NULL) {
+		return TEST_CHECK(!"malloc failed");
+	}
+	uint64_t state = UINT64_C(0x17) + (size_t)layout * 10 + (size_t)trans;
+	for (size_t j = 0; j < TEST_GEMV_D_GROUPS; j++) {
+		const fp64 b = ldexp(
+			test_rand_fp64(&state, 1.0, 2.0), (int)(test_rand_u64(&state) % 31) - 10
+		);
+		x[3 * j + 0] = b;
+		x[3 * j + 1] = 1.0;
+		x[3 * j + 2] = 1.0;
+		for (size_t i = 0; i < len_y; i++) {
+			const fp64 a = ldexp(
+				test_rand_fp64(&state, 1.0, 2.0), (int)(test_rand_u64(&state) % 31) - 10
+			);
+			const Float64x2 prod = Float64x2_mul_d_d(a, b);
+			op_a[i][3 * j + 0] = a;
+			op_a[i][3 * j + 1] = -prod.hi;
+			op_a[i][3 * j + 2] = -prod.lo;
+		}
+	}
+	for (size_t j = 0; j < TEST_GEMV_D_TAIL; j++) {
+		x[3 * TEST_GEMV_D_GROUPS + j] = tail_x[j];
+	}
+	for (size_t i = 0; i < len_y; i++) {
+		op_a[i][3 * TEST_GEMV_D_GROUPS + 0] = (fp64)(i + 1);
+		op_a[i][3 * TEST_GEMV_D_GROUPS + 1] = 0x1.0p-60;
+		op_a[i][3 * TEST_GEMV_D_GROUPS + 2] = 3.0;
+	}
+	// Shuffles the columns
+	for (size_t j = len_x - 1; j > 0; j--) {
+		const size_t k = (size_t)(test_rand_u64(&state) % (j + 1));
+		fp64 temp = x[j]; x[j] = x[k]; x[k] = temp;
+		for (size_t i = 0; i < len_y; i++) {
+			temp = op_a[i][j]; op_a[i][j] = op_a[i][k]; op_a[i][k] = temp;
+		}
+	}
+	for (size_t i = 0; i < size_a; i++) {
+		A[i] = NAN;
+	}
+	fp64 abs_sum[TEST_GEMV_D_ROWS];
+	for (size_t i = 0; i < len_y; i++) {
+		abs_sum[i] = 0.0;
+		for (size_t j = 0; j < len_x; j++) {
+			A[op_index(layout, trans, lda, i, j)] = op_a[i][j];
+			abs_sum[i] += fabs(op_a[i][j] * x[j]);
+		}
+	}
+
+	size_t mismatches = 0;
+	/* Float64x2, where y must not be read when beta is zero */ {
+		const Float64x2 alpha = Float64x2_set_d(1.5);
+		const Float64x2 beta = Float64x2_set_d(0.5);
+		Float64x2 y[TEST_GEMV_D_ROWS];
+		Float64x2 y_init[TEST_GEMV_D_ROWS];
+		test_fill_Float64x2(&state, y_init, len_y, -2.0, 2.0);
+		for (size_t i = 0; i < len_y; i++) {
+			y[i] = Float64x2_set_d(NAN);
+		}
+		Float64x2_gemv_d(layout, trans, m, n, alpha, A, lda, x, 1, Float64x2_set_zero(), y, -1);
+		for (size_t i = 0; i < len_y; i++) {
+			const Float64x2 ref = Float64x2_mul(alpha, Float64x2_add_d_d((fp64)(i + 1), 0x1.00003p-60));
+			const Float64x2 diff = Float64x2_sub(y[test_strided_index(len_y, -1, i)], ref);
+			mismatches += !(fabs(diff.hi) <= 0x1.0p-100 * fabs(ref.hi) + 2.0 * test_dot2_bound(len_x, abs_sum[i]));
+		}
+		memcpy(y, y_init, sizeof(y));
+		Float64x2_gemv_d(layout, trans, m, n, alpha, A, lda, x, 1, beta, y, -1);
+		for (size_t i = 0; i < len_y; i++) {
+			const size_t iy = test_strided_index(len_y, -1, i);
+			const Float64x2 ref = Float64x2_add(
+				Float64x2_mul(alpha, Float64x2_add_d_d((fp64)(i + 1), 0x1.00003p-60)),
+				Float64x2_mul(beta, y_init[iy])
+			);
+			const Float64x2 diff = Float64x2_sub(y[iy], ref);
+			mismatches += !(fabs(diff.hi) <= 0x1.0p-100 * (fabs(ref.hi) + 1.0) + 2.0 * test_dot2_bound(len_x, abs_sum[i]));
+		}
+	}
+	/* Float64x4 */ {
+		const Float64x4 alpha = Float64x4_set_d(1.5);
+		const Float64x4 beta = Float64x4_set_d(0.5);
+		Float64x4 y[TEST_GEMV_D_ROWS];
+		Float64x4 y_init[TEST_GEMV_D_ROWS];
+		test_fill_Float64x4(&state, y_init, len_y, -2.0, 2.0);
+		memcpy(y, y_init, sizeof(y));
+		Float64x4_gemv_d(layout, trans, m, n, alpha, A, lda, x, 1, beta, y, -1);
+		for (size_t i = 0; i < len_y; i++) {
+			const size_t iy = test_strided_index(len_y, -1, i);
+			const Float64x4 exact = Float64x4_add(
+				Float64x4_set_d((fp64)(i + 1)), Float64x4_set_d(0x1.00003p-60)
+			);
+			const Float64x4 ref = Float64x4_add(
+				Float64x4_mul(alpha, exact), Float64x4_mul(beta, y_init[iy])
+			);
+			const Float64x4 diff = Float64x4_sub(y[iy], ref);
+			mismatches += !(fabs(diff.val[0]) <= 0x1.0p-200 * ((fp64)len_x * abs_sum[i] + 16.0));
+		}
+	}
+	free(A);
+	if (mismatches != 0) {
+		printf(
+			"FAIL gemv_d %s %c: %zu mismatches\n",
+			(layout == LDF_BLAS_ROW_MAJOR) ? "row" : "col",
+			(trans == LDF_BLAS_NO_TRANS) ? 'N' : 'T', mismatches
+		);
+		return 1;
+	}
+	return 0;
+}
+
+static int test_gemm_level(void) {
+	int fails = 0;
+	for (size_t l = 0; l < sizeof(gemm_layouts) / sizeof(gemm_layouts[0]); l++) {
+	for (size_t ta = 0; ta < sizeof(gemm_transposes) / sizeof(gemm_transposes[0]); ta++) {
+		fails += test_gemv_d_case(gemm_layouts[l], gemm_transposes[ta]);
+	}
+	}
+	for (size_t s = 0; s < sizeof(gemm_sizes) / sizeof(gemm_sizes[0]); s++) {
+	for (size_t l = 0; l < sizeof(gemm_layouts) / sizeof(gemm_layouts[0]); l++) {
+	for (size_t ta = 0; ta < sizeof(gemm_transposes) / sizeof(gemm_transposes[0]); ta++) {
+		fails += test_Float64x2_gemv_case(gemm_layouts[l], gemm_transposes[ta], gemm_sizes[s]);
+		for (size_t tb = 0; tb < sizeof(gemm_transposes) / sizeof(gemm_transposes[0]); tb++) {
+			fails += test_Float64x2_gemm_case(
+				gemm_layouts[l], gemm_transposes[ta], gemm_transposes[tb], gemm_sizes[s], 0
+			);
+			fails += test_Float64x2_gemm_case(
+				gemm_layouts[l], gemm_transposes[ta], gemm_transposes[tb], gemm_sizes[s], 1
+			);
+			fails += test_Float64x4_gemm_case(
+				gemm_layouts[l], gemm_transposes[ta], gemm_transposes[tb], gemm_sizes[s]
+			);
+		}
+	}
+	}
+	}
+	return fails;
+}
+
+int test_gemm(void) {
+	int fails = 0;
+	const LDF_cpu_level detected = LDF_cpu_detect_level();
+	const LDF_cpu_level initial = LDF_cpu_get_level();
+	for (int level = 0; level <= (int)detected; level++) {
+		LDF_cpu_set_level((LDF_cpu_level)level);
+		const int level_fails = test_gemm_level();
+		if (level_fails != 0) {
+			printf("FAIL GEMM and GEMV at level %s\n", LDF_cpu_level_name((LDF_cpu_level)level));
+		}
+		fails += level_fails;
+	}
+	LDF_cpu_set_level(initial);
+	return fails;
+}
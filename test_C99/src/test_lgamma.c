@@ -0,0 +1,137 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "test_common.h"
+
+#include "Float64/Float64_AVX.h"
+
+#include <math.h>
+
+/**
+ * @brief Error of x in ulps of ref
+ */
+static fp64 test_lgamma_ulp(const fp64 x, const fp64 ref) {
+	if (x == ref || (isnan(x) && isnan(ref))) {
+		return 0.0;
+	}
+	const fp64 ulp = nextafter(fabs(ref), INFINITY) - fabs(ref);
+	return fabs(x - ref) / ulp;
+}
+
+/**
+ * @brief Compares each lane of _mm256_lgamma_pd(x) against libm, and returns
+ * the largest error in ulps.
+ */
+static fp64 test_lgamma_max_ulp(const fp64* x, const size_t n) {
+	fp64 max_ulp = 0.0;
+	for (size_t i = 0; i < n; i += 4) {
+		fp64 lane[4] = {x[i], x[i], x[i], x[i]};
+		for (size_t j = 1; j < 4 && i + j < n; j++) {
+			lane[j] = x[i + j];
+		}
+		fp64 ret[4];
+		_mm256_storeu_pd(ret, _mm256_lgamma_pd(_mm256_loadu_pd(lane)));
+		for (size_t j = 0; j < 4; j++) {
+			const fp64 err = test_lgamma_ulp(ret[j], lgamma(lane[j]));
+			max_ulp = (err > max_ulp) ? err : max_ulp;
+		}
+	}
+	return max_ulp;
+}
+
+/**
+ * @brief 1 / x overflows for subnormal x, so lgamma(x) = -log(|x|) is used.
+ */
+static int test_lgamma_tiny(void) {
+	const fp64 x[12] = {
+		0x1.0p-1074, -0x1.0p-1074, 1.0e-310, -1.0e-310,
+		0x1.0p-1022, -0x1.0p-1022, 1.0e-300, -1.0e-300,
+		0x1.0p-55, -0x1.0p-55, 0x1.0p-53, -0x1.0p-53
+	};
+	return TEST_CHECK(test_lgamma_max_ulp(x, 12) <= 1.0);
+}
+
+/**
+ * @brief The reflection formula cancels near the roots of lgamma(x) inside
+ * (-10.0, -2.0), so the relative error is checked on both sides of each root.
+ */
+static int test_lgamma_roots(void) {
+	static const fp64 roots[16] = {
+		-2.4570247382208006, -2.7476826467274126, -3.1435808883499801, -3.9552942848585979,
+		-4.0393618397405369, -4.9915446405600477, -5.0082181683225935, -5.9986074800808756,
+		-6.0013852944531551, -6.9998015078906377, -7.0001983334073248, -7.9999751970958207,
+		-8.0000248002706820, -8.9999972442509775, -9.0000027557148227, -9.9999997244266292
+	};
+	int fails = 0;
+	for (size_t r = 0; r < 16; r++) {
+		const fp64 root = roots[r];
+		// Half of the distance covered by the Taylor series around the root
+		const fp64 width = fabs(root - round(root)) * 0.0625;
+		fp64 x[64];
+		for (size_t i = 0; i < 32; i++) {
+			// Adjacent values, where lgamma(x) is tiny
+			x[i] = root + ((fp64)i - 16.0) * 0x1.0p-52 * fabs(root);
+			x[i + 32] = root + ((fp64)i - 16.0) * (width / 16.0);
+		}
+		const fp64 max_ulp = test_lgamma_max_ulp(x, 64);
+		if (max_ulp > 8.0) {
+			printf("FAIL lgamma: %.3g ulp near the root %.17g\n", max_ulp, root);
+			fails++;
+		}
+	}
+	return fails;
+}
+
+/**
+ * @brief lgamma(x) away from the roots
+ */
+static int test_lgamma_range(void) {
+	int fails = 0;
+	uint64_t seed = 0x6C67616D6D61;
+	fp64 x[256];
+	for (size_t i = 0; i < 256; i++) {
+		x[i] = test_rand_fp64(&seed, 0.0, 40.0);
+	}
+	fails += TEST_CHECK(test_lgamma_max_ulp(x, 256) <= 4.0);
+	for (size_t i = 0; i < 256; i++) {
+		x[i] = exp(test_rand_fp64(&seed, 3.0, 700.0));
+	}
+	fails += TEST_CHECK(test_lgamma_max_ulp(x, 256) <= 4.0);
+	return fails;
+}
+
+/**
+ * @brief lgamma(x) = +inf for +-0.0, negative integers, and +-inf
+ */
+static int test_lgamma_special(void) {
+	int fails = 0;
+	const __m256d x_pole = _mm256_setr_pd(0.0, -0.0, -3.0, -0x1.0p+60);
+	const __m256d x_inf = _mm256_setr_pd(INFINITY, -INFINITY, 1.0, 2.0);
+	fp64 ret_pole[4], ret_inf[4];
+	_mm256_storeu_pd(ret_pole, _mm256_lgamma_pd(x_pole));
+	_mm256_storeu_pd(ret_inf, _mm256_lgamma_pd(x_inf));
+	for (int i = 0; i < 4; i++) {
+		fails += TEST_CHECK(ret_pole[i] == INFINITY);
+	}
+	fails += TEST_CHECK(ret_inf[0] == INFINITY && ret_inf[1] == INFINITY);
+	// lgamma(1) = lgamma(2) = 0
+	fails += TEST_CHECK(ret_inf[2] == 0.0 && ret_inf[3] == 0.0);
+	fp64 ret_nan[4];
+	_mm256_storeu_pd(ret_nan, _mm256_lgamma_pd(_mm256_set1_pd(NAN)));
+	fails += TEST_CHECK(isnan(ret_nan[0]));
+	return fails;
+}
+
+int test_lgamma(void) {
+	int fails = 0;
+	fails += test_lgamma_tiny();
+	fails += test_lgamma_roots();
+	fails += test_lgamma_range();
+	fails += test_lgamma_special();
+	return fails;
+}
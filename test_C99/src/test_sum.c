@@ -0,0 +1,169 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "test_common.h"
+
+#include "LDF/LDF_cpu_dispatch.h"
+#include "Float64/Float64_sum.h"
+#include "Float64x2/Float64x2.h"
+#include "Float64x2/Float64x2_blas.h"
+
+#include <math.h>
+#include <string.h>
+
+/* The number of cancelling pairs. Odd, so that the SIMD tails are used */
+#define TEST_SUM_PAIRS 101
+#define TEST_SUM_TAIL 3
+#define TEST_SUM_COUNT (2 * TEST_SUM_PAIRS + TEST_SUM_TAIL)
+
+/**
+ * @brief Fills x with the pairs a[i] and -a[i], where a[i] ranges from 2^-20
+ * to 2^100, followed by the tail, and shuffles them. The exact sum is the
+ * sum of the tail, and the condition number is about 2^108.
+ */
+static void fill_ill_conditioned(
+	uint64_t* state, fp64* x, const fp64 tail[TEST_SUM_TAIL]
+) {
+	for (size_t i = 0; i < TEST_SUM_PAIRS; i++) {
+		const fp64 a = ldexp(
+			test_rand_fp64(state, 1.0, 2.0), (int)(test_rand_u64(state) % 121) - 20
+		);
+		x[2 * i + 0] = a;
+		x[2 * i + 1] = -a;
+	}
+	for (size_t i = 0; i < TEST_SUM_TAIL; i++) {
+		x[2 * TEST_SUM_PAIRS + i] = tail[i];
+	}
+	for (size_t i = TEST_SUM_COUNT - 1; i > 0; i--) {
+		const size_t j = (size_t)(test_rand_u64(state) % (i + 1));
+		const fp64 temp = x[i];
+		x[i] = x[j];
+		x[j] = temp;
+	}
+}
+
+/** @brief Returns true if ret is lo or the next fp64 after lo */
+static int is_faithful(const fp64 ret, const fp64 lo) {
+	return ret == lo || ret == nextafter(lo, INFINITY);
+}
+
+static int test_sum_level(void) {
+	int fails = 0;
+	uint64_t state = UINT64_C(0x18);
+	fp64 x[TEST_SUM_COUNT];
+
+	/* The exact sum is representable, so AccSum must return it */ {
+		const fp64 tail[TEST_SUM_TAIL] = { 1.0, 0x1.0p-20, 0x1.0p-52 };
+		const fp64 exact = 1.0 + 0x1.0p-20 + 0x1.0p-52;
+		for (int trial = 0; trial < 8; trial++) {
+			fill_ill_conditioned(&state, x, tail);
+			fails += TEST_CHECK(Float64_accsum(TEST_SUM_COUNT, x, 1) == exact);
+			fails += TEST_CHECK(Float64_sumK(TEST_SUM_COUNT, x, 1, 4) == exact);
+			const Float64x2 sum_x2 = Float64x2_sumK_d(TEST_SUM_COUNT, x, 1, 4);
+			fails += TEST_CHECK(sum_x2.hi == exact && sum_x2.lo == 0.0);
+		}
+	}
+
+	/* 1 + 1.5 * 2^-53 lies between 1 and 1 + 2^-52 */ {
+		const fp64 tail[TEST_SUM_TAIL] = { 1.0, 0x1.0p-53, 0x1.0p-54 };
+		for (int trial = 0; trial < 8; trial++) {
+			fill_ill_conditioned(&state, x, tail);
+			fails += TEST_CHECK(is_faithful(Float64_accsum(TEST_SUM_COUNT, x, 1), 1.0));
+			fails += TEST_CHECK(is_faithful(Float64_sumK(TEST_SUM_COUNT, x, 1, 4), 1.0));
+			// Float64x2 can represent the exact sum
+			const Float64x2 diff = Float64x2_sub(
+				Float64x2_sumK_d(TEST_SUM_COUNT, x, 1, 4),
+				Float64x2_add_d_d(1.0, 0x1.8p-53)
+			);
+			fails += TEST_CHECK(fabs(diff.hi) <= 0x1.0p-100);
+		}
+	}
+
+	/* The exact total of the partials is the sum */ {
+		const fp64 tail[TEST_SUM_TAIL] = { 3.0, -0x1.0p-30, 0x1.0p-70 };
+		fill_ill_conditioned(&state, x, tail);
+		fp64 partials[FLOAT64_SUMK_MAX];
+		fails += TEST_CHECK(Float64_sumK_partials(TEST_SUM_COUNT, x, 1, 0, partials) == 1);
+		fails += TEST_CHECK(Float64_sumK_partials(TEST_SUM_COUNT, x, 1, 99, partials) == FLOAT64_SUMK_MAX);
+		const fp64 total = Float64_accsum(FLOAT64_SUMK_MAX, partials, 1);
+		fails += TEST_CHECK(is_faithful(total, 3.0 - 0x1.0p-30));
+		fails += TEST_CHECK(total == Float64_sumK(TEST_SUM_COUNT, x, 1, FLOAT64_SUMK_MAX));
+	}
+
+	/* Special values */ {
+		const fp64 with_inf[3] = { 1.0, INFINITY, -2.0 };
+		const fp64 with_nan[3] = { 1.0, NAN, -2.0 };
+		fails += TEST_CHECK(Float64_accsum(3, with_inf, 1) == INFINITY);
+		fails += TEST_CHECK(isnan(Float64_accsum(3, with_nan, 1)));
+		fails += TEST_CHECK(Float64_accsum(0, with_inf, 1) == 0.0);
+		fails += TEST_CHECK(Float64_sumK(0, with_inf, 1, 2) == 0.0);
+	}
+	return fails;
+}
+
+/**
+ * @brief Every level, and the strided scalar loop, must give the same bits
+ * as the scalar level.
+ */
+static int test_sum_reproducible(const LDF_cpu_level detected) {
+	int fails = 0;
+	uint64_t state = UINT64_C(0x182);
+	fp64 x[TEST_SUM_COUNT];
+	fp64 x_strided[2 * TEST_SUM_COUNT];
+	// Well conditioned, so that the rounding of each level matters
+	for (size_t i = 0; i < TEST_SUM_COUNT; i++) {
+		x[i] = test_rand_fp64(&state, -1.0, 3.0);
+		x_strided[2 * i + 0] = x[i];
+		x_strided[2 * i + 1] = NAN;
+	}
+
+	fp64 ref[FLOAT64_SUMK_MAX + 1];
+	LDF_cpu_set_level(LDF_CPU_LEVEL_SCALAR);
+	for (int K = 1; K <= FLOAT64_SUMK_MAX; K++) {
+		ref[K - 1] = Float64_sumK(TEST_SUM_COUNT, x, 1, K);
+	}
+	ref[FLOAT64_SUMK_MAX] = Float64_accsum(TEST_SUM_COUNT, x, 1);
+
+	for (int level = 0; level <= (int)detected; level++) {
+		LDF_cpu_set_level((LDF_cpu_level)level);
+		size_t mismatches = 0;
+		for (int K = 1; K <= FLOAT64_SUMK_MAX; K++) {
+			const fp64 ret = Float64_sumK(TEST_SUM_COUNT, x, 1, K);
+			const fp64 ret_strided = Float64_sumK(TEST_SUM_COUNT, x_strided, 2, K);
+			mismatches += memcmp(&ret, &ref[K - 1], sizeof(fp64)) != 0;
+			mismatches += memcmp(&ret_strided, &ref[K - 1], sizeof(fp64)) != 0;
+		}
+		const fp64 ret = Float64_accsum(TEST_SUM_COUNT, x, 1);
+		mismatches += memcmp(&ret, &ref[FLOAT64_SUMK_MAX], sizeof(fp64)) != 0;
+		if (mismatches != 0) {
+			printf(
+				"FAIL Float64_sumK is not reproducible at level %s: %zu mismatches\n",
+				LDF_cpu_level_name((LDF_cpu_level)level), mismatches
+			);
+			fails++;
+		}
+	}
+	return fails;
+}
+
+int test_sum(void) {
+	int fails = 0;
+	const LDF_cpu_level detected = LDF_cpu_detect_level();
+	const LDF_cpu_level initial = LDF_cpu_get_level();
+	for (int level = 0; level <= (int)detected; level++) {
+		LDF_cpu_set_level((LDF_cpu_level)level);
+		const int level_fails = test_sum_level();
+		if (level_fails != 0) {
+			printf("FAIL Float64_sum at level %s\n", LDF_cpu_level_name((LDF_cpu_level)level));
+		}
+		fails += level_fails;
+	}
+	fails += test_sum_reproducible(detected);
+	LDF_cpu_set_level(initial);
+	return fails;
+}
@@ -88,6 +88,8 @@ inline int64_t getNanoTime(void) {
 
 #include "precision_test.hpp"
 
+#include "test_common.hpp"
+
 #endif
 
 #if 1
@@ -345,6 +347,16 @@ int main(void) {
 	
 	// get_fact();
 	printf("\n");
+
+	int fails = 0;
+	fails += test_trig();
+	fails += test_parallel();
+	fails += test_polynomial();
+	fails += test_exp();
+	fails += test_log();
+	fails += test_trigpi();
+	printf("%d test failure%s\n", fails, (fails == 1) ? "" : "s");
+
 	fflush(stdout);
-	return 0;
+	return (fails == 0) ? 0 : 1;
 }
@@ -0,0 +1,148 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#ifndef TEST_COMMON_HPP
+#define TEST_COMMON_HPP
+
+/**
+ * @brief Helpers shared by the test_*.cpp files. Each test function returns
+ * the number of failed checks, and prints the location of each failure.
+ */
+
+#include "../../Float64/Float64.h"
+#include "../../Float64x2/Float64x2_def.h"
+#include "../../Float64x4/Float64x4_def.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#ifdef LDF_ENABLE_FLOAT128
+	#include <quadmath.h>
+#endif
+
+/**
+ * @brief Evaluates to 1 and prints the expression when cond is false,
+ * otherwise evaluates to 0.
+ */
+#define TEST_CHECK(cond) test_check(static_cast<bool>(cond), #cond, __FILE__, __LINE__)
+
+inline int test_check(
+	const bool passed, const char* expr, const char* file, const int line
+) {
+	if (passed) {
+		return 0;
+	}
+	printf("FAIL %s:%d: %s\n", file, line, expr);
+	return 1;
+}
+
+/**
+ * @brief splitmix64, so that every run uses the same inputs.
+ */
+inline uint64_t test_rand_u64(uint64_t& state) {
+	uint64_t z = (state += UINT64_C(0x9E3779B97F4A7C15));
+	z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+	z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+	return z ^ (z >> 31);
+}
+
+/**
+ * @brief Returns a random fp64 within [min, max)
+ */
+inline fp64 test_rand_fp64(uint64_t& state, const fp64 min, const fp64 max) {
+	const fp64 u = static_cast<fp64>(test_rand_u64(state) >> 11) * 0x1.0p-53;
+	return min + (max - min) * u;
+}
+
+/**
+ * @brief Returns true if x and y have the same bits, which also compares
+ * NaN and the sign of zero.
+ */
+template<typename T>
+inline bool test_bitwise_equal(const T& x, const T& y) {
+	return memcmp(&x, &y, sizeof(T)) == 0;
+}
+
+#ifdef LDF_ENABLE_FLOAT128
+/** @brief Converts x to __float128, which is exact for Float64x2 */
+inline LDF_Float128 test_to_fp128(const Float64x2& x) {
+	return static_cast<LDF_Float128>(x.hi) + static_cast<LDF_Float128>(x.lo);
+}
+
+/** @brief Converts x to __float128, rounding the lower limbs */
+inline LDF_Float128 test_to_fp128(const Float64x4& x) {
+	return
+		static_cast<LDF_Float128>(x.val[0]) + static_cast<LDF_Float128>(x.val[1]) +
+		static_cast<LDF_Float128>(x.val[2]) + static_cast<LDF_Float128>(x.val[3]);
+}
+
+/**
+ * @brief Splits x into its first limb and the sum of the other limbs.
+ * Float64x4 can hold more bits than __float128, so reference values are
+ * computed from hi and lo instead of from test_to_fp128(x).
+ */
+inline void test_split_fp128(const Float64x2& x, fp64& hi, LDF_Float128& lo) {
+	hi = x.hi;
+	lo = static_cast<LDF_Float128>(x.lo);
+}
+
+/** @copydoc test_split_fp128 */
+inline void test_split_fp128(const Float64x4& x, fp64& hi, LDF_Float128& lo) {
+	hi = x.val[0];
+	lo =
+		static_cast<LDF_Float128>(x.val[1]) + static_cast<LDF_Float128>(x.val[2]) +
+		static_cast<LDF_Float128>(x.val[3]);
+}
+
+/**
+ * @brief Error of x against a __float128 reference in ulps, where an ulp is
+ * precision * |ref|. The lower limbs can not go below the smallest subnormal,
+ * so an ulp is at least 2^-1074.
+ */
+inline fp64 test_ulp_error(
+	const LDF_Float128 x, const LDF_Float128 ref, const fp64 precision
+) {
+	if (isnanq(x) || isnanq(ref)) {
+		return (isnanq(x) && isnanq(ref)) ? 0.0 : INFINITY;
+	}
+	if (x == ref) {
+		return 0.0;
+	}
+	LDF_Float128 ulp = fabsq(ref) * static_cast<LDF_Float128>(precision);
+	if (ulp < static_cast<LDF_Float128>(0x1.0p-1074)) {
+		ulp = static_cast<LDF_Float128>(0x1.0p-1074);
+	}
+	return static_cast<fp64>(fabsq(x - ref) / ulp);
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Tests
+//------------------------------------------------------------------------------
+
+/** @brief The trigonometric functions */
+int test_trig();
+
+/** @brief Float64x2_parallel.hpp and Float64x4_parallel.hpp */
+int test_parallel();
+
+/** @brief Horner and Estrin evaluation from LDF_polynomial.hpp */
+int test_polynomial();
+
+/** @brief exp and expm1 against __float128, up to the overflow and underflow thresholds */
+int test_exp();
+
+/** @brief log against __float128 near 1, at powers of two, and for subnormals */
+int test_log();
+
+/** @brief sinpi, cospi, and tanpi at exactly representable results */
+int test_trigpi();
+
+#endif /* TEST_COMMON_HPP */
@@ -0,0 +1,168 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "test_common.hpp"
+
+#include "../../Float64x2/Float64x2.hpp"
+#include "../../Float64x4/Float64x4.hpp"
+
+#include <cmath>
+#include <limits>
+
+/** @brief The largest fp64 where exp(x) is finite, log(DBL_MAX) rounded down */
+static const fp64 exp_overflow = +0x1.62e42fefa39efp+9;
+/** @brief The smallest fp64 where exp(x) does not round to zero */
+static const fp64 exp_underflow = -0x1.74910d52d3051p+9;
+
+/**
+ * @brief Returns a random value within [min, max), with a random lower limb
+ * so that the reduction sees every bit of the input.
+ */
+template <typename T>
+static T random_input(uint64_t& seed, const fp64 min, const fp64 max) {
+	const fp64 hi = test_rand_fp64(seed, min, max);
+	return static_cast<T>(hi) + static_cast<T>(hi * test_rand_fp64(seed, -0x1.0p-54, 0x1.0p-54));
+}
+
+#ifdef LDF_ENABLE_FLOAT128
+
+/**
+ * @brief expq is only accurate to about 2^-107 when x has more bits than a
+ * fp64, so exp(hi + lo) = exp(hi) * (1 + expm1(lo)) is used.
+ */
+template <typename T>
+static LDF_Float128 reference_exp(const T& x) {
+	fp64 hi;
+	LDF_Float128 lo;
+	test_split_fp128(x, hi, lo);
+	const LDF_Float128 exp_hi = expq(static_cast<LDF_Float128>(hi));
+	return exp_hi + exp_hi * expm1q(lo);
+}
+
+/** @copydoc reference_exp */
+template <typename T>
+static LDF_Float128 reference_expm1(const T& x) {
+	fp64 hi;
+	LDF_Float128 lo;
+	test_split_fp128(x, hi, lo);
+	const LDF_Float128 expm1_hi = expm1q(static_cast<LDF_Float128>(hi));
+	return expm1_hi + (expm1_hi + static_cast<LDF_Float128>(1.0)) * expm1q(lo);
+}
+
+struct exp_range {
+	fp64 min;
+	fp64 max;
+};
+
+/**
+ * @brief exp near 0, the largest inputs, and the inputs where the result is
+ * subnormal or where its lower limbs are.
+ */
+static const exp_range exp_ranges[] = {
+	{  -700.0, +700.0},
+	{  +700.0, exp_overflow},
+	{  -708.5, -700.0},
+	{  -745.2, -708.5}
+};
+
+/** @brief expm1 near 0 uses a Taylor series instead of the table */
+static const exp_range expm1_ranges[] = {
+	{-0x1.0p-10, +0x1.0p-10},
+	{  -2.0    ,   +2.0   },
+	{ -40.0    ,  +40.0   }
+};
+
+/**
+ * @brief Compares exp and expm1 against __float128. precision is the
+ * size of an ulp relative to the result, which for Float64x4 is limited by
+ * the precision of __float128.
+ */
+template <typename T>
+static int test_exp_accuracy(
+	const char* name, const fp64 precision, const fp64 tolerance, const fp64 expm1_tolerance
+) {
+	int fails = 0;
+	uint64_t seed = UINT64_C(0x21);
+	for (const exp_range& range : exp_ranges) {
+		fp64 max_ulp = 0.0;
+		for (int i = 0; i < 2000; i++) {
+			const T x = random_input<T>(seed, range.min, range.max);
+			const fp64 ulp = test_ulp_error(
+				test_to_fp128(exp(x)), reference_exp(x), precision
+			);
+			max_ulp = (ulp > max_ulp) ? ulp : max_ulp;
+		}
+		if (max_ulp > tolerance) {
+			printf("FAIL %s exp on [%g, %g]: %.3g ulp\n", name, range.min, range.max, max_ulp);
+			fails++;
+		}
+	}
+	for (const exp_range& range : expm1_ranges) {
+		fp64 max_ulp = 0.0;
+		for (int i = 0; i < 2000; i++) {
+			const T x = random_input<T>(seed, range.min, range.max);
+			const fp64 ulp = test_ulp_error(
+				test_to_fp128(expm1(x)), reference_expm1(x), precision
+			);
+			max_ulp = (ulp > max_ulp) ? ulp : max_ulp;
+		}
+		if (max_ulp > expm1_tolerance) {
+			printf("FAIL %s expm1 on [%g, %g]: %.3g ulp\n", name, range.min, range.max, max_ulp);
+			fails++;
+		}
+	}
+
+	/* The thresholds, and where the upper limb becomes subnormal */ {
+		const fp64 edges[] = {
+			exp_overflow, std::nextafter(exp_overflow, 0.0), -0x1.6232bdd7abcd2p+9,
+			std::nextafter(exp_underflow, 0.0), exp_underflow, -745.2, -1000.0
+		};
+		for (const fp64 edge : edges) {
+			const T x = static_cast<T>(edge);
+			const fp64 ulp = test_ulp_error(
+				test_to_fp128(exp(x)), reference_exp(x), precision
+			);
+			if (ulp > tolerance) {
+				printf("FAIL %s exp(%.17g): %.3g ulp\n", name, edge, ulp);
+				fails++;
+			}
+		}
+	}
+	return fails;
+}
+
+#endif
+
+/** @brief The overflow threshold and the special values */
+template <typename T>
+static int test_exp_special() {
+	int fails = 0;
+	const T inf = std::numeric_limits<T>::infinity();
+	fails += TEST_CHECK(isfinite(exp(static_cast<T>(exp_overflow))));
+	fails += TEST_CHECK(isinf(exp(static_cast<T>(std::nextafter(exp_overflow, INFINITY)))));
+	fails += TEST_CHECK(isinf(exp(static_cast<T>(1000.0))));
+	fails += TEST_CHECK(exp(static_cast<T>(-1000.0)) == static_cast<T>(0.0));
+	fails += TEST_CHECK(exp(static_cast<T>(0.0)) == static_cast<T>(1.0));
+	fails += TEST_CHECK(isinf(exp(inf)));
+	fails += TEST_CHECK(exp(-inf) == static_cast<T>(0.0));
+	fails += TEST_CHECK(isnan(exp(std::numeric_limits<T>::quiet_NaN())));
+	fails += TEST_CHECK(expm1(static_cast<T>(0.0)) == static_cast<T>(0.0));
+	fails += TEST_CHECK(expm1(-inf) == static_cast<T>(-1.0));
+	return fails;
+}
+
+int test_exp() {
+	int fails = 0;
+	#ifdef LDF_ENABLE_FLOAT128
+		fails += test_exp_accuracy<Float64x2>("Float64x2", 0x1.0p-106, 4.0, 8.0);
+		fails += test_exp_accuracy<Float64x4>("Float64x4", 0x1.0p-112, 2.0, 2.0);
+	#endif
+	fails += test_exp_special<Float64x2>();
+	fails += test_exp_special<Float64x4>();
+	return fails;
+}
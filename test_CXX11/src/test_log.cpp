@@ -0,0 +1,142 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "test_common.hpp"
+
+#include "../../Float64x2/Float64x2.hpp"
+#include "../../Float64x4/Float64x4.hpp"
+
+#include <cmath>
+#include <limits>
+
+#ifdef LDF_ENABLE_FLOAT128
+
+/**
+ * @brief log(hi + lo) = log(hi) + log1p(lo / hi), since a Float64x4 input
+ * can have more bits than __float128.
+ */
+template <typename T>
+static LDF_Float128 reference_log(const T& x) {
+	fp64 hi;
+	LDF_Float128 lo;
+	test_split_fp128(x, hi, lo);
+	const LDF_Float128 hi_q = static_cast<LDF_Float128>(hi);
+	return logq(hi_q) + log1pq(lo / hi_q);
+}
+
+/** @brief Tracks the largest error, and the input where it happened */
+struct log_max_error {
+	fp64 ulp;
+	fp64 x;
+};
+
+template <typename T>
+static void log_update(log_max_error& max, const T& x, const fp64 precision) {
+	const fp64 ulp = test_ulp_error(test_to_fp128(log(x)), reference_log(x), precision);
+	if (ulp > max.ulp) {
+		max.ulp = ulp;
+		max.x = static_cast<fp64>(x);
+	}
+}
+
+template <typename T>
+static int log_report(
+	const char* name, const char* inputs, const log_max_error& max, const fp64 tolerance
+) {
+	if (max.ulp <= tolerance) {
+		return 0;
+	}
+	printf("FAIL %s log %s: %.3g ulp at %.17g\n", name, inputs, max.ulp, max.x);
+	return 1;
+}
+
+/**
+ * @brief Compares log against __float128. precision is the size of an ulp
+ * relative to the result, which for Float64x4 is limited by the precision
+ * of __float128.
+ */
+template <typename T>
+static int test_log_accuracy(const char* name, const fp64 precision, const fp64 tolerance) {
+	int fails = 0;
+	uint64_t seed = UINT64_C(0x22);
+
+	/* Both sides of the table boundary at sqrt(2) */ {
+		log_max_error max = {0.0, 0.0};
+		for (int i = 0; i < 2000; i++) {
+			const fp64 hi = test_rand_fp64(seed, 0.5, 2.0);
+			log_update(max, static_cast<T>(hi) + static_cast<T>(hi * test_rand_fp64(seed, -0x1.0p-54, 0x1.0p-54)), precision);
+		}
+		fails += log_report<T>(name, "on [0.5, 2]", max, tolerance);
+	}
+
+	/* 1 +- 2^-k, where log(x) is small and must not lose relative accuracy */ {
+		log_max_error max = {0.0, 0.0};
+		for (int k = 1; k <= 120; k++) {
+			for (int i = 0; i < 16; i++) {
+				const fp64 d = std::ldexp(test_rand_fp64(seed, 1.0, 2.0), -k);
+				log_update(max, static_cast<T>(1.0) + static_cast<T>(d), precision);
+				log_update(max, static_cast<T>(1.0) - static_cast<T>(d), precision);
+			}
+		}
+		fails += log_report<T>(name, "near 1", max, tolerance);
+	}
+
+	/* Powers of two, and their neighbours */ {
+		log_max_error max = {0.0, 0.0};
+		for (int e = -1074; e <= 1023; e++) {
+			const T x = static_cast<T>(std::ldexp(1.0, e));
+			log_update(max, x, precision);
+			if (e >= -900) {
+				const T ulp = static_cast<T>(std::ldexp(1.0, e - 80));
+				log_update(max, x + ulp, precision);
+				log_update(max, x - ulp, precision);
+			}
+		}
+		log_update(max, std::numeric_limits<T>::max(), precision);
+		fails += log_report<T>(name, "at powers of two", max, tolerance);
+	}
+
+	/* Subnormal inputs */ {
+		log_max_error max = {0.0, 0.0};
+		for (int i = 0; i < 2000; i++) {
+			const fp64 x = std::ldexp(
+				test_rand_fp64(seed, 1.0, 2.0), -1023 - static_cast<int>(test_rand_u64(seed) % 52)
+			);
+			log_update(max, static_cast<T>(x), precision);
+		}
+		fails += log_report<T>(name, "of subnormals", max, tolerance);
+	}
+	return fails;
+}
+
+#endif
+
+/** @brief log(1) is exactly zero, and the special values */
+template <typename T>
+static int test_log_special() {
+	int fails = 0;
+	const T inf = std::numeric_limits<T>::infinity();
+	fails += TEST_CHECK(log(static_cast<T>(1.0)) == static_cast<T>(0.0));
+	fails += TEST_CHECK(log(static_cast<T>(0.0)) == -inf);
+	fails += TEST_CHECK(log(inf) == inf);
+	fails += TEST_CHECK(isnan(log(static_cast<T>(-1.0))));
+	fails += TEST_CHECK(isnan(log(-inf)));
+	fails += TEST_CHECK(isnan(log(std::numeric_limits<T>::quiet_NaN())));
+	return fails;
+}
+
+int test_log() {
+	int fails = 0;
+	#ifdef LDF_ENABLE_FLOAT128
+		fails += test_log_accuracy<Float64x2>("Float64x2", 0x1.0p-106, 4.0);
+		fails += test_log_accuracy<Float64x4>("Float64x4", 0x1.0p-112, 2.0);
+	#endif
+	fails += test_log_special<Float64x2>();
+	fails += test_log_special<Float64x4>();
+	return fails;
+}
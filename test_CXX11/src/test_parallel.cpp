@@ -0,0 +1,123 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "test_common.hpp"
+
+#include "../../LDF/LDF_thread_pool.hpp"
+#include "../../Float64x2/Float64x2.hpp"
+#include "../../Float64x2/Float64x2_parallel.hpp"
+#include "../../Float64x4/Float64x4.hpp"
+#include "../../Float64x4/Float64x4_parallel.hpp"
+
+#include <cmath>
+#include <vector>
+
+/* Several blocks, and a partial block at the end */
+static constexpr size_t test_parallel_count = 5 * LDF::reproducible_block_size + 1234;
+
+/**
+ * @brief The results of each pool are compared bitwise against a pool with
+ * one thread, which sums every block on the calling thread.
+ */
+static int test_Float64x2_parallel(LDF::Thread_Pool* const* pools, const size_t pool_count) {
+	int fails = 0;
+	uint64_t state = UINT64_C(0x19);
+	std::vector<Float64x2> x(2 * test_parallel_count);
+	std::vector<Float64x2> y(test_parallel_count);
+	for (Float64x2& value : x) {
+		value = test_rand_fp64(state, -4.0, 4.0);
+		value += test_rand_fp64(state, -0x1.0p-53, 0x1.0p-53) * value.hi;
+	}
+	for (Float64x2& value : y) {
+		value = test_rand_fp64(state, -4.0, 4.0);
+	}
+	const size_t n = test_parallel_count;
+
+	LDF::Thread_Pool& serial = *pools[0];
+	const Float64x2 sum = LDF::parallel_sum(n, x.data(), 1, serial);
+	const Float64x2 sum_strided = LDF::parallel_sum(n, x.data(), -2, serial);
+	const Float64x2 dot = LDF::parallel_dot(n, x.data(), 1, y.data(), 1, serial);
+	const Float64x2 nrm2 = LDF::parallel_nrm2(n, x.data(), 1, serial);
+
+	for (size_t p = 1; p < pool_count; p++) {
+		LDF::Thread_Pool& pool = *pools[p];
+		fails += TEST_CHECK(test_bitwise_equal(LDF::parallel_sum(n, x.data(), 1, pool), sum));
+		fails += TEST_CHECK(test_bitwise_equal(LDF::parallel_sum(n, x.data(), -2, pool), sum_strided));
+		fails += TEST_CHECK(test_bitwise_equal(LDF::parallel_dot(n, x.data(), 1, y.data(), 1, pool), dot));
+		fails += TEST_CHECK(test_bitwise_equal(LDF::parallel_nrm2(n, x.data(), 1, pool), nrm2));
+	}
+	fails += TEST_CHECK(test_bitwise_equal(LDF::parallel_sum(n, x.data(), 1), sum));
+
+	/* Compare against a naive loop, so that the results are also correct */ {
+		Float64x2 ref_sum = 0.0;
+		Float64x2 ref_dot = 0.0;
+		fp64 bound_sum = 0.0;
+		fp64 bound_dot = 0.0;
+		for (size_t i = 0; i < n; i++) {
+			ref_sum += x[i];
+			ref_dot += x[i] * y[i];
+			bound_sum += std::fabs(x[i].hi);
+			bound_dot += std::fabs(x[i].hi * y[i].hi);
+		}
+		fails += TEST_CHECK(std::fabs((sum - ref_sum).hi) <= 0x1.0p-90 * bound_sum);
+		fails += TEST_CHECK(std::fabs((dot - ref_dot).hi) <= 0x1.0p-90 * bound_dot);
+	}
+
+	/* n = 0 */ {
+		const Float64x2 zero = LDF::parallel_sum(0, x.data(), 1, serial);
+		fails += TEST_CHECK(zero.hi == 0.0 && zero.lo == 0.0);
+	}
+	return fails;
+}
+
+static int test_Float64x4_parallel(LDF::Thread_Pool* const* pools, const size_t pool_count) {
+	int fails = 0;
+	uint64_t state = UINT64_C(0x194);
+	std::vector<Float64x4> x(test_parallel_count);
+	std::vector<Float64x4> y(test_parallel_count);
+	for (size_t i = 0; i < test_parallel_count; i++) {
+		x[i] = test_rand_fp64(state, -4.0, 4.0);
+		x[i] += Float64x4(test_rand_fp64(state, -0x1.0p-53, 0x1.0p-53) * x[i].val[0]);
+		y[i] = test_rand_fp64(state, -4.0, 4.0);
+	}
+	const size_t n = test_parallel_count;
+
+	LDF::Thread_Pool& serial = *pools[0];
+	const Float64x4 sum = LDF::parallel_sum(n, x.data(), 1, serial);
+	const Float64x4 dot = LDF::parallel_dot(n, x.data(), 1, y.data(), -1, serial);
+	for (size_t p = 1; p < pool_count; p++) {
+		LDF::Thread_Pool& pool = *pools[p];
+		fails += TEST_CHECK(test_bitwise_equal(LDF::parallel_sum(n, x.data(), 1, pool), sum));
+		fails += TEST_CHECK(test_bitwise_equal(LDF::parallel_dot(n, x.data(), 1, y.data(), -1, pool), dot));
+	}
+
+	Float64x4 ref_sum = 0.0;
+	fp64 bound_sum = 0.0;
+	for (size_t i = 0; i < n; i++) {
+		ref_sum += x[i];
+		bound_sum += std::fabs(x[i].val[0]);
+	}
+	fails += TEST_CHECK(std::fabs((sum - ref_sum).val[0]) <= 0x1.0p-190 * bound_sum);
+	return fails;
+}
+
+int test_parallel() {
+	int fails = 0;
+	LDF::Thread_Pool pool_1(1);
+	LDF::Thread_Pool pool_2(2);
+	LDF::Thread_Pool pool_3(3);
+	LDF::Thread_Pool pool_N(0);
+	LDF::Thread_Pool* const pools[] = { &pool_1, &pool_2, &pool_3, &pool_N };
+	const size_t pool_count = sizeof(pools) / sizeof(pools[0]);
+	fails += TEST_CHECK(pool_1.thread_count() == 1);
+	fails += TEST_CHECK(pool_3.thread_count() == 3);
+
+	fails += test_Float64x2_parallel(pools, pool_count);
+	fails += test_Float64x4_parallel(pools, pool_count);
+	return fails;
+}
@@ -0,0 +1,229 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "test_common.hpp"
+
+#include "../../LDF/LDF_polynomial.hpp"
+#include "../../Float64x2/Float64x2.hpp"
+#include "../../Float64x2/Float64x2_polynomial.hpp"
+#include "../../Float64x4/Float64x4.hpp"
+#include "../../Float64x4/Float64x4_polynomial.hpp"
+
+#include <cmath>
+#include <vector>
+
+/* Covers every shape of the Estrin tree up to 17 coefficients */
+static constexpr size_t test_polynomial_max_count = 17;
+static constexpr int test_polynomial_points = 16;
+
+static Float64x4 to_Float64x4(const Float64x2& x) {
+	return Float64x4(x.hi) + Float64x4(x.lo);
+}
+
+/**
+ * @brief Evaluates the polynomial term by term in Float64x4, and sets bound
+ * to the sum of the absolute terms, which bounds the rounding error of
+ * Horner's and Estrin's schemes.
+ */
+template <typename T>
+static Float64x4 polynomial_direct(
+	const std::vector<T>& coef, const Float64x4& x, fp64& bound
+) {
+	Float64x4 ret = 0.0;
+	Float64x4 power = 1.0;
+	bound = 0.0;
+	for (size_t i = 0; i < coef.size(); i++) {
+		const Float64x4 term = to_Float64x4(coef[i]) * power;
+		ret += term;
+		bound += std::fabs(term.val[0]);
+		power *= x;
+	}
+	return ret;
+}
+
+template <>
+Float64x4 polynomial_direct<Float64x4>(
+	const std::vector<Float64x4>& coef, const Float64x4& x, fp64& bound
+) {
+	Float64x4 ret = 0.0;
+	Float64x4 power = 1.0;
+	bound = 0.0;
+	for (size_t i = 0; i < coef.size(); i++) {
+		const Float64x4 term = coef[i] * power;
+		ret += term;
+		bound += std::fabs(term.val[0]);
+		power *= x;
+	}
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// Float64x2
+//------------------------------------------------------------------------------
+
+static std::vector<Float64x2> random_Float64x2_coef(uint64_t& state, const size_t count) {
+	std::vector<Float64x2> coef(count);
+	for (Float64x2& c : coef) {
+		c = test_rand_fp64(state, -2.0, 2.0);
+		c += test_rand_fp64(state, -0x1.0p-53, 0x1.0p-53) * c.hi;
+	}
+	return coef;
+}
+
+static int test_Float64x2_polynomial() {
+	int fails = 0;
+	uint64_t state = UINT64_C(0x20);
+	for (size_t count = 1; count <= test_polynomial_max_count; count++) {
+		const std::vector<Float64x2> coef = random_Float64x2_coef(state, count);
+		const LDF::Split_Polynomial<Float64x2> poly(coef.data(), count);
+		fails += TEST_CHECK(poly.size() == count);
+		fails += TEST_CHECK(test_bitwise_equal(poly.coef(count - 1), coef[count - 1]));
+
+		const fp64 tolerance = 0x1.0p-102 * static_cast<fp64>(2 * count);
+		size_t mismatches = 0;
+		Float64x2 x[test_polynomial_points];
+		for (int i = 0; i < test_polynomial_points; i++) {
+			x[i] = test_rand_fp64(state, -1.5, 1.5);
+			fp64 bound;
+			const Float64x4 ref = polynomial_direct(coef, to_Float64x4(x[i]), bound);
+			const Float64x2 ret_horner = LDF::horner(poly, x[i]);
+			const Float64x2 ret_estrin = LDF::estrin(poly, x[i]);
+			mismatches += !(std::fabs((to_Float64x4(ret_horner) - ref).val[0]) <= tolerance * bound);
+			mismatches += !(std::fabs((to_Float64x4(ret_estrin) - ref).val[0]) <= tolerance * bound);
+		}
+
+		#ifdef __AVX__
+			// Each lane of __m256dx2 must match the scalar evaluation
+			for (int i = 0; i < test_polynomial_points; i += 4) {
+				const __m256dx2 x_simd = _mm256x2_loadu_pdx2(&x[i]);
+				Float64x2 ret_horner[4];
+				Float64x2 ret_estrin[4];
+				_mm256x2_storeu_pdx2(ret_horner, LDF::horner(poly, x_simd));
+				_mm256x2_storeu_pdx2(ret_estrin, LDF::estrin(poly, x_simd));
+				for (int lane = 0; lane < 4; lane++) {
+					fp64 bound;
+					const Float64x4 ref = polynomial_direct(coef, to_Float64x4(x[i + lane]), bound);
+					mismatches += !(std::fabs((to_Float64x4(ret_horner[lane]) - ref).val[0]) <= tolerance * bound);
+					mismatches += !(std::fabs((to_Float64x4(ret_estrin[lane]) - ref).val[0]) <= tolerance * bound);
+				}
+			}
+		#endif
+
+		if (mismatches != 0) {
+			printf("FAIL Float64x2 polynomial with %zu coefficients: %zu mismatches\n", count, mismatches);
+			fails++;
+		}
+	}
+
+	/* Small integers are evaluated exactly by both schemes */ {
+		const Float64x2 coef[6] = { 1.0, -2.0, 3.0, -4.0, 5.0, -6.0 };
+		const LDF::Split_Polynomial<Float64x2> poly(coef, 6);
+		// 1 - 2*3 + 3*9 - 4*27 + 5*81 - 6*243
+		const Float64x2 exact = -1139.0;
+		fails += TEST_CHECK(test_bitwise_equal(LDF::horner(poly, Float64x2(3.0)), exact));
+		fails += TEST_CHECK(test_bitwise_equal(LDF::estrin(poly, Float64x2(3.0)), exact));
+	}
+
+	/* An empty polynomial is zero */ {
+		const LDF::Split_Polynomial<Float64x2> empty;
+		fails += TEST_CHECK(LDF::horner(empty, Float64x2(2.0)) == 0.0);
+		fails += TEST_CHECK(LDF::estrin(empty, Float64x2(2.0)) == 0.0);
+	}
+	return fails;
+}
+
+/**
+ * @brief Rational functions, where the numerator and denominator have
+ * different degrees so that rational_estrin shares the longer power table.
+ */
+static int test_Float64x2_rational() {
+	int fails = 0;
+	uint64_t state = UINT64_C(0x202);
+	const std::vector<Float64x2> num_coef = random_Float64x2_coef(state, 9);
+	std::vector<Float64x2> den_coef = random_Float64x2_coef(state, 6);
+	// Keeps the denominator away from zero
+	den_coef[0] = 16.0;
+	const LDF::Split_Polynomial<Float64x2> num(num_coef.data(), num_coef.size());
+	const LDF::Split_Polynomial<Float64x2> den(den_coef.data(), den_coef.size());
+
+	size_t mismatches = 0;
+	for (int i = 0; i < test_polynomial_points; i++) {
+		const Float64x2 x = test_rand_fp64(state, -1.0, 1.0);
+		fp64 num_bound, den_bound;
+		const Float64x4 ref_num = polynomial_direct(num_coef, to_Float64x4(x), num_bound);
+		const Float64x4 ref_den = polynomial_direct(den_coef, to_Float64x4(x), den_bound);
+		const Float64x4 ref = ref_num / ref_den;
+		// Relative error of num, plus that of den, plus the division
+		const fp64 tolerance = 0x1.0p-98 * (
+			num_bound / std::fabs(ref_num.val[0]) + den_bound / std::fabs(ref_den.val[0]) + 1.0
+		);
+		const Float64x2 ret_horner = LDF::rational_horner(num, den, x);
+		const Float64x2 ret_estrin = LDF::rational_estrin(num, den, x);
+		mismatches += !(std::fabs((to_Float64x4(ret_horner) - ref).val[0]) <= tolerance * std::fabs(ref.val[0]));
+		mismatches += !(std::fabs((to_Float64x4(ret_estrin) - ref).val[0]) <= tolerance * std::fabs(ref.val[0]));
+	}
+	fails += TEST_CHECK(mismatches == 0);
+	return fails;
+}
+
+//------------------------------------------------------------------------------
+// Float64x4
+//------------------------------------------------------------------------------
+
+static int test_Float64x4_polynomial() {
+	int fails = 0;
+	uint64_t state = UINT64_C(0x204);
+	for (size_t count = 1; count <= test_polynomial_max_count; count++) {
+		std::vector<Float64x4> coef(count);
+		for (Float64x4& c : coef) {
+			c = test_rand_fp64(state, -2.0, 2.0);
+			c += Float64x4(test_rand_fp64(state, -0x1.0p-53, 0x1.0p-53) * c.val[0]);
+		}
+		const LDF::Split_Polynomial<Float64x4> poly(coef.data(), count);
+		const fp64 tolerance = 0x1.0p-205 * static_cast<fp64>(2 * count);
+		size_t mismatches = 0;
+		Float64x4 x[test_polynomial_points];
+		for (int i = 0; i < test_polynomial_points; i++) {
+			x[i] = test_rand_fp64(state, -1.5, 1.5);
+			fp64 bound;
+			const Float64x4 ref = polynomial_direct(coef, x[i], bound);
+			mismatches += !(std::fabs((LDF::horner(poly, x[i]) - ref).val[0]) <= tolerance * bound);
+			mismatches += !(std::fabs((LDF::estrin(poly, x[i]) - ref).val[0]) <= tolerance * bound);
+		}
+
+		#ifdef __AVX__
+			for (int i = 0; i < test_polynomial_points; i += 4) {
+				const __m256dx4 x_simd = _mm256x4_loadu_pdx4(&x[i]);
+				Float64x4 ret_horner[4];
+				Float64x4 ret_estrin[4];
+				_mm256x4_storeu_pdx4(ret_horner, LDF::horner(poly, x_simd));
+				_mm256x4_storeu_pdx4(ret_estrin, LDF::estrin(poly, x_simd));
+				for (int lane = 0; lane < 4; lane++) {
+					fp64 bound;
+					const Float64x4 ref = polynomial_direct(coef, x[i + lane], bound);
+					mismatches += !(std::fabs((ret_horner[lane] - ref).val[0]) <= tolerance * bound);
+					mismatches += !(std::fabs((ret_estrin[lane] - ref).val[0]) <= tolerance * bound);
+				}
+			}
+		#endif
+
+		if (mismatches != 0) {
+			printf("FAIL Float64x4 polynomial with %zu coefficients: %zu mismatches\n", count, mismatches);
+			fails++;
+		}
+	}
+	return fails;
+}
+
+int test_polynomial() {
+	int fails = 0;
+	fails += test_Float64x2_polynomial();
+	fails += test_Float64x2_rational();
+	fails += test_Float64x4_polynomial();
+	return fails;
+}
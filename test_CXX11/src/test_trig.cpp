@@ -0,0 +1,311 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "test_common.hpp"
+
+#include "../../Float64x2/Float64x2.hpp"
+#include "../../Float64x4/Float64x4.hpp"
+
+#ifdef __AVX__
+	#include "../../Float64x2/Float64x2_AVX.h"
+	#include "../../Float64x4/Float64x4_AVX.h"
+#endif
+
+#ifdef LDF_ENABLE_FLOAT80
+	#include "../../Float80x2/Float80x2.hpp"
+#endif
+
+#include <cmath>
+#include <limits>
+
+/** @brief Relative error of x against ref */
+static fp64 relative_error(const Float64x2& x, const Float64x2& ref) {
+	return std::fabs((x - ref).hi) / std::fabs(ref.hi);
+}
+
+/** @copydoc relative_error */
+static fp64 relative_error(const Float64x4& x, const Float64x4& ref) {
+	return std::fabs((x - ref).val[0]) / std::fabs(ref.val[0]);
+}
+
+#ifdef LDF_ENABLE_FLOAT80
+/** @copydoc relative_error */
+static fp80 relative_error(const Float80x2& x, const Float80x2& ref) {
+	return std::fabs((x - ref).hi) / std::fabs(ref.hi);
+}
+#endif
+
+//------------------------------------------------------------------------------
+// Cody-Waite reduction
+//------------------------------------------------------------------------------
+
+struct trig_reference {
+	Float64x2 x;
+	Float64x2 sin_x;
+	Float64x2 cos_x;
+};
+
+/**
+ * @brief sin(x) and cos(x) rounded to Float64x2, computed with 400 digit
+ * decimal arithmetic. The inputs cover the pass-through path below pi/32,
+ * both sides of pi/32, the Cody-Waite path up to 2^20, and just above it.
+ * The last inputs are the Float64x2 values closest to multiples of pi and
+ * pi/2, where the reduction has to cancel about 100 bits.
+ */
+static const trig_reference cody_waite_references[] = {
+	{ {0x1.4f8b588e368f1p-17, 0x0.0p+0}, {0x1.4f8b588e1e8a2p-17, 0x1.75b30450b875ep-71}, {0x1.ffffffff920c8p-1, 0x1.3149f1007a5f5p-58} },
+	{ {0x1.999999999999ap-5, 0x0.0p+0}, {0x1.996dea2ff643cp-5, 0x1.bb06d08e470f0p-61}, {0x1.ff5c31b289258p-1, -0x1.4ebf8fa0324b6p-55} },
+	{ {0x1.91d14e3bcd35bp-4, 0x0.0p+0}, {0x1.912c654d160aep-4, -0x1.90948ed7182bap-63}, {0x1.fd89d00ef1ab2p-1, 0x1.c69d0c13fbf10p-59} },
+	{ {0x1.923a29c779a6bp-4, 0x0.0p+0}, {0x1.9194bfa7220bep-4, 0x1.90f2f1f920ffep-58}, {0x1.fd888740096d2p-1, -0x1.d27fba1903564p-55} },
+	{ {0x1.999999999999ap-4, 0x0.0p+0}, {0x1.98eaecb8bcb2cp-4, 0x1.c687ae84515ddp-59}, {0x1.fd712f9a817c1p-1, -0x1.fb7ab33ee2672p-55} },
+	{ {0x1.91eb851eb851fp-1, 0x0.0p+0}, {0x1.69e4fd79ac743p-1, -0x1.3a831ffc5c93cp-56}, {0x1.6a2ecb934b59ap-1, -0x1.f3738e2bed1bcp-56} },
+	{ {0x1.0000000000000p+0, 0x0.0p+0}, {0x1.aed548f090ceep-1, 0x1.06374f484e288p-59}, {0x1.14a280fb5068cp-1, -0x1.b71edcc9344bcp-55} },
+	{ {0x1.921fb54442d18p+0, 0x0.0p+0}, {0x1.0000000000000p+0, -0x1.377ce858a5d48p-109}, {0x1.1a62633145c07p-54, -0x1.f1976b7ed8fbcp-110} },
+	{ {0x1.8000000000000p+1, 0x0.0p+0}, {0x1.210386db6d55bp-3, 0x1.3c7205d08d063p-57}, {-0x1.fae04be85e5d2p-1, -0x1.83effc17efb54p-55} },
+	{ {-0x1.6000000000000p+2, 0x0.0p+0}, {0x1.693c94e0ab057p-1, -0x1.49447d34a5e8bp-56}, {0x1.6ad6c3c07d448p-1, 0x1.598876a8e32fap-57} },
+	{ {0x1.9000000000000p+6, 0x0.0p+0}, {-0x1.03425b78c4db8p-1, -0x1.c23d8557420fbp-59}, {0x1.b981dbf665fdfp-1, 0x1.8fd0cdcd985e8p-55} },
+	{ {0x1.6300000000000p+8, 0x0.0p+0}, {-0x1.f9bd0307d1de3p-16, 0x1.894874d2528d2p-70}, {-0x1.fffffffc18e4cp-1, 0x1.862265016699cp-57} },
+	{ {0x1.81cd6c8b43958p+13, 0x0.0p+0}, {-0x1.687d5890974a5p-1, -0x1.6a6c3056ad519p-56}, {0x1.6b94c3bbe24b8p-1, -0x1.c9c50dc8917f6p-56} },
+	{ {-0x1.9639000000000p+16, 0x0.0p+0}, {0x1.40efdf1eb8de7p-16, -0x1.f636eaa54141cp-70}, {0x1.fffffffe6da77p-1, 0x1.7035e9b2fcdecp-57} },
+	{ {0x1.fffff00000000p+19, 0x0.0p+0}, {-0x1.4cb305757fa66p-3, 0x1.9051c2ac3d9a0p-59}, {0x1.f932ec65b1d71p-1, 0x1.5759be4908756p-57} },
+	{ {0x1.0000000000000p+20, 0x0.0p+0}, {0x1.526ccb2fc8656p-2, -0x1.312bfebafe1dfp-56}, {0x1.e33ada92fe2aep-1, -0x1.420bfaf737b2dp-57} },
+	{ {0x1.0000140000000p+20, 0x0.0p+0}, {0x1.ffef292a2d12fp-1, -0x1.b30c4afb31b83p-57}, {-0x1.069e8f04d583dp-6, 0x1.dbe8f3dbaa013p-60} },
+	{ {0x1.0000000000000p+0, 0x1.0000000000000p-60}, {0x1.aed548f090ceep-1, 0x1.4b5fef872242bp-59}, {0x1.14a280fb5068cp-1, -0x1.bdda31ecf68f0p-55} },
+	{ {0x1.921fb54442d18p+1, 0x1.1a62633145c07p-53}, {-0x1.f1976b7ed8fbcp-109, 0x1.4cf98e804177dp-163}, {-0x1.0000000000000p+0, 0x1.e396a47941a45p-218} },
+	{ {0x1.2d97c7f3321d2p+3, 0x1.a79394c9e8a0ap-52}, {0x1.456737b06ea1ap-106, -0x1.83226a8fe7731p-160}, {-0x1.0000000000000p+0, 0x1.9d9f3d03d4fcap-213} },
+	{ {0x1.3a28c59d5433bp+8, -0x1.1b19140c0c0d5p-49}, {0x1.2f92fec6612a8p-108, -0x1.08bdd50cc9679p-162}, {0x1.0000000000000p+0, -0x1.67fd4b8131d7bp-217} },
+	{ {0x1.88b2f704a940ap+11, -0x1.2c3beb21e1e21p-43}, {0x1.217b77be77f97p-97, 0x1.46b512b5b0044p-151}, {0x1.0000000000000p+0, -0x1.4757ffe853eb2p-195} },
+	{ {0x1.ff539020c29bcp+19, 0x1.2a09e3a3aef2ep-35}, {-0x1.779b0ee22f4f8p-89, -0x1.4b05dd31c0a0dp-145}, {-0x1.0000000000000p+0, 0x1.138bd1c2d6aeep-178} },
+	{ {0x1.2efdec30a2e8ap+14, 0x1.7a454a054c327p-40}, {0x1.0000000000000p+0, -0x1.da5e5edcdcf34p-192}, {0x1.ecd344852049fp-96, 0x1.da47724636a86p-151} },
+};
+
+static int test_trig_cody_waite() {
+	int fails = 0;
+	for (const trig_reference& ref : cody_waite_references) {
+		Float64x2 sin_x, cos_x;
+		sincos(ref.x, sin_x, cos_x);
+		const fp64 errors[4] = {
+			relative_error(sin(ref.x), ref.sin_x),
+			relative_error(cos(ref.x), ref.cos_x),
+			relative_error(sin_x, ref.sin_x),
+			relative_error(cos_x, ref.cos_x)
+		};
+		for (int i = 0; i < 4; i++) {
+			if (!(errors[i] <= 0x1.0p-100)) {
+				printf(
+					"FAIL %s(%a + %a): relative error %.3e\n",
+					(i % 2 == 0) ? "sin" : "cos", ref.x.hi, ref.x.lo, errors[i]
+				);
+				fails++;
+			}
+		}
+	}
+
+	/* sin is odd and cos is even */ {
+		for (const trig_reference& ref : cody_waite_references) {
+			fails += TEST_CHECK(test_bitwise_equal(sin(-ref.x), -sin(ref.x)));
+			fails += TEST_CHECK(test_bitwise_equal(cos(-ref.x), cos(ref.x)));
+		}
+	}
+	return fails;
+}
+
+//------------------------------------------------------------------------------
+// Payne-Hanek reduction
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Arguments above 2^52 up to DBL_MAX, including 0x1.6ac5b262ca1ffp+849,
+ * which is within 2^-61 of a multiple of pi/2.
+ */
+static const trig_reference payne_hanek_references[] = {
+	{ {0x1.0000000000000p+53, 0x0.0p+0}, {-0x1.b2a66c8f35586p-1, -0x1.bdca662b97498p-57}, {-0x1.0e9918bb35aacp-1, -0x1.46928231baf44p-55} },
+	{ {0x1.0000000000000p+60, 0x1.8000000000000p-1}, {-0x1.f980c5a3831aep-1, -0x1.c9d2e7508f327p-55}, {0x1.4539913824aafp-3, 0x1.7e0330789c06bp-57} },
+	{ {0x1.0f0cf064dd592p+73, 0x0.0p+0}, {-0x1.b453ab76bf397p-1, -0x1.f453790772648p-58}, {0x1.0be2cef01c8f4p-1, -0x1.b2d1bc8018c4fp-55} },
+	{ {0x1.6ac5b262ca1ffp+849, 0x0.0p+0}, {0x1.0000000000000p+0, -0x1.2b089ea1e692bp-123}, {-0x1.14ae72e6ba22fp-61, 0x1.73eef1477d90ep-118} },
+	{ {0x1.7e43c8800759cp+996, 0x1.137367c236c65p+940}, {-0x1.d2b5923ac8474p-1, 0x1.8a8c888f24e04p-57}, {-0x1.a513b79ab19edp-2, -0x1.9c288a8495c7dp-57} },
+	{ {0x1.fffffffffffffp+1023, 0x0.0p+0}, {0x1.452fc98b34e97p-8, -0x1.27bb193d960dfp-62}, {-0x1.fffe62ecfab75p-1, -0x1.e038d934070f1p-56} },
+	{ {-0x1.24a35bcdc760fp+667, 0x0.0p+0}, {-0x1.c90cbc8cf1779p-1, 0x1.81b5b82f1353cp-55}, {-0x1.cd8465237dae8p-2, 0x1.56c6378ed32e7p-56} },
+};
+
+struct trig_reference_Float64x4 {
+	Float64x4 x;
+	Float64x4 sin_x;
+	Float64x4 cos_x;
+};
+
+static const trig_reference_Float64x4 payne_hanek_references_Float64x4[] = {
+	{ {0x1.0000000000000p+53, 0x1.0000000000000p-1, 0x0.0p+0, 0x0.0p+0}, {-0x1.ff2c468498b90p-1, 0x1.391e495cb38d6p-55, -0x1.f1cede7750948p-109, 0x1.836dcc3465ac9p-163}, {-0x1.d16fa85d00c9cp-5, 0x1.fe67a91281c55p-60, 0x1.fbc8d77b5b643p-114, -0x1.748427c064d3ap-172} },
+	{ {0x1.0f0cf064dd592p+73, 0x0.0p+0, 0x0.0p+0, 0x0.0p+0}, {-0x1.b453ab76bf397p-1, -0x1.f453790772648p-58, 0x1.21f6f48413f44p-112, -0x1.98fb829b20a51p-166}, {0x1.0be2cef01c8f4p-1, -0x1.b2d1bc8018c4fp-55, -0x1.614ab5e5d93a4p-109, -0x1.fe2404f1d9e29p-163} },
+	{ {0x1.6ac5b262ca1ffp+849, 0x0.0p+0, 0x0.0p+0, 0x0.0p+0}, {0x1.0000000000000p+0, -0x1.2b089ea1e692bp-123, 0x1.b667cc5bcaf8ep-177, 0x1.897f74a572767p-233}, {-0x1.14ae72e6ba22fp-61, 0x1.73eef1477d90ep-118, 0x1.4fade1e51055dp-173, 0x1.d4bfea2ab67a2p-231} },
+	{ {0x1.fffffffffffffp+1023, 0x0.0p+0, 0x0.0p+0, 0x0.0p+0}, {0x1.452fc98b34e97p-8, -0x1.27bb193d960dfp-62, 0x1.4897bcc9f11cbp-117, 0x1.5f200d980163ap-171}, {-0x1.fffe62ecfab75p-1, -0x1.e038d934070f1p-56, -0x1.aef38c3e2b357p-111, 0x1.79067d68ea21ap-166} },
+	{ {-0x1.b6e83b85f253bp+333, 0x1.078e111c3556dp+279, -0x1.7bd29d1c87a19p+222, 0x1.11b0ec57e649ap+166}, {-0x1.564fc0b126624p-3, -0x1.9972ebb1e1494p-57, 0x1.d2b44a73a7546p-112, -0x1.d2ea18dd65504p-166}, {0x1.f8cc231ba9276p-1, -0x1.bf2156e84e045p-55, 0x1.20e16ed6a0aadp-109, -0x1.e402a6b98d2d0p-164} },
+};
+
+#ifdef LDF_ENABLE_FLOAT80
+struct trig_reference_Float80x2 {
+	Float80x2 x;
+	Float80x2 sin_x;
+	Float80x2 cos_x;
+};
+
+/** @brief Arguments up to LDBL_MAX */
+static const trig_reference_Float80x2 payne_hanek_references_Float80x2[] = {
+	{ {0x8000000000003039P+7L, 0.0L}, {0xDC1EE7E398F591DEP-66L, 0xA1B65B7652F720C1P-133L}, {0xFA03EE7CDFE016ABP-64L, 0xB64E034D283A8D19P-129L} },
+	{ {0xC90FDAA22168C234P+16237L, 0.0L}, {0xAB10BC4E3BFDD9E4P-64L, 0x889B5055579E6C74P-129L}, {-0xBE742A3146088E1CP-64L, 0xEB39BC45C0BACDA2P-129L} },
+	{ {0xFFFFFFFFFFFFFFFFP+16320L, 0.0L}, {0xFDFD9D4B6D0E5F7CP-64L, -0xD35E6A9E1578E28EP-129L}, {-0x800BBD0061D4F543P-66L, 0x8580943C0A46DBE9P-132L} },
+	{ {-0xA000000000000000P+200L, 0.0L}, {0xAA7B49881ECAD31BP-64L, -0x8E41766F01FF9E53P-129L}, {-0xBEF9FC8840036A2CP-64L, -0xCD01101CAC72BBAAP-129L} },
+};
+#endif
+
+static int test_trig_payne_hanek() {
+	int fails = 0;
+	for (const trig_reference& ref : payne_hanek_references) {
+		Float64x2 sin_x, cos_x;
+		sincos(ref.x, sin_x, cos_x);
+		fails += TEST_CHECK(relative_error(sin(ref.x), ref.sin_x) <= 0x1.0p-100);
+		fails += TEST_CHECK(relative_error(cos(ref.x), ref.cos_x) <= 0x1.0p-100);
+		fails += TEST_CHECK(relative_error(sin_x, ref.sin_x) <= 0x1.0p-100);
+		fails += TEST_CHECK(relative_error(cos_x, ref.cos_x) <= 0x1.0p-100);
+	}
+	for (const trig_reference_Float64x4& ref : payne_hanek_references_Float64x4) {
+		Float64x4 sin_x, cos_x;
+		sincos(ref.x, sin_x, cos_x);
+		fails += TEST_CHECK(relative_error(sin(ref.x), ref.sin_x) <= 0x1.0p-200);
+		fails += TEST_CHECK(relative_error(cos(ref.x), ref.cos_x) <= 0x1.0p-200);
+		fails += TEST_CHECK(relative_error(sin_x, ref.sin_x) <= 0x1.0p-200);
+		fails += TEST_CHECK(relative_error(cos_x, ref.cos_x) <= 0x1.0p-200);
+	}
+	#ifdef LDF_ENABLE_FLOAT80
+		for (const trig_reference_Float80x2& ref : payne_hanek_references_Float80x2) {
+			Float80x2 sin_x, cos_x;
+			sincos(ref.x, sin_x, cos_x);
+			fails += TEST_CHECK(relative_error(sin(ref.x), ref.sin_x) <= 0x1.0p-120L);
+			fails += TEST_CHECK(relative_error(cos(ref.x), ref.cos_x) <= 0x1.0p-120L);
+			fails += TEST_CHECK(relative_error(sin_x, ref.sin_x) <= 0x1.0p-120L);
+			fails += TEST_CHECK(relative_error(cos_x, ref.cos_x) <= 0x1.0p-120L);
+		}
+	#endif
+
+	#ifdef __AVX__
+		// Large lanes are reduced by the scalar functions
+		for (size_t i = 0; i + 4 <= sizeof(payne_hanek_references) / sizeof(payne_hanek_references[0]); i++) {
+			Float64x2 x[4], sin_x[4], cos_x[4];
+			for (size_t lane = 0; lane < 4; lane++) {
+				// Mixes large and small lanes
+				x[lane] = (lane == 2) ? cody_waite_references[i].x : payne_hanek_references[i + lane].x;
+			}
+			__m256dx2 sin_simd, cos_simd;
+			_mm256x2_sincos_pdx2(_mm256x2_loadu_pdx2(x), &sin_simd, &cos_simd);
+			_mm256x2_storeu_pdx2(sin_x, sin_simd);
+			_mm256x2_storeu_pdx2(cos_x, cos_simd);
+			for (size_t lane = 0; lane < 4; lane++) {
+				const trig_reference& ref = (lane == 2) ? cody_waite_references[i] : payne_hanek_references[i + lane];
+				fails += TEST_CHECK(relative_error(sin_x[lane], ref.sin_x) <= 0x1.0p-98);
+				fails += TEST_CHECK(relative_error(cos_x[lane], ref.cos_x) <= 0x1.0p-98);
+			}
+		}
+		for (size_t i = 0; i + 4 <= sizeof(payne_hanek_references_Float64x4) / sizeof(payne_hanek_references_Float64x4[0]); i++) {
+			Float64x4 x[4], sin_x[4], cos_x[4];
+			for (size_t lane = 0; lane < 4; lane++) {
+				x[lane] = payne_hanek_references_Float64x4[i + lane].x;
+			}
+			__m256dx4 sin_simd, cos_simd;
+			_mm256x4_sincos_pdx4(_mm256x4_loadu_pdx4(x), &sin_simd, &cos_simd);
+			_mm256x4_storeu_pdx4(sin_x, sin_simd);
+			_mm256x4_storeu_pdx4(cos_x, cos_simd);
+			for (size_t lane = 0; lane < 4; lane++) {
+				const trig_reference_Float64x4& ref = payne_hanek_references_Float64x4[i + lane];
+				fails += TEST_CHECK(relative_error(sin_x[lane], ref.sin_x) <= 0x1.0p-196);
+				fails += TEST_CHECK(relative_error(cos_x[lane], ref.cos_x) <= 0x1.0p-196);
+			}
+		}
+	#endif
+	return fails;
+}
+
+/** @brief sin and cos of infinity and NaN are NaN */
+template <typename T>
+static int test_trig_non_finite() {
+	int fails = 0;
+	const T values[3] = {
+		std::numeric_limits<T>::infinity(),
+		-std::numeric_limits<T>::infinity(),
+		std::numeric_limits<T>::quiet_NaN()
+	};
+	for (const T& x : values) {
+		T sin_x, cos_x;
+		sincos(x, sin_x, cos_x);
+		fails += TEST_CHECK(isnan(sin(x)));
+		fails += TEST_CHECK(isnan(cos(x)));
+		fails += TEST_CHECK(isnan(sin_x) && isnan(cos_x));
+	}
+	return fails;
+}
+
+#ifdef __AVX__
+/**
+ * @brief atan2(+-0, +0) = +-0 and atan2(+-0, -0) = +-pi, instead of
+ * atan(0 / 0) which is NaN. Only the sign of the upper limb is compared.
+ */
+static int test_trig_atan2_zero_AVX() {
+	int fails = 0;
+	const fp64 y[4] = { +0.0, -0.0, +0.0, -0.0 };
+	const fp64 x[4] = { +0.0, +0.0, -0.0, -0.0 };
+	/* __m256dx2 */ {
+		const Float64x2 pi = LDF::const_pi<Float64x2>();
+		const Float64x2 ref[4] = { +0.0, -0.0, pi, -pi };
+		Float64x2 y_x[4], x_x[4], ret[4];
+		for (int lane = 0; lane < 4; lane++) {
+			y_x[lane] = y[lane];
+			x_x[lane] = x[lane];
+		}
+		_mm256x2_storeu_pdx2(ret, _mm256x2_atan2_pdx2(
+			_mm256x2_loadu_pdx2(y_x), _mm256x2_loadu_pdx2(x_x)
+		));
+		for (int lane = 0; lane < 4; lane++) {
+			fails += TEST_CHECK(
+				ret[lane] == ref[lane] && std::signbit(ret[lane].hi) == std::signbit(ref[lane].hi)
+			);
+		}
+	}
+	/* __m256dx4 */ {
+		const Float64x4 pi = LDF::const_pi<Float64x4>();
+		const Float64x4 ref[4] = { +0.0, -0.0, pi, -pi };
+		Float64x4 y_x[4], x_x[4], ret[4];
+		for (int lane = 0; lane < 4; lane++) {
+			y_x[lane] = y[lane];
+			x_x[lane] = x[lane];
+		}
+		_mm256x4_storeu_pdx4(ret, _mm256x4_atan2_pdx4(
+			_mm256x4_loadu_pdx4(y_x), _mm256x4_loadu_pdx4(x_x)
+		));
+		for (int lane = 0; lane < 4; lane++) {
+			fails += TEST_CHECK(
+				ret[lane] == ref[lane] && std::signbit(ret[lane].val[0]) == std::signbit(ref[lane].val[0])
+			);
+		}
+	}
+	return fails;
+}
+#endif
+
+int test_trig() {
+	int fails = 0;
+	fails += test_trig_cody_waite();
+	fails += test_trig_payne_hanek();
+	fails += test_trig_non_finite<Float64x2>();
+	fails += test_trig_non_finite<Float64x4>();
+	#ifdef LDF_ENABLE_FLOAT80
+		fails += test_trig_non_finite<Float80x2>();
+	#endif
+	#ifdef __AVX__
+		fails += test_trig_atan2_zero_AVX();
+	#endif
+	return fails;
+}
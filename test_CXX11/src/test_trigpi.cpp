@@ -0,0 +1,196 @@
+/*
+**	Author: zerico2005 (2024)
+**	Project: LIB-Dekker-Float
+**	License: MIT License
+**	A copy of the MIT License should be included with
+**	this project. If not, see https://opensource.org/license/MIT
+*/
+
+#include "test_common.hpp"
+
+#include "../../Float32x2/Float32x2.hpp"
+#include "../../Float64x2/Float64x2.hpp"
+#include "../../Float64x4/Float64x4.hpp"
+
+#ifdef __AVX__
+	#include "../../Float32x2/Float32x2_AVX.h"
+	#include "../../Float64x2/Float64x2_AVX.h"
+	#include "../../Float64x4/Float64x4_AVX.h"
+#endif
+
+#ifdef LDF_ENABLE_FLOAT80
+	#include "../../Float80x2/Float80x2.hpp"
+#endif
+
+/**
+ * @brief The values checked by test_trigpi_exact. large is an integer that
+ * needs the lower limb, so that each limb is reduced modulo 2.
+ */
+template <typename T>
+static T trigpi_large_integer() {
+	return static_cast<T>(0x1.0p+40) + static_cast<T>(3.0);
+}
+
+template <>
+Float64x2 trigpi_large_integer<Float64x2>() {
+	return static_cast<Float64x2>(0x1.0p+80) + static_cast<Float64x2>(3.0);
+}
+
+/**
+ * @brief sinpi and cospi reduce their argument exactly, so they are exact at
+ * integers and half-integers, and periodic without rounding.
+ */
+template <typename T>
+static int test_trigpi_exact(const char* name) {
+	int fails = 0;
+	size_t mismatches = 0;
+	const T one = static_cast<T>(1.0);
+	const T zero = static_cast<T>(0.0);
+	for (int n = -6; n <= 6; n++) {
+		const T x = static_cast<T>(static_cast<fp64>(n));
+		const T half = x + static_cast<T>(0.5);
+		// (-1)^n
+		const T sign = (n % 2 == 0) ? one : -one;
+		mismatches += !(sinpi(x) == zero);
+		mismatches += !(cospi(x) == sign);
+		mismatches += !(tanpi(x) == zero);
+		mismatches += !(sinpi(half) == sign);
+		mismatches += !(cospi(half) == zero);
+		T sin_x, cos_x;
+		sincospi(half, sin_x, cos_x);
+		mismatches += !(sin_x == sign && cos_x == zero);
+	}
+
+	/* Both limbs are reduced */ {
+		// large is odd
+		const T large = trigpi_large_integer<T>();
+		mismatches += !(sinpi(large) == zero);
+		mismatches += !(cospi(large) == -one);
+		mismatches += !(sinpi(large + static_cast<T>(0.5)) == -one);
+		mismatches += !(cospi(large - static_cast<T>(0.5)) == zero);
+		// The lower limb of large * 2^64 is an even integer above 2^53
+		const T large_even = large * static_cast<T>(0x1.0p+64);
+		mismatches += !(sinpi(large_even) == zero);
+		mismatches += !(cospi(large_even) == one);
+	}
+
+	/* sin(pi/4) == cos(pi/4), so tanpi(1/4) is exactly 1 */ {
+		const T quarter = static_cast<T>(0.25);
+		mismatches += !test_bitwise_equal(sinpi(quarter), cospi(quarter));
+		mismatches += !(tanpi(quarter) == one);
+		mismatches += !(tanpi(-quarter) == -one);
+	}
+
+	/* x + 2 is exact, so the results must have the same bits */ {
+		// 0.296875 has few mantissa bits, so x - 4 is also exact in Float32x2
+		const T x = static_cast<T>(0x1.3p-2);
+		const T x_2 = x + static_cast<T>(2.0);
+		const T x_neg = x - static_cast<T>(4.0);
+		mismatches += !test_bitwise_equal(sinpi(x_2), sinpi(x));
+		mismatches += !test_bitwise_equal(cospi(x_2), cospi(x));
+		mismatches += !test_bitwise_equal(sinpi(x_neg), sinpi(x));
+		mismatches += !test_bitwise_equal(cospi(x_neg), cospi(x));
+	}
+
+	if (mismatches != 0) {
+		printf("FAIL %s sinpi/cospi: %zu results are not exact\n", name, mismatches);
+		fails++;
+	}
+	return fails;
+}
+
+/** @brief sinpi and cospi of infinity and NaN are NaN */
+template <typename T>
+static int test_trigpi_non_finite() {
+	int fails = 0;
+	const T values[3] = {
+		std::numeric_limits<T>::infinity(),
+		-std::numeric_limits<T>::infinity(),
+		std::numeric_limits<T>::quiet_NaN()
+	};
+	for (const T& x : values) {
+		fails += TEST_CHECK(isnan(sinpi(x)));
+		fails += TEST_CHECK(isnan(cospi(x)));
+	}
+	return fails;
+}
+
+#ifdef __AVX__
+/**
+ * @brief The AVX forms must give the same exact values in every lane.
+ */
+static int test_trigpi_AVX() {
+	int fails = 0;
+	/* __m256dx2 */ {
+		const Float64x2 x[4] = {
+			-3.0, 2.5, 7.0, static_cast<Float64x2>(0x1.0p+60) + static_cast<Float64x2>(0.5)
+		};
+		const fp64 sin_ref[4] = { 0.0, 1.0, 0.0, 1.0 };
+		const fp64 cos_ref[4] = { -1.0, 0.0, -1.0, 0.0 };
+		__m256dx2 sin_simd, cos_simd;
+		_mm256x2_sincospi_pdx2(_mm256x2_loadu_pdx2(x), &sin_simd, &cos_simd);
+		Float64x2 sin_x[4], cos_x[4], sinpi_x[4], cospi_x[4];
+		_mm256x2_storeu_pdx2(sin_x, sin_simd);
+		_mm256x2_storeu_pdx2(cos_x, cos_simd);
+		_mm256x2_storeu_pdx2(sinpi_x, _mm256x2_sinpi_pdx2(_mm256x2_loadu_pdx2(x)));
+		_mm256x2_storeu_pdx2(cospi_x, _mm256x2_cospi_pdx2(_mm256x2_loadu_pdx2(x)));
+		for (int lane = 0; lane < 4; lane++) {
+			fails += TEST_CHECK(sin_x[lane] == sin_ref[lane] && sinpi_x[lane] == sin_ref[lane]);
+			fails += TEST_CHECK(cos_x[lane] == cos_ref[lane] && cospi_x[lane] == cos_ref[lane]);
+		}
+	}
+	/* __m256dx4 */ {
+		const Float64x4 x[4] = { -3.0, 2.5, 7.0, -0.5 };
+		const fp64 sin_ref[4] = { 0.0, 1.0, 0.0, -1.0 };
+		const fp64 cos_ref[4] = { -1.0, 0.0, -1.0, 0.0 };
+		__m256dx4 sin_simd, cos_simd;
+		_mm256x4_sincospi_pdx4(_mm256x4_loadu_pdx4(x), &sin_simd, &cos_simd);
+		Float64x4 sin_x[4], cos_x[4];
+		_mm256x4_storeu_pdx4(sin_x, sin_simd);
+		_mm256x4_storeu_pdx4(cos_x, cos_simd);
+		for (int lane = 0; lane < 4; lane++) {
+			fails += TEST_CHECK(sin_x[lane] == sin_ref[lane]);
+			fails += TEST_CHECK(cos_x[lane] == cos_ref[lane]);
+		}
+	}
+	/* __m256x2 */ {
+		Float32x2 x[8];
+		fp32 sin_ref[8];
+		fp32 cos_ref[8];
+		for (int lane = 0; lane < 8; lane++) {
+			// -2, -1.5, ... 1.5
+			x[lane] = static_cast<fp32>(lane - 4) * 0.5f;
+			const int quarter = (lane - 4) & 3;
+			sin_ref[lane] = (quarter == 1) ? 1.0f : (quarter == 3) ? -1.0f : 0.0f;
+			cos_ref[lane] = (quarter == 0) ? 1.0f : (quarter == 2) ? -1.0f : 0.0f;
+		}
+		__m256x2 sin_simd, cos_simd;
+		_mm256x2_sincospi_psx2(_mm256x2_loadu_psx2(x), &sin_simd, &cos_simd);
+		Float32x2 sin_x[8], cos_x[8];
+		_mm256x2_storeu_psx2(sin_x, sin_simd);
+		_mm256x2_storeu_psx2(cos_x, cos_simd);
+		for (int lane = 0; lane < 8; lane++) {
+			fails += TEST_CHECK(sin_x[lane] == sin_ref[lane]);
+			fails += TEST_CHECK(cos_x[lane] == cos_ref[lane]);
+		}
+	}
+	return fails;
+}
+#endif
+
+int test_trigpi() {
+	int fails = 0;
+	fails += test_trigpi_exact<Float32x2>("Float32x2");
+	fails += test_trigpi_exact<Float64x2>("Float64x2");
+	fails += test_trigpi_exact<Float64x4>("Float64x4");
+	fails += test_trigpi_non_finite<Float64x2>();
+	fails += test_trigpi_non_finite<Float64x4>();
+	#ifdef LDF_ENABLE_FLOAT80
+		fails += test_trigpi_exact<Float80x2>("Float80x2");
+		fails += test_trigpi_non_finite<Float80x2>();
+	#endif
+	#ifdef __AVX__
+		fails += test_trigpi_AVX();
+	#endif
+	return fails;
+}